@@ -56,126 +56,23 @@
 #include "testing_ell2csr.hpp"
 #include "testing_identity.hpp"
 
+#include <algorithm>
 #include <boost/program_options.hpp>
+#include <dirent.h>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <rocsparse.h>
+#include <sstream>
 #include <stdio.h>
+#include <sys/stat.h>
+#include <vector>
 
 namespace po = boost::program_options;
 
-int main(int argc, char* argv[])
+// Dispatch a single routine to its testing harness
+static int run_function(const std::string& function, char precision, Arguments& argus)
 {
-    Arguments argus;
-    argus.unit_check = 0;
-    argus.timing     = 1;
-
-    std::string function;
-    char        precision = 's';
-
-    rocsparse_int device_id;
-
-    po::options_description desc("rocsparse client command line options");
-    desc.add_options()("help,h", "produces this help message")
-        // clang-format off
-        ("sizem,m",
-         po::value<rocsparse_int>(&argus.M)->default_value(128),
-         "Specific matrix size testing: sizem is only applicable to SPARSE-2 "
-         "& SPARSE-3: the number of rows.")
-
-        ("sizen,n",
-         po::value<rocsparse_int>(&argus.N)->default_value(128),
-         "Specific matrix/vector size testing: SPARSE-1: the length of the "
-         "dense vector. SPARSE-2 & SPARSE-3: the number of columns")
-
-        ("sizennz,z",
-         po::value<rocsparse_int>(&argus.nnz)->default_value(32),
-         "Specific vector size testing, LEVEL-1: the number of non-zero elements "
-         "of the sparse vector.")
-
-        ("mtx",
-         po::value<std::string>(&argus.filename)->default_value(""), "read from matrix "
-         "market (.mtx) format. This will override parameters m, n, and z.")
-
-        ("rocalution",
-         po::value<std::string>(&argus.rocalution)->default_value(""),
-         "read from rocalution matrix binary file.")
-
-        ("laplacian-dim",
-         po::value<rocsparse_int>(&argus.laplacian)->default_value(0), "assemble "
-         "laplacian matrix for 2D unit square with dimension <dim>. This will override "
-         "parameters m, n, z and mtx.")
-
-        ("alpha", 
-          po::value<double>(&argus.alpha)->default_value(1.0), "specifies the scalar alpha")
-
-        ("beta", 
-          po::value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
-
-        ("function,f",
-         po::value<std::string>(&function)->default_value("axpyi"),
-         "SPARSE function to test. Options:\n"
-         "  Level1: axpyi, doti, gthr, gthrz, roti, sctr\n"
-         "  Level2: coomv, csrmv, csrsv, ellmv, hybmv\n"
-         "  Level3: csrmm\n"
-         "  Preconditioner: csrilu0\n"
-         "  Conversion: csr2coo, csr2csc, csr2ell,\n"
-         "              csr2hyb, coo2csr, ell2csr\n"
-         "  Sorting: csrsort, coosort\n"
-         "  Misc: identity")
-
-        ("precision,r",
-         po::value<char>(&precision)->default_value('s'), "Options: s,d")
-
-        ("verify,v",
-         po::value<rocsparse_int>(&argus.unit_check)->default_value(0),
-         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
-
-        ("iters,i",
-         po::value<rocsparse_int>(&argus.iters)->default_value(10),
-         "Iterations to run inside timing loop")
-
-        ("device,d",
-         po::value<rocsparse_int>(&device_id)->default_value(0),
-         "Set default device to be used for subsequent program runs");
-    // clang-format on
-
-    po::variables_map vm;
-    po::store(po::parse_command_line(argc, argv, desc), vm);
-    po::notify(vm);
-
-    if(vm.count("help"))
-    {
-        std::cout << desc << std::endl;
-        return 0;
-    }
-
-    if(precision != 's' && precision != 'd')
-    {
-        fprintf(stderr, "Invalid value for --precision\n");
-        return -1;
-    }
-
-    // Device Query
-    rocsparse_int device_count = query_device_property();
-
-    if(device_count <= device_id)
-    {
-        fprintf(stderr, "Error: invalid device ID. There may not be such device ID. Will exit\n");
-        return -1;
-    }
-    else
-    {
-        set_device(device_id);
-    }
-
-    /* ============================================================================================
-     */
-    if(argus.M < 0 || argus.N < 0)
-    {
-        fprintf(stderr, "Invalid dimension\n");
-        return -1;
-    }
-
     // Level1
     if(function == "axpyi")
     {
@@ -322,5 +219,1170 @@ int main(int argc, char* argv[])
         fprintf(stderr, "Invalid value for --function\n");
         return -1;
     }
+
+    return 0;
+}
+
+// Replay a bench log captured via rocsparse_layer_mode_log_bench: every line is a
+// rocsparse-bench invocation and is re-parsed through the regular options, so a
+// production trace re-executes under timing without hand-reconstructing the workload
+static int run_replay(const std::string&       logfile,
+                      const std::string&       replay_mtx,
+                      po::options_description& desc,
+                      std::string&             function,
+                      char&                    precision,
+                      Arguments&               argus)
+{
+    std::ifstream in(logfile.c_str());
+    if(!in.is_open())
+    {
+        fprintf(stderr, "Cannot open bench log %s\n", logfile.c_str());
+        return -1;
+    }
+
+    std::string line;
+    int         lineno = 0;
+
+    while(std::getline(in, line))
+    {
+        ++lineno;
+
+        // Tokenize the captured invocation
+        std::vector<std::string> tokens;
+        std::istringstream       iss(line);
+        std::string              token;
+        while(iss >> token)
+        {
+            tokens.push_back(token);
+        }
+
+        // Drop everything up to and including the executable name; lines that do not
+        // invoke rocsparse-bench are skipped
+        size_t exe = 0;
+        while(exe < tokens.size() && tokens[exe].find("rocsparse-bench") == std::string::npos)
+        {
+            ++exe;
+        }
+
+        if(exe == tokens.size())
+        {
+            continue;
+        }
+        tokens.erase(tokens.begin(), tokens.begin() + exe + 1);
+
+        // The log emits a <matrix.mtx> placeholder for file driven calls; substitute
+        // the matrix given on the command line or fall back to a generated matrix
+        for(size_t i = 0; i < tokens.size();)
+        {
+            if(tokens[i] == "<matrix.mtx>")
+            {
+                if(!replay_mtx.empty())
+                {
+                    tokens[i] = replay_mtx;
+                    ++i;
+                }
+                else
+                {
+                    // Remove the placeholder and its preceding --mtx flag
+                    tokens.erase(tokens.begin() + i);
+                    if(i > 0 && tokens[i - 1] == "--mtx")
+                    {
+                        tokens.erase(tokens.begin() + i - 1);
+                    }
+                }
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        // Parse the replayed invocation into the regular arguments
+        try
+        {
+            po::variables_map vm;
+            po::store(po::command_line_parser(tokens).options(desc).run(), vm);
+            po::notify(vm);
+        }
+        catch(const std::exception& e)
+        {
+            fprintf(stderr, "Skipping bench log line %d: %s\n", lineno, e.what());
+            continue;
+        }
+
+        argus.unit_check = 0;
+        argus.timing     = 1;
+
+        char label[32];
+        snprintf(label, sizeof(label), "line%d", lineno);
+        bench_set_case(label);
+
+        printf("[replay] line %d: %s\n", lineno, line.c_str());
+
+        if(run_function(function, precision, argus) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+// Gather the matrix files of a sweep; path is either a directory that is
+// scanned for .mtx and .csr files or a manifest listing one path per line
+static int sweep_gather(const std::string& path, std::vector<std::string>& cases)
+{
+    struct stat st;
+    if(stat(path.c_str(), &st) != 0)
+    {
+        fprintf(stderr, "Cannot access %s\n", path.c_str());
+        return -1;
+    }
+
+    if(S_ISDIR(st.st_mode))
+    {
+        DIR* dir = opendir(path.c_str());
+        if(dir == NULL)
+        {
+            fprintf(stderr, "Cannot open directory %s\n", path.c_str());
+            return -1;
+        }
+
+        struct dirent* entry;
+        while((entry = readdir(dir)) != NULL)
+        {
+            std::string name = entry->d_name;
+            size_t      pos  = name.rfind('.');
+
+            if(pos == std::string::npos)
+            {
+                continue;
+            }
+
+            std::string ext = name.substr(pos);
+            if(ext == ".mtx" || ext == ".csr")
+            {
+                cases.push_back(path + "/" + name);
+            }
+        }
+        closedir(dir);
+    }
+    else
+    {
+        std::ifstream manifest(path.c_str());
+        std::string   line;
+        while(std::getline(manifest, line))
+        {
+            // Strip trailing whitespace and skip comments
+            while(!line.empty() && isspace(line[line.size() - 1]))
+            {
+                line.resize(line.size() - 1);
+            }
+
+            if(line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+
+            cases.push_back(line);
+        }
+    }
+
+    if(cases.empty())
+    {
+        fprintf(stderr, "No matrix files found in %s\n", path.c_str());
+        return -1;
+    }
+
+    std::sort(cases.begin(), cases.end());
+
+    return 0;
+}
+
+// Strip directory and extension to obtain the case label of a matrix file
+static std::string sweep_case_name(const std::string& path)
+{
+    size_t      slash = path.rfind('/');
+    std::string name  = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    size_t      dot   = name.rfind('.');
+
+    return (dot == std::string::npos) ? name : name.substr(0, dot);
+}
+
+// Read a baseline written by --baseline-out, i.e. the csv statistics report
+static int sweep_load_baseline(const std::string& file, std::map<std::string, double>& baseline)
+{
+    std::ifstream in(file.c_str());
+    if(!in.is_open())
+    {
+        fprintf(stderr, "Cannot open baseline file %s\n", file.c_str());
+        return -1;
+    }
+
+    std::string line;
+    std::getline(in, line); // header
+
+    while(std::getline(in, line))
+    {
+        size_t c1 = line.find(',');
+        size_t c2 = line.find(',', c1 + 1);
+        size_t c3 = line.find(',', c2 + 1);
+
+        if(c1 == std::string::npos || c2 == std::string::npos || c3 == std::string::npos)
+        {
+            continue;
+        }
+
+        baseline[line.substr(0, c1)] = atof(line.substr(c2 + 1, c3 - c2 - 1).c_str());
+    }
+
+    return 0;
+}
+
+// Run the selected routines over all matrices of a sweep on a warm device and
+// compare the median runtimes against a stored baseline
+static int run_sweep(const std::string& sweep,
+                     const std::string& functions,
+                     char               precision,
+                     Arguments&         argus,
+                     const std::string& baseline_file,
+                     const std::string& baseline_out,
+                     double             threshold)
+{
+    std::vector<std::string> cases;
+    if(sweep_gather(sweep, cases) != 0)
+    {
+        return -1;
+    }
+
+    std::map<std::string, double> baseline;
+    if(!baseline_file.empty() && sweep_load_baseline(baseline_file, baseline) != 0)
+    {
+        return -1;
+    }
+
+    // Split the comma separated routine list
+    std::vector<std::string> routines;
+    for(size_t pos = 0; pos < functions.size();)
+    {
+        size_t comma = functions.find(',', pos);
+        if(comma == std::string::npos)
+        {
+            comma = functions.size();
+        }
+
+        routines.push_back(functions.substr(pos, comma - pos));
+        pos = comma + 1;
+    }
+
+    // Keep the device and the kernel code objects warm across all cases, so
+    // that a sweep does not pay the device initialization once per matrix
+    rocsparse_handle handle;
+    rocsparse_create_handle(&handle);
+    rocsparse_initialize(handle);
+
+    int regressions = 0;
+
+    for(size_t i = 0; i < cases.size(); ++i)
+    {
+        std::string name = sweep_case_name(cases[i]);
+        bench_set_case(name);
+
+        // Route rocalution binary files and mtx files to their readers
+        bool rocalution  = cases[i].size() > 4
+                          && cases[i].compare(cases[i].size() - 4, 4, ".csr") == 0;
+        argus.filename   = rocalution ? "" : cases[i];
+        argus.rocalution = rocalution ? cases[i] : "";
+
+        for(size_t r = 0; r < routines.size(); ++r)
+        {
+            if(run_function(routines[r], precision, argus) != 0)
+            {
+                rocsparse_destroy_handle(handle);
+                return -1;
+            }
+
+            if(!baseline.empty())
+            {
+                std::string key = name + ":" + routines[r];
+                bench_stats stats = bench_query(routines[r]);
+
+                std::map<std::string, double>::const_iterator it = baseline.find(key);
+                if(it == baseline.end())
+                {
+                    printf("[sweep] %s: no baseline\n", key.c_str());
+                }
+                else if(stats.median > it->second * (1.0 + threshold / 100.0))
+                {
+                    printf("[sweep] %s: REGRESSION %0.2lfus vs %0.2lfus baseline\n",
+                           key.c_str(),
+                           stats.median,
+                           it->second);
+                    ++regressions;
+                }
+                else
+                {
+                    printf("[sweep] %s: PASS %0.2lfus vs %0.2lfus baseline\n",
+                           key.c_str(),
+                           stats.median,
+                           it->second);
+                }
+            }
+        }
+    }
+
+    rocsparse_destroy_handle(handle);
+
+    if(!baseline_out.empty())
+    {
+        bench_report("csv", baseline_out);
+    }
+
+    if(regressions > 0)
+    {
+        fprintf(stderr, "[sweep] %d regression(s) above %0.1lf%% threshold\n",
+                regressions,
+                threshold);
+        return 1;
+    }
+
+    return 0;
+}
+
+// Launch N concurrent instances of the selected routine on independent streams,
+// each with its own handle and its own copy of the matrix, mimicking the
+// co-scheduling of many small solves on one device. Calls are issued round-robin
+// across the tenants, so the streams compete for the device like independent
+// processes would. Aggregate throughput and the per-call latency distribution
+// are reported for every power-of-two tenant count up to N
+template <typename T>
+static int run_multitenant(const std::string& function, Arguments& argus, rocsparse_int tenants)
+{
+    if(function != "csrmv")
+    {
+        fprintf(stderr, "Multi-tenant mode supports --function csrmv\n");
+        return -1;
+    }
+
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int        m        = argus.M;
+    rocsparse_int        n        = argus.N;
+    rocsparse_int        nnz;
+
+    // Assemble the host matrix shared by all tenants
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T>             hval;
+
+    srand(12345ULL);
+    if(argus.rocalution != "")
+    {
+        if(read_rocalution_matrix(
+               argus.rocalution.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", argus.rocalution.c_str());
+            return -1;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcol_ind, hval, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else
+    {
+        if(argus.filename != "")
+        {
+            if(read_mtx_matrix(
+                   argus.filename.c_str(), m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", argus.filename.c_str());
+                return -1;
+            }
+        }
+        else
+        {
+            double scale = 0.02;
+            if(m > 1000 || n > 1000)
+            {
+                scale = 2.0 / std::max(m, n);
+            }
+            nnz = m * scale * n;
+
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+
+    rocsparse_init<T>(hx, 1, n);
+    rocsparse_init<T>(hy, 1, m);
+
+    T h_alpha = static_cast<T>(argus.alpha);
+    T h_beta  = static_cast<T>(argus.beta);
+
+    // Set up the tenants: own handle, own non-blocking stream, own matrix copy
+    std::vector<rocsparse_handle>    handle(tenants);
+    std::vector<hipStream_t>         stream(tenants);
+    std::vector<rocsparse_mat_descr> descr(tenants);
+    std::vector<rocsparse_int*>      dptr(tenants);
+    std::vector<rocsparse_int*>      dcol(tenants);
+    std::vector<T*>                  dval(tenants);
+    std::vector<T*>                  dx(tenants);
+    std::vector<T*>                  dy(tenants);
+
+    for(rocsparse_int t = 0; t < tenants; ++t)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_handle(&handle[t]));
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream[t], hipStreamNonBlocking));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle[t], stream[t]));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle[t], rocsparse_pointer_mode_host));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr[t]));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr[t], idx_base));
+
+        CHECK_HIP_ERROR(hipMalloc((void**)&dptr[t], sizeof(rocsparse_int) * (m + 1)));
+        CHECK_HIP_ERROR(hipMalloc((void**)&dcol[t], sizeof(rocsparse_int) * nnz));
+        CHECK_HIP_ERROR(hipMalloc((void**)&dval[t], sizeof(T) * nnz));
+        CHECK_HIP_ERROR(hipMalloc((void**)&dx[t], sizeof(T) * n));
+        CHECK_HIP_ERROR(hipMalloc((void**)&dy[t], sizeof(T) * m));
+
+        CHECK_HIP_ERROR(hipMemcpy(dptr[t],
+                                  hcsr_row_ptr.data(),
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcol[t], hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dval[t], hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx[t], hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy[t], hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    }
+
+    size_t flops = (h_alpha != static_cast<T>(1)) ? 3.0 * nnz : 2.0 * nnz;
+    flops        = (h_beta != static_cast<T>(0)) ? flops + m : flops;
+
+    printf("tenants\t\tcalls/s\t\tGFlops\t\tlat_median_us\tlat_mean_us\tlat_ci95_hi_us\n");
+
+    for(rocsparse_int active = 1; active <= tenants;
+        active = (active == tenants) ? tenants + 1 : std::min(active * 2, tenants))
+    {
+        // Warm up all active tenants
+        for(rocsparse_int iter = 0; iter < argus.warmup; ++iter)
+        {
+            for(rocsparse_int t = 0; t < active; ++t)
+            {
+                rocsparse_csrmv(handle[t],
+                                rocsparse_operation_none,
+                                m,
+                                n,
+                                nnz,
+                                &h_alpha,
+                                descr[t],
+                                dval[t],
+                                dptr[t],
+                                dcol[t],
+                                nullptr,
+                                dx[t],
+                                &h_beta,
+                                dy[t]);
+            }
+        }
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        std::vector<gpu_event_timer> timer(active);
+
+        double wall = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < argus.iters; ++iter)
+        {
+            for(rocsparse_int t = 0; t < active; ++t)
+            {
+                timer[t].start(stream[t]);
+
+                rocsparse_csrmv(handle[t],
+                                rocsparse_operation_none,
+                                m,
+                                n,
+                                nnz,
+                                &h_alpha,
+                                descr[t],
+                                dval[t],
+                                dptr[t],
+                                dcol[t],
+                                nullptr,
+                                dx[t],
+                                &h_beta,
+                                dy[t]);
+
+                timer[t].stop(stream[t]);
+            }
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        wall = get_time_us() - wall;
+
+        // Per-call latencies of all active tenants
+        std::vector<double> times;
+        for(rocsparse_int t = 0; t < active; ++t)
+        {
+            std::vector<double> tenant_times = timer[t].times_us();
+            times.insert(times.end(), tenant_times.begin(), tenant_times.end());
+        }
+
+        bench_stats stats = bench_compute_stats(times);
+
+        double total_calls   = static_cast<double>(argus.iters) * active;
+        double calls_per_sec = total_calls / (wall * 1e-6);
+        double gflops        = flops * total_calls / wall / 1e3;
+
+        printf("%7d\t\t%0.1lf\t\t%0.2lf\t\t%0.2lf\t\t%0.2lf\t\t%0.2lf\n",
+               active,
+               calls_per_sec,
+               gflops,
+               stats.median,
+               stats.mean,
+               stats.ci95_hi);
+
+        // Label the samples with the tenant count for the statistics report
+        char label[32];
+        snprintf(label, sizeof(label), "mt%d", active);
+        bench_set_case(label);
+        bench_collect(function, times);
+        bench_set_case("");
+    }
+
+    for(rocsparse_int t = 0; t < tenants; ++t)
+    {
+        CHECK_HIP_ERROR(hipFree(dptr[t]));
+        CHECK_HIP_ERROR(hipFree(dcol[t]));
+        CHECK_HIP_ERROR(hipFree(dval[t]));
+        CHECK_HIP_ERROR(hipFree(dx[t]));
+        CHECK_HIP_ERROR(hipFree(dy[t]));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr[t]));
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(handle[t]));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream[t]));
+    }
+
+    return 0;
+}
+
+// Time the complete parse-to-result SpMV pipeline instead of the kernel on
+// pre-staged device data. Every iteration re-runs upload, conversion, analysis,
+// compute and download, and each stage is reported separately, such that
+// format decisions account for the conversion and transfer cost and not only
+// for the kernel time
+template <typename T>
+static int run_pipeline(const std::string& function, const std::string& pipeline, Arguments& argus)
+{
+    if(function != "csrmv")
+    {
+        fprintf(stderr, "Pipeline mode supports --function csrmv\n");
+        return -1;
+    }
+
+    if(pipeline != "csr" && pipeline != "coo" && pipeline != "ell" && pipeline != "hyb")
+    {
+        fprintf(stderr, "Invalid value for --pipeline\n");
+        return -1;
+    }
+
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int        m        = argus.M;
+    rocsparse_int        n        = argus.N;
+    rocsparse_int        nnz;
+
+    // Assemble the host matrix, timing the parse stage
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T>             hval;
+
+    double parse_time = get_time_us();
+
+    srand(12345ULL);
+    if(argus.rocalution != "")
+    {
+        if(read_rocalution_matrix(
+               argus.rocalution.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", argus.rocalution.c_str());
+            return -1;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcol_ind, hval, idx_base);
+        nnz   = hcsr_row_ptr[m];
+    }
+    else
+    {
+        if(argus.filename != "")
+        {
+            if(read_mtx_matrix(
+                   argus.filename.c_str(), m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", argus.filename.c_str());
+                return -1;
+            }
+        }
+        else
+        {
+            double scale = 0.02;
+            if(m > 1000 || n > 1000)
+            {
+                scale = 2.0 / std::max(m, n);
+            }
+            nnz = m * scale * n;
+
+            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    parse_time = get_time_us() - parse_time;
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+
+    rocsparse_init<T>(hx, 1, n);
+    rocsparse_init<T>(hy, 1, m);
+
+    T h_alpha = static_cast<T>(argus.alpha);
+    T h_beta  = static_cast<T>(argus.beta);
+
+    rocsparse_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_create_handle(&handle));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    rocsparse_mat_descr descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Device buffers of the uploaded CSR matrix and the vectors. The
+    // allocations are reused across iterations, production pipelines cache
+    // them the same way
+    rocsparse_int* dptr;
+    rocsparse_int* dcol;
+    T*             dval;
+    T*             dx;
+    T*             dy;
+
+    CHECK_HIP_ERROR(hipMalloc((void**)&dptr, sizeof(rocsparse_int) * (m + 1)));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dcol, sizeof(rocsparse_int) * nnz));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dval, sizeof(T) * nnz));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dx, sizeof(T) * n));
+    CHECK_HIP_ERROR(hipMalloc((void**)&dy, sizeof(T) * m));
+
+    // COO row indices, only required by the coo pipeline
+    rocsparse_int* dcoo_row_ind = NULL;
+    if(pipeline == "coo")
+    {
+        CHECK_HIP_ERROR(hipMalloc((void**)&dcoo_row_ind, sizeof(rocsparse_int) * nnz));
+    }
+
+    std::vector<double> upload_times;
+    std::vector<double> convert_times;
+    std::vector<double> analyze_times;
+    std::vector<double> compute_times;
+    std::vector<double> download_times;
+    std::vector<double> end2end_times;
+
+    std::vector<T> hy_result(m);
+
+    for(rocsparse_int iter = 0; iter < argus.warmup + argus.iters; ++iter)
+    {
+        bool timed = iter >= argus.warmup;
+
+        // Upload stage
+        double time = get_time_us();
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        double upload = get_time_us() - time;
+
+        // Per-iteration format resources
+        rocsparse_int*    dell_col_ind = NULL;
+        T*                dell_val     = NULL;
+        rocsparse_int     ell_width    = 0;
+        rocsparse_hyb_mat hyb          = NULL;
+        rocsparse_mat_info info        = NULL;
+
+        // Convert stage
+        time = get_time_us();
+
+        if(pipeline == "coo")
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csr2coo(handle, dptr, nnz, m, dcoo_row_ind, idx_base));
+        }
+        else if(pipeline == "ell")
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csr2ell_width(handle, m, descr, dptr, descr, &ell_width));
+
+            CHECK_HIP_ERROR(
+                hipMalloc((void**)&dell_col_ind, sizeof(rocsparse_int) * ell_width * m));
+            CHECK_HIP_ERROR(hipMalloc((void**)&dell_val, sizeof(T) * ell_width * m));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2ell(
+                handle, m, descr, dval, dptr, dcol, descr, ell_width, dell_val, dell_col_ind));
+        }
+        else if(pipeline == "hyb")
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_create_hyb_mat(&hyb));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(
+                handle, m, n, descr, dval, dptr, dcol, hyb, 0, rocsparse_hyb_partition_auto));
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        double convert = get_time_us() - time;
+
+        // Analyze stage
+        time = get_time_us();
+
+        if(pipeline == "csr")
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+                handle, rocsparse_operation_none, m, n, nnz, descr, dval, dptr, dcol, info));
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        double analyze = get_time_us() - time;
+
+        // Compute stage
+        time = get_time_us();
+
+        if(pipeline == "csr")
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                                  rocsparse_operation_none,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy));
+        }
+        else if(pipeline == "coo")
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_coomv(handle,
+                                                  rocsparse_operation_none,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dval,
+                                                  dcoo_row_ind,
+                                                  dcol,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy));
+        }
+        else if(pipeline == "ell")
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_ellmv(handle,
+                                                  rocsparse_operation_none,
+                                                  m,
+                                                  n,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dell_val,
+                                                  dell_col_ind,
+                                                  ell_width,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy));
+        }
+        else
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_hybmv(
+                handle, rocsparse_operation_none, &h_alpha, descr, hyb, dx, &h_beta, dy));
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        double compute = get_time_us() - time;
+
+        // Download stage
+        time = get_time_us();
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_result.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        double download = get_time_us() - time;
+
+        // Release the per-iteration format resources outside the timing
+        if(info != NULL)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info));
+        }
+        if(hyb != NULL)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_hyb_mat(hyb));
+        }
+        if(dell_col_ind != NULL)
+        {
+            CHECK_HIP_ERROR(hipFree(dell_col_ind));
+        }
+        if(dell_val != NULL)
+        {
+            CHECK_HIP_ERROR(hipFree(dell_val));
+        }
+
+        if(timed)
+        {
+            upload_times.push_back(upload);
+            convert_times.push_back(convert);
+            analyze_times.push_back(analyze);
+            compute_times.push_back(compute);
+            download_times.push_back(download);
+            end2end_times.push_back(upload + convert + analyze + compute + download);
+        }
+    }
+
+    printf("[pipeline] %s SpMV, m %d, n %d, nnz %d, parse %0.2lfus\n",
+           pipeline.c_str(),
+           m,
+           n,
+           nnz,
+           parse_time);
+    printf("stage\t\tmedian_us\tmean_us\t\tci95_hi_us\n");
+
+    const char*          names[] = {"upload", "convert", "analyze", "compute", "download",
+                                    "end2end"};
+    std::vector<double>* samples[]
+        = {&upload_times, &convert_times, &analyze_times, &compute_times, &download_times,
+           &end2end_times};
+
+    bench_set_case("pipeline-" + pipeline);
+
+    for(int s = 0; s < 6; ++s)
+    {
+        bench_stats stats = bench_compute_stats(*samples[s]);
+
+        printf("%-8s\t%0.2lf\t\t%0.2lf\t\t%0.2lf\n",
+               names[s],
+               stats.median,
+               stats.mean,
+               stats.ci95_hi);
+
+        bench_collect(names[s], *samples[s]);
+    }
+
+    bench_set_case("");
+
+    if(dcoo_row_ind != NULL)
+    {
+        CHECK_HIP_ERROR(hipFree(dcoo_row_ind));
+    }
+    CHECK_HIP_ERROR(hipFree(dptr));
+    CHECK_HIP_ERROR(hipFree(dcol));
+    CHECK_HIP_ERROR(hipFree(dval));
+    CHECK_HIP_ERROR(hipFree(dx));
+    CHECK_HIP_ERROR(hipFree(dy));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr));
+    CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(handle));
+
     return 0;
 }
+
+int main(int argc, char* argv[])
+{
+    Arguments argus;
+    argus.unit_check = 0;
+    argus.timing     = 1;
+
+    std::string function;
+    std::string format;
+    std::string bench_out;
+    std::string sweep;
+    std::string replay;
+    std::string replay_mtx;
+    std::string baseline;
+    std::string baseline_out;
+    std::string pipeline;
+    double      threshold;
+    char        precision = 's';
+
+    rocsparse_int multitenant;
+
+    rocsparse_int device_id;
+
+    po::options_description desc("rocsparse client command line options");
+    desc.add_options()("help,h", "produces this help message")
+        // clang-format off
+        ("sizem,m",
+         po::value<rocsparse_int>(&argus.M)->default_value(128),
+         "Specific matrix size testing: sizem is only applicable to SPARSE-2 "
+         "& SPARSE-3: the number of rows.")
+
+        ("sizen,n",
+         po::value<rocsparse_int>(&argus.N)->default_value(128),
+         "Specific matrix/vector size testing: SPARSE-1: the length of the "
+         "dense vector. SPARSE-2 & SPARSE-3: the number of columns")
+
+        ("sizennz,z",
+         po::value<rocsparse_int>(&argus.nnz)->default_value(32),
+         "Specific vector size testing, LEVEL-1: the number of non-zero elements "
+         "of the sparse vector.")
+
+        ("mtx",
+         po::value<std::string>(&argus.filename)->default_value(""), "read from matrix "
+         "market (.mtx) format. This will override parameters m, n, and z.")
+
+        ("rocalution",
+         po::value<std::string>(&argus.rocalution)->default_value(""),
+         "read from rocalution matrix binary file.")
+
+        ("laplacian-dim",
+         po::value<rocsparse_int>(&argus.laplacian)->default_value(0), "assemble "
+         "laplacian matrix for 2D unit square with dimension <dim>. This will override "
+         "parameters m, n, z and mtx.")
+
+        ("stencil",
+         po::value<rocsparse_int>(&argus.stencil)->default_value(5),
+         "stencil type of the assembled laplacian matrix. Options: 5 (2D 5-point), "
+         "7 (3D 7-point), 27 (3D 27-point), 0 (anisotropic banded matrix with "
+         "laplacian-dim rows)")
+
+        ("bandwidth",
+         po::value<rocsparse_int>(&argus.bandwidth)->default_value(64),
+         "bandwidth of the anisotropic banded matrix (stencil 0)")
+
+        ("ndiag",
+         po::value<rocsparse_int>(&argus.ndiag)->default_value(4),
+         "number of off-diagonal pairs of the anisotropic banded matrix (stencil 0)")
+
+        ("alpha",
+          po::value<double>(&argus.alpha)->default_value(1.0), "specifies the scalar alpha")
+
+        ("beta",
+          po::value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
+
+        ("function,f",
+         po::value<std::string>(&function)->default_value("axpyi"),
+         "SPARSE function to test. Options:\n"
+         "  Level1: axpyi, doti, gthr, gthrz, roti, sctr\n"
+         "  Level2: coomv, csrmv, csrsv, ellmv, hybmv\n"
+         "  Level3: csrmm\n"
+         "  Preconditioner: csrilu0\n"
+         "  Conversion: csr2coo, csr2csc, csr2ell,\n"
+         "              csr2hyb, coo2csr, ell2csr\n"
+         "  Sorting: csrsort, coosort\n"
+         "  Misc: identity\n"
+         "In sweep mode, a comma separated list of functions")
+
+        ("precision,r",
+         po::value<char>(&precision)->default_value('s'), "Options: s,d")
+
+        ("verify,v",
+         po::value<rocsparse_int>(&argus.unit_check)->default_value(0),
+         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
+
+        ("iters,i",
+         po::value<rocsparse_int>(&argus.iters)->default_value(10),
+         "Iterations to run inside timing loop")
+
+        ("warmup,w",
+         po::value<rocsparse_int>(&argus.warmup)->default_value(2),
+         "Warm-up iterations to run before the timing loop")
+
+        ("format",
+         po::value<std::string>(&format)->default_value(""),
+         "Report timing statistics (median, stddev, 95% confidence interval) "
+         "in machine-readable form. Options: csv, json")
+
+        ("bench-out",
+         po::value<std::string>(&bench_out)->default_value(""),
+         "Write the statistics report to the given file instead of stdout")
+
+        ("sweep",
+         po::value<std::string>(&sweep)->default_value(""),
+         "Run the selected function(s) over a collection of matrices, given "
+         "either as a directory containing .mtx/.csr files or as a manifest "
+         "file listing one matrix path per line. The device and handle stay "
+         "warm across all cases")
+
+        ("replay",
+         po::value<std::string>(&replay)->default_value(""),
+         "Replay a bench log captured with rocsparse_layer_mode_log_bench: "
+         "every line of the file is re-executed under timing")
+
+        ("replay-mtx",
+         po::value<std::string>(&replay_mtx)->default_value(""),
+         "Matrix file substituted for the <matrix.mtx> placeholder of replayed "
+         "bench log lines; without it, replay falls back to generated matrices")
+
+        ("baseline",
+         po::value<std::string>(&baseline)->default_value(""),
+         "Baseline csv file (written by --baseline-out) to diff the sweep "
+         "results against")
+
+        ("baseline-out",
+         po::value<std::string>(&baseline_out)->default_value(""),
+         "Write the sweep results as a new baseline csv file")
+
+        ("threshold",
+         po::value<double>(&threshold)->default_value(5.0),
+         "Slow-down in percent over the baseline median that counts as a "
+         "regression")
+
+        ("pipeline",
+         po::value<std::string>(&pipeline)->default_value(""),
+         "Time the complete parse-to-result SpMV pipeline in the given storage "
+         "format instead of the kernel on pre-staged device data. Every "
+         "iteration re-runs upload, conversion, analysis, compute and download "
+         "and each stage is reported separately. Options: csr, coo, ell, hyb")
+
+        ("multitenant",
+         po::value<rocsparse_int>(&multitenant)->default_value(0),
+         "Launch the given number of concurrent instances of the selected "
+         "function on independent streams, each with its own handle and "
+         "matrix copy, and report aggregate throughput and per-call latency "
+         "for every power-of-two tenant count. 0 disables the mode")
+
+        ("device,d",
+         po::value<rocsparse_int>(&device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs");
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(precision != 's' && precision != 'd')
+    {
+        fprintf(stderr, "Invalid value for --precision\n");
+        return -1;
+    }
+
+    if(format != "" && format != "csv" && format != "json")
+    {
+        fprintf(stderr, "Invalid value for --format\n");
+        return -1;
+    }
+
+    if(argus.iters < 1 || argus.warmup < 0)
+    {
+        fprintf(stderr, "Invalid value for --iters or --warmup\n");
+        return -1;
+    }
+
+    if(argus.stencil != 0 && argus.stencil != 5 && argus.stencil != 7 && argus.stencil != 27)
+    {
+        fprintf(stderr, "Invalid value for --stencil\n");
+        return -1;
+    }
+
+    // Device Query
+    rocsparse_int device_count = query_device_property();
+
+    if(device_count <= device_id)
+    {
+        fprintf(stderr, "Error: invalid device ID. There may not be such device ID. Will exit\n");
+        return -1;
+    }
+    else
+    {
+        set_device(device_id);
+    }
+
+    // Peak memory bandwidth of the selected device, for roofline reporting
+    bench_set_peak_bandwidth(device_peak_bandwidth(device_id));
+
+    /* ============================================================================================
+     */
+    if(argus.M < 0 || argus.N < 0)
+    {
+        fprintf(stderr, "Invalid dimension\n");
+        return -1;
+    }
+
+    int ret;
+
+    if(!replay.empty())
+    {
+        ret = run_replay(replay, replay_mtx, desc, function, precision, argus);
+    }
+    else if(!sweep.empty())
+    {
+        ret = run_sweep(sweep, function, precision, argus, baseline, baseline_out, threshold);
+    }
+    else if(multitenant > 0)
+    {
+        ret = (precision == 's') ? run_multitenant<float>(function, argus, multitenant)
+                                 : run_multitenant<double>(function, argus, multitenant);
+    }
+    else if(!pipeline.empty())
+    {
+        ret = (precision == 's') ? run_pipeline<float>(function, pipeline, argus)
+                                 : run_pipeline<double>(function, pipeline, argus);
+    }
+    else
+    {
+        ret = run_function(function, precision, argus);
+    }
+
+    if(ret < 0)
+    {
+        return ret;
+    }
+
+    // Summarize the per-iteration samples collected by the testing harness
+    bench_report(format, bench_out);
+
+    return ret;
+}
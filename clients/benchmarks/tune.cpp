@@ -0,0 +1,335 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* Offline autotuner for the pre-instantiated kernel parameter variants.
+ *
+ * The adaptive csrmv kernel ships three pre-instantiated tuning variants
+ * whose row block packing and workgroup shape differ. The library selects
+ * one of them per device architecture from a built-in table. This client
+ * sweeps all variants over a set of user supplied matrices and writes the
+ * fastest one into a selection table, which the library loads at handle
+ * creation when the ROCSPARSE_TUNING_TABLE environment variable names it.
+ * Run it once per hardware generation on representative matrices:
+ *
+ *   rocsparse-tune --matrix a.mtx --matrix b.mtx --output rocsparse.tune
+ *   ROCSPARSE_TUNING_TABLE=rocsparse.tune ./application
+ */
+
+#include "utility.hpp"
+
+#include <boost/program_options.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <iostream>
+#include <rocsparse.h>
+#include <string>
+#include <vector>
+
+namespace po = boost::program_options;
+
+#define CHECK_ROCSPARSE(stat)                                                  \
+    do                                                                         \
+    {                                                                          \
+        if((stat) != rocsparse_status_success)                                 \
+        {                                                                      \
+            fprintf(stderr, "rocSPARSE error in %s line %d\n", __FILE__, __LINE__); \
+            return -1;                                                         \
+        }                                                                      \
+    } while(0)
+
+#define CHECK_HIP(stat)                                                        \
+    do                                                                         \
+    {                                                                          \
+        if((stat) != hipSuccess)                                               \
+        {                                                                      \
+            fprintf(stderr, "HIP error in %s line %d\n", __FILE__, __LINE__);  \
+            return -1;                                                         \
+        }                                                                      \
+    } while(0)
+
+// One matrix in CSR format on the host
+struct csr_matrix
+{
+    rocsparse_int               m;
+    rocsparse_int               n;
+    rocsparse_int               nnz;
+    std::vector<rocsparse_int>  row_ptr;
+    std::vector<rocsparse_int>  col_ind;
+    std::vector<double>         val;
+};
+
+// Load an mtx file and convert it to CSR
+static int load_matrix(const std::string& filename, csr_matrix& mat)
+{
+    std::vector<rocsparse_int> coo_row_ind;
+
+    if(read_mtx_matrix(filename.c_str(),
+                       mat.m,
+                       mat.n,
+                       mat.nnz,
+                       coo_row_ind,
+                       mat.col_ind,
+                       mat.val,
+                       rocsparse_index_base_zero)
+       != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+        return -1;
+    }
+
+    // Convert COO to CSR
+    mat.row_ptr.assign(mat.m + 1, 0);
+
+    for(rocsparse_int i = 0; i < mat.nnz; ++i)
+    {
+        ++mat.row_ptr[coo_row_ind[i] + 1];
+    }
+
+    for(rocsparse_int i = 0; i < mat.m; ++i)
+    {
+        mat.row_ptr[i + 1] += mat.row_ptr[i];
+    }
+
+    return 0;
+}
+
+// Time the adaptive csrmv of a matrix with the currently selected tuning
+// variant, returning the average time per call in microseconds
+static int time_csrmv(const csr_matrix& mat, int iters, double* time)
+{
+    rocsparse_handle handle;
+    CHECK_ROCSPARSE(rocsparse_create_handle(&handle));
+
+    rocsparse_mat_descr descr;
+    CHECK_ROCSPARSE(rocsparse_create_mat_descr(&descr));
+
+    rocsparse_mat_info info;
+    CHECK_ROCSPARSE(rocsparse_create_mat_info(&info));
+
+    rocsparse_int* dptr;
+    rocsparse_int* dcol;
+    double*        dval;
+    double*        dx;
+    double*        dy;
+
+    CHECK_HIP(hipMalloc((void**)&dptr, sizeof(rocsparse_int) * (mat.m + 1)));
+    CHECK_HIP(hipMalloc((void**)&dcol, sizeof(rocsparse_int) * mat.nnz));
+    CHECK_HIP(hipMalloc((void**)&dval, sizeof(double) * mat.nnz));
+    CHECK_HIP(hipMalloc((void**)&dx, sizeof(double) * mat.n));
+    CHECK_HIP(hipMalloc((void**)&dy, sizeof(double) * mat.m));
+
+    CHECK_HIP(hipMemcpy(dptr,
+                        mat.row_ptr.data(),
+                        sizeof(rocsparse_int) * (mat.m + 1),
+                        hipMemcpyHostToDevice));
+    CHECK_HIP(hipMemcpy(
+        dcol, mat.col_ind.data(), sizeof(rocsparse_int) * mat.nnz, hipMemcpyHostToDevice));
+    CHECK_HIP(hipMemcpy(dval, mat.val.data(), sizeof(double) * mat.nnz, hipMemcpyHostToDevice));
+
+    std::vector<double> hx(mat.n);
+    rocsparse_init(hx, 1, mat.n);
+
+    CHECK_HIP(hipMemcpy(dx, hx.data(), sizeof(double) * mat.n, hipMemcpyHostToDevice));
+    CHECK_HIP(hipMemset(dy, 0, sizeof(double) * mat.m));
+
+    double alpha = 1.0;
+    double beta  = 0.0;
+
+    CHECK_ROCSPARSE(rocsparse_dcsrmv_analysis(handle,
+                                              rocsparse_operation_none,
+                                              mat.m,
+                                              mat.n,
+                                              mat.nnz,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              info));
+
+    // Warm up
+    for(int i = 0; i < 10; ++i)
+    {
+        CHECK_ROCSPARSE(rocsparse_dcsrmv(handle,
+                                         rocsparse_operation_none,
+                                         mat.m,
+                                         mat.n,
+                                         mat.nnz,
+                                         &alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         info,
+                                         dx,
+                                         &beta,
+                                         dy));
+    }
+    CHECK_HIP(hipDeviceSynchronize());
+
+    double start = get_time_us();
+
+    for(int i = 0; i < iters; ++i)
+    {
+        CHECK_ROCSPARSE(rocsparse_dcsrmv(handle,
+                                         rocsparse_operation_none,
+                                         mat.m,
+                                         mat.n,
+                                         mat.nnz,
+                                         &alpha,
+                                         descr,
+                                         dval,
+                                         dptr,
+                                         dcol,
+                                         info,
+                                         dx,
+                                         &beta,
+                                         dy));
+    }
+    CHECK_HIP(hipDeviceSynchronize());
+
+    *time = (get_time_us() - start) / iters;
+
+    CHECK_HIP(hipFree(dptr));
+    CHECK_HIP(hipFree(dcol));
+    CHECK_HIP(hipFree(dval));
+    CHECK_HIP(hipFree(dx));
+    CHECK_HIP(hipFree(dy));
+
+    CHECK_ROCSPARSE(rocsparse_destroy_mat_info(info));
+    CHECK_ROCSPARSE(rocsparse_destroy_mat_descr(descr));
+    CHECK_ROCSPARSE(rocsparse_destroy_handle(handle));
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> matrices;
+    std::string              output;
+    int                      iters;
+
+    po::options_description desc("rocsparse-tune command line options");
+    desc.add_options()("help,h", "produces this help message")
+
+        ("matrix,m",
+         po::value<std::vector<std::string>>(&matrices)->composing(),
+         "mtx matrix file to tune on, can be given multiple times")
+
+        ("output,o",
+         po::value<std::string>(&output)->default_value("rocsparse.tune"),
+         "selection table file, appended to if it exists")
+
+        ("iters,i",
+         po::value<int>(&iters)->default_value(100),
+         "number of timed csrmv calls per matrix and variant");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if(vm.count("help") || matrices.empty())
+    {
+        std::cout << desc << std::endl;
+        return matrices.empty() ? -1 : 0;
+    }
+
+    // Load all matrices up front
+    std::vector<csr_matrix> mats(matrices.size());
+
+    for(size_t i = 0; i < matrices.size(); ++i)
+    {
+        if(load_matrix(matrices[i], mats[i]) != 0)
+        {
+            return -1;
+        }
+    }
+
+    hipDeviceProp_t prop;
+    CHECK_HIP(hipGetDeviceProperties(&prop, 0));
+
+    printf("Tuning csrmv_adaptive on %s (gcnArch %d), %zu matrices, %d iterations\n",
+           prop.name,
+           prop.gcnArch,
+           mats.size(),
+           iters);
+
+    // Sweep the pre-instantiated variants. The override is read at handle
+    // creation, hence each variant runs with its own handle
+    static const int num_variants = 4;
+
+    int    best_variant = 0;
+    double best_time    = 0.0;
+
+    for(int variant = 0; variant < num_variants; ++variant)
+    {
+        char str_variant[16];
+        snprintf(str_variant, sizeof(str_variant), "%d", variant);
+        setenv("ROCSPARSE_CSRMV_TUNING", str_variant, 1);
+
+        double total = 0.0;
+
+        for(size_t i = 0; i < mats.size(); ++i)
+        {
+            double time;
+            if(time_csrmv(mats[i], iters, &time) != 0)
+            {
+                return -1;
+            }
+
+            total += time;
+        }
+
+        printf("  variant %d: %0.2f us total\n", variant, total);
+
+        if(variant == 0 || total < best_time)
+        {
+            best_variant = variant;
+            best_time    = total;
+        }
+    }
+
+    unsetenv("ROCSPARSE_CSRMV_TUNING");
+
+    // Append the selection to the table. The library picks the last
+    // matching line, hence re-tuning overrides earlier entries
+    FILE* f = fopen(output.c_str(), "a");
+    if(f == NULL)
+    {
+        fprintf(stderr, "Cannot open [write] %s\n", output.c_str());
+        return -1;
+    }
+
+    if(ftell(f) == 0)
+    {
+        fprintf(f, "# rocSPARSE kernel parameter selection table\n");
+        fprintf(f, "# <gcnArch> <routine> <variant>\n");
+    }
+
+    fprintf(f, "%d csrmv_adaptive %d\n", prop.gcnArch, best_variant);
+    fclose(f);
+
+    printf("Selected variant %d, written to %s\n", best_variant, output.c_str());
+
+    return 0;
+}
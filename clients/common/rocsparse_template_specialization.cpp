@@ -516,194 +516,1160 @@ namespace rocsparse
         return rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
     }
 
+    template <>
+    rocsparse_status rocsparse_bsrmv(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_bsr_mat   bsr,
+                                     const float*              x,
+                                     const float*              beta,
+                                     float*                    y)
+    {
+        return rocsparse_sbsrmv(handle, trans, alpha, descr, bsr, x, beta, y);
+    }
+
+    template <>
+    rocsparse_status rocsparse_bsrmv(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_bsr_mat   bsr,
+                                     const double*             x,
+                                     const double*             beta,
+                                     double*                   y)
+    {
+        return rocsparse_dbsrmv(handle, trans, alpha, descr, bsr, x, beta, y);
+    }
+
+    template <>
+    rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      const float*              alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_dcsr_mat  dcsr,
+                                      const float*              x,
+                                      const float*              beta,
+                                      float*                    y)
+    {
+        return rocsparse_sdcsrmv(handle, trans, alpha, descr, dcsr, x, beta, y);
+    }
+
+    template <>
+    rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      const double*             alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_dcsr_mat  dcsr,
+                                      const double*             x,
+                                      const double*             beta,
+                                      double*                   y)
+    {
+        return rocsparse_ddcsrmv(handle, trans, alpha, descr, dcsr, x, beta, y);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const float*              B,
+                                     rocsparse_int             ldb,
+                                     const float*              beta,
+                                     float*                    C,
+                                     rocsparse_int             ldc)
+    {
+        return rocsparse_scsrmm(handle,
+                                trans_A,
+                                trans_B,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                B,
+                                ldb,
+                                beta,
+                                C,
+                                ldc);
+    }
+
     template <>
     rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
                                      rocsparse_operation       trans_A,
                                      rocsparse_operation       trans_B,
                                      rocsparse_int             m,
-                                     rocsparse_int             n,
-                                     rocsparse_int             k,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const double*             B,
+                                     rocsparse_int             ldb,
+                                     const double*             beta,
+                                     double*                   C,
+                                     rocsparse_int             ldc)
+    {
+        return rocsparse_dcsrmm(handle,
+                                trans_A,
+                                trans_B,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                B,
+                                ldb,
+                                beta,
+                                C,
+                                ldc);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const float*              x,
+                                           rocsparse_int             ldx,
+                                           float*                    y,
+                                           rocsparse_int             ldy,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+    {
+        return rocsparse_scsrsm_solve(handle,
+                                      trans,
+                                      m,
+                                      nrhs,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      ldx,
+                                      y,
+                                      ldy,
+                                      policy,
+                                      temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const double*             x,
+                                           rocsparse_int             ldx,
+                                           double*                   y,
+                                           rocsparse_int             ldy,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+    {
+        return rocsparse_dcsrsm_solve(handle,
+                                      trans,
+                                      m,
+                                      nrhs,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      ldx,
+                                      y,
+                                      ldy,
+                                      policy,
+                                      temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const float*              csr_val_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const float*              csr_val_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       float*                    csr_val_C,
+                                       const rocsparse_int*      csr_row_ptr_C,
+                                       rocsparse_int*            csr_col_ind_C,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_scsrgemm(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  n,
+                                  k,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C,
+                                  temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const double*             csr_val_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const double*             csr_val_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       double*                   csr_val_C,
+                                       const rocsparse_int*      csr_row_ptr_C,
+                                       rocsparse_int*            csr_col_ind_C,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_dcsrgemm(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  n,
+                                  k,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C,
+                                  temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const float*              csr_val_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const float*              beta,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const float*              csr_val_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       float*                    csr_val_C,
+                                       const rocsparse_int*      csr_row_ptr_C,
+                                       rocsparse_int*            csr_col_ind_C)
+    {
+        return rocsparse_scsrgeam(handle,
+                                  m,
+                                  n,
+                                  alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  beta,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const double*             alpha,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const double*             csr_val_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const double*             beta,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const double*             csr_val_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       double*                   csr_val_C,
+                                       const rocsparse_int*      csr_row_ptr_C,
+                                       rocsparse_int*            csr_col_ind_C)
+    {
+        return rocsparse_dcsrgeam(handle,
+                                  m,
+                                  n,
+                                  alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  beta,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C);
+    }
+
+    template <>
+    rocsparse_status rocsparse_sddmm(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const float*              alpha,
+                                     const float*              A,
+                                     rocsparse_int             lda,
+                                     const float*              B,
+                                     rocsparse_int             ldb,
+                                     const float*              beta,
+                                     const rocsparse_mat_descr descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind)
+    {
+        return rocsparse_ssddmm(handle,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                beta,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind);
+    }
+
+    template <>
+    rocsparse_status rocsparse_sddmm(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const double*             alpha,
+                                     const double*             A,
+                                     rocsparse_int             lda,
+                                     const double*             B,
+                                     rocsparse_int             ldb,
+                                     const double*             beta,
+                                     const rocsparse_mat_descr descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind)
+    {
+        return rocsparse_dsddmm(handle,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                beta,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind);
+    }
+
+    template <>
+    rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const float*              alpha,
+                                     const float*              A,
+                                     rocsparse_int             lda,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const float*              beta,
+                                     float*                    C,
+                                     rocsparse_int             ldc)
+    {
+        return rocsparse_sgemmi(handle,
+                                trans_A,
+                                trans_B,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                A,
+                                lda,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                beta,
+                                C,
+                                ldc);
+    }
+
+    template <>
+    rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const double*             alpha,
+                                     const double*             A,
+                                     rocsparse_int             lda,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const double*             beta,
+                                     double*                   C,
+                                     rocsparse_int             ldc)
+    {
+        return rocsparse_dgemmi(handle,
+                                trans_A,
+                                trans_B,
+                                m,
+                                n,
+                                k,
+                                nnz,
+                                alpha,
+                                A,
+                                lda,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                beta,
+                                C,
+                                ldc);
+    }
+
+    template <>
+    rocsparse_status rocsparse_s24mm(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              s24_val,
+                                     const unsigned char*      s24_meta,
+                                     const float*              B,
+                                     rocsparse_int             ldb,
+                                     const float*              beta,
+                                     float*                    C,
+                                     rocsparse_int             ldc)
+    {
+        return rocsparse_ss24mm(
+            handle, trans_A, trans_B, m, n, k, alpha, descr, s24_val, s24_meta, B, ldb, beta, C, ldc);
+    }
+
+    template <>
+    rocsparse_status rocsparse_s24mm(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             s24_val,
+                                     const unsigned char*      s24_meta,
+                                     const double*             B,
+                                     rocsparse_int             ldb,
+                                     const double*             beta,
+                                     double*                   C,
+                                     rocsparse_int             ldc)
+    {
+        return rocsparse_ds24mm(
+            handle, trans_A, trans_B, m, n, k, alpha, descr, s24_val, s24_meta, B, ldb, beta, C, ldc);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float*              csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   size_t*                   buffer_size)
+    {
+        return rocsparse_scsrilu0_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double*             csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   size_t*                   buffer_size)
+    {
+        return rocsparse_dcsrilu0_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_analysis_policy analysis,
+                                                rocsparse_solve_policy    solve,
+                                                void*                     temp_buffer)
+    {
+        return rocsparse_scsrilu0_analysis(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           analysis,
+                                           solve,
+                                           temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_analysis_policy analysis,
+                                                rocsparse_solve_policy    solve,
+                                                void*                     temp_buffer)
+    {
+        return rocsparse_dcsrilu0_analysis(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           analysis,
+                                           solve,
+                                           temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       float*                    csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_scsrilu0(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       double*                   csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_dcsrilu0(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  size_t*                   buffer_size)
+    {
+        return rocsparse_scsric0_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  size_t*                   buffer_size)
+    {
+        return rocsparse_dcsric0_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_analysis_policy analysis,
+                                               rocsparse_solve_policy    solve,
+                                               void*                     temp_buffer)
+    {
+        return rocsparse_scsric0_analysis(handle,
+                                          m,
+                                          nnz,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_analysis_policy analysis,
+                                               rocsparse_solve_policy    solve,
+                                               void*                     temp_buffer)
+    {
+        return rocsparse_dcsric0_analysis(handle,
+                                          m,
+                                          nnz,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          analysis,
+                                          solve,
+                                          temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_solve_policy    policy,
+                                      void*                     temp_buffer)
+    {
+        return rocsparse_scsric0(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_solve_policy    policy,
+                                      void*                     temp_buffer)
+    {
+        return rocsparse_dcsric0(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csriluk_buffer_size(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float*              csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   size_t*                   buffer_size)
+    {
+        return rocsparse_scsriluk_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csriluk_buffer_size(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double*             csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   size_t*                   buffer_size)
+    {
+        return rocsparse_dcsriluk_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       float*                    iluk_val,
+                                       const rocsparse_int*      iluk_row_ptr,
+                                       rocsparse_int*            iluk_col_ind,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_scsriluk(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  iluk_val,
+                                  iluk_row_ptr,
+                                  iluk_col_ind,
+                                  policy,
+                                  temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       double*                   iluk_val,
+                                       const rocsparse_int*      iluk_row_ptr,
+                                       rocsparse_int*            iluk_col_ind,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+    {
+        return rocsparse_dcsriluk(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  iluk_val,
+                                  iluk_row_ptr,
+                                  iluk_col_ind,
+                                  policy,
+                                  temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const float*              tol,
+                                           rocsparse_int             max_fill,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_int*            ilut_row_ptr,
+                                           rocsparse_int*            ilut_nnz)
+    {
+        return rocsparse_scsrilut_nnz(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      tol,
+                                      max_fill,
+                                      info,
+                                      ilut_row_ptr,
+                                      ilut_nnz);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const double*             tol,
+                                           rocsparse_int             max_fill,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_int*            ilut_row_ptr,
+                                           rocsparse_int*            ilut_nnz)
+    {
+        return rocsparse_dcsrilut_nnz(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      tol,
+                                      max_fill,
+                                      info,
+                                      ilut_row_ptr,
+                                      ilut_nnz);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilut(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       const rocsparse_mat_descr descr,
+                                       rocsparse_mat_info        info,
+                                       float*                    ilut_val,
+                                       const rocsparse_int*      ilut_row_ptr,
+                                       rocsparse_int*            ilut_col_ind)
+    {
+        return rocsparse_scsrilut(handle, m, descr, info, ilut_val, ilut_row_ptr, ilut_col_ind);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrilut(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       const rocsparse_mat_descr descr,
+                                       rocsparse_mat_info        info,
+                                       double*                   ilut_val,
+                                       const rocsparse_int*      ilut_row_ptr,
+                                       rocsparse_int*            ilut_col_ind)
+    {
+        return rocsparse_dcsrilut(handle, m, descr, info, ilut_val, ilut_row_ptr, ilut_col_ind);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrcg_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size)
+    {
+        return rocsparse_scsrcg_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrcg_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size)
+    {
+        return rocsparse_dcsrcg_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csrcg(rocsparse_handle          handle,
+                                     rocsparse_int             m,
                                      rocsparse_int             nnz,
-                                     const float*              alpha,
                                      const rocsparse_mat_descr descr,
                                      const float*              csr_val,
                                      const rocsparse_int*      csr_row_ptr,
                                      const rocsparse_int*      csr_col_ind,
-                                     const float*              B,
-                                     rocsparse_int             ldb,
-                                     const float*              beta,
-                                     float*                    C,
-                                     rocsparse_int             ldc)
+                                     rocsparse_mat_info        info,
+                                     float*                    x,
+                                     const float*              b,
+                                     float                     tol,
+                                     rocsparse_int             max_iter,
+                                     rocsparse_int*            niter,
+                                     float*                    nrm_res,
+                                     void*                     temp_buffer)
     {
-        return rocsparse_scsrmm(handle,
-                                trans_A,
-                                trans_B,
+        return rocsparse_scsrcg(handle,
                                 m,
-                                n,
-                                k,
                                 nnz,
-                                alpha,
                                 descr,
                                 csr_val,
                                 csr_row_ptr,
                                 csr_col_ind,
-                                B,
-                                ldb,
-                                beta,
-                                C,
-                                ldc);
+                                info,
+                                x,
+                                b,
+                                tol,
+                                max_iter,
+                                niter,
+                                nrm_res,
+                                temp_buffer);
     }
 
     template <>
-    rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
-                                     rocsparse_operation       trans_A,
-                                     rocsparse_operation       trans_B,
+    rocsparse_status rocsparse_csrcg(rocsparse_handle          handle,
                                      rocsparse_int             m,
-                                     rocsparse_int             n,
-                                     rocsparse_int             k,
                                      rocsparse_int             nnz,
-                                     const double*             alpha,
                                      const rocsparse_mat_descr descr,
                                      const double*             csr_val,
                                      const rocsparse_int*      csr_row_ptr,
                                      const rocsparse_int*      csr_col_ind,
-                                     const double*             B,
-                                     rocsparse_int             ldb,
-                                     const double*             beta,
-                                     double*                   C,
-                                     rocsparse_int             ldc)
+                                     rocsparse_mat_info        info,
+                                     double*                   x,
+                                     const double*             b,
+                                     double                    tol,
+                                     rocsparse_int             max_iter,
+                                     rocsparse_int*            niter,
+                                     double*                   nrm_res,
+                                     void*                     temp_buffer)
     {
-        return rocsparse_dcsrmm(handle,
-                                trans_A,
-                                trans_B,
+        return rocsparse_dcsrcg(handle,
                                 m,
-                                n,
-                                k,
                                 nnz,
-                                alpha,
                                 descr,
                                 csr_val,
                                 csr_row_ptr,
                                 csr_col_ind,
-                                B,
-                                ldb,
-                                beta,
-                                C,
-                                ldc);
-    }
-
-    template <>
-    rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             nnz,
-                                                   const rocsparse_mat_descr descr,
-                                                   const float*              csr_val,
-                                                   const rocsparse_int*      csr_row_ptr,
-                                                   const rocsparse_int*      csr_col_ind,
-                                                   rocsparse_mat_info        info,
-                                                   size_t*                   buffer_size)
-    {
-        return rocsparse_scsrilu0_buffer_size(
-            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
-    }
-
-    template <>
-    rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             nnz,
-                                                   const rocsparse_mat_descr descr,
-                                                   const double*             csr_val,
-                                                   const rocsparse_int*      csr_row_ptr,
-                                                   const rocsparse_int*      csr_col_ind,
-                                                   rocsparse_mat_info        info,
-                                                   size_t*                   buffer_size)
-    {
-        return rocsparse_dcsrilu0_buffer_size(
-            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+                                info,
+                                x,
+                                b,
+                                tol,
+                                max_iter,
+                                niter,
+                                nrm_res,
+                                temp_buffer);
     }
 
     template <>
-    rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                rocsparse_analysis_policy analysis,
-                                                rocsparse_solve_policy    solve,
-                                                void*                     temp_buffer)
+    rocsparse_status rocsparse_csrbicgstab_buffer_size(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float*              csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       size_t*                   buffer_size)
     {
-        return rocsparse_scsrilu0_analysis(handle,
-                                           m,
-                                           nnz,
-                                           descr,
-                                           csr_val,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           info,
-                                           analysis,
-                                           solve,
-                                           temp_buffer);
+        return rocsparse_scsrbicgstab_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
     }
 
     template <>
-    rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                rocsparse_analysis_policy analysis,
-                                                rocsparse_solve_policy    solve,
-                                                void*                     temp_buffer)
+    rocsparse_status rocsparse_csrbicgstab_buffer_size(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double*             csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       size_t*                   buffer_size)
     {
-        return rocsparse_dcsrilu0_analysis(handle,
-                                           m,
-                                           nnz,
-                                           descr,
-                                           csr_val,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           info,
-                                           analysis,
-                                           solve,
-                                           temp_buffer);
+        return rocsparse_dcsrbicgstab_buffer_size(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
     }
 
     template <>
-    rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
-                                       rocsparse_int             m,
-                                       rocsparse_int             nnz,
-                                       const rocsparse_mat_descr descr,
-                                       float*                    csr_val,
-                                       const rocsparse_int*      csr_row_ptr,
-                                       const rocsparse_int*      csr_col_ind,
-                                       rocsparse_mat_info        info,
-                                       rocsparse_solve_policy    policy,
-                                       void*                     temp_buffer)
+    rocsparse_status rocsparse_csrbicgstab(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           float*                    x,
+                                           const float*              b,
+                                           float                     tol,
+                                           rocsparse_int             max_iter,
+                                           rocsparse_int*            niter,
+                                           float*                    nrm_res,
+                                           void*                     temp_buffer)
     {
-        return rocsparse_scsrilu0(
-            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+        return rocsparse_scsrbicgstab(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      b,
+                                      tol,
+                                      max_iter,
+                                      niter,
+                                      nrm_res,
+                                      temp_buffer);
     }
 
     template <>
-    rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
-                                       rocsparse_int             m,
-                                       rocsparse_int             nnz,
-                                       const rocsparse_mat_descr descr,
-                                       double*                   csr_val,
-                                       const rocsparse_int*      csr_row_ptr,
-                                       const rocsparse_int*      csr_col_ind,
-                                       rocsparse_mat_info        info,
-                                       rocsparse_solve_policy    policy,
-                                       void*                     temp_buffer)
+    rocsparse_status rocsparse_csrbicgstab(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           double*                   x,
+                                           const double*             b,
+                                           double                    tol,
+                                           rocsparse_int             max_iter,
+                                           rocsparse_int*            niter,
+                                           double*                   nrm_res,
+                                           void*                     temp_buffer)
     {
-        return rocsparse_dcsrilu0(
-            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+        return rocsparse_dcsrbicgstab(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      b,
+                                      tol,
+                                      max_iter,
+                                      niter,
+                                      nrm_res,
+                                      temp_buffer);
     }
 
     template <>
@@ -814,6 +1780,66 @@ namespace rocsparse
                                   ell_col_ind);
     }
 
+    template <>
+    rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       rocsparse_bsr_mat         bsr)
+    {
+        return rocsparse_scsr2bsr(
+            handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, bsr);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       rocsparse_bsr_mat         bsr)
+    {
+        return rocsparse_dcsr2bsr(
+            handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, block_dim, bsr);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csr2dcsr(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_dcsr_mat        dcsr)
+    {
+        return rocsparse_scsr2dcsr(
+            handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, dcsr);
+    }
+
+    template <>
+    rocsparse_status rocsparse_csr2dcsr(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_dcsr_mat        dcsr)
+    {
+        return rocsparse_dcsr2dcsr(
+            handle, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, dcsr);
+    }
+
     template <>
     rocsparse_status rocsparse_csr2hyb(rocsparse_handle          handle,
                                        rocsparse_int             m,
@@ -914,4 +1940,84 @@ namespace rocsparse
                                   csr_col_ind);
     }
 
+    template <>
+    rocsparse_status rocsparse_coo2csr_assemble_buffer_size<float>(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   rocsparse_int    n,
+                                                                   rocsparse_int    nnz,
+                                                                   size_t*          buffer_size)
+    {
+        return rocsparse_scoo2csr_assemble_buffer_size(handle, m, n, nnz, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_coo2csr_assemble_buffer_size<double>(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    rocsparse_int    n,
+                                                                    rocsparse_int    nnz,
+                                                                    size_t*          buffer_size)
+    {
+        return rocsparse_dcoo2csr_assemble_buffer_size(handle, m, n, nnz, buffer_size);
+    }
+
+    template <>
+    rocsparse_status rocsparse_coo2csr_assemble(rocsparse_handle     handle,
+                                                rocsparse_int        m,
+                                                rocsparse_int        n,
+                                                rocsparse_int        nnz,
+                                                const float*         coo_val,
+                                                const rocsparse_int* coo_row_ind,
+                                                const rocsparse_int* coo_col_ind,
+                                                float*               csr_val,
+                                                rocsparse_int*       csr_row_ptr,
+                                                rocsparse_int*       csr_col_ind,
+                                                rocsparse_int*       nnz_C,
+                                                rocsparse_index_base idx_base,
+                                                void*                temp_buffer)
+    {
+        return rocsparse_scoo2csr_assemble(handle,
+                                           m,
+                                           n,
+                                           nnz,
+                                           coo_val,
+                                           coo_row_ind,
+                                           coo_col_ind,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           nnz_C,
+                                           idx_base,
+                                           temp_buffer);
+    }
+
+    template <>
+    rocsparse_status rocsparse_coo2csr_assemble(rocsparse_handle     handle,
+                                                rocsparse_int        m,
+                                                rocsparse_int        n,
+                                                rocsparse_int        nnz,
+                                                const double*        coo_val,
+                                                const rocsparse_int* coo_row_ind,
+                                                const rocsparse_int* coo_col_ind,
+                                                double*              csr_val,
+                                                rocsparse_int*       csr_row_ptr,
+                                                rocsparse_int*       csr_col_ind,
+                                                rocsparse_int*       nnz_C,
+                                                rocsparse_index_base idx_base,
+                                                void*                temp_buffer)
+    {
+        return rocsparse_dcoo2csr_assemble(handle,
+                                           m,
+                                           n,
+                                           nnz,
+                                           coo_val,
+                                           coo_row_ind,
+                                           coo_col_ind,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           nnz_C,
+                                           idx_base,
+                                           temp_buffer);
+    }
+
 } // namespace rocsparse
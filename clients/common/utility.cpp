@@ -23,10 +23,17 @@
 
 #include "utility.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
 #include <hip/hip_runtime_api.h>
+#include <iostream>
+#include <map>
 #include <rocsparse.h>
 #include <stdio.h>
 #include <sys/time.h>
+#include <vector>
 
 #ifdef __cplusplus
 extern "C" {
@@ -136,3 +143,323 @@ double get_time_us_sync(hipStream_t stream)
 #ifdef __cplusplus
 }
 #endif
+
+/* ============================================================================================ */
+/*  event timing */
+
+gpu_event_timer::~gpu_event_timer()
+{
+    for(size_t i = 0; i < start_events.size(); ++i)
+    {
+        hipEventDestroy(start_events[i]);
+    }
+    for(size_t i = 0; i < stop_events.size(); ++i)
+    {
+        hipEventDestroy(stop_events[i]);
+    }
+}
+
+void gpu_event_timer::start(hipStream_t stream)
+{
+    hipEvent_t event;
+    hipEventCreate(&event);
+    hipEventRecord(event, stream);
+    start_events.push_back(event);
+}
+
+void gpu_event_timer::stop(hipStream_t stream)
+{
+    hipEvent_t event;
+    hipEventCreate(&event);
+    hipEventRecord(event, stream);
+    stop_events.push_back(event);
+}
+
+std::vector<double> gpu_event_timer::times_us()
+{
+    std::vector<double> times(stop_events.size());
+
+    if(!stop_events.empty())
+    {
+        // One synchronization resolves all recorded iterations
+        hipEventSynchronize(stop_events.back());
+    }
+
+    for(size_t i = 0; i < stop_events.size(); ++i)
+    {
+        float ms;
+        hipEventElapsedTime(&ms, start_events[i], stop_events[i]);
+        times[i] = ms * 1000.0;
+    }
+
+    return times;
+}
+
+void device_mem_sampler::start(void)
+{
+    size_t total;
+    if(hipMemGetInfo(&baseline_free, &total) != hipSuccess)
+    {
+        baseline_free = 0;
+        return;
+    }
+
+    min_free = baseline_free;
+    running  = true;
+
+    // Poll free device memory while the sampled region runs; the largest
+    // drop against the baseline gives the peak footprint, including
+    // temporaries the library allocates and releases internally
+    sampler = std::thread([this] {
+        while(running)
+        {
+            size_t free;
+            size_t total;
+            if(hipMemGetInfo(&free, &total) == hipSuccess && free < min_free)
+            {
+                min_free = free;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+}
+
+size_t device_mem_sampler::stop(void)
+{
+    if(!running)
+    {
+        return 0;
+    }
+
+    running = false;
+    sampler.join();
+
+    return baseline_free - min_free;
+}
+
+/* ============================================================================================ */
+/*  benchmark statistics */
+
+// Samples recorded by the testing harnesses, keyed by routine name and,
+// when a case label is set, prefixed with "<case>:"
+static std::map<std::string, std::vector<double>> bench_samples;
+static std::string                                bench_case;
+
+static std::string bench_key(const std::string& routine)
+{
+    return bench_case.empty() ? routine : bench_case + ":" + routine;
+}
+
+bench_stats bench_compute_stats(std::vector<double> times_us)
+{
+    bench_stats stats;
+    stats.samples = times_us.size();
+
+    if(stats.samples == 0)
+    {
+        stats.median = stats.mean = stats.stddev = stats.ci95_lo = stats.ci95_hi = 0.0;
+        return stats;
+    }
+
+    std::sort(times_us.begin(), times_us.end());
+
+    rocsparse_int n = stats.samples;
+    stats.median    = (n & 1) ? times_us[n / 2] : 0.5 * (times_us[n / 2 - 1] + times_us[n / 2]);
+
+    double sum = 0.0;
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        sum += times_us[i];
+    }
+    stats.mean = sum / n;
+
+    double var = 0.0;
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        var += (times_us[i] - stats.mean) * (times_us[i] - stats.mean);
+    }
+    stats.stddev = (n > 1) ? std::sqrt(var / (n - 1)) : 0.0;
+
+    // 95% confidence interval of the mean, normal approximation
+    double half    = 1.96 * stats.stddev / std::sqrt((double)n);
+    stats.ci95_lo  = stats.mean - half;
+    stats.ci95_hi  = stats.mean + half;
+
+    return stats;
+}
+
+void bench_collect(const std::string& routine, const std::vector<double>& times_us)
+{
+    std::vector<double>& samples = bench_samples[bench_key(routine)];
+    samples.insert(samples.end(), times_us.begin(), times_us.end());
+}
+
+void bench_set_case(const std::string& name)
+{
+    bench_case = name;
+}
+
+// Achieved bandwidth per routine and the device peak to relate it to
+static std::map<std::string, double> bench_bandwidth;
+static double                        bench_peak_bandwidth = 0.0;
+
+void bench_set_bandwidth(const std::string& routine, double gbyte_per_sec)
+{
+    bench_bandwidth[bench_key(routine)] = gbyte_per_sec;
+}
+
+void bench_set_peak_bandwidth(double gbyte_per_sec)
+{
+    bench_peak_bandwidth = gbyte_per_sec;
+}
+
+// Peak device memory footprint per routine
+static std::map<std::string, size_t> bench_peak_memory;
+
+void bench_set_peak_memory(const std::string& routine, size_t bytes)
+{
+    bench_peak_memory[bench_key(routine)] = bytes;
+}
+
+double device_peak_bandwidth(rocsparse_int device_id)
+{
+    hipDeviceProp_t prop;
+    if(hipGetDeviceProperties(&prop, device_id) != hipSuccess)
+    {
+        return 0.0;
+    }
+
+    // memoryClockRate is in kHz; DDR transfers twice per clock
+    return 2.0 * prop.memoryClockRate * (prop.memoryBusWidth / 8.0) / 1e6;
+}
+
+// Roofline classification: kernels that do not cover their launch overhead scale
+// with latency rather than with the memory system; otherwise the achieved fraction
+// of peak decides between bandwidth and compute bound
+static const char* bench_classify(double median_us, double e2e_us, double pct_peak)
+{
+    if(median_us < 20.0 || (e2e_us > 0.0 && e2e_us > 2.0 * median_us))
+    {
+        return "latency-bound";
+    }
+
+    return (pct_peak >= 50.0) ? "bandwidth-bound" : "compute-bound";
+}
+
+bench_stats bench_query(const std::string& routine)
+{
+    std::map<std::string, std::vector<double>>::const_iterator it
+        = bench_samples.find(bench_key(routine));
+
+    return bench_compute_stats(it != bench_samples.end() ? it->second
+                                                         : std::vector<double>());
+}
+
+void bench_report(const std::string& format, const std::string& file)
+{
+    if(format.empty() || bench_samples.empty())
+    {
+        return;
+    }
+
+    std::ofstream fout;
+    if(!file.empty())
+    {
+        fout.open(file.c_str());
+        if(!fout.is_open())
+        {
+            fprintf(stderr, "Cannot open bench output file %s\n", file.c_str());
+            return;
+        }
+    }
+    std::ostream& out = file.empty() ? std::cout : fout;
+
+    if(format == "json")
+    {
+        out << "[";
+        bool first = true;
+        for(std::map<std::string, std::vector<double>>::const_iterator it = bench_samples.begin();
+            it != bench_samples.end();
+            ++it)
+        {
+            bench_stats stats = bench_compute_stats(it->second);
+
+            out << (first ? "" : ",") << "\n  {\"routine\": \"" << it->first << "\""
+                << ", \"samples\": " << stats.samples << ", \"median_us\": " << stats.median
+                << ", \"mean_us\": " << stats.mean << ", \"stddev_us\": " << stats.stddev
+                << ", \"ci95_lo_us\": " << stats.ci95_lo << ", \"ci95_hi_us\": " << stats.ci95_hi;
+
+            std::map<std::string, double>::const_iterator bw = bench_bandwidth.find(it->first);
+            if(bw != bench_bandwidth.end())
+            {
+                double pct = (bench_peak_bandwidth > 0.0)
+                                 ? bw->second / bench_peak_bandwidth * 100.0
+                                 : 0.0;
+
+                std::map<std::string, std::vector<double>>::const_iterator e2e
+                    = bench_samples.find(it->first + "_e2e");
+                double e2e_us
+                    = (e2e != bench_samples.end()) ? bench_compute_stats(e2e->second).median : 0.0;
+
+                out << ", \"gbyte_per_sec\": " << bw->second << ", \"pct_peak\": " << pct
+                    << ", \"bound\": \"" << bench_classify(stats.median, e2e_us, pct) << "\"";
+            }
+
+            std::map<std::string, size_t>::const_iterator mem = bench_peak_memory.find(it->first);
+            if(mem != bench_peak_memory.end())
+            {
+                out << ", \"peak_mem_mbyte\": " << mem->second / 1e6;
+            }
+
+            out << "}";
+            first = false;
+        }
+        out << "\n]" << std::endl;
+    }
+    else
+    {
+        out << "routine,samples,median_us,mean_us,stddev_us,ci95_lo_us,ci95_hi_us,"
+               "gbyte_per_sec,pct_peak,bound,peak_mem_mbyte"
+            << std::endl;
+        for(std::map<std::string, std::vector<double>>::const_iterator it = bench_samples.begin();
+            it != bench_samples.end();
+            ++it)
+        {
+            bench_stats stats = bench_compute_stats(it->second);
+
+            out << it->first << "," << stats.samples << "," << stats.median << "," << stats.mean
+                << "," << stats.stddev << "," << stats.ci95_lo << "," << stats.ci95_hi;
+
+            std::map<std::string, double>::const_iterator bw = bench_bandwidth.find(it->first);
+            if(bw != bench_bandwidth.end())
+            {
+                double pct = (bench_peak_bandwidth > 0.0)
+                                 ? bw->second / bench_peak_bandwidth * 100.0
+                                 : 0.0;
+
+                std::map<std::string, std::vector<double>>::const_iterator e2e
+                    = bench_samples.find(it->first + "_e2e");
+                double e2e_us
+                    = (e2e != bench_samples.end()) ? bench_compute_stats(e2e->second).median : 0.0;
+
+                out << "," << bw->second << "," << pct << ","
+                    << bench_classify(stats.median, e2e_us, pct);
+            }
+            else
+            {
+                out << ",,,";
+            }
+
+            out << ",";
+
+            std::map<std::string, size_t>::const_iterator mem = bench_peak_memory.find(it->first);
+            if(mem != bench_peak_memory.end())
+            {
+                out << mem->second / 1e6;
+            }
+
+            out << std::endl;
+        }
+    }
+}
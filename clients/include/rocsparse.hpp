@@ -191,6 +191,26 @@ namespace rocsparse
                                      const T*                  beta,
                                      T*                        y);
 
+    template <typename T>
+    rocsparse_status rocsparse_bsrmv(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     const T*                  alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_bsr_mat   bsr,
+                                     const T*                  x,
+                                     const T*                  beta,
+                                     T*                        y);
+
+    template <typename T>
+    rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      const T*                  alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_dcsr_mat  dcsr,
+                                      const T*                  x,
+                                      const T*                  beta,
+                                      T*                        y);
+
     template <typename T>
     rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
                                      rocsparse_operation       trans_A,
@@ -210,6 +230,122 @@ namespace rocsparse
                                      T*                        C,
                                      rocsparse_int             ldc);
 
+    template <typename T>
+    rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nrhs,
+                                           rocsparse_int             nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const T*                  x,
+                                           rocsparse_int             ldx,
+                                           T*                        y,
+                                           rocsparse_int             ldy,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const T*                  csr_val_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const T*                  csr_val_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       T*                        csr_val_C,
+                                       const rocsparse_int*      csr_row_ptr_C,
+                                       rocsparse_int*            csr_col_ind_C,
+                                       void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const T*                  csr_val_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const T*                  beta,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const T*                  csr_val_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       T*                        csr_val_C,
+                                       const rocsparse_int*      csr_row_ptr_C,
+                                       rocsparse_int*            csr_col_ind_C);
+
+    template <typename T>
+    rocsparse_status rocsparse_sddmm(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const T*                  alpha,
+                                     const T*                  A,
+                                     rocsparse_int             lda,
+                                     const T*                  B,
+                                     rocsparse_int             ldb,
+                                     const T*                  beta,
+                                     const rocsparse_mat_descr descr,
+                                     T*                        csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind);
+
+    template <typename T>
+    rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     rocsparse_int             nnz,
+                                     const T*                  alpha,
+                                     const T*                  A,
+                                     rocsparse_int             lda,
+                                     const rocsparse_mat_descr descr,
+                                     const T*                  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const T*                  beta,
+                                     T*                        C,
+                                     rocsparse_int             ldc);
+
+    template <typename T>
+    rocsparse_status rocsparse_s24mm(rocsparse_handle          handle,
+                                     rocsparse_operation       trans_A,
+                                     rocsparse_operation       trans_B,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             k,
+                                     const T*                  alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const T*                  s24_val,
+                                     const unsigned char*      s24_meta,
+                                     const T*                  B,
+                                     rocsparse_int             ldb,
+                                     const T*                  beta,
+                                     T*                        C,
+                                     rocsparse_int             ldc);
+
     template <typename T>
     rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
                                                    rocsparse_int             m,
@@ -246,6 +382,145 @@ namespace rocsparse
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer);
 
+    template <typename T>
+    rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  size_t*                   buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_analysis_policy analysis,
+                                               rocsparse_solve_policy    solve,
+                                               void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      T*                        csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_solve_policy    policy,
+                                      void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csriluk_buffer_size(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   size_t*                   buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const T*                  csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       T*                        iluk_val,
+                                       const rocsparse_int*      iluk_row_ptr,
+                                       rocsparse_int*            iluk_col_ind,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const T*                  tol,
+                                           rocsparse_int             max_fill,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_int*            ilut_row_ptr,
+                                           rocsparse_int*            ilut_nnz);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrilut(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       const rocsparse_mat_descr descr,
+                                       rocsparse_mat_info        info,
+                                       T*                        ilut_val,
+                                       const rocsparse_int*      ilut_row_ptr,
+                                       rocsparse_int*            ilut_col_ind);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrcg_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrcg(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const T*                  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     T*                        x,
+                                     const T*                  b,
+                                     T                         tol,
+                                     rocsparse_int             max_iter,
+                                     rocsparse_int*            niter,
+                                     T*                        nrm_res,
+                                     void*                     temp_buffer);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrbicgstab_buffer_size(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const T*                  csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       size_t*                   buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_csrbicgstab(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           T*                        x,
+                                           const T*                  b,
+                                           T                         tol,
+                                           rocsparse_int             max_iter,
+                                           rocsparse_int*            niter,
+                                           T*                        nrm_res,
+                                           void*                     temp_buffer);
+
     template <typename T>
     rocsparse_status rocsparse_csr2csc(rocsparse_handle     handle,
                                        rocsparse_int        m,
@@ -273,6 +548,28 @@ namespace rocsparse
                                        T*                        ell_val,
                                        rocsparse_int*            ell_col_ind);
 
+    template <typename T>
+    rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr,
+                                       const T*                  csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       rocsparse_bsr_mat         bsr);
+
+    template <typename T>
+    rocsparse_status rocsparse_csr2dcsr(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const T*                  csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_dcsr_mat        dcsr);
+
     template <typename T>
     rocsparse_status rocsparse_csr2hyb(rocsparse_handle          handle,
                                        rocsparse_int             m,
@@ -298,6 +595,28 @@ namespace rocsparse
                                        const rocsparse_int*      csr_row_ptr,
                                        rocsparse_int*            csr_col_ind);
 
+    template <typename T>
+    rocsparse_status rocsparse_coo2csr_assemble_buffer_size(rocsparse_handle handle,
+                                                            rocsparse_int    m,
+                                                            rocsparse_int    n,
+                                                            rocsparse_int    nnz,
+                                                            size_t*          buffer_size);
+
+    template <typename T>
+    rocsparse_status rocsparse_coo2csr_assemble(rocsparse_handle     handle,
+                                                rocsparse_int        m,
+                                                rocsparse_int        n,
+                                                rocsparse_int        nnz,
+                                                const T*             coo_val,
+                                                const rocsparse_int* coo_row_ind,
+                                                const rocsparse_int* coo_col_ind,
+                                                T*                   csr_val,
+                                                rocsparse_int*       csr_row_ptr,
+                                                rocsparse_int*       csr_col_ind,
+                                                rocsparse_int*       nnz_C,
+                                                rocsparse_index_base idx_base,
+                                                void*                temp_buffer);
+
 } // namespace rocsparse
 
 #endif // _ROCSPARSE_HPP_
@@ -109,6 +109,38 @@ namespace rocsparse_test
         }
     };
 
+    struct bsr_struct
+    {
+        rocsparse_bsr_mat bsr;
+        bsr_struct()
+        {
+            rocsparse_status status = rocsparse_create_bsr_mat(&bsr);
+            verify_rocsparse_status_success(status, "ERROR: bsr_struct constructor");
+        }
+
+        ~bsr_struct()
+        {
+            rocsparse_status status = rocsparse_destroy_bsr_mat(bsr);
+            verify_rocsparse_status_success(status, "ERROR: bsr_struct destructor");
+        }
+    };
+
+    struct dcsr_struct
+    {
+        rocsparse_dcsr_mat dcsr;
+        dcsr_struct()
+        {
+            rocsparse_status status = rocsparse_create_dcsr_mat(&dcsr);
+            verify_rocsparse_status_success(status, "ERROR: dcsr_struct constructor");
+        }
+
+        ~dcsr_struct()
+        {
+            rocsparse_status status = rocsparse_destroy_dcsr_mat(dcsr);
+            verify_rocsparse_status_success(status, "ERROR: dcsr_struct destructor");
+        }
+    };
+
     struct mat_info_struct
     {
         rocsparse_mat_info info;
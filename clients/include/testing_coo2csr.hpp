@@ -182,7 +182,7 @@ rocsparse_status testing_coo2csr(Arguments argus)
     else if(argus.laplacian)
     {
         std::vector<rocsparse_int> hptr(m + 1);
-        m = n = gen_2d_laplacian(argus.laplacian, hptr, hcoo_col_ind, hcoo_val, idx_base);
+        m = n = gen_laplacian(argus, hptr, hcoo_col_ind, hcoo_val, idx_base);
         nnz   = hptr[m];
         hcoo_row_ind.resize(nnz);
 
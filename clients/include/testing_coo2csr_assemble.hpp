@@ -0,0 +1,631 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_COO2CSR_ASSEMBLE_HPP
+#define TESTING_COO2CSR_ASSEMBLE_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <map>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_coo2csr_assemble_bad_arg(void)
+{
+    rocsparse_int    m         = 100;
+    rocsparse_int    n         = 100;
+    rocsparse_int    nnz       = 100;
+    rocsparse_int    safe_size = 100;
+    size_t           size;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    auto coo_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto coo_row_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto coo_col_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto csr_row_ptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_col_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    T*             coo_val     = (T*)coo_val_managed.get();
+    rocsparse_int* coo_row_ind = (rocsparse_int*)coo_row_ind_managed.get();
+    rocsparse_int* coo_col_ind = (rocsparse_int*)coo_col_ind_managed.get();
+    T*             csr_val     = (T*)csr_val_managed.get();
+    rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+    rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+    void*          dbuffer     = (void*)dbuffer_managed.get();
+
+    rocsparse_int nnz_C;
+
+    if(!coo_val || !coo_row_ind || !coo_col_ind || !csr_val || !csr_row_ptr || !csr_col_ind
+       || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Testing rocsparse_coo2csr_assemble_buffer_size()
+
+    // Testing for(buffer_size == nullptr)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble_buffer_size<T>(handle, m, n, nnz, size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: buffer_size is nullptr");
+    }
+    // Testing for(handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble_buffer_size<T>(handle_null, m, n, nnz, &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // Testing rocsparse_coo2csr_assemble()
+
+    // Testing for(coo_val == nullptr)
+    {
+        T* coo_val_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val_null,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: coo_val is nullptr");
+    }
+    // Testing for(coo_row_ind == nullptr)
+    {
+        rocsparse_int* coo_row_ind_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind_null,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: coo_row_ind is nullptr");
+    }
+    // Testing for(coo_col_ind == nullptr)
+    {
+        rocsparse_int* coo_col_ind_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind_null,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: coo_col_ind is nullptr");
+    }
+    // Testing for(csr_val == nullptr)
+    {
+        T* csr_val_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val_null,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+    }
+    // Testing for(csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr_null,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+    // Testing for(csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind_null,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+    // Testing for(nnz_C == nullptr)
+    {
+        rocsparse_int* nnz_C_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            nnz_C_null,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: nnz_C is nullptr");
+    }
+    // Testing for(temp_buffer == nullptr)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: temp_buffer is nullptr");
+    }
+    // Testing for(handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_coo2csr_assemble(handle_null,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            rocsparse_index_base_zero,
+                                            dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_coo2csr_assemble(Arguments argus)
+{
+    rocsparse_int        m         = argus.M;
+    rocsparse_int        n         = argus.N;
+    rocsparse_int        safe_size = 100;
+    rocsparse_index_base idx_base  = argus.idx_base;
+    rocsparse_status     status;
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto coo_val_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto coo_row_ind_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto coo_col_ind_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_val_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        // The quick return zeroes the row pointer array of a non-empty matrix
+        auto csr_row_ptr_managed = rocsparse_unique_ptr{
+            device_malloc(sizeof(rocsparse_int) * (std::max(m, safe_size) + 1)), device_free};
+        auto csr_col_ind_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dbuffer_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        T*             coo_val     = (T*)coo_val_managed.get();
+        rocsparse_int* coo_row_ind = (rocsparse_int*)coo_row_ind_managed.get();
+        rocsparse_int* coo_col_ind = (rocsparse_int*)coo_col_ind_managed.get();
+        T*             csr_val     = (T*)csr_val_managed.get();
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+        rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+        void*          dbuffer     = (void*)dbuffer_managed.get();
+
+        if(!coo_val || !coo_row_ind || !coo_col_ind || !csr_val || !csr_row_ptr || !csr_col_ind
+           || !dbuffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!coo_val || !coo_row_ind || !coo_col_ind || "
+                                            "!csr_val || !csr_row_ptr || !csr_col_ind || "
+                                            "!dbuffer");
+            return rocsparse_status_memory_error;
+        }
+
+        size_t size;
+        status = rocsparse_coo2csr_assemble_buffer_size<T>(handle, m, n, nnz, &size);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int nnz_C = 77;
+        status              = rocsparse_coo2csr_assemble(handle,
+                                            m,
+                                            n,
+                                            nnz,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            &nnz_C,
+                                            idx_base,
+                                            dbuffer);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+
+            // An empty matrix assembles to zero entries
+            rocsparse_int zero = 0;
+            unit_check_general(1, 1, 1, &zero, &nnz_C);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Initialize random seed
+    srand(12345ULL);
+
+    // Sample an unassembled COO matrix. The positions are drawn from a
+    // smaller pool, such that duplicate entries occur as in finite element
+    // assembly
+    rocsparse_int npos = std::max(nnz / 3, 1);
+
+    std::vector<rocsparse_int> pool_row(npos);
+    std::vector<rocsparse_int> pool_col(npos);
+
+    for(rocsparse_int i = 0; i < npos; ++i)
+    {
+        pool_row[i] = rand() % m;
+        pool_col[i] = rand() % n;
+    }
+
+    std::vector<rocsparse_int> hcoo_row_ind(nnz);
+    std::vector<rocsparse_int> hcoo_col_ind(nnz);
+    std::vector<T>             hcoo_val(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        rocsparse_int p = rand() % npos;
+
+        hcoo_row_ind[i] = pool_row[p] + idx_base;
+        hcoo_col_ind[i] = pool_col[p] + idx_base;
+        hcoo_val[i]     = random_generator<T>();
+    }
+
+    // Assemble on host, summing duplicates in row-major order
+    std::map<int64_t, T> assembled;
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        int64_t key = static_cast<int64_t>(hcoo_row_ind[i] - idx_base) * n
+                      + (hcoo_col_ind[i] - idx_base);
+        assembled[key] += hcoo_val[i];
+    }
+
+    rocsparse_int nnz_C_gold = assembled.size();
+
+    std::vector<rocsparse_int> hcsr_row_ptr_gold(m + 1, 0);
+    std::vector<rocsparse_int> hcsr_col_ind_gold(nnz_C_gold);
+    std::vector<T>             hcsr_val_gold(nnz_C_gold);
+
+    rocsparse_int idx = 0;
+    for(const std::pair<const int64_t, T>& entry : assembled)
+    {
+        rocsparse_int row = entry.first / n;
+        rocsparse_int col = entry.first % n;
+
+        ++hcsr_row_ptr_gold[row + 1];
+        hcsr_col_ind_gold[idx] = col + idx_base;
+        hcsr_val_gold[idx]     = entry.second;
+        ++idx;
+    }
+
+    hcsr_row_ptr_gold[0] = idx_base;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        hcsr_row_ptr_gold[i + 1] += hcsr_row_ptr_gold[i];
+    }
+
+    // Allocate memory on the device
+    auto dcoo_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcoo_row_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcoo_col_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsr_row_ptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dnnz_C_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+
+    T*             dcoo_val     = (T*)dcoo_val_managed.get();
+    rocsparse_int* dcoo_row_ind = (rocsparse_int*)dcoo_row_ind_managed.get();
+    rocsparse_int* dcoo_col_ind = (rocsparse_int*)dcoo_col_ind_managed.get();
+    T*             dcsr_val     = (T*)dcsr_val_managed.get();
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    rocsparse_int* dnnz_C       = (rocsparse_int*)dnnz_C_managed.get();
+
+    if(!dcoo_val || !dcoo_row_ind || !dcoo_col_ind || !dcsr_val || !dcsr_row_ptr || !dcsr_col_ind
+       || !dnnz_C)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dcoo_val || !dcoo_row_ind || !dcoo_col_ind || "
+                                        "!dcsr_val || !dcsr_row_ptr || !dcsr_col_ind || "
+                                        "!dnnz_C");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(dcoo_val, hcoo_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcoo_row_ind, hcoo_row_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcoo_col_ind, hcoo_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain and allocate the temporary buffer
+    size_t size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_coo2csr_assemble_buffer_size<T>(handle, m, n, nnz, &size));
+
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        rocsparse_int hnnz_C_1;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_coo2csr_assemble(handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         dcoo_val,
+                                                         dcoo_row_ind,
+                                                         dcoo_col_ind,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         &hnnz_C_1,
+                                                         idx_base,
+                                                         dbuffer));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_coo2csr_assemble(handle,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         dcoo_val,
+                                                         dcoo_row_ind,
+                                                         dcoo_col_ind,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dnnz_C,
+                                                         idx_base,
+                                                         dbuffer));
+
+        rocsparse_int hnnz_C_2;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_C_2, dnnz_C, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Check the assembled entry count for both pointer modes
+        unit_check_general(1, 1, 1, &nnz_C_gold, &hnnz_C_1);
+        unit_check_general(1, 1, 1, &nnz_C_gold, &hnnz_C_2);
+
+        // Copy output from device to host
+        std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind(nnz_C_gold);
+        std::vector<T>             hcsr_val(nnz_C_gold);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr.data(),
+                                  dcsr_row_ptr,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind.data(),
+                                  dcsr_col_ind,
+                                  sizeof(rocsparse_int) * nnz_C_gold,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val.data(), dcsr_val, sizeof(T) * nnz_C_gold, hipMemcpyDeviceToHost));
+
+        // Unit check. The duplicates are summed in a different order on the
+        // device, hence the values are verified up to rounding
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptr.data());
+        unit_check_general(1, nnz_C_gold, 1, hcsr_col_ind_gold.data(), hcsr_col_ind.data());
+        unit_check_near(1, nnz_C_gold, 1, hcsr_val_gold.data(), hcsr_val.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        rocsparse_int hnnz_C;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_coo2csr_assemble(handle,
+                                       m,
+                                       n,
+                                       nnz,
+                                       dcoo_val,
+                                       dcoo_row_ind,
+                                       dcoo_col_ind,
+                                       dcsr_val,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       &hnnz_C,
+                                       idx_base,
+                                       dbuffer);
+        }
+
+        // The conversion is blocking, wall clock time covers the full pipeline
+        std::vector<double> times(number_hot_calls);
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            double time = get_time_us();
+
+            rocsparse_coo2csr_assemble(handle,
+                                       m,
+                                       n,
+                                       nnz,
+                                       dcoo_val,
+                                       dcoo_row_ind,
+                                       dcoo_col_ind,
+                                       dcsr_val,
+                                       dcsr_row_ptr,
+                                       dcsr_col_ind,
+                                       &hnnz_C,
+                                       idx_base,
+                                       dbuffer);
+
+            times[iter] = get_time_us() - time;
+        }
+
+        bench_collect("coo2csr_assemble", times);
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
+
+        double bandwidth = (sizeof(rocsparse_int) * (2.0 * nnz + hnnz_C + m + 1)
+                            + sizeof(T) * (nnz + hnnz_C))
+                           / gpu_time_used / 1e6;
+        bench_set_bandwidth("coo2csr_assemble", bandwidth);
+
+        printf("m\t\tn\t\tnnz\t\tnnz_C\t\tGB/s\tmsec\n");
+        printf("%8d\t%8d\t%9d\t%9d\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               hnnz_C,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_COO2CSR_ASSEMBLE_HPP
@@ -260,7 +260,7 @@ rocsparse_status testing_coomv(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hptr, hcol, hval, idx_base);
+        m = n = gen_laplacian(argus, hptr, hcol, hval, idx_base);
         nnz   = hptr[m];
         hrow.resize(nnz);
 
@@ -382,7 +382,7 @@ rocsparse_status testing_coomv(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 10;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
@@ -392,17 +392,34 @@ rocsparse_status testing_coomv(Arguments argus)
                 handle, transA, m, n, nnz, &h_alpha, descr, dval, drow, dcol, dx, &h_beta, dy_1);
         }
 
-        double gpu_time_used = get_time_us(); // in microseconds
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
+            timer.start(stream);
+
             rocsparse_coomv(
                 handle, transA, m, n, nnz, &h_alpha, descr, dval, drow, dcol, dx, &h_beta, dy_1);
+
+            timer.stop(stream);
         }
 
-        // Convert to miliseconds per call
-        gpu_time_used     = get_time_us() - gpu_time_used;
-        gpu_time_used     = gpu_time_used / (number_hot_calls * 1e3);
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("coomv", times);
+        bench_collect("coomv_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
         size_t flops      = (h_alpha != 1.0) ? 3.0 * nnz : 2.0 * nnz;
         flops             = (h_beta != 0.0) ? flops + m : flops;
         double gpu_gflops = flops / gpu_time_used / 1e6;
@@ -417,6 +434,7 @@ rocsparse_status testing_coomv(Arguments argus)
         }
         double bandwidth
             = (memtrans * sizeof(T) + (2 * nnz) * sizeof(rocsparse_int)) / gpu_time_used / 1e6;
+        bench_set_bandwidth("coomv", bandwidth);
 
         printf("m\t\tn\t\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
         printf("%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
@@ -318,7 +318,7 @@ rocsparse_status testing_coosort(Arguments argus)
     else if(argus.laplacian)
     {
         std::vector<rocsparse_int> hcsr_row_ptr;
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcoo_col_ind, hcoo_val, idx_base);
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcoo_col_ind, hcoo_val, idx_base);
         nnz   = hcsr_row_ptr[m];
 
         // Convert CSR to COO
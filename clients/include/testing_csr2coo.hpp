@@ -170,7 +170,7 @@ rocsparse_status testing_csr2coo(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcol_ind, hval, idx_base);
         nnz   = hcsr_row_ptr[m];
     }
     else
@@ -419,7 +419,7 @@ rocsparse_status testing_csr2csc(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
         nnz   = hcsr_row_ptr[m];
     }
     else
@@ -595,6 +595,11 @@ rocsparse_status testing_csr2csc(Arguments argus)
         rocsparse_int number_cold_calls = 2;
         rocsparse_int number_hot_calls  = argus.iters;
 
+        // Sample the peak device memory footprint of the conversion, the
+        // temporary buffer allocates multiples of nnz
+        device_mem_sampler mem_sampler;
+        mem_sampler.start();
+
         for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
         {
             rocsparse_csr2csc(handle,
@@ -633,8 +638,22 @@ rocsparse_status testing_csr2csc(Arguments argus)
 
         gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
 
-        printf("m\t\tn\t\tnnz\t\tmsec\n");
-        printf("%8d\t%8d\t%9d\t%0.2lf\n", m, n, nnz, gpu_time_used);
+        // Combine the sampled footprint with the exact accounting of the
+        // handle internal temporary memory; the user provided temporary
+        // buffer is added on top of both
+        size_t peak_mem = mem_sampler.stop();
+
+        size_t lib_in_use;
+        size_t lib_peak;
+        size_t lib_buffer_size;
+        rocsparse_memory_snapshot(handle, &lib_in_use, &lib_peak, &lib_buffer_size);
+
+        peak_mem = std::max(peak_mem, lib_peak) + size;
+
+        bench_set_peak_memory("csr2csc", peak_mem);
+
+        printf("m\t\tn\t\tnnz\t\tmsec\t\tpeak_mem_mbyte\n");
+        printf("%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\n", m, n, nnz, gpu_time_used, peak_mem / 1e6);
     }
 
     return rocsparse_status_success;
@@ -427,7 +427,7 @@ rocsparse_status testing_csr2ell(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base);
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base);
         nnz   = hcsr_row_ptr[m];
     }
     else
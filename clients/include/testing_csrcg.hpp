@@ -0,0 +1,751 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRCG_HPP
+#define TESTING_CSRCG_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrcg_bad_arg(void)
+{
+    rocsparse_int    m         = 100;
+    rocsparse_int    nnz       = 100;
+    rocsparse_int    max_iter  = 100;
+    rocsparse_int    safe_size = 100;
+    T                tol       = static_cast<T>(1e-6);
+    rocsparse_int    niter;
+    T                nrm_res;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto db_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             dx      = (T*)dx_managed.get();
+    T*             db      = (T*)db_managed.get();
+    void*          dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !db || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csrcg_buffer_size
+    size_t size;
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrcg_buffer_size(handle, m, nnz, descr, dval, dptr_null, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrcg_buffer_size(handle, m, nnz, descr, dval, dptr, dcol_null, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrcg_buffer_size(handle, m, nnz, descr, dval_null, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_csrcg_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrcg_buffer_size(handle, m, nnz, descr_null, dval, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrcg_buffer_size(handle_null, m, nnz, descr, dval, dptr, dcol, &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrcg
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr_null,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol_null,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval_null,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx_null,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == db)
+    {
+        T* db_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db_null,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: db is nullptr");
+    }
+    // testing for(nullptr == niter)
+    {
+        rocsparse_int* niter_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 niter_null,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: niter is nullptr");
+    }
+    // testing for(nullptr == nrm_res)
+    {
+        T* nrm_res_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 nrm_res_null,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: nrm_res is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr_null,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrcg(handle_null,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 tol,
+                                 max_iter,
+                                 &niter,
+                                 &nrm_res,
+                                 dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrcg(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        m         = argus.M;
+    rocsparse_index_base idx_base  = argus.idx_base;
+    std::string          binfile   = "";
+    std::string          filename  = "";
+    rocsparse_status     status;
+    size_t               size;
+
+    // When in testing mode, M == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m       = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0)
+    {
+        rocsparse_int niter;
+        T             nrm_res;
+
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto db_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto buffer_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr   = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol   = (rocsparse_int*)dcol_managed.get();
+        T*             dval   = (T*)dval_managed.get();
+        T*             dx     = (T*)dx_managed.get();
+        T*             db     = (T*)db_managed.get();
+        void*          buffer = (void*)buffer_managed.get();
+
+        if(!dval || !dptr || !dcol || !dx || !db || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || "
+                                            "!dx || !db || !buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csrcg_buffer_size
+        status = rocsparse_csrcg_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, &size);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        // Test rocsparse_csrcg
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_csrcg(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 nullptr,
+                                 dx,
+                                 db,
+                                 static_cast<T>(1e-6),
+                                 safe_size,
+                                 &niter,
+                                 &nrm_res,
+                                 buffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+
+            // Quick return has to report zero iterations
+            rocsparse_int zero = 0;
+            unit_check_general(1, 1, 1, &zero, &niter);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        rocsparse_int n;
+        if(read_bin_matrix(
+               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m   = gen_laplacian(argus, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz = hcsr_row_ptr[m] - idx_base;
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            rocsparse_int n;
+            if(read_mtx_matrix(
+                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Right-hand side b = A * 1, such that the exact solution is known
+    std::vector<T> hx(m, static_cast<T>(0));
+    std::vector<T> hb(m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        T sum = static_cast<T>(0);
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            sum += hcsr_val[j];
+        }
+        hb[i] = sum;
+    }
+
+    // Residual norm of the initial guess x = 0
+    double nrm_b = 0.0;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        nrm_b += hb[i] * hb[i];
+    }
+    nrm_b = sqrt(nrm_b);
+
+    // Relative stopping tolerance
+    T             tol      = std::numeric_limits<T>::epsilon() * 1e5 * nrm_b;
+    rocsparse_int max_iter = 10000;
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto db_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_niter_managed = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+    auto d_nrm_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             dx      = (T*)dx_managed.get();
+    T*             db      = (T*)db_managed.get();
+    rocsparse_int* d_niter = (rocsparse_int*)d_niter_managed.get();
+    T*             d_nrm   = (T*)d_nrm_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !db || !d_niter || !d_nrm)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!db || !d_niter || !d_nrm");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Obtain csrcg buffer size
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrcg_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        rocsparse_int hniter_1;
+        T             hnrm_1;
+
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcg(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              nullptr,
+                                              dx,
+                                              db,
+                                              tol,
+                                              max_iter,
+                                              &hniter_1,
+                                              &hnrm_1,
+                                              dbuffer));
+
+        std::vector<T> hx_1(m);
+        CHECK_HIP_ERROR(hipMemcpy(hx_1.data(), dx, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // ROCSPARSE pointer mode device
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcg(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              nullptr,
+                                              dx,
+                                              db,
+                                              tol,
+                                              max_iter,
+                                              d_niter,
+                                              d_nrm,
+                                              dbuffer));
+
+        rocsparse_int hniter_2;
+        T             hnrm_2;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hniter_2, d_niter, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&hnrm_2, d_nrm, sizeof(T), hipMemcpyDeviceToHost));
+
+        // Both pointer modes run the identical iteration
+        unit_check_general(1, 1, 1, &hniter_1, &hniter_2);
+        unit_check_near(1, 1, 1, &hnrm_1, &hnrm_2);
+
+        // The solver has to reach the requested tolerance
+        if(hnrm_1 > tol)
+        {
+            verify_rocsparse_status_success(rocsparse_status_internal_error,
+                                            "Error: CG did not converge");
+            return rocsparse_status_internal_error;
+        }
+
+        // Verify the reported residual norm against the solution
+        double nrm_res = 0.0;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            double res = hb[i];
+            for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+                ++j)
+            {
+                res -= static_cast<double>(hcsr_val[j]) * hx_1[hcsr_col_ind[j] - idx_base];
+            }
+            nrm_res += res * res;
+        }
+        nrm_res = sqrt(nrm_res);
+
+        if(nrm_res > 10.0 * tol)
+        {
+            verify_rocsparse_status_success(rocsparse_status_internal_error,
+                                            "Error: CG residual does not match solution");
+            return rocsparse_status_internal_error;
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        rocsparse_int hniter;
+        T             hnrm;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+            rocsparse_csrcg(handle,
+                            m,
+                            nnz,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            db,
+                            tol,
+                            max_iter,
+                            &hniter,
+                            &hnrm,
+                            dbuffer);
+        }
+
+        // The full solve is timed with wall clock, as the host pointer mode
+        // synchronizes on the result anyway
+        std::vector<double> times(number_hot_calls);
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+            double time = get_time_us();
+
+            rocsparse_csrcg(handle,
+                            m,
+                            nnz,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            db,
+                            tol,
+                            max_iter,
+                            &hniter,
+                            &hnrm,
+                            dbuffer);
+
+            times[iter] = get_time_us() - time;
+        }
+
+        bench_collect("csrcg", times);
+
+        // Median in miliseconds per solve
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
+
+        printf("m\t\tnnz\t\titer\tnrm_res\t\tmsec\n");
+        printf("%8d\t%9d\t%6d\t%0.2e\t%0.2lf\n", m, nnz, hniter, (double)hnrm, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRCG_HPP
@@ -0,0 +1,1173 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRGEMM_HPP
+#define TESTING_CSRGEMM_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+/* ============================================================================================ */
+/*! \brief  Host CSR matrix matrix product C = A * B, using a dense marker array per row.
+ *  Column indices of C are returned in ascending order.
+ */
+template <typename T>
+static rocsparse_int host_csrgemm(rocsparse_int               m,
+                                  rocsparse_int               n,
+                                  const rocsparse_int*        csr_row_ptr_A,
+                                  const rocsparse_int*        csr_col_ind_A,
+                                  const T*                    csr_val_A,
+                                  const rocsparse_int*        csr_row_ptr_B,
+                                  const rocsparse_int*        csr_col_ind_B,
+                                  const T*                    csr_val_B,
+                                  std::vector<rocsparse_int>& csr_row_ptr_C,
+                                  std::vector<rocsparse_int>& csr_col_ind_C,
+                                  std::vector<T>&             csr_val_C,
+                                  rocsparse_index_base        idx_base_A,
+                                  rocsparse_index_base        idx_base_B,
+                                  rocsparse_index_base        idx_base_C)
+{
+    csr_row_ptr_C.resize(m + 1);
+    csr_row_ptr_C[0] = idx_base_C;
+
+    std::vector<T>    sum(n, static_cast<T>(0));
+    std::vector<bool> marker(n, false);
+
+    // Count the non-zero pattern of each row
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_nnz = 0;
+
+        for(rocsparse_int j = csr_row_ptr_A[i] - idx_base_A; j < csr_row_ptr_A[i + 1] - idx_base_A;
+            ++j)
+        {
+            rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+            for(rocsparse_int k = csr_row_ptr_B[col_A] - idx_base_B;
+                k < csr_row_ptr_B[col_A + 1] - idx_base_B;
+                ++k)
+            {
+                rocsparse_int col_B = csr_col_ind_B[k] - idx_base_B;
+
+                if(!marker[col_B])
+                {
+                    marker[col_B] = true;
+                    ++row_nnz;
+                }
+            }
+        }
+
+        csr_row_ptr_C[i + 1] = csr_row_ptr_C[i] + row_nnz;
+
+        // Clear the marker for the next row
+        for(rocsparse_int j = csr_row_ptr_A[i] - idx_base_A; j < csr_row_ptr_A[i + 1] - idx_base_A;
+            ++j)
+        {
+            rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+            for(rocsparse_int k = csr_row_ptr_B[col_A] - idx_base_B;
+                k < csr_row_ptr_B[col_A + 1] - idx_base_B;
+                ++k)
+            {
+                marker[csr_col_ind_B[k] - idx_base_B] = false;
+            }
+        }
+    }
+
+    rocsparse_int nnz_C = csr_row_ptr_C[m] - idx_base_C;
+
+    csr_col_ind_C.resize(nnz_C);
+    csr_val_C.resize(nnz_C);
+
+    // Accumulate the products of each row into the dense scratch row and
+    // gather the touched columns in ascending order
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr_C[i] - idx_base_C;
+        rocsparse_int row_nnz   = 0;
+
+        for(rocsparse_int j = csr_row_ptr_A[i] - idx_base_A; j < csr_row_ptr_A[i + 1] - idx_base_A;
+            ++j)
+        {
+            rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+            T             val_A = csr_val_A[j];
+
+            for(rocsparse_int k = csr_row_ptr_B[col_A] - idx_base_B;
+                k < csr_row_ptr_B[col_A + 1] - idx_base_B;
+                ++k)
+            {
+                rocsparse_int col_B = csr_col_ind_B[k] - idx_base_B;
+
+                if(!marker[col_B])
+                {
+                    marker[col_B]                        = true;
+                    csr_col_ind_C[row_begin + row_nnz++] = col_B;
+                }
+
+                sum[col_B] = std::fma(val_A, csr_val_B[k], sum[col_B]);
+            }
+        }
+
+        std::sort(csr_col_ind_C.begin() + row_begin, csr_col_ind_C.begin() + row_begin + row_nnz);
+
+        for(rocsparse_int j = 0; j < row_nnz; ++j)
+        {
+            rocsparse_int col = csr_col_ind_C[row_begin + j];
+
+            csr_val_C[row_begin + j]     = sum[col];
+            sum[col]                     = static_cast<T>(0);
+            marker[col]                  = false;
+            csr_col_ind_C[row_begin + j] = col + idx_base_C;
+        }
+    }
+
+    return nnz_C;
+}
+
+template <typename T>
+void testing_csrgemm_bad_arg(void)
+{
+    rocsparse_int       m         = 100;
+    rocsparse_int       n         = 100;
+    rocsparse_int       k         = 100;
+    rocsparse_int       nnz_A     = 100;
+    rocsparse_int       nnz_B     = 100;
+    rocsparse_int       safe_size = 100;
+    rocsparse_operation trans     = rocsparse_operation_none;
+    rocsparse_status    status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_A(new descr_struct);
+    rocsparse_mat_descr           descr_A = unique_ptr_descr_A->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_B(new descr_struct);
+    rocsparse_mat_descr           descr_B = unique_ptr_descr_B->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr_C(new descr_struct);
+    rocsparse_mat_descr           descr_C = unique_ptr_descr_C->descr;
+
+    auto dptr_A_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_A_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_A_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dptr_B_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_B_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_B_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dptr_C_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_C_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_C_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr_A  = (rocsparse_int*)dptr_A_managed.get();
+    rocsparse_int* dcol_A  = (rocsparse_int*)dcol_A_managed.get();
+    T*             dval_A  = (T*)dval_A_managed.get();
+    rocsparse_int* dptr_B  = (rocsparse_int*)dptr_B_managed.get();
+    rocsparse_int* dcol_B  = (rocsparse_int*)dcol_B_managed.get();
+    T*             dval_B  = (T*)dval_B_managed.get();
+    rocsparse_int* dptr_C  = (rocsparse_int*)dptr_C_managed.get();
+    rocsparse_int* dcol_C  = (rocsparse_int*)dcol_C_managed.get();
+    T*             dval_C  = (T*)dval_C_managed.get();
+    void*          dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dptr_A || !dcol_A || !dval_A || !dptr_B || !dcol_B || !dval_B || !dptr_C || !dcol_C
+       || !dval_C || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csrgemm_buffer_size
+    size_t size;
+
+    // testing for(nullptr == dptr_A)
+    {
+        rocsparse_int* dptr_A_null = nullptr;
+
+        status = rocsparse_csrgemm_buffer_size(handle,
+                                               trans,
+                                               trans,
+                                               m,
+                                               n,
+                                               k,
+                                               descr_A,
+                                               nnz_A,
+                                               dptr_A_null,
+                                               dcol_A,
+                                               descr_B,
+                                               nnz_B,
+                                               dptr_B,
+                                               dcol_B,
+                                               &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr_A is nullptr");
+    }
+    // testing for(nullptr == dcol_B)
+    {
+        rocsparse_int* dcol_B_null = nullptr;
+
+        status = rocsparse_csrgemm_buffer_size(handle,
+                                               trans,
+                                               trans,
+                                               m,
+                                               n,
+                                               k,
+                                               descr_A,
+                                               nnz_A,
+                                               dptr_A,
+                                               dcol_A,
+                                               descr_B,
+                                               nnz_B,
+                                               dptr_B,
+                                               dcol_B_null,
+                                               &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol_B is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_csrgemm_buffer_size(handle,
+                                               trans,
+                                               trans,
+                                               m,
+                                               n,
+                                               k,
+                                               descr_A,
+                                               nnz_A,
+                                               dptr_A,
+                                               dcol_A,
+                                               descr_B,
+                                               nnz_B,
+                                               dptr_B,
+                                               dcol_B,
+                                               size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr_A)
+    {
+        rocsparse_mat_descr descr_A_null = nullptr;
+
+        status = rocsparse_csrgemm_buffer_size(handle,
+                                               trans,
+                                               trans,
+                                               m,
+                                               n,
+                                               k,
+                                               descr_A_null,
+                                               nnz_A,
+                                               dptr_A,
+                                               dcol_A,
+                                               descr_B,
+                                               nnz_B,
+                                               dptr_B,
+                                               dcol_B,
+                                               &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr_A is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrgemm_buffer_size(handle_null,
+                                               trans,
+                                               trans,
+                                               m,
+                                               n,
+                                               k,
+                                               descr_A,
+                                               nnz_A,
+                                               dptr_A,
+                                               dcol_A,
+                                               descr_B,
+                                               nnz_B,
+                                               dptr_B,
+                                               dcol_B,
+                                               &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrgemm_nnz
+    rocsparse_int nnz_C;
+
+    // testing for(nullptr == dptr_A)
+    {
+        rocsparse_int* dptr_A_null = nullptr;
+
+        status = rocsparse_csrgemm_nnz(handle,
+                                       trans,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       descr_A,
+                                       nnz_A,
+                                       dptr_A_null,
+                                       dcol_A,
+                                       descr_B,
+                                       nnz_B,
+                                       dptr_B,
+                                       dcol_B,
+                                       descr_C,
+                                       dptr_C,
+                                       &nnz_C,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr_A is nullptr");
+    }
+    // testing for(nullptr == dptr_C)
+    {
+        rocsparse_int* dptr_C_null = nullptr;
+
+        status = rocsparse_csrgemm_nnz(handle,
+                                       trans,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       descr_A,
+                                       nnz_A,
+                                       dptr_A,
+                                       dcol_A,
+                                       descr_B,
+                                       nnz_B,
+                                       dptr_B,
+                                       dcol_B,
+                                       descr_C,
+                                       dptr_C_null,
+                                       &nnz_C,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr_C is nullptr");
+    }
+    // testing for(nullptr == nnz_C)
+    {
+        rocsparse_int* nnz_C_null = nullptr;
+
+        status = rocsparse_csrgemm_nnz(handle,
+                                       trans,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       descr_A,
+                                       nnz_A,
+                                       dptr_A,
+                                       dcol_A,
+                                       descr_B,
+                                       nnz_B,
+                                       dptr_B,
+                                       dcol_B,
+                                       descr_C,
+                                       dptr_C,
+                                       nnz_C_null,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: nnz_C is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrgemm_nnz(handle,
+                                       trans,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       descr_A,
+                                       nnz_A,
+                                       dptr_A,
+                                       dcol_A,
+                                       descr_B,
+                                       nnz_B,
+                                       dptr_B,
+                                       dcol_B,
+                                       descr_C,
+                                       dptr_C,
+                                       &nnz_C,
+                                       dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrgemm_nnz(handle_null,
+                                       trans,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       descr_A,
+                                       nnz_A,
+                                       dptr_A,
+                                       dcol_A,
+                                       descr_B,
+                                       nnz_B,
+                                       dptr_B,
+                                       dcol_B,
+                                       descr_C,
+                                       dptr_C,
+                                       &nnz_C,
+                                       dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrgemm
+
+    // testing for(nullptr == dval_A)
+    {
+        T* dval_A_null = nullptr;
+
+        status = rocsparse_csrgemm(handle,
+                                   trans,
+                                   trans,
+                                   m,
+                                   n,
+                                   k,
+                                   descr_A,
+                                   nnz_A,
+                                   dval_A_null,
+                                   dptr_A,
+                                   dcol_A,
+                                   descr_B,
+                                   nnz_B,
+                                   dval_B,
+                                   dptr_B,
+                                   dcol_B,
+                                   descr_C,
+                                   dval_C,
+                                   dptr_C,
+                                   dcol_C,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval_A is nullptr");
+    }
+    // testing for(nullptr == dval_B)
+    {
+        T* dval_B_null = nullptr;
+
+        status = rocsparse_csrgemm(handle,
+                                   trans,
+                                   trans,
+                                   m,
+                                   n,
+                                   k,
+                                   descr_A,
+                                   nnz_A,
+                                   dval_A,
+                                   dptr_A,
+                                   dcol_A,
+                                   descr_B,
+                                   nnz_B,
+                                   dval_B_null,
+                                   dptr_B,
+                                   dcol_B,
+                                   descr_C,
+                                   dval_C,
+                                   dptr_C,
+                                   dcol_C,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval_B is nullptr");
+    }
+    // testing for(nullptr == dval_C)
+    {
+        T* dval_C_null = nullptr;
+
+        status = rocsparse_csrgemm(handle,
+                                   trans,
+                                   trans,
+                                   m,
+                                   n,
+                                   k,
+                                   descr_A,
+                                   nnz_A,
+                                   dval_A,
+                                   dptr_A,
+                                   dcol_A,
+                                   descr_B,
+                                   nnz_B,
+                                   dval_B,
+                                   dptr_B,
+                                   dcol_B,
+                                   descr_C,
+                                   dval_C_null,
+                                   dptr_C,
+                                   dcol_C,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval_C is nullptr");
+    }
+    // testing for(nullptr == dcol_C)
+    {
+        rocsparse_int* dcol_C_null = nullptr;
+
+        status = rocsparse_csrgemm(handle,
+                                   trans,
+                                   trans,
+                                   m,
+                                   n,
+                                   k,
+                                   descr_A,
+                                   nnz_A,
+                                   dval_A,
+                                   dptr_A,
+                                   dcol_A,
+                                   descr_B,
+                                   nnz_B,
+                                   dval_B,
+                                   dptr_B,
+                                   dcol_B,
+                                   descr_C,
+                                   dval_C,
+                                   dptr_C,
+                                   dcol_C_null,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol_C is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csrgemm(handle,
+                                   trans,
+                                   trans,
+                                   m,
+                                   n,
+                                   k,
+                                   descr_A,
+                                   nnz_A,
+                                   dval_A,
+                                   dptr_A,
+                                   dcol_A,
+                                   descr_B,
+                                   nnz_B,
+                                   dval_B,
+                                   dptr_B,
+                                   dcol_B,
+                                   descr_C,
+                                   dval_C,
+                                   dptr_C,
+                                   dcol_C,
+                                   dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrgemm(handle_null,
+                                   trans,
+                                   trans,
+                                   m,
+                                   n,
+                                   k,
+                                   descr_A,
+                                   nnz_A,
+                                   dval_A,
+                                   dptr_A,
+                                   dcol_A,
+                                   descr_B,
+                                   nnz_B,
+                                   dval_B,
+                                   dptr_B,
+                                   dcol_B,
+                                   descr_C,
+                                   dval_C,
+                                   dptr_C,
+                                   dcol_C,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrgemm(Arguments argus)
+{
+    rocsparse_int        safe_size  = 100;
+    rocsparse_int        m          = argus.M;
+    rocsparse_int        n          = argus.N;
+    rocsparse_int        k          = argus.K;
+    rocsparse_operation  trans      = rocsparse_operation_none;
+    rocsparse_index_base idx_base_A = argus.idx_base;
+    rocsparse_index_base idx_base_B = argus.idx_base2;
+    rocsparse_index_base idx_base_C = argus.idx_base;
+    std::string          binfile    = "";
+    std::string          filename   = "";
+    rocsparse_status     status;
+    size_t               size;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = k = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr_A(new descr_struct);
+    rocsparse_mat_descr           descr_A = test_descr_A->descr;
+
+    std::unique_ptr<descr_struct> test_descr_B(new descr_struct);
+    rocsparse_mat_descr           descr_B = test_descr_B->descr;
+
+    std::unique_ptr<descr_struct> test_descr_C(new descr_struct);
+    rocsparse_mat_descr           descr_C = test_descr_C->descr;
+
+    // Set matrix index bases
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_A, idx_base_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_B, idx_base_B));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_C, idx_base_C));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || k > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, std::max(k, n));
+    }
+    rocsparse_int nnz_A = m * scale * k;
+    rocsparse_int nnz_B = k * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || k <= 0 || nnz_A <= 0 || nnz_B <= 0)
+    {
+        auto dptr_A_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_A_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_A_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dptr_B_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_B_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_B_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dptr_C_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dbuffer_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr_A  = (rocsparse_int*)dptr_A_managed.get();
+        rocsparse_int* dcol_A  = (rocsparse_int*)dcol_A_managed.get();
+        T*             dval_A  = (T*)dval_A_managed.get();
+        rocsparse_int* dptr_B  = (rocsparse_int*)dptr_B_managed.get();
+        rocsparse_int* dcol_B  = (rocsparse_int*)dcol_B_managed.get();
+        T*             dval_B  = (T*)dval_B_managed.get();
+        rocsparse_int* dptr_C  = (rocsparse_int*)dptr_C_managed.get();
+        void*          dbuffer = (void*)dbuffer_managed.get();
+
+        if(!dptr_A || !dcol_A || !dval_A || !dptr_B || !dcol_B || !dval_B || !dptr_C || !dbuffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr_A || !dcol_A || !dval_A || !dptr_B || "
+                                            "!dcol_B || !dval_B || !dptr_C || !dbuffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csrgemm_buffer_size
+        status = rocsparse_csrgemm_buffer_size(handle,
+                                               trans,
+                                               trans,
+                                               m,
+                                               n,
+                                               k,
+                                               descr_A,
+                                               nnz_A,
+                                               dptr_A,
+                                               dcol_A,
+                                               descr_B,
+                                               nnz_B,
+                                               dptr_B,
+                                               dcol_B,
+                                               &size);
+
+        if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0)
+        {
+            verify_rocsparse_status_invalid_size(
+                status, "Error: m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && k >= 0");
+        }
+
+        // Test rocsparse_csrgemm_nnz
+        rocsparse_int nnz_C;
+        status = rocsparse_csrgemm_nnz(handle,
+                                       trans,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       descr_A,
+                                       nnz_A,
+                                       dptr_A,
+                                       dcol_A,
+                                       descr_B,
+                                       nnz_B,
+                                       dptr_B,
+                                       dcol_B,
+                                       descr_C,
+                                       dptr_C,
+                                       &nnz_C,
+                                       dbuffer);
+
+        if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0)
+        {
+            verify_rocsparse_status_invalid_size(
+                status, "Error: m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && k >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr_A;
+    std::vector<rocsparse_int> hcsr_col_ind_A;
+    std::vector<T>             hcsr_val_A;
+    std::vector<rocsparse_int> hcsr_row_ptr_B;
+    std::vector<rocsparse_int> hcsr_col_ind_B;
+    std::vector<T>             hcsr_val_B;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, k, nnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idx_base_A)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+
+        // Square the matrix from file, re-based to the B index base
+        n = k;
+
+        hcsr_row_ptr_B.resize(k + 1);
+        hcsr_col_ind_B.resize(nnz_A);
+        hcsr_val_B = hcsr_val_A;
+
+        for(rocsparse_int i = 0; i < k + 1; ++i)
+        {
+            hcsr_row_ptr_B[i] = hcsr_row_ptr_A[i] - idx_base_A + idx_base_B;
+        }
+        for(rocsparse_int i = 0; i < nnz_A; ++i)
+        {
+            hcsr_col_ind_B[i] = hcsr_col_ind_A[i] - idx_base_A + idx_base_B;
+        }
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            if(read_mtx_matrix(filename.c_str(),
+                               m,
+                               k,
+                               nnz_A,
+                               hcoo_row_ind,
+                               hcsr_col_ind_A,
+                               hcsr_val_A,
+                               idx_base_A)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+            n = k;
+        }
+        else
+        {
+            gen_matrix_coo(m, k, nnz_A, hcoo_row_ind, hcsr_col_ind_A, hcsr_val_A, idx_base_A);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr_A.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz_A; ++i)
+        {
+            ++hcsr_row_ptr_A[hcoo_row_ind[i] + 1 - idx_base_A];
+        }
+
+        hcsr_row_ptr_A[0] = idx_base_A;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr_A[i + 1] += hcsr_row_ptr_A[i];
+        }
+
+        if(filename != "")
+        {
+            // Square the matrix from file, re-based to the B index base
+            hcsr_row_ptr_B.resize(k + 1);
+            hcsr_col_ind_B.resize(nnz_A);
+            hcsr_val_B = hcsr_val_A;
+
+            for(rocsparse_int i = 0; i < k + 1; ++i)
+            {
+                hcsr_row_ptr_B[i] = hcsr_row_ptr_A[i] - idx_base_A + idx_base_B;
+            }
+            for(rocsparse_int i = 0; i < nnz_A; ++i)
+            {
+                hcsr_col_ind_B[i] = hcsr_col_ind_A[i] - idx_base_A + idx_base_B;
+            }
+        }
+        else
+        {
+            // Generate a second random matrix for B
+            std::vector<rocsparse_int> hcoo_row_ind_B;
+            gen_matrix_coo(k, n, nnz_B, hcoo_row_ind_B, hcsr_col_ind_B, hcsr_val_B, idx_base_B);
+
+            hcsr_row_ptr_B.resize(k + 1, 0);
+            for(rocsparse_int i = 0; i < nnz_B; ++i)
+            {
+                ++hcsr_row_ptr_B[hcoo_row_ind_B[i] + 1 - idx_base_B];
+            }
+
+            hcsr_row_ptr_B[0] = idx_base_B;
+            for(rocsparse_int i = 0; i < k; ++i)
+            {
+                hcsr_row_ptr_B[i + 1] += hcsr_row_ptr_B[i];
+            }
+        }
+    }
+
+    nnz_A = hcsr_row_ptr_A[m] - idx_base_A;
+    nnz_B = hcsr_row_ptr_B[k] - idx_base_B;
+
+    // Allocate memory on device
+    auto dptr_A_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_A_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz_A), device_free};
+    auto dval_A_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto dptr_B_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (k + 1)), device_free};
+    auto dcol_B_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz_B), device_free};
+    auto dval_B_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dptr_C_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+
+    rocsparse_int* dptr_A = (rocsparse_int*)dptr_A_managed.get();
+    rocsparse_int* dcol_A = (rocsparse_int*)dcol_A_managed.get();
+    T*             dval_A = (T*)dval_A_managed.get();
+    rocsparse_int* dptr_B = (rocsparse_int*)dptr_B_managed.get();
+    rocsparse_int* dcol_B = (rocsparse_int*)dcol_B_managed.get();
+    T*             dval_B = (T*)dval_B_managed.get();
+    rocsparse_int* dptr_C = (rocsparse_int*)dptr_C_managed.get();
+
+    if(!dptr_A || !dcol_A || !dval_A || !dptr_B || !dcol_B || !dval_B || !dptr_C)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr_A || !dcol_A || !dval_A || !dptr_B || "
+                                        "!dcol_B || !dval_B || !dptr_C");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr_A, hcsr_row_ptr_A.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_A, hcsr_col_ind_A.data(), sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_A, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr_B, hcsr_row_ptr_B.data(), sizeof(rocsparse_int) * (k + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_B, hcsr_col_ind_B.data(), sizeof(rocsparse_int) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_B, hcsr_val_B.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+
+    // Obtain csrgemm buffer size
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size(handle,
+                                                        trans,
+                                                        trans,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        descr_A,
+                                                        nnz_A,
+                                                        dptr_A,
+                                                        dcol_A,
+                                                        descr_B,
+                                                        nnz_B,
+                                                        dptr_B,
+                                                        dcol_B,
+                                                        &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // Obtain the non-zero pattern of C
+    rocsparse_int hnnz_C;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz(handle,
+                                                trans,
+                                                trans,
+                                                m,
+                                                n,
+                                                k,
+                                                descr_A,
+                                                nnz_A,
+                                                dptr_A,
+                                                dcol_A,
+                                                descr_B,
+                                                nnz_B,
+                                                dptr_B,
+                                                dcol_B,
+                                                descr_C,
+                                                dptr_C,
+                                                &hnnz_C,
+                                                dbuffer));
+
+    // Allocate the C matrix arrays
+    rocsparse_int C_size = std::max(hnnz_C, static_cast<rocsparse_int>(1));
+
+    auto dcol_C_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * C_size), device_free};
+    auto dval_C_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * C_size), device_free};
+
+    rocsparse_int* dcol_C = (rocsparse_int*)dcol_C_managed.get();
+    T*             dval_C = (T*)dval_C_managed.get();
+
+    if(!dcol_C || !dval_C)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dcol_C || !dval_C");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm(handle,
+                                                trans,
+                                                trans,
+                                                m,
+                                                n,
+                                                k,
+                                                descr_A,
+                                                nnz_A,
+                                                dval_A,
+                                                dptr_A,
+                                                dcol_A,
+                                                descr_B,
+                                                nnz_B,
+                                                dval_B,
+                                                dptr_B,
+                                                dcol_B,
+                                                descr_C,
+                                                dval_C,
+                                                dptr_C,
+                                                dcol_C,
+                                                dbuffer));
+
+        // Copy output from device to CPU
+        std::vector<rocsparse_int> hcsr_row_ptr_C(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind_C(hnnz_C);
+        std::vector<T>             hcsr_val_C(hnnz_C);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C.data(),
+                                  dptr_C,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C.data(),
+                                  dcol_C,
+                                  sizeof(rocsparse_int) * hnnz_C,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C.data(), dval_C, sizeof(T) * hnnz_C, hipMemcpyDeviceToHost));
+
+        // Host csrgemm
+        std::vector<rocsparse_int> hcsr_row_ptr_C_gold;
+        std::vector<rocsparse_int> hcsr_col_ind_C_gold;
+        std::vector<T>             hcsr_val_C_gold;
+
+        double cpu_time_used = get_time_us();
+
+        rocsparse_int nnz_C_gold = host_csrgemm(m,
+                                                n,
+                                                hcsr_row_ptr_A.data(),
+                                                hcsr_col_ind_A.data(),
+                                                hcsr_val_A.data(),
+                                                hcsr_row_ptr_B.data(),
+                                                hcsr_col_ind_B.data(),
+                                                hcsr_val_B.data(),
+                                                hcsr_row_ptr_C_gold,
+                                                hcsr_col_ind_C_gold,
+                                                hcsr_val_C_gold,
+                                                idx_base_A,
+                                                idx_base_B,
+                                                idx_base_C);
+
+        cpu_time_used = get_time_us() - cpu_time_used;
+
+        // Check the structure
+        unit_check_general(1, 1, 1, &nnz_C_gold, &hnnz_C);
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+        unit_check_general(1, hnnz_C, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+
+        // The products of a row may be accumulated in any order on the device,
+        // compare with a floating point tolerance
+        unit_check_near(1, hnnz_C, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrgemm(handle,
+                              trans,
+                              trans,
+                              m,
+                              n,
+                              k,
+                              descr_A,
+                              nnz_A,
+                              dval_A,
+                              dptr_A,
+                              dcol_A,
+                              descr_B,
+                              nnz_B,
+                              dval_B,
+                              dptr_B,
+                              dcol_B,
+                              descr_C,
+                              dval_C,
+                              dptr_C,
+                              dcol_C,
+                              dbuffer);
+        }
+
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            timer.start(stream);
+
+            rocsparse_csrgemm(handle,
+                              trans,
+                              trans,
+                              m,
+                              n,
+                              k,
+                              descr_A,
+                              nnz_A,
+                              dval_A,
+                              dptr_A,
+                              dcol_A,
+                              descr_B,
+                              nnz_B,
+                              dval_B,
+                              dptr_B,
+                              dcol_B,
+                              descr_C,
+                              dval_C,
+                              dptr_C,
+                              dcol_C,
+                              dbuffer);
+
+            timer.stop(stream);
+        }
+
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("csrgemm", times);
+        bench_collect("csrgemm_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
+
+        // Count the intermediate products to obtain the flop count
+        size_t nprod = 0;
+        for(rocsparse_int i = 0; i < nnz_A; ++i)
+        {
+            rocsparse_int col_A = hcsr_col_ind_A[i] - idx_base_A;
+            nprod += hcsr_row_ptr_B[col_A + 1] - hcsr_row_ptr_B[col_A];
+        }
+
+        double gpu_gflops = 2.0 * nprod / gpu_time_used / 1e6;
+
+        // Bandwidth
+        size_t int_data = (m + 1 + nnz_A + k + 1 + nnz_B + m + 1 + hnnz_C) * sizeof(rocsparse_int);
+        size_t flt_data = (nnz_A + nnz_B + hnnz_C) * sizeof(T);
+        double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+        bench_set_bandwidth("csrgemm", bandwidth);
+
+        printf("m\t\tn\t\tk\t\tnnz_C\t\tGFlops\tGB/s\tmsec\n");
+        printf("%8d\t%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               k,
+               hnnz_C,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRGEMM_HPP
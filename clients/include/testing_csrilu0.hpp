@@ -444,7 +444,7 @@ rocsparse_status testing_csrilu0(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m   = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        m   = gen_laplacian(argus, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
         nnz = hcsr_row_ptr[m];
     }
     else
@@ -591,7 +591,7 @@ rocsparse_status testing_csrilu0(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
@@ -609,10 +609,17 @@ rocsparse_status testing_csrilu0(Arguments argus)
                               dbuffer);
         }
 
-        double gpu_time_used = get_time_us(); // in microseconds
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
+            timer.start(stream);
+
             rocsparse_csrilu0(handle,
                               m,
                               nnz,
@@ -623,15 +630,27 @@ rocsparse_status testing_csrilu0(Arguments argus)
                               info,
                               rocsparse_solve_policy_auto,
                               dbuffer);
+
+            timer.stop(stream);
         }
 
-        // Convert to miliseconds per call
-        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("csrilu0", times);
+        bench_collect("csrilu0_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
 
         // Bandwidth
         size_t int_data  = (m + 1 + nnz) * sizeof(rocsparse_int);
         size_t flt_data  = (nnz + nnz) * sizeof(T);
         double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+        bench_set_bandwidth("csrilu0", bandwidth);
 
         printf("m\t\tnnz\t\tGB/s\tmsec\n");
         printf("%8d\t%9d\t%0.2lf\t%0.2lf\n", m, nnz, bandwidth, gpu_time_used);
@@ -0,0 +1,796 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRILUK_HPP
+#define TESTING_CSRILUK_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cmath>
+#include <map>
+#include <rocsparse.h>
+#include <string>
+#include <vector>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+/* ============================================================================================ */
+/*! \brief  Host symbolic ILU(k) factorization. Fill-in entries obtain the level of their
+ *  generating entries plus one and are kept, if their level does not exceed the requested
+ *  fill level. Entries of the input matrix have level zero.
+ */
+static inline void host_csriluk_nnz(rocsparse_int               m,
+                                    const rocsparse_int*        ptr,
+                                    const rocsparse_int*        col,
+                                    rocsparse_int               level,
+                                    rocsparse_index_base        idx_base,
+                                    std::vector<rocsparse_int>& iluk_row_ptr,
+                                    std::vector<rocsparse_int>& iluk_col_ind)
+{
+    std::vector<std::vector<std::pair<rocsparse_int, rocsparse_int>>> urow(m);
+
+    iluk_row_ptr.resize(m + 1);
+    iluk_col_ind.clear();
+
+    iluk_row_ptr[0] = idx_base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // Working row, mapping column index to fill level
+        std::map<rocsparse_int, rocsparse_int> w;
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            w[col[j] - idx_base] = 0;
+        }
+
+        // Merge the upper parts of the dependency rows in ascending order
+        for(auto it = w.begin(); it != w.end() && it->first < i; ++it)
+        {
+            rocsparse_int k     = it->first;
+            rocsparse_int lev_k = it->second;
+
+            for(auto& u : urow[k])
+            {
+                rocsparse_int lev = lev_k + u.second + 1;
+
+                if(lev > level)
+                {
+                    continue;
+                }
+
+                auto pos = w.find(u.first);
+                if(pos == w.end())
+                {
+                    w[u.first] = lev;
+                }
+                else if(lev < pos->second)
+                {
+                    pos->second = lev;
+                }
+            }
+        }
+
+        for(auto& entry : w)
+        {
+            iluk_col_ind.push_back(entry.first + idx_base);
+
+            if(entry.first > i)
+            {
+                urow[i].push_back(entry);
+            }
+        }
+
+        iluk_row_ptr[i + 1] = static_cast<rocsparse_int>(iluk_col_ind.size()) + idx_base;
+    }
+}
+
+template <typename T>
+void testing_csriluk_bad_arg(void)
+{
+    rocsparse_int          m         = 100;
+    rocsparse_int          nnz       = 100;
+    rocsparse_int          level     = 1;
+    rocsparse_int          safe_size = 100;
+    rocsparse_solve_policy solve     = rocsparse_solve_policy_auto;
+    rocsparse_status       status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto diluk_ptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto diluk_col_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto diluk_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dbuffer_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr      = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol      = (rocsparse_int*)dcol_managed.get();
+    T*             dval      = (T*)dval_managed.get();
+    rocsparse_int* diluk_ptr = (rocsparse_int*)diluk_ptr_managed.get();
+    rocsparse_int* diluk_col = (rocsparse_int*)diluk_col_managed.get();
+    T*             diluk_val = (T*)diluk_val_managed.get();
+    void*          dbuffer   = (void*)dbuffer_managed.get();
+
+    if(!dptr || !dcol || !dval || !diluk_ptr || !diluk_col || !diluk_val || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csriluk_buffer_size
+    size_t size;
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csriluk_buffer_size(
+            handle, m, nnz, descr, dval, dptr_null, dcol, info, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csriluk_buffer_size(
+            handle, m, nnz, descr, dval, dptr, dcol_null, info, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == buffer_size)
+    {
+        size_t* size_null = nullptr;
+
+        status = rocsparse_csriluk_buffer_size(
+            handle, m, nnz, descr, dval, dptr, dcol, info, size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: size is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csriluk_buffer_size(
+            handle, m, nnz, descr_null, dval, dptr, dcol, info, &size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csriluk_buffer_size(
+            handle_null, m, nnz, descr, dval, dptr, dcol, info, &size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csriluk_nnz
+    rocsparse_int iluk_nnz;
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csriluk_nnz(
+            handle, m, nnz, level, descr, dptr_null, dcol, info, diluk_ptr, &iluk_nnz, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csriluk_nnz(
+            handle, m, nnz, level, descr, dptr, dcol_null, info, diluk_ptr, &iluk_nnz, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == diluk_ptr)
+    {
+        rocsparse_int* diluk_ptr_null = nullptr;
+
+        status = rocsparse_csriluk_nnz(
+            handle, m, nnz, level, descr, dptr, dcol, info, diluk_ptr_null, &iluk_nnz, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: iluk_row_ptr is nullptr");
+    }
+    // testing for(nullptr == iluk_nnz)
+    {
+        rocsparse_int* iluk_nnz_null = nullptr;
+
+        status = rocsparse_csriluk_nnz(
+            handle, m, nnz, level, descr, dptr, dcol, info, diluk_ptr, iluk_nnz_null, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: iluk_nnz is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csriluk_nnz(
+            handle, m, nnz, level, descr, dptr, dcol, info, diluk_ptr, &iluk_nnz, dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csriluk_nnz(
+            handle_null, m, nnz, level, descr, dptr, dcol, info, diluk_ptr, &iluk_nnz, dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csriluk
+
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csriluk(handle,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   dval_null,
+                                   dptr,
+                                   dcol,
+                                   info,
+                                   diluk_val,
+                                   diluk_ptr,
+                                   diluk_col,
+                                   solve,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == diluk_val)
+    {
+        T* diluk_val_null = nullptr;
+
+        status = rocsparse_csriluk(handle,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   dcol,
+                                   info,
+                                   diluk_val_null,
+                                   diluk_ptr,
+                                   diluk_col,
+                                   solve,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: iluk_val is nullptr");
+    }
+    // testing for(nullptr == diluk_col)
+    {
+        rocsparse_int* diluk_col_null = nullptr;
+
+        status = rocsparse_csriluk(handle,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   dcol,
+                                   info,
+                                   diluk_val,
+                                   diluk_ptr,
+                                   diluk_col_null,
+                                   solve,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: iluk_col_ind is nullptr");
+    }
+    // testing for(nullptr == dbuffer)
+    {
+        void* dbuffer_null = nullptr;
+
+        status = rocsparse_csriluk(handle,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   dcol,
+                                   info,
+                                   diluk_val,
+                                   diluk_ptr,
+                                   diluk_col,
+                                   solve,
+                                   dbuffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dbuffer is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csriluk(handle_null,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   dcol,
+                                   info,
+                                   diluk_val,
+                                   diluk_ptr,
+                                   diluk_col,
+                                   solve,
+                                   dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csriluk_zero_pivot
+    rocsparse_int position;
+
+    // testing for(nullptr == position)
+    {
+        rocsparse_int* position_null = nullptr;
+
+        status = rocsparse_csriluk_zero_pivot(handle, info, position_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: position is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csriluk_zero_pivot(handle, info_null, &position);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csriluk_zero_pivot(handle_null, info, &position);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csriluk_clear
+
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csriluk_clear(handle, info_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csriluk_clear(handle_null, info);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csriluk(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        m         = argus.M;
+    rocsparse_int        level     = argus.K; // fill level
+    rocsparse_index_base idx_base  = argus.idx_base;
+    std::string          binfile   = "";
+    std::string          filename  = "";
+    rocsparse_status     status;
+    size_t               size;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m       = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0 || level < 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto diluk_ptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto buffer_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* dptr      = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol      = (rocsparse_int*)dcol_managed.get();
+        T*             dval      = (T*)dval_managed.get();
+        rocsparse_int* diluk_ptr = (rocsparse_int*)diluk_ptr_managed.get();
+        void*          buffer    = (void*)buffer_managed.get();
+
+        if(!dptr || !dcol || !dval || !diluk_ptr || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !diluk_ptr || !buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csriluk_nnz
+        rocsparse_int iluk_nnz;
+        status = rocsparse_csriluk_nnz(
+            handle, m, nnz, level, descr, dptr, dcol, info, diluk_ptr, &iluk_nnz, buffer);
+
+        if(m < 0 || nnz < 0 || level < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0 || level < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0 && level >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m   = gen_laplacian(argus, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz = hcsr_row_ptr[m];
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto diluk_ptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto d_position_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+
+    rocsparse_int* dptr       = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol       = (rocsparse_int*)dcol_managed.get();
+    T*             dval       = (T*)dval_managed.get();
+    rocsparse_int* diluk_ptr  = (rocsparse_int*)diluk_ptr_managed.get();
+    rocsparse_int* d_position = (rocsparse_int*)d_position_managed.get();
+
+    if(!dptr || !dcol || !dval || !diluk_ptr || !d_position)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval || !diluk_ptr || !d_position");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain csriluk buffer size
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csriluk_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, info, &size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // Symbolic factorization
+    rocsparse_int hiluk_nnz;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(
+        handle, m, nnz, level, descr, dptr, dcol, info, diluk_ptr, &hiluk_nnz, dbuffer));
+
+    // Host symbolic factorization
+    std::vector<rocsparse_int> hiluk_row_ptr_gold;
+    std::vector<rocsparse_int> hiluk_col_ind_gold;
+
+    host_csriluk_nnz(
+        m, hcsr_row_ptr.data(), hcsr_col_ind.data(), level, idx_base, hiluk_row_ptr_gold, hiluk_col_ind_gold);
+
+    rocsparse_int hiluk_nnz_gold = static_cast<rocsparse_int>(hiluk_col_ind_gold.size());
+
+    // Allocate the factorization arrays
+    auto diluk_col_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * hiluk_nnz), device_free};
+    auto diluk_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * hiluk_nnz), device_free};
+
+    rocsparse_int* diluk_col = (rocsparse_int*)diluk_col_managed.get();
+    T*             diluk_val = (T*)diluk_val_managed.get();
+
+    if(!diluk_col || !diluk_val)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!diluk_col || !diluk_val");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // Check the factorization pattern
+        std::vector<rocsparse_int> hiluk_row_ptr(m + 1);
+        CHECK_HIP_ERROR(hipMemcpy(hiluk_row_ptr.data(),
+                                  diluk_ptr,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+
+        unit_check_general(1, 1, 1, &hiluk_nnz_gold, &hiluk_nnz);
+        unit_check_general(1, m + 1, 1, hiluk_row_ptr_gold.data(), hiluk_row_ptr.data());
+
+        // Numerical factorization
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk(handle,
+                                                m,
+                                                nnz,
+                                                descr,
+                                                dval,
+                                                dptr,
+                                                dcol,
+                                                info,
+                                                diluk_val,
+                                                diluk_ptr,
+                                                diluk_col,
+                                                rocsparse_solve_policy_auto,
+                                                dbuffer));
+
+        // Pointer mode host
+        rocsparse_int    hposition_1;
+        rocsparse_status pivot_status_1;
+        pivot_status_1 = rocsparse_csriluk_zero_pivot(handle, info, &hposition_1);
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        rocsparse_status pivot_status_2;
+        pivot_status_2 = rocsparse_csriluk_zero_pivot(handle, info, d_position);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Copy output from device to CPU
+        rocsparse_int              hposition_2;
+        std::vector<rocsparse_int> hiluk_col_ind(hiluk_nnz);
+        std::vector<T>             hiluk_val(hiluk_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hiluk_col_ind.data(),
+                                  diluk_col,
+                                  sizeof(rocsparse_int) * hiluk_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hiluk_val.data(), diluk_val, sizeof(T) * hiluk_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hposition_2, d_position, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        unit_check_general(1, hiluk_nnz, 1, hiluk_col_ind_gold.data(), hiluk_col_ind.data());
+
+        // Host reference: scatter the input matrix into the factorization pattern
+        // and factorize it without further fill-ins
+        std::vector<T> hiluk_val_gold(hiluk_nnz, static_cast<T>(0));
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rocsparse_int j = hiluk_row_ptr_gold[i] - idx_base;
+
+            for(rocsparse_int k = hcsr_row_ptr[i] - idx_base; k < hcsr_row_ptr[i + 1] - idx_base;
+                ++k)
+            {
+                while(hiluk_col_ind_gold[j] < hcsr_col_ind[k])
+                {
+                    ++j;
+                }
+
+                hiluk_val_gold[j] = hcsr_val[k];
+            }
+        }
+
+        rocsparse_int position_gold = csrilu0(
+            m, hiluk_row_ptr_gold.data(), hiluk_col_ind_gold.data(), hiluk_val_gold.data(), idx_base);
+
+        unit_check_general(1, 1, 1, &position_gold, &hposition_1);
+        unit_check_general(1, 1, 1, &position_gold, &hposition_2);
+
+        if(hposition_1 != -1)
+        {
+            verify_rocsparse_status_zero_pivot(pivot_status_1,
+                                               "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        if(hposition_2 != -1)
+        {
+            verify_rocsparse_status_zero_pivot(pivot_status_2,
+                                               "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        unit_check_near(1, hiluk_nnz, 1, hiluk_val_gold.data(), hiluk_val.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csriluk(handle,
+                              m,
+                              nnz,
+                              descr,
+                              dval,
+                              dptr,
+                              dcol,
+                              info,
+                              diluk_val,
+                              diluk_ptr,
+                              diluk_col,
+                              rocsparse_solve_policy_auto,
+                              dbuffer);
+        }
+
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            timer.start(stream);
+
+            rocsparse_csriluk(handle,
+                              m,
+                              nnz,
+                              descr,
+                              dval,
+                              dptr,
+                              dcol,
+                              info,
+                              diluk_val,
+                              diluk_ptr,
+                              diluk_col,
+                              rocsparse_solve_policy_auto,
+                              dbuffer);
+
+            timer.stop(stream);
+        }
+
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("csriluk", times);
+        bench_collect("csriluk_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
+
+        // Bandwidth
+        size_t int_data  = (m + 1 + nnz + m + 1 + hiluk_nnz) * sizeof(rocsparse_int);
+        size_t flt_data  = (nnz + 2 * hiluk_nnz) * sizeof(T);
+        double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+        bench_set_bandwidth("csriluk", bandwidth);
+
+        printf("m\t\tnnz\t\tlevel\tnnz_iluk\tGB/s\tmsec\n");
+        printf("%8d\t%9d\t%5d\t%9d\t%0.2lf\t%0.2lf\n",
+               m,
+               nnz,
+               level,
+               hiluk_nnz,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_clear(handle, info));
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRILUK_HPP
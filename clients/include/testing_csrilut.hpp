@@ -0,0 +1,673 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRILUT_HPP
+#define TESTING_CSRILUT_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <rocsparse.h>
+#include <string>
+#include <vector>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+/* ============================================================================================ */
+/*! \brief  Host incomplete LU factorization with threshold based dropping. Mirrors the
+ *  row-wise elimination of the library, keeping the diagonal and at most max_fill entries
+ *  in the strict lower and strict upper part of each row. Returns false on zero pivot.
+ */
+template <typename T>
+static bool host_csrilut(rocsparse_int               m,
+                         const rocsparse_int*        ptr,
+                         const rocsparse_int*        col,
+                         const T*                    val,
+                         T                           tol,
+                         rocsparse_int               max_fill,
+                         rocsparse_index_base        idx_base,
+                         std::vector<rocsparse_int>& ilut_row_ptr,
+                         std::vector<rocsparse_int>& ilut_col_ind,
+                         std::vector<T>&             ilut_val)
+{
+    std::vector<std::vector<std::pair<rocsparse_int, T>>> lpart(m);
+    std::vector<std::vector<std::pair<rocsparse_int, T>>> upart(m);
+    std::vector<T>                                        diag(m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // Working row, mapping column index to value
+        std::map<rocsparse_int, T> w;
+
+        rocsparse_int row_begin = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        double row_norm = 0.0;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            w[col[j] - idx_base] = val[j];
+            row_norm += val[j] * val[j];
+        }
+
+        // Relative drop threshold of the current row
+        T threshold = tol * static_cast<T>(std::sqrt(row_norm));
+
+        // Eliminate dependency rows in ascending order
+        for(auto it = w.begin(); it != w.end() && it->first < i; ++it)
+        {
+            rocsparse_int k = it->first;
+
+            T w_k = it->second / diag[k];
+
+            if(std::abs(w_k) < threshold)
+            {
+                it->second = static_cast<T>(0);
+                continue;
+            }
+
+            it->second = w_k;
+
+            for(auto& u : upart[k])
+            {
+                w[u.first] -= w_k * u.second;
+            }
+        }
+
+        // Split the working row into lower part, diagonal and upper part
+        std::vector<std::pair<rocsparse_int, T>>& lrow = lpart[i];
+        std::vector<std::pair<rocsparse_int, T>>& urow = upart[i];
+
+        T    diag_val = static_cast<T>(0);
+        bool has_diag = false;
+
+        for(auto& entry : w)
+        {
+            if(entry.first == i)
+            {
+                diag_val = entry.second;
+                has_diag = true;
+            }
+            else if(std::abs(entry.second) >= threshold && entry.second != static_cast<T>(0))
+            {
+                if(entry.first < i)
+                {
+                    lrow.push_back(entry);
+                }
+                else
+                {
+                    urow.push_back(entry);
+                }
+            }
+        }
+
+        // Structural or numerical zero pivot
+        if(!has_diag || diag_val == static_cast<T>(0))
+        {
+            return false;
+        }
+
+        diag[i] = diag_val;
+
+        // Keep only the max_fill largest entries in each part, by magnitude
+        auto larger = [](const std::pair<rocsparse_int, T>& lhs,
+                         const std::pair<rocsparse_int, T>& rhs) {
+            return std::abs(lhs.second) > std::abs(rhs.second);
+        };
+        auto by_col = [](const std::pair<rocsparse_int, T>& lhs,
+                         const std::pair<rocsparse_int, T>& rhs) {
+            return lhs.first < rhs.first;
+        };
+
+        if(static_cast<rocsparse_int>(lrow.size()) > max_fill)
+        {
+            std::partial_sort(lrow.begin(), lrow.begin() + max_fill, lrow.end(), larger);
+            lrow.resize(max_fill);
+            std::sort(lrow.begin(), lrow.end(), by_col);
+        }
+
+        if(static_cast<rocsparse_int>(urow.size()) > max_fill)
+        {
+            std::partial_sort(urow.begin(), urow.begin() + max_fill, urow.end(), larger);
+            urow.resize(max_fill);
+            std::sort(urow.begin(), urow.end(), by_col);
+        }
+    }
+
+    // Assemble the factorization in CSR format
+    ilut_row_ptr.resize(m + 1);
+    ilut_col_ind.clear();
+    ilut_val.clear();
+
+    ilut_row_ptr[0] = idx_base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(auto& entry : lpart[i])
+        {
+            ilut_col_ind.push_back(entry.first + idx_base);
+            ilut_val.push_back(entry.second);
+        }
+
+        ilut_col_ind.push_back(i + idx_base);
+        ilut_val.push_back(diag[i]);
+
+        for(auto& entry : upart[i])
+        {
+            ilut_col_ind.push_back(entry.first + idx_base);
+            ilut_val.push_back(entry.second);
+        }
+
+        ilut_row_ptr[i + 1] = static_cast<rocsparse_int>(ilut_col_ind.size()) + idx_base;
+    }
+
+    return true;
+}
+
+template <typename T>
+void testing_csrilut_bad_arg(void)
+{
+    rocsparse_int    m         = 100;
+    rocsparse_int    nnz       = 100;
+    rocsparse_int    max_fill  = 10;
+    rocsparse_int    safe_size = 100;
+    T                tol       = static_cast<T>(0.01);
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dilut_ptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dilut_col_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dilut_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dptr      = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol      = (rocsparse_int*)dcol_managed.get();
+    T*             dval      = (T*)dval_managed.get();
+    rocsparse_int* dilut_ptr = (rocsparse_int*)dilut_ptr_managed.get();
+    rocsparse_int* dilut_col = (rocsparse_int*)dilut_col_managed.get();
+    T*             dilut_val = (T*)dilut_val_managed.get();
+
+    if(!dptr || !dcol || !dval || !dilut_ptr || !dilut_col || !dilut_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csrilut_nnz
+    rocsparse_int ilut_nnz;
+
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval_null, dptr, dcol, &tol, max_fill, info, dilut_ptr, &ilut_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr_null, dcol, &tol, max_fill, info, dilut_ptr, &ilut_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr, dcol_null, &tol, max_fill, info, dilut_ptr, &ilut_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == tol)
+    {
+        T* tol_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr, dcol, tol_null, max_fill, info, dilut_ptr, &ilut_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: tol is nullptr");
+    }
+    // testing for(nullptr == dilut_ptr)
+    {
+        rocsparse_int* dilut_ptr_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr_null, &ilut_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: ilut_row_ptr is nullptr");
+    }
+    // testing for(nullptr == ilut_nnz)
+    {
+        rocsparse_int* ilut_nnz_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr, ilut_nnz_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: ilut_nnz is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr_null, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr, &ilut_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info_null, dilut_ptr, &ilut_nnz);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilut_nnz(
+            handle_null, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr, &ilut_nnz);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrilut
+
+    // testing for(nullptr == dilut_val)
+    {
+        T* dilut_val_null = nullptr;
+
+        status = rocsparse_csrilut(handle, m, descr, info, dilut_val_null, dilut_ptr, dilut_col);
+        verify_rocsparse_status_invalid_pointer(status, "Error: ilut_val is nullptr");
+    }
+    // testing for(nullptr == dilut_ptr)
+    {
+        rocsparse_int* dilut_ptr_null = nullptr;
+
+        status = rocsparse_csrilut(handle, m, descr, info, dilut_val, dilut_ptr_null, dilut_col);
+        verify_rocsparse_status_invalid_pointer(status, "Error: ilut_row_ptr is nullptr");
+    }
+    // testing for(nullptr == dilut_col)
+    {
+        rocsparse_int* dilut_col_null = nullptr;
+
+        status = rocsparse_csrilut(handle, m, descr, info, dilut_val, dilut_ptr, dilut_col_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: ilut_col_ind is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrilut(handle, m, descr_null, info, dilut_val, dilut_ptr, dilut_col);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilut(handle, m, descr, info_null, dilut_val, dilut_ptr, dilut_col);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilut(handle_null, m, descr, info, dilut_val, dilut_ptr, dilut_col);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_csrilut_clear
+
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_csrilut_clear(handle, info_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrilut_clear(handle_null, info);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrilut(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        m         = argus.M;
+    rocsparse_int        max_fill  = argus.K; // fill limit per triangular part
+    T                    tol       = static_cast<T>(argus.alpha); // drop tolerance
+    rocsparse_index_base idx_base  = argus.idx_base;
+    std::string          binfile   = "";
+    std::string          filename  = "";
+    rocsparse_status     status;
+
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m       = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info               info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0 || max_fill < 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dilut_ptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+
+        rocsparse_int* dptr      = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol      = (rocsparse_int*)dcol_managed.get();
+        T*             dval      = (T*)dval_managed.get();
+        rocsparse_int* dilut_ptr = (rocsparse_int*)dilut_ptr_managed.get();
+
+        if(!dptr || !dcol || !dval || !dilut_ptr)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dilut_ptr");
+            return rocsparse_status_memory_error;
+        }
+
+        // Test rocsparse_csrilut_nnz
+        rocsparse_int ilut_nnz;
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr, &ilut_nnz);
+
+        if(m < 0 || nnz < 0 || max_fill < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0 || max_fill < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0 && max_fill >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(binfile != "")
+    {
+        if(read_bin_matrix(
+               binfile.c_str(), m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base)
+           != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+    else if(argus.laplacian)
+    {
+        m   = gen_laplacian(argus, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        nnz = hcsr_row_ptr[m];
+    }
+    else
+    {
+        std::vector<rocsparse_int> hcoo_row_ind;
+
+        if(filename != "")
+        {
+            if(read_mtx_matrix(
+                   filename.c_str(), m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base)
+               != 0)
+            {
+                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+                return rocsparse_status_internal_error;
+            }
+        }
+        else
+        {
+            gen_matrix_coo(m, m, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+        }
+
+        // Convert COO to CSR
+        hcsr_row_ptr.resize(m + 1, 0);
+        for(rocsparse_int i = 0; i < nnz; ++i)
+        {
+            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        }
+
+        hcsr_row_ptr[0] = idx_base;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+        }
+    }
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dilut_ptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+
+    rocsparse_int* dptr      = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol      = (rocsparse_int*)dcol_managed.get();
+    T*             dval      = (T*)dval_managed.get();
+    rocsparse_int* dilut_ptr = (rocsparse_int*)dilut_ptr_managed.get();
+
+    if(!dptr || !dcol || !dval || !dilut_ptr)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval || !dilut_ptr");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // Host reference factorization
+        std::vector<rocsparse_int> hilut_row_ptr_gold;
+        std::vector<rocsparse_int> hilut_col_ind_gold;
+        std::vector<T>             hilut_val_gold;
+
+        bool pivot_free = host_csrilut(m,
+                                       hcsr_row_ptr.data(),
+                                       hcsr_col_ind.data(),
+                                       hcsr_val.data(),
+                                       tol,
+                                       max_fill,
+                                       idx_base,
+                                       hilut_row_ptr_gold,
+                                       hilut_col_ind_gold,
+                                       hilut_val_gold);
+
+        rocsparse_int hilut_nnz;
+        status = rocsparse_csrilut_nnz(
+            handle, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr, &hilut_nnz);
+
+        if(!pivot_free)
+        {
+            verify_rocsparse_status_zero_pivot(status, "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        verify_rocsparse_status_success(status, "rocsparse_csrilut_nnz");
+
+        rocsparse_int hilut_nnz_gold = static_cast<rocsparse_int>(hilut_col_ind_gold.size());
+
+        // Check the factorization pattern
+        std::vector<rocsparse_int> hilut_row_ptr(m + 1);
+        CHECK_HIP_ERROR(hipMemcpy(hilut_row_ptr.data(),
+                                  dilut_ptr,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+
+        unit_check_general(1, 1, 1, &hilut_nnz_gold, &hilut_nnz);
+        unit_check_general(1, m + 1, 1, hilut_row_ptr_gold.data(), hilut_row_ptr.data());
+
+        // Obtain the factorization
+        auto dilut_col_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * hilut_nnz), device_free};
+        auto dilut_val_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(T) * hilut_nnz), device_free};
+
+        rocsparse_int* dilut_col = (rocsparse_int*)dilut_col_managed.get();
+        T*             dilut_val = (T*)dilut_val_managed.get();
+
+        if(!dilut_col || !dilut_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dilut_col || !dilut_val");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrilut(handle, m, descr, info, dilut_val, dilut_ptr, dilut_col));
+
+        // Copy output from device to CPU
+        std::vector<rocsparse_int> hilut_col_ind(hilut_nnz);
+        std::vector<T>             hilut_val(hilut_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hilut_col_ind.data(),
+                                  dilut_col,
+                                  sizeof(rocsparse_int) * hilut_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hilut_val.data(), dilut_val, sizeof(T) * hilut_nnz, hipMemcpyDeviceToHost));
+
+        unit_check_general(1, hilut_nnz, 1, hilut_col_ind_gold.data(), hilut_col_ind.data());
+        unit_check_near(1, hilut_nnz, 1, hilut_val_gold.data(), hilut_val.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+
+        rocsparse_int hilut_nnz;
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrilut_nnz(
+                handle, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr, &hilut_nnz);
+        }
+
+        // The factorization runs on the host, measure wall clock time per call
+        std::vector<double> times(number_hot_calls);
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            double time = get_time_us();
+
+            rocsparse_csrilut_nnz(
+                handle, m, nnz, descr, dval, dptr, dcol, &tol, max_fill, info, dilut_ptr, &hilut_nnz);
+
+            times[iter] = get_time_us() - time;
+        }
+
+        bench_collect("csrilut", times);
+
+        // Median in miliseconds per call
+        double time_used = bench_compute_stats(times).median / 1e3;
+
+        // Bandwidth
+        size_t int_data  = (m + 1 + nnz + m + 1 + hilut_nnz) * sizeof(rocsparse_int);
+        size_t flt_data  = (nnz + hilut_nnz) * sizeof(T);
+        double bandwidth = (int_data + flt_data) / time_used / 1e6;
+        bench_set_bandwidth("csrilut", bandwidth);
+
+        printf("m\t\tnnz\t\ttol\tmax_fill\tnnz_ilut\tGB/s\tmsec\n");
+        printf("%8d\t%9d\t%0.1e\t%8d\t%9d\t%0.2lf\t%0.2lf\n",
+               m,
+               nnz,
+               static_cast<double>(tol),
+               max_fill,
+               hilut_nnz,
+               bandwidth,
+               time_used);
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilut_clear(handle, info));
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRILUT_HPP
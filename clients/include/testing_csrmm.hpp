@@ -29,6 +29,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
+#include "utility_device.hpp"
 
 #include <rocsparse.h>
 #include <string>
@@ -414,7 +415,7 @@ rocsparse_status testing_csrmm(Arguments argus)
     else if(argus.laplacian)
     {
         M = K
-            = gen_2d_laplacian(argus.laplacian, hcsr_row_ptrA, hcsr_col_indA, hcsr_valA, idx_base);
+            = gen_laplacian(argus, hcsr_row_ptrA, hcsr_col_indA, hcsr_valA, idx_base);
         nnz = hcsr_row_ptrA[M];
     }
     else
@@ -570,13 +571,13 @@ rocsparse_status testing_csrmm(Arguments argus)
                                               dC_2,
                                               ldc));
 
-        // copy output from device to CPU
-        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC_1, sizeof(T) * Cnnz, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC_2, sizeof(T) * Cnnz, hipMemcpyDeviceToHost));
-
         // CPU
         double cpu_time_used = get_time_us();
 
+        // Rows of C are independent
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
         for(rocsparse_int i = 0; i < Cnrow; ++i)
         {
             for(rocsparse_int j = 0; j < Cncol; ++j)
@@ -600,13 +601,21 @@ rocsparse_status testing_csrmm(Arguments argus)
 
         cpu_time_used = get_time_us() - cpu_time_used;
 
-        unit_check_near(Cnrow, Cncol, ldc, hC_gold.data(), hC_1.data());
-        unit_check_near(Cnrow, Cncol, ldc, hC_gold.data(), hC_2.data());
+        // Upload the host reference once and compare on the device, so that only a
+        // single scalar comes back instead of the full C matrices
+        auto dC_gold_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * Cnnz), device_free};
+        T*   dC_gold         = (T*)dC_gold_managed.get();
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dC_gold, hC_gold.data(), sizeof(T) * Cnnz, hipMemcpyHostToDevice));
+
+        unit_check_near_device(Cnnz, dC_gold, dC_1);
+        unit_check_near_device(Cnnz, dC_gold, dC_2);
     }
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
@@ -631,10 +640,17 @@ rocsparse_status testing_csrmm(Arguments argus)
                             ldc);
         }
 
-        double gpu_time_used = get_time_us(); // in microseconds
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
+            timer.start(stream);
+
             rocsparse_csrmm(handle,
                             transA,
                             transB,
@@ -652,10 +668,21 @@ rocsparse_status testing_csrmm(Arguments argus)
                             &h_beta,
                             dC_1,
                             ldc);
+
+            timer.stop(stream);
         }
 
-        // Convert to miliseconds per call
-        gpu_time_used     = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("csrmm", times);
+        bench_collect("csrmm_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
         size_t flops      = 3.0 * nnz * Bncol;
         flops             = (h_beta != 0.0) ? flops + Cnnz : flops;
         double gpu_gflops = flops / gpu_time_used / 1e6;
@@ -663,6 +690,7 @@ rocsparse_status testing_csrmm(Arguments argus)
         memtrans          = (h_beta != 0.0) ? memtrans + Cnnz : memtrans;
         double bandwidth
             = (memtrans * sizeof(T) + (M + 1 + nnz) * sizeof(rocsparse_int)) / gpu_time_used / 1e6;
+        bench_set_bandwidth("csrmm", bandwidth);
 
         printf("m\t\tn\t\tk\t\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
         printf("%8d\t%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
@@ -29,6 +29,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "unit.hpp"
 #include "utility.hpp"
+#include "utility_device.hpp"
 
 #include <cmath>
 #include <rocsparse.h>
@@ -467,9 +468,23 @@ rocsparse_status testing_csrmv(Arguments argus)
     std::vector<rocsparse_int> hcol_ind;
     std::vector<T>             hval;
 
+    // When only timing is requested and the matrix is generated rather than read from a
+    // file, materialize it directly in device memory and skip the host pass and upload.
+    // Only the 5-point laplacian stencil has a device generator
+    bool dev_gen = argus.timing && !argus.unit_check && binfile == "" && filename == ""
+                   && rocalution == "" && (argus.laplacian == 0 || argus.stencil == 5);
+
     // Initial Data on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(dev_gen)
+    {
+        if(argus.laplacian)
+        {
+            m = n = argus.laplacian * argus.laplacian;
+            nnz   = gen_2d_laplacian_nnz(argus.laplacian);
+        }
+    }
+    else if(binfile != "")
     {
         if(read_bin_matrix(binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
         {
@@ -489,7 +504,7 @@ rocsparse_status testing_csrmv(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcol_ind, hval, idx_base);
         nnz   = hcsr_row_ptr[m];
     }
     else
@@ -525,17 +540,23 @@ rocsparse_status testing_csrmv(Arguments argus)
         }
     }
 
-    std::vector<T> hx(n);
-    std::vector<T> hy_1(m);
-    std::vector<T> hy_2(m);
-    std::vector<T> hy_gold(m);
+    std::vector<T> hx;
+    std::vector<T> hy_1;
+    std::vector<T> hy_2;
+    std::vector<T> hy_gold;
+
+    if(!dev_gen)
+    {
+        hx.resize(n);
+        hy_1.resize(m);
 
-    rocsparse_init<T>(hx, 1, n);
-    rocsparse_init<T>(hy_1, 1, m);
+        rocsparse_init<T>(hx, 1, n);
+        rocsparse_init<T>(hy_1, 1, m);
 
-    // copy vector is easy in STL; hy_gold = hx: save a copy in hy_gold which will be output of CPU
-    hy_2    = hy_1;
-    hy_gold = hy_1;
+        // copy vector is easy in STL; hy_gold = hx: save a copy in hy_gold which will be output of CPU
+        hy_2    = hy_1;
+        hy_gold = hy_1;
+    }
 
     // allocate memory on device
     auto dptr_managed
@@ -566,14 +587,33 @@ rocsparse_status testing_csrmv(Arguments argus)
         return rocsparse_status_memory_error;
     }
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(hipMemcpy(
-        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(
-        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    if(dev_gen)
+    {
+        // Generate matrix and vectors directly in device memory
+        if(argus.laplacian)
+        {
+            gen_2d_laplacian_device(argus.laplacian, dptr, dcol, dval, idx_base);
+        }
+        else
+        {
+            rocsparse_init_csr_device(dptr, dcol, dval, m, n, nnz, idx_base, 12345ULL);
+        }
+
+        rocsparse_init_device(dx, n, 54321ULL);
+        rocsparse_init_device(dy_1, m, 67890ULL);
+    }
+    else
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(
+            dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    }
+
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -608,6 +648,10 @@ rocsparse_status testing_csrmv(Arguments argus)
         // Different csrmv algorithms require different CPU summation
         if(adaptive)
         {
+            // Rows are independent
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
             for(rocsparse_int i = 0; i < m; ++i)
             {
                 hy_gold[i] *= h_beta;
@@ -666,6 +710,10 @@ rocsparse_status testing_csrmv(Arguments argus)
                 return rocsparse_status_internal_error;
             }
 
+            // Rows are independent
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
             for(rocsparse_int i = 0; i < m; ++i)
             {
                 std::vector<T> sum(WF_SIZE, 0.0);
@@ -719,10 +767,13 @@ rocsparse_status testing_csrmv(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
+        device_mem_sampler mem_sampler;
+        mem_sampler.start();
+
         for(int iter = 0; iter < number_cold_calls; iter++)
         {
             rocsparse_csrmv(handle,
@@ -741,10 +792,17 @@ rocsparse_status testing_csrmv(Arguments argus)
                             dy_1);
         }
 
-        double gpu_time_used = get_time_us(); // in microseconds
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
+            timer.start(stream);
+
             rocsparse_csrmv(handle,
                             transA,
                             m,
@@ -759,10 +817,32 @@ rocsparse_status testing_csrmv(Arguments argus)
                             dx,
                             &h_beta,
                             dy_1);
+
+            timer.stop(stream);
         }
 
-        // Convert to miliseconds per call
-        gpu_time_used     = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("csrmv", times);
+        bench_collect("csrmv_e2e", std::vector<double>(1, e2e_time));
+
+        // Peak device memory footprint, combining the sampled free memory
+        // drop with the exact accounting of the handle internal temporaries
+        size_t peak_mem = mem_sampler.stop();
+
+        size_t lib_in_use;
+        size_t lib_peak;
+        size_t lib_buffer_size;
+        rocsparse_memory_snapshot(handle, &lib_in_use, &lib_peak, &lib_buffer_size);
+
+        bench_set_peak_memory("csrmv", std::max(peak_mem, lib_peak));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
         size_t flops      = (h_alpha != 1.0) ? 3.0 * nnz : 2.0 * nnz;
         flops             = (h_beta != 0.0) ? flops + m : flops;
         double gpu_gflops = flops / gpu_time_used / 1e6;
@@ -770,6 +850,7 @@ rocsparse_status testing_csrmv(Arguments argus)
         memtrans          = (h_beta != 0.0) ? memtrans + m : memtrans;
         double bandwidth
             = (memtrans * sizeof(T) + (m + 1 + nnz) * sizeof(rocsparse_int)) / gpu_time_used / 1e6;
+        bench_set_bandwidth("csrmv", bandwidth);
 
         printf("m\t\tn\t\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
         printf("%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
@@ -650,7 +650,7 @@ rocsparse_status testing_csrsv(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
         nnz   = hcsr_row_ptr[m];
     }
     else
@@ -873,7 +873,7 @@ rocsparse_status testing_csrsv(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
@@ -895,10 +895,17 @@ rocsparse_status testing_csrsv(Arguments argus)
                                   dbuffer);
         }
 
-        double gpu_time_used = get_time_us(); // in microseconds
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
+            timer.start(stream);
+
             rocsparse_csrsv_solve(handle,
                                   trans,
                                   m,
@@ -913,10 +920,21 @@ rocsparse_status testing_csrsv(Arguments argus)
                                   dy_1,
                                   rocsparse_solve_policy_auto,
                                   dbuffer);
+
+            timer.stop(stream);
         }
 
-        // Convert to miliseconds per call
-        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("csrsv", times);
+        bench_collect("csrsv_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
 
         // GFlops
         size_t flops = 2 * nnz;
@@ -937,6 +955,7 @@ rocsparse_status testing_csrsv(Arguments argus)
         size_t int_data  = (m + 1 + nnz) * sizeof(rocsparse_int);
         size_t flt_data  = (nnz + m + m) * sizeof(T);
         double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+        bench_set_bandwidth("csrsv", bandwidth);
 
         printf("m\t\tnnz\t\talpha\tGFlops\tGB/s\tmsec\n");
         printf("%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
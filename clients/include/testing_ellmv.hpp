@@ -240,7 +240,7 @@ rocsparse_status testing_ellmv(Arguments argus)
     }
     else if(argus.laplacian)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
+        m = n = gen_laplacian(argus, hcsr_row_ptr, hcol_ind, hval, idx_base);
         nnz   = hcsr_row_ptr[m];
     }
     else
@@ -414,7 +414,7 @@ rocsparse_status testing_ellmv(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
@@ -424,16 +424,34 @@ rocsparse_status testing_ellmv(Arguments argus)
                 handle, transA, m, n, &h_alpha, descr, dval, dcol, ell_width, dx, &h_beta, dy_1);
         }
 
-        double gpu_time_used = get_time_us(); // in microseconds
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
 
         for(int iter = 0; iter < number_hot_calls; iter++)
         {
+            timer.start(stream);
+
             rocsparse_ellmv(
                 handle, transA, m, n, &h_alpha, descr, dval, dcol, ell_width, dx, &h_beta, dy_1);
+
+            timer.stop(stream);
         }
 
-        // Convert to miliseconds per call
-        gpu_time_used     = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("ellmv", times);
+        bench_collect("ellmv_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
         size_t flops      = (h_alpha != 1.0) ? 3.0 * nnz : 2.0 * nnz;
         flops             = (h_beta != 0.0) ? flops + m : flops;
         double gpu_gflops = flops / gpu_time_used / 1e6;
@@ -441,6 +459,7 @@ rocsparse_status testing_ellmv(Arguments argus)
         memtrans += sizeof(rocsparse_int) * ell_nnz;
         memtrans         = (h_beta != 0.0) ? memtrans + sizeof(T) * m : memtrans;
         double bandwidth = memtrans / gpu_time_used / 1e6;
+        bench_set_bandwidth("ellmv", bandwidth);
 
         printf("m\t\tn\t\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
         printf("%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
@@ -0,0 +1,626 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_GEMMI_HPP
+#define TESTING_GEMMI_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_gemmi_bad_arg(void)
+{
+    rocsparse_int       m         = 100;
+    rocsparse_int       n         = 100;
+    rocsparse_int       k         = 100;
+    rocsparse_int       nnz       = 100;
+    rocsparse_int       lda       = 100;
+    rocsparse_int       ldc       = 100;
+    rocsparse_int       safe_size = 100;
+    T                   h_alpha   = 0.6;
+    T                   h_beta    = 0.2;
+    rocsparse_operation trans_A   = rocsparse_operation_none;
+    rocsparse_operation trans_B   = rocsparse_operation_transpose;
+    rocsparse_status    status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dA_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dC_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T*             dval = (T*)dval_managed.get();
+    T*             dA   = (T*)dA_managed.get();
+    T*             dC   = (T*)dC_managed.get();
+
+    if(!dval || !dptr || !dcol || !dA || !dC)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dA)
+    {
+        T* dA_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA_null,
+                                 lda,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dA is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 descr,
+                                 dval_null,
+                                 dptr,
+                                 dcol,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 descr,
+                                 dval,
+                                 dptr_null,
+                                 dcol,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol_null,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 d_alpha_null,
+                                 dA,
+                                 lda,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 d_beta_null,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == dC)
+    {
+        T* dC_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 &h_beta,
+                                 dC_null,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dC is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 descr_null,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_gemmi(handle_null,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_gemmi(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        m         = argus.M;
+    rocsparse_int        n         = argus.N;
+    rocsparse_int        k         = argus.K;
+    T                    h_alpha   = argus.alpha;
+    T                    h_beta    = argus.beta;
+    rocsparse_operation  trans_A   = rocsparse_operation_none;
+    rocsparse_operation  trans_B   = rocsparse_operation_transpose;
+    rocsparse_index_base idx_base  = argus.idx_base;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements of sparse matrix B
+    double scale = 0.02;
+    if(n > 1000 || k > 1000)
+    {
+        scale = 2.0 / std::max(n, k);
+    }
+    rocsparse_int nnz = n * scale * k;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || k <= 0 || nnz <= 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dA_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dC_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T*             dval = (T*)dval_managed.get();
+        T*             dA   = (T*)dA_managed.get();
+        T*             dC   = (T*)dC_managed.get();
+
+        if(!dval || !dptr || !dcol || !dA || !dC)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dA || !dC");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_gemmi(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 safe_size,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol,
+                                 &h_beta,
+                                 dC,
+                                 safe_size);
+
+        if(m < 0 || n < 0 || k < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || k < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && k >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Initialize random seed
+    srand(12345ULL);
+
+    // Host structures - sparse matrix B in CSR format, n rows and k columns
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    gen_matrix_coo(n, k, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+
+    // Convert COO to CSR
+    std::vector<rocsparse_int> hcsr_row_ptr(n + 1, 0);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+    }
+
+    hcsr_row_ptr[0] = idx_base;
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+    }
+
+    // Dense matrices, stored column major
+    rocsparse_int lda = m;
+    rocsparse_int ldc = m;
+
+    std::vector<T> hA(lda * k);
+    std::vector<T> hC_1(ldc * n);
+    std::vector<T> hC_2(ldc * n);
+    std::vector<T> hC_gold(ldc * n);
+
+    rocsparse_init<T>(hA, lda, k);
+    rocsparse_init<T>(hC_1, ldc, n);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (n + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dA_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * lda * k), device_free};
+    auto dC_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldc * n), device_free};
+    auto dC_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldc * n), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval    = (T*)dval_managed.get();
+    T*             dA      = (T*)dA_managed.get();
+    T*             dC_1    = (T*)dC_1_managed.get();
+    T*             dC_2    = (T*)dC_2_managed.get();
+    T*             d_alpha = (T*)d_alpha_managed.get();
+    T*             d_beta  = (T*)d_beta_managed.get();
+
+    if(!dptr || !dcol || !dval || !dA || !dC_1 || !dC_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval || !dA || "
+                                        "!dC_1 || !dC_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * lda * k, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1.data(), sizeof(T) * ldc * n, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2.data(), sizeof(T) * ldc * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_gemmi(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              nnz,
+                                              &h_alpha,
+                                              dA,
+                                              lda,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              &h_beta,
+                                              dC_1,
+                                              ldc));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_gemmi(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              nnz,
+                                              d_alpha,
+                                              dA,
+                                              lda,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              d_beta,
+                                              dC_2,
+                                              ldc));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC_1, sizeof(T) * ldc * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC_2, sizeof(T) * ldc * n, hipMemcpyDeviceToHost));
+
+        // Host gemmi, C := alpha * A * B^T + beta * C with B in CSR format
+        for(rocsparse_int j = 0; j < n; ++j)
+        {
+            rocsparse_int row_begin = hcsr_row_ptr[j] - idx_base;
+            rocsparse_int row_end   = hcsr_row_ptr[j + 1] - idx_base;
+
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                T sum = static_cast<T>(0);
+
+                for(rocsparse_int l = row_begin; l < row_end; ++l)
+                {
+                    rocsparse_int col = hcsr_col_ind[l] - idx_base;
+
+                    sum = std::fma(hA[col * lda + i], hcsr_val[l], sum);
+                }
+
+                hC_gold[j * ldc + i] = std::fma(h_alpha, sum, h_beta * hC_gold[j * ldc + i]);
+            }
+        }
+
+        unit_check_near(m, n, ldc, hC_gold.data(), hC_1.data());
+        unit_check_near(m, n, ldc, hC_gold.data(), hC_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_gemmi(handle,
+                            trans_A,
+                            trans_B,
+                            m,
+                            n,
+                            k,
+                            nnz,
+                            &h_alpha,
+                            dA,
+                            lda,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            &h_beta,
+                            dC_1,
+                            ldc);
+        }
+
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            timer.start(stream);
+
+            rocsparse_gemmi(handle,
+                            trans_A,
+                            trans_B,
+                            m,
+                            n,
+                            k,
+                            nnz,
+                            &h_alpha,
+                            dA,
+                            lda,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            &h_beta,
+                            dC_1,
+                            ldc);
+
+            timer.stop(stream);
+        }
+
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("gemmi", times);
+        bench_collect("gemmi_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
+
+        // GFlops
+        size_t flops      = (2 * (size_t)nnz + 3 * (size_t)n) * m;
+        double gpu_gflops = flops / gpu_time_used / 1e6;
+
+        // Bandwidth
+        size_t int_data  = (n + 1 + nnz) * sizeof(rocsparse_int);
+        size_t flt_data  = ((size_t)nnz + (size_t)m * k + 2 * (size_t)m * n) * sizeof(T);
+        double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+        bench_set_bandwidth("gemmi", bandwidth);
+
+        printf("m\t\tn\t\tk\t\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
+        printf("%8d\t%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               k,
+               nnz,
+               h_alpha,
+               h_beta,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_GEMMI_HPP
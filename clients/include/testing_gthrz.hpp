@@ -203,7 +203,7 @@ rocsparse_status testing_gthrz(Arguments argus)
 
     if(argus.timing)
     {
-        int number_cold_calls = 2;
+        int number_cold_calls = argus.warmup;
         int number_hot_calls  = argus.iters;
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
@@ -212,16 +212,36 @@ rocsparse_status testing_gthrz(Arguments argus)
             rocsparse_gthrz(handle, nnz, dy, dx_val, dx_ind, idx_base);
         }
 
-        double gpu_time_used = get_time_us(); // in microseconds
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
 
         for(rocsparse_int iter = 0; iter < number_hot_calls; iter++)
         {
+            timer.start(stream);
+
             rocsparse_gthrz(handle, nnz, dy, dx_val, dx_ind, idx_base);
+
+            timer.stop(stream);
         }
 
-        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("gthrz", times);
+        bench_collect("gthrz_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in microseconds per call
+        double gpu_time_used = bench_compute_stats(times).median;
         double bandwidth
             = (sizeof(rocsparse_int) * nnz + sizeof(T) * 2.0 * nnz) / gpu_time_used / 1e3;
+        bench_set_bandwidth("gthrz", bandwidth);
 
         printf("nnz\t\tGB/s\tusec\n");
         printf("%9d\t%0.2lf\t%0.2lf\n", nnz, bandwidth, gpu_time_used);
@@ -0,0 +1,559 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_S24MM_HPP
+#define TESTING_S24MM_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_s24mm_bad_arg(void)
+{
+    rocsparse_int       m         = 100;
+    rocsparse_int       n         = 100;
+    rocsparse_int       k         = 100;
+    rocsparse_int       ldb       = 100;
+    rocsparse_int       ldc       = 100;
+    rocsparse_int       safe_size = 100;
+    T                   h_alpha   = 0.6;
+    T                   h_beta    = 0.2;
+    rocsparse_operation trans_A   = rocsparse_operation_none;
+    rocsparse_operation trans_B   = rocsparse_operation_none;
+    rocsparse_status    status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dmeta_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(unsigned char) * safe_size), device_free};
+    auto dB_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dC_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    T*             dval  = (T*)dval_managed.get();
+    unsigned char* dmeta = (unsigned char*)dmeta_managed.get();
+    T*             dB    = (T*)dB_managed.get();
+    T*             dC    = (T*)dC_managed.get();
+
+    if(!dval || !dmeta || !dB || !dC)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr,
+                                 dval_null,
+                                 dmeta,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dmeta)
+    {
+        unsigned char* dmeta_null = nullptr;
+
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr,
+                                 dval,
+                                 dmeta_null,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dmeta is nullptr");
+    }
+    // testing for(nullptr == dB)
+    {
+        T* dB_null = nullptr;
+
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr,
+                                 dval,
+                                 dmeta,
+                                 dB_null,
+                                 ldb,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dB is nullptr");
+    }
+    // testing for(nullptr == dC)
+    {
+        T* dC_null = nullptr;
+
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr,
+                                 dval,
+                                 dmeta,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC_null,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dC is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 d_alpha_null,
+                                 descr,
+                                 dval,
+                                 dmeta,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr,
+                                 dval,
+                                 dmeta,
+                                 dB,
+                                 ldb,
+                                 d_beta_null,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr_null,
+                                 dval,
+                                 dmeta,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_s24mm(handle_null,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr,
+                                 dval,
+                                 dmeta,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 dC,
+                                 ldc);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_s24mm(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        m         = argus.M;
+    rocsparse_int        n         = argus.N;
+    rocsparse_int        k         = argus.K;
+    T                    h_alpha   = argus.alpha;
+    T                    h_beta    = argus.beta;
+    rocsparse_operation  trans_A   = rocsparse_operation_none;
+    rocsparse_operation  trans_B   = rocsparse_operation_none;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    // Argument sanity check before allocating invalid memory. The column
+    // dimension has to be a multiple of the 2:4 group size
+    if(m <= 0 || n <= 0 || k <= 0 || (k % 4) != 0)
+    {
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dmeta_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(unsigned char) * safe_size), device_free};
+        auto dB_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dC_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        T*             dval  = (T*)dval_managed.get();
+        unsigned char* dmeta = (unsigned char*)dmeta_managed.get();
+        T*             dB    = (T*)dB_managed.get();
+        T*             dC    = (T*)dC_managed.get();
+
+        if(!dval || !dmeta || !dB || !dC)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dval || !dmeta || !dB || !dC");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_s24mm(handle,
+                                 trans_A,
+                                 trans_B,
+                                 m,
+                                 n,
+                                 k,
+                                 &h_alpha,
+                                 descr,
+                                 dval,
+                                 dmeta,
+                                 dB,
+                                 safe_size,
+                                 &h_beta,
+                                 dC,
+                                 safe_size);
+
+        if(m < 0 || n < 0 || k < 0 || (k % 4) != 0)
+        {
+            verify_rocsparse_status_invalid_size(status,
+                                                 "Error: m < 0 || n < 0 || k < 0 || k % 4 != 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && k % 4 == 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Initialize random seed
+    srand(12345ULL);
+
+    rocsparse_int ngroups = k / 4;
+    rocsparse_int lda     = m;
+    rocsparse_int ldb     = k;
+    rocsparse_int ldc     = m;
+
+    // Host structures. A is stored compressed with two values per group of
+    // four columns, the metadata holds the two column offsets of each group
+    std::vector<T>             hs24_val(m * (k / 2));
+    std::vector<unsigned char> hs24_meta(m * ngroups);
+    std::vector<T>             hA(lda * k, static_cast<T>(0));
+
+    // The six possible 2:4 patterns of a group
+    static const unsigned char patterns[6] = {0x4, 0x8, 0xc, 0x9, 0xd, 0xe};
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int g = 0; g < ngroups; ++g)
+        {
+            unsigned char meta = patterns[rand() % 6];
+            rocsparse_int c0   = meta & 0x3;
+            rocsparse_int c1   = (meta >> 2) & 0x3;
+
+            T v0 = random_generator<T>();
+            T v1 = random_generator<T>();
+
+            hs24_meta[g * m + i]           = meta;
+            hs24_val[(2 * g + 0) * m + i]  = v0;
+            hs24_val[(2 * g + 1) * m + i]  = v1;
+
+            // Scatter into the dense reference matrix
+            hA[(4 * g + c0) * lda + i] = v0;
+            hA[(4 * g + c1) * lda + i] = v1;
+        }
+    }
+
+    std::vector<T> hB(ldb * n);
+    std::vector<T> hC_1(ldc * n);
+    std::vector<T> hC_2(ldc * n);
+    std::vector<T> hC_gold(ldc * n);
+
+    rocsparse_init<T>(hB, ldb, n);
+    rocsparse_init<T>(hC_1, ldc, n);
+
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // Allocate memory on device
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m * (k / 2)), device_free};
+    auto dmeta_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(unsigned char) * m * ngroups), device_free};
+    auto dB_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldb * n), device_free};
+    auto dC_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldc * n), device_free};
+    auto dC_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldc * n), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    T*             dval    = (T*)dval_managed.get();
+    unsigned char* dmeta   = (unsigned char*)dmeta_managed.get();
+    T*             dB      = (T*)dB_managed.get();
+    T*             dC_1    = (T*)dC_1_managed.get();
+    T*             dC_2    = (T*)dC_2_managed.get();
+    T*             d_alpha = (T*)d_alpha_managed.get();
+    T*             d_beta  = (T*)d_beta_managed.get();
+
+    if(!dval || !dmeta || !dB || !dC_1 || !dC_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dmeta || !dB || !dC_1 || "
+                                        "!dC_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dval, hs24_val.data(), sizeof(T) * m * (k / 2), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dmeta, hs24_meta.data(), sizeof(unsigned char) * m * ngroups, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * ldb * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1.data(), sizeof(T) * ldc * n, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2.data(), sizeof(T) * ldc * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_s24mm(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              &h_alpha,
+                                              descr,
+                                              dval,
+                                              dmeta,
+                                              dB,
+                                              ldb,
+                                              &h_beta,
+                                              dC_1,
+                                              ldc));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_s24mm(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              d_alpha,
+                                              descr,
+                                              dval,
+                                              dmeta,
+                                              dB,
+                                              ldb,
+                                              d_beta,
+                                              dC_2,
+                                              ldc));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_1.data(), dC_1, sizeof(T) * ldc * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2.data(), dC_2, sizeof(T) * ldc * n, hipMemcpyDeviceToHost));
+
+        // Host gemm on the dense reference matrix
+        for(rocsparse_int j = 0; j < n; ++j)
+        {
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                T sum = static_cast<T>(0);
+
+                for(rocsparse_int l = 0; l < k; ++l)
+                {
+                    sum = std::fma(hA[l * lda + i], hB[j * ldb + l], sum);
+                }
+
+                hC_gold[j * ldc + i] = std::fma(h_alpha, sum, h_beta * hC_gold[j * ldc + i]);
+            }
+        }
+
+        unit_check_near(m, n, ldc, hC_gold.data(), hC_1.data());
+        unit_check_near(m, n, ldc, hC_gold.data(), hC_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_s24mm(handle,
+                            trans_A,
+                            trans_B,
+                            m,
+                            n,
+                            k,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dmeta,
+                            dB,
+                            ldb,
+                            &h_beta,
+                            dC_1,
+                            ldc);
+        }
+
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            timer.start(stream);
+
+            rocsparse_s24mm(handle,
+                            trans_A,
+                            trans_B,
+                            m,
+                            n,
+                            k,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dmeta,
+                            dB,
+                            ldb,
+                            &h_beta,
+                            dC_1,
+                            ldc);
+
+            timer.stop(stream);
+        }
+
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("s24mm", times);
+        bench_collect("s24mm_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
+
+        // GFlops, k / 2 fused multiply-adds plus alpha and beta scaling per entry of C
+        size_t flops      = ((size_t)k + 3) * m * n;
+        double gpu_gflops = flops / gpu_time_used / 1e6;
+
+        // Bandwidth
+        size_t meta_data = (size_t)m * ngroups * sizeof(unsigned char);
+        size_t flt_data  = ((size_t)m * (k / 2) + (size_t)k * n + 2 * (size_t)m * n) * sizeof(T);
+        double bandwidth = (meta_data + flt_data) / gpu_time_used / 1e6;
+        bench_set_bandwidth("s24mm", bandwidth);
+
+        printf("m\t\tn\t\tk\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
+        printf("%8d\t%8d\t%8d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               k,
+               h_alpha,
+               h_beta,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_S24MM_HPP
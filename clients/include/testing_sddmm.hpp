@@ -0,0 +1,596 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SDDMM_HPP
+#define TESTING_SDDMM_HPP
+
+#include "rocsparse.hpp"
+#include "rocsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <rocsparse.h>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_sddmm_bad_arg(void)
+{
+    rocsparse_int    m         = 100;
+    rocsparse_int    n         = 100;
+    rocsparse_int    k         = 100;
+    rocsparse_int    nnz       = 100;
+    rocsparse_int    lda       = 100;
+    rocsparse_int    ldb       = 100;
+    rocsparse_int    safe_size = 100;
+    T                h_alpha   = 0.6;
+    T                h_beta    = 0.2;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle               handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr           descr = unique_ptr_descr->descr;
+
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dA_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dB_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T*             dval = (T*)dval_managed.get();
+    T*             dA   = (T*)dA_managed.get();
+    T*             dB   = (T*)dB_managed.get();
+
+    if(!dval || !dptr || !dcol || !dA || !dB)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dA)
+    {
+        T* dA_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA_null,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dA is nullptr");
+    }
+    // testing for(nullptr == dB)
+    {
+        T* dB_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB_null,
+                                 ldb,
+                                 &h_beta,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dB is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 d_alpha_null,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 d_beta_null,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 descr,
+                                 dval_null,
+                                 dptr,
+                                 dcol);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 descr,
+                                 dval,
+                                 dptr_null,
+                                 dcol);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 descr_null,
+                                 dval,
+                                 dptr,
+                                 dcol);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_sddmm(handle_null,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 lda,
+                                 dB,
+                                 ldb,
+                                 &h_beta,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_sddmm(Arguments argus)
+{
+    rocsparse_int        safe_size = 100;
+    rocsparse_int        m         = argus.M;
+    rocsparse_int        n         = argus.N;
+    rocsparse_int        k         = argus.K;
+    T                    h_alpha   = argus.alpha;
+    T                    h_beta    = argus.beta;
+    rocsparse_index_base idx_base  = argus.idx_base;
+    rocsparse_status     status;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle               handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr           descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements in the sampled matrix
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || k <= 0 || nnz <= 0)
+    {
+        auto dptr_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed
+            = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dA_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dB_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T*             dval = (T*)dval_managed.get();
+        T*             dA   = (T*)dA_managed.get();
+        T*             dB   = (T*)dB_managed.get();
+
+        if(!dval || !dptr || !dcol || !dA || !dB)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dA || !dB");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_sddmm(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 nnz,
+                                 &h_alpha,
+                                 dA,
+                                 safe_size,
+                                 dB,
+                                 safe_size,
+                                 &h_beta,
+                                 descr,
+                                 dval,
+                                 dptr,
+                                 dcol);
+
+        if(m < 0 || n < 0 || k < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || k < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && k >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Initialize random seed
+    srand(12345ULL);
+
+    // Host structures - sparsity pattern of C
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T>             hcsr_val;
+
+    gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+
+    // Convert COO to CSR
+    std::vector<rocsparse_int> hcsr_row_ptr(m + 1, 0);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+    }
+
+    hcsr_row_ptr[0] = idx_base;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+    }
+
+    // Dense matrices, stored column major
+    rocsparse_int lda = m;
+    rocsparse_int ldb = n;
+
+    std::vector<T> hA(lda * k);
+    std::vector<T> hB(ldb * k);
+    std::vector<T> hcsr_val_1(nnz);
+    std::vector<T> hcsr_val_2(nnz);
+    std::vector<T> hcsr_val_gold(nnz);
+
+    rocsparse_init<T>(hA, lda, k);
+    rocsparse_init<T>(hB, ldb, k);
+
+    hcsr_val_1    = hcsr_val;
+    hcsr_val_2    = hcsr_val;
+    hcsr_val_gold = hcsr_val;
+
+    // Allocate memory on device
+    auto dptr_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed
+        = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_1_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_2_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dA_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * lda * k), device_free};
+    auto dB_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldb * k), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr    = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol    = (rocsparse_int*)dcol_managed.get();
+    T*             dval_1  = (T*)dval_1_managed.get();
+    T*             dval_2  = (T*)dval_2_managed.get();
+    T*             dA      = (T*)dA_managed.get();
+    T*             dB      = (T*)dB_managed.get();
+    T*             d_alpha = (T*)d_alpha_managed.get();
+    T*             d_beta  = (T*)d_beta_managed.get();
+
+    if(!dptr || !dcol || !dval_1 || !dval_2 || !dA || !dB || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval_1 || !dval_2 || "
+                                        "!dA || !dB || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_1, hcsr_val_1.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * lda * k, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * ldb * k, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(dval_2, hcsr_val_2.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sddmm(handle,
+                                              m,
+                                              n,
+                                              k,
+                                              nnz,
+                                              &h_alpha,
+                                              dA,
+                                              lda,
+                                              dB,
+                                              ldb,
+                                              &h_beta,
+                                              descr,
+                                              dval_1,
+                                              dptr,
+                                              dcol));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sddmm(handle,
+                                              m,
+                                              n,
+                                              k,
+                                              nnz,
+                                              d_alpha,
+                                              dA,
+                                              lda,
+                                              dB,
+                                              ldb,
+                                              d_beta,
+                                              descr,
+                                              dval_2,
+                                              dptr,
+                                              dcol));
+
+        // Copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_1.data(), dval_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_2.data(), dval_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // Host sddmm, sampling A * B^T at the sparsity pattern of C
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rocsparse_int row_begin = hcsr_row_ptr[i] - idx_base;
+            rocsparse_int row_end   = hcsr_row_ptr[i + 1] - idx_base;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col = hcsr_col_ind[j] - idx_base;
+
+                T dot = static_cast<T>(0);
+                for(rocsparse_int l = 0; l < k; ++l)
+                {
+                    dot = std::fma(hA[l * lda + i], hB[l * ldb + col], dot);
+                }
+
+                hcsr_val_gold[j] = std::fma(h_alpha, dot, h_beta * hcsr_val_gold[j]);
+            }
+        }
+
+        unit_check_near(1, nnz, 1, hcsr_val_gold.data(), hcsr_val_1.data());
+        unit_check_near(1, nnz, 1, hcsr_val_gold.data(), hcsr_val_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = argus.warmup;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_sddmm(handle,
+                            m,
+                            n,
+                            k,
+                            nnz,
+                            &h_alpha,
+                            dA,
+                            lda,
+                            dB,
+                            ldb,
+                            &h_beta,
+                            descr,
+                            dval_1,
+                            dptr,
+                            dcol);
+        }
+
+        hipStream_t stream;
+        rocsparse_get_stream(handle, &stream);
+
+        gpu_event_timer timer;
+
+        double e2e_time = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            timer.start(stream);
+
+            rocsparse_sddmm(handle,
+                            m,
+                            n,
+                            k,
+                            nnz,
+                            &h_alpha,
+                            dA,
+                            lda,
+                            dB,
+                            ldb,
+                            &h_beta,
+                            descr,
+                            dval_1,
+                            dptr,
+                            dcol);
+
+            timer.stop(stream);
+        }
+
+        // Per-iteration kernel times, resolved with a single sync after the loop
+        std::vector<double> times = timer.times_us();
+
+        // End-to-end time including launch overhead, per call
+        e2e_time = (get_time_us() - e2e_time) / number_hot_calls;
+
+        bench_collect("sddmm", times);
+        bench_collect("sddmm_e2e", std::vector<double>(1, e2e_time));
+
+        // Median in miliseconds per call
+        double gpu_time_used = bench_compute_stats(times).median / 1e3;
+
+        // GFlops
+        size_t flops      = (2 * (size_t)k + 3) * nnz;
+        double gpu_gflops = flops / gpu_time_used / 1e6;
+
+        // Bandwidth
+        size_t int_data  = (m + 1 + nnz) * sizeof(rocsparse_int);
+        size_t flt_data  = (2 * (size_t)nnz + (size_t)k * (m + n)) * sizeof(T);
+        double bandwidth = (int_data + flt_data) / gpu_time_used / 1e6;
+        bench_set_bandwidth("sddmm", bandwidth);
+
+        printf("m\t\tn\t\tk\t\tnnz\t\talpha\tbeta\tGFlops\tGB/s\tmsec\n");
+        printf("%8d\t%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               k,
+               nnz,
+               h_alpha,
+               h_beta,
+               gpu_gflops,
+               bandwidth,
+               gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_SDDMM_HPP
@@ -26,16 +26,30 @@
 #define TESTING_UTILITY_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <ctype.h>
+#include <fcntl.h>
 #include <fstream>
 #include <hip/hip_runtime_api.h>
+#include <map>
 #include <math.h>
 #include <rocsparse.h>
 #include <sstream>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /*!\file
  * \brief provide data initialization and timing utilities.
  */
@@ -239,6 +253,171 @@ rocsparse_int gen_2d_laplacian(rocsparse_int               ndim,
     return n;
 }
 
+/* ============================================================================================ */
+/*! \brief  Generate 3D laplacian on unit cube in CSR format, as 7-point or 27-point
+ *  stencil. The 27-point stencil requires ndim >= 3 for distinct neighbor columns.
+ */
+template <typename T>
+rocsparse_int gen_3d_laplacian(rocsparse_int               ndim,
+                               std::vector<rocsparse_int>& rowptr,
+                               std::vector<rocsparse_int>& col,
+                               std::vector<T>&             val,
+                               rocsparse_index_base        idx_base,
+                               bool                        full27)
+{
+    if(ndim == 0)
+    {
+        return 0;
+    }
+
+    rocsparse_int n      = ndim * ndim * ndim;
+    rocsparse_int points = full27 ? 27 : 7;
+
+    rowptr.resize(n + 1);
+    col.resize((size_t)n * points);
+    val.resize((size_t)n * points);
+
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int k = 0; k < ndim; ++k)
+    {
+        for(rocsparse_int i = 0; i < ndim; ++i)
+        {
+            for(rocsparse_int j = 0; j < ndim; ++j)
+            {
+                rocsparse_int idx = (k * ndim + i) * ndim + j;
+                rowptr[idx]       = nnz + idx_base;
+
+                // Neighbors in lexicographic (dk, di, dj) order, which is ascending
+                // column order on the structured grid
+                for(rocsparse_int dk = -1; dk <= 1; ++dk)
+                {
+                    for(rocsparse_int di = -1; di <= 1; ++di)
+                    {
+                        for(rocsparse_int dj = -1; dj <= 1; ++dj)
+                        {
+                            // The 7-point stencil couples along the axes only
+                            if(!full27 && (dk != 0) + (di != 0) + (dj != 0) > 1)
+                            {
+                                continue;
+                            }
+
+                            if(k + dk < 0 || k + dk >= ndim || i + di < 0 || i + di >= ndim
+                               || j + dj < 0 || j + dj >= ndim)
+                            {
+                                continue;
+                            }
+
+                            if(dk == 0 && di == 0 && dj == 0)
+                            {
+                                col[nnz] = idx + idx_base;
+                                val[nnz] = static_cast<T>(full27 ? 26 : 6);
+                            }
+                            else
+                            {
+                                col[nnz] = ((k + dk) * ndim + i + di) * ndim + j + dj + idx_base;
+                                val[nnz] = static_cast<T>(-1);
+                            }
+                            ++nnz;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    rowptr[n] = nnz + idx_base;
+
+    col.resize(nnz);
+    val.resize(nnz);
+
+    return n;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate an anisotropic banded matrix in CSR format: couplings sit on ndiag
+ *  pairs of off-diagonals whose offsets grow geometrically up to the given bandwidth,
+ *  mimicking the near/far couplings of anisotropic structured grids.
+ */
+template <typename T>
+rocsparse_int gen_banded_matrix(rocsparse_int               m,
+                                rocsparse_int               bandwidth,
+                                rocsparse_int               ndiag,
+                                std::vector<rocsparse_int>& rowptr,
+                                std::vector<rocsparse_int>& col,
+                                std::vector<T>&             val,
+                                rocsparse_index_base        idx_base)
+{
+    if(m == 0)
+    {
+        return 0;
+    }
+
+    // Geometrically growing off-diagonal offsets, e.g. 1, 4, 16, 64 for
+    // bandwidth 64 and 4 diagonal pairs
+    std::vector<rocsparse_int> offset;
+    for(rocsparse_int d = 0; d < ndiag; ++d)
+    {
+        rocsparse_int off
+            = (d == ndiag - 1) ? bandwidth
+                               : (rocsparse_int)(pow((double)bandwidth, (d + 1.0) / ndiag) + 0.5);
+
+        if(off < 1)
+        {
+            off = 1;
+        }
+
+        // Offsets may collide for small bandwidths
+        if(offset.empty() || off > offset.back())
+        {
+            offset.push_back(off);
+        }
+    }
+
+    rowptr.resize(m + 1);
+    col.resize((size_t)m * (2 * offset.size() + 1));
+    val.resize((size_t)m * (2 * offset.size() + 1));
+
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rowptr[i] = nnz + idx_base;
+
+        // Lower couplings in ascending column order
+        for(rocsparse_int d = (rocsparse_int)offset.size() - 1; d >= 0; --d)
+        {
+            if(i - offset[d] >= 0)
+            {
+                col[nnz] = i - offset[d] + idx_base;
+                val[nnz] = static_cast<T>(-1);
+                ++nnz;
+            }
+        }
+
+        // Diagonal, scaled to keep the matrix diagonally dominant
+        col[nnz] = i + idx_base;
+        val[nnz] = static_cast<T>(2 * offset.size() + 1);
+        ++nnz;
+
+        // Upper couplings
+        for(size_t d = 0; d < offset.size(); ++d)
+        {
+            if(i + offset[d] < m)
+            {
+                col[nnz] = i + offset[d] + idx_base;
+                val[nnz] = static_cast<T>(-1);
+                ++nnz;
+            }
+        }
+    }
+    rowptr[m] = nnz + idx_base;
+
+    col.resize(nnz);
+    val.resize(nnz);
+
+    return m;
+}
+
 /* ============================================================================================ */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename T>
@@ -344,7 +523,381 @@ void gen_matrix_coo(rocsparse_int               m,
 }
 
 /* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
+/*! \brief  Skip to the first character of the next line */
+static inline const char* mtx_next_line(const char* p, const char* end)
+{
+    while(p < end && *p != '\n')
+    {
+        ++p;
+    }
+
+    return (p < end) ? p + 1 : end;
+}
+
+/* ============================================================================================ */
+/*! \brief  Parse an integer from the mtx data, advancing the read pointer */
+static inline bool mtx_read_int(const char*& p, const char* end, rocsparse_int& value)
+{
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        ++p;
+    }
+
+    bool neg = false;
+    if(p < end && (*p == '+' || *p == '-'))
+    {
+        neg = (*p++ == '-');
+    }
+
+    if(p >= end || *p < '0' || *p > '9')
+    {
+        return false;
+    }
+
+    rocsparse_int v = 0;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        v = v * 10 + (*p++ - '0');
+    }
+
+    value = neg ? -v : v;
+
+    return true;
+}
+
+/* ============================================================================================ */
+/*! \brief  Parse a floating point value from the mtx data, advancing the read pointer */
+static inline bool mtx_read_double(const char*& p, const char* end, double& value)
+{
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        ++p;
+    }
+
+    bool neg = false;
+    if(p < end && (*p == '+' || *p == '-'))
+    {
+        neg = (*p++ == '-');
+    }
+
+    bool   digit = false;
+    double v     = 0.0;
+
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        v     = v * 10.0 + (*p++ - '0');
+        digit = true;
+    }
+
+    if(p < end && *p == '.')
+    {
+        ++p;
+
+        double scale = 0.1;
+        while(p < end && *p >= '0' && *p <= '9')
+        {
+            v += scale * (*p++ - '0');
+            scale *= 0.1;
+            digit = true;
+        }
+    }
+
+    if(!digit)
+    {
+        return false;
+    }
+
+    if(p < end && (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D'))
+    {
+        ++p;
+
+        rocsparse_int exp;
+        if(!mtx_read_int(p, end, exp))
+        {
+            return false;
+        }
+
+        v *= pow(10.0, static_cast<double>(exp));
+    }
+
+    value = neg ? -v : v;
+
+    return true;
+}
+
+/* ============================================================================================ */
+/*! \brief  Header of the binary matrix cache written next to parsed mtx files. Indices and
+    values are stored type independent as zero based CSR in int64_t and double */
+struct mtx_bin_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    int64_t  nrow;
+    int64_t  ncol;
+    int64_t  nnz;
+};
+
+#define MTX_BIN_MAGIC "rocSPbin"
+#define MTX_BIN_VERSION 1
+
+/* ============================================================================================ */
+/*! \brief  Load the binary cache of an mtx file, if a valid one that is not older than the
+    mtx file exists. The cache is mapped into memory and expanded into COO arrays */
+template <typename T>
+static rocsparse_int read_mtx_bin_cache(const char*                 cachename,
+                                        const char*                 mtxname,
+                                        rocsparse_int&              nrow,
+                                        rocsparse_int&              ncol,
+                                        rocsparse_int&              nnz,
+                                        std::vector<rocsparse_int>& row,
+                                        std::vector<rocsparse_int>& col,
+                                        std::vector<T>&             val,
+                                        rocsparse_index_base        idx_base)
+{
+    struct stat mtx_st;
+    struct stat bin_st;
+
+    if(stat(mtxname, &mtx_st) < 0 || stat(cachename, &bin_st) < 0)
+    {
+        return -1;
+    }
+
+    // Discard stale caches
+    if(bin_st.st_mtime < mtx_st.st_mtime)
+    {
+        return -1;
+    }
+
+    int fd = open(cachename, O_RDONLY);
+    if(fd < 0)
+    {
+        return -1;
+    }
+
+    size_t fsize = bin_st.st_size;
+    if(fsize < sizeof(mtx_bin_header))
+    {
+        close(fd);
+        return -1;
+    }
+
+    const char* fbuf = static_cast<const char*>(mmap(NULL, fsize, PROT_READ, MAP_PRIVATE, fd, 0));
+    if(fbuf == MAP_FAILED)
+    {
+        close(fd);
+        return -1;
+    }
+
+    const mtx_bin_header* h = reinterpret_cast<const mtx_bin_header*>(fbuf);
+
+    // Validate header and file size
+    if(memcmp(h->magic, MTX_BIN_MAGIC, 8) != 0 || h->version != MTX_BIN_VERSION || h->nrow < 0
+       || h->nnz < 0
+       || fsize != sizeof(mtx_bin_header) + sizeof(int64_t) * (h->nrow + 1 + h->nnz)
+                       + sizeof(double) * h->nnz)
+    {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
+        return -1;
+    }
+
+    printf("Reading matrix %s (cached)...", mtxname);
+    fflush(stdout);
+
+    nrow = static_cast<rocsparse_int>(h->nrow);
+    ncol = static_cast<rocsparse_int>(h->ncol);
+    nnz  = static_cast<rocsparse_int>(h->nnz);
+
+    const int64_t* bin_ptr = reinterpret_cast<const int64_t*>(fbuf + sizeof(mtx_bin_header));
+    const int64_t* bin_col = bin_ptr + h->nrow + 1;
+    const double*  bin_val = reinterpret_cast<const double*>(bin_col + h->nnz);
+
+    row.resize(nnz);
+    col.resize(nnz);
+    val.resize(nnz);
+
+    // Expand the CSR row offsets into COO row indices with the requested base
+    for(rocsparse_int i = 0; i < nrow; ++i)
+    {
+        for(int64_t j = bin_ptr[i]; j < bin_ptr[i + 1]; ++j)
+        {
+            row[j] = i + idx_base;
+        }
+    }
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        col[i] = static_cast<rocsparse_int>(bin_col[i]) + idx_base;
+        val[i] = static_cast<T>(bin_val[i]);
+    }
+
+    munmap(const_cast<char*>(fbuf), fsize);
+    close(fd);
+
+    printf("done.\n");
+    fflush(stdout);
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Write the binary cache of an mtx file from its sorted COO arrays. Writing is best
+    effort, a failure leaves at most a stale temporary behind */
+template <typename T>
+static void write_mtx_bin_cache(const char*                       cachename,
+                                rocsparse_int                     nrow,
+                                rocsparse_int                     ncol,
+                                rocsparse_int                     nnz,
+                                const std::vector<rocsparse_int>& row,
+                                const std::vector<rocsparse_int>& col,
+                                const std::vector<T>&             val,
+                                rocsparse_index_base              idx_base)
+{
+    std::string tmpname = std::string(cachename) + ".tmp";
+
+    FILE* f = fopen(tmpname.c_str(), "wb");
+    if(!f)
+    {
+        return;
+    }
+
+    mtx_bin_header h;
+    memcpy(h.magic, MTX_BIN_MAGIC, 8);
+    h.version  = MTX_BIN_VERSION;
+    h.reserved = 0;
+    h.nrow     = nrow;
+    h.ncol     = ncol;
+    h.nnz      = nnz;
+
+    // Compress the sorted COO row indices into zero based CSR row offsets
+    std::vector<int64_t> bin_ptr(nrow + 1, 0);
+    std::vector<int64_t> bin_col(nnz);
+    std::vector<double>  bin_val(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++bin_ptr[row[i] - idx_base + 1];
+        bin_col[i] = col[i] - idx_base;
+        bin_val[i] = static_cast<double>(val[i]);
+    }
+
+    for(rocsparse_int i = 0; i < nrow; ++i)
+    {
+        bin_ptr[i + 1] += bin_ptr[i];
+    }
+
+    size_t err = fwrite(&h, sizeof(mtx_bin_header), 1, f);
+    err += fwrite(bin_ptr.data(), sizeof(int64_t), nrow + 1, f);
+    err += fwrite(bin_col.data(), sizeof(int64_t), nnz, f);
+    err += fwrite(bin_val.data(), sizeof(double), nnz, f);
+
+    fclose(f);
+
+    if(err != static_cast<size_t>(1 + nrow + 1 + nnz + nnz)
+       || rename(tmpname.c_str(), cachename) != 0)
+    {
+        remove(tmpname.c_str());
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Process-wide matrix fixture cache shared across the test suite. Parsed files and
+    generated structured matrices are memoized by their file name or generator parameters,
+    such that test cases exercising the same input skip the regeneration or the file parse
+    entirely. The cache stops accepting entries once its byte budget is exhausted,
+    configurable in megabytes through ROCSPARSE_FIXTURE_CACHE_MB (default 1024, 0 disables
+    the cache) */
+template <typename T>
+struct matrix_fixture
+{
+    rocsparse_int              m;
+    rocsparse_int              n;
+    rocsparse_int              nnz;
+    std::vector<rocsparse_int> row_ptr;
+    std::vector<rocsparse_int> col;
+    std::vector<T>             val;
+};
+
+inline size_t& matrix_fixture_used()
+{
+    static size_t used = 0;
+    return used;
+}
+
+inline size_t matrix_fixture_budget()
+{
+    static size_t budget = getenv("ROCSPARSE_FIXTURE_CACHE_MB")
+                               ? strtoull(getenv("ROCSPARSE_FIXTURE_CACHE_MB"), NULL, 10)
+                                     * 1000000ULL
+                               : 1024000000ULL;
+    return budget;
+}
+
+template <typename T>
+std::map<std::string, matrix_fixture<T>>& matrix_fixture_map()
+{
+    static std::map<std::string, matrix_fixture<T>> cache;
+    return cache;
+}
+
+template <typename T>
+bool matrix_fixture_lookup(const std::string&          key,
+                           rocsparse_int&              m,
+                           rocsparse_int&              n,
+                           rocsparse_int&              nnz,
+                           std::vector<rocsparse_int>& row_ptr,
+                           std::vector<rocsparse_int>& col,
+                           std::vector<T>&             val)
+{
+    auto it = matrix_fixture_map<T>().find(key);
+    if(it == matrix_fixture_map<T>().end())
+    {
+        return false;
+    }
+
+    m       = it->second.m;
+    n       = it->second.n;
+    nnz     = it->second.nnz;
+    row_ptr = it->second.row_ptr;
+    col     = it->second.col;
+    val     = it->second.val;
+
+    return true;
+}
+
+template <typename T>
+void matrix_fixture_insert(const std::string&                key,
+                           rocsparse_int                     m,
+                           rocsparse_int                     n,
+                           rocsparse_int                     nnz,
+                           const std::vector<rocsparse_int>& row_ptr,
+                           const std::vector<rocsparse_int>& col,
+                           const std::vector<T>&             val)
+{
+    size_t bytes = sizeof(rocsparse_int) * (row_ptr.size() + col.size()) + sizeof(T) * val.size();
+
+    if(matrix_fixture_used() + bytes > matrix_fixture_budget())
+    {
+        return;
+    }
+
+    matrix_fixture<T>& entry = matrix_fixture_map<T>()[key];
+
+    entry.m       = m;
+    entry.n       = n;
+    entry.nnz     = nnz;
+    entry.row_ptr = row_ptr;
+    entry.col     = col;
+    entry.val     = val;
+
+    matrix_fixture_used() += bytes;
+}
+
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in COO format. The file is mapped into memory and the
+    entry section is split into chunks that are parsed by OpenMP threads in parallel. A binary
+    cache is written next to the mtx file on first parse and loaded on subsequent runs */
 template <typename T>
 rocsparse_int read_mtx_matrix(const char*                 filename,
                               rocsparse_int&              nrow,
@@ -355,23 +908,59 @@ rocsparse_int read_mtx_matrix(const char*                 filename,
                               std::vector<T>&             val,
                               rocsparse_index_base        idx_base)
 {
+    // Serve repeated reads of the same file from the fixture cache
+    std::string fkey = std::string("mtx:") + filename + ":" + std::to_string(idx_base);
+    if(matrix_fixture_lookup(fkey, nrow, ncol, nnz, row, col, val))
+    {
+        return 0;
+    }
+
+    // Prefer the binary cache of a previous run, if it is still valid
+    std::string cachename = std::string(filename) + ".bin";
+    if(read_mtx_bin_cache(cachename.c_str(), filename, nrow, ncol, nnz, row, col, val, idx_base)
+       == 0)
+    {
+        matrix_fixture_insert(fkey, nrow, ncol, nnz, row, col, val);
+
+        return 0;
+    }
+
     printf("Reading matrix %s...", filename);
     fflush(stdout);
 
-    FILE* f = fopen(filename, "r");
-    if(!f)
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0)
     {
         return -1;
     }
 
-    char line[1024];
+    struct stat st;
+    if(fstat(fd, &st) < 0 || st.st_size == 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    size_t      fsize = st.st_size;
+    const char* fbuf  = static_cast<const char*>(mmap(NULL, fsize, PROT_READ, MAP_PRIVATE, fd, 0));
 
-    // Check for banner
-    if(!fgets(line, 1024, f))
+    if(fbuf == MAP_FAILED)
     {
+        close(fd);
         return -1;
     }
 
+    const char* fend = fbuf + fsize;
+
+    // Copy the banner line into a bounded buffer for parsing
+    char line[1024];
+
+    const char* p    = mtx_next_line(fbuf, fend);
+    size_t      llen = std::min(static_cast<size_t>(p - fbuf), sizeof(line) - 1);
+
+    memcpy(line, fbuf, llen);
+    line[llen] = '\0';
+
     char banner[16];
     char array[16];
     char coord[16];
@@ -381,122 +970,196 @@ rocsparse_int read_mtx_matrix(const char*                 filename,
     // Extract banner
     if(sscanf(line, "%s %s %s %s %s", banner, array, coord, data, type) != 5)
     {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
         return -1;
     }
 
     // Convert to lower case
-    for(char* p = array; *p != '\0'; *p = tolower(*p), p++)
+    for(char* c = array; *c != '\0'; *c = tolower(*c), c++)
         ;
-    for(char* p = coord; *p != '\0'; *p = tolower(*p), p++)
+    for(char* c = coord; *c != '\0'; *c = tolower(*c), c++)
         ;
-    for(char* p = data; *p != '\0'; *p = tolower(*p), p++)
+    for(char* c = data; *c != '\0'; *c = tolower(*c), c++)
         ;
-    for(char* p = type; *p != '\0'; *p = tolower(*p), p++)
+    for(char* c = type; *c != '\0'; *c = tolower(*c), c++)
         ;
 
     // Check banner
     if(strncmp(line, "%%MatrixMarket", 14) != 0)
     {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
         return -1;
     }
 
     // Check array type
     if(strcmp(array, "matrix") != 0)
     {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
         return -1;
     }
 
     // Check coord
     if(strcmp(coord, "coordinate") != 0)
     {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
         return -1;
     }
 
     // Check data
     if(strcmp(data, "real") != 0 && strcmp(data, "integer") != 0 && strcmp(data, "pattern") != 0)
     {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
         return -1;
     }
 
     // Check type
     if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0)
     {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
         return -1;
     }
 
     // Symmetric flag
     rocsparse_int symm = !strcmp(type, "symmetric");
 
+    // Pattern flag
+    rocsparse_int pattern = !strcmp(data, "pattern");
+
     // Skip comments
-    while(fgets(line, 1024, f))
+    while(p < fend && *p == '%')
     {
-        if(line[0] != '%')
-        {
-            break;
-        }
+        p = mtx_next_line(p, fend);
     }
 
     // Read dimensions
     rocsparse_int snnz;
 
-    sscanf(line, "%d %d %d", &nrow, &ncol, &snnz);
-    nnz = symm ? (snnz - nrow) * 2 + nrow : snnz;
+    if(!mtx_read_int(p, fend, nrow) || !mtx_read_int(p, fend, ncol) || !mtx_read_int(p, fend, snnz))
+    {
+        munmap(const_cast<char*>(fbuf), fsize);
+        close(fd);
+        return -1;
+    }
 
-    std::vector<rocsparse_int> unsorted_row(nnz);
-    std::vector<rocsparse_int> unsorted_col(nnz);
-    std::vector<T>             unsorted_val(nnz);
+    // Beginning of the entry section
+    const char* entries = mtx_next_line(p, fend);
 
-    // Read entries
-    rocsparse_int idx = 0;
-    while(fgets(line, 1024, f))
+#ifdef _OPENMP
+    rocsparse_int nthreads = omp_get_max_threads();
+#else
+    rocsparse_int nthreads = 1;
+#endif
+
+    // Per thread COO arrays and parse status
+    std::vector<std::vector<rocsparse_int>> trow(nthreads);
+    std::vector<std::vector<rocsparse_int>> tcol(nthreads);
+    std::vector<std::vector<T>>             tval(nthreads);
+    std::vector<rocsparse_int>              tok(nthreads, 1);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
     {
-        if(idx >= nnz)
-        {
-            return true;
-        }
+#ifdef _OPENMP
+        rocsparse_int tid = omp_get_thread_num();
+#else
+        rocsparse_int tid = 0;
+#endif
 
-        rocsparse_int irow;
-        rocsparse_int icol;
-        T             ival;
+        // Split the entry section into equally sized chunks and align the
+        // chunk bounds on line boundaries. Each thread extends its chunk to
+        // the end of its last line, the next thread skips that partial line
+        size_t chunk = (fend - entries) / nthreads;
 
-        std::istringstream ss(line);
+        const char* begin = (tid == 0) ? entries : mtx_next_line(entries + tid * chunk, fend);
+        const char* end = (tid == nthreads - 1) ? fend : mtx_next_line(entries + (tid + 1) * chunk, fend);
 
-        if(!strcmp(data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = static_cast<T>(1);
-        }
-        else
-        {
-            ss >> irow >> icol >> ival;
-        }
+        trow[tid].reserve((snnz / nthreads + 1) * (symm ? 2 : 1));
+        tcol[tid].reserve((snnz / nthreads + 1) * (symm ? 2 : 1));
+        tval[tid].reserve((snnz / nthreads + 1) * (symm ? 2 : 1));
 
-        if(idx_base == rocsparse_index_base_zero)
+        const char* pos = begin;
+        while(pos < end)
         {
-            --irow;
-            --icol;
-        }
+            // Skip empty lines
+            while(pos < end
+                  && (*pos == ' ' || *pos == '\t' || *pos == '\r' || *pos == '\n'))
+            {
+                ++pos;
+            }
 
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
+            if(pos >= end)
+            {
+                break;
+            }
 
-        ++idx;
+            rocsparse_int irow;
+            rocsparse_int icol;
+            double        ival = 1.0;
 
-        if(symm && irow != icol)
-        {
-            if(idx >= nnz)
+            if(!mtx_read_int(pos, end, irow) || !mtx_read_int(pos, end, icol)
+               || (!pattern && !mtx_read_double(pos, end, ival)))
+            {
+                tok[tid] = 0;
+                break;
+            }
+
+            pos = mtx_next_line(pos, end);
+
+            if(idx_base == rocsparse_index_base_zero)
             {
-                return true;
+                --irow;
+                --icol;
             }
 
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+            trow[tid].push_back(irow);
+            tcol[tid].push_back(icol);
+            tval[tid].push_back(static_cast<T>(ival));
+
+            if(symm && irow != icol)
+            {
+                trow[tid].push_back(icol);
+                tcol[tid].push_back(irow);
+                tval[tid].push_back(static_cast<T>(ival));
+            }
         }
     }
-    fclose(f);
+
+    munmap(const_cast<char*>(fbuf), fsize);
+    close(fd);
+
+    // Gather the per thread entry counts
+    nnz = 0;
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        if(!tok[t])
+        {
+            return -1;
+        }
+
+        nnz += trow[t].size();
+    }
+
+    std::vector<rocsparse_int> unsorted_row(nnz);
+    std::vector<rocsparse_int> unsorted_col(nnz);
+    std::vector<T>             unsorted_val(nnz);
+
+    // Merge the per thread arrays
+    rocsparse_int offset = 0;
+    for(rocsparse_int t = 0; t < nthreads; ++t)
+    {
+        std::copy(trow[t].begin(), trow[t].end(), unsorted_row.begin() + offset);
+        std::copy(tcol[t].begin(), tcol[t].end(), unsorted_col.begin() + offset);
+        std::copy(tval[t].begin(), tval[t].end(), unsorted_val.begin() + offset);
+
+        offset += trow[t].size();
+    }
 
     row.resize(nnz);
     col.resize(nnz);
@@ -531,6 +1194,11 @@ rocsparse_int read_mtx_matrix(const char*                 filename,
         val[i] = unsorted_val[perm[i]];
     }
 
+    // Cache the parsed matrix for subsequent runs
+    write_mtx_bin_cache(cachename.c_str(), nrow, ncol, nnz, row, col, val, idx_base);
+
+    matrix_fixture_insert(fkey, nrow, ncol, nnz, row, col, val);
+
     printf("done.\n");
     fflush(stdout);
 
@@ -549,6 +1217,13 @@ rocsparse_int read_bin_matrix(const char*                 filename,
                               std::vector<T>&             val,
                               rocsparse_index_base        idx_base)
 {
+    // Serve repeated reads of the same file from the fixture cache
+    std::string fkey = std::string("bin:") + filename + ":" + std::to_string(idx_base);
+    if(matrix_fixture_lookup(fkey, nrow, ncol, nnz, ptr, col, val))
+    {
+        return 0;
+    }
+
     printf("Reading matrix %s...", filename);
     fflush(stdout);
 
@@ -594,6 +1269,8 @@ rocsparse_int read_bin_matrix(const char*                 filename,
         }
     }
 
+    matrix_fixture_insert(fkey, nrow, ncol, nnz, ptr, col, val);
+
     printf("done.\n");
     fflush(stdout);
 
@@ -612,6 +1289,13 @@ rocsparse_int read_rocalution_matrix(const char*                 filename,
                                      std::vector<T>&             val,
                                      rocsparse_index_base        idx_base)
 {
+    // Serve repeated reads of the same file from the fixture cache
+    std::string fkey = std::string("csr:") + filename + ":" + std::to_string(idx_base);
+    if(matrix_fixture_lookup(fkey, nrow, ncol, nnz, ptr, col, val))
+    {
+        return 0;
+    }
+
     printf("Reading matrix %s...", filename);
     fflush(stdout);
 
@@ -666,6 +1350,8 @@ rocsparse_int read_rocalution_matrix(const char*                 filename,
         }
     }
 
+    matrix_fixture_insert(fkey, nrow, ncol, nnz, ptr, col, val);
+
     printf("done.\n");
     fflush(stdout);
 
@@ -674,7 +1360,8 @@ rocsparse_int read_rocalution_matrix(const char*                 filename,
 
 /* ============================================================================================ */
 /*! \brief  Compute incomplete LU factorization without fill-ins and no pivoting using CSR
- *  matrix storage format.
+ *  matrix storage format. Rows are grouped by dependency level so that all rows within a
+ *  level factorize in parallel; levels are processed in order.
  */
 template <typename T>
 rocsparse_int csrilu0(rocsparse_int        m,
@@ -683,86 +1370,172 @@ rocsparse_int csrilu0(rocsparse_int        m,
                       T*                   val,
                       rocsparse_index_base idx_base)
 {
-    // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_offset(m);
-    std::vector<rocsparse_int> nnz_entries(m, 0);
+    // Dependency level of each row: one more than the deepest row it eliminates with
+    std::vector<rocsparse_int> depth(m, 0);
+    rocsparse_int              nlevels = 0;
+
+    for(rocsparse_int ai = 0; ai < m; ++ai)
+    {
+        rocsparse_int d = 0;
+
+        for(rocsparse_int j = ptr[ai] - idx_base; j < ptr[ai + 1] - idx_base; ++j)
+        {
+            rocsparse_int aj = col[j] - idx_base;
+            if(aj >= ai)
+            {
+                break;
+            }
+
+            d = std::max(d, depth[aj] + 1);
+        }
+
+        depth[ai] = d;
+        nlevels   = std::max(nlevels, d + 1);
+    }
 
-    // ai = 0 to N loop over all rows
+    // Counting sort the rows by level
+    std::vector<rocsparse_int> level_offset(nlevels + 1, 0);
     for(rocsparse_int ai = 0; ai < m; ++ai)
     {
-        // ai-th row entries
-        rocsparse_int row_start = ptr[ai] - idx_base;
-        rocsparse_int row_end   = ptr[ai + 1] - idx_base;
-        rocsparse_int j;
+        ++level_offset[depth[ai] + 1];
+    }
+    for(rocsparse_int i = 0; i < nlevels; ++i)
+    {
+        level_offset[i + 1] += level_offset[i];
+    }
 
-        // nnz position of ai-th row in val array
-        for(j = row_start; j < row_end; ++j)
+    std::vector<rocsparse_int> level_rows(m);
+    {
+        std::vector<rocsparse_int> fill = level_offset;
+        for(rocsparse_int ai = 0; ai < m; ++ai)
         {
-            nnz_entries[col[j] - idx_base] = j;
+            level_rows[fill[depth[ai]]++] = ai;
         }
+    }
+
+    // pointer of upper part of each row
+    std::vector<rocsparse_int> diag_offset(m);
+
+    // first zero pivot in row order and the value to report for it
+    rocsparse_int position_row = -1;
+    rocsparse_int position_val = -1;
 
-        bool has_diag = false;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // per-thread scratch for the nnz positions of the current row
+        std::vector<rocsparse_int> nnz_entries(m, 0);
 
-        // loop over ai-th row nnz entries
-        for(j = row_start; j < row_end; ++j)
+        for(rocsparse_int lvl = 0; lvl < nlevels; ++lvl)
         {
-            // if nnz entry is in lower matrix
-            if(col[j] - idx_base < ai)
+            // All rows of a level are independent; the barrier at the end of the
+            // loop makes their results visible to the next level
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+            for(rocsparse_int idx = level_offset[lvl]; idx < level_offset[lvl + 1]; ++idx)
             {
+                rocsparse_int ai = level_rows[idx];
 
-                rocsparse_int col_j  = col[j] - idx_base;
-                rocsparse_int diag_j = diag_offset[col_j];
+                // ai-th row entries
+                rocsparse_int row_start = ptr[ai] - idx_base;
+                rocsparse_int row_end   = ptr[ai + 1] - idx_base;
+                rocsparse_int j;
 
-                if(val[diag_j] != static_cast<T>(0))
+                // nnz position of ai-th row in val array
+                for(j = row_start; j < row_end; ++j)
                 {
-                    // multiplication factor
-                    val[j] = val[j] / val[diag_j];
+                    nnz_entries[col[j] - idx_base] = j;
+                }
+
+                bool          has_diag = false;
+                rocsparse_int pivot    = -1;
 
-                    // loop over upper offset pointer and do linear combination for nnz entry
-                    for(rocsparse_int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+                // loop over ai-th row nnz entries
+                for(j = row_start; j < row_end; ++j)
+                {
+                    // if nnz entry is in lower matrix
+                    if(col[j] - idx_base < ai)
                     {
-                        // if nnz at this position do linear combination
-                        if(nnz_entries[col[k] - idx_base] != 0)
+
+                        rocsparse_int col_j  = col[j] - idx_base;
+                        rocsparse_int diag_j = diag_offset[col_j];
+
+                        if(val[diag_j] != static_cast<T>(0))
                         {
-                            rocsparse_int idx = nnz_entries[col[k] - idx_base];
-                            val[idx]          = std::fma(-val[j], val[k], val[idx]);
+                            // multiplication factor
+                            val[j] = val[j] / val[diag_j];
+
+                            // loop over upper offset pointer and do linear combination for nnz
+                            // entry
+                            for(rocsparse_int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+                            {
+                                // if nnz at this position do linear combination
+                                if(nnz_entries[col[k] - idx_base] != 0)
+                                {
+                                    rocsparse_int idx2 = nnz_entries[col[k] - idx_base];
+                                    val[idx2]          = std::fma(-val[j], val[k], val[idx2]);
+                                }
+                            }
                         }
+                        else
+                        {
+                            // Numerical zero diagonal
+                            pivot = col_j + idx_base;
+                            break;
+                        }
+                    }
+                    else if(col[j] - idx_base == ai)
+                    {
+                        has_diag = true;
+                        break;
+                    }
+                    else
+                    {
+                        break;
                     }
                 }
-                else
+
+                if(pivot == -1 && !has_diag)
                 {
-                    // Numerical zero diagonal
-                    return col_j + idx_base;
+                    // Structural zero digonal
+                    pivot = ai + idx_base;
                 }
-            }
-            else if(col[j] - idx_base == ai)
-            {
-                has_diag = true;
-                break;
-            }
-            else
-            {
-                break;
-            }
-        }
 
-        if(!has_diag)
-        {
-            // Structural zero digonal
-            return ai + idx_base;
-        }
+                if(pivot != -1)
+                {
+                    // Report the zero pivot of the lowest row, matching the row order
+                    // of the serial factorization
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                    {
+                        if(position_row == -1 || ai < position_row)
+                        {
+                            position_row = ai;
+                            position_val = pivot;
+                        }
+                    }
+
+                    // Keep the diagonal pointer in bounds for dependent rows; their
+                    // results are discarded once the zero pivot is reported
+                    j = row_start;
+                }
 
-        // set diagonal pointer to diagonal element
-        diag_offset[ai] = j;
+                // set diagonal pointer to diagonal element
+                diag_offset[ai] = j;
 
-        // clear nnz entries
-        for(j = row_start; j < row_end; ++j)
-        {
-            nnz_entries[col[j] - idx_base] = 0;
+                // clear nnz entries
+                for(j = row_start; j < row_end; ++j)
+                {
+                    nnz_entries[col[j] - idx_base] = 0;
+                }
+            }
         }
     }
 
-    return -1;
+    return position_val;
 }
 
 /* ============================================================================================ */
@@ -1004,6 +1777,90 @@ double get_time_us_sync(hipStream_t stream);
 }
 #endif
 
+/* ============================================================================================ */
+/*  benchmark statistics: per-iteration samples are collected by the testing harnesses and
+    summarized by the benchmark client to obtain run-to-run stable numbers */
+
+/*! \brief hipEvent based GPU timer: events are recorded around the kernel region of
+    each iteration and resolved with a single synchronization after the loop, so that
+    launch overhead and host jitter do not fold into the kernel time */
+class gpu_event_timer
+{
+public:
+    gpu_event_timer() {}
+    ~gpu_event_timer();
+
+    // Record the start/stop event of the next iteration, without synchronizing
+    void start(hipStream_t stream);
+    void stop(hipStream_t stream);
+
+    // Synchronize once and return the per-iteration kernel times in microseconds
+    std::vector<double> times_us();
+
+private:
+    std::vector<hipEvent_t> start_events;
+    std::vector<hipEvent_t> stop_events;
+};
+
+/*! \brief hipMemGetInfo based device memory sampler: free memory is polled from a
+    background thread between start() and stop(), the largest drop against the baseline
+    gives the peak footprint of the sampled region, including temporary buffers that the
+    library allocates and releases internally */
+class device_mem_sampler
+{
+public:
+    // Take the baseline and start polling
+    void start(void);
+
+    // Stop polling and return the peak device memory consumed since start() in bytes
+    size_t stop(void);
+
+private:
+    std::thread       sampler;
+    std::atomic<bool> running{false};
+    size_t            baseline_free = 0;
+    size_t            min_free      = 0;
+};
+
+/*! \brief Summary statistics over per-iteration timing samples (in microseconds) */
+struct bench_stats
+{
+    int    samples;
+    double median;
+    double mean;
+    double stddev;
+    double ci95_lo;
+    double ci95_hi;
+};
+
+/*! \brief Compute median, standard deviation and 95% confidence interval of the mean */
+bench_stats bench_compute_stats(std::vector<double> times_us);
+
+/*! \brief Record the per-iteration samples of the hot loop for a routine */
+void bench_collect(const std::string& routine, const std::vector<double>& times_us);
+
+/*! \brief Label subsequently collected samples, e.g. with the current matrix of a sweep */
+void bench_set_case(const std::string& name);
+
+/*! \brief Record the achieved memory bandwidth of a routine in GB/s */
+void bench_set_bandwidth(const std::string& routine, double gbyte_per_sec);
+
+/*! \brief Record the peak device memory footprint of a routine in bytes */
+void bench_set_peak_memory(const std::string& routine, size_t bytes);
+
+/*! \brief Set the theoretical peak memory bandwidth the report relates achieved GB/s to */
+void bench_set_peak_bandwidth(double gbyte_per_sec);
+
+/*! \brief Theoretical peak memory bandwidth of a device in GB/s, from memory clock and
+    bus width */
+double device_peak_bandwidth(rocsparse_int device_id);
+
+/*! \brief Look up the statistics collected for a routine under the current case label */
+bench_stats bench_query(const std::string& routine);
+
+/*! \brief Write collected statistics in csv or json format; empty format disables the report */
+void bench_report(const std::string& format, const std::string& file);
+
 /* ============================================================================================ */
 
 /*! \brief Class used to parse command arguments in both client & gtest   */
@@ -1040,7 +1897,11 @@ public:
     rocsparse_int timing     = 0;
 
     rocsparse_int iters     = 10;
+    rocsparse_int warmup    = 2;
     rocsparse_int laplacian = 0;
+    rocsparse_int stencil   = 5;
+    rocsparse_int bandwidth = 64;
+    rocsparse_int ndiag     = 4;
     rocsparse_int ell_width = 0;
     rocsparse_int temp      = 0;
 
@@ -1076,7 +1937,11 @@ public:
         this->timing     = rhs.timing;
 
         this->iters     = rhs.iters;
+        this->warmup    = rhs.warmup;
         this->laplacian = rhs.laplacian;
+        this->stencil   = rhs.stencil;
+        this->bandwidth = rhs.bandwidth;
+        this->ndiag     = rhs.ndiag;
         this->ell_width = rhs.ell_width;
         this->temp      = rhs.temp;
 
@@ -1088,4 +1953,62 @@ public:
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  Generate the structured matrix selected by the laplacian arguments: the 2D
+ *  5-point stencil (default), the 3D 7-point or 27-point stencil, or the anisotropic
+ *  banded matrix (stencil 0), which uses the laplacian dimension directly as row count.
+ */
+template <typename T>
+rocsparse_int gen_laplacian(const Arguments&            argus,
+                            std::vector<rocsparse_int>& rowptr,
+                            std::vector<rocsparse_int>& col,
+                            std::vector<T>&             val,
+                            rocsparse_index_base        idx_base)
+{
+    // Serve repeated generations of the same structured matrix from the
+    // fixture cache
+    char key[64];
+    sprintf(key,
+            "lap:%d:%d:%d:%d:%d",
+            argus.stencil,
+            argus.laplacian,
+            argus.bandwidth,
+            argus.ndiag,
+            idx_base);
+
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    if(matrix_fixture_lookup(key, m, n, nnz, rowptr, col, val))
+    {
+        return m;
+    }
+
+    switch(argus.stencil)
+    {
+    case 7:
+        m = gen_3d_laplacian(argus.laplacian, rowptr, col, val, idx_base, false);
+        break;
+    case 27:
+        m = gen_3d_laplacian(argus.laplacian, rowptr, col, val, idx_base, true);
+        break;
+    case 0:
+        m = gen_banded_matrix(
+            argus.laplacian, argus.bandwidth, argus.ndiag, rowptr, col, val, idx_base);
+        break;
+    default:
+        m = gen_2d_laplacian(argus.laplacian, rowptr, col, val, idx_base);
+        break;
+    }
+
+    if(m > 0)
+    {
+        matrix_fixture_insert<T>(
+            key, m, m, static_cast<rocsparse_int>(col.size()), rowptr, col, val);
+    }
+
+    return m;
+}
+
 #endif // TESTING_UTILITY_HPP
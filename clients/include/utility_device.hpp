@@ -0,0 +1,392 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_UTILITY_DEVICE_HPP
+#define TESTING_UTILITY_DEVICE_HPP
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <assert.h>
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocsparse.h>
+#include <vector>
+
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+/* ============================================================================================ */
+/*  Device-side test matrix generation: the host generators in utility.hpp walk the whole
+    matrix with rand() and std::sort and then upload over PCIe, which dominates benchmark
+    wall time for large sizes. The generators below materialize the csr arrays directly in
+    device memory from a stateless counter-based RNG, so no host pass and no upload occur. */
+
+/*! \brief  splitmix64 hash, used as stateless parallel RNG */
+static __device__ __forceinline__ unsigned long long gen_hash(unsigned long long x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/*! \brief  random value in [1, 10], matching random_generator() of the host path */
+template <typename T>
+static __device__ __forceinline__ T gen_random_value(unsigned long long seed,
+                                                     unsigned long long idx)
+{
+    return static_cast<T>(gen_hash(seed ^ idx) % 10 + 1);
+}
+
+/*! \brief  Fill an array with random values in [1, 10] */
+template <typename T>
+__global__ void gen_random_kernel(T* __restrict__ array, size_t size, unsigned long long seed)
+{
+    size_t gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    array[gid] = gen_random_value<T>(seed, gid);
+}
+
+/*! \brief  Generate a random csr pattern: row lengths are balanced over the rows and the
+    column indices of each row are sampled from disjoint buckets, so they come out sorted
+    and free of duplicates without any further pass */
+template <typename T>
+__global__ void gen_csr_kernel(rocsparse_int* __restrict__ csr_row_ptr,
+                               rocsparse_int* __restrict__ csr_col_ind,
+                               T* __restrict__ csr_val,
+                               rocsparse_int        m,
+                               rocsparse_int        n,
+                               rocsparse_int        nnz,
+                               rocsparse_index_base idx_base,
+                               unsigned long long   seed)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int base = nnz / m;
+    rocsparse_int rem  = nnz % m;
+
+    rocsparse_int row_begin = row * base + min(row, rem);
+    rocsparse_int row_nnz   = base + (row < rem ? 1 : 0);
+
+    csr_row_ptr[row] = row_begin + idx_base;
+    if(row == m - 1)
+    {
+        csr_row_ptr[m] = nnz + idx_base;
+    }
+
+    for(rocsparse_int j = 0; j < row_nnz; ++j)
+    {
+        // Bucket [lo, hi) of the j-th entry of this row
+        rocsparse_int lo = static_cast<rocsparse_int>((long long)j * n / row_nnz);
+        rocsparse_int hi = static_cast<rocsparse_int>((long long)(j + 1) * n / row_nnz);
+
+        unsigned long long rng = gen_hash(seed ^ ((unsigned long long)(row_begin + j) << 1));
+
+        csr_col_ind[row_begin + j] = lo + static_cast<rocsparse_int>(rng % (hi - lo)) + idx_base;
+        csr_val[row_begin + j]     = gen_random_value<T>(seed, row_begin + j);
+    }
+}
+
+/*! \brief  Generate the 2D laplacian on the unit square in csr format; the row offsets
+    follow in closed form from the number of boundary rows preceding each grid point, so
+    every row is filled independently */
+template <typename T>
+__global__ void gen_2d_laplacian_kernel(rocsparse_int* __restrict__ csr_row_ptr,
+                                        rocsparse_int* __restrict__ csr_col_ind,
+                                        T* __restrict__ csr_val,
+                                        rocsparse_int        ndim,
+                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int n   = ndim * ndim;
+
+    if(idx >= n)
+    {
+        return;
+    }
+
+    rocsparse_int i = idx / ndim;
+    rocsparse_int j = idx % ndim;
+
+    // Number of missing neighbors in all rows preceding this one
+    rocsparse_int missing = min(idx, ndim) // upper boundary
+                            + i + (j > 0 ? 1 : 0) // left boundary
+                            + i // right boundary
+                            + (i == ndim - 1 ? j : 0); // lower boundary
+
+    rocsparse_int nnz = 5 * idx - missing;
+
+    csr_row_ptr[idx] = nnz + idx_base;
+    if(idx == n - 1)
+    {
+        csr_row_ptr[n] = 5 * n - 4 * ndim + idx_base;
+    }
+
+    // if no upper boundary element, connect with upper neighbor
+    if(i != 0)
+    {
+        csr_col_ind[nnz] = idx - ndim + idx_base;
+        csr_val[nnz]     = static_cast<T>(-1);
+        ++nnz;
+    }
+    // if no left boundary element, connect with left neighbor
+    if(j != 0)
+    {
+        csr_col_ind[nnz] = idx - 1 + idx_base;
+        csr_val[nnz]     = static_cast<T>(-1);
+        ++nnz;
+    }
+    // element itself
+    csr_col_ind[nnz] = idx + idx_base;
+    csr_val[nnz]     = static_cast<T>(4);
+    ++nnz;
+    // if no right boundary element, connect with right neighbor
+    if(j != ndim - 1)
+    {
+        csr_col_ind[nnz] = idx + 1 + idx_base;
+        csr_val[nnz]     = static_cast<T>(-1);
+    }
+    // if no lower boundary element, connect with lower neighbor
+    if(i != ndim - 1)
+    {
+        csr_col_ind[nnz + (j != ndim - 1 ? 1 : 0)] = idx + ndim + idx_base;
+        csr_val[nnz + (j != ndim - 1 ? 1 : 0)]     = static_cast<T>(-1);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Fill a device array with random values in [1, 10] */
+template <typename T>
+void rocsparse_init_device(T* array, size_t size, unsigned long long seed, hipStream_t stream = 0)
+{
+    hipLaunchKernelGGL((gen_random_kernel<T>),
+                       dim3((size + 255) / 256),
+                       dim3(256),
+                       0,
+                       stream,
+                       array,
+                       size,
+                       seed);
+}
+
+/* ============================================================================================ */
+/*! \brief  csr matrix initialization directly in device memory; the arrays must hold
+    m + 1 row offsets and nnz column indices and values, and nnz must not exceed m * n */
+template <typename T>
+void rocsparse_init_csr_device(rocsparse_int*       csr_row_ptr,
+                               rocsparse_int*       csr_col_ind,
+                               T*                   csr_val,
+                               rocsparse_int        m,
+                               rocsparse_int        n,
+                               rocsparse_int        nnz,
+                               rocsparse_index_base idx_base,
+                               unsigned long long   seed,
+                               hipStream_t          stream = 0)
+{
+    hipLaunchKernelGGL((gen_csr_kernel<T>),
+                       dim3((m + 255) / 256),
+                       dim3(256),
+                       0,
+                       stream,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       m,
+                       n,
+                       nnz,
+                       idx_base,
+                       seed);
+}
+
+/* ============================================================================================ */
+/*! \brief  Number of non-zeros of the 2D laplacian on a ndim x ndim grid, for sizing the
+    device arrays before the generator runs */
+static inline rocsparse_int gen_2d_laplacian_nnz(rocsparse_int ndim)
+{
+    return ndim * ndim * 5 - ndim * 4;
+}
+
+/*! \brief  Generate 2D laplacian on unit square in csr format directly in device memory */
+template <typename T>
+rocsparse_int gen_2d_laplacian_device(rocsparse_int        ndim,
+                                      rocsparse_int*       csr_row_ptr,
+                                      rocsparse_int*       csr_col_ind,
+                                      T*                   csr_val,
+                                      rocsparse_index_base idx_base,
+                                      hipStream_t          stream = 0)
+{
+    if(ndim == 0)
+    {
+        return 0;
+    }
+
+    rocsparse_int n = ndim * ndim;
+
+    hipLaunchKernelGGL((gen_2d_laplacian_kernel<T>),
+                       dim3((n + 255) / 256),
+                       dim3(256),
+                       0,
+                       stream,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       ndim,
+                       idx_base);
+
+    return n;
+}
+
+/* ============================================================================================ */
+/*  Device-side result verification: downloading full result matrices and comparing
+    element-by-element on the host dwarfs the kernel under test for large sizes. The
+    reduction below compares against a device resident reference and returns a single
+    scalar, so a correctness run costs one kernel and an eight byte download. */
+
+/*! \brief  Max-error reduction: every block writes its maximum of
+    |ref - res| / max(|ref| * tol_rel, tol_abs) to the workspace; zero tolerances select
+    the exact comparison, the scalar is the plain maximum absolute difference then */
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void unit_check_max_error_kernel(const T* __restrict__ ref,
+                                            const T* __restrict__ res,
+                                            size_t size,
+                                            double tol_rel,
+                                            double tol_abs,
+                                            double* __restrict__ workspace)
+{
+    __shared__ double sdata[BLOCKSIZE];
+
+    double err = 0.0;
+
+    for(size_t idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x; idx < size;
+        idx += hipGridDim_x * BLOCKSIZE)
+    {
+        double refv = static_cast<double>(ref[idx]);
+        double diff = fabs(refv - static_cast<double>(res[idx]));
+
+        double scale = (tol_abs > 0.0) ? max(fabs(refv) * tol_rel, tol_abs) : 1.0;
+
+        err = max(err, diff / scale);
+    }
+
+    sdata[hipThreadIdx_x] = err;
+    __syncthreads();
+
+    for(unsigned int i = BLOCKSIZE >> 1; i > 0; i >>= 1)
+    {
+        if(hipThreadIdx_x < i)
+        {
+            sdata[hipThreadIdx_x] = max(sdata[hipThreadIdx_x], sdata[hipThreadIdx_x + i]);
+        }
+        __syncthreads();
+    }
+
+    if(hipThreadIdx_x == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+/*! \brief  Maximum comparison error between two device arrays, see the kernel above for
+    the tolerance semantics */
+template <typename T>
+double unit_check_max_error_device(
+    size_t size, const T* dref, const T* dres, double tol_rel, double tol_abs)
+{
+    static constexpr unsigned int BLOCKSIZE = 256;
+    static constexpr unsigned int MAXBLOCKS = 512;
+
+    unsigned int nblocks = std::min((size + BLOCKSIZE - 1) / BLOCKSIZE, (size_t)MAXBLOCKS);
+
+    double* dworkspace;
+    CHECK_HIP_ERROR(hipMalloc((void**)&dworkspace, sizeof(double) * nblocks));
+
+    hipLaunchKernelGGL((unit_check_max_error_kernel<T, BLOCKSIZE>),
+                       dim3(nblocks),
+                       dim3(BLOCKSIZE),
+                       0,
+                       0,
+                       dref,
+                       dres,
+                       size,
+                       tol_rel,
+                       tol_abs,
+                       dworkspace);
+
+    std::vector<double> hworkspace(nblocks);
+    CHECK_HIP_ERROR(hipMemcpy(
+        hworkspace.data(), dworkspace, sizeof(double) * nblocks, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipFree(dworkspace));
+
+    double err = 0.0;
+    for(unsigned int i = 0; i < nblocks; ++i)
+    {
+        err = std::max(err, hworkspace[i]);
+    }
+
+    return err;
+}
+
+/*! \brief  Device-side counterpart of unit_check_general: both arrays must match exactly */
+template <typename T>
+void unit_check_general_device(size_t size, const T* dref, const T* dres)
+{
+    double err = unit_check_max_error_device(size, dref, dres, 0.0, 0.0);
+
+#ifdef GOOGLE_TEST
+    ASSERT_EQ(err, 0.0);
+#else
+    assert(err == 0.0);
+#endif
+}
+
+/*! \brief  Device-side counterpart of unit_check_near: the normalized error must stay
+    below one under the tolerances of the host check */
+template <typename T>
+void unit_check_near_device(size_t size, const T* dref, const T* dres)
+{
+    double tol_rel = (sizeof(T) == sizeof(float)) ? 1e-3 : 1e-10;
+    double tol_abs = 10.0 * std::numeric_limits<T>::epsilon();
+
+    double err = unit_check_max_error_device(size, dref, dres, tol_rel, tol_abs);
+
+#ifdef GOOGLE_TEST
+    ASSERT_LT(err, 1.0);
+#else
+    assert(err < 1.0);
+#endif
+}
+
+#endif // TESTING_UTILITY_DEVICE_HPP
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* End-to-end breadth-first search driver: every BFS level is one SpMV over
+ * the boolean semiring, emulated with csrmv on the transposed adjacency
+ * matrix
+ *
+ *     y <- A^T * x
+ *
+ * where x is the dense 0/1 frontier indicator. A vertex with y > 0 that has
+ * not been visited yet joins the next frontier. The frontier update runs on
+ * the host, so the measured iterations per second include the frontier
+ * round-trip that a level-synchronous deployment pays as well. The traversal
+ * rate is reported in MTEPS, millions of traversed edges per second. */
+
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+    // Parse command line
+    if(argc < 2)
+    {
+        fprintf(stderr, "%s <graph.mtx> [<source>]\n", argv[0]);
+        return -1;
+    }
+
+    const char*   filename = argv[1];
+    rocsparse_int source   = 0;
+
+    if(argc > 2)
+    {
+        source = atoi(argv[2]);
+    }
+
+    // rocSPARSE handle
+    rocsparse_handle handle;
+    rocsparse_create_handle(&handle);
+
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+
+    hipGetDevice(&device_id);
+    hipGetDeviceProperties(&devProp, device_id);
+    printf("Device: %s\n", devProp.name);
+
+    // Read the graph as an edge list
+    rocsparse_int              m;
+    rocsparse_int              n;
+    rocsparse_int              nnz;
+    std::vector<rocsparse_int> hrow;
+    std::vector<rocsparse_int> hcol;
+    std::vector<double>        hedge;
+
+    if(read_mtx_matrix(filename, m, n, nnz, hrow, hcol, hedge, rocsparse_index_base_zero) != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename);
+        return -1;
+    }
+
+    if(m != n)
+    {
+        fprintf(stderr, "BFS requires a square adjacency matrix, got %dx%d\n", m, n);
+        return -1;
+    }
+
+    if(source < 0 || source >= m)
+    {
+        fprintf(stderr, "Invalid source vertex %d\n", source);
+        return -1;
+    }
+
+    // Assemble the transposed adjacency matrix in CSR format with unit
+    // weights: row j holds the in-edges of vertex j, such that y = A^T * x
+    // gathers the out-neighbors of the frontier
+    std::vector<rocsparse_int> hAptr(m + 1, 0);
+    std::vector<rocsparse_int> hAcol(nnz);
+    std::vector<double>        hAval(nnz, 1.0);
+    std::vector<rocsparse_int> outdeg(m, 0);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++hAptr[hcol[i] + 1];
+        ++outdeg[hrow[i]];
+    }
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        hAptr[i + 1] += hAptr[i];
+    }
+
+    std::vector<rocsparse_int> shift(hAptr.begin(), hAptr.end() - 1);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        hAcol[shift[hcol[i]]++] = hrow[i];
+    }
+
+    // Matrix descriptor
+    rocsparse_mat_descr descrA;
+    rocsparse_create_mat_descr(&descrA);
+
+    // Offload data to device
+    rocsparse_int* dAptr = NULL;
+    rocsparse_int* dAcol = NULL;
+    double*        dAval = NULL;
+    double*        dx    = NULL;
+    double*        dy    = NULL;
+
+    hipMalloc((void**)&dAptr, sizeof(rocsparse_int) * (m + 1));
+    hipMalloc((void**)&dAcol, sizeof(rocsparse_int) * nnz);
+    hipMalloc((void**)&dAval, sizeof(double) * nnz);
+    hipMalloc((void**)&dx, sizeof(double) * m);
+    hipMalloc((void**)&dy, sizeof(double) * m);
+
+    hipMemcpy(dAptr, hAptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice);
+    hipMemcpy(dAcol, hAcol.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice);
+    hipMemcpy(dAval, hAval.data(), sizeof(double) * nnz, hipMemcpyHostToDevice);
+
+    // Frontier indicator and level array
+    std::vector<double>        hx(m, 0.0);
+    std::vector<double>        hy(m);
+    std::vector<rocsparse_int> level(m, -1);
+
+    hx[source]    = 1.0;
+    level[source] = 0;
+
+    hipMemcpy(dx, hx.data(), sizeof(double) * m, hipMemcpyHostToDevice);
+
+    printf("Running BFS over csrmv on %s: %d vertices, %d edges, source %d\n",
+           filename,
+           m,
+           nnz,
+           source);
+
+    double h_alpha = 1.0;
+    double h_beta  = 0.0;
+
+    rocsparse_int depth    = 0;
+    rocsparse_int visited  = 1;
+    rocsparse_int frontier = 1;
+    double        edges    = outdeg[source];
+
+    hipDeviceSynchronize();
+    double time = get_time_us();
+
+    while(frontier > 0)
+    {
+        // Expand the frontier along the out-edges
+        rocsparse_dcsrmv(handle,
+                         rocsparse_operation_none,
+                         m,
+                         m,
+                         nnz,
+                         &h_alpha,
+                         descrA,
+                         dAval,
+                         dAptr,
+                         dAcol,
+                         nullptr,
+                         dx,
+                         &h_beta,
+                         dy);
+
+        hipMemcpy(hy.data(), dy, sizeof(double) * m, hipMemcpyDeviceToHost);
+
+        // Unvisited vertices reached by the expansion form the next frontier
+        ++depth;
+        frontier = 0;
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            if(hy[i] != 0.0 && level[i] < 0)
+            {
+                level[i] = depth;
+                hx[i]    = 1.0;
+
+                ++frontier;
+                edges += outdeg[i];
+            }
+            else
+            {
+                hx[i] = 0.0;
+            }
+        }
+
+        visited += frontier;
+
+        if(frontier > 0)
+        {
+            hipMemcpy(dx, hx.data(), sizeof(double) * m, hipMemcpyHostToDevice);
+        }
+    }
+
+    hipDeviceSynchronize();
+    time = (get_time_us() - time) / 1e6;
+
+    printf("BFS finished at depth %d: %d of %d vertices visited, %0.3lf sec, "
+           "%0.1lf iterations/sec, %0.2lf MTEPS\n",
+           depth,
+           visited,
+           m,
+           time,
+           depth / time,
+           edges / time / 1e6);
+
+    // Clean up
+    hipFree(dAptr);
+    hipFree(dAcol);
+    hipFree(dAval);
+    hipFree(dx);
+    hipFree(dy);
+
+    rocsparse_destroy_mat_descr(descrA);
+    rocsparse_destroy_handle(handle);
+
+    return 0;
+}
@@ -0,0 +1,329 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/* End-to-end PageRank driver: the power iteration
+ *
+ *     r <- d * P^T * r + (1 - d + d * dangling) / n
+ *
+ * is run over csrmv or hybmv until the rank vector converges, measuring
+ * iterations per second rather than isolated SpMV time, so that vector reuse,
+ * the dangling node reduction and the convergence check are part of the
+ * number. P^T is the column-stochastic transition matrix of the graph,
+ * assembled on the host from a .mtx edge list. The rank mass of dangling
+ * vertices is gathered with doti over their index list and redistributed
+ * uniformly through the beta scaling of the SpMV. */
+
+#include "utility.hpp"
+
+#include <math.h>
+#include <rocsparse.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+    // Parse command line
+    if(argc < 2)
+    {
+        fprintf(stderr, "%s <graph.mtx> [<damping> <tol> <max_iter> <csr|hyb>]\n", argv[0]);
+        return -1;
+    }
+
+    const char* filename = argv[1];
+    double      damping  = 0.85;
+    double      tol      = 1e-6;
+    int         max_iter = 1000;
+    bool        use_hyb  = false;
+
+    if(argc > 2)
+    {
+        damping = atof(argv[2]);
+    }
+    if(argc > 3)
+    {
+        tol = atof(argv[3]);
+    }
+    if(argc > 4)
+    {
+        max_iter = atoi(argv[4]);
+    }
+    if(argc > 5)
+    {
+        use_hyb = (strcmp(argv[5], "hyb") == 0);
+    }
+
+    // rocSPARSE handle
+    rocsparse_handle handle;
+    rocsparse_create_handle(&handle);
+
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+
+    hipGetDevice(&device_id);
+    hipGetDeviceProperties(&devProp, device_id);
+    printf("Device: %s\n", devProp.name);
+
+    // Read the graph as an edge list
+    rocsparse_int              m;
+    rocsparse_int              n;
+    rocsparse_int              nnz;
+    std::vector<rocsparse_int> hrow;
+    std::vector<rocsparse_int> hcol;
+    std::vector<double>        hedge;
+
+    if(read_mtx_matrix(filename, m, n, nnz, hrow, hcol, hedge, rocsparse_index_base_zero) != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", filename);
+        return -1;
+    }
+
+    if(m != n)
+    {
+        fprintf(stderr, "PageRank requires a square adjacency matrix, got %dx%d\n", m, n);
+        return -1;
+    }
+
+    // Out-degree of every vertex and the list of dangling vertices, whose
+    // rank mass is redistributed uniformly
+    std::vector<rocsparse_int> outdeg(m, 0);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++outdeg[hrow[i]];
+    }
+
+    std::vector<rocsparse_int> hdangling;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        if(outdeg[i] == 0)
+        {
+            hdangling.push_back(i);
+        }
+    }
+    rocsparse_int ndangling = hdangling.size();
+
+    // Assemble the transposed transition matrix P^T in CSR format: row j
+    // holds the in-edges of vertex j, scaled by the inverse out-degree of
+    // their source
+    std::vector<rocsparse_int> hAptr(m + 1, 0);
+    std::vector<rocsparse_int> hAcol(nnz);
+    std::vector<double>        hAval(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++hAptr[hcol[i] + 1];
+    }
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        hAptr[i + 1] += hAptr[i];
+    }
+
+    std::vector<rocsparse_int> shift(hAptr.begin(), hAptr.end() - 1);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        rocsparse_int idx = shift[hcol[i]]++;
+
+        hAcol[idx] = hrow[i];
+        hAval[idx] = 1.0 / outdeg[hrow[i]];
+    }
+
+    // Matrix descriptor
+    rocsparse_mat_descr descrA;
+    rocsparse_create_mat_descr(&descrA);
+
+    // Offload data to device
+    rocsparse_int* dAptr     = NULL;
+    rocsparse_int* dAcol     = NULL;
+    double*        dAval     = NULL;
+    rocsparse_int* ddangling = NULL;
+    double*        ddangones = NULL;
+    double*        dones     = NULL;
+    double*        dr        = NULL;
+    double*        dy        = NULL;
+
+    hipMalloc((void**)&dAptr, sizeof(rocsparse_int) * (m + 1));
+    hipMalloc((void**)&dAcol, sizeof(rocsparse_int) * nnz);
+    hipMalloc((void**)&dAval, sizeof(double) * nnz);
+    hipMalloc((void**)&dones, sizeof(double) * m);
+    hipMalloc((void**)&dr, sizeof(double) * m);
+    hipMalloc((void**)&dy, sizeof(double) * m);
+
+    hipMemcpy(dAptr, hAptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice);
+    hipMemcpy(dAcol, hAcol.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice);
+    hipMemcpy(dAval, hAval.data(), sizeof(double) * nnz, hipMemcpyHostToDevice);
+
+    if(ndangling > 0)
+    {
+        std::vector<double> hdangones(ndangling, 1.0);
+
+        hipMalloc((void**)&ddangling, sizeof(rocsparse_int) * ndangling);
+        hipMalloc((void**)&ddangones, sizeof(double) * ndangling);
+
+        hipMemcpy(ddangling,
+                  hdangling.data(),
+                  sizeof(rocsparse_int) * ndangling,
+                  hipMemcpyHostToDevice);
+        hipMemcpy(ddangones, hdangones.data(), sizeof(double) * ndangling, hipMemcpyHostToDevice);
+    }
+
+    // Uniform initial rank and the all-ones vector carrying the teleport
+    // contribution through the beta scaling
+    std::vector<double> hr(m, 1.0 / m);
+    std::vector<double> hones(m, 1.0);
+
+    hipMemcpy(dr, hr.data(), sizeof(double) * m, hipMemcpyHostToDevice);
+    hipMemcpy(dones, hones.data(), sizeof(double) * m, hipMemcpyHostToDevice);
+
+    // Optionally convert to HYB format
+    rocsparse_hyb_mat hybA = NULL;
+    if(use_hyb)
+    {
+        rocsparse_create_hyb_mat(&hybA);
+        rocsparse_dcsr2hyb(
+            handle, m, m, descrA, dAval, dAptr, dAcol, hybA, 0, rocsparse_hyb_partition_auto);
+    }
+
+    printf("Running PageRank over %s on %s: %d vertices, %d edges, %d dangling\n",
+           use_hyb ? "hybmv" : "csrmv",
+           filename,
+           m,
+           nnz,
+           ndangling);
+
+    // Convergence is checked on the host every few iterations against the
+    // previously checked rank vector
+    const int           check_interval = 10;
+    std::vector<double> hr_prev(hr);
+
+    int    iter     = 0;
+    double residual = 1.0;
+
+    hipDeviceSynchronize();
+    double time = get_time_us();
+
+    while(iter < max_iter && residual > tol)
+    {
+        // Rank mass of the dangling vertices
+        double dangling_sum = 0.0;
+        if(ndangling > 0)
+        {
+            rocsparse_ddoti(handle,
+                            ndangling,
+                            ddangones,
+                            ddangling,
+                            dr,
+                            &dangling_sum,
+                            rocsparse_index_base_zero);
+        }
+
+        // Teleport contribution, entering through beta on the all-ones vector
+        double teleport = (1.0 - damping + damping * dangling_sum) / m;
+
+        hipMemcpy(dy, dones, sizeof(double) * m, hipMemcpyDeviceToDevice);
+
+        if(use_hyb)
+        {
+            rocsparse_dhybmv(handle,
+                             rocsparse_operation_none,
+                             &damping,
+                             descrA,
+                             hybA,
+                             dr,
+                             &teleport,
+                             dy);
+        }
+        else
+        {
+            rocsparse_dcsrmv(handle,
+                             rocsparse_operation_none,
+                             m,
+                             m,
+                             nnz,
+                             &damping,
+                             descrA,
+                             dAval,
+                             dAptr,
+                             dAcol,
+                             nullptr,
+                             dr,
+                             &teleport,
+                             dy);
+        }
+
+        // The new rank becomes the input of the next iteration
+        double* tmp = dr;
+        dr          = dy;
+        dy          = tmp;
+
+        ++iter;
+
+        if(iter % check_interval == 0)
+        {
+            hipMemcpy(hr.data(), dr, sizeof(double) * m, hipMemcpyDeviceToHost);
+
+            residual = 0.0;
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                residual += fabs(hr[i] - hr_prev[i]);
+            }
+
+            hr_prev = hr;
+        }
+    }
+
+    hipDeviceSynchronize();
+    time = (get_time_us() - time) / 1e6;
+
+    printf("PageRank %s after %d iterations: residual %0.2e, %0.3lf sec, "
+           "%0.1lf iterations/sec\n",
+           residual <= tol ? "converged" : "stopped",
+           iter,
+           residual,
+           time,
+           iter / time);
+
+    // Clean up
+    if(use_hyb)
+    {
+        rocsparse_destroy_hyb_mat(hybA);
+    }
+
+    hipFree(dAptr);
+    hipFree(dAcol);
+    hipFree(dAval);
+    hipFree(dones);
+    hipFree(dr);
+    hipFree(dy);
+
+    if(ndangling > 0)
+    {
+        hipFree(ddangling);
+        hipFree(ddangones);
+    }
+
+    rocsparse_destroy_mat_descr(descrA);
+    rocsparse_destroy_handle(handle);
+
+    return 0;
+}
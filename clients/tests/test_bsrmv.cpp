@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_bsrmv.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, int, double, double, base> bsrmv_tuple;
+typedef std::tuple<int, double, double, base, std::string> bsrmv_bin_tuple;
+
+int bsrmv_M_range[]        = {-1, 0, 500, 647};
+int bsrmv_N_range[]        = {-1, 0, 364, 523};
+int bsrmv_blockdim_range[] = {-1, 1, 3, 8, 17};
+
+double bsrmv_alpha_range[] = {2.0, 0.0};
+double bsrmv_beta_range[]  = {0.0, 1.0};
+
+base bsrmv_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+std::string bsrmv_bin[] = {"rma10.bin",
+                           "mac_econ_fwd500.bin",
+                           "mc2depi.bin",
+                           "scircuit.bin",
+                           "nos1.bin",
+                           "nos2.bin",
+                           "nos3.bin",
+                           "nos4.bin",
+                           "nos5.bin",
+                           "nos6.bin",
+                           "nos7.bin"};
+
+class parameterized_bsrmv : public testing::TestWithParam<bsrmv_tuple>
+{
+protected:
+    parameterized_bsrmv() {}
+    virtual ~parameterized_bsrmv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_bsrmv_bin : public testing::TestWithParam<bsrmv_bin_tuple>
+{
+protected:
+    parameterized_bsrmv_bin() {}
+    virtual ~parameterized_bsrmv_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_bsrmv_arguments(bsrmv_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.K        = std::get<2>(tup);
+    arg.alpha    = std::get<3>(tup);
+    arg.beta     = std::get<4>(tup);
+    arg.idx_base = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_bsrmv_arguments(bsrmv_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.N        = -99;
+    arg.K        = std::get<0>(tup);
+    arg.alpha    = std::get<1>(tup);
+    arg.beta     = std::get<2>(tup);
+    arg.idx_base = std::get<3>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<4>(tup);
+
+    // Get current executables absolute path
+    char    path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "../matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(bsrmv_bad_arg, bsrmv_float)
+{
+    testing_bsrmv_bad_arg<float>();
+}
+
+TEST_P(parameterized_bsrmv, bsrmv_float)
+{
+    Arguments arg = setup_bsrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_bsrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsrmv, bsrmv_double)
+{
+    Arguments arg = setup_bsrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_bsrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsrmv_bin, bsrmv_bin_float)
+{
+    Arguments arg = setup_bsrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_bsrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_bsrmv_bin, bsrmv_bin_double)
+{
+    Arguments arg = setup_bsrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_bsrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(bsrmv,
+                        parameterized_bsrmv,
+                        testing::Combine(testing::ValuesIn(bsrmv_M_range),
+                                         testing::ValuesIn(bsrmv_N_range),
+                                         testing::ValuesIn(bsrmv_blockdim_range),
+                                         testing::ValuesIn(bsrmv_alpha_range),
+                                         testing::ValuesIn(bsrmv_beta_range),
+                                         testing::ValuesIn(bsrmv_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(bsrmv_bin,
+                        parameterized_bsrmv_bin,
+                        testing::Combine(testing::Values(4, 8),
+                                         testing::Values(1.0),
+                                         testing::Values(0.0, 1.0),
+                                         testing::ValuesIn(bsrmv_idxbase_range),
+                                         testing::ValuesIn(bsrmv_bin)));
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_coo2csr_assemble.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+
+typedef std::tuple<int, int, rocsparse_index_base> coo2csr_assemble_tuple;
+
+int coo2csr_assemble_M_range[] = {-1, 0, 10, 500, 872};
+int coo2csr_assemble_N_range[] = {-3, 0, 33, 242, 623};
+
+rocsparse_index_base coo2csr_assemble_idx_base_range[]
+    = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_coo2csr_assemble : public testing::TestWithParam<coo2csr_assemble_tuple>
+{
+protected:
+    parameterized_coo2csr_assemble() {}
+    virtual ~parameterized_coo2csr_assemble() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_coo2csr_assemble_arguments(coo2csr_assemble_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(coo2csr_assemble_bad_arg, coo2csr_assemble_float)
+{
+    testing_coo2csr_assemble_bad_arg<float>();
+}
+
+TEST_P(parameterized_coo2csr_assemble, coo2csr_assemble_float)
+{
+    Arguments arg = setup_coo2csr_assemble_arguments(GetParam());
+
+    rocsparse_status status = testing_coo2csr_assemble<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_coo2csr_assemble, coo2csr_assemble_double)
+{
+    Arguments arg = setup_coo2csr_assemble_arguments(GetParam());
+
+    rocsparse_status status = testing_coo2csr_assemble<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(coo2csr_assemble,
+                        parameterized_coo2csr_assemble,
+                        testing::Combine(testing::ValuesIn(coo2csr_assemble_M_range),
+                                         testing::ValuesIn(coo2csr_assemble_N_range),
+                                         testing::ValuesIn(coo2csr_assemble_idx_base_range)));
@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrbicgstab.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+
+typedef std::tuple<int, base>         csrbicgstab_tuple;
+typedef std::tuple<base, std::string> csrbicgstab_bin_tuple;
+
+// Positive values are used as 2D laplacian dimension, such that the
+// generated matrix is symmetric positive definite
+int csrbicgstab_M_range[] = {-1, 0, 16, 42};
+
+base csrbicgstab_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+// Symmetric positive definite test matrices with moderate condition number
+std::string csrbicgstab_bin[] = {"nos3.bin", "nos4.bin", "nos5.bin"};
+
+class parameterized_csrbicgstab : public testing::TestWithParam<csrbicgstab_tuple>
+{
+protected:
+    parameterized_csrbicgstab() {}
+    virtual ~parameterized_csrbicgstab() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrbicgstab_bin : public testing::TestWithParam<csrbicgstab_bin_tuple>
+{
+protected:
+    parameterized_csrbicgstab_bin() {}
+    virtual ~parameterized_csrbicgstab_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrbicgstab_arguments(csrbicgstab_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.laplacian = arg.M > 0 ? arg.M : 0;
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csrbicgstab_arguments(csrbicgstab_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.idx_base = std::get<0>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<1>(tup);
+
+    // Get current executables absolute path
+    char    path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "../matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrbicgstab_bad_arg, csrbicgstab_float)
+{
+    testing_csrbicgstab_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrbicgstab, csrbicgstab_float)
+{
+    Arguments arg = setup_csrbicgstab_arguments(GetParam());
+
+    rocsparse_status status = testing_csrbicgstab<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrbicgstab, csrbicgstab_double)
+{
+    Arguments arg = setup_csrbicgstab_arguments(GetParam());
+
+    rocsparse_status status = testing_csrbicgstab<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrbicgstab_bin, csrbicgstab_bin_float)
+{
+    Arguments arg = setup_csrbicgstab_arguments(GetParam());
+
+    rocsparse_status status = testing_csrbicgstab<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrbicgstab_bin, csrbicgstab_bin_double)
+{
+    Arguments arg = setup_csrbicgstab_arguments(GetParam());
+
+    rocsparse_status status = testing_csrbicgstab<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrbicgstab,
+                        parameterized_csrbicgstab,
+                        testing::Combine(testing::ValuesIn(csrbicgstab_M_range),
+                                         testing::ValuesIn(csrbicgstab_idxbase_range)));
+
+INSTANTIATE_TEST_CASE_P(csrbicgstab_bin,
+                        parameterized_csrbicgstab_bin,
+                        testing::Combine(testing::ValuesIn(csrbicgstab_idxbase_range),
+                                         testing::ValuesIn(csrbicgstab_bin)));
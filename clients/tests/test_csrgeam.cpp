@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrgeam.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, double, double, base, base>    csrgeam_tuple;
+typedef std::tuple<double, double, base, base, std::string> csrgeam_bin_tuple;
+
+int csrgeam_M_range[] = {-1, 0, 50, 647};
+int csrgeam_N_range[] = {-1, 0, 13, 523};
+
+double csrgeam_alpha_range[] = {-1.0, 0.0, 2.7};
+double csrgeam_beta_range[]  = {-0.3, 0.0, 1.0};
+
+base csrgeam_idxbaseA_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+base csrgeam_idxbaseB_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+std::string csrgeam_bin[] = {"rma10.bin",
+                             "mac_econ_fwd500.bin",
+                             "mc2depi.bin",
+                             "scircuit.bin",
+                             "nos1.bin",
+                             "nos2.bin",
+                             "nos3.bin",
+                             "nos4.bin",
+                             "nos5.bin",
+                             "nos6.bin",
+                             "nos7.bin"};
+
+class parameterized_csrgeam : public testing::TestWithParam<csrgeam_tuple>
+{
+protected:
+    parameterized_csrgeam() {}
+    virtual ~parameterized_csrgeam() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrgeam_bin : public testing::TestWithParam<csrgeam_bin_tuple>
+{
+protected:
+    parameterized_csrgeam_bin() {}
+    virtual ~parameterized_csrgeam_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrgeam_arguments(csrgeam_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup);
+    arg.beta      = std::get<3>(tup);
+    arg.idx_base  = std::get<4>(tup);
+    arg.idx_base2 = std::get<5>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csrgeam_arguments(csrgeam_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = -99;
+    arg.alpha     = std::get<0>(tup);
+    arg.beta      = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.idx_base2 = std::get<3>(tup);
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<4>(tup);
+
+    // Get current executables absolute path
+    char    path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "../matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrgeam_bad_arg, csrgeam_float)
+{
+    testing_csrgeam_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrgeam, csrgeam_float)
+{
+    Arguments arg = setup_csrgeam_arguments(GetParam());
+
+    rocsparse_status status = testing_csrgeam<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrgeam, csrgeam_double)
+{
+    Arguments arg = setup_csrgeam_arguments(GetParam());
+
+    rocsparse_status status = testing_csrgeam<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrgeam_bin, csrgeam_bin_float)
+{
+    Arguments arg = setup_csrgeam_arguments(GetParam());
+
+    rocsparse_status status = testing_csrgeam<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrgeam_bin, csrgeam_bin_double)
+{
+    Arguments arg = setup_csrgeam_arguments(GetParam());
+
+    rocsparse_status status = testing_csrgeam<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrgeam,
+                        parameterized_csrgeam,
+                        testing::Combine(testing::ValuesIn(csrgeam_M_range),
+                                         testing::ValuesIn(csrgeam_N_range),
+                                         testing::ValuesIn(csrgeam_alpha_range),
+                                         testing::ValuesIn(csrgeam_beta_range),
+                                         testing::ValuesIn(csrgeam_idxbaseA_range),
+                                         testing::ValuesIn(csrgeam_idxbaseB_range)));
+
+INSTANTIATE_TEST_CASE_P(csrgeam_bin,
+                        parameterized_csrgeam_bin,
+                        testing::Combine(testing::Values(1.0, -0.5),
+                                         testing::Values(1.0, 0.0),
+                                         testing::ValuesIn(csrgeam_idxbaseA_range),
+                                         testing::ValuesIn(csrgeam_idxbaseB_range),
+                                         testing::ValuesIn(csrgeam_bin)));
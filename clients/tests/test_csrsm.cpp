@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrsm.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef rocsparse_diag_type  diag;
+typedef rocsparse_fill_mode  fill;
+
+typedef std::tuple<int, int, double, base, diag, fill>         csrsm_tuple;
+typedef std::tuple<int, double, base, diag, fill, std::string> csrsm_bin_tuple;
+
+int csrsm_M_range[]    = {-1, 0, 50, 647};
+int csrsm_nrhs_range[] = {-1, 0, 8, 27};
+
+double csrsm_alpha_range[] = {1.0, 2.7};
+
+base csrsm_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+diag csrsm_diag_range[]    = {rocsparse_diag_type_non_unit};
+fill csrsm_fill_range[]    = {rocsparse_fill_mode_lower, rocsparse_fill_mode_upper};
+
+std::string csrsm_bin[] = {"rma10.bin",
+                           "mac_econ_fwd500.bin",
+                           "mc2depi.bin",
+                           "scircuit.bin",
+                           "nos1.bin",
+                           "nos2.bin",
+                           "nos3.bin",
+                           "nos4.bin",
+                           "nos5.bin",
+                           "nos6.bin",
+                           "nos7.bin"};
+
+class parameterized_csrsm : public testing::TestWithParam<csrsm_tuple>
+{
+protected:
+    parameterized_csrsm() {}
+    virtual ~parameterized_csrsm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrsm_bin : public testing::TestWithParam<csrsm_bin_tuple>
+{
+protected:
+    parameterized_csrsm_bin() {}
+    virtual ~parameterized_csrsm_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrsm_arguments(csrsm_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup);
+    arg.idx_base  = std::get<3>(tup);
+    arg.diag_type = std::get<4>(tup);
+    arg.fill_mode = std::get<5>(tup);
+    arg.transA    = rocsparse_operation_none;
+    arg.timing    = 0;
+    return arg;
+}
+
+Arguments setup_csrsm_arguments(csrsm_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M         = -99;
+    arg.N         = std::get<0>(tup);
+    arg.alpha     = std::get<1>(tup);
+    arg.idx_base  = std::get<2>(tup);
+    arg.diag_type = std::get<3>(tup);
+    arg.fill_mode = std::get<4>(tup);
+    arg.transA    = rocsparse_operation_none;
+    arg.timing    = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<5>(tup);
+
+    // Get current executables absolute path
+    char    path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "../matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrsm_bad_arg, csrsm_float)
+{
+    testing_csrsm_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrsm, csrsm_float)
+{
+    Arguments arg = setup_csrsm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsm<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsm, csrsm_double)
+{
+    Arguments arg = setup_csrsm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsm<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsm_bin, csrsm_bin_float)
+{
+    Arguments arg = setup_csrsm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsm<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsm_bin, csrsm_bin_double)
+{
+    Arguments arg = setup_csrsm_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsm<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrsm,
+                        parameterized_csrsm,
+                        testing::Combine(testing::ValuesIn(csrsm_M_range),
+                                         testing::ValuesIn(csrsm_nrhs_range),
+                                         testing::ValuesIn(csrsm_alpha_range),
+                                         testing::ValuesIn(csrsm_idxbase_range),
+                                         testing::ValuesIn(csrsm_diag_range),
+                                         testing::ValuesIn(csrsm_fill_range)));
+
+INSTANTIATE_TEST_CASE_P(csrsm_bin,
+                        parameterized_csrsm_bin,
+                        testing::Combine(testing::Values(4, 19),
+                                         testing::Values(1.0),
+                                         testing::ValuesIn(csrsm_idxbase_range),
+                                         testing::ValuesIn(csrsm_diag_range),
+                                         testing::ValuesIn(csrsm_fill_range),
+                                         testing::ValuesIn(csrsm_bin)));
@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemmi.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, int, double, double, base> gemmi_tuple;
+
+int gemmi_M_range[] = {-1, 0, 42, 511};
+int gemmi_N_range[] = {-1, 0, 13, 339};
+int gemmi_K_range[] = {-1, 16, 50};
+
+double gemmi_alpha_range[] = {2.0, 0.0};
+double gemmi_beta_range[]  = {0.0, 0.67};
+
+base gemmi_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_gemmi : public testing::TestWithParam<gemmi_tuple>
+{
+protected:
+    parameterized_gemmi() {}
+    virtual ~parameterized_gemmi() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_gemmi_arguments(gemmi_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.K        = std::get<2>(tup);
+    arg.alpha    = std::get<3>(tup);
+    arg.beta     = std::get<4>(tup);
+    arg.idx_base = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(gemmi_bad_arg, gemmi_float)
+{
+    testing_gemmi_bad_arg<float>();
+}
+
+TEST_P(parameterized_gemmi, gemmi_float)
+{
+    Arguments arg = setup_gemmi_arguments(GetParam());
+
+    rocsparse_status status = testing_gemmi<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_gemmi, gemmi_double)
+{
+    Arguments arg = setup_gemmi_arguments(GetParam());
+
+    rocsparse_status status = testing_gemmi<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(gemmi,
+                        parameterized_gemmi,
+                        testing::Combine(testing::ValuesIn(gemmi_M_range),
+                                         testing::ValuesIn(gemmi_N_range),
+                                         testing::ValuesIn(gemmi_K_range),
+                                         testing::ValuesIn(gemmi_alpha_range),
+                                         testing::ValuesIn(gemmi_beta_range),
+                                         testing::ValuesIn(gemmi_idxbase_range)));
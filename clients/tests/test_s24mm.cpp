@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_s24mm.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+
+typedef std::tuple<int, int, int, double, double> s24mm_tuple;
+
+int s24mm_M_range[] = {-1, 0, 42, 511};
+int s24mm_N_range[] = {-1, 0, 13, 339};
+
+// 6 is rejected as it is not a multiple of the 2:4 group size
+int s24mm_K_range[] = {-1, 6, 16, 48};
+
+double s24mm_alpha_range[] = {2.0, 0.0};
+double s24mm_beta_range[]  = {0.0, 0.67};
+
+class parameterized_s24mm : public testing::TestWithParam<s24mm_tuple>
+{
+protected:
+    parameterized_s24mm() {}
+    virtual ~parameterized_s24mm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_s24mm_arguments(s24mm_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.N      = std::get<1>(tup);
+    arg.K      = std::get<2>(tup);
+    arg.alpha  = std::get<3>(tup);
+    arg.beta   = std::get<4>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+TEST(s24mm_bad_arg, s24mm_float)
+{
+    testing_s24mm_bad_arg<float>();
+}
+
+TEST_P(parameterized_s24mm, s24mm_float)
+{
+    Arguments arg = setup_s24mm_arguments(GetParam());
+
+    rocsparse_status status = testing_s24mm<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_s24mm, s24mm_double)
+{
+    Arguments arg = setup_s24mm_arguments(GetParam());
+
+    rocsparse_status status = testing_s24mm<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(s24mm,
+                        parameterized_s24mm,
+                        testing::Combine(testing::ValuesIn(s24mm_M_range),
+                                         testing::ValuesIn(s24mm_N_range),
+                                         testing::ValuesIn(s24mm_K_range),
+                                         testing::ValuesIn(s24mm_alpha_range),
+                                         testing::ValuesIn(s24mm_beta_range)));
@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_sddmm.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocsparse.h>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, int, double, double, base> sddmm_tuple;
+
+int sddmm_M_range[] = {-1, 0, 42, 511};
+int sddmm_N_range[] = {-1, 0, 13, 339};
+int sddmm_K_range[] = {-1, 16, 50};
+
+double sddmm_alpha_range[] = {2.0, 0.0};
+double sddmm_beta_range[]  = {0.0, 0.67};
+
+base sddmm_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_sddmm : public testing::TestWithParam<sddmm_tuple>
+{
+protected:
+    parameterized_sddmm() {}
+    virtual ~parameterized_sddmm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_sddmm_arguments(sddmm_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.K        = std::get<2>(tup);
+    arg.alpha    = std::get<3>(tup);
+    arg.beta     = std::get<4>(tup);
+    arg.idx_base = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(sddmm_bad_arg, sddmm_float)
+{
+    testing_sddmm_bad_arg<float>();
+}
+
+TEST_P(parameterized_sddmm, sddmm_float)
+{
+    Arguments arg = setup_sddmm_arguments(GetParam());
+
+    rocsparse_status status = testing_sddmm<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_sddmm, sddmm_double)
+{
+    Arguments arg = setup_sddmm_arguments(GetParam());
+
+    rocsparse_status status = testing_sddmm<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(sddmm,
+                        parameterized_sddmm,
+                        testing::Combine(testing::ValuesIn(sddmm_M_range),
+                                         testing::ValuesIn(sddmm_N_range),
+                                         testing::ValuesIn(sddmm_K_range),
+                                         testing::ValuesIn(sddmm_alpha_range),
+                                         testing::ValuesIn(sddmm_beta_range),
+                                         testing::ValuesIn(sddmm_idxbase_range)));
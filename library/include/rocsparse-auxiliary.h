@@ -74,6 +74,32 @@ rocsparse_status rocsparse_create_handle(rocsparse_handle* handle);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_handle(rocsparse_handle handle);
 
+/*! \ingroup aux_module
+ *  \brief Asynchronously preload the device code of frequently used kernels
+ *
+ *  \details
+ *  \p rocsparse_initialize starts loading and finalizing the device code objects
+ *  of the frequently used kernels for the device of the handle on a background
+ *  thread. Without it, the code objects are loaded lazily on first use, which
+ *  can stall the first library call for a substantial amount of time. Calling
+ *  \p rocsparse_initialize right after rocsparse_create_handle() overlaps this
+ *  cost with the remaining application startup, such that the first SpMV runs
+ *  at full speed. Kernels that are not preloaded continue to be loaded lazily
+ *  on first use.
+ *
+ *  \note
+ *  This function is non blocking. The preloading finishes in the background,
+ *  at the latest when the handle is destroyed.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_initialize(rocsparse_handle handle);
+
 /*! \ingroup aux_module
  *  \brief Specify user defined HIP stream
  *
@@ -173,6 +199,50 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify atomics mode
+ *
+ *  \details
+ *  \p rocsparse_set_atomics_mode specifies whether the rocSPARSE library context
+ *  may use atomic updates in subsequent function calls. By default, atomics are
+ *  allowed. With \ref rocsparse_atomics_not_allowed, routines that finalize
+ *  shared rows atomically, such as rocsparse_scoomv() and the adaptive path of
+ *  rocsparse_scsrmv(), run a deterministic, ordered fix-up pass instead and
+ *  produce bitwise identical results on every run, at a small performance
+ *  overhead.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  atomics_mode    the atomics mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_atomics_mode(rocsparse_handle       handle,
+                                            rocsparse_atomics_mode atomics_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current atomics mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_atomics_mode gets the rocSPARSE library context atomics mode
+ *  which is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  atomics_mode    the atomics mode that is currently used by the rocSPARSE
+ *                  library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_atomics_mode(rocsparse_handle        handle,
+                                            rocsparse_atomics_mode* atomics_mode);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -403,6 +473,107 @@ rocsparse_status rocsparse_set_mat_diag_type(rocsparse_mat_descr descr,
 ROCSPARSE_EXPORT
 rocsparse_diag_type rocsparse_get_mat_diag_type(const rocsparse_mat_descr descr);
 
+/*! \ingroup aux_module
+ *  \brief Restrict a matrix descriptor to a row range
+ *
+ *  \details
+ *  \p rocsparse_set_mat_row_range restricts subsequent operations using the
+ *  matrix descriptor to the rows [\p row_begin, \p row_end) of the sparse CSR
+ *  matrix. The view is zero-copy: the row pointer array keeps its absolute
+ *  offsets into the value and column index arrays, hence no matrix data is
+ *  moved or rewritten. This allows e.g. splitting an SpMV into an interior and
+ *  a boundary row range for computation/communication overlap in partitioned
+ *  solvers. Passing a negative \p row_end clears the view, such that the
+ *  descriptor covers the full matrix again.
+ *
+ *  \note
+ *  The row range is currently honored by the csrmv and csrmm routines of all
+ *  precisions, for \ref rocsparse_operation_none and
+ *  \ref rocsparse_matrix_type_general. Other routines using the descriptor
+ *  ignore the view.
+ *
+ *  @param[inout]
+ *  descr       the matrix descriptor.
+ *  @param[in]
+ *  row_begin   first row of the view.
+ *  @param[in]
+ *  row_end     one past the last row of the view, negative to clear the view.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p descr pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p row_begin is negative or
+ *          \p row_end is smaller than \p row_begin.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_mat_row_range(rocsparse_mat_descr descr,
+                                             rocsparse_int       row_begin,
+                                             rocsparse_int       row_end);
+
+/*! \ingroup aux_module
+ *  \brief Get the row range of a matrix descriptor
+ *
+ *  \details
+ *  \p rocsparse_get_mat_row_range returns the row range of the matrix
+ *  descriptor. If no view is set, \p row_begin is 0 and \p row_end is -1.
+ *
+ *  @param[in]
+ *  descr       the matrix descriptor.
+ *  @param[out]
+ *  row_begin   first row of the view.
+ *  @param[out]
+ *  row_end     one past the last row of the view, -1 if no view is set.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p row_begin or
+ *          \p row_end pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_mat_row_range(const rocsparse_mat_descr descr,
+                                             rocsparse_int*            row_begin,
+                                             rocsparse_int*            row_end);
+
+/*! \ingroup aux_module
+ *  \brief Specify whether the \p ELL storage of a matrix descriptor is pitched
+ *
+ *  \details
+ *  \p rocsparse_set_mat_ell_pitched enables or disables pitched \p ELL storage
+ *  for a matrix descriptor. In pitched mode, each column-major \p ELL slice is
+ *  padded to a pitch that is a multiple of 64 elements, such that slice starts
+ *  remain aligned to the memory channel interleave for odd row counts. The
+ *  elements between row \p m and the pitch are never accessed and need not be
+ *  initialized. \p ELL arrays of a pitched matrix must be allocated with
+ *  rocsparse_get_mat_ell_pitch() times the \p ELL width elements.
+ *
+ *  @param[inout]
+ *  descr       the matrix descriptor.
+ *  @param[in]
+ *  pitched     zero for tight \p ELL storage, non-zero for pitched storage.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p descr pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_mat_ell_pitched(rocsparse_mat_descr descr, rocsparse_int pitched);
+
+/*! \ingroup aux_module
+ *  \brief Get the \p ELL slice pitch of a matrix descriptor
+ *
+ *  \details
+ *  \p rocsparse_get_mat_ell_pitch returns the number of elements each
+ *  column-major \p ELL slice of a matrix with \p m rows occupies. For a tight
+ *  descriptor this equals \p m, for a pitched descriptor \p m is rounded up
+ *  to the next multiple of 64.
+ *
+ *  @param[in]
+ *  descr   the matrix descriptor.
+ *  @param[in]
+ *  m       number of rows of the sparse \p ELL matrix.
+ *
+ *  \returns the \p ELL slice pitch in elements.
+ */
+ROCSPARSE_EXPORT
+rocsparse_int rocsparse_get_mat_ell_pitch(const rocsparse_mat_descr descr, rocsparse_int m);
+
 /*! \ingroup aux_module
  *  \brief Create a \p HYB matrix structure
  *
@@ -436,37 +607,1037 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb);
 
 /*! \ingroup aux_module
- *  \brief Create a matrix info structure
+ *  \brief Create a \p BSR matrix structure
  *
  *  \details
- *  \p rocsparse_create_mat_info creates a structure that holds the matrix info data
- *  that is gathered during the analysis routines available. It should be destroyed
- *  at the end using rocsparse_destroy_mat_info().
+ *  \p rocsparse_create_bsr_mat creates a structure that holds the matrix in \p BSR
+ *  storage format. It should be destroyed at the end using rocsparse_destroy_bsr_mat().
  *
  *  @param[inout]
- *  info    the pointer to the info structure.
+ *  bsr the pointer to the BSR matrix.
  *
  *  \retval rocsparse_status_success the operation completed successfully.
- *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p bsr pointer is invalid.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
+rocsparse_status rocsparse_create_bsr_mat(rocsparse_bsr_mat* bsr);
 
 /*! \ingroup aux_module
- *  \brief Destroy a matrix info structure
+ *  \brief Destroy a \p BSR matrix structure
  *
  *  \details
- *  \p rocsparse_destroy_mat_info destroys a matrix info structure.
+ *  \p rocsparse_destroy_bsr_mat destroys a \p BSR structure.
  *
  *  @param[in]
- *  info    the info structure.
+ *  bsr the BSR matrix structure.
  *
  *  \retval rocsparse_status_success the operation completed successfully.
- *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p bsr pointer is invalid.
  *  \retval rocsparse_status_internal_error an internal error occurred.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
+rocsparse_status rocsparse_destroy_bsr_mat(rocsparse_bsr_mat bsr);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p DCSR matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_dcsr_mat creates a structure that holds the matrix in \p DCSR
+ *  storage format. It should be destroyed at the end using
+ *  rocsparse_destroy_dcsr_mat().
+ *
+ *  @param[inout]
+ *  dcsr the pointer to the DCSR matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p dcsr pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_dcsr_mat(rocsparse_dcsr_mat* dcsr);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p DCSR matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_dcsr_mat destroys a \p DCSR structure.
+ *
+ *  @param[in]
+ *  dcsr the DCSR matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p dcsr pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_dcsr_mat(rocsparse_dcsr_mat dcsr);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p SELL matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_sell_mat creates a structure that holds the matrix in
+ *  \p SELL-C-sigma storage format. It should be destroyed at the end using
+ *  rocsparse_destroy_sell_mat().
+ *
+ *  @param[inout]
+ *  sell the pointer to the SELL matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p sell pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_sell_mat(rocsparse_sell_mat* sell);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p SELL matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_sell_mat destroys a \p SELL structure.
+ *
+ *  @param[in]
+ *  sell the SELL matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p sell pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_sell_mat(rocsparse_sell_mat sell);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p DIST matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_dist_mat creates a structure that holds a matrix partitioned
+ *  by rows across multiple devices. It should be destroyed at the end using
+ *  rocsparse_destroy_dist_mat().
+ *
+ *  @param[inout]
+ *  dist the pointer to the distributed matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p dist pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_dist_mat(rocsparse_dist_mat* dist);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p DIST matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_dist_mat destroys a \p DIST structure, releasing the
+ *  partitions on their owning devices.
+ *
+ *  @param[in]
+ *  dist the distributed matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p dist pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_dist_mat(rocsparse_dist_mat dist);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p SPLIT matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_split_mat creates a structure that holds a matrix split
+ *  by rows between the device and the host. It should be destroyed at the end
+ *  using rocsparse_destroy_split_mat().
+ *
+ *  @param[inout]
+ *  split the pointer to the split matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p split pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_split_mat(rocsparse_split_mat* split);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p SPLIT matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_split_mat destroys a \p SPLIT structure, releasing the
+ *  device partition and the host resident arrays.
+ *
+ *  @param[in]
+ *  split the split matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p split pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_split_mat(rocsparse_split_mat split);
+
+/*! \ingroup aux_module
+ *  \brief Allocate padded and aligned CSR matrix arrays
+ *
+ *  \details
+ *  \p rocsparse_csr_malloc allocates the three arrays of a sparse CSR matrix
+ *  with the padding and alignment the vectorized kernels expect. The value
+ *  and column index arrays are padded to the next wavefront multiple of the
+ *  device and the padding is zero filled, such that wavefront wide vector
+ *  loads never run past the allocation, and the allocation sizes are rounded
+ *  up to the texture alignment of the device. The first \p nnz entries are
+ *  filled by the caller as usual, the padding must be left untouched. The
+ *  arrays are released with hipFree().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  val_size    size of one matrix value in bytes.
+ *  @param[out]
+ *  csr_row_ptr pointer to the array of \p m+1 row pointers.
+ *  @param[out]
+ *  csr_col_ind pointer to the padded column index array.
+ *  @param[out]
+ *  csr_val     pointer to the padded value array.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not
+ *          initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p nnz or \p val_size is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *          \p csr_val pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_malloc(rocsparse_handle handle,
+                                      rocsparse_int    m,
+                                      rocsparse_int    nnz,
+                                      size_t           val_size,
+                                      rocsparse_int**  csr_row_ptr,
+                                      rocsparse_int**  csr_col_ind,
+                                      void**           csr_val);
+
+/*! \ingroup aux_module
+ *  \brief Allocate padded and aligned ELL matrix arrays
+ *
+ *  \details
+ *  \p rocsparse_ell_malloc allocates the two arrays of a sparse ELL matrix
+ *  with the padding and alignment the vectorized kernels expect, analogous to
+ *  rocsparse_csr_malloc(). The arrays hold \p m times \p ell_width entries,
+ *  padded to the next wavefront multiple of the device with a zero filled
+ *  tail, and the allocation sizes are rounded up to the texture alignment of
+ *  the device. The arrays are released with hipFree().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse ELL matrix.
+ *  @param[in]
+ *  ell_width   number of non-zero entries per row of the sparse ELL matrix.
+ *  @param[in]
+ *  val_size    size of one matrix value in bytes.
+ *  @param[out]
+ *  ell_col_ind pointer to the padded column index array.
+ *  @param[out]
+ *  ell_val     pointer to the padded value array.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not
+ *          initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p ell_width or \p val_size is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_pointer \p ell_col_ind or \p ell_val
+ *          pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ell_malloc(rocsparse_handle handle,
+                                      rocsparse_int    m,
+                                      rocsparse_int    ell_width,
+                                      size_t           val_size,
+                                      rocsparse_int**  ell_col_ind,
+                                      void**           ell_val);
+
+/*! \ingroup aux_module
+ *  \brief Create a CSR builder structure
+ *
+ *  \details
+ *  \p rocsparse_create_csr_builder creates a structure that holds a sparse
+ *  matrix under incremental construction. Row batches are appended using e.g.
+ *  rocsparse_scsr_builder_append() and the accumulated matrix is compacted
+ *  into CSR storage using e.g. rocsparse_scsr_builder_finalize(). It should
+ *  be destroyed at the end using rocsparse_destroy_csr_builder().
+ *
+ *  @param[inout]
+ *  builder the pointer to the CSR builder.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p builder pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_csr_builder(rocsparse_csr_builder* builder);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a CSR builder structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_csr_builder destroys a CSR builder structure,
+ *  releasing the accumulated device storage.
+ *
+ *  @param[in]
+ *  builder the CSR builder structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p builder pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_csr_builder(rocsparse_csr_builder builder);
+
+/*! \ingroup aux_module
+ *  \brief Create a generic API sparse matrix descriptor in CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_create_csr_descr creates a generic API descriptor of a sparse
+ *  matrix in CSR storage format, holding its dimensions, data type and array
+ *  pointers. The descriptor is passed to the generic routines, e.g.
+ *  rocsparse_spmv(), which dispatch on the storage format and the data type
+ *  at runtime. It should be destroyed at the end using
+ *  rocsparse_destroy_spmat_descr().
+ *
+ *  @param[out]
+ *  descr       the pointer to the sparse matrix descriptor.
+ *  @param[in]
+ *  rows        number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  cols        number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p rows+1 elements that point to the start of every
+ *              row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, typed
+ *              according to \p data_type.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[in]
+ *  data_type   \ref rocsparse_datatype of the matrix values.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *          \p csr_col_ind or \p csr_val pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p rows, \p cols or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_value \p idx_base or \p data_type is
+ *          invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_csr_descr(rocsparse_spmat_descr* descr,
+                                            rocsparse_int          rows,
+                                            rocsparse_int          cols,
+                                            rocsparse_int          nnz,
+                                            void*                  csr_row_ptr,
+                                            void*                  csr_col_ind,
+                                            void*                  csr_val,
+                                            rocsparse_index_base   idx_base,
+                                            rocsparse_datatype     data_type);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a generic API sparse matrix descriptor
+ *
+ *  \details
+ *  \p rocsparse_destroy_spmat_descr destroys a generic API sparse matrix
+ *  descriptor, releasing all analysis meta data gathered on the matrix. The
+ *  user provided arrays are not touched.
+ *
+ *  @param[in]
+ *  descr   the sparse matrix descriptor.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p descr pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_spmat_descr(rocsparse_spmat_descr descr);
+
+/*! \ingroup aux_module
+ *  \brief Create a generic API dense vector descriptor
+ *
+ *  \details
+ *  \p rocsparse_create_dnvec_descr creates a generic API descriptor of a dense
+ *  vector, holding its size, data type and array pointer. It should be
+ *  destroyed at the end using rocsparse_destroy_dnvec_descr().
+ *
+ *  @param[out]
+ *  descr     the pointer to the dense vector descriptor.
+ *  @param[in]
+ *  size      number of elements of the dense vector.
+ *  @param[in]
+ *  values    array of \p size elements, typed according to \p data_type.
+ *  @param[in]
+ *  data_type \ref rocsparse_datatype of the vector values.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p descr or \p values pointer is
+ *          invalid.
+ *  \retval rocsparse_status_invalid_size \p size is invalid.
+ *  \retval rocsparse_status_invalid_value \p data_type is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_dnvec_descr(rocsparse_dnvec_descr* descr,
+                                              rocsparse_int          size,
+                                              void*                  values,
+                                              rocsparse_datatype     data_type);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a generic API dense vector descriptor
+ *
+ *  \details
+ *  \p rocsparse_destroy_dnvec_descr destroys a generic API dense vector
+ *  descriptor. The user provided array is not touched.
+ *
+ *  @param[in]
+ *  descr   the dense vector descriptor.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_dnvec_descr(rocsparse_dnvec_descr descr);
+
+/*! \ingroup aux_module
+ *  \brief Create a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_create_mat_info creates a structure that holds the matrix info data
+ *  that is gathered during the analysis routines available. It should be destroyed
+ *  at the end using rocsparse_destroy_mat_info().
+ *
+ *  @param[inout]
+ *  info    the pointer to the info structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_mat_info destroys a matrix info structure.
+ *
+ *  @param[in]
+ *  info    the info structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
+
+/*! \ingroup aux_module
+ *  \brief Query the serialized size of the analysis meta data of a matrix info
+ *
+ *  \details
+ *  \p rocsparse_mat_info_serialize_size returns the number of bytes a call to
+ *  rocsparse_mat_info_serialize() will write for \p info. The size covers the
+ *  csrmv, csrsv, csrilu0 and csric0 analysis meta data currently attached to
+ *  \p info.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  info    the info structure.
+ *  @param[out]
+ *  size    number of bytes of the serialized meta data.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p info or \p size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_serialize_size(rocsparse_handle   handle,
+                                                   rocsparse_mat_info info,
+                                                   size_t*            size);
+
+/*! \ingroup aux_module
+ *  \brief Serialize the analysis meta data of a matrix info into a host buffer
+ *
+ *  \details
+ *  \p rocsparse_mat_info_serialize copies the csrmv, csrsv, csrilu0 and csric0
+ *  analysis meta data attached to \p info into the user provided host buffer,
+ *  from where it can be written next to the matrix files. A later process
+ *  operating on the same matrix can re-create the meta data with
+ *  rocsparse_mat_info_deserialize() without re-running the analysis routines.
+ *  \p buffer must hold at least rocsparse_mat_info_serialize_size() bytes.
+ *
+ *  The blob is tied to the build configuration and the wavefront size of the
+ *  device the analysis was run on, it is rejected on mismatch when loading.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  info    the info structure.
+ *  @param[out]
+ *  buffer  host buffer receiving the serialized meta data.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p info or \p buffer pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_serialize(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              void*              buffer);
+
+/*! \ingroup aux_module
+ *  \brief Re-create the analysis meta data of a matrix info from a host buffer
+ *
+ *  \details
+ *  \p rocsparse_mat_info_deserialize loads a blob written by
+ *  rocsparse_mat_info_serialize() into \p info, uploading the device resident
+ *  arrays with a single copy per array. \p info must not carry analysis
+ *  results yet. The caller is responsible for passing the meta data only to
+ *  routines operating on the matrix it was analyzed for, this is not
+ *  verified.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[inout]
+ *  info    the info structure.
+ *  @param[in]
+ *  buffer  host buffer holding the serialized meta data.
+ *  @param[in]
+ *  size    number of bytes of \p buffer.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p info or \p buffer pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p size is too small for the blob.
+ *  \retval rocsparse_status_invalid_value the blob is malformed or was written
+ *          by an incompatible build or device.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_deserialize(rocsparse_handle   handle,
+                                                rocsparse_mat_info info,
+                                                const void*        buffer,
+                                                size_t             size);
+
+/*! \ingroup aux_module
+ *  \brief Query the dimensions of a binary CSR matrix container
+ *
+ *  \details
+ *  \p rocsparse_read_bin_csr_size reads the header of a rocSPARSE binary CSR
+ *  container and returns the matrix dimensions, such that the device arrays
+ *  for rocsparse_sread_bin_csr() can be allocated.
+ *
+ *  The container starts with a 40 byte header, holding the 8 byte magic
+ *  string "rocSPbin", a 32 bit version (currently 1), 32 reserved bits and
+ *  the number of rows, columns and non-zeros as \p int64_t. The header is
+ *  followed by \p nrow+1 zero based CSR row offsets and \p nnz column
+ *  indices, both \p int64_t, and \p nnz matrix values stored as \p double.
+ *  The rocSPARSE clients write this container next to parsed mtx files.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  filename    path of the binary CSR container.
+ *  @param[out]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[out]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[out]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p filename, \p m, \p n or \p nnz
+ *          pointer is invalid.
+ *  \retval rocsparse_status_invalid_size the matrix dimensions overflow
+ *          \ref rocsparse_int.
+ *  \retval rocsparse_status_invalid_value the container is malformed or was
+ *          written by an incompatible version.
+ *  \retval rocsparse_status_internal_error the file could not be read.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_read_bin_csr_size(rocsparse_handle handle,
+                                             const char*      filename,
+                                             rocsparse_int*   m,
+                                             rocsparse_int*   n,
+                                             rocsparse_int*   nnz);
+
+/*! \ingroup aux_module
+ *  \brief Load a binary CSR matrix container directly into device memory
+ *
+ *  \details
+ *  \p rocsparse_Xread_bin_csr loads a rocSPARSE binary CSR container, see
+ *  rocsparse_read_bin_csr_size() for the file layout, into the user allocated
+ *  device arrays. The file is mapped into memory and converted chunk by chunk
+ *  in pinned staging buffers, from where it is copied asynchronously on the
+ *  stream of the handle, such that the disk reads overlap with the transfers
+ *  over the interconnect and no intermediate host copy of the matrix is
+ *  built. The indices are converted to the index base of \p descr, the
+ *  values to the requested precision.
+ *
+ *  \p m, \p n and \p nnz must match the container, as returned by
+ *  rocsparse_read_bin_csr_size().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  filename    path of the binary CSR container.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p filename, \p descr,
+ *          \p csr_val, \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid or
+ *          does not match the container.
+ *  \retval rocsparse_status_invalid_value the container is malformed or was
+ *          written by an incompatible version.
+ *  \retval rocsparse_status_internal_error the file could not be read.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sread_bin_csr(rocsparse_handle          handle,
+                                         const char*               filename,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         float*                    csr_val,
+                                         rocsparse_int*            csr_row_ptr,
+                                         rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dread_bin_csr(rocsparse_handle          handle,
+                                         const char*               filename,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         double*                   csr_val,
+                                         rocsparse_int*            csr_row_ptr,
+                                         rocsparse_int*            csr_col_ind);
+/**@}*/
+
+/*! \ingroup aux_module
+ *  \brief Upload a host CSR matrix to the device through a pipelined
+ *  staging ring
+ *
+ *  \details
+ *  \p rocsparse_Xupload_csr copies the host CSR arrays \p host_row_ptr,
+ *  \p host_col_ind and \p host_val into the user allocated device arrays.
+ *  Instead of three sequential copies, the arrays are cut into chunks and
+ *  pipelined through a pinned staging ring owned by the handle, such that
+ *  filling one chunk overlaps with the device transfer of the previous one
+ *  and the interconnect stays busy across the array boundaries. If the
+ *  index base of \p descr differs from \p host_base, the index shift is
+ *  fused into the staging pass, so the conversion is hidden behind the
+ *  transfers.
+ *
+ *  \note
+ *  This function is non blocking with respect to the device. The host
+ *  arrays are fully consumed on return and can be modified or freed, the
+ *  device arrays are valid once the stream has been synchronized.
+ *
+ *  @param[in]
+ *  handle       the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  m            number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz          number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr        descriptor of the sparse CSR matrix, its index base is the
+ *               base of the uploaded device arrays.
+ *  @param[in]
+ *  host_val     host array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  host_row_ptr host array of \p m+1 elements that point to the start of
+ *               every row of the sparse CSR matrix.
+ *  @param[in]
+ *  host_col_ind host array of \p nnz elements containing the column indices
+ *               of the sparse CSR matrix.
+ *  @param[in]
+ *  host_base    index base of the host arrays.
+ *  @param[out]
+ *  csr_val      device array of \p nnz elements of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_row_ptr  device array of \p m+1 elements that point to the start of
+ *               every row of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_col_ind  device array of \p nnz elements containing the column
+ *               indices of the sparse CSR matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p host_val,
+ *          \p host_row_ptr, \p host_col_ind, \p csr_val, \p csr_row_ptr or
+ *          \p csr_col_ind pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_value \p host_base is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_supload_csr(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              host_val,
+                                       const rocsparse_int*      host_row_ptr,
+                                       const rocsparse_int*      host_col_ind,
+                                       rocsparse_index_base      host_base,
+                                       float*                    csr_val,
+                                       rocsparse_int*            csr_row_ptr,
+                                       rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dupload_csr(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             host_val,
+                                       const rocsparse_int*      host_row_ptr,
+                                       const rocsparse_int*      host_col_ind,
+                                       rocsparse_index_base      host_base,
+                                       double*                   csr_val,
+                                       rocsparse_int*            csr_row_ptr,
+                                       rocsparse_int*            csr_col_ind);
+/**@}*/
+
+/*! \ingroup aux_module
+ *  \brief Stage a host array for device access, by copy or zero-copy
+ *
+ *  \details
+ *  \p rocsparse_stage_host_buffer makes the host array \p host_ptr accessible
+ *  to the device and returns a device pointer for it in \p dev_ptr, which can
+ *  be passed to any rocSPARSE routine in place of a device array. Depending
+ *  on \p size and \p expected_reuse, the array is either copied into a newly
+ *  allocated device buffer, or registered with the runtime such that the
+ *  kernels stream it over the interconnect without staging a device copy.
+ *  The zero-copy path is selected for large arrays that are read only once
+ *  or twice, e.g. the csr arrays of a matrix multiplied a single time, where
+ *  a copy would move the same bytes over the interconnect and additionally
+ *  consume device memory.
+ *
+ *  \p host_ptr must remain valid and unmodified until
+ *  rocsparse_unstage_host_buffer() is called. \p expected_reuse is the
+ *  number of operations the caller expects to read the array, values less
+ *  than one are treated as one.
+ *
+ *  @param[in]
+ *  handle          the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  size            number of bytes of the host array.
+ *  @param[in]
+ *  expected_reuse  expected number of operations reading the array.
+ *  @param[in]
+ *  host_ptr        host array to stage.
+ *  @param[out]
+ *  dev_ptr         device pointer under which the array is accessible.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p host_ptr or \p dev_ptr pointer
+ *          is invalid.
+ *  \retval rocsparse_status_invalid_size \p size is invalid.
+ *  \retval rocsparse_status_memory_error the buffer could not be allocated or
+ *          registered.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_stage_host_buffer(rocsparse_handle handle,
+                                             size_t           size,
+                                             rocsparse_int    expected_reuse,
+                                             void*            host_ptr,
+                                             void**           dev_ptr);
+
+/*! \ingroup aux_module
+ *  \brief Release a host array staged with rocsparse_stage_host_buffer()
+ *
+ *  \details
+ *  \p rocsparse_unstage_host_buffer releases the device access to a host
+ *  array staged with rocsparse_stage_host_buffer(), freeing the device copy
+ *  or unregistering the host memory, whichever the staging selected. All
+ *  operations reading \p dev_ptr must have completed.
+ *
+ *  @param[in]
+ *  handle    the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  host_ptr  the staged host array.
+ *  @param[in]
+ *  dev_ptr   the device pointer returned by the staging.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p host_ptr or \p dev_ptr pointer
+ *          is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_unstage_host_buffer(rocsparse_handle handle,
+                                               void*            host_ptr,
+                                               void*            dev_ptr);
+
+/*! \ingroup aux_module
+ *  \brief Snapshot the per-routine profiling table
+ *
+ *  \details
+ *  \p rocsparse_profile_snapshot copies the current contents of the per-routine
+ *  profiling table into the user provided array of
+ *  \ref rocsparse_profile_entry structures. If \p entries is \p NULL, only the
+ *  number of table entries is returned in \p num_entries. Otherwise, at most
+ *  \p num_entries entries are copied and \p num_entries is updated with the
+ *  number of entries written. Profiling is enabled by setting the
+ *  \ref rocsparse_layer_mode_log_profile bit in the \p ROCSPARSE_LAYER
+ *  environment variable.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[inout]
+ *  num_entries number of entries that fit into \p entries, overwritten by the
+ *              number of entries returned.
+ *  @param[out]
+ *  entries     array of at least \p num_entries profile entries, can be
+ *              \p NULL to query the table size.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p num_entries pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_profile_snapshot(rocsparse_handle         handle,
+                                            rocsparse_int*           num_entries,
+                                            rocsparse_profile_entry* entries);
+
+/*! \ingroup aux_module
+ *  \brief Reset the per-routine profiling table
+ *
+ *  \details
+ *  \p rocsparse_profile_reset clears all entries of the per-routine profiling
+ *  table, such that a new measurement interval can be started.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_profile_reset(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Snapshot the temporary device memory accounting of the handle
+ *
+ *  \details
+ *  \p rocsparse_memory_snapshot returns the number of bytes of temporary
+ *  device memory currently allocated by the library on behalf of \p handle in
+ *  \p in_use, the largest number of bytes that were allocated simultaneously
+ *  since handle creation or the last call to rocsparse_memory_reset() in
+ *  \p peak, and the current size of the handle internal device buffer that
+ *  serves these allocations in \p buffer_size. User provided buffers, e.g.
+ *  the \p temp_buffer arguments of the analysis routines, are not included.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  in_use      bytes of temporary device memory currently allocated.
+ *  @param[out]
+ *  peak        peak bytes of temporary device memory allocated simultaneously.
+ *  @param[out]
+ *  buffer_size size of the handle internal device buffer in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p in_use, \p peak or
+ *          \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_memory_snapshot(rocsparse_handle handle,
+                                           size_t*          in_use,
+                                           size_t*          peak,
+                                           size_t*          buffer_size);
+
+/*! \ingroup aux_module
+ *  \brief Reset the temporary device memory peak of the handle
+ *
+ *  \details
+ *  \p rocsparse_memory_reset resets the peak returned by
+ *  rocsparse_memory_snapshot() to the currently allocated number of bytes,
+ *  such that a new measurement interval can be started.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_memory_reset(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Open a group of data independent calls that may execute concurrently
+ *
+ *  \details
+ *  \p rocsparse_concurrent_begin marks the begin of a group of library calls
+ *  that are data independent of each other and may therefore execute
+ *  concurrently on the device. Inside the group, the calls are distributed
+ *  across a pool of streams owned by the handle, rocsparse_concurrent_branch()
+ *  switches to the next stream of the pool. Small kernels that individually
+ *  cannot fill the device, e.g. the lower and upper triangular solves of a
+ *  preconditioner, overlap this way. All required events are inserted
+ *  automatically: the group is ordered behind all work previously enqueued to
+ *  the handle stream, and the handle stream is ordered behind the whole group
+ *  once rocsparse_concurrent_end() is called.
+ *
+ *  The caller is responsible for the data independence of the grouped calls,
+ *  including their caller provided temporary buffers. Temporary memory that
+ *  the library allocates internally is partitioned per pool stream, each
+ *  stream of the group operates on its own scratch buffer. Groups cannot be
+ *  nested.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  \par Example
+ *  Overlapping the two triangular solves of an incomplete LU preconditioner:
+ *  \code{.c}
+ *      rocsparse_concurrent_begin(handle);
+ *      rocsparse_dcsrsv_solve(handle, ..., descr_L, ..., buffer_L);
+ *      rocsparse_concurrent_branch(handle);
+ *      rocsparse_dcsrsv_solve(handle, ..., descr_U, ..., buffer_U);
+ *      rocsparse_concurrent_end(handle);
+ *  \endcode
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value a group is already open.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_concurrent_begin(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Switch the open concurrent group to the next stream of the pool
+ *
+ *  \details
+ *  \p rocsparse_concurrent_branch switches the group opened by
+ *  rocsparse_concurrent_begin() to the next stream of the handle stream pool.
+ *  Calls issued after the branch execute concurrently with the calls issued
+ *  before it. Branching more often than the pool has streams cycles through
+ *  the pool, serializing onto already used streams.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value no group is open.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_concurrent_branch(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Close a group of concurrent calls
+ *
+ *  \details
+ *  \p rocsparse_concurrent_end closes the group opened by
+ *  rocsparse_concurrent_begin() and restores the handle stream. Work enqueued
+ *  to the handle stream afterwards is ordered behind all calls of the group.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value no group is open.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_concurrent_end(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Open a section of latency critical calls on a high priority stream
+ *
+ *  \details
+ *  \p rocsparse_priority_begin swaps the handle stream to a side stream
+ *  created with the greatest priority the device offers, such that the calls
+ *  issued inside the section are scheduled ahead of long running kernels
+ *  queued on the user stream. This cuts the tail latency of small must-finish
+ *  calls, e.g. a tiny triangular solve, that would otherwise queue behind
+ *  multi-millisecond kernels on a shared stream.
+ *
+ *  The section is deliberately not ordered behind the work in flight on the
+ *  user stream, the caller guarantees that the calls inside the section are
+ *  data independent of it. The user stream is ordered behind the whole
+ *  section once rocsparse_priority_end() is called, such that subsequent
+ *  consumers of the results are safe. Sections cannot be nested.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  \par Example
+ *  Running a small solve ahead of a queued SpMM:
+ *  \code{.c}
+ *      rocsparse_dcsrmm(handle, ...);
+ *      rocsparse_priority_begin(handle);
+ *      rocsparse_dcsrsv_solve(handle, ..., buffer);
+ *      rocsparse_priority_end(handle);
+ *  \endcode
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value a section is already open.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_priority_begin(rocsparse_handle handle);
+
+/*! \ingroup aux_module
+ *  \brief Close a section of latency critical calls
+ *
+ *  \details
+ *  \p rocsparse_priority_end closes the section opened by
+ *  rocsparse_priority_begin() and restores the handle stream. Work enqueued
+ *  to the handle stream afterwards is ordered behind all calls of the
+ *  section.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value no section is open.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_priority_end(rocsparse_handle handle);
 
 #ifdef __cplusplus
 }
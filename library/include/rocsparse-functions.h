@@ -106,25 +106,102 @@ rocsparse_status rocsparse_daxpyi(rocsparse_handle     handle,
                                   const rocsparse_int* x_ind,
                                   double*              y,
                                   rocsparse_index_base idx_base);
-/*
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_caxpyi(rocsparse_handle handle,
-                                  rocsparse_int nnz,
+rocsparse_status rocsparse_caxpyi(rocsparse_handle               handle,
+                                  rocsparse_int                  nnz,
                                   const rocsparse_float_complex* alpha,
                                   const rocsparse_float_complex* x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_float_complex* y,
-                                  rocsparse_index_base idx_base);
+                                  const rocsparse_int*           x_ind,
+                                  rocsparse_float_complex*       y,
+                                  rocsparse_index_base           idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zaxpyi(rocsparse_handle handle,
-                                  rocsparse_int nnz,
+rocsparse_status rocsparse_zaxpyi(rocsparse_handle                handle,
+                                  rocsparse_int                   nnz,
                                   const rocsparse_double_complex* alpha,
                                   const rocsparse_double_complex* x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_double_complex* y,
-                                  rocsparse_index_base idx_base);
-*/
+                                  const rocsparse_int*            x_ind,
+                                  rocsparse_double_complex*       y,
+                                  rocsparse_index_base            idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Strided batched scale a sparse vector and add it to a dense vector.
+ *
+ *  \details
+ *  \p rocsparse_axpyi_batched multiplies each of the \p batch_count sparse vectors
+ *  \f$x_i\f$ with the scalar \f$\alpha\f$ and adds the result to the corresponding
+ *  dense vector \f$y_i\f$, such that
+ *  \f[
+ *    y_i := y_i + \alpha \cdot x_i, \quad i = 0, \ldots, \text{batch\_count} - 1
+ *  \f]
+ *  All batch members share the sparsity pattern \p x_ind. The values of batch \f$i\f$
+ *  are expected at \p x_val \f$+ i \cdot\f$ \p x_stride and the dense vector at
+ *  \p y \f$+ i \cdot\f$ \p y_stride. The whole batch is processed by a single
+ *  kernel launch with one workgroup per batch member, avoiding the launch latency
+ *  of \p batch_count separate rocsparse_axpyi() calls.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of each vector \f$x_i\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  x_val       array of \p nnz \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$
+ *              \p x_stride elements holding the values of all batch members.
+ *  @param[in]
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values, shared by all batch members.
+ *  @param[in]
+ *  x_stride    stride between the values of two consecutive batch members, must be
+ *              at least \p nnz.
+ *  @param[inout]
+ *  y           array holding all dense vectors of the batch.
+ *  @param[in]
+ *  y_stride    stride between two consecutive dense vectors of the batch.
+ *  @param[in]
+ *  batch_count number of batch members.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p x_stride, \p y_stride or
+ *          \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p alpha, \p x_val, \p x_ind or \p y
+ *          pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_saxpyi_batched(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          const float*         alpha,
+                                          const float*         x_val,
+                                          const rocsparse_int* x_ind,
+                                          rocsparse_int        x_stride,
+                                          float*               y,
+                                          rocsparse_int        y_stride,
+                                          rocsparse_int        batch_count,
+                                          rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_daxpyi_batched(rocsparse_handle     handle,
+                                          rocsparse_int        nnz,
+                                          const double*        alpha,
+                                          const double*        x_val,
+                                          const rocsparse_int* x_ind,
+                                          rocsparse_int        x_stride,
+                                          double*              y,
+                                          rocsparse_int        y_stride,
+                                          rocsparse_int        batch_count,
+                                          rocsparse_index_base idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
@@ -192,115 +269,118 @@ rocsparse_status rocsparse_ddoti(rocsparse_handle     handle,
                                  const double*        y,
                                  double*              result,
                                  rocsparse_index_base idx_base);
-/*
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cdoti(rocsparse_handle handle,
-                                 rocsparse_int nnz,
+rocsparse_status rocsparse_cdoti(rocsparse_handle               handle,
+                                 rocsparse_int                  nnz,
                                  const rocsparse_float_complex* x_val,
-                                 const rocsparse_int* x_ind,
+                                 const rocsparse_int*           x_ind,
                                  const rocsparse_float_complex* y,
-                                 rocsparse_float_complex* result,
-                                 rocsparse_index_base idx_base);
+                                 rocsparse_float_complex*       result,
+                                 rocsparse_index_base           idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zdoti(rocsparse_handle handle,
-                                 rocsparse_int nnz,
+rocsparse_status rocsparse_zdoti(rocsparse_handle                handle,
+                                 rocsparse_int                   nnz,
                                  const rocsparse_double_complex* x_val,
-                                 const rocsparse_int* x_ind,
+                                 const rocsparse_int*            x_ind,
                                  const rocsparse_double_complex* y,
-                                 rocsparse_double_complex* result,
-                                 rocsparse_index_base idx_base);
-*/
+                                 rocsparse_double_complex*       result,
+                                 rocsparse_index_base            idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Gather elements from a dense vector and store them into a sparse vector.
+ *  \brief Strided batched dot product of sparse vectors with dense vectors.
  *
  *  \details
- *  \p rocsparse_gthr gathers the elements that are listed in \p x_ind from the dense
- *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$.
- *
- *  \code{.c}
- *      for(i = 0; i < nnz; ++i)
- *      {
- *          x_val[i] = y[x_ind[i]];
- *      }
- *  \endcode
+ *  \p rocsparse_doti_batched computes the dot product of each of the
+ *  \p batch_count sparse vectors \f$x_i\f$ with the corresponding dense vector
+ *  \f$y_i\f$, such that
+ *  \f[
+ *    \text{result}[i] := y_i^T x_i, \quad i = 0, \ldots, \text{batch\_count} - 1
+ *  \f]
+ *  All batch members share the sparsity pattern \p x_ind. The values of batch \f$i\f$
+ *  are expected at \p x_val \f$+ i \cdot\f$ \p x_stride and the dense vector at
+ *  \p y \f$+ i \cdot\f$ \p y_stride. Each batch member is reduced by one
+ *  workgroup, such that the whole batch is covered by a single kernel launch.
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  In device pointer mode, this function is non blocking and executed asynchronously
+ *  with respect to the host. It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  nnz         number of non-zero entries of \f$x\f$.
+ *  nnz         number of non-zero entries of each vector \f$x_i\f$.
  *  @param[in]
- *  y           array of values in dense format.
- *  @param[out]
- *  x_val       array of \p nnz elements containing the values of \f$x\f$.
+ *  x_val       array of \p nnz \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$
+ *              \p x_stride elements holding the values of all batch members.
  *  @param[in]
  *  x_ind       array of \p nnz elements containing the indices of the non-zero
- *              values of \f$x\f$.
+ *              values, shared by all batch members.
+ *  @param[in]
+ *  x_stride    stride between the values of two consecutive batch members, must be
+ *              at least \p nnz.
+ *  @param[in]
+ *  y           array holding all dense vectors of the batch.
+ *  @param[in]
+ *  y_stride    stride between two consecutive dense vectors of the batch.
+ *  @param[out]
+ *  result      array of \p batch_count dot products, can be host or device memory.
+ *  @param[in]
+ *  batch_count number of batch members.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
- *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
- *              invalid.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p x_stride, \p y_stride or
+ *          \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y or \p result
+ *          pointer is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgthr(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 const float*         y,
-                                 float*               x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgthr(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 const double*        y,
-                                 double*              x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgthr(rocsparse_handle handle,
-                                 rocsparse_int nnz,
-                                 const rocsparse_float_complex* y,
-                                 rocsparse_float_complex* x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sdoti_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         const float*         x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         const float*         y,
+                                         rocsparse_int        y_stride,
+                                         float*               result,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgthr(rocsparse_handle handle,
-                                 rocsparse_int nnz,
-                                 const rocsparse_double_complex* y,
-                                 rocsparse_double_complex* x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_index_base idx_base);
-*/
+rocsparse_status rocsparse_ddoti_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         const double*        x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         const double*        y,
+                                         rocsparse_int        y_stride,
+                                         double*              result,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Gather and zero out elements from a dense vector and store them into a sparse
+ *  \brief Compute the dot product of a complex conjugated sparse vector and a dense
  *  vector.
  *
  *  \details
- *  \p rocsparse_gthrz gathers the elements that are listed in \p x_ind from the dense
- *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$. The gathered elements
- *  in \f$y\f$ are replaced by zero.
+ *  \p rocsparse_dotci computes the dot product of the complex conjugated sparse vector
+ *  \f$x\f$ with the dense vector \f$y\f$, such that
+ *  \f[
+ *    \text{result} := \bar{x}^T y
+ *  \f]
  *
  *  \code{.c}
  *      for(i = 0; i < nnz; ++i)
  *      {
- *          x_val[i]    = y[x_ind[i]];
- *          y[x_ind[i]] = 0;
+ *          result += conj(x_val[i]) * y[x_ind[i]];
  *      }
  *  \endcode
  *
@@ -311,372 +391,412 @@ rocsparse_status rocsparse_zgthr(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  nnz         number of non-zero entries of \f$x\f$.
- *  @param[inout]
- *  y           array of values in dense format.
- *  @param[out]
- *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  nnz         number of non-zero entries of vector \f$x\f$.
+ *  @param[in]
+ *  x_val       array of \p nnz values.
  *  @param[in]
  *  x_ind       array of \p nnz elements containing the indices of the non-zero
  *              values of \f$x\f$.
  *  @param[in]
+ *  y           array of values in dense format.
+ *  @param[out]
+ *  result      pointer to the result, can be host or device memory
+ *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
- *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
- *              invalid.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y or \p result
+ *          pointer is invalid.
+ *  \retval rocsparse_status_memory_error the buffer for the dot product reduction
+ *          could not be allocated.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgthrz(rocsparse_handle     handle,
-                                  rocsparse_int        nnz,
-                                  float*               y,
-                                  float*               x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgthrz(rocsparse_handle     handle,
-                                  rocsparse_int        nnz,
-                                  double*              y,
-                                  double*              x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgthrz(rocsparse_handle handle,
-                                  rocsparse_int nnz,
-                                  rocsparse_float_complex* y,
-                                  rocsparse_float_complex* x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
+rocsparse_status rocsparse_cdotci(rocsparse_handle               handle,
+                                  rocsparse_int                  nnz,
+                                  const rocsparse_float_complex* x_val,
+                                  const rocsparse_int*           x_ind,
+                                  const rocsparse_float_complex* y,
+                                  rocsparse_float_complex*       result,
+                                  rocsparse_index_base           idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgthrz(rocsparse_handle handle,
-                                  rocsparse_int nnz,
-                                  rocsparse_double_complex* y,
-                                  rocsparse_double_complex* x_val,
-                                  const rocsparse_int* x_ind,
-                                  rocsparse_index_base idx_base);
-*/
+rocsparse_status rocsparse_zdotci(rocsparse_handle                handle,
+                                  rocsparse_int                   nnz,
+                                  const rocsparse_double_complex* x_val,
+                                  const rocsparse_int*            x_ind,
+                                  const rocsparse_double_complex* y,
+                                  rocsparse_double_complex*       result,
+                                  rocsparse_index_base            idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Apply Givens rotation to a dense and a sparse vector.
+ *  \brief Compute the dot product of two sparse vectors.
  *
  *  \details
- *  \p rocsparse_roti applies the Givens rotation matrix \f$G\f$ to the sparse vector
- *  \f$x\f$ and the dense vector \f$y\f$, where
+ *  \p rocsparse_dotii computes the dot product of the sparse vector \f$x\f$ with the
+ *  sparse vector \f$y\f$, such that
  *  \f[
- *    G = \begin{pmatrix} c & s \\ -s & c \end{pmatrix}
+ *    \text{result} := y^T x
  *  \f]
+ *  Both vectors are given in compressed form, only indices that appear in both index
+ *  lists contribute to the sum. The index lists are intersected directly on the
+ *  device, each entry of the shorter vector is matched against the sorted index list
+ *  of the longer one by binary search. No dense scratch vector is required, in
+ *  contrast to scattering one side with rocsparse_ssctr() or rocsparse_dsctr() and
+ *  calling rocsparse_sdoti() or rocsparse_ddoti() on the result.
  *
  *  \code{.c}
- *      for(i = 0; i < nnz; ++i)
+ *      for(i = 0; i < x_nnz; ++i)
  *      {
- *          x_tmp = x_val[i];
- *          y_tmp = y[x_ind[i]];
- *
- *          x_val[i]    = c * x_tmp + s * y_tmp;
- *          y[x_ind[i]] = c * y_tmp - s * x_tmp;
+ *          for(j = 0; j < y_nnz; ++j)
+ *          {
+ *              if(x_ind[i] == y_ind[j])
+ *              {
+ *                  result += x_val[i] * y_val[j];
+ *              }
+ *          }
  *      }
  *  \endcode
  *
  *  \note
+ *  The sparse indices of \f$x\f$ and \f$y\f$ are expected to be sorted in increasing
+ *  order and distinct.
+ *
+ *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  nnz         number of non-zero entries of \f$x\f$.
- *  @param[inout]
- *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  x_nnz       number of non-zero entries of vector \f$x\f$.
  *  @param[in]
- *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *  x_val       array of \p x_nnz values.
+ *  @param[in]
+ *  x_ind       array of \p x_nnz elements containing the indices of the non-zero
  *              values of \f$x\f$.
- *  @param[inout]
- *  y           array of values in dense format.
  *  @param[in]
- *  c           pointer to the cosine element of \f$G\f$, can be on host or device.
+ *  y_nnz       number of non-zero entries of vector \f$y\f$.
  *  @param[in]
- *  s           pointer to the sine element of \f$G\f$, can be on host or device.
+ *  y_val       array of \p y_nnz values.
+ *  @param[in]
+ *  y_ind       array of \p y_nnz elements containing the indices of the non-zero
+ *              values of \f$y\f$.
+ *  @param[out]
+ *  result      pointer to the result, can be host or device memory
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
- *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p c, \p s, \p x_val, \p x_ind or \p y
- *              pointer is invalid.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p x_nnz or \p y_nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y_val, \p y_ind or
+ *          \p result pointer is invalid.
+ *  \retval rocsparse_status_memory_error the buffer for the dot product reduction
+ *          could not be allocated.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sroti(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 float*               x_val,
-                                 const rocsparse_int* x_ind,
-                                 float*               y,
-                                 const float*         c,
-                                 const float*         s,
-                                 rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sdotii(rocsparse_handle     handle,
+                                  rocsparse_int        x_nnz,
+                                  const float*         x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_int        y_nnz,
+                                  const float*         y_val,
+                                  const rocsparse_int* y_ind,
+                                  float*               result,
+                                  rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_droti(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 double*              x_val,
-                                 const rocsparse_int* x_ind,
-                                 double*              y,
-                                 const double*        c,
-                                 const double*        s,
-                                 rocsparse_index_base idx_base);
+rocsparse_status rocsparse_ddotii(rocsparse_handle     handle,
+                                  rocsparse_int        x_nnz,
+                                  const double*        x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_int        y_nnz,
+                                  const double*        y_val,
+                                  const rocsparse_int* y_ind,
+                                  double*              result,
+                                  rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cdotii(rocsparse_handle               handle,
+                                  rocsparse_int                  x_nnz,
+                                  const rocsparse_float_complex* x_val,
+                                  const rocsparse_int*           x_ind,
+                                  rocsparse_int                  y_nnz,
+                                  const rocsparse_float_complex* y_val,
+                                  const rocsparse_int*           y_ind,
+                                  rocsparse_float_complex*       result,
+                                  rocsparse_index_base           idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zdotii(rocsparse_handle                handle,
+                                  rocsparse_int                   x_nnz,
+                                  const rocsparse_double_complex* x_val,
+                                  const rocsparse_int*            x_ind,
+                                  rocsparse_int                   y_nnz,
+                                  const rocsparse_double_complex* y_val,
+                                  const rocsparse_int*            y_ind,
+                                  rocsparse_double_complex*       result,
+                                  rocsparse_index_base            idx_base);
 /**@}*/
 
 /*! \ingroup level1_module
- *  \brief Scatter elements from a dense vector across a sparse vector.
+ *  \brief Batched dot product of sparse vector pairs.
  *
  *  \details
- *  \p rocsparse_sctr scatters the elements that are listed in \p x_ind from the sparse
- *  vector \f$x\f$ into the dense vector \f$y\f$. Indices of \f$y\f$ that are not listed
- *  in \p x_ind remain unchanged.
+ *  \p rocsparse_dotii_batched computes the dot product of each of the
+ *  \p batch_count sparse vector pairs \f$(x_i, y_i)\f$, such that
+ *  \f[
+ *    \text{result}[i] := y_i^T x_i, \quad i = 0, \ldots, \text{batch\_count} - 1
+ *  \f]
+ *  The vectors are stored back to back in compressed form, the entries of pair
+ *  \f$i\f$ are expected at \p x_ptr[i] .. \p x_ptr[i+1] of \p x_val and \p x_ind,
+ *  and at \p y_ptr[i] .. \p y_ptr[i+1] of \p y_val and \p y_ind, analogous to the
+ *  row pointer of the CSR storage format. Each pair is intersected by one
+ *  wavefront, such that many small vector pairs are covered by a single kernel
+ *  launch.
  *
- *  \code{.c}
- *      for(i = 0; i < nnz; ++i)
- *      {
- *          y[x_ind[i]] = x_val[i];
- *      }
- *  \endcode
+ *  \note
+ *  The sparse indices of each vector are expected to be sorted in increasing order
+ *  and distinct.
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  In device pointer mode, this function is non blocking and executed asynchronously
+ *  with respect to the host. It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  nnz         number of non-zero entries of \f$x\f$.
+ *  batch_count number of vector pairs.
  *  @param[in]
- *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  x_val       array holding the values of all vectors \f$x_i\f$.
  *  @param[in]
- *  x_ind       array of \p nnz elements containing the indices of the non-zero
- *              values of x.
- *  @param[inout]
- *  y           array of values in dense format.
+ *  x_ind       array holding the indices of the non-zero values of all vectors
+ *              \f$x_i\f$.
+ *  @param[in]
+ *  x_ptr       array of \p batch_count+1 elements that point to the start of every
+ *              vector \f$x_i\f$.
+ *  @param[in]
+ *  y_val       array holding the values of all vectors \f$y_i\f$.
+ *  @param[in]
+ *  y_ind       array holding the indices of the non-zero values of all vectors
+ *              \f$y_i\f$.
+ *  @param[in]
+ *  y_ptr       array of \p batch_count+1 elements that point to the start of every
+ *              vector \f$y_i\f$.
+ *  @param[out]
+ *  result      array of \p batch_count dot products, can be host or device memory.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
- *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer is
- *              invalid.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p x_ptr, \p y_val,
+ *          \p y_ind, \p y_ptr or \p result pointer is invalid.
+ *  \retval rocsparse_status_arch_mismatch the device is not supported.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ssctr(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 const float*         x_val,
-                                 const rocsparse_int* x_ind,
-                                 float*               y,
-                                 rocsparse_index_base idx_base);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dsctr(rocsparse_handle     handle,
-                                 rocsparse_int        nnz,
-                                 const double*        x_val,
-                                 const rocsparse_int* x_ind,
-                                 double*              y,
-                                 rocsparse_index_base idx_base);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csctr(rocsparse_handle handle,
-                                 rocsparse_int nnz,
-                                 const rocsparse_float_complex* x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_float_complex* y,
-                                 rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sdotii_batched(rocsparse_handle     handle,
+                                          rocsparse_int        batch_count,
+                                          const float*         x_val,
+                                          const rocsparse_int* x_ind,
+                                          const rocsparse_int* x_ptr,
+                                          const float*         y_val,
+                                          const rocsparse_int* y_ind,
+                                          const rocsparse_int* y_ptr,
+                                          float*               result,
+                                          rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zsctr(rocsparse_handle handle,
-                                 rocsparse_int nnz,
-                                 const rocsparse_double_complex* x_val,
-                                 const rocsparse_int* x_ind,
-                                 rocsparse_double_complex* y,
-                                 rocsparse_index_base idx_base);
-*/
+rocsparse_status rocsparse_ddotii_batched(rocsparse_handle     handle,
+                                          rocsparse_int        batch_count,
+                                          const double*        x_val,
+                                          const rocsparse_int* x_ind,
+                                          const rocsparse_int* x_ptr,
+                                          const double*        y_val,
+                                          const rocsparse_int* y_ind,
+                                          const rocsparse_int* y_ptr,
+                                          double*              result,
+                                          rocsparse_index_base idx_base);
 /**@}*/
 
-/*
- * ===========================================================================
- *    level 2 SPARSE
- * ===========================================================================
- */
-
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using COO storage format
+/*! \ingroup level1_module
+ *  \brief Fused dot product and scaled addition of a sparse vector and a dense vector.
  *
  *  \details
- *  \p rocsparse_coomv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in COO storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
- *  such that
+ *  \p rocsparse_dotiaxpyi computes the dot product of the sparse vector \f$x\f$ with
+ *  the dense vector \f$y\f$ and subsequently multiplies \f$x\f$ by the scalar
+ *  \f$\alpha\f$ and adds it to \f$y\f$, such that
  *  \f[
- *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans == rocsparse_operation_none} \\
- *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
+ *    \text{result} := y^T x, \quad
+ *    y := y + \alpha \cdot x
  *  \f]
- *
- *  The COO matrix has to be sorted by row indices. This can be achieved by using
- *  rocsparse_coosort_by_row().
+ *  where the dot product is computed with the values of \f$y\f$ prior to the update.
+ *  Both operations are performed in a single pass over \p x_val and \p x_ind, saving
+ *  memory traffic and a kernel launch compared to calling rocsparse_doti() and
+ *  rocsparse_axpyi() back to back, e.g. in the update steps of iterative Krylov
+ *  solvers.
  *
  *  \code{.c}
- *      for(i = 0; i < m; ++i)
- *      {
- *          y[i] = beta * y[i];
- *      }
- *
  *      for(i = 0; i < nnz; ++i)
  *      {
- *          y[coo_row_ind[i]] += alpha * coo_val[i] * x[coo_col_ind[i]];
+ *          result += x_val[i] * y[x_ind[i]];
+ *          y[x_ind[i]] = y[x_ind[i]] + alpha * x_val[i];
  *      }
  *  \endcode
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  The sparse indices of \f$x\f$ are expected to be distinct.
  *
  *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse COO matrix.
+ *  nnz         number of non-zero entries of vector \f$x\f$.
  *  @param[in]
- *  n           number of columns of the sparse COO matrix.
+ *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse COO matrix.
+ *  x_val       array of \p nnz values.
  *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[inout]
+ *  y           array of values in dense format.
+ *  @param[out]
+ *  result      pointer to the result, can be host or device memory
  *  @param[in]
- *  descr       descriptor of the sparse COO matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p alpha, \p x_val, \p x_ind, \p y or
+ *          \p result pointer is invalid.
+ *  \retval rocsparse_status_memory_error the buffer for the dot product reduction
+ *          could not be allocated.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdotiaxpyi(rocsparse_handle     handle,
+                                      rocsparse_int        nnz,
+                                      const float*         alpha,
+                                      const float*         x_val,
+                                      const rocsparse_int* x_ind,
+                                      float*               y,
+                                      float*               result,
+                                      rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddotiaxpyi(rocsparse_handle     handle,
+                                      rocsparse_int        nnz,
+                                      const double*        alpha,
+                                      const double*        x_val,
+                                      const rocsparse_int* x_ind,
+                                      double*              y,
+                                      double*              result,
+                                      rocsparse_index_base idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Gather elements from a dense vector and store them into a sparse vector.
+ *
+ *  \details
+ *  \p rocsparse_gthr gathers the elements that are listed in \p x_ind from the dense
+ *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          x_val[i] = y[x_ind[i]];
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
  *  @param[in]
- *  coo_val     array of \p nnz elements of the sparse COO matrix.
+ *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
- *              matrix.
+ *  nnz         number of non-zero entries of \f$x\f$.
  *  @param[in]
- *  coo_col_ind array of \p nnz elements containing the column indices of the sparse
- *              COO matrix.
+ *  y           array of values in dense format.
+ *  @param[out]
+ *  x_val       array of \p nnz elements containing the values of \f$x\f$.
  *  @param[in]
- *  x           array of \p n elements (\f$op(A) = A\f$) or \p m elements
- *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
  *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  y           array of \p m elements (\f$op(A) = A\f$) or \p n elements
- *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p coo_val,
- *              \p coo_row_ind, \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
+ *              invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scoomv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              coo_val,
-                                  const rocsparse_int*      coo_row_ind,
-                                  const rocsparse_int*      coo_col_ind,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
+rocsparse_status rocsparse_sgthr(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 const float*         y,
+                                 float*               x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcoomv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             coo_val,
-                                  const rocsparse_int*      coo_row_ind,
-                                  const rocsparse_int*      coo_col_ind,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
-/*
+rocsparse_status rocsparse_dgthr(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 const double*        y,
+                                 double*              x_val,
+                                 const rocsparse_int* x_ind,
+                                 rocsparse_index_base idx_base);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccoomv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* coo_val,
-                                  const rocsparse_int* coo_row_ind,
-                                  const rocsparse_int* coo_col_ind,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
+rocsparse_status rocsparse_cgthr(rocsparse_handle               handle,
+                                 rocsparse_int                  nnz,
+                                 const rocsparse_float_complex* y,
+                                 rocsparse_float_complex*       x_val,
+                                 const rocsparse_int*           x_ind,
+                                 rocsparse_index_base           idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* coo_val,
-                                  const rocsparse_int* coo_row_ind,
-                                  const rocsparse_int* coo_col_ind,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
+rocsparse_status rocsparse_zgthr(rocsparse_handle                handle,
+                                 rocsparse_int                   nnz,
+                                 const rocsparse_double_complex* y,
+                                 rocsparse_double_complex*       x_val,
+                                 const rocsparse_int*            x_ind,
+                                 rocsparse_index_base            idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Strided batched gather of dense vector elements into sparse vectors.
  *
  *  \details
- *  \p rocsparse_csrmv_analysis performs the analysis step for rocsparse_scsrmv() and
- *  rocsparse_dcsrmv(). It is expected that this function will be executed only once for
- *  a given matrix and particular operation type. The gathered analysis meta data can be
- *  cleared by rocsparse_csrmv_clear().
- *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  \p rocsparse_gthr_batched gathers, for each of the \p batch_count batch members,
+ *  the elements that are listed in \p x_ind from the dense vector \f$y_i\f$ and
+ *  stores them in the sparse vector \f$x_i\f$. All batch members share the sparsity
+ *  pattern \p x_ind. The values of batch \f$i\f$ are written to
+ *  \p x_val \f$+ i \cdot\f$ \p x_stride and the dense vector is read from
+ *  \p y \f$+ i \cdot\f$ \p y_stride. The whole batch is processed by a single
+ *  kernel launch with one workgroup per batch member.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -685,129 +805,194 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of each vector \f$x_i\f$.
  *  @param[in]
- *  n           number of columns of the sparse CSR matrix.
+ *  y           array holding all dense vectors of the batch.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  y_stride    stride between two consecutive dense vectors of the batch.
+ *  @param[out]
+ *  x_val       array of \p nnz \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$
+ *              \p x_stride elements holding the gathered values of all batch members.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values, shared by all batch members.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  x_stride    stride between the values of two consecutive batch members, must be
+ *              at least \p nnz.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  batch_count number of batch members.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind or \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer for the gathered information
- *              could not be allocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p x_stride, \p y_stride or
+ *          \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
+ *          invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             n,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info);
+rocsparse_status rocsparse_sgthr_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         const float*         y,
+                                         rocsparse_int        y_stride,
+                                         float*               x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             n,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info);
+rocsparse_status rocsparse_dgthr_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         const double*        y,
+                                         rocsparse_int        y_stride,
+                                         double*              x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Gather and zero out elements from a dense vector and store them into a sparse
+ *  vector.
  *
  *  \details
- *  \p rocsparse_csrmv_clear deallocates all memory that was allocated by
- *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). This is especially
- *  useful, if memory is an issue and the analysis data is not required anymore for
- *  further computation, e.g. when switching to another sparse matrix format.
+ *  \p rocsparse_gthrz gathers the elements that are listed in \p x_ind from the dense
+ *  vector \f$y\f$ and stores them in the sparse vector \f$x\f$. The gathered elements
+ *  in \f$y\f$ are replaced by zero.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          x_val[i]    = y[x_ind[i]];
+ *          y[x_ind[i]] = 0;
+ *      }
+ *  \endcode
  *
  *  \note
- *  Calling \p rocsparse_csrmv_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of \f$x\f$.
  *  @param[inout]
- *  info        structure that holds the information collected during analysis step.
+ *  y           array of values in dense format.
+ *  @param[out]
+ *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  @param[in]
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer for the gathered information
- *              could not be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- * */
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p y, \p x_val or \p x_ind pointer is
+ *              invalid.
+ */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_sgthrz(rocsparse_handle     handle,
+                                  rocsparse_int        nnz,
+                                  float*               y,
+                                  float*               x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_index_base idx_base);
 
-/*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using CSR storage format
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgthrz(rocsparse_handle     handle,
+                                  rocsparse_int        nnz,
+                                  double*              y,
+                                  double*              x_val,
+                                  const rocsparse_int* x_ind,
+                                  rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgthrz(rocsparse_handle         handle,
+                                  rocsparse_int            nnz,
+                                  rocsparse_float_complex* y,
+                                  rocsparse_float_complex* x_val,
+                                  const rocsparse_int*     x_ind,
+                                  rocsparse_index_base     idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgthrz(rocsparse_handle          handle,
+                                  rocsparse_int             nnz,
+                                  rocsparse_double_complex* y,
+                                  rocsparse_double_complex* x_val,
+                                  const rocsparse_int*      x_ind,
+                                  rocsparse_index_base      idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Euclidean norm of a sparse vector.
  *
  *  \details
- *  \p rocsparse_csrmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in CSR storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  \p rocsparse_nrm2i computes the Euclidean norm of the sparse vector \f$x\f$,
  *  such that
  *  \f[
- *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *    \text{result} := \|x\|_2 = \sqrt{\sum_i x\_val[i]^2}
  *  \f]
- *  with
+ *  The compressed values are reduced directly, no dense vector is accessed.
+ *
+ *  \note
+ *  In device pointer mode, this function is non blocking and executed asynchronously
+ *  with respect to the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of vector \f$x\f$.
+ *  @param[in]
+ *  x_val       array of \p nnz values.
+ *  @param[out]
+ *  result      pointer to the result, can be host or device memory
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val or \p result pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_snrm2i(rocsparse_handle handle,
+                                  rocsparse_int    nnz,
+                                  const float*     x_val,
+                                  float*           result);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnrm2i(rocsparse_handle handle,
+                                  rocsparse_int    nnz,
+                                  const double*    x_val,
+                                  double*          result);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Apply Givens rotation to a dense and a sparse vector.
+ *
+ *  \details
+ *  \p rocsparse_roti applies the Givens rotation matrix \f$G\f$ to the sparse vector
+ *  \f$x\f$ and the dense vector \f$y\f$, where
  *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans == rocsparse_operation_none} \\
- *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
+ *    G = \begin{pmatrix} c & s \\ -s & c \end{pmatrix}
  *  \f]
  *
- *  The \p info parameter is optional and contains information collected by
- *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). If present, the
- *  information will be used to speed up the \p csrmv computation. If \p info == \p NULL,
- *  general \p csrmv routine will be used instead.
- *
  *  \code{.c}
- *      for(i = 0; i < m; ++i)
+ *      for(i = 0; i < nnz; ++i)
  *      {
- *          y[i] = beta * y[i];
+ *          x_tmp = x_val[i];
+ *          y_tmp = y[x_ind[i]];
  *
- *          for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
- *          {
- *              y[i] = y[i] + alpha * csr_val[j] * x[csr_col_ind[j]];
- *          }
+ *          x_val[i]    = c * x_tmp + s * y_tmp;
+ *          y[x_ind[i]] = c * y_tmp - s * x_tmp;
  *      }
  *  \endcode
  *
@@ -815,294 +1000,305 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
- *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
- *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
+ *  nnz         number of non-zero entries of \f$x\f$.
+ *  @param[inout]
+ *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[inout]
+ *  y           array of values in dense format.
  *  @param[in]
- *  n           number of columns of the sparse CSR matrix.
+ *  c           pointer to the cosine element of \f$G\f$, can be on host or device.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  s           pointer to the sine element of \f$G\f$, can be on host or device.
  *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p c, \p s, \p x_val, \p x_ind or \p y
+ *              pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sroti(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 float*               x_val,
+                                 const rocsparse_int* x_ind,
+                                 float*               y,
+                                 const float*         c,
+                                 const float*         s,
+                                 rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_droti(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 double*              x_val,
+                                 const rocsparse_int* x_ind,
+                                 double*              y,
+                                 const double*        c,
+                                 const double*        s,
+                                 rocsparse_index_base idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Strided batched Givens rotation applied to sparse and dense vectors.
+ *
+ *  \details
+ *  \p rocsparse_roti_batched applies the Givens rotation to each of the
+ *  \p batch_count sparse vectors \f$x_i\f$ and the corresponding dense vectors
+ *  \f$y_i\f$, such that
+ *  \f[
+ *    x_i := c \cdot x_i + s \cdot y_i, \quad
+ *    y_i := c \cdot y_i - s \cdot x_i
+ *  \f]
+ *  The gather from \f$y_i\f$, the rotation and the scatter back to \f$y_i\f$ are
+ *  fused into a single pass over the shared sparsity pattern \p x_ind, and the
+ *  whole batch is covered by one kernel launch with one workgroup per batch
+ *  member. The values of batch \f$i\f$ are expected at
+ *  \p x_val \f$+ i \cdot\f$ \p x_stride and the dense vector at
+ *  \p y \f$+ i \cdot\f$ \p y_stride. The indices of a batch member must be free
+ *  of duplicates, they do not need to be sorted.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of each vector \f$x_i\f$.
+ *  @param[inout]
+ *  x_val       array of \p nnz \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$
+ *              \p x_stride elements holding the values of all batch members.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start
- *              of every row of the sparse CSR matrix.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values, shared by all batch members.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  x_stride    stride between the values of two consecutive batch members, must be
+ *              at least \p nnz.
+ *  @param[inout]
+ *  y           array holding all dense vectors of the batch.
  *  @param[in]
- *  info        information collected by rocsparse_scsrmv_analysis() or
- *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information is
- *              available.
+ *  y_stride    stride between two consecutive dense vectors of the batch.
  *  @param[in]
- *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  c           pointer to the cosine element of \f$G\f$, can be on host or device.
  *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
- *              invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  s           pointer to the sine element of \f$G\f$, can be on host or device.
+ *  @param[in]
+ *  batch_count number of batch members.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \par Example
- *  This example performs a sparse matrix vector multiplication in CSR format
- *  using additional meta data to improve performance.
- *  \code{.c}
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Perform analysis step to obtain meta data
- *      rocsparse_scsrmv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                n,
- *                                nnz,
- *                                descr,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info);
- *
- *      // Compute y = Ax
- *      rocsparse_scsrmv(handle,
- *                       rocsparse_operation_none,
- *                       m,
- *                       n,
- *                       nnz,
- *                       &alpha,
- *                       descr,
- *                       csr_val,
- *                       csr_row_ptr,
- *                       csr_col_ind,
- *                       info,
- *                       x,
- *                       &beta,
- *                       y);
- *
- *      // Do more work
- *      // ...
- *
- *      // Clean up
- *      rocsparse_destroy_mat_info(info);
- *  \endcode
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p x_stride, \p y_stride or
+ *          \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p c, \p s, \p x_val, \p x_ind or
+ *          \p y pointer is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  rocsparse_mat_info info,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
+rocsparse_status rocsparse_sroti_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         float*               x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         float*               y,
+                                         rocsparse_int        y_stride,
+                                         const float*         c,
+                                         const float*         s,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  rocsparse_mat_info info,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
+rocsparse_status rocsparse_droti_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         double*              x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         double*              y,
+                                         rocsparse_int        y_stride,
+                                         const double*        c,
+                                         const double*        s,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Scatter elements from a dense vector across a sparse vector.
  *
  *  \details
- *  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_scsrsv_solve() or
- *  rocsparse_dcsrsv_solve() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
- *  is stored in \p position, using same index base as the CSR matrix.
+ *  \p rocsparse_sctr scatters the elements that are listed in \p x_ind from the sparse
+ *  vector \f$x\f$ into the dense vector \f$y\f$. Indices of \f$y\f$ that are not listed
+ *  in \p x_ind remain unchanged.
  *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          y[x_ind[i]] = x_val[i];
+ *      }
+ *  \endcode
  *
- *  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
- *  performance negatively.
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of \f$x\f$.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  x_val       array of \p nnz elements containing the non-zero values of \f$x\f$.
+ *  @param[in]
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of x.
  *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *  y           array of values in dense format.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer is
  *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
-                                            const rocsparse_mat_descr descr,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_int*            position);
+rocsparse_status rocsparse_ssctr(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 const float*         x_val,
+                                 const rocsparse_int* x_ind,
+                                 float*               y,
+                                 rocsparse_index_base idx_base);
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsctr(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 const double*        x_val,
+                                 const rocsparse_int* x_ind,
+                                 double*              y,
+                                 rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csctr(rocsparse_handle               handle,
+                                 rocsparse_int                  nnz,
+                                 const rocsparse_float_complex* x_val,
+                                 const rocsparse_int*           x_ind,
+                                 rocsparse_float_complex*       y,
+                                 rocsparse_index_base           idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zsctr(rocsparse_handle                handle,
+                                 rocsparse_int                   nnz,
+                                 const rocsparse_double_complex* x_val,
+                                 const rocsparse_int*            x_ind,
+                                 rocsparse_double_complex*       y,
+                                 rocsparse_index_base            idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Strided batched scatter of sparse vector elements into dense vectors.
  *
  *  \details
- *  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
- *  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
- *  rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve(). The temporary storage buffer
- *  must be allocated by the user. The size of the temporary storage buffer is identical
- *  to the size returned by rocsparse_scsrilu0_buffer_size() and
- *  rocsparse_dcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
- *  user allocated buffer can thus be shared between subsequent calls to those functions.
+ *  \p rocsparse_sctr_batched scatters, for each of the \p batch_count batch members,
+ *  the elements of the sparse vector \f$x_i\f$ into the dense vector \f$y_i\f$ at
+ *  the positions listed in \p x_ind. All batch members share the sparsity pattern
+ *  \p x_ind. The values of batch \f$i\f$ are read from
+ *  \p x_val \f$+ i \cdot\f$ \p x_stride and the dense vector is written at
+ *  \p y \f$+ i \cdot\f$ \p y_stride. The whole batch is processed by a single
+ *  kernel launch with one workgroup per batch member.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
- *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of each vector \f$x_i\f$.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  x_val       array of \p nnz \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$
+ *              \p x_stride elements holding the values of all batch members.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values, shared by all batch members.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  x_stride    stride between the values of two consecutive batch members, must be
+ *              at least \p nnz.
+ *  @param[out]
+ *  y           array holding all dense vectors of the batch.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  y_stride    stride between two consecutive dense vectors of the batch.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
+ *  batch_count number of batch members.
  *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
- *              rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve().
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p nnz, \p x_stride, \p y_stride or
+ *          \p batch_count is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer is
+ *          invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const float*              csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_ssctr_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         const float*         x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         float*               y,
+                                         rocsparse_int        y_stride,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_operation       trans,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const double*             csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size);
+rocsparse_status rocsparse_dsctr_batched(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         const double*        x_val,
+                                         const rocsparse_int* x_ind,
+                                         rocsparse_int        x_stride,
+                                         double*              y,
+                                         rocsparse_int        y_stride,
+                                         rocsparse_int        batch_count,
+                                         rocsparse_index_base idx_base);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Scatter elements from a sparse vector and accumulate them into a dense
+ *  vector.
  *
  *  \details
- *  \p rocsparse_csrsv_analysis performs the analysis step for rocsparse_scsrsv_solve()
- *  and rocsparse_dcsrsv_solve(). It is expected that this function will be executed only
- *  once for a given matrix and particular operation type. The analysis meta data can be
- *  cleared by rocsparse_csrsv_clear().
+ *  \p rocsparse_sctr_add adds the elements of the sparse vector \f$x\f$ to the dense
+ *  vector \f$y\f$ at the locations that are listed in \p x_ind.
  *
- *  \p rocsparse_csrsv_analysis can share its meta data with
- *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
+ *  \code{.c}
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          y[x_ind[i]] = y[x_ind[i]] + x_val[i];
+ *      }
+ *  \endcode
+ *
+ *  In contrast to rocsparse_ssctr() and rocsparse_dsctr(), duplicate entries in
+ *  \p x_ind are allowed. Their contributions are accumulated atomically, such that
+ *  e.g. unassembled element contributions can be scattered in a single pass without
+ *  sorting and reducing duplicates first.
  *
  *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  The order in which contributions to the same dense entry are added is not
+ *  deterministic.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -1111,112 +1307,294 @@ rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  trans       matrix operation type.
+ *  nnz         number of non-zero entries of \f$x\f$.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  x_val       array of \p nnz elements containing the values of \f$x\f$.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[inout]
+ *  y           array of values in dense format.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p x_val, \p x_ind or \p y pointer is
+ *              invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ssctr_add(rocsparse_handle     handle,
+                                     rocsparse_int        nnz,
+                                     const float*         x_val,
+                                     const rocsparse_int* x_ind,
+                                     float*               y,
+                                     rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsctr_add(rocsparse_handle     handle,
+                                     rocsparse_int        nnz,
+                                     const double*        x_val,
+                                     const rocsparse_int* x_ind,
+                                     double*              y,
+                                     rocsparse_index_base idx_base);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Sum of the elements of a sparse vector.
+ *
+ *  \details
+ *  \p rocsparse_sumi computes the sum of the values of the sparse vector \f$x\f$,
+ *  such that
+ *  \f[
+ *    \text{result} := \sum_i x\_val[i]
+ *  \f]
+ *  The compressed values are reduced directly, no dense vector is accessed.
+ *
+ *  \note
+ *  In device pointer mode, this function is non blocking and executed asynchronously
+ *  with respect to the host. It may return before the actual computation has finished.
+ *
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  nnz         number of non-zero entries of vector \f$x\f$.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  x_val       array of \p nnz values.
  *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
+ *  result      pointer to the result, can be host or device memory
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val or \p result pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ssumi(rocsparse_handle handle,
+                                 rocsparse_int    nnz,
+                                 const float*     x_val,
+                                 float*           result);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsumi(rocsparse_handle handle,
+                                 rocsparse_int    nnz,
+                                 const double*    x_val,
+                                 double*          result);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Obtain the temporary buffer size for rocsparse_stopk() and
+ *  rocsparse_dtopk().
+ *
+ *  \details
+ *  \p rocsparse_topk_buffer_size returns the size of the temporary storage buffer
+ *  required by rocsparse_stopk() and rocsparse_dtopk(). The temporary storage
+ *  buffer must be allocated by the user.
+ *
  *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
+ *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
+ *  nnz         number of non-zero entries of vector \f$x\f$.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  k           number of largest magnitude entries to select.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_stopk() and rocsparse_dtopk().
  *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p nnz or \p k is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_stopk_buffer_size(rocsparse_handle handle,
+                                             rocsparse_int    nnz,
+                                             rocsparse_int    k,
+                                             size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle          handle,
-                                           rocsparse_operation       trans,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_dtopk_buffer_size(rocsparse_handle handle,
+                                             rocsparse_int    nnz,
+                                             rocsparse_int    k,
+                                             size_t*          buffer_size);
 /**@}*/
 
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+/*! \ingroup level1_module
+ *  \brief Select the k largest magnitude entries of a sparse vector.
  *
  *  \details
- *  \p rocsparse_csrsv_clear deallocates all memory that was allocated by
- *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis(). This is especially
- *  useful, if memory is an issue and the analysis data is not required for further
- *  computation, e.g. when switching to another sparse matrix format. Calling
- *  \p rocsparse_csrsv_clear is optional. All allocated resources will be cleared, when
- *  the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
+ *  \p rocsparse_topk selects the \p k entries of the sparse vector \f$x\f$ with the
+ *  largest absolute value and stores their values and indices in \f$y\f$, ordered by
+ *  descending magnitude. The selection is performed entirely on the device using a
+ *  radix sort of the entry magnitudes, such that e.g. iterative pruning of sparse
+ *  vectors does not require a round trip to the host. Entries with equal magnitude
+ *  are selected in no particular order.
+ *
+ *  \p rocsparse_topk requires a temporary storage buffer, allocated by the user. The
+ *  size of this buffer can be queried using rocsparse_stopk_buffer_size() and
+ *  rocsparse_dtopk_buffer_size().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of vector \f$x\f$.
+ *  @param[in]
+ *  k           number of largest magnitude entries to select, with
+ *              \f$0 \le k \le nnz\f$.
+ *  @param[in]
+ *  x_val       array of \p nnz values.
+ *  @param[in]
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[out]
+ *  y_val       array of \p k values, sorted by descending magnitude.
+ *  @param[out]
+ *  y_ind       array of \p k elements containing the indices of the selected
+ *              values.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is returned
+ *              by rocsparse_stopk_buffer_size() and rocsparse_dtopk_buffer_size().
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p nnz or \p k is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y_val, \p y_ind
+ *          or \p temp_buffer pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_stopk(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 rocsparse_int        k,
+                                 const float*         x_val,
+                                 const rocsparse_int* x_ind,
+                                 float*               y_val,
+                                 rocsparse_int*       y_ind,
+                                 void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dtopk(rocsparse_handle     handle,
+                                 rocsparse_int        nnz,
+                                 rocsparse_int        k,
+                                 const double*        x_val,
+                                 const rocsparse_int* x_ind,
+                                 double*              y_val,
+                                 rocsparse_int*       y_ind,
+                                 void*                temp_buffer);
+/**@}*/
+
+/*! \ingroup level1_module
+ *  \brief Execute a chain of sparse level 1 operations in a single kernel pass
+ *
+ *  \details
+ *  \p rocsparse_level1_chain executes a short sequence of level 1 operations on the
+ *  sparse vector \f$x\f$, in sparse format, and the dense vector \f$y\f$ in a single
+ *  kernel pass over the shared index set \p x_ind. The sparse value of each entry is
+ *  kept in a register between the operations, such that \p x_ind and \p x_val are read
+ *  from global memory only once, regardless of the length of the chain. The operations
+ *  are applied in the order given by \p ops, see \ref rocsparse_level1_op for the
+ *  available operations.
+ *
+ *  Each operation is assigned two consecutive entries of \p scalars, such that the
+ *  scalars of operation \f$i\f$ are expected at \p scalars \f$[2 i]\f$ and
+ *  \p scalars \f$[2 i + 1]\f$. \ref rocsparse_level1_op_axpyi and
+ *  \ref rocsparse_level1_op_scal read \f$\alpha\f$ from the first entry,
+ *  \ref rocsparse_level1_op_roti reads \f$c\f$ from the first and \f$s\f$ from the
+ *  second entry. The remaining operations consume no scalars. If no operation of the
+ *  chain consumes a scalar, \p scalars may be a null pointer.
+ *
+ *  \note
+ *  A chain may consist of at most 8 operations. The operation list \p ops is always
+ *  read on the host, the \p scalars array is read according to the pointer mode of
+ *  the handle.
+ *
+ *  \note
+ *  Since later operations of a chain observe the intermediate values of \f$y\f$, the
+ *  indices in \p x_ind must be free of duplicates. They do not need to be sorted.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of vector \f$x\f$.
  *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
+ *  x_val       array of \p nnz elements containing the values of \f$x\f$.
+ *  @param[in]
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[inout]
+ *  y           array of values in dense format.
+ *  @param[in]
+ *  nops        number of operations in the chain.
+ *  @param[in]
+ *  ops         array of \p nops operations to apply, in order.
+ *  @param[in]
+ *  scalars     array of 2 \f$\cdot\f$ \p nops scalars, two per operation. Can be a
+ *              null pointer if no operation of the chain consumes a scalar.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid or \p nops is invalid
+ *              or exceeds the maximum chain length.
+ *  \retval     rocsparse_status_invalid_value \p idx_base or an entry of \p ops is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p x_val, \p x_ind, \p y, \p ops or
+ *              \p scalars pointer is invalid.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
-                                       const rocsparse_mat_descr descr,
-                                       rocsparse_mat_info        info);
+rocsparse_status rocsparse_slevel1_chain(rocsparse_handle           handle,
+                                         rocsparse_int              nnz,
+                                         float*                     x_val,
+                                         const rocsparse_int*       x_ind,
+                                         float*                     y,
+                                         rocsparse_int              nops,
+                                         const rocsparse_level1_op* ops,
+                                         const float*               scalars,
+                                         rocsparse_index_base       idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dlevel1_chain(rocsparse_handle           handle,
+                                         rocsparse_int              nnz,
+                                         double*                    x_val,
+                                         const rocsparse_int*       x_ind,
+                                         double*                    y,
+                                         rocsparse_int              nops,
+                                         const rocsparse_level1_op* ops,
+                                         const double*              scalars,
+                                         rocsparse_index_base       idx_base);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    level 2 SPARSE
+ * ===========================================================================
+ */
 
 /*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+ *  \brief Sparse matrix vector multiplication using COO storage format
  *
  *  \details
- *  \p rocsparse_csrsv_solve solves a sparse triangular linear system of a sparse
- *  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution vector
- *  \f$y\f$ and the right-hand side \f$x\f$ that is multiplied by \f$\alpha\f$, such that
+ *  \p rocsparse_coomv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in COO storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
  *  \f[
- *    op(A) \cdot y = \alpha \cdot x,
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
  *  \f]
  *  with
  *  \f[
@@ -1229,18 +1607,20 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
  *    \right.
  *  \f]
  *
- *  \p rocsparse_csrsv_solve requires a user allocated temporary buffer. Its size is
- *  returned by rocsparse_scsrsv_buffer_size() or rocsparse_dcsrsv_buffer_size().
- *  Furthermore, analysis meta data is required. It can be obtained by
- *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis().
- *  \p rocsparse_csrsv_solve reports the first zero pivot (either numerical or structural
- *  zero). The zero pivot status can be checked calling rocsparse_csrsv_zero_pivot().
- *  If \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
- *  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+ *  The COO matrix has to be sorted by row indices. This can be achieved by using
+ *  rocsparse_coosort_by_row().
  *
- *  \note
- *  The sparse CSR matrix has to be sorted. This can be achieved by calling
- *  rocsparse_csrsort().
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          y[i] = beta * y[i];
+ *      }
+ *
+ *      for(i = 0; i < nnz; ++i)
+ *      {
+ *          y[coo_row_ind[i]] += alpha * coo_val[i] * x[coo_col_ind[i]];
+ *      }
+ *  \endcode
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -1254,302 +1634,217 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
  *  @param[in]
  *  trans       matrix operation type.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  m           number of rows of the sparse COO matrix.
  *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  n           number of columns of the sparse COO matrix.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of the sparse COO matrix.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start
- *              of every row of the sparse CSR matrix.
+ *  descr       descriptor of the sparse COO matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  coo_val     array of \p nnz elements of the sparse COO matrix.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+ *              matrix.
  *  @param[in]
- *  x           array of \p m elements, holding the right-hand side.
- *  @param[out]
- *  y           array of \p m elements, holding the solution.
+ *  coo_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              COO matrix.
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  x           array of \p n elements (\f$op(A) = A\f$) or \p m elements
+ *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) = A\f$) or \p n elements
+ *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p coo_val,
+ *              \p coo_row_ind, \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
- *  storage format with unit diagonal. The following example solves \f$L \cdot y = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
- *
- *      // Create matrix descriptor
- *      rocsparse_mat_descr descr;
- *      rocsparse_create_mat_descr(&descr);
- *      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
- *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Obtain required buffer size
- *      size_t buffer_size;
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size);
- *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Perform analysis step
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *
- *      // Solve Ly = x
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             x,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
- *
- *      // No zero pivot should be found, with L having unit diagonal
- *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nnz,
-                                        const float*              alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const float*              csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        rocsparse_mat_info        info,
-                                        const float*              x,
-                                        float*                    y,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
+rocsparse_status rocsparse_scoomv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              coo_val,
+                                  const rocsparse_int*      coo_row_ind,
+                                  const rocsparse_int*      coo_col_ind,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle          handle,
-                                        rocsparse_operation       trans,
-                                        rocsparse_int             m,
-                                        rocsparse_int             nnz,
-                                        const double*             alpha,
-                                        const rocsparse_mat_descr descr,
-                                        const double*             csr_val,
-                                        const rocsparse_int*      csr_row_ptr,
-                                        const rocsparse_int*      csr_col_ind,
-                                        rocsparse_mat_info        info,
-                                        const double*             x,
-                                        double*                   y,
-                                        rocsparse_solve_policy    policy,
-                                        void*                     temp_buffer);
+rocsparse_status rocsparse_dcoomv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             coo_val,
+                                  const rocsparse_int*      coo_row_ind,
+                                  const rocsparse_int*      coo_col_ind,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccoomv(rocsparse_handle               handle,
+                                  rocsparse_operation            trans,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* coo_val,
+                                  const rocsparse_int*           coo_row_ind,
+                                  const rocsparse_int*           coo_col_ind,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
+                                  rocsparse_operation             trans,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* coo_val,
+                                  const rocsparse_int*            coo_row_ind,
+                                  const rocsparse_int*            coo_col_ind,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       y);
 /**@}*/
 
 /*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using ELL storage format
+ *  \brief Sparse matrix vector multiplication using CSR storage format
  *
  *  \details
- *  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
- *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
- *  such that
- *  \f[
- *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans == rocsparse_operation_none} \\
- *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
- *  \f]
- *
- *  \code{.c}
- *      for(i = 0; i < m; ++i)
- *      {
- *          y[i] = beta * y[i];
- *
- *          for(p = 0; p < ell_width; ++p)
- *          {
- *              idx = p * m + i;
+ *  \p rocsparse_csrmv_analysis performs the analysis step for rocsparse_scsrmv() and
+ *  rocsparse_dcsrmv(). It is expected that this function will be executed only once for
+ *  a given matrix and particular operation type. The gathered analysis meta data can be
+ *  cleared by rocsparse_csrmv_clear().
  *
- *              if((ell_col_ind[idx] >= 0) && (ell_col_ind[idx] < n))
- *              {
- *                  y[i] = y[i] + alpha * ell_val[idx] * x[ell_col_ind[idx]];
- *              }
- *          }
- *      }
- *  \endcode
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
- *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
- *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
  *  trans       matrix operation type.
  *  @param[in]
- *  m           number of rows of the sparse ELL matrix.
- *  @param[in]
- *  n           number of columns of the sparse ELL matrix.
- *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  descr       descriptor of the sparse ELL matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  n           number of columns of the sparse CSR matrix.
  *  @param[in]
- *  ell_val     array that contains the elements of the sparse ELL matrix. Padded
- *              elements should be zero.
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  ell_col_ind array that contains the column indices of the sparse ELL matrix.
- *              Padded column indices should be -1.
+ *  descr       descriptor of the sparse CSR matrix.
  *  @param[in]
- *  ell_width   number of non-zero elements per row of the sparse ELL matrix.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
- *  beta        scalar \f$\beta\f$.
- *  @param[inout]
- *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
- *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
- *              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              ell_val,
-                                  const rocsparse_int*      ell_col_ind,
-                                  rocsparse_int             ell_width,
-                                  const float*              x,
-                                  const float*              beta,
-                                  float*                    y);
+rocsparse_status rocsparse_scsrmv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dellmv(rocsparse_handle          handle,
-                                  rocsparse_operation       trans,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             ell_val,
-                                  const rocsparse_int*      ell_col_ind,
-                                  rocsparse_int             ell_width,
-                                  const double*             x,
-                                  const double*             beta,
-                                  double*                   y);
-
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* ell_val,
-                                  const rocsparse_int* ell_col_ind,
-                                  rocsparse_int ell_width,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
+rocsparse_status rocsparse_dcsrmv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info);
+/**@}*/
 
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required anymore for
+ *  further computation, e.g. when switching to another sparse matrix format.
+ *
+ *  \note
+ *  Calling \p rocsparse_csrmv_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ * */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* ell_val,
-                                  const rocsparse_int* ell_col_ind,
-                                  rocsparse_int ell_width,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
-/**@}*/
+rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
 /*! \ingroup level2_module
- *  \brief Sparse matrix vector multiplication using HYB storage format
+ *  \brief Sparse matrix vector multiplication using CSR storage format
  *
  *  \details
- *  \p rocsparse_hybmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
- *  matrix, defined in HYB storage format, and the dense vector \f$x\f$ and adds the
+ *  \p rocsparse_csrmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in CSR storage format, and the dense vector \f$x\f$ and adds the
  *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
  *  such that
  *  \f[
@@ -1566,6 +1861,28 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
  *    \right.
  *  \f]
  *
+ *  The \p info parameter is optional and contains information collected by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(). If present, the
+ *  information will be used to speed up the \p csrmv computation. If \p info == \p NULL,
+ *  general \p csrmv routine will be used instead.
+ *
+ *  For matrices of \ref rocsparse_matrix_type_symmetric, only one triangle of the
+ *  matrix is stored and each stored entry contributes to both \f$y_{row}\f$ and
+ *  \f$y_{col}\f$, halving the matrix traffic compared to storing both triangles.
+ *  The \p info parameter is ignored in this case.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          y[i] = beta * y[i];
+ *
+ *          for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
+ *          {
+ *              y[i] = y[i] + alpha * csr_val[j] * x[csr_col_ind[j]];
+ *          }
+ *      }
+ *  \endcode
+ *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
@@ -1573,17 +1890,41 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
  *  \note
  *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
+ *  \note
+ *  In \ref rocsparse_pointer_mode_device, this function issues no allocations,
+ *  host transfers or stream synchronization and can be captured into a hipGraph
+ *  for repeated replay. The handle device memory is allocated on first use,
+ *  hence at least one rocSPARSE function, e.g. rocsparse_scsrmv_analysis(),
+ *  has to be called with the handle before the capture starts.
+ *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
  *  trans       matrix operation type.
  *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
  *  alpha       scalar \f$\alpha\f$.
  *  @param[in]
- *  descr       descriptor of the sparse HYB matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  descr       descriptor of the sparse CSR matrix. Currently,
+ *              \ref rocsparse_matrix_type_general and
+ *              \ref rocsparse_matrix_type_symmetric are supported.
  *  @param[in]
- *  hyb         matrix in HYB storage format.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information is
+ *              available.
  *  @param[in]
  *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
  *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
@@ -1595,443 +1936,386 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
- *              valid matrix sizes.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
- *              \p beta or \p y pointer is invalid.
- *  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
- *              with a valid partitioning type.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_memory_error the buffer could not be allocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *              \ref rocsparse_matrix_type is neither
+ *              \ref rocsparse_matrix_type_general nor
+ *              \ref rocsparse_matrix_type_symmetric.
+ *
+ *  \par Example
+ *  This example performs a sparse matrix vector multiplication in CSR format
+ *  using additional meta data to improve performance.
+ *  \code{.c}
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Perform analysis step to obtain meta data
+ *      rocsparse_scsrmv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                n,
+ *                                nnz,
+ *                                descr,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info);
+ *
+ *      // Compute y = Ax
+ *      rocsparse_scsrmv(handle,
+ *                       rocsparse_operation_none,
+ *                       m,
+ *                       n,
+ *                       nnz,
+ *                       &alpha,
+ *                       descr,
+ *                       csr_val,
+ *                       csr_row_ptr,
+ *                       csr_col_ind,
+ *                       info,
+ *                       x,
+ *                       &beta,
+ *                       y);
+ *
+ *      // Do more work
+ *      // ...
+ *
+ *      // Clean up
+ *      rocsparse_destroy_mat_info(info);
+ *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_shybmv(rocsparse_handle          handle,
+rocsparse_status rocsparse_scsrmv(rocsparse_handle          handle,
                                   rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             nnz,
                                   const float*              alpha,
                                   const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat   hyb,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
                                   const float*              x,
                                   const float*              beta,
                                   float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dhybmv(rocsparse_handle          handle,
+rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
                                   rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             nnz,
                                   const double*             alpha,
                                   const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat   hyb,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
                                   const double*             x,
                                   const double*             beta,
                                   double*                   y);
-/*
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_shybmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
+rocsparse_status rocsparse_ccsrmv(rocsparse_handle               handle,
+                                  rocsparse_operation            trans,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  nnz,
                                   const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int*           csr_row_ptr,
+                                  const rocsparse_int*           csr_col_ind,
+                                  rocsparse_mat_info             info,
                                   const rocsparse_float_complex* x,
                                   const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
+                                  rocsparse_float_complex*       y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
+rocsparse_status rocsparse_zcsrmv(rocsparse_handle                handle,
+                                  rocsparse_operation             trans,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   nnz,
                                   const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int*            csr_row_ptr,
+                                  const rocsparse_int*            csr_col_ind,
+                                  rocsparse_mat_info              info,
                                   const rocsparse_double_complex* x,
                                   const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
+                                  rocsparse_double_complex*       y);
 /**@}*/
 
-/*
- * ===========================================================================
- *    level 3 SPARSE
- * ===========================================================================
- */
-
-/*! \ingroup level3_module
- *  \brief Sparse matrix dense matrix multiplication using CSR storage format
+/*! \ingroup level2_module
+ *  \brief Masked sparse matrix vector multiplication using CSR storage
+ *  format
  *
  *  \details
- *  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
- *  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
- *  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
- *  is multiplied by the scalar \f$\beta\f$, such that
- *  \f[
- *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
- *  \f]
- *  with
- *  \f[
- *    op(A) = \left\{
- *    \begin{array}{ll}
- *        A,   & \text{if trans_A == rocsparse_operation_none} \\
- *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
- *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
- *  \f]
- *  and
+ *  \p rocsparse_Xcsrmv_masked multiplies the scalar \f$\alpha\f$ with the
+ *  rows of a sparse \f$m \times n\f$ matrix listed in \p mask_row_ind and
+ *  the dense vector \f$x\f$ and adds the result to the corresponding
+ *  entries of the dense vector \f$y\f$ that are multiplied by the scalar
+ *  \f$\beta\f$, such that
  *  \f[
- *    op(B) = \left\{
- *    \begin{array}{ll}
- *        B,   & \text{if trans_B == rocsparse_operation_none} \\
- *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
- *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
- *    \end{array}
- *    \right.
+ *    y_i := \alpha \cdot A_{i*} \cdot x + \beta \cdot y_i
+ *    \quad \forall i \in mask\_row\_ind.
  *  \f]
+ *  Entries of \f$y\f$ not listed in the mask are left untouched and the
+ *  matrix rows outside the mask are never read, such that incremental
+ *  updates recomputing a small subset of the rows only pay for the matrix
+ *  traffic of that subset.
  *
- *  \code{.c}
- *      for(i = 0; i < ldc; ++i)
- *      {
- *          for(j = 0; j < n; ++j)
- *          {
- *              C[i][j] = beta * C[i][j];
- *
- *              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
- *              {
- *                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
- *              }
- *          }
- *      }
- *  \endcode
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
- *  \note
- *  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
- *
  *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  trans_A     matrix \f$A\f$ operation type.
+ *  handle       handle to the rocsparse library context queue.
  *  @param[in]
- *  trans_B     matrix \f$B\f$ operation type.
+ *  trans        matrix operation type.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  m            number of rows of the sparse CSR matrix.
  *  @param[in]
- *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  n            number of columns of the sparse CSR matrix.
  *  @param[in]
- *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  nnz          number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  num_masked   number of rows listed in \p mask_row_ind.
  *  @param[in]
- *  alpha       scalar \f$\alpha\f$.
+ *  mask_row_ind array of \p num_masked row indices to compute, following
+ *               the index base of \p descr. Each row may be listed at most
+ *               once.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  alpha        scalar \f$\alpha\f$.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  descr        descriptor of the sparse CSR matrix. Currently, only
+ *               \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix \f$A\f$.
+ *  csr_val      array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix \f$A\f$.
+ *  csr_row_ptr  array of \p m+1 elements that point to the start
+ *               of every row of the sparse CSR matrix.
  *  @param[in]
- *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
- *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+ *  csr_col_ind  array of \p nnz elements containing the column indices of
+ *               the sparse CSR matrix.
  *  @param[in]
- *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
- *              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
- *              \f$op(A) == A^H\f$).
+ *  x            array of \p n elements.
  *  @param[in]
- *  beta        scalar \f$\beta\f$.
+ *  beta         scalar \f$\beta\f$.
  *  @param[inout]
- *  C           array of dimension \f$ldc \times n\f$.
- *  @param[in]
- *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
- *              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
- *              \f$op(A) == A^H\f$).
+ *  y            array of \p m elements, only the masked entries are
+ *               updated.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
- *              is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or
+ *              \p num_masked is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha,
+ *              \p mask_row_ind, \p csr_val, \p csr_row_ptr, \p csr_col_ind,
+ *              \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans_A != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  This example multiplies a CSR matrix with a dense matrix.
- *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
- *
- *      rocsparse_int m   = 3;
- *      rocsparse_int k   = 5;
- *      rocsparse_int nnz = 8;
- *
- *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
- *
- *      // Set dimension n of B
- *      rocsparse_int n = 64;
- *
- *      // Allocate and generate dense matrix B
- *      std::vector<float> hB(k * n);
- *      for(rocsparse_int i = 0; i < k * n; ++i)
- *      {
- *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
- *      }
- *
- *      // Copy B to the device
- *      float* B;
- *      hipMalloc((void**)&B, sizeof(float) * k * n);
- *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
- *
- *      // alpha and beta
- *      float alpha = 1.0f;
- *      float beta  = 0.0f;
- *
- *      // Allocate memory for the resulting matrix C
- *      float* C;
- *      hipMalloc((void**)&C, sizeof(float) * m * n);
- *
- *      // Perform the matrix multiplication
- *      rocsparse_scsrmm(handle,
- *                       rocsparse_operation_none,
- *                       rocsparse_operation_none,
- *                       m,
- *                       n,
- *                       k,
- *                       nnz,
- *                       &alpha,
- *                       descr,
- *                       csr_val,
- *                       csr_row_ptr,
- *                       csr_col_ind,
- *                       B,
- *                       k,
- *                       &beta,
- *                       C,
- *                       m);
- *  \endcode
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \p descr->type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const float*              alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const float*              csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const float*              B,
-                                  rocsparse_int             ldb,
-                                  const float*              beta,
-                                  float*                    C,
-                                  rocsparse_int             ldc);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
-                                  rocsparse_operation       trans_A,
-                                  rocsparse_operation       trans_B,
-                                  rocsparse_int             m,
-                                  rocsparse_int             n,
-                                  rocsparse_int             k,
-                                  rocsparse_int             nnz,
-                                  const double*             alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const double*             csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  const double*             B,
-                                  rocsparse_int             ldb,
-                                  const double*             beta,
-                                  double*                   C,
-                                  rocsparse_int             ldc);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_float_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const rocsparse_float_complex* B,
-                                  rocsparse_int ldb,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* C,
-                                  rocsparse_int ldc);
+rocsparse_status rocsparse_scsrmv_masked(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         rocsparse_int             num_masked,
+                                         const rocsparse_int*      mask_row_ind,
+                                         const float*              alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const float*              csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const float*              x,
+                                         const float*              beta,
+                                         float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrmm(rocsparse_handle handle,
-                                  rocsparse_operation trans_A,
-                                  rocsparse_operation trans_B,
-                                  rocsparse_int m,
-                                  rocsparse_int n,
-                                  rocsparse_int k,
-                                  rocsparse_int nnz,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_double_complex* csr_val,
-                                  const rocsparse_int* csr_row_ptr,
-                                  const rocsparse_int* csr_col_ind,
-                                  const rocsparse_double_complex* B,
-                                  rocsparse_int ldb,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* C,
-                                  rocsparse_int ldc);
-*/
+rocsparse_status rocsparse_dcsrmv_masked(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         rocsparse_int             num_masked,
+                                         const rocsparse_int*      mask_row_ind,
+                                         const double*             alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const double*             csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const double*             x,
+                                         const double*             beta,
+                                         double*                   y);
 /**@}*/
 
-/*
- * ===========================================================================
- *    preconditioner SPARSE
- * ===========================================================================
- */
-
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication with fused elementwise
+ *  epilogue using CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_scsrilu0() or
- *  rocsparse_dcsrilu0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
- *  is stored in \p position, using same index base as the CSR matrix.
+ *  \p rocsparse_Xcsrmv_epilogue computes
+ *  \f$y := \alpha \cdot A \cdot x + \beta \cdot y\f$ and applies the
+ *  elementwise pass selected by \p epilogue to \f$y\f$ in the output stage
+ *  of the kernel, such that the follow-up elementwise kernel and its extra
+ *  read and write of \f$y\f$ are eliminated. The epilogues of
+ *  \ref rocsparse_epilogue can be combined by bitwise OR, composed
+ *  epilogues are applied in the order diagonal scale, vector subtract,
+ *  clamp.
  *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
- *  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
- */
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int*     position);
-
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
- *  rocsparse_scsrilu0() and rocsparse_dcsrilu0(). The temporary storage buffer must
- *  be allocated by the user. The size of the temporary storage buffer is identical to
- *  the size returned by rocsparse_scsrsv_buffer_size() and
- *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
+ *  trans       matrix operation type.
  *  @param[in]
  *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
  *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
  *              sparse CSR matrix.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
+ *  x           array of \p n elements.
  *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
- *              rocsparse_scsrilu0() and rocsparse_dcsrilu0().
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *  @param[in]
+ *  epilogue    fused elementwise pass, see \ref rocsparse_epilogue.
+ *  @param[in]
+ *  diag        array of \p m elements scaling the result rows, only read if
+ *              \ref rocsparse_epilogue_diag_scale is selected, can be
+ *              \p NULL otherwise.
+ *  @param[in]
+ *  vec         array of \p m elements subtracted from the result rows, only
+ *              read if \ref rocsparse_epilogue_vector_sub is selected, can
+ *              be \p NULL otherwise.
+ *  @param[in]
+ *  clamp_lo    lower clamp bound, only read if
+ *              \ref rocsparse_epilogue_clamp is selected, can be \p NULL
+ *              otherwise.
+ *  @param[in]
+ *  clamp_hi    upper clamp bound, only read if
+ *              \ref rocsparse_epilogue_clamp is selected, can be \p NULL
+ *              otherwise.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p epilogue is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha,
+ *              \p csr_val, \p csr_row_ptr, \p csr_col_ind, \p x, \p beta,
+ *              \p y or a selected epilogue operand pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *              \p descr->type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_scsrmv_epilogue(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const float*              x,
+                                           const float*              beta,
+                                           float*                    y,
+                                           rocsparse_epilogue        epilogue,
+                                           const float*              diag,
+                                           const float*              vec,
+                                           const float*              clamp_lo,
+                                           const float*              clamp_hi);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_epilogue(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const double*             x,
+                                           const double*             beta,
+                                           double*                   y,
+                                           rocsparse_epilogue        epilogue,
+                                           const double*             diag,
+                                           const double*             vec,
+                                           const double*             clamp_lo,
+                                           const double*             clamp_hi);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+/*! \ingroup level2_module
+ *  \brief Mixed precision sparse matrix vector multiplication using CSR
  *  storage format
  *
  *  \details
- *  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0()
- *  and rocsparse_dcsrilu0(). It is expected that this function will be executed only
- *  once for a given matrix and particular operation type. The analysis meta data can be
- *  cleared by rocsparse_csrilu0_clear().
- *
- *  \p rocsparse_csrilu0_analysis can share its meta data with
- *  rocsparse_scsrsv_analysis() and rocsparse_dcsrsv_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
+ *  \p rocsparse_hscsrmv_mixed and \p rocsparse_sdcsrmv_mixed multiply the scalar
+ *  \f$\alpha\f$ with a sparse \f$m \times n\f$ matrix, defined in CSR storage
+ *  format, and the dense vector \f$x\f$ and add the result to the dense vector
+ *  \f$y\f$ that is multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot A \cdot x + \beta \cdot y.
+ *  \f]
+ *  The matrix values are stored in reduced precision and widened to the
+ *  precision of \f$x\f$ and \f$y\f$ on load, in which all computations,
+ *  including the reductions, are carried out. \p rocsparse_hscsrmv_mixed stores
+ *  the values in half precision and computes in single precision,
+ *  \p rocsparse_sdcsrmv_mixed stores the values in single precision and computes in
+ *  double precision. This halves the matrix value traffic of the bandwidth
+ *  bound kernels compared to the uniform precision routines.
+ *
+ *  Matrix meta data from rocsparse_scsrmv_analysis() or
+ *  rocsparse_dcsrmv_analysis() is honored, such that the adaptive kernel is
+ *  used whenever it has been selected during analysis.
  *
  *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2040,119 +2324,206 @@ rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
  *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
+ *  alpha       scalar \f$\alpha\f$, in compute precision.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, in storage
+ *              precision.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
  *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
  *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information
+ *              is available.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  x           array of \p n elements, in compute precision.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$, in compute precision.
+ *  @param[inout]
+ *  y           array of \p m elements, in compute precision.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_hscsrmv_mixed(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         const float*              alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const rocsparse_half*     csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         const float*              x,
+                                         const float*              beta,
+                                         float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_sdcsrmv_mixed(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         const double*             alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const float*              csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         const double*             x,
+                                         const double*             beta,
+                                         double*                   y);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+/*! \ingroup level2_module
+ *  \brief Quantized sparse matrix vector multiplication using CSR storage
+ *  format
  *
  *  \details
- *  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
- *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). This is especially
- *  useful, if memory is an issue and the analysis data is not required for further
- *  computation.
+ *  \p rocsparse_qscsrmv and \p rocsparse_qdcsrmv multiply the scalar
+ *  \f$\alpha\f$ with a sparse \f$m \times n\f$ matrix, stored as 8 bit
+ *  quantized values in CSR storage format, and the dense vector \f$x\f$ and
+ *  add the result to the dense vector \f$y\f$ that is multiplied by the
+ *  scalar \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot A \cdot x + \beta \cdot y
+ *  \f]
+ *  The value of the matrix entry stored at position \p j in row \p i is
+ *  \f$csr\_scale[i] \cdot csr\_val[j]\f$. The integer values are widened in
+ *  registers, all accumulations and reductions are carried out in the compute
+ *  precision and each row sum is dequantized once by the per row scale
+ *  factor. This cuts the matrix value traffic of the bandwidth bound kernel
+ *  by a factor of four respectively eight compared to the uniform precision
+ *  routines.
  *
  *  \note
- *  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$, in compute precision.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz quantized elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_scale   array of \p m per row scale factors, in compute precision.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  x           array of \p n elements, in compute precision.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$, in compute precision.
  *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
+ *  y           array of \p m elements, in compute precision.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_scale, \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or
+ *              \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_qscsrmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const int8_t*             csr_val,
+                                   const float*              csr_scale,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   const float*              x,
+                                   const float*              beta,
+                                   float*                    y);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
- *  storage format
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_qdcsrmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const int8_t*             csr_val,
+                                   const double*             csr_scale,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   const double*             x,
+                                   const double*             beta,
+                                   double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix multi-vector multiplication using CSR storage format
  *
  *  \details
- *  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
- *  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \p rocsparse_csrmv_multi multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSR storage format, and \p nrhs dense vectors,
+ *  stored as the columns of the \f$n \times nrhs\f$ matrix \f$X\f$ with leading
+ *  dimension \p ldx, and adds the result to the corresponding columns of the
+ *  \f$m \times nrhs\f$ matrix \f$Y\f$ with leading dimension \p ldy, that are
+ *  multiplied by the scalar \f$\beta\f$, such that
  *  \f[
- *    A \approx LU
+ *    Y := \alpha \cdot op(A) \cdot X + \beta \cdot Y
  *  \f]
- *
- *  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis()
- *  or rocsparse_dcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
- *  (either numerical or structural zero). The zero pivot status can be obtained by
- *  calling rocsparse_csrilu0_zero_pivot().
+ *  The matrix is read only once for up to 8 vectors, which are held in registers.
+ *  Larger numbers of vectors are processed in batches of 8.
  *
  *  \note
- *  The sparse CSR matrix has to be sorted. This can be achieved by calling
- *  rocsparse_csrsort().
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2161,49 +2532,5275 @@ rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
  *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
- *  @param[inout]
+ *  nrhs        number of dense vectors.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
  *  csr_val     array of \p nnz elements of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start
- *              of every row of the sparse CSR matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
  *              CSR matrix.
  *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
+ *  x           array of dimension \p ldx times \p nrhs.
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  ldx         leading dimension of \p x, must be at least \p n.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of dimension \p ldy times \p nrhs.
+ *  @param[in]
+ *  ldy         leading dimension of \p y, must be at least \p m.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
- *              or \p csr_col_ind pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz, \p nrhs, \p ldx or
+ *              \p ldy is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_multi(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        rocsparse_int             nrhs,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        const float*              x,
+                                        rocsparse_int             ldx,
+                                        const float*              beta,
+                                        float*                    y,
+                                        rocsparse_int             ldy);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_multi(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        rocsparse_int             nrhs,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        const double*             x,
+                                        rocsparse_int             ldx,
+                                        const double*             beta,
+                                        double*                   y,
+                                        rocsparse_int             ldy);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Semiring sparse matrix vector multiplication using CSR storage format
  *
- *  \par Example
- *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
- *  storage format. The following example computes the incomplete LU factorization
- *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
+ *  \details
+ *  \p rocsparse_csrmv_semiring multiplies a sparse \f$m \times n\f$ matrix,
+ *  defined in CSR storage format, with the dense vector \f$x\f$ over the
+ *  semiring selected by \p semiring, such that
+ *  \f[
+ *    y := (\beta \otimes y) \oplus \bigoplus_j (\alpha \otimes A_{ij} \otimes x_j)
+ *  \f]
+ *  with \f$\oplus\f$ and \f$\otimes\f$ the reduce and combine operators of the
+ *  semiring. For \ref rocsparse_semiring_min_plus this is the shortest path
+ *  relaxation step, for \ref rocsparse_semiring_or_and a reachability frontier
+ *  expansion. If \p beta equals the reduce identity of the semiring (e.g.
+ *  \f$\infty\f$ for min-plus), \p y is overwritten without being read.
+ *  \ref rocsparse_semiring_plus_times falls back to the conventional
+ *  rocsparse_scsrmv() and rocsparse_dcsrmv() general path.
  *
- *      // Create matrix descriptor for M
- *      rocsparse_mat_descr descr_M;
- *      rocsparse_create_mat_descr(&descr_M);
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$, combined with every matrix entry.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$, combined with every element of \f$y\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *  @param[in]
+ *  semiring    semiring the multiplication is performed over.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_value \p semiring is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_semiring(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const float*              x,
+                                           const float*              beta,
+                                           float*                    y,
+                                           rocsparse_semiring        semiring);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_semiring(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const double*             x,
+                                           const double*             beta,
+                                           double*                   y,
+                                           rocsparse_semiring        semiring);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Strided batched sparse matrix vector multiplication using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_batched multiplies the scalar \f$\alpha\f$ with a batch
+ *  of \p batch_count sparse \f$m \times n\f$ matrices that share one sparsity
+ *  pattern but hold individual values, and the dense vector \f$x\f$ and adds
+ *  the result to the corresponding dense vector of the batch \f$y\f$ that is
+ *  multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    y_i := \alpha \cdot A_i \cdot x + \beta \cdot y_i
+ *  \f]
+ *  for each batch member \f$i\f$. The values of matrix \f$i\f$ start at
+ *  \p csr_val + \p i * \p csr_val_stride, the result vector \f$y_i\f$ starts
+ *  at \p y + \p i * \p y_stride. The batch members are processed in tiles of
+ *  up to 8 value arrays that are accumulated in registers, such that the
+ *  shared pattern and \f$x\f$ are read once per tile instead of once per
+ *  member.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrices.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrices.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrices.
+ *  @param[in]
+ *  batch_count number of batch members.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrices. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p batch_count times \p csr_val_stride elements
+ *              holding the values of the sparse CSR matrices.
+ *  @param[in]
+ *  csr_val_stride stride between the value arrays of two consecutive batch
+ *              members, must be at least \p nnz.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the shared sparsity pattern.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              shared sparsity pattern.
+ *  @param[in]
+ *  x           array of \p n elements, shared by all batch members.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p batch_count times \p y_stride elements holding the
+ *              result vectors.
+ *  @param[in]
+ *  y_stride    stride between the result vectors of two consecutive batch
+ *              members, must be at least \p m.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz, \p batch_count,
+ *              \p csr_val_stride or \p y_stride is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_batched(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             nnz,
+                                          rocsparse_int             batch_count,
+                                          const float*              alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          rocsparse_int             csr_val_stride,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const float*              x,
+                                          const float*              beta,
+                                          float*                    y,
+                                          rocsparse_int             y_stride);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_batched(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             nnz,
+                                          rocsparse_int             batch_count,
+                                          const double*             alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          rocsparse_int             csr_val_stride,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const double*             x,
+                                          const double*             beta,
+                                          double*                   y,
+                                          rocsparse_int             y_stride);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Iterated sparse matrix vector multiplication using a persistent kernel
+ *
+ *  \details
+ *  \p rocsparse_csrmv_persistent computes \p niter iterations of
+ *  \f[
+ *    z_{k+1} := \alpha \cdot A \cdot z_k + \beta \cdot z_k,
+ *  \f]
+ *  with \f$z_0 = x\f$ and the result \f$z_{niter}\f$ stored in \f$y\f$, for a sparse
+ *  square matrix in CSR storage format. All iterations are performed by a single,
+ *  resident kernel that synchronizes through a grid-wide barrier, such that no
+ *  per-iteration kernel launch latency is incurred. This is beneficial for small
+ *  matrices that are applied many times, e.g. in polynomial preconditioners or
+ *  power iterations.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix, must be equal to \p m.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  niter       number of iterations.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  x           array of \p m elements, the start vector \f$z_0\f$.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[out]
+ *  y           array of \p m elements, the result \f$z_{niter}\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p niter is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_memory_error the workspace could not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_persistent(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             rocsparse_int             niter,
+                                             const float*              alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             const float*              x,
+                                             const float*              beta,
+                                             float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_persistent(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             rocsparse_int             niter,
+                                             const double*             alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             const double*             x,
+                                             const double*             beta,
+                                             double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Fused computation of the matrix powers \f$A \cdot x, \ldots, A^s \cdot x\f$
+ *
+ *  \details
+ *  \p rocsparse_csrmv_powers computes the Krylov basis vectors
+ *  \f[
+ *    A \cdot x, A^2 \cdot x, \ldots, A^s \cdot x,
+ *  \f]
+ *  for a sparse square matrix in CSR storage format, and stores them in the columns
+ *  of \f$y\f$. All powers are computed by a single, resident kernel that
+ *  synchronizes through a grid-wide barrier, such that each wavefront revisits the
+ *  same matrix rows for every power and the matrix tiles stay cache resident
+ *  across the powers. This is beneficial for communication-avoiding s-step Krylov
+ *  methods, where the basis is rebuilt every outer iteration.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix, must be equal to \p m.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  s           number of matrix powers to compute.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  x           array of \p m elements, the start vector.
+ *  @param[out]
+ *  y           array of dimension \p ldy \f$\times\f$ \p s, column \f$k\f$ holds
+ *              \f$A^{k+1} \cdot x\f$.
+ *  @param[in]
+ *  ldy         leading dimension of \p y, must be at least \p m.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz, \p s or \p ldy is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the workspace could not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_powers(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         rocsparse_int             s,
+                                         const rocsparse_mat_descr descr,
+                                         const float*              csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const float*              x,
+                                         float*                    y,
+                                         rocsparse_int             ldy);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_powers(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         rocsparse_int             s,
+                                         const rocsparse_mat_descr descr,
+                                         const double*             csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const double*             x,
+                                         double*                   y,
+                                         rocsparse_int             ldy);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Application of a matrix polynomial \f$y := p(A) \cdot x\f$
+ *
+ *  \details
+ *  \p rocsparse_csrmv_polynomial evaluates
+ *  \f[
+ *    y := \left( \sum_{k=0}^{degree} coeffs[k] \cdot A^k \right) \cdot x,
+ *  \f]
+ *  for a sparse square matrix in CSR storage format using Horner's scheme. The
+ *  scaled additions of \f$x\f$ are fused into the output stage of the matrix
+ *  vector kernel, such that the whole polynomial is applied in exactly
+ *  \p degree kernel launches and no extra pass over the vectors is required.
+ *  This is the building block of Chebyshev and polynomial smoothers, where the
+ *  recurrence is applied once per smoothing step.
+ *
+ *  \p rocsparse_csrmv_polynomial requires the meta data of
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(), which has to be
+ *  called prior to this routine.
+ *
+ *  \note
+ *  The coefficient array is read from host memory, independent of the pointer
+ *  mode set on the handle.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix, must be equal to \p m.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  degree      degree of the polynomial.
+ *  @param[in]
+ *  coeffs      host array of \p degree+1 polynomial coefficients, ordered from
+ *              the constant term to the leading term.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis().
+ *  @param[in]
+ *  x           array of \p m elements.
+ *  @param[out]
+ *  y           array of \p m elements, holds \f$p(A) \cdot x\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p degree is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p coeffs, \p descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p info, \p x or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_memory_error the workspace could not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_polynomial(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             rocsparse_int             degree,
+                                             const float*              coeffs,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const float*              x,
+                                             float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_polynomial(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             rocsparse_int             degree,
+                                             const double*             coeffs,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const double*             x,
+                                             double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication with fused dot product epilogue
+ *
+ *  \details
+ *  \p rocsparse_csrmv_dot multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times m\f$ matrix, defined in CSR storage format, and the dense vector
+ *  \f$x\f$ and adds the result to the dense vector \f$y\f$ that is multiplied by
+ *  the scalar \f$\beta\f$, and additionally returns the dot product of \f$x\f$
+ *  with the updated \f$y\f$, such that
+ *  \f[
+ *    y := \alpha \cdot A \cdot x + \beta \cdot y
+ *    \quad \text{and} \quad
+ *    dot := x^T y.
+ *  \f]
+ *  The dot product contributions are folded into the SpMV kernel while the
+ *  freshly computed \f$y\f$ elements are still in registers and finalized by a
+ *  single block reduction, which saves one full read of \f$y\f$ and one kernel
+ *  launch compared to calling a separate reduction. This is the
+ *  \f$p^T A p\f$ term of conjugate gradient type iterations.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  If \ref rocsparse_pointer_mode_device is used, \p dot is written on the
+ *  device and the function is non blocking. With
+ *  \ref rocsparse_pointer_mode_host, the function blocks until \p dot is
+ *  available on the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix, must be equal to \p m.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *  @param[out]
+ *  dot         the dot product \f$x^T y\f$ of the updated \f$y\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid or
+ *              \p m != \p n.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta, \p y or \p dot
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_dot(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const float*              alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const float*              x,
+                                      const float*              beta,
+                                      float*                    y,
+                                      float*                    dot);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_dot(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const double*             alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const double*             x,
+                                      const double*             beta,
+                                      double*                   y,
+                                      double*                   dot);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Out-of-core sparse matrix vector multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_ooc multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSR storage format in host memory, and the
+ *  dense vector \f$x\f$ and adds the result to the dense vector \f$y\f$ that is
+ *  multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot A \cdot x + \beta \cdot y
+ *  \f]
+ *  In contrast to rocsparse_scsrmv(), the matrix arrays \p csr_val, \p csr_row_ptr
+ *  and \p csr_col_ind reside in host memory and may exceed the device memory
+ *  capacity. The matrix is streamed through a double buffered staging area in row
+ *  panels, overlapping the upload of the next panel with the computation of the
+ *  current panel. The vectors \p x and \p y reside in device memory.
+ *
+ *  \note
+ *  For the upload to overlap with the computation, the matrix arrays should be
+ *  allocated with \p hipHostMalloc or registered with \p hipHostRegister. Pageable
+ *  host memory works but serializes the transfers.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, in host memory.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix, in host memory.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix, in host memory.
+ *  @param[in]
+ *  x           array of \p n elements, in device memory.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements, in device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_memory_error the staging area could not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_ooc(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const float*              alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const float*              x,
+                                      const float*              beta,
+                                      float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_ooc(rocsparse_handle          handle,
+                                      rocsparse_operation       trans,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const double*             alpha,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      const double*             x,
+                                      const double*             beta,
+                                      double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrsv_solve() or
+ *  rocsparse_dcsrsv_solve() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int*            position);
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_zero_pivot_async queries the zero pivot status of
+ *  rocsparse_scsrsv_solve() or rocsparse_dcsrsv_solve() without synchronizing the
+ *  stream. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$, or -1 if no zero pivot has
+ *  been found, is written to \p position, which must be in device memory. The write is
+ *  enqueued to the stream and becomes visible, once all previously enqueued operations
+ *  have completed.
+ *
+ *  Additionally, if \p callback is not \p NULL, it is invoked from a background thread
+ *  with the pivot index and \p user_data, once the device has reached the query point.
+ *  This allows checking for zero pivots in fully asynchronous pipelines, e.g. when
+ *  factorizing batches of matrices, without ever stalling the stream.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[out]
+ *  position    pointer to zero pivot \f$j\f$, must be in device memory.
+ *  @param[in]
+ *  callback    callback function that is invoked with the pivot index, can be \p NULL.
+ *  @param[in]
+ *  user_data   user defined pointer that is passed to \p callback.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_zero_pivot_async(rocsparse_handle              handle,
+                                                  const rocsparse_mat_descr    descr,
+                                                  rocsparse_mat_info            info,
+                                                  rocsparse_int*                position,
+                                                  rocsparse_zero_pivot_callback callback,
+                                                  void*                         user_data);
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
+ *  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *  rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve(). The temporary storage buffer
+ *  must be allocated by the user. The size of the temporary storage buffer is identical
+ *  to the size returned by rocsparse_scsrilu0_buffer_size() and
+ *  rocsparse_dcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
+ *  user allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *              rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format, strided batched
+ *
+ *  \details
+ *  \p rocsparse_csrsv_buffer_size_batched returns the size of the temporary storage
+ *  buffer that is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *  rocsparse_scsrsv_solve_batched() and rocsparse_dcsrsv_solve_batched() for a batch of
+ *  \p batch_count matrices that share the same sparsity pattern. The temporary storage
+ *  buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of each sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of each sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrices.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the first sparse CSR matrix of the batch.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              shared sparsity pattern.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the shared
+ *              sparsity pattern.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  batch_count number of matrices in the batch.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *              rocsparse_scsrsv_solve_batched() and rocsparse_dcsrsv_solve_batched().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p batch_count is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_buffer_size_batched(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float*              csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_int             batch_count,
+                                                      size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_buffer_size_batched(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double*             csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_int             batch_count,
+                                                      size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_analysis performs the analysis step for rocsparse_scsrsv_solve()
+ *  and rocsparse_dcsrsv_solve(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csrsv_clear().
+ *
+ *  \p rocsparse_csrsv_analysis can share its meta data with
+ *  rocsparse_scsrilu0_analysis() and rocsparse_dcsrilu0_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_level or
+ *              \ref rocsparse_solve_policy_jacobi.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation, e.g. when switching to another sparse matrix format. Calling
+ *  \p rocsparse_csrsv_clear is optional. All allocated resources will be cleared, when
+ *  the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
+                                       const rocsparse_mat_descr descr,
+                                       rocsparse_mat_info        info);
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_solve solves a sparse triangular linear system of a sparse
+ *  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution vector
+ *  \f$y\f$ and the right-hand side \f$x\f$ that is multiplied by \f$\alpha\f$, such that
+ *  \f[
+ *    op(A) \cdot y = \alpha \cdot x,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \p rocsparse_csrsv_solve requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsrsv_buffer_size() or rocsparse_dcsrsv_buffer_size().
+ *  Furthermore, analysis meta data is required. It can be obtained by
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis().
+ *  \p rocsparse_csrsv_solve reports the first zero pivot (either numerical or structural
+ *  zero). The zero pivot status can be checked calling rocsparse_csrsv_zero_pivot().
+ *  If \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
+ *  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
+ *
+ *  With \ref rocsparse_solve_policy_jacobi, the system is not solved exactly. Instead,
+ *  the solution is approximated by a fixed number of fully parallel Jacobi sweeps on
+ *  the triangular system, which avoids the dependency ordered processing of the rows
+ *  entirely. This can be sufficient, if the solve is part of a preconditioner
+ *  application.
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  A transposed solve operates on the stored (non transposed) matrix, no
+ *  transposed copy of the matrix is required. It re-uses the analysis meta data
+ *  gathered for the non transposed solve but ignores \p policy, as the rows are
+ *  always processed in dependency level order. Since only real valued precisions
+ *  are available, \ref rocsparse_operation_conjugate_transpose is treated as
+ *  \ref rocsparse_operation_transpose.
+ *
+ *  \note
+ *  In \ref rocsparse_pointer_mode_device, this function issues no allocations,
+ *  host transfers or stream synchronization and can be captured into a hipGraph
+ *  for repeated replay, e.g. together with rocsparse_scsrmv() as one iteration
+ *  of an iterative solver. The mandatory preceding rocsparse_scsrsv_analysis()
+ *  call allocates the handle device memory, the solve itself stays free of
+ *  allocations.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  x           array of \p m elements, holding the right-hand side.
+ *  @param[out]
+ *  y           array of \p m elements, holding the solution.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_level or
+ *              \ref rocsparse_solve_policy_jacobi.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none and the analysis meta data
+ *              holds no dependency levels, or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the lower triangular \f$m \times m\f$ matrix \f$L\f$, stored in CSR
+ *  storage format with unit diagonal. The following example solves \f$L \cdot y = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor
+ *      rocsparse_mat_descr descr;
+ *      rocsparse_create_mat_descr(&descr);
+ *      rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size;
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size);
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis step
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Solve Ly = x
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             x,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // No zero pivot should be found, with L having unit diagonal
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const float*              x,
+                                        float*                    y,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const double*             x,
+                                        double*                   y,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Mixed precision sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_sdcsrsv_solve solves the sparse triangular linear system
+ *  \f[
+ *    op(A) y = \alpha x,
+ *  \f]
+ *  with the matrix values stored in single precision while the right-hand
+ *  side, the solution and all computations, including the substitution and
+ *  the diagonal inversion, are in double precision. This allows incomplete
+ *  factorization preconditioners, e.g. computed by rocsparse_scsrilu0(), to
+ *  be stored in single precision and applied within a double precision
+ *  solver without materializing a double precision copy of the factors,
+ *  halving the matrix value traffic of the bandwidth bound solve.
+ *
+ *  The analysis meta data is precision agnostic, \p info gathered by
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis() on the same
+ *  sparsity pattern is honored, including the dependency levels and the
+ *  solve policy selection. The zero pivot status can be checked calling
+ *  rocsparse_csrsv_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$, in compute precision.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, in storage
+ *              precision.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  x           array of \p m elements, holding the right-hand side, in compute
+ *              precision.
+ *  @param[out]
+ *  y           array of \p m elements, holding the solution, in compute
+ *              precision.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_level or
+ *              \ref rocsparse_solve_policy_jacobi.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none and the analysis meta data
+ *              holds no dependency levels, or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdcsrsv_solve(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const double*             alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const float*              csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         const double*             x,
+                                         double*                   y,
+                                         rocsparse_solve_policy    policy,
+                                         void*                     temp_buffer);
+
+/*! \ingroup level2_module
+ *  \brief Fused lower and upper triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_lu_solve computes
+ *  \f[
+ *    y = U^{-1} L^{-1} (\alpha \cdot x),
+ *  \f]
+ *  where \f$L\f$ and \f$U\f$ are the triangles of a combined factorization, defined
+ *  in CSR storage format, as computed by rocsparse_scsrilu0() or
+ *  rocsparse_dcsrilu0(). \f$L\f$ is applied with a unit diagonal and \f$U\f$ with a
+ *  non-unit diagonal. Both solves are performed by a single kernel launch and each
+ *  row of the upper solve starts as soon as its lower solve dependencies are
+ *  resolved, instead of draining the whole lower solve at a kernel boundary. The
+ *  intermediate vector is consumed shortly after it is produced and typically
+ *  remains cache resident. This is the preferred way of applying an ILU0
+ *  preconditioner within an iterative solver.
+ *
+ *  \p rocsparse_csrsv_lu_solve requires the analysis meta data of both triangles,
+ *  gathered by rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis(), called
+ *  once with a \ref rocsparse_fill_mode_lower and once with a
+ *  \ref rocsparse_fill_mode_upper descriptor on the same \p info structure. The
+ *  temporary storage buffer of the analysis is re-used and must be allocated by the
+ *  user, its size is returned by rocsparse_scsrsv_buffer_size() or
+ *  rocsparse_dcsrsv_buffer_size().
+ *
+ *  \p rocsparse_csrsv_lu_solve reports the first zero pivot of the upper triangle
+ *  (either numerical or structural zero). The zero pivot status can be checked
+ *  calling rocsparse_csrsv_zero_pivot() with the upper fill mode descriptor.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the
+ *  host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix, the fill mode is ignored.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the combined factor.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the analysis meta data of both triangles.
+ *  @param[in]
+ *  x           array of \p m elements, holding the right-hand side.
+ *  @param[out]
+ *  y           array of \p m elements, holding the solution.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p y, \p info or
+ *              \p temp_buffer pointer is invalid, or the analysis meta data of one
+ *              of the triangles is missing.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_lu_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const float*              x,
+                                           float*                    y,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_lu_solve(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const double*             x,
+                                           double*                   y,
+                                           void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format, strided batched
+ *
+ *  \details
+ *  \p rocsparse_csrsv_solve_batched solves a batch of \p batch_count sparse triangular
+ *  linear systems
+ *  \f[
+ *    op(A_i) y_i = \alpha x_i,
+ *  \f]
+ *  where all matrices \f$A_i\f$ share the same sparsity pattern, given by
+ *  \p csr_row_ptr and \p csr_col_ind. The values of matrix \f$A_i\f$ are expected at
+ *  \p csr_val \f$+ i \cdot\f$ \p batch_stride, the right-hand side \f$x_i\f$ at
+ *  \p x \f$+ i \cdot\f$ \p x_stride and the solution \f$y_i\f$ is written to
+ *  \p y \f$+ i \cdot\f$ \p y_stride. The matrices are processed concurrently across
+ *  the workgroups, such that batches of many small systems can saturate the device.
+ *
+ *  Only a single analysis step is required for the whole batch, since all matrices
+ *  share their sparsity pattern. It can be obtained by rocsparse_scsrsv_analysis() or
+ *  rocsparse_dcsrsv_analysis(), called with the values of any matrix of the batch.
+ *  The temporary storage buffer must be allocated by the user and its size is returned
+ *  by rocsparse_scsrsv_buffer_size_batched() or rocsparse_dcsrsv_buffer_size_batched().
+ *
+ *  \p rocsparse_csrsv_solve_batched reports the first zero pivot (either numerical or
+ *  structural zero) found in any matrix of the batch. The zero pivot status can be
+ *  checked calling rocsparse_csrsv_zero_pivot(). If \ref rocsparse_diag_type ==
+ *  \ref rocsparse_diag_type_unit, no zero pivot will be reported, even if
+ *  \f$A_{j,j} = 0\f$ for some \f$j\f$.
+ *
+ *  \note
+ *  Only \ref rocsparse_solve_policy_auto is supported, the matrices of the batch are
+ *  processed concurrently and no level scheduling is performed.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle       handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans        matrix operation type.
+ *  @param[in]
+ *  m            number of rows of each sparse CSR matrix.
+ *  @param[in]
+ *  nnz          number of non-zero entries of each sparse CSR matrix.
+ *  @param[in]
+ *  alpha        scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr        descriptor of the sparse CSR matrices.
+ *  @param[in]
+ *  csr_val      array of \p nnz \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$
+ *               \p batch_stride elements holding the values of all matrices of the
+ *               batch.
+ *  @param[in]
+ *  batch_stride stride between the values of two consecutive matrices of the batch,
+ *               must be greater than or equal to \p nnz.
+ *  @param[in]
+ *  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
+ *               shared sparsity pattern.
+ *  @param[in]
+ *  csr_col_ind  array of \p nnz elements containing the column indices of the shared
+ *               sparsity pattern.
+ *  @param[in]
+ *  info         structure that holds the information collected during the analysis
+ *               step.
+ *  @param[in]
+ *  x            array of \p m \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$ \p x_stride
+ *               elements holding all right-hand sides of the batch.
+ *  @param[in]
+ *  x_stride     stride between two consecutive right-hand sides of the batch, must be
+ *               greater than or equal to \p m.
+ *  @param[out]
+ *  y            array of \p m \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$ \p y_stride
+ *               elements holding all solutions of the batch.
+ *  @param[in]
+ *  y_stride     stride between two consecutive solutions of the batch, must be greater
+ *               than or equal to \p m.
+ *  @param[in]
+ *  batch_count  number of systems in the batch.
+ *  @param[in]
+ *  policy       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer  temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz, \p batch_count,
+ *              \p batch_stride, \p x_stride or \p y_stride is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p y, \p info or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p policy !=
+ *              \ref rocsparse_solve_policy_auto.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_solve_batched(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const float*              alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                rocsparse_int             batch_stride,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const float*              x,
+                                                rocsparse_int             x_stride,
+                                                float*                    y,
+                                                rocsparse_int             y_stride,
+                                                rocsparse_int             batch_count,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_solve_batched(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                rocsparse_int             batch_stride,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const double*             x,
+                                                rocsparse_int             x_stride,
+                                                double*                   y,
+                                                rocsparse_int             y_stride,
+                                                rocsparse_int             batch_count,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using ELL storage format
+ *
+ *  \details
+ *  \p rocsparse_ellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in ELL storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          y[i] = beta * y[i];
+ *
+ *          for(p = 0; p < ell_width; ++p)
+ *          {
+ *              idx = p * m + i;
+ *
+ *              if((ell_col_ind[idx] >= 0) && (ell_col_ind[idx] < n))
+ *              {
+ *                  y[i] = y[i] + alpha * ell_val[idx] * x[ell_col_ind[idx]];
+ *              }
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  For real matrices, the conjugate transposed product coincides with the
+ *  transposed product.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse ELL matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse ELL matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported. The ELL
+ *              storage mode of the descriptor, see
+ *              rocsparse_set_mat_ell_pitched(), determines the slice pitch
+ *              of \p ell_val and \p ell_col_ind.
+ *  @param[in]
+ *  ell_val     array that contains the elements of the sparse ELL matrix. Padded
+ *              elements should be zero.
+ *  @param[in]
+ *  ell_col_ind array that contains the column indices of the sparse ELL matrix.
+ *              Padded column indices should be -1.
+ *  @param[in]
+ *  ell_width   number of non-zero elements per row of the sparse ELL matrix.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
+ *              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sellmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              ell_val,
+                                  const rocsparse_int*      ell_col_ind,
+                                  rocsparse_int             ell_width,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dellmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             ell_val,
+                                  const rocsparse_int*      ell_col_ind,
+                                  rocsparse_int             ell_width,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
+
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_float_complex* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_double_complex* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
+*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Dense matrix sparse vector multiplication using a column ordered matrix.
+ *
+ *  \details
+ *  \p rocsparse_gemvi multiplies the scalar \f$\alpha\f$ with the dense \f$m \times n\f$
+ *  matrix \f$op(A)\f$, given in column order, and the sparse vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *  Only the columns of \f$A\f$ that are selected by the sparse indices of \f$x\f$ are
+ *  read, such that the operation requires \f$O(m \cdot nnz)\f$ instead of
+ *  \f$O(m \cdot n)\f$ work and no scratch dense vector.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the dense matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  A           array of dimension (\p lda, \p n).
+ *  @param[in]
+ *  lda         leading dimension of \f$A\f$, must be at least \f$\max{(1, m)}\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of vector \f$x\f$.
+ *  @param[in]
+ *  x_val       array of \p nnz values.
+ *  @param[in]
+ *  x_ind       array of \p nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval rocsparse_status_invalid_size \p m, \p n, \p lda or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p alpha, \p A, \p x_val, \p x_ind,
+ *          \p beta or \p y pointer is invalid.
+ *  \retval rocsparse_status_not_implemented
+ *          \p trans != \ref rocsparse_operation_none.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgemvi(rocsparse_handle     handle,
+                                  rocsparse_operation  trans,
+                                  rocsparse_int        m,
+                                  rocsparse_int        n,
+                                  const float*         alpha,
+                                  const float*         A,
+                                  rocsparse_int        lda,
+                                  rocsparse_int        nnz,
+                                  const float*         x_val,
+                                  const rocsparse_int* x_ind,
+                                  const float*         beta,
+                                  float*               y,
+                                  rocsparse_index_base idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgemvi(rocsparse_handle     handle,
+                                  rocsparse_operation  trans,
+                                  rocsparse_int        m,
+                                  rocsparse_int        n,
+                                  const double*        alpha,
+                                  const double*        A,
+                                  rocsparse_int        lda,
+                                  rocsparse_int        nnz,
+                                  const double*        x_val,
+                                  const rocsparse_int* x_ind,
+                                  const double*        beta,
+                                  double*              y,
+                                  rocsparse_index_base idx_base);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using HYB storage format
+ *
+ *  \details
+ *  \p rocsparse_hybmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in HYB storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse HYB matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  hyb         matrix in HYB storage format.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
+ *              with a valid partitioning type.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_memory_error the buffer could not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_shybmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat   hyb,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dhybmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat   hyb,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_shybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
+*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Multi-device sparse matrix vector multiplication using DIST storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_distmv multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times m\f$ matrix, partitioned by rows across multiple devices in DIST
+ *  storage format, and the row-partitioned dense vector \f$x\f$ and adds the
+ *  result to the row-partitioned dense vector \f$y\f$ that is multiplied by the
+ *  scalar \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A, & \text{if trans == rocsparse_operation_none}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  Each partition multiplies its interior rows while the halo \f$x\f$ entries are
+ *  gathered from the owning devices through direct peer copies, such that the
+ *  interior computation overlaps the halo exchange. The boundary rows are
+ *  accumulated once the exchange has arrived.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the
+ *  host. It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handles     array of \p ndevice handles, one per partition, in the order
+ *              passed to rocsparse_scsr2dist() or rocsparse_dcsr2dist().
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  dist        matrix in DIST storage format.
+ *  @param[in]
+ *  x           array of \p ndevice device pointers, where the p-th pointer holds
+ *              the \f$x\f$ entries of the rows owned by partition p.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p ndevice device pointers, where the p-th pointer holds
+ *              the \f$y\f$ entries of the rows owned by partition p.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle \p handles or a handle in
+ *              \p handles is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p dist, \p alpha, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdistmv(rocsparse_handle*        handles,
+                                   rocsparse_operation      trans,
+                                   const float*             alpha,
+                                   const rocsparse_dist_mat dist,
+                                   const float* const*      x,
+                                   const float*             beta,
+                                   float* const*            y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddistmv(rocsparse_handle*        handles,
+                                   rocsparse_operation      trans,
+                                   const double*            alpha,
+                                   const rocsparse_dist_mat dist,
+                                   const double* const*     x,
+                                   const double*            beta,
+                                   double* const*           y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Hybrid device and host sparse matrix vector multiplication using
+ *  SPLIT storage format
+ *
+ *  \details
+ *  \p rocsparse_splitmv multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, split by rows between the device and the host in
+ *  SPLIT storage format, and the dense vector \f$x\f$ and adds the result to
+ *  the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$, such
+ *  that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A, & \text{if trans == rocsparse_operation_none}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The device resident rows are multiplied on the device while \f$x\f$ and the
+ *  host part of \f$y\f$ are staged to the host, where the remaining rows are
+ *  multiplied by a multithreaded host loop, such that the two partitions
+ *  overlap. The host results are merged back into \f$y\f$ afterwards.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, the host partition is
+ *  computed on the calling threads.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  split       matrix in SPLIT storage format.
+ *  @param[in]
+ *  x           device array of \p n elements (\f$op(A) == A\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           device array of \p m elements (\f$op(A) == A\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not
+ *              initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p split, \p alpha, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ssplitmv(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    const float*              alpha,
+                                    const rocsparse_split_mat split,
+                                    const float*              x,
+                                    const float*              beta,
+                                    float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsplitmv(rocsparse_handle          handle,
+                                    rocsparse_operation       trans,
+                                    const double*             alpha,
+                                    const rocsparse_split_mat split,
+                                    const double*             x,
+                                    const double*             beta,
+                                    double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in BSR storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  bsr         matrix in BSR storage format.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p bsr structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p bsr, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_bsr_mat   bsr,
+                                  const float*              x,
+                                  const float*              beta,
+                                  float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrmv(rocsparse_handle          handle,
+                                  rocsparse_operation       trans,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_bsr_mat   bsr,
+                                  const double*             x,
+                                  const double*             beta,
+                                  double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using DCSR storage format
+ *
+ *  \details
+ *  \p rocsparse_dcsrmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in doubly compressed sparse row storage format, and the dense vector
+ *  \f$x\f$ and adds the result to the dense vector \f$y\f$ that is multiplied by the
+ *  scalar \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The matrix rows are only scheduled for the non-empty rows of the matrix, such that
+ *  hypersparse matrices do not pay for their empty rows. \f$\beta\f$ is applied to all
+ *  \p m entries of \f$y\f$.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse DCSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  dcsr        matrix in DCSR storage format.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p dcsr structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p dcsr, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdcsrmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_dcsr_mat  dcsr,
+                                   const float*              x,
+                                   const float*              beta,
+                                   float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddcsrmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_dcsr_mat  dcsr,
+                                   const double*             x,
+                                   const double*             beta,
+                                   double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using \p SELL-C-sigma storage format
+ *
+ *  \details
+ *  \p rocsparse_sellmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in SELL-C-sigma storage format, and the dense vector \f$x\f$ and adds
+ *  the result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse SELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  sell        matrix in SELL-C-sigma storage format.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size the sizes of \p sell are invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p sell, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ssellmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_sell_mat  sell,
+                                   const float*              x,
+                                   const float*              beta,
+                                   float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsellmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_sell_mat  sell,
+                                   const double*             x,
+                                   const double*             beta,
+                                   double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Analysis step for the format-selecting sparse matrix vector multiplication
+ *
+ *  \details
+ *  \p rocsparse_spmv_analysis gathers the row length distribution of the sparse CSR
+ *  matrix (mean, variance and maximum) and selects and builds the internal storage
+ *  format that is expected to perform best for rocsparse_sspmv() and
+ *  rocsparse_dspmv(). The gathered meta data is stored in \p info and can be cleared
+ *  by rocsparse_spmv_clear().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis
+ *              step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the internal
+ *              representation could not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sspmv_analysis(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dspmv_analysis(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Clear spmv info structure
+ *
+ *  \details
+ *  \p rocsparse_spmv_clear deallocates all memory that was allocated by
+ *  rocsparse_sspmv_analysis() or rocsparse_dspmv_analysis().
+ *
+ *  \note
+ *  Calling \p rocsparse_spmv_clear is optional. All allocated resources will be
+ *  cleared when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup level2_module
+ *  \brief Format-selecting sparse matrix vector multiplication
+ *
+ *  \details
+ *  \p rocsparse_spmv multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, given in CSR storage format, and the dense vector \f$x\f$
+ *  and adds the result to the dense vector \f$y\f$ that is multiplied by the scalar
+ *  \f$\beta\f$. The kernel and internal storage format that were selected by
+ *  rocsparse_sspmv_analysis() or rocsparse_dspmv_analysis() are used for the
+ *  computation. If no analysis meta data is available, the CSR kernel is used.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_sspmv_analysis() or
+ *              rocsparse_dspmv_analysis().
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value the analysis meta data does not match
+ *              the given matrix.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sspmv(rocsparse_handle          handle,
+                                 rocsparse_operation       trans,
+                                 rocsparse_int             m,
+                                 rocsparse_int             n,
+                                 rocsparse_int             nnz,
+                                 const float*              alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const float*              csr_val,
+                                 const rocsparse_int*      csr_row_ptr,
+                                 const rocsparse_int*      csr_col_ind,
+                                 rocsparse_mat_info        info,
+                                 const float*              x,
+                                 const float*              beta,
+                                 float*                    y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dspmv(rocsparse_handle          handle,
+                                 rocsparse_operation       trans,
+                                 rocsparse_int             m,
+                                 rocsparse_int             n,
+                                 rocsparse_int             nnz,
+                                 const double*             alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const double*             csr_val,
+                                 const rocsparse_int*      csr_row_ptr,
+                                 const rocsparse_int*      csr_col_ind,
+                                 rocsparse_mat_info        info,
+                                 const double*             x,
+                                 const double*             beta,
+                                 double*                   y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Generic sparse matrix vector multiplication
+ *
+ *  \details
+ *  \p rocsparse_spmv multiplies the scalar \f$\alpha\f$ with a sparse matrix,
+ *  given by a generic \ref rocsparse_spmat_descr, and the dense vector
+ *  \f$x\f$ and adds the result to the dense vector \f$y\f$ that is multiplied
+ *  by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y.
+ *  \f]
+ *  The storage format and the precision are read from the descriptors at
+ *  runtime and dispatched internally to the corresponding typed kernels, such
+ *  that a single entry point covers all precisions, including the mixed
+ *  precision combinations. \p alpha and \p beta are expected in the precision
+ *  given by \p compute_type.
+ *
+ *  The following combinations of matrix data type and \p compute_type are
+ *  supported for CSR matrices:
+ *  <table>
+ *  <tr><th>matrix      <th>compute_type <th>dispatches to
+ *  <tr><td>\ref rocsparse_datatype_f32_r <td>\ref rocsparse_datatype_f32_r
+ *      <td>rocsparse_scsrmv()
+ *  <tr><td>\ref rocsparse_datatype_f64_r <td>\ref rocsparse_datatype_f64_r
+ *      <td>rocsparse_dcsrmv()
+ *  <tr><td>\ref rocsparse_datatype_f32_c <td>\ref rocsparse_datatype_f32_c
+ *      <td>rocsparse_ccsrmv()
+ *  <tr><td>\ref rocsparse_datatype_f64_c <td>\ref rocsparse_datatype_f64_c
+ *      <td>rocsparse_zcsrmv()
+ *  <tr><td>\ref rocsparse_datatype_f32_r <td>\ref rocsparse_datatype_f64_r
+ *      <td>rocsparse_sdcsrmv_mixed()
+ *  <tr><td>\ref rocsparse_datatype_f16_r <td>\ref rocsparse_datatype_f32_r
+ *      <td>rocsparse_hscsrmv_mixed()
+ *  </table>
+ *
+ *  Analysis meta data gathered on the matrix, e.g. by rocsparse_scsrmv_analysis()
+ *  run on the same arrays, is held by the descriptor and honored by the
+ *  dispatched kernels.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle       handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans        matrix operation type.
+ *  @param[in]
+ *  alpha        scalar \f$\alpha\f$, in compute precision.
+ *  @param[in]
+ *  mat          sparse matrix descriptor.
+ *  @param[in]
+ *  x            dense vector descriptor of \f$x\f$.
+ *  @param[in]
+ *  beta         scalar \f$\beta\f$, in compute precision.
+ *  @param[inout]
+ *  y            dense vector descriptor of \f$y\f$.
+ *  @param[in]
+ *  compute_type \ref rocsparse_datatype in which the computation is carried
+ *               out.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p mat, \p x, \p y, \p alpha or
+ *              \p beta pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value the data type of \p x or \p y does
+ *              not match \p compute_type.
+ *  \retval     rocsparse_status_not_implemented the storage format or the
+ *              precision combination is not supported.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
+                                rocsparse_operation         trans,
+                                const void*                 alpha,
+                                const rocsparse_spmat_descr mat,
+                                const rocsparse_dnvec_descr x,
+                                const void*                 beta,
+                                const rocsparse_dnvec_descr y,
+                                rocsparse_datatype          compute_type);
+
+/*
+ * ===========================================================================
+ *    level 3 SPARSE
+ * ===========================================================================
+ */
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
+ *  matrix \f$A\f$, defined in CSR storage format, and the dense \f$k \times n\f$
+ *  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
+ *  is multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans_A == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *  and
+ *  \f[
+ *    op(B) = \left\{
+ *    \begin{array}{ll}
+ *        B,   & \text{if trans_B == rocsparse_operation_none} \\
+ *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+ *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  \code{.c}
+ *      for(i = 0; i < ldc; ++i)
+ *      {
+ *          for(j = 0; j < n; ++j)
+ *          {
+ *              C[i][j] = beta * C[i][j];
+ *
+ *              for(k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
+ *              {
+ *                  C[i][j] += alpha * csr_val[k] * B[csr_col_ind[k]][j];
+ *              }
+ *          }
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, \p trans_B == \ref rocsparse_operation_none is required, if
+ *  \p trans_A != \ref rocsparse_operation_none.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of dimension \f$ldb \times n\f$ (\f$op(B) == B\f$) or
+ *              \f$ldb \times k\f$ (\f$op(B) == B^T\f$ or \f$op(B) == B^H\f$).
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, m)}\f$ (\f$op(A) == A^T\f$ or
+ *              \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension \f$ldc \times n\f$.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$
+ *              (\f$op(A) == A\f$) or \f$\max{(1, k)}\f$ (\f$op(A) == A^T\f$ or
+ *              \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or \p ldc
+ *              is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example multiplies a CSR matrix with a dense matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int k   = 5;
+ *      rocsparse_int nnz = 8;
+ *
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Set dimension n of B
+ *      rocsparse_int n = 64;
+ *
+ *      // Allocate and generate dense matrix B
+ *      std::vector<float> hB(k * n);
+ *      for(rocsparse_int i = 0; i < k * n; ++i)
+ *      {
+ *          hB[i] = static_cast<float>(rand()) / RAND_MAX;
+ *      }
+ *
+ *      // Copy B to the device
+ *      float* B;
+ *      hipMalloc((void**)&B, sizeof(float) * k * n);
+ *      hipMemcpy(B, hB.data(), sizeof(float) * k * n, hipMemcpyHostToDevice);
+ *
+ *      // alpha and beta
+ *      float alpha = 1.0f;
+ *      float beta  = 0.0f;
+ *
+ *      // Allocate memory for the resulting matrix C
+ *      float* C;
+ *      hipMalloc((void**)&C, sizeof(float) * m * n);
+ *
+ *      // Perform the matrix multiplication
+ *      rocsparse_scsrmm(handle,
+ *                       rocsparse_operation_none,
+ *                       rocsparse_operation_none,
+ *                       m,
+ *                       n,
+ *                       k,
+ *                       nnz,
+ *                       &alpha,
+ *                       descr,
+ *                       csr_val,
+ *                       csr_row_ptr,
+ *                       csr_col_ind,
+ *                       B,
+ *                       k,
+ *                       &beta,
+ *                       C,
+ *                       m);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmm(rocsparse_handle               handle,
+                                  rocsparse_operation            trans_A,
+                                  rocsparse_operation            trans_B,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  k,
+                                  rocsparse_int                  nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int*           csr_row_ptr,
+                                  const rocsparse_int*           csr_col_ind,
+                                  const rocsparse_float_complex* B,
+                                  rocsparse_int                  ldb,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       C,
+                                  rocsparse_int                  ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmm(rocsparse_handle                handle,
+                                  rocsparse_operation             trans_A,
+                                  rocsparse_operation             trans_B,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   k,
+                                  rocsparse_int                   nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int*            csr_row_ptr,
+                                  const rocsparse_int*            csr_col_ind,
+                                  const rocsparse_double_complex* B,
+                                  rocsparse_int                   ldb,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       C,
+                                  rocsparse_int                   ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication with fused elementwise
+ *  epilogue using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_Xcsrmm_epilogue computes
+ *  \f$C := \alpha \cdot A \cdot B + \beta \cdot C\f$ and applies the
+ *  elementwise pass selected by \p epilogue to \f$C\f$ in the output stage
+ *  of the kernel, such that the follow-up elementwise kernel and its extra
+ *  read and write of \f$C\f$ are eliminated. The epilogue operands \p diag
+ *  and \p vec are indexed by the row of \f$C\f$ and broadcast across its
+ *  columns. The epilogues of \ref rocsparse_epilogue can be combined by
+ *  bitwise OR, composed epilogues are applied in the order diagonal scale,
+ *  vector subtract, clamp.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none are supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$B\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of dimension \f$ldb \times n\f$.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \p k.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension \f$ldc \times n\f$.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \p m.
+ *  @param[in]
+ *  epilogue    fused elementwise pass, see \ref rocsparse_epilogue.
+ *  @param[in]
+ *  diag        array of \p m elements scaling the result rows, only read if
+ *              \ref rocsparse_epilogue_diag_scale is selected, can be
+ *              \p NULL otherwise.
+ *  @param[in]
+ *  vec         array of \p m elements subtracted from the result rows, only
+ *              read if \ref rocsparse_epilogue_vector_sub is selected, can
+ *              be \p NULL otherwise.
+ *  @param[in]
+ *  clamp_lo    lower clamp bound, only read if
+ *              \ref rocsparse_epilogue_clamp is selected, can be \p NULL
+ *              otherwise.
+ *  @param[in]
+ *  clamp_hi    upper clamp bound, only read if
+ *              \ref rocsparse_epilogue_clamp is selected, can be \p NULL
+ *              otherwise.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz,
+ *              \p ldb or \p ldc is invalid.
+ *  \retval     rocsparse_status_invalid_value \p epilogue is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha,
+ *              \p csr_val, \p csr_row_ptr, \p csr_col_ind, \p B, \p beta,
+ *              \p C or a selected epilogue operand pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none or
+ *              \p descr->type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmm_epilogue(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const float*              B,
+                                           rocsparse_int             ldb,
+                                           const float*              beta,
+                                           float*                    C,
+                                           rocsparse_int             ldc,
+                                           rocsparse_epilogue        epilogue,
+                                           const float*              diag,
+                                           const float*              vec,
+                                           const float*              clamp_lo,
+                                           const float*              clamp_hi);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmm_epilogue(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const double*             B,
+                                           rocsparse_int             ldb,
+                                           const double*             beta,
+                                           double*                   C,
+                                           rocsparse_int             ldc,
+                                           rocsparse_epilogue        epilogue,
+                                           const double*             diag,
+                                           const double*             vec,
+                                           const double*             clamp_lo,
+                                           const double*             clamp_hi);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Strided batched sparse matrix dense matrix multiplication using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmm_batched multiplies the scalar \f$\alpha\f$ with the sparse
+ *  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the dense
+ *  \f$k \times n\f$ matrices \f$B_i\f$ and adds the result to the dense
+ *  \f$m \times n\f$ matrices \f$C_i\f$ that are multiplied by the scalar
+ *  \f$\beta\f$, such that
+ *  \f[
+ *    C_i := \alpha \cdot A \cdot B_i + \beta \cdot C_i, \quad i = 0, \ldots,
+ *    \text{batch_count} - 1.
+ *  \f]
+ *  The sparsity pattern and the values of \f$A\f$ are shared by all batches. The
+ *  matrices \f$B_i\f$ and \f$C_i\f$ are separated by the batch strides
+ *  \p batch_stride_B and \p batch_stride_C, respectively. All batches are processed
+ *  by a single kernel launch, such that small dense matrices still fill the device.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A         matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B         matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n               number of columns of the dense matrices \f$B_i\f$ and \f$C_i\f$.
+ *  @param[in]
+ *  k               number of columns of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha           scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the
+ *                  sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B               array of dimension (\p batch_stride_B * \p batch_count), holding
+ *                  the dense matrices \f$B_i\f$ with leading dimension \p ldb.
+ *  @param[in]
+ *  ldb             leading dimension of the dense matrices \f$B_i\f$, must be at
+ *                  least \p k.
+ *  @param[in]
+ *  batch_stride_B  stride between two consecutive matrices \f$B_i\f$, must be at
+ *                  least \p ldb * \p n.
+ *  @param[in]
+ *  beta            scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C               array of dimension (\p batch_stride_C * \p batch_count), holding
+ *                  the dense matrices \f$C_i\f$ with leading dimension \p ldc.
+ *  @param[in]
+ *  ldc             leading dimension of the dense matrices \f$C_i\f$, must be at
+ *                  least \p m.
+ *  @param[in]
+ *  batch_stride_C  stride between two consecutive matrices \f$C_i\f$, must be at
+ *                  least \p ldc * \p n.
+ *  @param[in]
+ *  batch_count     number of batches.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb,
+ *              \p ldc, \p batch_stride_B, \p batch_stride_C or \p batch_count is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none, or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmm_batched(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          rocsparse_int             nnz,
+                                          const float*              alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const float*              B,
+                                          rocsparse_int             ldb,
+                                          rocsparse_int             batch_stride_B,
+                                          const float*              beta,
+                                          float*                    C,
+                                          rocsparse_int             ldc,
+                                          rocsparse_int             batch_stride_C,
+                                          rocsparse_int             batch_count);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmm_batched(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          rocsparse_int             nnz,
+                                          const double*             alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const double*             B,
+                                          rocsparse_int             ldb,
+                                          rocsparse_int             batch_stride_B,
+                                          const double*             beta,
+                                          double*                   C,
+                                          rocsparse_int             ldc,
+                                          rocsparse_int             batch_stride_C,
+                                          rocsparse_int             batch_count);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Mixed precision sparse matrix dense matrix multiplication using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_hscsrmm and \p rocsparse_sdcsrmm multiply the scalar
+ *  \f$\alpha\f$ with a sparse \f$m \times k\f$ matrix \f$A\f$, defined in CSR
+ *  storage format, and the dense \f$k \times n\f$ matrix \f$B\f$ and add the
+ *  result to the dense \f$m \times n\f$ matrix \f$C\f$ that is multiplied by
+ *  the scalar \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot A \cdot B + \beta \cdot C.
+ *  \f]
+ *  The matrix values of \f$A\f$ are stored in reduced precision and widened
+ *  to the precision of \f$B\f$ and \f$C\f$ on load, in which all computations
+ *  are carried out. \p rocsparse_hscsrmm stores the values in half precision
+ *  and computes in single precision, \p rocsparse_sdcsrmm stores the values
+ *  in single precision and computes in double precision.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$B\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$, in compute precision.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$, in
+ *              storage precision.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of dimension (\p ldb, \p n), in compute precision.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \p k.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$, in compute precision.
+ *  @param[inout]
+ *  C           array of dimension (\p ldc, \p n), in compute precision.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \p m.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb
+ *              or \p ldc is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_hscsrmm(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_A,
+                                   rocsparse_operation       trans_B,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   rocsparse_int             nnz,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_half*     csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   const float*              B,
+                                   rocsparse_int             ldb,
+                                   const float*              beta,
+                                   float*                    C,
+                                   rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdcsrmm(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_A,
+                                   rocsparse_operation       trans_B,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   rocsparse_int             nnz,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   const double*             B,
+                                   rocsparse_int             ldb,
+                                   const double*             beta,
+                                   double*                   C,
+                                   rocsparse_int             ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication with selectable dense
+ *  matrix layout, using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmm2 multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the
+ *  dense \f$k \times n\f$ matrix \f$B\f$ and adds the result to the dense
+ *  \f$m \times n\f$ matrix \f$C\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C.
+ *  \f]
+ *  In addition to rocsparse_scsrmm(), the memory layout of the dense matrices
+ *  \f$B\f$ and \f$C\f$ can be chosen with \p order. For
+ *  \ref rocsparse_order_row, both matrices are read and written row-major
+ *  with leading dimensions \p ldb and \p ldc, no transposes of \f$B\f$ and
+ *  \f$C\f$ are required.
+ *
+ *  \note
+ *  Currently, \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none is required, if
+ *  \p order == \ref rocsparse_order_row.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  order       memory layout of the dense matrices \f$B\f$ and \f$C\f$.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$op(B)\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of dimension (\p ldb, \p n) for column-major layout and
+ *              (\p k, \p ldb) for row-major layout.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \p k for
+ *              column-major and \p n for row-major layout.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension (\p ldc, \p n) for column-major layout and
+ *              (\p m, \p ldc) for row-major layout.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \p m for
+ *              column-major and \p n for row-major layout.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p order is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb
+ *              or \p ldc is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none with
+ *              \p order == \ref rocsparse_order_row or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmm2(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_A,
+                                   rocsparse_operation       trans_B,
+                                   rocsparse_order           order,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   rocsparse_int             nnz,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   const float*              B,
+                                   rocsparse_int             ldb,
+                                   const float*              beta,
+                                   float*                    C,
+                                   rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmm2(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_A,
+                                   rocsparse_operation       trans_B,
+                                   rocsparse_order           order,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   rocsparse_int             nnz,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   const double*             B,
+                                   rocsparse_int             ldb,
+                                   const double*             beta,
+                                   double*                   C,
+                                   rocsparse_int             ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication using COO storage format
+ *
+ *  \details
+ *  \p rocsparse_coomm multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times k\f$ matrix \f$A\f$, defined in COO storage format, and the dense
+ *  \f$k \times n\f$ matrix \f$B\f$ and adds the result to the dense
+ *  \f$m \times n\f$ matrix \f$C\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    C := \alpha \cdot A \cdot B + \beta \cdot C.
+ *  \f]
+ *
+ *  Unlike the row parallel kernels of rocsparse_scsrmm() and
+ *  rocsparse_dcsrmm(), the non-zero entries are partitioned evenly across the
+ *  wavefronts and partial row sums are combined by a segmented reduction. The
+ *  kernel is therefore insensitive to the row length distribution, which makes
+ *  it the preferred choice for heavy-tailed matrices, where single rows hold a
+ *  substantial share of all non-zeros and would idle most workgroups of a row
+ *  parallel kernel. For matrices with balanced rows, the csrmm routines are
+ *  typically faster. The COO matrix is expected to be sorted by row.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the
+ *  host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse COO matrix \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$B\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse COO matrix \f$A\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse COO matrix \f$A\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse COO matrix \f$A\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  coo_val     array of \p nnz elements of the sparse COO matrix \f$A\f$.
+ *  @param[in]
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse
+ *              COO matrix \f$A\f$, sorted by row.
+ *  @param[in]
+ *  coo_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse COO matrix \f$A\f$.
+ *  @param[in]
+ *  B           array of dimension \f$ldb \times n\f$.
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \f$\max{(1, k)}\f$.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension \f$ldc \times n\f$.
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \f$\max{(1, m)}\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p ldb or
+ *              \p ldc is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p coo_val,
+ *              \p coo_row_ind, \p coo_col_ind, \p B, \p beta or \p C pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none or
+ *              \p trans_B != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scoomm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              coo_val,
+                                  const rocsparse_int*      coo_row_ind,
+                                  const rocsparse_int*      coo_col_ind,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcoomm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             coo_val,
+                                  const rocsparse_int*      coo_row_ind,
+                                  const rocsparse_int*      coo_col_ind,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccoomm(rocsparse_handle               handle,
+                                  rocsparse_operation            trans_A,
+                                  rocsparse_operation            trans_B,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  k,
+                                  rocsparse_int                  nnz,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* coo_val,
+                                  const rocsparse_int*           coo_row_ind,
+                                  const rocsparse_int*           coo_col_ind,
+                                  const rocsparse_float_complex* B,
+                                  rocsparse_int                  ldb,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex*       C,
+                                  rocsparse_int                  ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcoomm(rocsparse_handle                handle,
+                                  rocsparse_operation             trans_A,
+                                  rocsparse_operation             trans_B,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   k,
+                                  rocsparse_int                   nnz,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* coo_val,
+                                  const rocsparse_int*            coo_row_ind,
+                                  const rocsparse_int*            coo_col_ind,
+                                  const rocsparse_double_complex* B,
+                                  rocsparse_int                   ldb,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex*       C,
+                                  rocsparse_int                   ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse triangular solve with multiple right-hand sides using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsm_solve solves a sparse triangular linear system of a sparse
+ *  \f$m \times m\f$ matrix, defined in CSR storage format, a dense solution matrix
+ *  \f$Y\f$ and the right-hand side matrix \f$X\f$ that is multiplied by \f$\alpha\f$,
+ *  such that
+ *  \f[
+ *    op(A) \cdot Y = \alpha \cdot X,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The columns of the right-hand side matrix are processed in batches, such that
+ *  the triangular factor is traversed only once per batch. This amortizes the
+ *  memory traffic of the factor across the right-hand sides, compared to solving
+ *  each column with an individual call to rocsparse_scsrsv_solve() or
+ *  rocsparse_dcsrsv_solve().
+ *
+ *  \p rocsparse_csrsm_solve requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsrsv_buffer_size() or rocsparse_dcsrsv_buffer_size().
+ *  Furthermore, analysis meta data is required. It can be obtained by
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis().
+ *  \p rocsparse_csrsm_solve reports the first zero pivot (either numerical or
+ *  structural zero). The zero pivot status can be checked calling
+ *  rocsparse_csrsv_zero_pivot(). If \ref rocsparse_diag_type ==
+ *  \ref rocsparse_diag_type_unit, no zero pivot will be reported, even if
+ *  \f$A_{j,j} = 0\f$ for some \f$j\f$.
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nrhs        number of columns of the dense matrices \f$X\f$ and \f$Y\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  x           array of dimension \f$ldx \times nrhs\f$, holding the right-hand sides.
+ *  @param[in]
+ *  ldx         leading dimension of \f$X\f$, must be at least \f$\max{(1, m)}\f$.
+ *  @param[out]
+ *  y           array of dimension \f$ldy \times nrhs\f$, holding the solution.
+ *  @param[in]
+ *  ldy         leading dimension of \f$Y\f$, must be at least \f$\max{(1, m)}\f$.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto or \ref rocsparse_solve_policy_level.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nrhs, \p nnz, \p ldx or \p ldy
+ *              is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const float*              x,
+                                        rocsparse_int             ldx,
+                                        float*                    y,
+                                        rocsparse_int             ldy,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsm_solve(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nrhs,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const double*             x,
+                                        rocsparse_int             ldx,
+                                        double*                   y,
+                                        rocsparse_int             ldy,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrgemm_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_csrgemm_nnz(), rocsparse_scsrgemm() and
+ *  rocsparse_dcsrgemm(). The temporary storage buffer must be allocated by the user.
+ *  Its size depends on the number of intermediate products of the sparse matrix
+ *  product and can therefore grow significantly beyond the memory consumption of the
+ *  input matrices.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A         matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B         matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  k               number of columns of the sparse CSR matrix \f$A\f$ and number of
+ *                  rows of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  descr_A         descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+ *                  sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  descr_B         descriptor of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+ *                  sparse CSR matrix \f$B\f$.
+ *  @param[out]
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_csrgemm_nnz(), rocsparse_scsrgemm() and
+ *                  rocsparse_dcsrgemm().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr_A or \p descr_B index base is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A or \p nnz_B is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+ *              \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B or
+ *              \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none, or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             k,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               size_t*                   buffer_size);
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrgemm_nnz computes the total CSR non-zero elements and the CSR row
+ *  pointer array of the sparse \f$m \times n\f$ matrix \f$C := A \cdot B\f$, where
+ *  \f$A\f$ is a sparse \f$m \times k\f$ matrix and \f$B\f$ is a sparse
+ *  \f$k \times n\f$ matrix, both in CSR storage format. The required temporary
+ *  storage buffer has to be allocated by the user with the size obtained by
+ *  rocsparse_csrgemm_buffer_size().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A         matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B         matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  k               number of columns of the sparse CSR matrix \f$A\f$ and number of
+ *                  rows of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  descr_A         descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+ *                  sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  descr_B         descriptor of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+ *                  sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  descr_C         descriptor of the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+ *                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned
+ *                  by rocsparse_csrgemm_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr_A, \p descr_B or \p descr_C
+ *              index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A or \p nnz_B is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+ *              \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+ *              \p descr_C, \p csr_row_ptr_C, \p nnz_C or \p temp_buffer pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none, or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            csr_row_ptr_C,
+                                       rocsparse_int*            nnz_C,
+                                       void*                     temp_buffer);
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrgemm multiplies the sparse \f$m \times k\f$ matrix \f$A\f$,
+ *  defined in CSR storage format, with the sparse \f$k \times n\f$ matrix \f$B\f$,
+ *  defined in CSR storage format, and stores the result in the sparse
+ *  \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format, such that
+ *  \f[
+ *    C := op(A) \cdot op(B),
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans_A == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *  and
+ *  \f[
+ *    op(B) = \left\{
+ *    \begin{array}{ll}
+ *        B,   & \text{if trans_B == rocsparse_operation_none} \\
+ *        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+ *        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The CSR arrays of \f$C\f$ have to be allocated by the user with the non-zero count
+ *  and the row pointer array obtained by rocsparse_csrgemm_nnz(). The column indices
+ *  per row of \f$C\f$ are sorted in ascending order. The required temporary storage
+ *  buffer has to be allocated by the user with the size obtained by
+ *  rocsparse_csrgemm_buffer_size().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A         matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B         matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  k               number of columns of the sparse CSR matrix \f$A\f$ and number of
+ *                  rows of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  descr_A         descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+ *                  sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  descr_B         descriptor of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+ *                  sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  descr_C         descriptor of the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+ *  @param[in]
+ *  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  csr_col_ind_C   array of elements containing the column indices of the sparse CSR
+ *                  matrix \f$C\f$.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned
+ *                  by rocsparse_csrgemm_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr_A, \p descr_B or \p descr_C
+ *              index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A or \p nnz_B is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr_A, \p csr_val_A,
+ *              \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B, \p csr_val_B,
+ *              \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_C, \p csr_val_C,
+ *              \p csr_row_ptr_C, \p csr_col_ind_C or \p temp_buffer pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none, or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const float*              csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const double*             csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix sparse matrix addition using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrgeam_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_csrgeam_nnz(). The temporary storage buffer must be
+ *  allocated by the user.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrices \f$A\f$, \f$B\f$ and
+ *                  \f$C\f$.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrices \f$A\f$, \f$B\f$ and
+ *                  \f$C\f$.
+ *  @param[in]
+ *  descr_A         descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+ *                  sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  descr_B         descriptor of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+ *                  sparse CSR matrix \f$B\f$.
+ *  @param[out]
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_csrgeam_nnz().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr_A or \p descr_B index base is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr_A, \p descr_B or
+ *              \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgeam_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               size_t*                   buffer_size);
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix sparse matrix addition using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrgeam_nnz computes the total CSR non-zero elements and the CSR row
+ *  pointer array of the sparse \f$m \times n\f$ matrix \f$C := \alpha \cdot A + \beta
+ *  \cdot B\f$, where \f$A\f$ and \f$B\f$ are sparse \f$m \times n\f$ matrices in CSR
+ *  storage format with sorted column indices per row. The required temporary storage
+ *  buffer has to be allocated by the user with the size obtained by
+ *  rocsparse_csrgeam_buffer_size().
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrices \f$A\f$, \f$B\f$ and
+ *                  \f$C\f$.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrices \f$A\f$, \f$B\f$ and
+ *                  \f$C\f$.
+ *  @param[in]
+ *  descr_A         descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+ *                  sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  descr_B         descriptor of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+ *                  sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  descr_C         descriptor of the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+ *                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned
+ *                  by rocsparse_csrgeam_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr_A, \p descr_B or \p descr_C
+ *              index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+ *              \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+ *              \p descr_C, \p csr_row_ptr_C, \p nnz_C or \p temp_buffer pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            csr_row_ptr_C,
+                                       rocsparse_int*            nnz_C,
+                                       void*                     temp_buffer);
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix sparse matrix addition using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrgeam adds the scaled sparse \f$m \times n\f$ matrix \f$A\f$,
+ *  defined in CSR storage format, to the scaled sparse \f$m \times n\f$ matrix
+ *  \f$B\f$, defined in CSR storage format, and stores the result in the sparse
+ *  \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format, such that
+ *  \f[
+ *    C := \alpha \cdot A + \beta \cdot B.
+ *  \f]
+ *  The column indices per row of \f$A\f$ and \f$B\f$ are assumed to be sorted in
+ *  ascending order. The CSR arrays of \f$C\f$ have to be allocated by the user with
+ *  the non-zero count and the row pointer array obtained by rocsparse_csrgeam_nnz().
+ *  The column indices per row of \f$C\f$ are sorted in ascending order.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrices \f$A\f$, \f$B\f$ and
+ *                  \f$C\f$.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrices \f$A\f$, \f$B\f$ and
+ *                  \f$C\f$.
+ *  @param[in]
+ *  alpha           scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr_A         descriptor of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+ *                  sparse CSR matrix \f$A\f$.
+ *  @param[in]
+ *  beta            scalar \f$\beta\f$.
+ *  @param[in]
+ *  descr_B         descriptor of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+ *                  sparse CSR matrix \f$B\f$.
+ *  @param[in]
+ *  descr_C         descriptor of the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+ *  @param[in]
+ *  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix \f$C\f$.
+ *  @param[out]
+ *  csr_col_ind_C   array of elements containing the column indices of the sparse CSR
+ *                  matrix \f$C\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr_A, \p descr_B or \p descr_C
+ *              index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p csr_val_A,
+ *              \p csr_row_ptr_A, \p csr_col_ind_A, \p beta, \p descr_B, \p csr_val_B,
+ *              \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_C, \p csr_val_C,
+ *              \p csr_row_ptr_C or \p csr_col_ind_C pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgeam(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const float*              csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgeam(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const double*             csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sampled dense dense matrix multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_sddmm multiplies the dense \f$m \times k\f$ matrix \f$A\f$ with the
+ *  transpose of the dense \f$n \times k\f$ matrix \f$B\f$, sampled at the sparsity
+ *  pattern of the \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format,
+ *  such that
+ *  \f[
+ *    C := \alpha \cdot (A \cdot B^T) \circ \mathrm{spy}(C) + \beta \cdot C.
+ *  \f]
+ *  Only the dot products at the non-zero positions of \f$C\f$ are computed, the
+ *  full dense product is never formed.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix \f$C\f$ and the dense matrix
+ *              \f$A\f$.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix \f$C\f$ and number of rows
+ *              of the dense matrix \f$B\f$.
+ *  @param[in]
+ *  k           number of columns of the dense matrices \f$A\f$ and \f$B\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix \f$C\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  A           array of dimension (\p lda, \p k).
+ *  @param[in]
+ *  lda         leading dimension of \f$A\f$, must be at least \p m.
+ *  @param[in]
+ *  B           array of dimension (\p ldb, \p k).
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \p n.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix \f$C\f$. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$C\f$.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix \f$C\f$.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix \f$C\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p descr index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p lda or
+ *              \p ldb is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p alpha, \p A, \p B, \p beta,
+ *              \p descr, \p csr_val, \p csr_row_ptr or \p csr_col_ind pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ssddmm(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const float*              A,
+                                  rocsparse_int             lda,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  const rocsparse_mat_descr descr,
+                                  float*                    csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsddmm(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const double*             A,
+                                  rocsparse_int             lda,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  const rocsparse_mat_descr descr,
+                                  double*                   csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Dense matrix sparse matrix multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_gemmi multiplies the scalar \f$\alpha\f$ with a dense
+ *  \f$m \times k\f$ matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix
+ *  \f$B\f$, defined in CSR storage format, and adds the result to the dense
+ *  \f$m \times n\f$ matrix \f$C\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C.
+ *  \f]
+ *  The sparse matrix is passed as the CSR matrix of \f$B^T\f$ with
+ *  \p trans_B == \ref rocsparse_operation_transpose, such that the rows of
+ *  the stored matrix can be traversed as the columns of \f$B\f$ and no
+ *  layout conversions of \f$A\f$ and \f$C\f$ are required.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_transpose is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the dense matrix \f$A\f$ and \f$C\f$.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix \f$op(B)\f$ and the
+ *              dense matrix \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the dense matrix \f$A\f$ and number of
+ *              rows of the sparse CSR matrix \f$op(B)\f$.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  A           array of dimension (\p lda, \p k).
+ *  @param[in]
+ *  lda         leading dimension of \f$A\f$, must be at least \p m.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p n+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension (\p ldc, \p n).
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \p m.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz, \p lda
+ *              or \p ldc is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p alpha, \p A, \p descr,
+ *              \p csr_val, \p csr_row_ptr, \p csr_col_ind, \p beta or \p C
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_transpose or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgemmi(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const float*              alpha,
+                                  const float*              A,
+                                  rocsparse_int             lda,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgemmi(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  rocsparse_int             nnz,
+                                  const double*             alpha,
+                                  const double*             A,
+                                  rocsparse_int             lda,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief 2:4 structured sparse matrix dense matrix multiplication
+ *
+ *  \details
+ *  \p rocsparse_s24mm multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times k\f$ matrix \f$A\f$ of 2:4 structure and the dense
+ *  \f$k \times n\f$ matrix \f$B\f$ and adds the result to the dense
+ *  \f$m \times n\f$ matrix \f$C\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot A \cdot B + \beta \cdot C.
+ *  \f]
+ *  \f$A\f$ is expected to hold exactly two non-zero entries in every group
+ *  of four consecutive columns of a row, as produced by structured pruning.
+ *  The kept values are stored in column-major order as an
+ *  \f$m \times \frac{k}{2}\f$ array \p s24_val. Byte \f$g\f$ of the
+ *  column-major \f$m \times \frac{k}{4}\f$ metadata array \p s24_meta
+ *  encodes the column offsets of the two values of group \f$g\f$ of a row
+ *  within the group, the first value in bits 0-1 and the second value in
+ *  bits 2-3. The fixed structure makes all value and metadata accesses
+ *  fully coalesced, no per-non-zero column indices are stored or fetched.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none is supported.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse 2:4 matrix \f$A\f$ and the
+ *              dense matrix \f$C\f$.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$B\f$ and \f$C\f$.
+ *  @param[in]
+ *  k           number of columns of the sparse 2:4 matrix \f$A\f$ and
+ *              number of rows of the dense matrix \f$B\f$, must be a
+ *              multiple of 4.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse 2:4 matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  s24_val     column-major array of dimension (\p m, \p k/2) containing
+ *              the kept values of the sparse 2:4 matrix.
+ *  @param[in]
+ *  s24_meta    column-major array of dimension (\p m, \p k/4) containing
+ *              the packed 2 bit column offsets of the sparse 2:4 matrix.
+ *  @param[in]
+ *  B           array of dimension (\p ldb, \p n).
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least \p k.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension (\p ldc, \p n).
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least \p m.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p k, \p ldb or
+ *              \p ldc is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p alpha, \p descr,
+ *              \p s24_val, \p s24_meta, \p B, \p beta or \p C pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ss24mm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              s24_val,
+                                  const unsigned char*      s24_meta,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ds24mm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             s24_val,
+                                  const unsigned char*      s24_meta,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+/**@}*/
+
+/*! \ingroup level3_module
+ *  \brief Sparse matrix dense matrix multiplication using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrmm multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times k\f$ matrix \f$A\f$, defined in BSR storage format, and the
+ *  dense \f$k \times n\f$ matrix \f$B\f$ and adds the result to the dense
+ *  \f$m \times n\f$ matrix \f$C\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, such that
+ *  \f[
+ *    C := \alpha \cdot A \cdot B + \beta \cdot C.
+ *  \f]
+ *  On devices with matrix core instructions, matrices with block dimension
+ *  16 are processed by feeding each non-zero block times a 16 column panel
+ *  of \f$B\f$ to the 16x16x4 matrix core fragments.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans_A == \ref rocsparse_operation_none and
+ *  \p trans_B == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans_A     matrix \f$A\f$ operation type.
+ *  @param[in]
+ *  trans_B     matrix \f$B\f$ operation type.
+ *  @param[in]
+ *  n           number of columns of the dense matrix \f$B\f$ and \f$C\f$.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  bsr         matrix in BSR storage format.
+ *  @param[in]
+ *  B           array of dimension (\p ldb, \p n).
+ *  @param[in]
+ *  ldb         leading dimension of \f$B\f$, must be at least the number of
+ *              columns of the sparse BSR matrix.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  C           array of dimension (\p ldc, \p n).
+ *  @param[in]
+ *  ldc         leading dimension of \f$C\f$, must be at least the number of
+ *              rows of the sparse BSR matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p n, \p ldb, \p ldc is invalid or
+ *              \p bsr structure was not initialized with valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p bsr, \p B,
+ *              \p beta or \p C pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans_A != \ref rocsparse_operation_none,
+ *              \p trans_B != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             n,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_bsr_mat   bsr,
+                                  const float*              B,
+                                  rocsparse_int             ldb,
+                                  const float*              beta,
+                                  float*                    C,
+                                  rocsparse_int             ldc);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrmm(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_A,
+                                  rocsparse_operation       trans_B,
+                                  rocsparse_int             n,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_bsr_mat   bsr,
+                                  const double*             B,
+                                  rocsparse_int             ldb,
+                                  const double*             beta,
+                                  double*                   C,
+                                  rocsparse_int             ldc);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    preconditioner SPARSE
+ * ===========================================================================
+ */
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrilu0() or
+ *  rocsparse_dcsrilu0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_zero_pivot_async queries the zero pivot status of
+ *  rocsparse_scsrilu0() or rocsparse_dcsrilu0() without synchronizing the stream. The
+ *  first zero pivot \f$j\f$ at \f$A_{j,j}\f$, or -1 if no zero pivot has been found,
+ *  is written to \p position, which must be in device memory. The write is enqueued to
+ *  the stream and becomes visible, once all previously enqueued operations have
+ *  completed.
+ *
+ *  Additionally, if \p callback is not \p NULL, it is invoked from a background thread
+ *  with the pivot index and \p user_data, once the device has reached the query point.
+ *  This allows checking for zero pivots in fully asynchronous pipelines, e.g. when
+ *  factorizing batches of matrices, without ever stalling the stream.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[out]
+ *  position    pointer to zero pivot \f$j\f$, must be in device memory.
+ *  @param[in]
+ *  callback    callback function that is invoked with the pivot index, can be \p NULL.
+ *  @param[in]
+ *  user_data   user defined pointer that is passed to \p callback.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_zero_pivot_async(rocsparse_handle              handle,
+                                                    rocsparse_mat_info            info,
+                                                    rocsparse_int*                position,
+                                                    rocsparse_zero_pivot_callback callback,
+                                                    void*                         user_data);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *  rocsparse_scsrilu0() and rocsparse_dcsrilu0(). The temporary storage buffer must
+ *  be allocated by the user. The size of the temporary storage buffer is identical to
+ *  the size returned by rocsparse_scsrsv_buffer_size() and
+ *  rocsparse_dcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *              rocsparse_scsrilu0() and rocsparse_dcsrilu0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format, strided batched
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_buffer_size_batched returns the size of the temporary storage
+ *  buffer that is required by rocsparse_scsrilu0_analysis(),
+ *  rocsparse_dcsrilu0_analysis(), rocsparse_scsrilu0_batched() and
+ *  rocsparse_dcsrilu0_batched() for a batch of \p batch_count matrices that share the
+ *  same sparsity pattern. The temporary storage buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of each sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of each sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrices.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the first sparse CSR matrix of the batch.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              shared sparsity pattern.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the shared
+ *              sparsity pattern.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  batch_count number of matrices in the batch.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *              rocsparse_scsrilu0_batched() and rocsparse_dcsrilu0_batched().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p batch_count is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_buffer_size_batched(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        rocsparse_int             batch_count,
+                                                        size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_buffer_size_batched(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        rocsparse_int             batch_count,
+                                                        size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0()
+ *  and rocsparse_dcsrilu0(). It is expected that this function will be executed only
+ *  once for a given matrix and particular operation type. The analysis meta data can be
+ *  cleared by rocsparse_csrilu0_clear().
+ *
+ *  \p rocsparse_csrilu0_analysis can share its meta data with
+ *  rocsparse_scsrsv_analysis() and rocsparse_dcsrsv_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used. Selecting
+ *  \ref rocsparse_analysis_policy_shared additionally gathers the lower and upper
+ *  triangular solve meta data, such that subsequent calls to
+ *  rocsparse_scsrsv_analysis() or rocsparse_dcsrsv_analysis() with
+ *  \ref rocsparse_analysis_policy_reuse become a no-op. This way, the analysis
+ *  cost is paid only once per matrix in an ILU0 preconditioned solver pipeline.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto or
+ *              \ref rocsparse_solve_policy_level.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+ *  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *
+ *  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis()
+ *  or rocsparse_dcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto or \ref rocsparse_solve_policy_level.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+ *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+ *  storage format. The following example computes the incomplete LU factorization
+ *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
  *
  *      // Create matrix descriptor for L
  *      rocsparse_mat_descr descr_L;
@@ -2211,208 +7808,4010 @@ rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
  *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
  *
- *      // Create matrix descriptor for U
- *      rocsparse_mat_descr descr_U;
- *      rocsparse_create_mat_descr(&descr_U);
- *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *      // Create matrix descriptor for U
+ *      rocsparse_mat_descr descr_U;
+ *      rocsparse_create_mat_descr(&descr_U);
+ *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_U;
+ *      rocsparse_dcsrilu0_buffer_size(handle,
+ *                                    m,
+ *                                    nnz,
+ *                                    descr_M,
+ *                                    csr_val,
+ *                                    csr_row_ptr,
+ *                                    csr_col_ind,
+ *                                    info,
+ *                                    &buffer_size_M);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_L,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dcsrsv_buffer_size(handle,
+ *                                   rocsparse_operation_none,
+ *                                   m,
+ *                                   nnz,
+ *                                   descr_U,
+ *                                   csr_val,
+ *                                   csr_row_ptr,
+ *                                   csr_col_ind,
+ *                                   info,
+ *                                   &buffer_size_U);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dcsrilu0_analysis(handle,
+ *                                  m,
+ *                                  nnz,
+ *                                  descr_M,
+ *                                  csr_val,
+ *                                  csr_row_ptr,
+ *                                  csr_col_ind,
+ *                                  info,
+ *                                  rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto,
+ *                                  temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_L,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle,
+ *                                rocsparse_operation_none,
+ *                                m,
+ *                                nnz,
+ *                                descr_U,
+ *                                csr_val,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete LU factorization
+ *      rocsparse_dcsrilu0(handle,
+ *                         m,
+ *                         nnz,
+ *                         descr_M,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         info,
+ *                         rocsparse_solve_policy_auto,
+ *                         temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("U has structural and/or numerical zero at U(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_L,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve Uy = z
+ *      rocsparse_dcsrsv_solve(handle,
+ *                             rocsparse_operation_none,
+ *                             m,
+ *                             nnz,
+ *                             &alpha,
+ *                             descr_U,
+ *                             csr_val,
+ *                             csr_row_ptr,
+ *                             csr_col_ind,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_mat_descr(descr_U);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format, strided batched
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_batched computes the incomplete LU factorization with 0
+ *  fill-ins and no pivoting of a batch of \p batch_count sparse \f$m \times m\f$ CSR
+ *  matrices that share the same sparsity pattern, such that
+ *  \f[
+ *    A_i \approx L_i U_i.
+ *  \f]
+ *  The values of matrix \f$A_i\f$ are expected at \p csr_val \f$+ i \cdot\f$
+ *  \p batch_stride and are overwritten with the factorization in place. The matrices
+ *  are processed concurrently across the workgroups, such that batches of many small
+ *  matrices can saturate the device.
+ *
+ *  Only a single analysis step is required for the whole batch, since all matrices
+ *  share their sparsity pattern. It can be obtained by rocsparse_scsrilu0_analysis()
+ *  or rocsparse_dcsrilu0_analysis(), called with the values of any matrix of the
+ *  batch. The temporary storage buffer must be allocated by the user and its size is
+ *  returned by rocsparse_scsrilu0_buffer_size_batched() or
+ *  rocsparse_dcsrilu0_buffer_size_batched().
+ *
+ *  \p rocsparse_csrilu0_batched reports the first zero pivot (either numerical or
+ *  structural zero) found in any matrix of the batch. The zero pivot status can be
+ *  checked calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  Only \ref rocsparse_solve_policy_auto is supported, the matrices of the batch are
+ *  processed concurrently and no level scheduling is performed.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle       handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m            number of rows of each sparse CSR matrix.
+ *  @param[in]
+ *  nnz          number of non-zero entries of each sparse CSR matrix.
+ *  @param[in]
+ *  descr        descriptor of the sparse CSR matrices.
+ *  @param[inout]
+ *  csr_val      array of \p nnz \f$+ (\f$ \p batch_count \f$- 1) \cdot\f$
+ *               \p batch_stride elements holding the values of all matrices of the
+ *               batch.
+ *  @param[in]
+ *  batch_stride stride between the values of two consecutive matrices of the batch,
+ *               must be greater than or equal to \p nnz.
+ *  @param[in]
+ *  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
+ *               shared sparsity pattern.
+ *  @param[in]
+ *  csr_col_ind  array of \p nnz elements containing the column indices of the shared
+ *               sparsity pattern.
+ *  @param[in]
+ *  info         structure that holds the information collected during the analysis
+ *               step.
+ *  @param[in]
+ *  batch_count  number of matrices in the batch.
+ *  @param[in]
+ *  policy       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer  temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz, \p batch_count or
+ *              \p batch_stride is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p policy !=
+ *              \ref rocsparse_solve_policy_auto.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_batched(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            float*                    csr_val,
+                                            rocsparse_int             batch_stride,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             batch_count,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_batched(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            double*                   csr_val,
+                                            rocsparse_int             batch_stride,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             batch_count,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incremental incomplete LU re-factorization using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_refactor updates an existing incomplete LU factorization with
+ *  0 fill-ins and no pivoting for new matrix values, while the sparsity pattern
+ *  remains unchanged. Instead of resolving the dependencies between the rows, the
+ *  factorization is iterated by \p nsweeps fully parallel fixed-point sweeps that are
+ *  warm-started from the previous factor values in \p csr_lu. If the values changed
+ *  only slightly since the previous factorization, e.g. between the iterations of a
+ *  quasi-Newton method, a small number of sweeps yields a factor of comparable
+ *  preconditioner quality at a fraction of the cost of rocsparse_scsrilu0() or
+ *  rocsparse_dcsrilu0().
+ *
+ *  The new matrix values are read from \p csr_val and are not modified. \p csr_lu
+ *  holds the previous factor values on entry and the updated factorization on exit.
+ *  The analysis meta data gathered by rocsparse_scsrilu0_analysis() or
+ *  rocsparse_dcsrilu0_analysis() for the initial factorization is re-used, no
+ *  additional analysis or temporary storage buffer is required.
+ *
+ *  \p rocsparse_csrilu0_refactor re-initializes the zero pivot status, since the new
+ *  values may have resolved a numerical pivot reported by a previous factorization.
+ *  The zero pivot status can be checked calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  The computed factorization is an approximation, its accuracy improves with
+ *  \p nsweeps. For an exact incomplete factorization, use rocsparse_scsrilu0() or
+ *  rocsparse_dcsrilu0().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements holding the new values of the sparse
+ *              CSR matrix.
+ *  @param[inout]
+ *  csr_lu      array of \p nnz elements holding the previous factor values on entry
+ *              and the updated factorization on exit.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis
+ *              step.
+ *  @param[in]
+ *  nsweeps     number of fixed-point sweeps.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nsweeps is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_lu,
+ *              \p csr_row_ptr, \p csr_col_ind or \p info pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_refactor(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             float*                    csr_lu,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int             nsweeps);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_refactor(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             double*                   csr_lu,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int             nsweeps);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Iterative incomplete LU factorization using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_iterative computes an approximate incomplete LU factorization
+ *  with 0 fill-ins and no pivoting of a sparse \f$m \times m\f$ CSR matrix, such that
+ *  \f[
+ *    A \approx LU.
+ *  \f]
+ *  Instead of resolving the dependencies between the rows, the factorization is
+ *  iterated by \p nsweeps fully parallel fixed-point sweeps that recompute all
+ *  non-zero entries of the factors concurrently from the current approximation,
+ *  starting from the matrix values with the lower triangular part scaled by the
+ *  diagonal. The sweeps run at full device occupancy independent of the dependency
+ *  depth of the matrix. On matrices with long dependency chains, where the exact
+ *  factorization degrades to a near-sequential computation, a small number of sweeps
+ *  yields a factor of comparable preconditioner quality at a fraction of the cost of
+ *  rocsparse_scsrilu0() or rocsparse_dcsrilu0().
+ *
+ *  The matrix values are read from \p csr_val and are not modified, the factorization
+ *  is written to \p csr_lu. The analysis meta data gathered by
+ *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis() is re-used, no
+ *  additional analysis or temporary storage buffer is required.
+ *
+ *  \p rocsparse_csrilu0_iterative re-initializes the zero pivot status. The zero
+ *  pivot status can be checked calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  The computed factorization is an approximation, its accuracy improves with
+ *  \p nsweeps. For an exact incomplete factorization, use rocsparse_scsrilu0() or
+ *  rocsparse_dcsrilu0().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements holding the values of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_lu      array of \p nnz elements holding the approximate incomplete
+ *              factorization.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis
+ *              step.
+ *  @param[in]
+ *  nsweeps     number of fixed-point sweeps.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nsweeps is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_lu,
+ *              \p csr_row_ptr, \p csr_col_ind or \p info pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_iterative(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              float*                    csr_lu,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             nsweeps);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_iterative(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              double*                   csr_lu,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             nsweeps);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsriluk() or
+ *  rocsparse_dcsriluk() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csriluk_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_csriluk_nnz(), rocsparse_scsriluk() and
+ *  rocsparse_dcsriluk(). The temporary storage buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_csriluk_nnz(), rocsparse_scsriluk() and rocsparse_dcsriluk().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_nnz computes the fill-in pattern of the incomplete LU
+ *  factorization \f$A \approx LU\f$ with fill level \p level. An entry that is
+ *  generated by eliminating entry \f$(i,k)\f$ against entry \f$(k,j)\f$ obtains the
+ *  fill level \f$\text{lev}(i,k) + \text{lev}(k,j) + 1\f$, entries of the input
+ *  matrix have fill level zero. Entries exceeding \p level are dropped from the
+ *  pattern. For \p level == 0, the pattern equals the pattern of the input matrix.
+ *
+ *  The number of non-zero entries of the factorization pattern is returned in
+ *  \p iluk_nnz and its row pointers are written to \p iluk_row_ptr, such that the
+ *  user can allocate the column indices and values arrays that are passed to
+ *  rocsparse_scsriluk() or rocsparse_dcsriluk(). The pattern is additionally stored
+ *  in \p info, together with the dependency meta data of the numerical
+ *  factorization. It can be cleared by rocsparse_csriluk_clear().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note \p rocsparse_csriluk_nnz is a blocking function. The symbolic factorization
+ *  is performed on the host. It might influence performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  level       fill level of the factorization.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the factorization pattern and the dependency
+ *              meta data.
+ *  @param[out]
+ *  iluk_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              factorization pattern.
+ *  @param[out]
+ *  iluk_nnz    number of non-zero entries of the factorization pattern, can be in
+ *              host or device memory.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p level is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p iluk_row_ptr, \p iluk_nnz or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       rocsparse_int             level,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       rocsparse_int*            iluk_row_ptr,
+                                       rocsparse_int*            iluk_nnz,
+                                       void*                     temp_buffer);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk_clear deallocates all memory that was allocated by
+ *  rocsparse_csriluk_nnz(). This is especially useful, if memory is an issue and the
+ *  factorization data is not required for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csriluk_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the factorization pattern and the dependency
+ *              meta data.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csriluk computes the incomplete LU factorization with fill level
+ *  \p level of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *
+ *  The factorization is computed on the pattern obtained by rocsparse_csriluk_nnz(),
+ *  which also needs to be called to obtain the required size of \p iluk_col_ind and
+ *  \p iluk_val. The column indices of the pattern are written to \p iluk_col_ind and
+ *  the factorization values to \p iluk_val, \f$L\f$ and \f$U\f$ are stored interleaved
+ *  in a single CSR matrix. \p rocsparse_csriluk reports the first zero pivot (either
+ *  numerical or structural zero). The zero pivot status can be obtained by calling
+ *  rocsparse_csriluk_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the factorization pattern and the dependency
+ *              meta data.
+ *  @param[out]
+ *  iluk_val    array of elements of the factorization, its size is returned by
+ *              rocsparse_csriluk_nnz().
+ *  @param[in]
+ *  iluk_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              factorization pattern, obtained by rocsparse_csriluk_nnz().
+ *  @param[out]
+ *  iluk_col_ind array of elements containing the column indices of the factorization
+ *              pattern, its size is returned by rocsparse_csriluk_nnz().
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto or \ref rocsparse_solve_policy_level.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info, \p iluk_val, \p iluk_row_ptr, \p iluk_col_ind
+ *              or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    float*                    iluk_val,
+                                    const rocsparse_int*      iluk_row_ptr,
+                                    rocsparse_int*            iluk_col_ind,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    double*                   iluk_val,
+                                    const rocsparse_int*      iluk_row_ptr,
+                                    rocsparse_int*            iluk_col_ind,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold based dropping and no pivoting
+ *  using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_nnz computes the incomplete LU factorization
+ *  \f$A \approx LU\f$ of a sparse \f$m \times m\f$ CSR matrix, dropping entries by
+ *  threshold. An eliminated entry is dropped, if its magnitude falls below \p tol,
+ *  relative to the norm of its row. Of the remaining entries, at most \p max_fill
+ *  entries are kept in the strictly lower and the strictly upper triangular part of
+ *  each row, the diagonal entry is always kept.
+ *
+ *  The factorization is computed entirely during this call and stored in \p info.
+ *  The number of non-zero entries of the factorization is returned in \p ilut_nnz
+ *  and its row pointers are written to \p ilut_row_ptr, such that the user can
+ *  allocate the column indices and values arrays that are filled by
+ *  rocsparse_scsrilut() or rocsparse_dcsrilut(). The factorization can be cleared
+ *  by rocsparse_csrilut_clear().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note \p rocsparse_csrilut_nnz is a blocking function. The factorization is
+ *  performed on the host. It might influence performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  tol         relative drop tolerance, can be in host or device memory.
+ *  @param[in]
+ *  max_fill    maximum number of entries that are kept in the strictly lower and the
+ *              strictly upper triangular part of each row.
+ *  @param[out]
+ *  info        structure that holds the computed factorization.
+ *  @param[out]
+ *  ilut_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              factorization.
+ *  @param[out]
+ *  ilut_nnz    number of non-zero entries of the factorization, can be in host or
+ *              device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_fill is invalid.
+ *  \retval     rocsparse_status_invalid_value \p tol is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p tol, \p info, \p ilut_row_ptr or \p ilut_nnz
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut_nnz(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        const float*              tol,
+                                        rocsparse_int             max_fill,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_int*            ilut_row_ptr,
+                                        rocsparse_int*            ilut_nnz);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut_nnz(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        const double*             tol,
+                                        rocsparse_int             max_fill,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_int*            ilut_row_ptr,
+                                        rocsparse_int*            ilut_nnz);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold based dropping and no pivoting
+ *  using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_clear deallocates all memory that was allocated by
+ *  rocsparse_scsrilut_nnz() or rocsparse_dcsrilut_nnz(). This is especially useful,
+ *  if memory is an issue and the factorization data is not required for further
+ *  computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csrilut_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the computed factorization.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the factorization could
+ *              not be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilut_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold based dropping and no pivoting
+ *  using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut copies the factorization that has been computed by
+ *  rocsparse_scsrilut_nnz() or rocsparse_dcsrilut_nnz() to the user arrays
+ *  \p ilut_col_ind and \p ilut_val, \f$L\f$ and \f$U\f$ are stored interleaved in a
+ *  single CSR matrix. Their required size is returned by rocsparse_scsrilut_nnz()
+ *  and rocsparse_dcsrilut_nnz().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the computed factorization.
+ *  @param[out]
+ *  ilut_val    array of elements of the factorization, its size is returned by
+ *              rocsparse_scsrilut_nnz() or rocsparse_dcsrilut_nnz().
+ *  @param[in]
+ *  ilut_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              factorization, obtained by rocsparse_scsrilut_nnz() or
+ *              rocsparse_dcsrilut_nnz().
+ *  @param[out]
+ *  ilut_col_ind array of elements containing the column indices of the factorization,
+ *              its size is returned by rocsparse_scsrilut_nnz() or
+ *              rocsparse_dcsrilut_nnz().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p info, \p ilut_val,
+ *              \p ilut_row_ptr or \p ilut_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_mat_info        info,
+                                    float*                    ilut_val,
+                                    const rocsparse_int*      ilut_row_ptr,
+                                    rocsparse_int*            ilut_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_mat_info        info,
+                                    double*                   ilut_val,
+                                    const rocsparse_int*      ilut_row_ptr,
+                                    rocsparse_int*            ilut_col_ind);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsric0() or
+ *  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+ *  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
+ *  be allocated by the user. The size of the temporary storage buffer is identical to
+ *  the size returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
+ *  rocsparse_scsrilu0_buffer_size() and rocsparse_dcsrilu0_buffer_size() if the matrix
+ *  sparsity pattern is identical. The user allocated buffer can thus be shared between
+ *  subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+ *              rocsparse_scsric0() and rocsparse_dcsric0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
+ *  and rocsparse_dcsric0(). It is expected that this function will be executed only
+ *  once for a given matrix. The analysis meta data can be cleared by
+ *  rocsparse_csric0_clear().
+ *
+ *  \p rocsparse_csric0_analysis can share its meta data with
+ *  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+ *  rocsparse_scsrsv_analysis() and rocsparse_dcsrsv_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse,
+ *              \ref rocsparse_analysis_policy_force or
+ *              \ref rocsparse_analysis_policy_shared.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0_clear deallocates all memory that was allocated by
+ *  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
+ *  useful, if memory is an issue and the analysis data is not required for further
+ *  computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_csric0_clear is optional. All allocated resources are cleared,
+ *  when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
+ *  and no pivoting of a sparse \f$m \times m\f$ symmetric positive definite CSR matrix
+ *  \f$A\f$, such that
+ *  \f[
+ *    A \approx L L^T
+ *  \f]
+ *
+ *  The factorization operates on the lower triangular part of \f$A\f$, including the
+ *  diagonal, and overwrites it with the factor \f$L\f$. Entries above the diagonal are
+ *  not touched. Compared to an LU factorization, only a single triangular factor needs
+ *  to be stored and applied.
+ *
+ *  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
+ *  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
+ *  (either numerical or structural zero, where a non-positive diagonal is reported as
+ *  numerical zero). The zero pivot status can be obtained by calling
+ *  rocsparse_csric0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+ *              or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete sparse approximate inverse of a triangular factor using
+ *  CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrisai computes an incomplete sparse approximate inverse of
+ *  the triangular factor given in CSR storage format. The approximate
+ *  inverse shares the sparsity pattern of the factor, its values are written
+ *  to \p isai_val while \p csr_row_ptr and \p csr_col_ind describe both
+ *  matrices. Each row of the approximate inverse is matched against the
+ *  corresponding row of the identity on this pattern, which amounts to one
+ *  small, independent dense triangular solve per row.
+ *
+ *  \ref rocsparse_fill_mode and \ref rocsparse_diag_type of \p descr select
+ *  the lower or upper triangular factor and whether its diagonal is unit.
+ *  For unit diagonal factors, the approximate inverse has a unit diagonal as
+ *  well, which is not stored.
+ *
+ *  Applying the preconditioner is a call to rocsparse_scsrmv() or
+ *  rocsparse_dcsrmv() per factor, replacing the dependency ordered
+ *  triangular solves of rocsparse_scsrsv_solve() and
+ *  rocsparse_dcsrsv_solve() by fully parallel SpMV.
+ *
+ *  \note \p rocsparse_csrisai is a blocking function, the zero pivot check
+ *  synchronizes with the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the triangular factor.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  isai_val    array of \p nnz elements holding the values of the approximate
+ *              inverse on the sparsity pattern of the factor.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p isai_val pointer is invalid.
+ *  \retval     rocsparse_status_zero_pivot a structural or numerical zero diagonal
+ *              entry has been found, the corresponding rows of the approximate
+ *              inverse are set to zero.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrisai(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    float*                    isai_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrisai(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    double*                   isai_val);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Strength graph of a sparse CSR matrix for algebraic multigrid setup
+ *
+ *  \details
+ *  \p rocsparse_csramg_strength_buffer_size returns the size of the temporary
+ *  storage buffer that is required by rocsparse_scsramg_strength_nnz() and
+ *  rocsparse_dcsramg_strength_nnz(). The temporary storage buffer must be
+ *  allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csramg_strength_buffer_size(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       rocsparse_int    nnz,
+                                                       size_t*          buffer_size);
+
+/*! \ingroup precond_module
+ *  \brief Strength graph of a sparse CSR matrix for algebraic multigrid setup
+ *
+ *  \details
+ *  \p rocsparse_csramg_strength_nnz computes the row pointer array and the
+ *  total number of entries of the strength graph of a sparse CSR matrix. An
+ *  off diagonal entry is part of the strength graph, if its magnitude
+ *  reaches \p theta times the largest off diagonal magnitude of its row.
+ *  Diagonal entries are never part of the strength graph. \p strength_nnz
+ *  obeys the \ref rocsparse_pointer_mode of the library context.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  theta       host scalar strength threshold in the range of 0 to 1.
+ *  @param[out]
+ *  strength_row_ptr array of \p m+1 elements that point to the start of every row of
+ *              the strength graph.
+ *  @param[out]
+ *  strength_nnz number of entries of the strength graph.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is returned by
+ *              rocsparse_csramg_strength_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p theta is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p strength_row_ptr, \p strength_nnz or \p temp_buffer
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+ *              \ref rocsparse_matrix_type_symmetric.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsramg_strength_nnz(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                float                     theta,
+                                                rocsparse_int*            strength_row_ptr,
+                                                rocsparse_int*            strength_nnz,
+                                                void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsramg_strength_nnz(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                double                    theta,
+                                                rocsparse_int*            strength_row_ptr,
+                                                rocsparse_int*            strength_nnz,
+                                                void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Strength graph of a sparse CSR matrix for algebraic multigrid setup
+ *
+ *  \details
+ *  \p rocsparse_csramg_strength fills the column indices of the strength
+ *  graph, using the row pointer array obtained by
+ *  rocsparse_scsramg_strength_nnz() or rocsparse_dcsramg_strength_nnz().
+ *  The strength graph is a pattern only matrix, no values are stored.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  theta       host scalar strength threshold in the range of 0 to 1.
+ *  @param[in]
+ *  strength_row_ptr array of \p m+1 elements that point to the start of every row of
+ *              the strength graph.
+ *  @param[out]
+ *  strength_col_ind array of \p strength_nnz elements containing the column indices
+ *              of the strength graph.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p theta is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p strength_row_ptr or \p strength_col_ind pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+ *              \ref rocsparse_matrix_type_symmetric.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsramg_strength(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            float                     theta,
+                                            const rocsparse_int*      strength_row_ptr,
+                                            rocsparse_int*            strength_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsramg_strength(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            double                    theta,
+                                            const rocsparse_int*      strength_row_ptr,
+                                            rocsparse_int*            strength_col_ind);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Parallel aggregation of a sparse CSR pattern for algebraic multigrid
+ *  setup
+ *
+ *  \details
+ *  \p rocsparse_csramg_aggregate partitions the rows of a sparse CSR pattern,
+ *  typically the strength graph obtained by rocsparse_scsramg_strength() or
+ *  rocsparse_dcsramg_strength(), into aggregates. Aggregate roots are chosen
+ *  as a maximal independent set of the pattern using hash based random
+ *  weights, the remaining rows join the aggregate of a neighboring root. On
+ *  exit, \p aggregates holds the zero based aggregate index of every row and
+ *  \p naggs the total number of aggregates. \p naggs obeys the
+ *  \ref rocsparse_pointer_mode of the library context. The pattern is
+ *  interpreted as adjacency structure and is assumed to be symmetric.
+ *
+ *  \note \p rocsparse_csramg_aggregate is a blocking function. It might
+ *  influence performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR pattern.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR pattern.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR pattern.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR pattern.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR pattern.
+ *  @param[out]
+ *  aggregates  array of \p m elements containing the zero based aggregate index of
+ *              every row.
+ *  @param[out]
+ *  naggs       number of aggregates.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p aggregates or \p naggs pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+ *              \ref rocsparse_matrix_type_symmetric.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csramg_aggregate(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int*            aggregates,
+                                            rocsparse_int*            naggs);
+
+/*! \ingroup precond_module
+ *  \brief Galerkin triple product for algebraic multigrid setup
+ *
+ *  \details
+ *  \p rocsparse_csramg_galerkin_buffer_size returns the size of the temporary
+ *  storage buffer that is required by rocsparse_csramg_galerkin_nnz(),
+ *  rocsparse_scsramg_galerkin() and rocsparse_dcsramg_galerkin(). The
+ *  temporary storage buffer must be allocated by the user and can be shared
+ *  by all precisions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  naggs       number of aggregates.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p naggs is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csramg_galerkin_buffer_size(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       rocsparse_int    nnz,
+                                                       rocsparse_int    naggs,
+                                                       size_t*          buffer_size);
+
+/*! \ingroup precond_module
+ *  \brief Galerkin triple product for algebraic multigrid setup
+ *
+ *  \details
+ *  \p rocsparse_csramg_galerkin_nnz computes the row pointer array and the
+ *  total number of entries of the coarse matrix \f$R \cdot A \cdot P\f$,
+ *  where the restriction \f$R\f$ and prolongation \f$P\f$ are given
+ *  implicitly by the aggregation obtained from
+ *  rocsparse_csramg_aggregate(). Every fine entry is mapped onto the coarse
+ *  position formed by the aggregates of its row and column index, entries
+ *  that fall onto the same coarse position are merged.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  naggs       number of aggregates, equals the dimension of the coarse matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  aggregates  array of \p m elements containing the zero based aggregate index of
+ *              every row.
+ *  @param[in]
+ *  descr_C     descriptor of the coarse CSR matrix.
+ *  @param[out]
+ *  csr_row_ptr_C array of \p naggs+1 elements that point to the start of every row of
+ *              the coarse CSR matrix.
+ *  @param[out]
+ *  nnz_C       number of non-zero entries of the coarse CSR matrix.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is returned by
+ *              rocsparse_csramg_galerkin_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p naggs is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p aggregates, \p descr_C, \p csr_row_ptr_C, \p nnz_C
+ *              or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csramg_galerkin_nnz(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               rocsparse_int             naggs,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               const rocsparse_int*      aggregates,
+                                               const rocsparse_mat_descr descr_C,
+                                               rocsparse_int*            csr_row_ptr_C,
+                                               rocsparse_int*            nnz_C,
+                                               void*                     temp_buffer);
+
+/*! \ingroup precond_module
+ *  \brief Galerkin triple product for algebraic multigrid setup
+ *
+ *  \details
+ *  \p rocsparse_csramg_galerkin computes the column indices and values of
+ *  the coarse matrix \f$R \cdot A \cdot P\f$, using the row pointer array
+ *  obtained by rocsparse_csramg_galerkin_nnz(). Every fine entry is added
+ *  onto the coarse position formed by the aggregates of its row and column
+ *  index, which corresponds to piecewise constant restriction and
+ *  prolongation operators.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  naggs       number of aggregates, equals the dimension of the coarse matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  aggregates  array of \p m elements containing the zero based aggregate index of
+ *              every row.
+ *  @param[in]
+ *  descr_C     descriptor of the coarse CSR matrix.
+ *  @param[out]
+ *  csr_val_C   array of \p nnz_C elements of the coarse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr_C array of \p naggs+1 elements that point to the start of every row of
+ *              the coarse CSR matrix.
+ *  @param[out]
+ *  csr_col_ind_C array of \p nnz_C elements containing the column indices of the
+ *              coarse CSR matrix.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is returned by
+ *              rocsparse_csramg_galerkin_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p naggs is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p aggregates, \p descr_C, \p csr_val_C,
+ *              \p csr_row_ptr_C, \p csr_col_ind_C or \p temp_buffer pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsramg_galerkin(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            rocsparse_int             naggs,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            const rocsparse_int*      aggregates,
+                                            const rocsparse_mat_descr descr_C,
+                                            float*                    csr_val_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            rocsparse_int*            csr_col_ind_C,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsramg_galerkin(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            rocsparse_int             naggs,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            const rocsparse_int*      aggregates,
+                                            const rocsparse_mat_descr descr_C,
+                                            double*                   csr_val_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            rocsparse_int*            csr_col_ind_C,
+                                            void*                     temp_buffer);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    Sparse Iterative Solvers
+ * ===========================================================================
+ */
+
+/*! \ingroup solver_module
+ *  \brief Conjugate Gradient solver using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrcg_buffer_size returns the size of the temporary storage
+ *  buffer that is required by rocsparse_scsrcg() and rocsparse_dcsrcg(). The
+ *  temporary storage buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrcg() and rocsparse_dcsrcg().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+ *              \ref rocsparse_matrix_type_symmetric.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrcg_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrcg_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup solver_module
+ *  \brief Conjugate Gradient solver using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrcg solves the linear system \f$A \cdot x = b\f$ for a
+ *  symmetric positive definite matrix in CSR storage format by the
+ *  Conjugate Gradient method, starting from the initial guess passed in
+ *  \p x. The vector updates and dot products of each iteration are fused
+ *  into few kernels and the residual norm is tracked on the device, such
+ *  that the iteration does not synchronize with the host. The solve stops
+ *  once the residual norm \f$\|b - A \cdot x\|_2\f$ drops to \p tol or
+ *  below, after \p max_iter iterations, or on a breakdown of the method.
+ *
+ *  Passing a \p info object that has been analyzed by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis() is optional.
+ *  If given, the gathered meta data is reused by every matrix vector
+ *  product of the iteration.
+ *
+ *  The number of performed iterations and the final residual norm are
+ *  returned in \p niter and \p nrm_res. \p tol and \p max_iter are always
+ *  host scalars, \p niter and \p nrm_res are written according to the
+ *  pointer mode of the handle.
+ *
+ *  \p rocsparse_csrcg requires a temporary storage buffer of size returned
+ *  by rocsparse_scsrcg_buffer_size() or rocsparse_dcsrcg_buffer_size().
+ *
+ *  \note In host pointer mode, the routine blocks until \p niter and
+ *  \p nrm_res are available on the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL.
+ *  @param[inout]
+ *  x           array of \p m elements, holding the initial guess on entry and the
+ *              approximate solution on exit.
+ *  @param[in]
+ *  b           array of \p m elements, holding the right hand side.
+ *  @param[in]
+ *  tol         host scalar tolerance on the residual norm.
+ *  @param[in]
+ *  max_iter    maximum number of iterations.
+ *  @param[out]
+ *  niter       number of performed iterations.
+ *  @param[out]
+ *  nrm_res     final residual norm \f$\|b - A \cdot x\|_2\f$.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_iter is invalid.
+ *  \retval     rocsparse_status_invalid_value \p tol is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p x, \p b, \p niter, \p nrm_res or \p temp_buffer
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+ *              \ref rocsparse_matrix_type_symmetric.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrcg(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  float*                    x,
+                                  const float*              b,
+                                  float                     tol,
+                                  rocsparse_int             max_iter,
+                                  rocsparse_int*            niter,
+                                  float*                    nrm_res,
+                                  void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrcg(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  double*                   x,
+                                  const double*             b,
+                                  double                    tol,
+                                  rocsparse_int             max_iter,
+                                  rocsparse_int*            niter,
+                                  double*                   nrm_res,
+                                  void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup solver_module
+ *  \brief BiCGStab solver using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrbicgstab_buffer_size returns the size of the temporary
+ *  storage buffer that is required by rocsparse_scsrbicgstab() and
+ *  rocsparse_dcsrbicgstab(). The temporary storage buffer must be allocated
+ *  by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrbicgstab() and rocsparse_dcsrbicgstab().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+ *              \ref rocsparse_matrix_type_symmetric.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrbicgstab_buffer_size(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrbicgstab_buffer_size(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const double*             csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup solver_module
+ *  \brief BiCGStab solver using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrbicgstab solves the linear system \f$A \cdot x = b\f$
+ *  for a general matrix in CSR storage format by the stabilized
+ *  bi-conjugate gradient method, starting from the initial guess passed in
+ *  \p x. The vector updates and dot products of each iteration are fused
+ *  into few kernels and the residual norm is tracked on the device, such
+ *  that the iteration does not synchronize with the host. The solve stops
+ *  once the residual norm \f$\|b - A \cdot x\|_2\f$ drops to \p tol or
+ *  below, after \p max_iter iterations, or on a breakdown of the method.
+ *
+ *  Passing a \p info object that has been analyzed by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis() is optional.
+ *  If given, the gathered meta data is reused by every matrix vector
+ *  product of the iteration.
+ *
+ *  The number of performed iterations and the final residual norm are
+ *  returned in \p niter and \p nrm_res. \p tol and \p max_iter are always
+ *  host scalars, \p niter and \p nrm_res are written according to the
+ *  pointer mode of the handle.
+ *
+ *  \p rocsparse_csrbicgstab requires a temporary storage buffer of size
+ *  returned by rocsparse_scsrbicgstab_buffer_size() or
+ *  rocsparse_dcsrbicgstab_buffer_size().
+ *
+ *  \note In host pointer mode, the routine blocks until \p niter and
+ *  \p nrm_res are available on the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL.
+ *  @param[inout]
+ *  x           array of \p m elements, holding the initial guess on entry and the
+ *              approximate solution on exit.
+ *  @param[in]
+ *  b           array of \p m elements, holding the right hand side.
+ *  @param[in]
+ *  tol         host scalar tolerance on the residual norm.
+ *  @param[in]
+ *  max_iter    maximum number of iterations.
+ *  @param[out]
+ *  niter       number of performed iterations.
+ *  @param[out]
+ *  nrm_res     final residual norm \f$\|b - A \cdot x\|_2\f$.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_iter is invalid.
+ *  \retval     rocsparse_status_invalid_value \p tol is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p x, \p b, \p niter, \p nrm_res or \p temp_buffer
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+ *              \ref rocsparse_matrix_type_symmetric.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrbicgstab(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        float*                    x,
+                                        const float*              b,
+                                        float                     tol,
+                                        rocsparse_int             max_iter,
+                                        rocsparse_int*            niter,
+                                        float*                    nrm_res,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrbicgstab(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        double*                   x,
+                                        const double*             b,
+                                        double                    tol,
+                                        rocsparse_int             max_iter,
+                                        rocsparse_int*            niter,
+                                        double*                   nrm_res,
+                                        void*                     temp_buffer);
+/**@}*/
+
+/*
+ * ===========================================================================
+ *    Sparse Format Conversions
+ * ===========================================================================
+ */
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse COO matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
+ *  to the start of every row, into a COO array of row indices.
+ *
+ *  \note
+ *  It can also be used to convert a CSC array containing the column offsets into a COO
+ *  array of column indices.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[out]
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+ *              matrix.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into a COO matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int n   = 5;
+ *      rocsparse_int nnz = 8;
+ *
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Allocate COO matrix arrays
+ *      rocsparse_int* coo_row_ind;
+ *      rocsparse_int* coo_col_ind;
+ *      float* coo_val;
+ *
+ *      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
+ *      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
+ *      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
+ *
+ *      // Convert the csr row offsets into coo row indices
+ *      rocsparse_csr2coo(handle,
+ *                        csr_row_ptr,
+ *                        nnz,
+ *                        m,
+ *                        coo_row_ind,
+ *                        rocsparse_index_base_zero);
+ *
+ *      // Copy the column and value arrays
+ *      hipMemcpy(coo_col_ind,
+ *                csr_col_ind,
+ *                sizeof(rocsparse_int) * nnz,
+ *                hipMemcpyDeviceToDevice);
+ *
+ *      hipMemcpy(coo_val,
+ *                csr_val,
+ *                sizeof(float) * nnz,
+ *                hipMemcpyDeviceToDevice);
+ *  \endcode
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int        nnz,
+                                   rocsparse_int        m,
+                                   rocsparse_int*       coo_row_ind,
+                                   rocsparse_index_base idx_base);
+
+/*! \ingroup conv_module
+ *  \brief Compute row length statistics of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrstat computes minimum, maximum, mean and variance of the
+ *  per row non-zero counts of a sparse CSR matrix, together with a log2
+ *  bucketed histogram of the row lengths, in a single pass over
+ *  \p csr_row_ptr. \p hist must point to \p 32 elements of device memory,
+ *  where \p hist[0] counts the empty rows and \p hist[b] counts the rows
+ *  with a length in \f$[2^{b-1}, 2^b)\f$. These statistics drive format and
+ *  kernel selection, e.g. the ELL width or the HYB partition.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, if \p row_min,
+ *  \p row_max, \p row_mean and \p row_var are requested in host memory.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[out]
+ *  row_min     minimum number of non-zero entries per row.
+ *  @param[out]
+ *  row_max     maximum number of non-zero entries per row.
+ *  @param[out]
+ *  row_mean    mean number of non-zero entries per row.
+ *  @param[out]
+ *  row_var     variance of the number of non-zero entries per row.
+ *  @param[out]
+ *  hist        array of \p 32 elements in device memory holding the log2
+ *              bucketed row length histogram.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p row_min,
+ *              \p row_max, \p row_mean, \p row_var or \p hist pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrstat(rocsparse_handle     handle,
+                                   rocsparse_int        m,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int*       row_min,
+                                   rocsparse_int*       row_max,
+                                   double*              row_mean,
+                                   double*              row_var,
+                                   rocsparse_int*       hist);
+
+/*! \ingroup conv_module
+ *  \brief Check a sparse CSR matrix for structural defects
+ *
+ *  \details
+ *  \p rocsparse_check_matrix_csr verifies the structure arrays of a sparse
+ *  CSR matrix on the device. The row offsets are checked for monotonicity
+ *  and consistency with \p nnz and the index base, the column indices are
+ *  checked against the matrix bounds, for ascending order within each row
+ *  and for duplicate entries. All defects found are combined into
+ *  \p data_status as a bit mask of \ref rocsparse_data_status values, such
+ *  that a clean matrix reports \ref rocsparse_data_status_ok. The matrix
+ *  data never leaves the device.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, if \p data_status is
+ *  requested in host memory.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[out]
+ *  data_status bit mask of the defects found in the matrix structure.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind
+ *              or \p data_status pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_check_matrix_csr(rocsparse_handle       handle,
+                                            rocsparse_int          m,
+                                            rocsparse_int          n,
+                                            rocsparse_int          nnz,
+                                            const rocsparse_int*   csr_row_ptr,
+                                            const rocsparse_int*   csr_col_ind,
+                                            rocsparse_index_base   idx_base,
+                                            rocsparse_data_status* data_status);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
+ *  required by rocsparse_scsr2csc() and rocsparse_dcsr2csc(). The temporary storage
+ *  buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              sparse_csr2csc().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *              \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     handle,
+                                               rocsparse_int        m,
+                                               rocsparse_int        n,
+                                               rocsparse_int        nnz,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_action     copy_values,
+                                               size_t*              buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
+ *  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
+ *  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
+ *  or not (\ref rocsparse_action_symbolic).
+ *
+ *  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
+ *  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
+ *
+ *  \note
+ *  The resulting matrix can also be seen as the transpose of the input matrix.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  csc_val     array of \p nnz elements of the sparse CSC matrix.
+ *  @param[out]
+ *  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+ *              matrix.
+ *  @param[out]
+ *  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
+ *              sparse CSC matrix.
+ *  @param[in]
+ *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is returned by
+ *              rocsparse_csr2csc_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *
+ *  \par Example
+ *  This example computes the transpose of a CSR matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m_A   = 3;
+ *      rocsparse_int n_A   = 5;
+ *      rocsparse_int nnz_A = 8;
+ *
+ *      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Allocate memory for transposed CSR matrix
+ *      rocsparse_int m_T   = n_A;
+ *      rocsparse_int n_T   = m_A;
+ *      rocsparse_int nnz_T = nnz_A;
+ *
+ *      rocsparse_int* csr_row_ptr_T;
+ *      rocsparse_int* csr_col_ind_T;
+ *      float* csr_val_T;
+ *
+ *      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
+ *      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
+ *      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
+ *
+ *      // Obtain the temporary buffer size
+ *      size_t buffer_size;
+ *      rocsparse_csr2csc_buffer_size(handle,
+ *                                    m_A,
+ *                                    n_A,
+ *                                    nnz_A,
+ *                                    csr_row_ptr_A,
+ *                                    csr_col_ind_A,
+ *                                    rocsparse_action_numeric,
+ *                                    &buffer_size);
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      rocsparse_scsr2csc(handle,
+ *                         m_A,
+ *                         n_A,
+ *                         nnz_A,
+ *                         csr_val_A,
+ *                         csr_row_ptr_A,
+ *                         csr_col_ind_A,
+ *                         csr_val_T,
+ *                         csr_col_ind_T,
+ *                         csr_row_ptr_T,
+ *                         rocsparse_action_numeric,
+ *                         rocsparse_index_base_zero,
+ *                         temp_buffer);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csc(rocsparse_handle     handle,
+                                    rocsparse_int        m,
+                                    rocsparse_int        n,
+                                    rocsparse_int        nnz,
+                                    const float*         csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    float*               csc_val,
+                                    rocsparse_int*       csc_row_ind,
+                                    rocsparse_int*       csc_col_ptr,
+                                    rocsparse_action     copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csc(rocsparse_handle     handle,
+                                    rocsparse_int        m,
+                                    rocsparse_int        n,
+                                    rocsparse_int        nnz,
+                                    const double*        csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    double*              csc_val,
+                                    rocsparse_int*       csc_row_ind,
+                                    rocsparse_int*       csc_col_ptr,
+                                    rocsparse_action     copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void*                temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Symbolic phase of the split CSR to CSC conversion
+ *
+ *  \details
+ *  \p rocsparse_csr2csc_analysis computes the CSC structure of the given CSR
+ *  matrix and caches the nnz permutation of the transpose in \p info. The
+ *  numeric values can subsequently be transposed by
+ *  rocsparse_scsr2csc_numeric() or rocsparse_dcsr2csc_numeric(), which reduce
+ *  to a single gather pass through the cached permutation. This split is
+ *  beneficial whenever the same sparsity pattern is transposed repeatedly
+ *  with changing values, e.g. once per timestep, as the stable radix sort of
+ *  the column indices is performed only once during the analysis.
+ *
+ *  \p rocsparse_csr2csc_analysis requires a temporary storage buffer,
+ *  allocated by the user. Its size is obtained by
+ *  rocsparse_csr2csc_buffer_size().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
+ *  @param[out]
+ *  csc_row_ind array of \p nnz elements containing the row indices of the
+ *              sparse CSC matrix.
+ *  @param[out]
+ *  csc_col_ptr array of \p n+1 elements that point to the start of every
+ *              column of the sparse CSC matrix.
+ *  @param[out]
+ *  info        structure that holds the cached nnz permutation.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is
+ *              returned by rocsparse_csr2csc_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr,
+ *              \p csr_col_ind, \p csc_row_ind, \p csc_col_ptr, \p info or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc_analysis(rocsparse_handle     handle,
+                                            rocsparse_int        m,
+                                            rocsparse_int        n,
+                                            rocsparse_int        nnz,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_int*       csc_row_ind,
+                                            rocsparse_int*       csc_col_ptr,
+                                            rocsparse_mat_info   info,
+                                            rocsparse_index_base idx_base,
+                                            void*                temp_buffer);
+
+/*! \ingroup conv_module
+ *  \brief Numeric phase of the split CSR to CSC conversion
+ *
+ *  \details
+ *  \p rocsparse_csr2csc_numeric transposes the values of a CSR matrix whose
+ *  sparsity pattern has previously been analyzed by
+ *  rocsparse_csr2csc_analysis() using the same \p info structure. The values
+ *  are gathered into their CSC position through the cached nnz permutation in
+ *  a single bandwidth bound pass, no temporary storage buffer is required.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[out]
+ *  csc_val     array of \p nnz elements of the sparse CSC matrix.
+ *  @param[in]
+ *  info        structure that holds the cached nnz permutation, obtained by
+ *              rocsparse_csr2csc_analysis().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p nnz is invalid or does not
+ *              match the analysis meta data.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csc_val or
+ *              \p info pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csc_numeric(rocsparse_handle   handle,
+                                            rocsparse_int      nnz,
+                                            const float*       csr_val,
+                                            float*             csc_val,
+                                            rocsparse_mat_info info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csc_numeric(rocsparse_handle   handle,
+                                            rocsparse_int      nnz,
+                                            const double*      csr_val,
+                                            double*            csc_val,
+                                            rocsparse_mat_info info);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Obtain the temporary buffer size for rocsparse_scsr2csc2() and
+ *  rocsparse_dcsr2csc2().
+ *
+ *  \details
+ *  \p rocsparse_csr2csc2_buffer_size returns the size of the temporary storage buffer
+ *  required by rocsparse_scsr2csc2() and rocsparse_dcsr2csc2() for the given
+ *  conversion algorithm. The temporary storage buffer must be allocated by the user.
+ *  For \ref rocsparse_csr2csc_alg_atomic, significantly less temporary storage is
+ *  required than for \ref rocsparse_csr2csc_alg_radix.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  @param[in]
+ *  alg         \ref rocsparse_csr2csc_alg_radix or \ref rocsparse_csr2csc_alg_atomic.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsr2csc2() and rocsparse_dcsr2csc2().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p alg is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *              \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc2_buffer_size(rocsparse_handle      handle,
+                                                rocsparse_int         m,
+                                                rocsparse_int         n,
+                                                rocsparse_int         nnz,
+                                                const rocsparse_int*  csr_row_ptr,
+                                                const rocsparse_int*  csr_col_ind,
+                                                rocsparse_action      copy_values,
+                                                rocsparse_csr2csc_alg alg,
+                                                size_t*               buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSC matrix using a selectable
+ *  algorithm.
+ *
+ *  \details
+ *  \p rocsparse_csr2csc2 converts a CSR matrix into a CSC matrix, like
+ *  rocsparse_scsr2csc() and rocsparse_dcsr2csc(), but allows choosing the conversion
+ *  algorithm. \ref rocsparse_csr2csc_alg_radix performs a stable radix sort of the
+ *  column indices and produces sorted row indices within each column.
+ *  \ref rocsparse_csr2csc_alg_atomic builds the CSC matrix directly from a column
+ *  histogram and atomically claimed insert positions, which avoids the full radix
+ *  sort and most of its temporary storage. With the atomic algorithm, the row
+ *  indices within each column are in undefined order.
+ *
+ *  \p rocsparse_csr2csc2 requires a temporary storage buffer, allocated by the user.
+ *  The size of this buffer can be queried using rocsparse_csr2csc2_buffer_size().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  csc_val     array of \p nnz elements of the sparse CSC matrix.
+ *  @param[out]
+ *  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+ *              matrix.
+ *  @param[out]
+ *  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
+ *              sparse CSC matrix.
+ *  @param[in]
+ *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  @param[in]
+ *  alg         \ref rocsparse_csr2csc_alg_radix or \ref rocsparse_csr2csc_alg_atomic.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user, size is returned by
+ *              rocsparse_csr2csc2_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p alg or \p idx_base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csc2(rocsparse_handle      handle,
+                                     rocsparse_int         m,
+                                     rocsparse_int         n,
+                                     rocsparse_int         nnz,
+                                     const float*          csr_val,
+                                     const rocsparse_int*  csr_row_ptr,
+                                     const rocsparse_int*  csr_col_ind,
+                                     float*                csc_val,
+                                     rocsparse_int*        csc_row_ind,
+                                     rocsparse_int*        csc_col_ptr,
+                                     rocsparse_action      copy_values,
+                                     rocsparse_csr2csc_alg alg,
+                                     rocsparse_index_base  idx_base,
+                                     void*                 temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csc2(rocsparse_handle      handle,
+                                     rocsparse_int         m,
+                                     rocsparse_int         n,
+                                     rocsparse_int         nnz,
+                                     const double*         csr_val,
+                                     const rocsparse_int*  csr_row_ptr,
+                                     const rocsparse_int*  csr_col_ind,
+                                     double*               csc_val,
+                                     rocsparse_int*        csc_row_ind,
+                                     rocsparse_int*        csc_col_ptr,
+                                     rocsparse_action      copy_values,
+                                     rocsparse_csr2csc_alg alg,
+                                     rocsparse_index_base  idx_base,
+                                     void*                 temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSC matrix with bounded
+ *  temporary storage
+ *
+ *  \details
+ *  \p rocsparse_csr2csc_chunked_buffer_size returns the minimum size of the
+ *  temporary storage buffer required by rocsparse_scsr2csc_chunked() and
+ *  rocsparse_dcsr2csc_chunked(). Any buffer exceeding the minimum enlarges the
+ *  column ranges per pass and thus reduces the number of passes over the CSR
+ *  arrays.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[out]
+ *  buffer_size minimum size of the temporary storage buffer in bytes.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc_chunked_buffer_size(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       rocsparse_int    n,
+                                                       rocsparse_int    nnz,
+                                                       size_t*          buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse CSC matrix with bounded
+ *  temporary storage
+ *
+ *  \details
+ *  \p rocsparse_csr2csc_chunked converts a CSR matrix into a CSC matrix by
+ *  streaming the matrix through in column ranges. The size of a column range
+ *  is derived from \p buffer_size, such that the peak temporary device memory
+ *  is bounded by the caller. Each column range re-reads the CSR arrays once,
+ *  trading additional passes for the ability to convert matrices close to the
+ *  device memory limit. \p copy_values decides, whether \p csc_val is being
+ *  filled during the conversion (\ref rocsparse_action_numeric) or not
+ *  (\ref rocsparse_action_symbolic). The row indices within each column are
+ *  in undefined order, the minimum \p buffer_size is obtained by
+ *  rocsparse_csr2csc_chunked_buffer_size().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
+ *  @param[out]
+ *  csc_val     array of \p nnz elements of the sparse CSC matrix.
+ *  @param[out]
+ *  csc_row_ind array of \p nnz elements containing the row indices of the
+ *              sparse CSC matrix.
+ *  @param[out]
+ *  csc_col_ptr array of \p n+1 elements that point to the start of every
+ *              column of the sparse CSC matrix.
+ *  @param[in]
+ *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  @param[in]
+ *  buffer_size size of the temporary storage buffer in bytes.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or
+ *              \p buffer_size is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csc_chunked(rocsparse_handle     handle,
+                                            rocsparse_int        m,
+                                            rocsparse_int        n,
+                                            rocsparse_int        nnz,
+                                            const float*         csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            float*               csc_val,
+                                            rocsparse_int*       csc_row_ind,
+                                            rocsparse_int*       csc_col_ptr,
+                                            rocsparse_action     copy_values,
+                                            rocsparse_index_base idx_base,
+                                            size_t               buffer_size,
+                                            void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csc_chunked(rocsparse_handle     handle,
+                                            rocsparse_int        m,
+                                            rocsparse_int        n,
+                                            rocsparse_int        nnz,
+                                            const double*        csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            double*              csc_val,
+                                            rocsparse_int*       csc_row_ind,
+                                            rocsparse_int*       csc_col_ptr,
+                                            rocsparse_action     copy_values,
+                                            rocsparse_index_base idx_base,
+                                            size_t               buffer_size,
+                                            void*                temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Compress a sparse CSR matrix by dropping small entries
+ *
+ *  \details
+ *  \p rocsparse_csr2csr_compress_buffer_size returns the size of the temporary
+ *  storage buffer required by rocsparse_scsr2csr_compress_nnz() and
+ *  rocsparse_dcsr2csr_compress_nnz(). The temporary storage buffer must be
+ *  allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csr_compress_buffer_size(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        rocsparse_int    n,
+                                                        rocsparse_int    nnz,
+                                                        size_t*          buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Compress a sparse CSR matrix by dropping small entries
+ *
+ *  \details
+ *  \p rocsparse_csr2csr_compress_nnz computes the row pointer array and the
+ *  total number of non-zero entries of the compressed CSR matrix, where all
+ *  entries with a magnitude below or equal to \p tol are removed. \p nnz_C
+ *  obeys the \ref rocsparse_pointer_mode of the library context. The required
+ *  temporary storage buffer size is obtained by
+ *  rocsparse_csr2csr_compress_buffer_size().
+ *
+ *  @param[in]
+ *  handle        handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m             number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n             number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz           number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr         descriptor of the sparse CSR matrix. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val       array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr   array of \p m+1 elements that point to the start of every row
+ *                of the sparse CSR matrix.
+ *  @param[in]
+ *  tol           non-negative tolerance, entries with a magnitude below or
+ *                equal to \p tol are removed.
+ *  @param[out]
+ *  csr_row_ptr_C array of \p m+1 elements that point to the start of every row
+ *                of the compressed CSR matrix.
+ *  @param[out]
+ *  nnz_C         pointer to the number of non-zero entries of the compressed
+ *                CSR matrix.
+ *  @param[in]
+ *  temp_buffer   temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p tol is negative.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_row_ptr_C, \p nnz_C or \p temp_buffer
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csr_compress_nnz(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 float                     tol,
+                                                 rocsparse_int*            csr_row_ptr_C,
+                                                 rocsparse_int*            nnz_C,
+                                                 void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csr_compress_nnz(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 double                    tol,
+                                                 rocsparse_int*            csr_row_ptr_C,
+                                                 rocsparse_int*            nnz_C,
+                                                 void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Compress a sparse CSR matrix by dropping small entries
+ *
+ *  \details
+ *  \p rocsparse_csr2csr_compress gathers all entries with a magnitude above
+ *  \p tol into the compressed CSR matrix. It is assumed that \p csr_row_ptr_C
+ *  and the number of non-zero entries of the compressed matrix have been
+ *  obtained by rocsparse_scsr2csr_compress_nnz() or
+ *  rocsparse_dcsr2csr_compress_nnz() and that \p csr_val_C and
+ *  \p csr_col_ind_C are allocated accordingly.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle        handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m             number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n             number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz           number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr         descriptor of the sparse CSR matrix. Currently, only
+ *                \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val       array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr   array of \p m+1 elements that point to the start of every row
+ *                of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind   array of \p nnz elements containing the column indices of the
+ *                sparse CSR matrix.
+ *  @param[in]
+ *  tol           non-negative tolerance, entries with a magnitude below or
+ *                equal to \p tol are removed.
+ *  @param[out]
+ *  csr_val_C     array containing the values of the compressed CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr_C array of \p m+1 elements that point to the start of every row
+ *                of the compressed CSR matrix.
+ *  @param[out]
+ *  csr_col_ind_C array containing the column indices of the compressed CSR
+ *                matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p tol is negative.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p csr_val_C, \p csr_row_ptr_C
+ *              or \p csr_col_ind_C pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csr_compress(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             float                     tol,
+                                             float*                    csr_val_C,
+                                             const rocsparse_int*      csr_row_ptr_C,
+                                             rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csr_compress(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             double                    tol,
+                                             double*                   csr_val_C,
+                                             const rocsparse_int*      csr_row_ptr_C,
+                                             rocsparse_int*            csr_col_ind_C);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
+ *  over all rows, the ELL \p width, for a given CSR matrix. \p ell_width obeys the
+ *  \ref rocsparse_pointer_mode of the library context, such that the width can be
+ *  returned in device memory and feed a subsequent device-side allocation without a
+ *  round trip to the host.
+ *
+ *  \note
+ *  In device pointer mode, this function is non blocking and executed asynchronously
+ *  with respect to the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[out]
+ *  ell_width   pointer to the number of non-zero elements per row in ELL storage
+ *              format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
+ *              \p ell_width pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_mat_descr ell_descr,
+                                         rocsparse_int*            ell_width);
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
+ *  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
+ *  number of rows times the number of ELL non-zero elements per row, such that
+ *  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
+ *  non-zero elements per row is obtained by rocsparse_csr2ell_width().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  @param[in]
+ *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  ell_width   number of non-zero elements per row in ELL storage format.
+ *  @param[out]
+ *  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
+ *  @param[out]
+ *  ell_col_ind array of \p m times \p ell_width elements containing the column indices
+ *              of the sparse ELL matrix.
  *
- *      // Obtain required buffer size
- *      size_t buffer_size_M;
- *      size_t buffer_size_L;
- *      size_t buffer_size_U;
- *      rocsparse_dcsrilu0_buffer_size(handle,
- *                                    m,
- *                                    nnz,
- *                                    descr_M,
- *                                    csr_val,
- *                                    csr_row_ptr,
- *                                    csr_col_ind,
- *                                    info,
- *                                    &buffer_size_M);
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr_L,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size_L);
- *      rocsparse_dcsrsv_buffer_size(handle,
- *                                   rocsparse_operation_none,
- *                                   m,
- *                                   nnz,
- *                                   descr_U,
- *                                   csr_val,
- *                                   csr_row_ptr,
- *                                   csr_col_ind,
- *                                   info,
- *                                   &buffer_size_U);
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
+ *              \p ell_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *  \par Example
+ *  This example converts a CSR matrix into an ELL matrix.
+ *  \code{.c}
+ *      //     1 2 0 3 0
+ *      // A = 0 4 5 0 0
+ *      //     6 0 0 7 8
+ *
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int n   = 5;
+ *      rocsparse_int nnz = 8;
+ *
+ *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+ *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *
+ *      // Create ELL matrix descriptor
+ *      rocsparse_mat_descr ell_descr;
+ *      rocsparse_create_mat_descr(&ell_descr);
+ *
+ *      // Obtain the ELL width
+ *      rocsparse_int ell_width;
+ *      rocsparse_csr2ell_width(handle,
+ *                              m,
+ *                              csr_descr,
+ *                              csr_row_ptr,
+ *                              ell_descr,
+ *                              &ell_width);
+ *
+ *      // Compute ELL non-zero entries
+ *      rocsparse_int ell_nnz = m * ell_width;
+ *
+ *      // Allocate ELL column and value arrays
+ *      rocsparse_int* ell_col_ind;
+ *      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
+ *
+ *      float* ell_val;
+ *      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
+ *
+ *      // Format conversion
+ *      rocsparse_scsr2ell(handle,
+ *                         m,
+ *                         csr_descr,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         ell_descr,
+ *                         ell_width,
+ *                         ell_val,
+ *                         ell_col_ind);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    float*                    ell_val,
+                                    rocsparse_int*            ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2ell(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    double*                   ell_val,
+                                    rocsparse_int*            ell_col_ind);
+
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    rocsparse_float_complex* ell_val,
+                                    rocsparse_int* ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int ell_width,
+                                    rocsparse_double_complex* ell_val,
+                                    rocsparse_int* ell_col_ind);
+*/
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse ELL matrix in a single pass
+ *
+ *  \details
+ *  \p rocsparse_csr2ell_fused converts a CSR matrix into an ELL matrix without a
+ *  host round-trip between the width computation and the conversion. The ELL width
+ *  is computed on the device and directly consumed by the conversion, such that
+ *  \f$\text{ell_width} = \min(\max_i(\text{nnz}_i), \text{max_width})\f$. Entries
+ *  of a row exceeding \p max_width are dropped, such that a single pathological
+ *  row cannot blow up the ELL memory footprint. It is assumed that \p ell_val and
+ *  \p ell_col_ind are allocated with \p m times \p max_width elements. The actual
+ *  width is returned in \p ell_width, obeying the \ref rocsparse_pointer_mode of
+ *  the library context.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, if \p ell_width is
+ *  requested in host memory.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  @param[in]
+ *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  max_width   maximum number of non-zero elements per row in ELL storage format,
+ *              row entries beyond this cap are dropped.
+ *  @param[out]
+ *  ell_val     array of \p m times \p max_width elements of the sparse ELL matrix.
+ *  @param[out]
+ *  ell_col_ind array of \p m times \p max_width elements containing the column
+ *              indices of the sparse ELL matrix.
+ *  @param[out]
+ *  ell_width   pointer to the number of non-zero elements per row in ELL storage
+ *              format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p max_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val,
+ *              \p ell_col_ind or \p ell_width pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell_fused(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          const rocsparse_mat_descr csr_descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const rocsparse_mat_descr ell_descr,
+                                          rocsparse_int             max_width,
+                                          float*                    ell_val,
+                                          rocsparse_int*            ell_col_ind,
+                                          rocsparse_int*            ell_width);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2ell_fused(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          const rocsparse_mat_descr csr_descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const rocsparse_mat_descr ell_descr,
+                                          rocsparse_int             max_width,
+                                          double*                   ell_val,
+                                          rocsparse_int*            ell_col_ind,
+                                          rocsparse_int*            ell_width);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
+ *  that \p hyb has been initialized with rocsparse_create_hyb_mat().
+ *
+ *  \note
+ *  This function requires a significant amount of storage for the HYB matrix,
+ *  depending on the matrix structure.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  hyb             sparse matrix in HYB format.
+ *  @param[in]
+ *  user_ell_width  width of the ELL part of the HYB matrix (only required if
+ *                  \p partition_type == \ref rocsparse_hyb_partition_user).
+ *  @param[in]
+ *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+ *                  \ref rocsparse_hyb_partition_user or
+ *                  \ref rocsparse_hyb_partition_max.
  *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
+ *              allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
- *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
- *      // computation performance
- *      rocsparse_dcsrilu0_analysis(handle,
- *                                  m,
- *                                  nnz,
- *                                  descr_M,
- *                                  csr_val,
- *                                  csr_row_ptr,
- *                                  csr_col_ind,
- *                                  info,
- *                                  rocsparse_analysis_policy_reuse,
- *                                  rocsparse_solve_policy_auto,
- *                                  temp_buffer);
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr_L,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *      rocsparse_dcsrsv_analysis(handle,
- *                                rocsparse_operation_none,
- *                                m,
- *                                nnz,
- *                                descr_U,
- *                                csr_val,
- *                                csr_row_ptr,
- *                                csr_col_ind,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
+ *  \par Example
+ *  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+ *  \code{.c}
+ *      // Create HYB matrix structure
+ *      rocsparse_hyb_mat hyb;
+ *      rocsparse_create_hyb_mat(&hyb);
  *
- *      // Check for zero pivot
- *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("A has structural zero at A(%d,%d)\n", position, position);
- *      }
+ *      // User defined ell width
+ *      rocsparse_int user_ell_width = 5;
  *
- *      // Compute incomplete LU factorization
- *      rocsparse_dcsrilu0(handle,
+ *      // Perform the conversion
+ *      rocsparse_scsr2hyb(handle,
  *                         m,
- *                         nnz,
- *                         descr_M,
+ *                         n,
+ *                         descr,
  *                         csr_val,
  *                         csr_row_ptr,
  *                         csr_col_ind,
- *                         info,
- *                         rocsparse_solve_policy_auto,
- *                         temp_buffer);
+ *                         hyb,
+ *                         user_ell_width,
+ *                         rocsparse_hyb_partition_user);
+ *
+ *      // Do some work
+ *
+ *      // Clean up
+ *      rocsparse_destroy_hyb_mat(hyb);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+/*
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+*/
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Update the numeric values of a sparse HYB matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2hyb_update rewrites the values of a HYB matrix that has
+ *  previously been obtained by rocsparse_scsr2hyb() or rocsparse_dcsr2hyb(),
+ *  from a CSR matrix with identical sparsity pattern. The ELL / COO partition
+ *  and the index arrays of the HYB matrix are kept, only the value arrays are
+ *  rewritten in a single pass over the matrix.
+ *
+ *  \note
+ *  The sparsity pattern of the CSR matrix must match the pattern the HYB
+ *  matrix has been created from, otherwise the behavior is undefined. If the
+ *  pattern has changed, rocsparse_scsr2hyb() and rocsparse_dcsr2hyb() have to
+ *  be called instead.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[inout]
+ *  hyb             sparse matrix in HYB format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m is invalid or does not match the
+ *              HYB matrix.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val or
+ *              \p csr_row_ptr pointer is invalid, or \p hyb has not been built by
+ *              rocsparse_scsr2hyb() or rocsparse_dcsr2hyb().
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb_update(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           rocsparse_hyb_mat         hyb);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb_update(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           rocsparse_hyb_mat         hyb);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a multi-device DIST matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2dist partitions a square CSR matrix by rows across
+ *  \p ndevice devices, balancing the number of non-zeros per partition. It is
+ *  assumed that \p dist has been initialized with rocsparse_create_dist_mat().
+ *  Each partition is split into an interior part, referencing only locally
+ *  owned \f$x\f$ entries, and a boundary part, referencing the halo entries
+ *  gathered from the other partitions, such that rocsparse_sdistmv() and
+ *  rocsparse_ddistmv() can overlap the interior computation with the halo
+ *  exchange. The column ownership coincides with the row partition, which
+ *  restricts this format to square matrices.
+ *
+ *  \note
+ *  \p csr_val, \p csr_row_ptr and \p csr_col_ind are host side arrays holding
+ *  the assembled global matrix.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handles     array of \p ndevice handles, one per partition. The p-th
+ *              partition resides on the device of the p-th handle.
+ *  @param[in]
+ *  ndevice     number of row partitions.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix. Must match \p m.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     host array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr host array of \p m+1 elements that point to the start of every
+ *              row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind host array containing the column indices of the sparse CSR
+ *              matrix.
+ *  @param[out]
+ *  dist        matrix in DIST storage format.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handles or a handle in \p handles
+ *          is invalid.
+ *  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz or \p ndevice is
+ *          invalid or \p m != \p n.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_val,
+ *          \p csr_row_ptr, \p csr_col_ind or \p dist pointer is invalid.
+ *  \retval rocsparse_status_not_implemented
+ *          \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2dist(rocsparse_handle*         handles,
+                                     rocsparse_int             ndevice,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_dist_mat        dist);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2dist(rocsparse_handle*         handles,
+                                     rocsparse_int             ndevice,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_dist_mat        dist);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a device and host SPLIT matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2split splits a CSR matrix by rows between the device and
+ *  the host. It is assumed that \p split has been initialized with
+ *  rocsparse_create_split_mat(). The leading rows are uploaded to the device
+ *  up to the amount of free device memory, less a reserve for the vectors and
+ *  the library workspaces, the remaining rows stay host resident, such that
+ *  rocsparse_ssplitmv() and rocsparse_dsplitmv() can overlap the device SpMV
+ *  with a multithreaded host SpMV. Matrices that fit entirely are uploaded
+ *  entirely, such that the format degrades gracefully at the device memory
+ *  boundary instead of falling off a performance cliff.
+ *
+ *  \note
+ *  \p csr_val, \p csr_row_ptr and \p csr_col_ind are host side arrays holding
+ *  the assembled matrix.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     host array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr host array of \p m+1 elements that point to the start of every
+ *              row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind host array containing the column indices of the sparse CSR
+ *              matrix.
+ *  @param[out]
+ *  split       matrix in SPLIT storage format.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not
+ *          initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_val,
+ *          \p csr_row_ptr, \p csr_col_ind or \p split pointer is invalid.
+ *  \retval rocsparse_status_not_implemented
+ *          \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2split(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_split_mat       split);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2split(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_split_mat       split);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse BSR matrix
  *
- *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("U has structural and/or numerical zero at U(%d,%d)\n",
- *                 position,
- *                 position);
- *      }
+ *  \details
+ *  \p rocsparse_csr2bsr converts a CSR matrix into a BSR matrix with blocks of
+ *  dimension \p block_dim. It is assumed that \p bsr has been initialized with
+ *  rocsparse_create_bsr_mat(). If the matrix dimensions are no multiple of
+ *  \p block_dim, the last block row and block column are padded with zeros.
  *
- *      // Solve Lz = x
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr_L,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             x,
- *                             z,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *  \note
+ *  This function requires a significant amount of storage for the BSR matrix,
+ *  depending on the matrix structure and the block dimension.
  *
- *      // Solve Uy = z
- *      rocsparse_dcsrsv_solve(handle,
- *                             rocsparse_operation_none,
- *                             m,
- *                             nnz,
- *                             &alpha,
- *                             descr_U,
- *                             csr_val,
- *                             csr_row_ptr,
- *                             csr_col_ind,
- *                             info,
- *                             z,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *  \note
+ *  This function is blocking with respect to the host.
  *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr_M);
- *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_U);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[in]
+ *  block_dim       dimension of the BSR blocks.
+ *  @param[out]
+ *  bsr             sparse matrix in BSR format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the BSR matrix could not be
+ *              allocated.
+ *  \retval     rocsparse_status_not_implemented \p block_dim is larger than supported or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
+rocsparse_status rocsparse_scsr2bsr(rocsparse_handle          handle,
                                     rocsparse_int             m,
-                                    rocsparse_int             nnz,
+                                    rocsparse_int             n,
                                     const rocsparse_mat_descr descr,
-                                    float*                    csr_val,
+                                    const float*              csr_val,
                                     const rocsparse_int*      csr_row_ptr,
                                     const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+                                    rocsparse_int             block_dim,
+                                    rocsparse_bsr_mat         bsr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
+rocsparse_status rocsparse_dcsr2bsr(rocsparse_handle          handle,
                                     rocsparse_int             m,
-                                    rocsparse_int             nnz,
+                                    rocsparse_int             n,
                                     const rocsparse_mat_descr descr,
-                                    double*                   csr_val,
+                                    const double*             csr_val,
                                     const rocsparse_int*      csr_row_ptr,
                                     const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+                                    rocsparse_int             block_dim,
+                                    rocsparse_bsr_mat         bsr);
 /**@}*/
 
-/*
- * ===========================================================================
- *    Sparse Format Conversions
- * ===========================================================================
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse DCSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2dcsr converts a CSR matrix into a doubly compressed sparse row
+ *  matrix, where row indices and row pointers are stored for the non-empty rows only.
+ *  For hypersparse matrices, where most rows are empty, this shrinks the row metadata
+ *  from \p m+1 entries to the number of non-empty rows. It is assumed that \p dcsr has
+ *  been initialized with rocsparse_create_dcsr_mat().
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  CSR matrix.
+ *  @param[out]
+ *  dcsr            sparse matrix in DCSR format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p dcsr, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the DCSR matrix could not
+ *              be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2dcsr(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_dcsr_mat        dcsr);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2dcsr(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_dcsr_mat        dcsr);
+/**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse COO matrix
+ *  \brief Convert a sparse CSR matrix into a sparse SELL-C-sigma matrix
  *
  *  \details
- *  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
- *  to the start of every row, into a COO array of row indices.
+ *  \p rocsparse_csr2sell converts a CSR matrix into a SELL-C-sigma matrix. The slice
+ *  height \p C is matched to the wavefront size of the device. Within windows of
+ *  \p sigma rows, the rows are sorted by descending length before they are packed
+ *  into slices, which reduces the zero fill-in for matrices with varying row
+ *  lengths. It is assumed that \p sell has been initialized with
+ *  rocsparse_create_sell_mat().
  *
  *  \note
- *  It can also be used to convert a CSC array containing the column offsets into a COO
- *  array of column indices.
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[in]
+ *  sigma           size of the row sorting window.
+ *  @param[out]
+ *  sell            sparse matrix in SELL-C-sigma format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p sigma is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p sell, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the SELL matrix could not be
+ *              allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2sell(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             sigma,
+                                     rocsparse_sell_mat        sell);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2sell(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             sigma,
+                                     rocsparse_sell_mat        sell);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse COO matrix into a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_coo2csr converts the COO array containing the row indices into a
+ *  CSR array of row offsets, that point to the start of every row.
+ *  It is assumed that the COO row index array is sorted.
+ *
+ *  \note It can also be used, to convert a COO array containing the column indices into
+ *  a CSC array of column offsets, that point to the start of every column. Then, it is
+ *  assumed that the COO column index array is sorted, instead.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2421,27 +11820,26 @@ rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row
- *              of the sparse CSR matrix.
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+ *              matrix.
  *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
  *  m           number of rows of the sparse CSR matrix.
  *  @param[out]
- *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
- *              matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
  *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
+ *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind or \p csr_row_ptr
  *              pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *
  *  \par Example
- *  This example converts a CSR matrix into a COO matrix.
+ *  This example converts a COO matrix into a CSR matrix.
  *  \code{.c}
  *      //     1 2 0 3 0
  *      // A = 0 4 5 0 0
@@ -2451,658 +11849,696 @@ rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
  *      rocsparse_int n   = 5;
  *      rocsparse_int nnz = 8;
  *
- *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *      coo_row_ind[nnz] = {0, 0, 0, 1, 1, 2, 2, 2}; // device memory
+ *      coo_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+ *      coo_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
  *
- *      // Allocate COO matrix arrays
- *      rocsparse_int* coo_row_ind;
- *      rocsparse_int* coo_col_ind;
- *      float* coo_val;
+ *      // Allocate CSR matrix arrays
+ *      rocsparse_int* csr_row_ptr;
+ *      rocsparse_int* csr_col_ind;
+ *      float* csr_val;
  *
- *      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
- *      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
- *      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
+ *      hipMalloc((void**)&csr_row_ptr, sizeof(rocsparse_int) * (m + 1));
+ *      hipMalloc((void**)&csr_col_ind, sizeof(rocsparse_int) * nnz);
+ *      hipMalloc((void**)&csr_val, sizeof(float) * nnz);
  *
- *      // Convert the csr row offsets into coo row indices
- *      rocsparse_csr2coo(handle,
- *                        csr_row_ptr,
+ *      // Convert the coo row indices into csr row offsets
+ *      rocsparse_coo2csr(handle,
+ *                        coo_row_ind,
  *                        nnz,
  *                        m,
- *                        coo_row_ind,
+ *                        csr_row_ptr,
  *                        rocsparse_index_base_zero);
  *
  *      // Copy the column and value arrays
- *      hipMemcpy(coo_col_ind,
- *                csr_col_ind,
+ *      hipMemcpy(csr_col_ind,
+ *                coo_col_ind,
  *                sizeof(rocsparse_int) * nnz,
  *                hipMemcpyDeviceToDevice);
  *
- *      hipMemcpy(coo_val,
- *                csr_val,
+ *      hipMemcpy(csr_val,
+ *                coo_val,
  *                sizeof(float) * nnz,
  *                hipMemcpyDeviceToDevice);
  *  \endcode
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
-                                   const rocsparse_int* csr_row_ptr,
+rocsparse_status rocsparse_coo2csr(rocsparse_handle     handle,
+                                   const rocsparse_int* coo_row_ind,
                                    rocsparse_int        nnz,
                                    rocsparse_int        m,
-                                   rocsparse_int*       coo_row_ind,
+                                   rocsparse_int*       csr_row_ptr,
                                    rocsparse_index_base idx_base);
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *  \brief Obtain the temporary buffer size for rocsparse_scoo2csr_assemble()
+ *  and rocsparse_dcoo2csr_assemble()
  *
  *  \details
- *  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
- *  required by rocsparse_scsr2csc() and rocsparse_dcsr2csc(). The temporary storage
- *  buffer must be allocated by the user.
+ *  \p rocsparse_coo2csr_assemble_buffer_size returns the size of the
+ *  temporary storage buffer required by rocsparse_scoo2csr_assemble() and
+ *  rocsparse_dcoo2csr_assemble(). The temporary storage buffer must be
+ *  allocated by the user.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
- *  @param[in]
- *  n           number of columns of the sparse CSR matrix.
- *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
- *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
- *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  m           number of rows of the sparse matrix.
  *  @param[in]
- *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  n           number of columns of the sparse matrix.
+ *  @param[in]
+ *  nnz         number of unassembled entries of the sparse COO matrix.
  *  @param[out]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              sparse_csr2csc().
+ *  buffer_size number of bytes of the temporary storage buffer.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
  *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
- *              \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     handle,
-                                               rocsparse_int        m,
-                                               rocsparse_int        n,
-                                               rocsparse_int        nnz,
-                                               const rocsparse_int* csr_row_ptr,
-                                               const rocsparse_int* csr_col_ind,
-                                               rocsparse_action     copy_values,
-                                               size_t*              buffer_size);
+rocsparse_status rocsparse_scoo2csr_assemble_buffer_size(
+    rocsparse_handle handle, rocsparse_int m, rocsparse_int n, rocsparse_int nnz, size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcoo2csr_assemble_buffer_size(
+    rocsparse_handle handle, rocsparse_int m, rocsparse_int n, rocsparse_int nnz, size_t* buffer_size);
+/**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ *  \brief Convert an unassembled sparse COO matrix into a CSR matrix,
+ *  summing duplicate entries
  *
  *  \details
- *  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
- *  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
- *  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
- *  or not (\ref rocsparse_action_symbolic).
- *
- *  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
- *  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
- *
- *  \note
- *  The resulting matrix can also be seen as the transpose of the input matrix.
+ *  \p rocsparse_coo2csr_assemble converts an unsorted COO matrix that may
+ *  contain duplicate \f$(row, col)\f$ entries, as produced by finite element
+ *  assembly, into a sorted CSR matrix in which duplicates are summed. The
+ *  sort, the duplicate reduction and the row pointer construction are fused
+ *  into a single pipeline over one temporary buffer, such that the
+ *  unassembled stream is traversed once instead of by separate coosort,
+ *  segmented reduction and coo2csr passes.
+ *
+ *  \p csr_val and \p csr_col_ind must be allocated for \p nnz entries, the
+ *  number of assembled entries is returned in \p nnz_C. \p nnz_C can be a
+ *  host or device pointer, depending on the pointer mode of the handle. The
+ *  input arrays are not modified.
+ *
+ *  \p rocsparse_coo2csr_assemble requires a user allocated temporary buffer.
+ *  Its size is obtained by rocsparse_scoo2csr_assemble_buffer_size() or
+ *  rocsparse_dcoo2csr_assemble_buffer_size().
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  This function is blocking with respect to the host.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  m           number of rows of the sparse matrix.
  *  @param[in]
- *  n           number of columns of the sparse CSR matrix.
+ *  n           number of columns of the sparse matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  nnz         number of unassembled entries of the sparse COO matrix.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  coo_val     array of \p nnz unassembled values.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  coo_row_ind array of \p nnz unassembled row indices.
  *  @param[in]
- *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
- *              CSR matrix.
+ *  coo_col_ind array of \p nnz unassembled column indices.
  *  @param[out]
- *  csc_val     array of \p nnz elements of the sparse CSC matrix.
+ *  csr_val     array of \p nnz elements holding the assembled values.
  *  @param[out]
- *  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
- *              matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the assembled CSR matrix.
  *  @param[out]
- *  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
- *              sparse CSC matrix.
- *  @param[in]
- *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  csr_col_ind array of \p nnz elements holding the assembled column indices.
+ *  @param[out]
+ *  nnz_C       number of assembled entries.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user, size is returned by
- *              rocsparse_csr2csc_buffer_size().
+ *  temp_buffer temporary storage buffer allocated by the user.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid.
  *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
- *              \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_pointer \p coo_val, \p coo_row_ind,
+ *              \p coo_col_ind, \p csr_val, \p csr_row_ptr, \p csr_col_ind,
+ *              \p nnz_C or \p temp_buffer pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scoo2csr_assemble(rocsparse_handle     handle,
+                                             rocsparse_int        m,
+                                             rocsparse_int        n,
+                                             rocsparse_int        nnz,
+                                             const float*         coo_val,
+                                             const rocsparse_int* coo_row_ind,
+                                             const rocsparse_int* coo_col_ind,
+                                             float*               csr_val,
+                                             rocsparse_int*       csr_row_ptr,
+                                             rocsparse_int*       csr_col_ind,
+                                             rocsparse_int*       nnz_C,
+                                             rocsparse_index_base idx_base,
+                                             void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcoo2csr_assemble(rocsparse_handle     handle,
+                                             rocsparse_int        m,
+                                             rocsparse_int        n,
+                                             rocsparse_int        nnz,
+                                             const double*        coo_val,
+                                             const rocsparse_int* coo_row_ind,
+                                             const rocsparse_int* coo_col_ind,
+                                             double*              csr_val,
+                                             rocsparse_int*       csr_row_ptr,
+                                             rocsparse_int*       csr_col_ind,
+                                             rocsparse_int*       nnz_C,
+                                             rocsparse_index_base idx_base,
+                                             void*                temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Append a CSR row batch to an incrementally built matrix
  *
- *  \par Example
- *  This example computes the transpose of a CSR matrix.
- *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
+ *  \details
+ *  \p rocsparse_csr_builder_append appends a batch of rows, given in CSR
+ *  storage format, below the rows accumulated in the CSR builder. The batch
+ *  is expanded into growing device storage at a cost proportional to the
+ *  batch, such that streaming ingestion avoids the repeated rebuild of the
+ *  accumulated matrix. The number of columns of the built matrix is the
+ *  largest \p ncols over all appended batches, the value precision is fixed
+ *  by the first append. The accumulated matrix is compacted into CSR storage
+ *  using rocsparse_scsr_builder_finalize() or
+ *  rocsparse_dcsr_builder_finalize().
  *
- *      rocsparse_int m_A   = 3;
- *      rocsparse_int n_A   = 5;
- *      rocsparse_int nnz_A = 8;
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  builder     CSR builder holding the accumulated matrix.
+ *  @param[in]
+ *  nrows       number of rows of the appended batch.
+ *  @param[in]
+ *  ncols       number of columns of the appended batch.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the appended batch.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the appended batch.
+ *  @param[in]
+ *  csr_row_ptr array of \p nrows+1 elements that point to the start of every
+ *              row of the appended batch.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              appended batch.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid or the
+ *              value precision does not match the previous appends.
+ *  \retval     rocsparse_status_invalid_size \p nrows, \p ncols or \p nnz is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p builder, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr_builder_append(rocsparse_handle      handle,
+                                               rocsparse_csr_builder builder,
+                                               rocsparse_int         nrows,
+                                               rocsparse_int         ncols,
+                                               rocsparse_int         nnz,
+                                               const float*          csr_val,
+                                               const rocsparse_int*  csr_row_ptr,
+                                               const rocsparse_int*  csr_col_ind,
+                                               rocsparse_index_base  idx_base);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr_builder_append(rocsparse_handle      handle,
+                                               rocsparse_csr_builder builder,
+                                               rocsparse_int         nrows,
+                                               rocsparse_int         ncols,
+                                               rocsparse_int         nnz,
+                                               const double*         csr_val,
+                                               const rocsparse_int*  csr_row_ptr,
+                                               const rocsparse_int*  csr_col_ind,
+                                               rocsparse_index_base  idx_base);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Query the size of an incrementally built matrix
  *
- *      // Allocate memory for transposed CSR matrix
- *      rocsparse_int m_T   = n_A;
- *      rocsparse_int n_T   = m_A;
- *      rocsparse_int nnz_T = nnz_A;
+ *  \details
+ *  \p rocsparse_csr_builder_size returns the dimensions and the number of
+ *  non-zero entries of the matrix accumulated in the CSR builder, such that
+ *  the CSR output arrays of the finalize step can be allocated.
  *
- *      rocsparse_int* csr_row_ptr_T;
- *      rocsparse_int* csr_col_ind_T;
- *      float* csr_val_T;
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  builder     CSR builder holding the accumulated matrix.
+ *  @param[out]
+ *  m           number of rows of the accumulated matrix.
+ *  @param[out]
+ *  n           number of columns of the accumulated matrix.
+ *  @param[out]
+ *  nnz         number of non-zero entries of the accumulated matrix.
  *
- *      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
- *      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
- *      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p builder, \p m, \p n or
+ *              \p nnz pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr_builder_size(rocsparse_handle      handle,
+                                            rocsparse_csr_builder builder,
+                                            rocsparse_int*        m,
+                                            rocsparse_int*        n,
+                                            rocsparse_int*        nnz);
+
+/*! \ingroup conv_module
+ *  \brief Compact an incrementally built matrix into CSR storage
  *
- *      // Obtain the temporary buffer size
- *      size_t buffer_size;
- *      rocsparse_csr2csc_buffer_size(handle,
- *                                    m_A,
- *                                    n_A,
- *                                    nnz_A,
- *                                    csr_row_ptr_A,
- *                                    csr_col_ind_A,
- *                                    rocsparse_action_numeric,
- *                                    &buffer_size);
+ *  \details
+ *  \p rocsparse_csr_builder_finalize compacts the matrix accumulated in the
+ *  CSR builder into the CSR output arrays. The appended row batches arrive
+ *  in order, such that the compaction reduces to the coo2csr row pointer
+ *  build and a single pass over the accumulated entries. The builder keeps
+ *  its storage, further batches can be appended and finalized again.
  *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  builder     CSR builder holding the accumulated matrix.
+ *  @param[out]
+ *  csr_val     array of \p nnz elements of the accumulated matrix.
+ *  @param[out]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the accumulated matrix.
+ *  @param[out]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              accumulated matrix.
+ *  @param[in]
+ *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *
- *      rocsparse_scsr2csc(handle,
- *                         m_A,
- *                         n_A,
- *                         nnz_A,
- *                         csr_val_A,
- *                         csr_row_ptr_A,
- *                         csr_col_ind_A,
- *                         csr_val_T,
- *                         csr_col_ind_T,
- *                         csr_row_ptr_T,
- *                         rocsparse_action_numeric,
- *                         rocsparse_index_base_zero,
- *                         temp_buffer);
- *  \endcode
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p idx_base is invalid or the
+ *              value precision does not match the appended batches.
+ *  \retval     rocsparse_status_invalid_pointer \p builder, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2csc(rocsparse_handle     handle,
-                                    rocsparse_int        m,
-                                    rocsparse_int        n,
-                                    rocsparse_int        nnz,
-                                    const float*         csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    float*               csc_val,
-                                    rocsparse_int*       csc_row_ind,
-                                    rocsparse_int*       csc_col_ptr,
-                                    rocsparse_action     copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void*                temp_buffer);
+rocsparse_status rocsparse_scsr_builder_finalize(rocsparse_handle      handle,
+                                                 rocsparse_csr_builder builder,
+                                                 float*                csr_val,
+                                                 rocsparse_int*        csr_row_ptr,
+                                                 rocsparse_int*        csr_col_ind,
+                                                 rocsparse_index_base  idx_base);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2csc(rocsparse_handle     handle,
-                                    rocsparse_int        m,
-                                    rocsparse_int        n,
-                                    rocsparse_int        nnz,
-                                    const double*        csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    double*              csc_val,
-                                    rocsparse_int*       csc_row_ind,
-                                    rocsparse_int*       csc_col_ptr,
-                                    rocsparse_action     copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void*                temp_buffer);
+rocsparse_status rocsparse_dcsr_builder_finalize(rocsparse_handle      handle,
+                                                 rocsparse_csr_builder builder,
+                                                 double*               csr_val,
+                                                 rocsparse_int*        csr_row_ptr,
+                                                 rocsparse_int*        csr_col_ind,
+                                                 rocsparse_index_base  idx_base);
 /**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *  \brief Build a hash index over the sparsity pattern of a CSR matrix
  *
  *  \details
- *  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
- *  over all rows, the ELL \p width, for a given CSR matrix.
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  \p rocsparse_csr_update_analysis builds a device hash index that maps the
+ *  (row, col) coordinates of the sparsity pattern to the position of the
+ *  entry in \p csr_val. The index is stored in \p info and is consumed by
+ *  rocsparse_scsr_update_values() and rocsparse_dcsr_update_values(), which
+ *  locate each updated entry by a constant number of table probes instead
+ *  of a binary search over the row. The index depends on the pattern only
+ *  and remains valid across value updates.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
  *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  n           number of columns of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the
+ *              sparse CSR matrix.
  *  @param[out]
- *  ell_width   pointer to the number of non-zero elements per row in ELL storage
- *              format.
+ *  info        structure that holds the pattern hash index.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
- *              \p ell_width pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind or \p info pointer is invalid.
  *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          handle,
-                                         rocsparse_int             m,
-                                         const rocsparse_mat_descr csr_descr,
-                                         const rocsparse_int*      csr_row_ptr,
-                                         const rocsparse_mat_descr ell_descr,
-                                         rocsparse_int*            ell_width);
+rocsparse_status rocsparse_csr_update_analysis(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info);
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+ *  \brief Scatter batched value updates into a sparse CSR matrix
  *
  *  \details
- *  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
- *  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
- *  number of rows times the number of ELL non-zero elements per row, such that
- *  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
- *  non-zero elements per row is obtained by rocsparse_csr2ell_width().
+ *  \p rocsparse_csr_update_values scatters a batch of \p nupd
+ *  (row, col, val) triples into \p csr_val, locating each entry through the
+ *  pattern hash index built by rocsparse_csr_update_analysis(). The triples
+ *  use the index base of the analyzed matrix. Triples that address a
+ *  coordinate outside the sparsity pattern are ignored.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  nupd        number of updated entries.
+ *  @param[in]
+ *  upd_row_ind array of \p nupd elements containing the row indices of the
+ *              updated entries.
+ *  @param[in]
+ *  upd_col_ind array of \p nupd elements containing the column indices of
+ *              the updated entries.
+ *  @param[in]
+ *  upd_val     array of \p nupd elements containing the updated values.
+ *  @param[inout]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the pattern hash index.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p nupd is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p upd_row_ind,
+ *              \p upd_col_ind, \p upd_val, \p csr_val or \p info pointer is
+ *              invalid or rocsparse_csr_update_analysis() has not been called
+ *              on \p info.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr_update_values(rocsparse_handle     handle,
+                                              rocsparse_int        nupd,
+                                              const rocsparse_int* upd_row_ind,
+                                              const rocsparse_int* upd_col_ind,
+                                              const float*         upd_val,
+                                              float*               csr_val,
+                                              rocsparse_mat_info   info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr_update_values(rocsparse_handle     handle,
+                                              rocsparse_int        nupd,
+                                              const rocsparse_int* upd_row_ind,
+                                              const rocsparse_int* upd_col_ind,
+                                              const double*        upd_val,
+                                              double*              csr_val,
+                                              rocsparse_mat_info   info);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Stack sparse CSR matrices into a block-diagonal CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csr_stack concatenates \p nbatch sparse CSR matrices into a single
+ *  block-diagonal CSR matrix, such that
+ *  \f[
+ *    A := \begin{pmatrix}
+ *    A_0 & & \\
+ *    & \ddots & \\
+ *    & & A_{nbatch-1}
+ *    \end{pmatrix}
+ *  \f]
+ *  Block \f$A_i\f$ has \p m[i] rows, \p n[i] columns and \p nnz[i] non-zero entries,
+ *  its device arrays are passed via the host pointer arrays \p csr_val,
+ *  \p csr_row_ptr and \p csr_col_ind. The stacked matrix is assembled entirely on the
+ *  device, the row pointers are shifted by the non-zero counts and the column indices
+ *  by the column counts of the preceding blocks. This turns batching many independent
+ *  small systems into a single pooled system without building and re-uploading the
+ *  block-diagonal matrix on the host whenever the batch membership changes.
+ *
+ *  The routine additionally fills the host arrays \p row_offset, \p col_offset and
+ *  \p nnz_offset with \p nbatch+1 zero based offsets each, such that block \f$i\f$
+ *  occupies the rows \p row_offset[i] to \p row_offset[i+1], the columns
+ *  \p col_offset[i] to \p col_offset[i+1] and the entries \p nnz_offset[i] to
+ *  \p nnz_offset[i+1] of the stacked matrix. Results computed on the pooled system
+ *  can be sliced back out per block using these offsets.
+ *
+ *  \p stacked_val and \p stacked_col_ind must be allocated with the sum of all
+ *  \p nnz[i] elements, \p stacked_row_ptr with the sum of all \p m[i] plus one
+ *  elements. All blocks and the stacked matrix share the index base of \p descr.
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
  *  @param[in]
- *  handle      handle to the rocsparse library context queue.
+ *  handle          handle to the rocsparse library context queue.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  nbatch          number of CSR matrices to stack.
  *  @param[in]
- *  csr_descr   descriptor of the sparse CSR matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  m               host array of \p nbatch row counts.
  *  @param[in]
- *  csr_val     array containing the values of the sparse CSR matrix.
+ *  n               host array of \p nbatch column counts.
  *  @param[in]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  nnz             host array of \p nbatch non-zero counts.
  *  @param[in]
- *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  descr           descriptor of the CSR matrices.
  *  @param[in]
- *  ell_descr   descriptor of the sparse ELL matrix. Currently, only
- *              \ref rocsparse_matrix_type_general is supported.
+ *  csr_val         host array of \p nbatch device pointers to the values of each
+ *                  block.
  *  @param[in]
- *  ell_width   number of non-zero elements per row in ELL storage format.
+ *  csr_row_ptr     host array of \p nbatch device pointers to the row pointers of
+ *                  each block.
+ *  @param[in]
+ *  csr_col_ind     host array of \p nbatch device pointers to the column indices of
+ *                  each block.
  *  @param[out]
- *  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
+ *  stacked_val     array holding the values of the stacked matrix.
  *  @param[out]
- *  ell_col_ind array of \p m times \p ell_width elements containing the column indices
- *              of the sparse ELL matrix.
+ *  stacked_row_ptr array holding the row pointers of the stacked matrix.
+ *  @param[out]
+ *  stacked_col_ind array holding the column indices of the stacked matrix.
+ *  @param[out]
+ *  row_offset      host array of \p nbatch+1 elements holding the first row of every
+ *                  block in the stacked matrix.
+ *  @param[out]
+ *  col_offset      host array of \p nbatch+1 elements holding the first column of
+ *                  every block in the stacked matrix.
+ *  @param[out]
+ *  nnz_offset      host array of \p nbatch+1 elements holding the first non-zero
+ *                  entry of every block in the stacked matrix.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
- *              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
- *              \p ell_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_invalid_handle the library context was not
+ *              initialized.
+ *  \retval     rocsparse_status_invalid_size \p nbatch or one of the block sizes is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p m, \p n, \p nnz, \p descr, one of
+ *              the pointer arrays or one of the output pointers is invalid.
  *  \retval     rocsparse_status_not_implemented
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  This example converts a CSR matrix into an ELL matrix.
- *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
- *
- *      rocsparse_int m   = 3;
- *      rocsparse_int n   = 5;
- *      rocsparse_int nnz = 8;
- *
- *      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
- *      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
- *
- *      // Create ELL matrix descriptor
- *      rocsparse_mat_descr ell_descr;
- *      rocsparse_create_mat_descr(&ell_descr);
- *
- *      // Obtain the ELL width
- *      rocsparse_int ell_width;
- *      rocsparse_csr2ell_width(handle,
- *                              m,
- *                              csr_descr,
- *                              csr_row_ptr,
- *                              ell_descr,
- *                              &ell_width);
- *
- *      // Compute ELL non-zero entries
- *      rocsparse_int ell_nnz = m * ell_width;
- *
- *      // Allocate ELL column and value arrays
- *      rocsparse_int* ell_col_ind;
- *      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
- *
- *      float* ell_val;
- *      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
- *
- *      // Format conversion
- *      rocsparse_scsr2ell(handle,
- *                         m,
- *                         csr_descr,
- *                         csr_val,
- *                         csr_row_ptr,
- *                         csr_col_ind,
- *                         ell_descr,
- *                         ell_width,
- *                         ell_val,
- *                         ell_col_ind);
- *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    float*                    ell_val,
-                                    rocsparse_int*            ell_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2ell(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    double*                   ell_val,
-                                    rocsparse_int*            ell_col_ind);
-
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    rocsparse_float_complex* ell_val,
-                                    rocsparse_int* ell_col_ind);
+rocsparse_status rocsparse_scsr_stack(rocsparse_handle            handle,
+                                      rocsparse_int               nbatch,
+                                      const rocsparse_int*        m,
+                                      const rocsparse_int*        n,
+                                      const rocsparse_int*        nnz,
+                                      const rocsparse_mat_descr   descr,
+                                      const float* const*         csr_val,
+                                      const rocsparse_int* const* csr_row_ptr,
+                                      const rocsparse_int* const* csr_col_ind,
+                                      float*                      stacked_val,
+                                      rocsparse_int*              stacked_row_ptr,
+                                      rocsparse_int*              stacked_col_ind,
+                                      rocsparse_int*              row_offset,
+                                      rocsparse_int*              col_offset,
+                                      rocsparse_int*              nnz_offset);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    rocsparse_double_complex* ell_val,
-                                    rocsparse_int* ell_col_ind);
-*/
+rocsparse_status rocsparse_dcsr_stack(rocsparse_handle            handle,
+                                      rocsparse_int               nbatch,
+                                      const rocsparse_int*        m,
+                                      const rocsparse_int*        n,
+                                      const rocsparse_int*        nnz,
+                                      const rocsparse_mat_descr   descr,
+                                      const double* const*        csr_val,
+                                      const rocsparse_int* const* csr_row_ptr,
+                                      const rocsparse_int* const* csr_col_ind,
+                                      double*                     stacked_val,
+                                      rocsparse_int*              stacked_row_ptr,
+                                      rocsparse_int*              stacked_col_ind,
+                                      rocsparse_int*              row_offset,
+                                      rocsparse_int*              col_offset,
+                                      rocsparse_int*              nnz_offset);
 /**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+ *  \brief Convert a sparse COO matrix into a sparse HYB matrix
  *
  *  \details
- *  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
- *  that \p hyb has been initialized with rocsparse_create_hyb_mat().
- *
- *  \note
- *  This function requires a significant amount of storage for the HYB matrix,
- *  depending on the matrix structure.
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  \p rocsparse_coo2hyb_buffer_size returns the size of the temporary storage
+ *  buffer required by rocsparse_scoo2hyb() and rocsparse_dcoo2hyb(). The
+ *  temporary storage buffer must be allocated by the user.
  *
  *  @param[in]
  *  handle          handle to the rocsparse library context queue.
  *  @param[in]
- *  m               number of rows of the sparse CSR matrix.
- *  @param[in]
- *  n               number of columns of the sparse CSR matrix.
+ *  m               number of rows of the sparse COO matrix.
  *  @param[in]
- *  descr           descriptor of the sparse CSR matrix. Currently, only
- *                  \ref rocsparse_matrix_type_general is supported.
+ *  n               number of columns of the sparse COO matrix.
  *  @param[in]
- *  csr_val         array containing the values of the sparse CSR matrix.
+ *  nnz             number of non-zero entries of the sparse COO matrix.
  *  @param[in]
- *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
- *                  sparse CSR matrix.
+ *  coo_row_ind     array of \p nnz elements containing the row indices of the sparse
+ *                  COO matrix.
  *  @param[in]
- *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  coo_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  COO matrix.
  *  @param[out]
- *  hyb             sparse matrix in HYB format.
- *  @param[in]
- *  user_ell_width  width of the ELL part of the HYB matrix (only required if
- *                  \p partition_type == \ref rocsparse_hyb_partition_user).
- *  @param[in]
- *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
- *                  \ref rocsparse_hyb_partition_user or
- *                  \ref rocsparse_hyb_partition_max.
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_scoo2hyb() and rocsparse_dcoo2hyb().
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
- *  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
- *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
- *              allocated.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind, \p coo_col_ind or
+ *              \p buffer_size pointer is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
- *  \code{.c}
- *      // Create HYB matrix structure
- *      rocsparse_hyb_mat hyb;
- *      rocsparse_create_hyb_mat(&hyb);
- *
- *      // User defined ell width
- *      rocsparse_int user_ell_width = 5;
- *
- *      // Perform the conversion
- *      rocsparse_scsr2hyb(handle,
- *                         m,
- *                         n,
- *                         descr,
- *                         csr_val,
- *                         csr_row_ptr,
- *                         csr_col_ind,
- *                         hyb,
- *                         user_ell_width,
- *                         rocsparse_hyb_partition_user);
- *
- *      // Do some work
- *
- *      // Clean up
- *      rocsparse_destroy_hyb_mat(hyb);
- *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
+rocsparse_status rocsparse_scoo2hyb_buffer_size(rocsparse_handle     handle,
+                                                rocsparse_int        m,
+                                                rocsparse_int        n,
+                                                rocsparse_int        nnz,
+                                                const rocsparse_int* coo_row_ind,
+                                                const rocsparse_int* coo_col_ind,
+                                                size_t*              buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
-*/
+rocsparse_status rocsparse_dcoo2hyb_buffer_size(rocsparse_handle     handle,
+                                                rocsparse_int        m,
+                                                rocsparse_int        n,
+                                                rocsparse_int        nnz,
+                                                const rocsparse_int* coo_row_ind,
+                                                const rocsparse_int* coo_col_ind,
+                                                size_t*              buffer_size);
 /**@}*/
 
 /*! \ingroup conv_module
- *  \brief Convert a sparse COO matrix into a sparse CSR matrix
+ *  \brief Convert a sparse COO matrix into a sparse HYB matrix
  *
  *  \details
- *  \p rocsparse_coo2csr converts the COO array containing the row indices into a
- *  CSR array of row offsets, that point to the start of every row.
- *  It is assumed that the COO row index array is sorted.
+ *  \p rocsparse_coo2hyb converts a COO matrix into a HYB matrix. The COO matrix
+ *  does not need to be sorted, it is sorted by row as part of the conversion and
+ *  the user arrays hold the sorted matrix on return. It is assumed that \p hyb
+ *  has been initialized with rocsparse_create_hyb_mat().
  *
- *  \note It can also be used, to convert a COO array containing the column indices into
- *  a CSC array of column offsets, that point to the start of every column. Then, it is
- *  assumed that the COO column index array is sorted, instead.
+ *  \p rocsparse_coo2hyb requires extra temporary storage buffer that has to be
+ *  allocated by the user. Storage buffer size can be determined by
+ *  rocsparse_scoo2hyb_buffer_size() and rocsparse_dcoo2hyb_buffer_size(). This
+ *  allows converting a batch of matrices back-to-back without buffer size
+ *  queries in between.
  *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  \note
+ *  This function requires a significant amount of storage for the HYB matrix,
+ *  depending on the matrix structure.
  *
  *  @param[in]
- *  handle      handle to the rocsparse library context queue.
+ *  handle          handle to the rocsparse library context queue.
  *  @param[in]
- *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
- *              matrix.
+ *  m               number of rows of the sparse COO matrix.
  *  @param[in]
- *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  n               number of columns of the sparse COO matrix.
  *  @param[in]
- *  m           number of rows of the sparse CSR matrix.
+ *  nnz             number of non-zero entries of the sparse COO matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse COO matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[inout]
+ *  coo_val         array of \p nnz elements containing the values of the sparse
+ *                  COO matrix.
+ *  @param[inout]
+ *  coo_row_ind     array of \p nnz elements containing the row indices of the sparse
+ *                  COO matrix.
+ *  @param[inout]
+ *  coo_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  COO matrix.
  *  @param[out]
- *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
- *              sparse CSR matrix.
+ *  hyb             sparse matrix in HYB format.
  *  @param[in]
- *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+ *  user_ell_width  width of the ELL part of the HYB matrix (only required if
+ *                  \p partition_type == \ref rocsparse_hyb_partition_user).
+ *  @param[in]
+ *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+ *                  \ref rocsparse_hyb_partition_user or
+ *                  \ref rocsparse_hyb_partition_max.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned
+ *                  by rocsparse_scoo2hyb_buffer_size() or
+ *                  rocsparse_dcoo2hyb_buffer_size().
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind or \p csr_row_ptr
- *              pointer is invalid.
- *
- *  \par Example
- *  This example converts a COO matrix into a CSR matrix.
- *  \code{.c}
- *      //     1 2 0 3 0
- *      // A = 0 4 5 0 0
- *      //     6 0 0 7 8
- *
- *      rocsparse_int m   = 3;
- *      rocsparse_int n   = 5;
- *      rocsparse_int nnz = 8;
- *
- *      coo_row_ind[nnz] = {0, 0, 0, 1, 1, 2, 2, 2}; // device memory
- *      coo_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
- *      coo_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
- *
- *      // Allocate CSR matrix arrays
- *      rocsparse_int* csr_row_ptr;
- *      rocsparse_int* csr_col_ind;
- *      float* csr_val;
- *
- *      hipMalloc((void**)&csr_row_ptr, sizeof(rocsparse_int) * (m + 1));
- *      hipMalloc((void**)&csr_col_ind, sizeof(rocsparse_int) * nnz);
- *      hipMalloc((void**)&csr_val, sizeof(float) * nnz);
- *
- *      // Convert the coo row indices into csr row offsets
- *      rocsparse_coo2csr(handle,
- *                        coo_row_ind,
- *                        nnz,
- *                        m,
- *                        csr_row_ptr,
- *                        rocsparse_index_base_zero);
- *
- *      // Copy the column and value arrays
- *      hipMemcpy(csr_col_ind,
- *                coo_col_ind,
- *                sizeof(rocsparse_int) * nnz,
- *                hipMemcpyDeviceToDevice);
- *
- *      hipMemcpy(csr_val,
- *                coo_val,
- *                sizeof(float) * nnz,
- *                hipMemcpyDeviceToDevice);
- *  \endcode
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p user_ell_width is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p coo_val,
+ *              \p coo_row_ind, \p coo_col_ind or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
+ *              allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_coo2csr(rocsparse_handle     handle,
-                                   const rocsparse_int* coo_row_ind,
-                                   rocsparse_int        nnz,
-                                   rocsparse_int        m,
-                                   rocsparse_int*       csr_row_ptr,
-                                   rocsparse_index_base idx_base);
+rocsparse_status rocsparse_scoo2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    coo_val,
+                                    rocsparse_int*            coo_row_ind,
+                                    rocsparse_int*            coo_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcoo2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   coo_val,
+                                    rocsparse_int*            coo_row_ind,
+                                    rocsparse_int*            coo_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type,
+                                    void*                     temp_buffer);
+/**@}*/
 
 /*! \ingroup conv_module
  *  \brief Convert a sparse ELL matrix into a sparse CSR matrix
@@ -3111,11 +12547,12 @@ rocsparse_status rocsparse_coo2csr(rocsparse_handle     handle,
  *  \p rocsparse_ell2csr_nnz computes the total CSR non-zero elements and the CSR
  *  row offsets, that point to the start of every row of the sparse CSR matrix, for
  *  a given ELL matrix. It is assumed that \p csr_row_ptr has been allocated with
- *  size \p m + 1.
+ *  size \p m + 1. \p csr_nnz obeys the \ref rocsparse_pointer_mode of the library
+ *  context.
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  In device pointer mode, this function is non blocking and executed asynchronously
+ *  with respect to the host. It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -3269,57 +12706,284 @@ rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          handle,
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sell2csr(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    const float*              ell_val,
-                                    const rocsparse_int*      ell_col_ind,
-                                    const rocsparse_mat_descr csr_descr,
-                                    float*                    csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    rocsparse_int*            csr_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dell2csr(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    const double*             ell_val,
-                                    const rocsparse_int*      ell_col_ind,
-                                    const rocsparse_mat_descr csr_descr,
-                                    double*                   csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    rocsparse_int*            csr_col_ind);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cell2csr(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    const rocsparse_float_complex* ell_val,
-                                    const rocsparse_int* ell_col_ind,
-                                    const rocsparse_mat_descr csr_descr,
-                                    rocsparse_float_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    rocsparse_int* csr_col_ind);
+rocsparse_status rocsparse_sell2csr(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    const float*              ell_val,
+                                    const rocsparse_int*      ell_col_ind,
+                                    const rocsparse_mat_descr csr_descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dell2csr(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    const double*             ell_val,
+                                    const rocsparse_int*      ell_col_ind,
+                                    const rocsparse_mat_descr csr_descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cell2csr(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_mat_descr      ell_descr,
+                                    rocsparse_int                  ell_width,
+                                    const rocsparse_float_complex* ell_val,
+                                    const rocsparse_int*           ell_col_ind,
+                                    const rocsparse_mat_descr      csr_descr,
+                                    rocsparse_float_complex*       csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    rocsparse_int*                 csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zell2csr(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_mat_descr       ell_descr,
+                                    rocsparse_int                   ell_width,
+                                    const rocsparse_double_complex* ell_val,
+                                    const rocsparse_int*            ell_col_ind,
+                                    const rocsparse_mat_descr       csr_descr,
+                                    rocsparse_double_complex*       csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    rocsparse_int*                  csr_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a dense matrix into a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_dense2csr_buffer_size returns the size of the temporary storage
+ *  buffer required by rocsparse_sdense2csr_nnz() and rocsparse_ddense2csr_nnz().
+ *  The temporary storage buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the dense matrix.
+ *  @param[in]
+ *  n           number of columns of the dense matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dense2csr_buffer_size(rocsparse_handle handle,
+                                                 rocsparse_int    m,
+                                                 rocsparse_int    n,
+                                                 size_t*          buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Convert a dense matrix into a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_dense2csr_nnz computes the row pointer array and the total
+ *  number of non-zero entries of the sparse CSR matrix for a given
+ *  column-major dense matrix. \p nnz obeys the \ref rocsparse_pointer_mode of
+ *  the library context. The required temporary storage buffer size is
+ *  obtained by rocsparse_dense2csr_buffer_size().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the dense matrix.
+ *  @param[in]
+ *  n           number of columns of the dense matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  A           array of dimension (\p lda, \p n) containing the column-major
+ *              dense matrix.
+ *  @param[in]
+ *  lda         leading dimension of the dense matrix.
+ *  @param[out]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[out]
+ *  nnz         pointer to the number of non-zero entries of the sparse CSR
+ *              matrix.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p lda is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p A, \p csr_row_ptr,
+ *              \p nnz or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdense2csr_nnz(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              A,
+                                          rocsparse_int             lda,
+                                          rocsparse_int*            csr_row_ptr,
+                                          rocsparse_int*            nnz,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddense2csr_nnz(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             A,
+                                          rocsparse_int             lda,
+                                          rocsparse_int*            csr_row_ptr,
+                                          rocsparse_int*            nnz,
+                                          void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a dense matrix into a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_dense2csr compacts the non-zero entries of a column-major
+ *  dense matrix into a sparse CSR matrix. It is assumed that \p csr_row_ptr
+ *  and the number of non-zero entries have been obtained by
+ *  rocsparse_sdense2csr_nnz() or rocsparse_ddense2csr_nnz() and that
+ *  \p csr_val and \p csr_col_ind are allocated accordingly.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the dense matrix.
+ *  @param[in]
+ *  n           number of columns of the dense matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  A           array of dimension (\p lda, \p n) containing the column-major
+ *              dense matrix.
+ *  @param[in]
+ *  lda         leading dimension of the dense matrix.
+ *  @param[out]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[out]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p lda is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p A, \p csr_val,
+ *              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdense2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              A,
+                                      rocsparse_int             lda,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddense2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             A,
+                                      rocsparse_int             lda,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a dense matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2dense converts a sparse CSR matrix into a column-major
+ *  dense matrix. Structural zeros are written explicitly, such that \p A
+ *  holds the full \p m times \p n matrix afterwards.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to
+ *  the host. It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array containing the values of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row
+ *              of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  A           array of dimension (\p lda, \p n) containing the column-major
+ *              dense matrix.
+ *  @param[in]
+ *  lda         leading dimension of the dense matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p lda is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind or \p A pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      float*                    A,
+                                      rocsparse_int             lda);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zell2csr(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int ell_width,
-                                    const rocsparse_double_complex* ell_val,
-                                    const rocsparse_int* ell_col_ind,
-                                    const rocsparse_mat_descr csr_descr,
-                                    rocsparse_double_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    rocsparse_int* csr_col_ind);
-*/
+rocsparse_status rocsparse_dcsr2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      double*                   A,
+                                      rocsparse_int             lda);
 /**@}*/
 
 /*! \ingroup conv_module
@@ -3371,146 +13035,404 @@ rocsparse_status rocsparse_create_identity_permutation(rocsparse_handle handle,
                                                        rocsparse_int*   p);
 
 /*! \ingroup conv_module
- *  \brief Sort a sparse CSR matrix
+ *  \brief Sort a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrsort_buffer_size returns the size of the temporary storage buffer
+ *  required by rocsparse_csrsort(). The temporary storage buffer must be allocated by
+ *  the user.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  CSR matrix.
+ *  @param[out]
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_csrsort().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *              \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsort_buffer_size(rocsparse_handle     handle,
+                                               rocsparse_int        m,
+                                               rocsparse_int        n,
+                                               rocsparse_int        nnz,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               size_t*              buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Sort a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrsort sorts a matrix in CSR format. The sorted permutation vector
+ *  \p perm can be used to obtain sorted \p csr_val array. In this case, \p perm must be
+ *  initialized as the identity permutation, see rocsparse_create_identity_permutation().
+ *
+ *  \p rocsparse_csrsort requires extra temporary storage buffer that has to be allocated by
+ *  the user. Storage buffer size can be determined by rocsparse_csrsort_buffer_size().
+ *
+ *  \note
+ *  \p perm can be \p NULL if a sorted permutation vector is not required.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[inout]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  CSR matrix.
+ *  @param[inout]
+ *  perm            array of \p nnz integers containing the unsorted map indices, can be
+ *                  \p NULL.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+ *                  rocsparse_csrsort_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
+ *              or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  The following example sorts a \f$3 \times 3\f$ CSR matrix.
+ *  \code{.c}
+ *      //     1 2 3
+ *      // A = 4 5 6
+ *      //     7 8 9
+ *      rocsparse_int m   = 3;
+ *      rocsparse_int n   = 3;
+ *      rocsparse_int nnz = 9;
+ *
+ *      csr_row_ptr[m + 1] = {0, 3, 6, 9};                // device memory
+ *      csr_col_ind[nnz]   = {2, 0, 1, 0, 1, 2, 0, 2, 1}; // device memory
+ *      csr_val[nnz]       = {3, 1, 2, 4, 5, 6, 7, 9, 8}; // device memory
+ *
+ *      // Create permutation vector perm as the identity map
+ *      rocsparse_int* perm;
+ *      hipMalloc((void**)&perm, sizeof(rocsparse_int) * nnz);
+ *      rocsparse_create_identity_permutation(handle, nnz, perm);
+ *
+ *      // Allocate temporary buffer
+ *      size_t buffer_size;
+ *      void* temp_buffer;
+ *      rocsparse_csrsort_buffer_size(handle, m, n, nnz, csr_row_ptr, csr_col_ind, &buffer_size);
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Sort the CSR matrix
+ *      rocsparse_csrsort(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, perm, temp_buffer);
+ *
+ *      // Gather sorted csr_val array
+ *      float* csr_val_sorted;
+ *      hipMalloc((void**)&csr_val_sorted, sizeof(float) * nnz);
+ *      rocsparse_sgthr(handle, nnz, csr_val, csr_val_sorted, perm, rocsparse_index_base_zero);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      hipFree(perm);
+ *      hipFree(csr_val);
+ *  \endcode
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int*            csr_col_ind,
+                                   rocsparse_int*            perm,
+                                   void*                     temp_buffer);
+
+/*! \ingroup conv_module
+ *  \brief Obtain the temporary buffer size for rocsparse_scsrsort_values() and
+ *  rocsparse_dcsrsort_values().
+ *
+ *  \details
+ *  \p rocsparse_csrsort_values_buffer_size returns the size of the temporary storage
+ *  buffer required by rocsparse_scsrsort_values() and rocsparse_dcsrsort_values().
+ *  The temporary storage buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the
+ *                  sparse CSR matrix.
+ *  @param[out]
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_scsrsort_values() and rocsparse_dcsrsort_values().
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *          \p buffer_size pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsort_values_buffer_size(rocsparse_handle     handle,
+                                                       rocsparse_int        m,
+                                                       rocsparse_int        n,
+                                                       rocsparse_int        nnz,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       size_t*              buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsort_values_buffer_size(rocsparse_handle     handle,
+                                                       rocsparse_int        m,
+                                                       rocsparse_int        n,
+                                                       rocsparse_int        nnz,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       size_t*              buffer_size);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Sort a sparse CSR matrix including its values.
+ *
+ *  \details
+ *  \p rocsparse_csrsort_values sorts a matrix in CSR format, like
+ *  rocsparse_csrsort(), but carries the value array through the segmented sort
+ *  instead of returning a permutation vector. This fuses the subsequent gather of
+ *  the values, e.g. using rocsparse_sgthr() or rocsparse_dgthr(), into the sort and
+ *  saves a full pass over the matrix. The column indices and values are sorted in
+ *  place.
+ *
+ *  \p rocsparse_csrsort_values requires extra temporary storage buffer that has to
+ *  be allocated by the user. Storage buffer size can be determined by
+ *  rocsparse_scsrsort_values_buffer_size() and rocsparse_dcsrsort_values_buffer_size().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+ *                  the sparse CSR matrix.
+ *  @param[inout]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the
+ *                  sparse CSR matrix.
+ *  @param[inout]
+ *  csr_val         array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned
+ *                  by rocsparse_scsrsort_values_buffer_size() and
+ *                  rocsparse_dcsrsort_values_buffer_size().
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *          \p csr_col_ind, \p csr_val or \p temp_buffer pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsort_values(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           rocsparse_int*            csr_col_ind,
+                                           float*                    csr_val,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsort_values(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           rocsparse_int*            csr_col_ind,
+                                           double*                   csr_val,
+                                           void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Multicolor reordering of a sparse CSR matrix
  *
  *  \details
- *  \p rocsparse_csrsort_buffer_size returns the size of the temporary storage buffer
- *  required by rocsparse_csrsort(). The temporary storage buffer must be allocated by
- *  the user.
+ *  \p rocsparse_csrcolor computes a multicoloring of the adjacency graph of a sparse
+ *  \f$m \times m\f$ CSR matrix, such that no two rows of the same color are connected
+ *  by a non-zero entry. The coloring is computed on the device using parallel
+ *  Jones-Plassmann-Luby iterations. The number of colors is returned in \p ncolors and
+ *  the color of each row is written to \p coloring.
+ *
+ *  If \p perm is not \p NULL, additionally a permutation is created that groups the
+ *  rows by color, such that each color forms one large contiguous independent set.
+ *  Reordering a matrix with this permutation widens the parallelism that is available
+ *  to the dependency driven triangular solve and factorization routines, e.g.
+ *  rocsparse_scsrsv_solve() or rocsparse_scsrilu0(), at the cost of a possibly slower
+ *  convergence of the preconditioned iteration. The permutation is compatible with the
+ *  permutation machinery of rocsparse_csrsort(), e.g. it can be applied to an array
+ *  using rocsparse_sgthr() or rocsparse_dgthr().
+ *
+ *  \note
+ *  The pattern of the sparse CSR matrix is assumed to be symmetric.
+ *
+ *  \note \p rocsparse_csrcolor is a blocking function. It might influence
+ *  performance negatively.
  *
  *  @param[in]
- *  handle          handle to the rocsparse library context queue.
+ *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  m               number of rows of the sparse CSR matrix.
+ *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  n               number of columns of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  descr       descriptor of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
- *                  sparse CSR matrix.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
- *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
- *                  CSR matrix.
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
  *  @param[out]
- *  buffer_size     number of bytes of the temporary storage buffer required by
- *                  rocsparse_csrsort().
+ *  ncolors     number of distinct colors, can be in host or device memory.
+ *  @param[out]
+ *  coloring    array of \p m elements containing the color of each row.
+ *  @param[out]
+ *  perm        array of \p m elements containing the permutation that groups the rows
+ *              by color, can be \p NULL.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
- *              \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p ncolors or \p coloring pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsort_buffer_size(rocsparse_handle     handle,
-                                               rocsparse_int        m,
-                                               rocsparse_int        n,
-                                               rocsparse_int        nnz,
-                                               const rocsparse_int* csr_row_ptr,
-                                               const rocsparse_int* csr_col_ind,
-                                               size_t*              buffer_size);
+rocsparse_status rocsparse_csrcolor(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int*            ncolors,
+                                    rocsparse_int*            coloring,
+                                    rocsparse_int*            perm);
 
 /*! \ingroup conv_module
- *  \brief Sort a sparse CSR matrix
+ *  \brief Bandwidth reducing reordering of a sparse CSR matrix
  *
  *  \details
- *  \p rocsparse_csrsort sorts a matrix in CSR format. The sorted permutation vector
- *  \p perm can be used to obtain sorted \p csr_val array. In this case, \p perm must be
- *  initialized as the identity permutation, see rocsparse_create_identity_permutation().
- *
- *  \p rocsparse_csrsort requires extra temporary storage buffer that has to be allocated by
- *  the user. Storage buffer size can be determined by rocsparse_csrsort_buffer_size().
+ *  \p rocsparse_csrrcm computes a reverse Cuthill-McKee ordering of the adjacency
+ *  graph of a sparse \f$m \times m\f$ CSR matrix on the device. The rows are levelized
+ *  by a breadth first search, started at a row of minimum degree and refined once
+ *  towards the periphery of the graph, and ordered by level and by degree within each
+ *  level. Reordering a matrix with the resulting permutation clusters the non-zero
+ *  entries around the diagonal, which improves the locality of the \f$x\f$ vector
+ *  reads of the iterated sparse matrix-vector product.
+ *
+ *  The permutation is written to \p perm, where \p perm[i] holds the original index of
+ *  the row that is placed at position \p i. It is compatible with the permutation
+ *  machinery of rocsparse_csrsort(), e.g. it can be applied to an array using
+ *  rocsparse_sgthr() or rocsparse_dgthr().
  *
  *  \note
- *  \p perm can be \p NULL if a sorted permutation vector is not required.
+ *  The pattern of the sparse CSR matrix is assumed to be symmetric.
  *
  *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
+ *  Each connected component of the adjacency graph is levelized by its own breadth
+ *  first search. Matrices that decompose into very many components degrade to the
+ *  component count in sequential steps.
+ *
+ *  \note \p rocsparse_csrrcm is a blocking function. It might influence
+ *  performance negatively.
  *
  *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  m               number of rows of the sparse CSR matrix.
+ *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  n               number of columns of the sparse CSR matrix.
+ *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
- *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  descr           descriptor of the sparse CSR matrix. Currently, only
- *                  \ref rocsparse_matrix_type_general is supported.
+ *  descr       descriptor of the sparse CSR matrix.
  *  @param[in]
- *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
- *                  sparse CSR matrix.
- *  @param[inout]
- *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
- *                  CSR matrix.
- *  @param[inout]
- *  perm            array of \p nnz integers containing the unsorted map indices, can be
- *                  \p NULL.
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
  *  @param[in]
- *  temp_buffer     temporary storage buffer allocated by the user, size is returned by
- *                  rocsparse_csrsort_buffer_size().
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  perm        array of \p m elements containing the reverse Cuthill-McKee
+ *              permutation.
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
- *              or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind or \p perm pointer is invalid.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  The following example sorts a \f$3 \times 3\f$ CSR matrix.
- *  \code{.c}
- *      //     1 2 3
- *      // A = 4 5 6
- *      //     7 8 9
- *      rocsparse_int m   = 3;
- *      rocsparse_int n   = 3;
- *      rocsparse_int nnz = 9;
- *
- *      csr_row_ptr[m + 1] = {0, 3, 6, 9};                // device memory
- *      csr_col_ind[nnz]   = {2, 0, 1, 0, 1, 2, 0, 2, 1}; // device memory
- *      csr_val[nnz]       = {3, 1, 2, 4, 5, 6, 7, 9, 8}; // device memory
- *
- *      // Create permutation vector perm as the identity map
- *      rocsparse_int* perm;
- *      hipMalloc((void**)&perm, sizeof(rocsparse_int) * nnz);
- *      rocsparse_create_identity_permutation(handle, nnz, perm);
- *
- *      // Allocate temporary buffer
- *      size_t buffer_size;
- *      void* temp_buffer;
- *      rocsparse_csrsort_buffer_size(handle, m, n, nnz, csr_row_ptr, csr_col_ind, &buffer_size);
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Sort the CSR matrix
- *      rocsparse_csrsort(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, perm, temp_buffer);
- *
- *      // Gather sorted csr_val array
- *      float* csr_val_sorted;
- *      hipMalloc((void**)&csr_val_sorted, sizeof(float) * nnz);
- *      rocsparse_sgthr(handle, nnz, csr_val, csr_val_sorted, perm, rocsparse_index_base_zero);
- *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      hipFree(perm);
- *      hipFree(csr_val);
- *  \endcode
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             n,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   rocsparse_int*            csr_col_ind,
-                                   rocsparse_int*            perm,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_int*            perm);
 
 /*! \ingroup conv_module
  *  \brief Sort a sparse COO matrix
@@ -3774,6 +13696,162 @@ rocsparse_status rocsparse_coosort_by_column(rocsparse_handle handle,
                                              rocsparse_int*   perm,
                                              void*            temp_buffer);
 
+/*! \ingroup conv_module
+ *  \brief Obtain the size of the low memory COO sort temporary storage buffer
+ *
+ *  \details
+ *  \p rocsparse_coosort_low_mem_buffer_size returns the size of the temporary storage
+ *  buffer that is required by rocsparse_coosort_by_row_low_mem() and
+ *  rocsparse_coosort_by_column_low_mem(). The temporary storage buffer has to be
+ *  allocated by the user.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse COO matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse COO matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse COO matrix.
+ *  @param[in]
+ *  coo_row_ind     array of \p nnz elements containing the row indices of the sparse
+ *                  COO matrix.
+ *  @param[in]
+ *  coo_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  COO matrix.
+ *  @param[out]
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_coosort_by_row_low_mem() and
+ *                  rocsparse_coosort_by_column_low_mem().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind, \p coo_col_ind or
+ *              \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_coosort_low_mem_buffer_size(rocsparse_handle     handle,
+                                                       rocsparse_int        m,
+                                                       rocsparse_int        n,
+                                                       rocsparse_int        nnz,
+                                                       const rocsparse_int* coo_row_ind,
+                                                       const rocsparse_int* coo_col_ind,
+                                                       size_t*              buffer_size);
+
+/*! \ingroup conv_module
+ *  \brief Sort a sparse COO matrix by row, with reduced memory footprint
+ *
+ *  \details
+ *  \p rocsparse_coosort_by_row_low_mem sorts a matrix in COO format by row, like
+ *  rocsparse_coosort_by_row(), but with a temporary storage buffer that no longer
+ *  holds double-buffer copies of the rows, the columns and the permutation. The rows
+ *  are ordered by a counting sort and the columns of each row are sorted in chunks
+ *  with a bounded working set, trading additional passes over the data for roughly
+ *  a third of the peak memory footprint. It is intended for ingest paths that sort
+ *  the largest matrices of a run while memory headroom is tight.
+ *
+ *  The sorted permutation vector \p perm can be used to obtain sorted \p coo_val
+ *  array. In this case, \p perm must be initialized as the identity permutation,
+ *  see rocsparse_create_identity_permutation().
+ *
+ *  \note
+ *  \p perm can be \p NULL if a sorted permutation vector is not required.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse COO matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse COO matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse COO matrix.
+ *  @param[inout]
+ *  coo_row_ind     array of \p nnz elements containing the row indices of the sparse
+ *                  COO matrix.
+ *  @param[inout]
+ *  coo_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  COO matrix.
+ *  @param[inout]
+ *  perm            array of \p nnz integers containing the unsorted map indices, can be
+ *                  \p NULL.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+ *                  rocsparse_coosort_low_mem_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind, \p coo_col_ind or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_coosort_by_row_low_mem(rocsparse_handle handle,
+                                                  rocsparse_int    m,
+                                                  rocsparse_int    n,
+                                                  rocsparse_int    nnz,
+                                                  rocsparse_int*   coo_row_ind,
+                                                  rocsparse_int*   coo_col_ind,
+                                                  rocsparse_int*   perm,
+                                                  void*            temp_buffer);
+
+/*! \ingroup conv_module
+ *  \brief Sort a sparse COO matrix by column, with reduced memory footprint
+ *
+ *  \details
+ *  \p rocsparse_coosort_by_column_low_mem sorts a matrix in COO format by column,
+ *  like rocsparse_coosort_by_column(), using the reduced footprint sort path of
+ *  rocsparse_coosort_by_row_low_mem().
+ *
+ *  \note
+ *  \p perm can be \p NULL if a sorted permutation vector is not required.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse COO matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse COO matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse COO matrix.
+ *  @param[inout]
+ *  coo_row_ind     array of \p nnz elements containing the row indices of the sparse
+ *                  COO matrix.
+ *  @param[inout]
+ *  coo_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  COO matrix.
+ *  @param[inout]
+ *  perm            array of \p nnz integers containing the unsorted map indices, can be
+ *                  \p NULL.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+ *                  rocsparse_coosort_low_mem_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p coo_row_ind, \p coo_col_ind or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_coosort_by_column_low_mem(rocsparse_handle handle,
+                                                     rocsparse_int    m,
+                                                     rocsparse_int    n,
+                                                     rocsparse_int    nnz,
+                                                     rocsparse_int*   coo_row_ind,
+                                                     rocsparse_int*   coo_col_ind,
+                                                     rocsparse_int*   perm,
+                                                     void*            temp_buffer);
+
 #ifdef __cplusplus
 }
 #endif
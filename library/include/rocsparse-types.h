@@ -33,6 +33,10 @@
 
 /*! \ingroup types_module
  *  \brief Specifies whether int32 or int64 is used.
+ *
+ *  \details
+ *  rocsparse_int is 32 bits wide by default and 64 bits wide when the
+ *  library is built with BUILD_ILP64=ON, which defines rocsparse_ILP64.
  */
 #if defined(rocsparse_ILP64)
 typedef int64_t rocsparse_int;
@@ -40,6 +44,199 @@ typedef int64_t rocsparse_int;
 typedef int32_t rocsparse_int;
 #endif
 
+/*! \ingroup types_module
+ *  \brief 16 bit floating point type.
+ *
+ *  \details
+ *  IEEE 754 half precision type, used for reduced precision matrix value
+ *  storage in the mixed precision routines. The data layout matches the
+ *  device side half precision type, the host is not expected to operate
+ *  on the values.
+ */
+typedef uint16_t rocsparse_half;
+
+/* Host / device qualifier for the complex type member functions, only
+ * required when compiling with a HIP capable compiler */
+#if defined(__HIPCC__) || defined(__HIP_DEVICE_COMPILE__)
+#define ROCSPARSE_HOST_DEVICE __host__ __device__
+#else
+#define ROCSPARSE_HOST_DEVICE
+#endif
+
+#ifdef __cplusplus
+
+/*! \ingroup types_module
+ *  \brief Single precision complex type.
+ *
+ *  \details
+ *  Interleaved storage of real and imaginary part, compatible with the
+ *  C99 float complex memory layout. The arithmetic operators are available
+ *  on host and device.
+ */
+struct rocsparse_float_complex
+{
+    float x; //!< real part
+    float y; //!< imaginary part
+
+    rocsparse_float_complex() = default;
+    ROCSPARSE_HOST_DEVICE rocsparse_float_complex(float r, float i = 0.0f) : x(r), y(i) {}
+
+    ROCSPARSE_HOST_DEVICE rocsparse_float_complex& operator+=(const rocsparse_float_complex& rhs)
+    {
+        x += rhs.x;
+        y += rhs.y;
+        return *this;
+    }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_float_complex& operator-=(const rocsparse_float_complex& rhs)
+    {
+        x -= rhs.x;
+        y -= rhs.y;
+        return *this;
+    }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_float_complex& operator*=(const rocsparse_float_complex& rhs)
+    {
+        float r = x * rhs.x - y * rhs.y;
+        float i = x * rhs.y + y * rhs.x;
+        x       = r;
+        y       = i;
+        return *this;
+    }
+};
+
+/*! \ingroup types_module
+ *  \brief Double precision complex type.
+ *
+ *  \details
+ *  Interleaved storage of real and imaginary part, compatible with the
+ *  C99 double complex memory layout. The arithmetic operators are available
+ *  on host and device.
+ */
+struct rocsparse_double_complex
+{
+    double x; //!< real part
+    double y; //!< imaginary part
+
+    rocsparse_double_complex() = default;
+    ROCSPARSE_HOST_DEVICE rocsparse_double_complex(double r, double i = 0.0) : x(r), y(i) {}
+
+    ROCSPARSE_HOST_DEVICE rocsparse_double_complex& operator+=(const rocsparse_double_complex& rhs)
+    {
+        x += rhs.x;
+        y += rhs.y;
+        return *this;
+    }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_double_complex& operator-=(const rocsparse_double_complex& rhs)
+    {
+        x -= rhs.x;
+        y -= rhs.y;
+        return *this;
+    }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_double_complex& operator*=(const rocsparse_double_complex& rhs)
+    {
+        double r = x * rhs.x - y * rhs.y;
+        double i = x * rhs.y + y * rhs.x;
+        x        = r;
+        y        = i;
+        return *this;
+    }
+};
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_float_complex operator+(rocsparse_float_complex lhs,
+                                                               const rocsparse_float_complex& rhs)
+{
+    return lhs += rhs;
+}
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_float_complex operator-(rocsparse_float_complex lhs,
+                                                               const rocsparse_float_complex& rhs)
+{
+    return lhs -= rhs;
+}
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_float_complex operator*(rocsparse_float_complex lhs,
+                                                               const rocsparse_float_complex& rhs)
+{
+    return lhs *= rhs;
+}
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_float_complex operator-(const rocsparse_float_complex& val)
+{
+    return rocsparse_float_complex(-val.x, -val.y);
+}
+
+inline ROCSPARSE_HOST_DEVICE bool operator==(const rocsparse_float_complex& lhs,
+                                             const rocsparse_float_complex& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+inline ROCSPARSE_HOST_DEVICE bool operator!=(const rocsparse_float_complex& lhs,
+                                             const rocsparse_float_complex& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_double_complex operator+(rocsparse_double_complex lhs,
+                                                                const rocsparse_double_complex& rhs)
+{
+    return lhs += rhs;
+}
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_double_complex operator-(rocsparse_double_complex lhs,
+                                                                const rocsparse_double_complex& rhs)
+{
+    return lhs -= rhs;
+}
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_double_complex operator*(rocsparse_double_complex lhs,
+                                                                const rocsparse_double_complex& rhs)
+{
+    return lhs *= rhs;
+}
+
+inline ROCSPARSE_HOST_DEVICE rocsparse_double_complex operator-(const rocsparse_double_complex& val)
+{
+    return rocsparse_double_complex(-val.x, -val.y);
+}
+
+inline ROCSPARSE_HOST_DEVICE bool operator==(const rocsparse_double_complex& lhs,
+                                             const rocsparse_double_complex& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+inline ROCSPARSE_HOST_DEVICE bool operator!=(const rocsparse_double_complex& lhs,
+                                             const rocsparse_double_complex& rhs)
+{
+    return !(lhs == rhs);
+}
+
+#else /* __cplusplus */
+
+/*! \ingroup types_module
+ *  \brief Single precision complex type.
+ */
+typedef struct
+{
+    float x; /**< real part */
+    float y; /**< imaginary part */
+} rocsparse_float_complex;
+
+/*! \ingroup types_module
+ *  \brief Double precision complex type.
+ */
+typedef struct
+{
+    double x; /**< real part */
+    double y; /**< imaginary part */
+} rocsparse_double_complex;
+
+#endif /* __cplusplus */
+
 /*! \ingroup types_module
  *  \brief Handle to the rocSPARSE library context queue.
  *
@@ -73,6 +270,76 @@ typedef struct _rocsparse_mat_descr* rocsparse_mat_descr;
  */
 typedef struct _rocsparse_hyb_mat* rocsparse_hyb_mat;
 
+/*! \ingroup types_module
+ *  \brief BSR matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE BSR matrix structure holds the BSR matrix. It must be initialized using
+ *  rocsparse_create_bsr_mat() and the returned BSR matrix must be passed to all
+ *  subsequent library calls that involve the matrix. It should be destroyed at the end
+ *  using rocsparse_destroy_bsr_mat().
+ */
+typedef struct _rocsparse_bsr_mat* rocsparse_bsr_mat;
+
+/*! \ingroup types_module
+ *  \brief DCSR matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE DCSR matrix structure holds the doubly compressed sparse row
+ *  matrix, where row indices and row pointers are stored for the non-empty rows
+ *  only. It must be initialized using rocsparse_create_dcsr_mat() and the returned
+ *  DCSR matrix must be passed to all subsequent library calls that involve the
+ *  matrix. It should be destroyed at the end using rocsparse_destroy_dcsr_mat().
+ */
+typedef struct _rocsparse_dcsr_mat* rocsparse_dcsr_mat;
+
+/*! \ingroup types_module
+ *  \brief SELL-C-sigma matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE SELL matrix structure holds the SELL-C-sigma matrix. It must be
+ *  initialized using rocsparse_create_sell_mat() and the returned SELL matrix must be
+ *  passed to all subsequent library calls that involve the matrix. It should be
+ *  destroyed at the end using rocsparse_destroy_sell_mat().
+ */
+typedef struct _rocsparse_sell_mat* rocsparse_sell_mat;
+
+/*! \ingroup types_module
+ *  \brief Multi-device row-partitioned matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE DIST matrix structure holds a sparse matrix partitioned by rows
+ *  across multiple devices. It must be initialized using rocsparse_create_dist_mat()
+ *  and the returned DIST matrix must be passed to all subsequent library calls that
+ *  involve the matrix. It should be destroyed at the end using
+ *  rocsparse_destroy_dist_mat().
+ */
+typedef struct _rocsparse_dist_mat* rocsparse_dist_mat;
+
+/*! \ingroup types_module
+ *  \brief Device and host split matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE SPLIT matrix structure holds a sparse matrix split by rows
+ *  between the device and the host. It must be initialized using
+ *  rocsparse_create_split_mat() and the returned SPLIT matrix must be passed to
+ *  all subsequent library calls that involve the matrix. It should be destroyed
+ *  at the end using rocsparse_destroy_split_mat().
+ */
+typedef struct _rocsparse_split_mat* rocsparse_split_mat;
+
+/*! \ingroup types_module
+ *  \brief Incremental CSR matrix builder.
+ *
+ *  \details
+ *  The rocSPARSE CSR builder structure holds a sparse matrix under construction,
+ *  growing by row batches at amortized cost. It must be initialized using
+ *  rocsparse_create_csr_builder() and the returned builder must be passed to all
+ *  subsequent library calls that append to or finalize the matrix. It should be
+ *  destroyed at the end using rocsparse_destroy_csr_builder().
+ */
+typedef struct _rocsparse_csr_builder* rocsparse_csr_builder;
+
 /*! \ingroup types_module
  *  \brief Info structure to hold all matrix meta data.
  *
@@ -85,6 +352,31 @@ typedef struct _rocsparse_hyb_mat* rocsparse_hyb_mat;
  */
 typedef struct _rocsparse_mat_info* rocsparse_mat_info;
 
+/*! \ingroup types_module
+ *  \brief Generic API descriptor of a sparse matrix.
+ *
+ *  \details
+ *  The rocSPARSE sparse matrix descriptor holds the dimensions, the storage
+ *  format, the data type and the array pointers of a sparse matrix. It must be
+ *  initialized using a format specific creation routine, e.g.
+ *  rocsparse_create_csr_descr(), and the returned descriptor must be passed to
+ *  all subsequent generic API calls that involve the matrix. It should be
+ *  destroyed at the end using rocsparse_destroy_spmat_descr().
+ */
+typedef struct _rocsparse_spmat_descr* rocsparse_spmat_descr;
+
+/*! \ingroup types_module
+ *  \brief Generic API descriptor of a dense vector.
+ *
+ *  \details
+ *  The rocSPARSE dense vector descriptor holds the size, the data type and the
+ *  array pointer of a dense vector. It must be initialized using
+ *  rocsparse_create_dnvec_descr() and the returned descriptor must be passed
+ *  to all subsequent generic API calls that involve the vector. It should be
+ *  destroyed at the end using rocsparse_destroy_dnvec_descr().
+ */
+typedef struct _rocsparse_dnvec_descr* rocsparse_dnvec_descr;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -180,6 +472,19 @@ typedef enum rocsparse_action_
     rocsparse_action_numeric  = 1 /**< Operate on data and indices. */
 } rocsparse_action;
 
+/*! \ingroup types_module
+ *  \brief Memory layout of a dense matrix.
+ *
+ *  \details
+ *  The \ref rocsparse_order indicates whether a dense matrix is stored in
+ *  column-major or row-major layout.
+ */
+typedef enum rocsparse_order_
+{
+    rocsparse_order_column = 0, /**< matrix is stored column-major. */
+    rocsparse_order_row    = 1 /**< matrix is stored row-major. */
+} rocsparse_order;
+
 /*! \ingroup types_module
  *  \brief HYB matrix partitioning type.
  *
@@ -194,6 +499,115 @@ typedef enum rocsparse_hyb_partition_
     rocsparse_hyb_partition_max  = 2 /**< max ELL nnz per row, no COO part. */
 } rocsparse_hyb_partition;
 
+/*! \ingroup types_module
+ *  \brief CSR to CSC conversion algorithm.
+ *
+ *  \details
+ *  The \ref rocsparse_csr2csc_alg type indicates the algorithm used by
+ *  rocsparse_scsr2csc2() and rocsparse_dcsr2csc2() to transpose the matrix.
+ */
+typedef enum rocsparse_csr2csc_alg_
+{
+    rocsparse_csr2csc_alg_radix  = 0, /**< stable radix sort, row indices within each
+                                           column are sorted. */
+    rocsparse_csr2csc_alg_atomic = 1 /**< counting sort with atomic offsets, requires
+                                          less temporary storage, row indices within
+                                          each column are in undefined order. */
+} rocsparse_csr2csc_alg;
+
+/*! \ingroup types_module
+ *  \brief Level 1 operation of a fused operation chain.
+ *
+ *  \details
+ *  The \ref rocsparse_level1_op type enumerates the sparse level 1 operations that
+ *  can be fused into a single kernel pass by rocsparse_slevel1_chain() and
+ *  rocsparse_dlevel1_chain().
+ */
+typedef enum rocsparse_level1_op_
+{
+    rocsparse_level1_op_axpyi = 0, /**< y := alpha * x + y. */
+    rocsparse_level1_op_gthr  = 1, /**< x := y(x_ind). */
+    rocsparse_level1_op_gthrz = 2, /**< x := y(x_ind), y(x_ind) := 0. */
+    rocsparse_level1_op_sctr  = 3, /**< y(x_ind) := x. */
+    rocsparse_level1_op_scal  = 4, /**< x := alpha * x. */
+    rocsparse_level1_op_roti  = 5 /**< apply Givens rotation to x and y(x_ind). */
+} rocsparse_level1_op;
+
+/*! \ingroup types_module
+ *  \brief Semiring of a sparse matrix vector multiplication.
+ *
+ *  \details
+ *  The \ref rocsparse_semiring type enumerates the semirings supported by
+ *  rocsparse_scsrmv_semiring() and rocsparse_dcsrmv_semiring(). It selects the
+ *  operator combining a matrix entry with a vector entry and the operator
+ *  reducing the combined values of a row.
+ */
+typedef enum rocsparse_semiring_
+{
+    rocsparse_semiring_plus_times = 0, /**< conventional arithmetic, y = A * x. */
+    rocsparse_semiring_min_plus   = 1, /**< tropical semiring, shortest path
+                                            relaxation. */
+    rocsparse_semiring_max_times  = 2, /**< max-times semiring, most reliable
+                                            path. */
+    rocsparse_semiring_or_and     = 3 /**< boolean semiring, reachability. */
+} rocsparse_semiring;
+
+/*! \ingroup types_module
+ *  \brief Fused elementwise epilogue of a sparse matrix product.
+ *
+ *  \details
+ *  The \ref rocsparse_epilogue type selects an elementwise pass fused into
+ *  the output stage of rocsparse_scsrmv_epilogue(),
+ *  rocsparse_dcsrmv_epilogue(), rocsparse_scsrmm_epilogue() and
+ *  rocsparse_dcsrmm_epilogue(), replacing a follow-up elementwise kernel
+ *  and its extra read and write of the result. The values can be combined
+ *  by bitwise OR, composed epilogues are applied in the order diagonal
+ *  scale, vector subtract, clamp.
+ */
+typedef enum rocsparse_epilogue_
+{
+    rocsparse_epilogue_none       = 0, /**< no fused epilogue. */
+    rocsparse_epilogue_diag_scale = 1, /**< scale row i of the result by
+                                            diag[i]. */
+    rocsparse_epilogue_vector_sub = 2, /**< subtract vec[i] from row i of the
+                                            result. */
+    rocsparse_epilogue_clamp      = 4 /**< clamp the result into
+                                           [clamp_lo, clamp_hi]. */
+} rocsparse_epilogue;
+
+/*! \ingroup types_module
+ *  \brief Storage format of a sparse matrix in the generic API.
+ *
+ *  \details
+ *  The \ref rocsparse_format indicates the storage format of a sparse matrix
+ *  behind a \ref rocsparse_spmat_descr.
+ */
+typedef enum rocsparse_format_
+{
+    rocsparse_format_csr = 0, /**< CSR storage format. */
+    rocsparse_format_coo = 1, /**< COO storage format. */
+    rocsparse_format_ell = 2 /**< ELL storage format. */
+} rocsparse_format;
+
+/*! \ingroup types_module
+ *  \brief Data type of the array behind a generic API descriptor.
+ *
+ *  \details
+ *  The \ref rocsparse_datatype indicates the precision of the values behind a
+ *  \ref rocsparse_spmat_descr or \ref rocsparse_dnvec_descr. The storage
+ *  precision of a matrix may differ from the compute precision of an
+ *  operation, the supported combinations are listed at the respective
+ *  generic routine, e.g. rocsparse_spmv().
+ */
+typedef enum rocsparse_datatype_
+{
+    rocsparse_datatype_f16_r = 150, /**< 16 bit floating point, real. */
+    rocsparse_datatype_f32_r = 151, /**< 32 bit floating point, real. */
+    rocsparse_datatype_f64_r = 152, /**< 64 bit floating point, real. */
+    rocsparse_datatype_f32_c = 154, /**< 32 bit floating point, complex. */
+    rocsparse_datatype_f64_c = 155 /**< 64 bit floating point, complex. */
+} rocsparse_datatype;
+
 /*! \ingroup types_module
  *  \brief Specify policy in analysis functions.
  *
@@ -205,19 +619,44 @@ typedef enum rocsparse_hyb_partition_
  */
 typedef enum rocsparse_analysis_policy_
 {
-    rocsparse_analysis_policy_reuse = 0, /**< try to re-use meta data. */
-    rocsparse_analysis_policy_force = 1 /**< force to re-build meta data. */
+    rocsparse_analysis_policy_reuse  = 0, /**< try to re-use meta data. */
+    rocsparse_analysis_policy_force  = 1, /**< force to re-build meta data. */
+    rocsparse_analysis_policy_shared = 2 /**< re-build meta data and share it with
+                                              other routines. */
 } rocsparse_analysis_policy;
 
 /*! \ingroup types_module
  *  \brief Specify policy in triangular solvers and factorizations.
  *
  *  \details
- *  This is a placeholder.
+ *  The \ref rocsparse_solve_policy specifies how the dependencies between the rows of a
+ *  triangular system are resolved during the solve phase. While
+ *  \ref rocsparse_solve_policy_auto processes all rows in a single kernel, spin waiting
+ *  on not yet available dependencies, \ref rocsparse_solve_policy_level launches one
+ *  kernel per dependency level, such that no wavefront ever has to busy wait. The level
+ *  based policy can be beneficial for matrices with long dependency chains.
+ *  \ref rocsparse_solve_policy_jacobi does not resolve the dependencies at all, but
+ *  instead approximates the solution by a fixed number of fully parallel Jacobi sweeps
+ *  on the triangular system. This can be sufficient for preconditioner applications.
  */
+/*! \ingroup types_module
+ *  \brief Callback function to asynchronously report a zero pivot.
+ *
+ *  \details
+ *  The callback is invoked from a background thread, once all operations that
+ *  have been enqueued to the stream prior to the zero pivot query have
+ *  completed. \p position is the index of the first zero pivot, using the
+ *  index base of the matrix, or -1 if no zero pivot has been found.
+ *  \p user_data is passed through unchanged. The callback must not enqueue
+ *  work to the stream it is invoked from.
+ */
+typedef void (*rocsparse_zero_pivot_callback)(rocsparse_int position, void* user_data);
+
 typedef enum rocsparse_solve_policy_
 {
-    rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
+    rocsparse_solve_policy_auto   = 0, /**< automatically decide on level information. */
+    rocsparse_solve_policy_level  = 1, /**< solve level by level, without spin waiting. */
+    rocsparse_solve_policy_jacobi = 2 /**< approximate solve using Jacobi sweeps. */
 } rocsparse_solve_policy;
 
 /*! \ingroup types_module
@@ -235,6 +674,48 @@ typedef enum rocsparse_pointer_mode_
     rocsparse_pointer_mode_device = 1 /**< scalar pointers are in device memory. */
 } rocsparse_pointer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates whether atomic updates may be used by compute kernels.
+ *
+ *  \details
+ *  Several kernels finalize rows that are shared between workgroups with
+ *  atomic additions, whose ordering varies from run to run and thus produces
+ *  results that are not bitwise reproducible. With
+ *  \ref rocsparse_atomics_not_allowed, the atomic finalization is replaced by
+ *  partial sums written to fixed slots that are combined by an ordered fix-up
+ *  pass, trading a small performance overhead for bitwise identical results
+ *  on every run. The \ref rocsparse_atomics_mode can be changed by
+ *  rocsparse_set_atomics_mode(). The currently used mode can be obtained by
+ *  rocsparse_get_atomics_mode().
+ */
+typedef enum rocsparse_atomics_mode_
+{
+    rocsparse_atomics_allowed     = 0, /**< atomic updates are allowed. */
+    rocsparse_atomics_not_allowed = 1 /**< deterministic, atomic free updates. */
+} rocsparse_atomics_mode;
+
+/*! \ingroup types_module
+ *  \brief Status word reported by the matrix validation routines.
+ *
+ *  \details
+ *  The \ref rocsparse_data_status is a bit mask reported by
+ *  rocsparse_check_matrix_csr() that describes all defects found in the
+ *  matrix data. \ref rocsparse_data_status_ok indicates that none of the
+ *  checks found a defect.
+ */
+typedef enum rocsparse_data_status_
+{
+    rocsparse_data_status_ok                 = 0, /**< no defect found. */
+    rocsparse_data_status_invalid_offset_ptr = 1, /**< row offsets are negative,
+                                                       not monotonically increasing
+                                                       or inconsistent with nnz. */
+    rocsparse_data_status_invalid_index      = 2, /**< column index out of bounds. */
+    rocsparse_data_status_invalid_sorting    = 4, /**< column indices are not in
+                                                       ascending order within a row. */
+    rocsparse_data_status_duplicate_entry    = 8 /**< row stores a column index
+                                                      more than once. */
+} rocsparse_data_status;
+
 /*! \ingroup types_module
  *  \brief Indicates if layer is active with bitmask.
  *
@@ -243,11 +724,32 @@ typedef enum rocsparse_pointer_mode_
  */
 typedef enum rocsparse_layer_mode
 {
-    rocsparse_layer_mode_none      = 0x0, /**< layer is not active. */
-    rocsparse_layer_mode_log_trace = 0x1, /**< layer is in logging mode. */
-    rocsparse_layer_mode_log_bench = 0x2 /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_none        = 0x0, /**< layer is not active. */
+    rocsparse_layer_mode_log_trace   = 0x1, /**< layer is in logging mode. */
+    rocsparse_layer_mode_log_bench   = 0x2, /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_log_profile = 0x4, /**< layer is in profiling mode. */
+    rocsparse_layer_mode_log_roctx   = 0x8 /**< layer emits roctx ranges. */
 } rocsparse_layer_mode;
 
+/*! \ingroup types_module
+ *  \brief Single entry of the per-routine profiling table.
+ *
+ *  \details
+ *  While the \ref rocsparse_layer_mode_log_profile layer is active, the library
+ *  accumulates call counts, device execution times and moved bytes per routine
+ *  on the handle. The table can be queried using rocsparse_profile_snapshot()
+ *  in terms of \ref rocsparse_profile_entry structures and cleared using
+ *  rocsparse_profile_reset().
+ */
+typedef struct rocsparse_profile_entry_
+{
+    char     name[64];  /**< routine name. */
+    uint64_t calls;     /**< number of recorded calls. */
+    double   time_ms;   /**< accumulated device time in milliseconds. */
+    double   bytes;     /**< accumulated bytes moved. */
+    double   bandwidth; /**< achieved bandwidth in GB/s. */
+} rocsparse_profile_entry;
+
 /*! \ingroup types_module
  *  \brief List of rocsparse status codes definition.
  *
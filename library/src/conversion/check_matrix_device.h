@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CHECK_MATRIX_DEVICE_H
+#define CHECK_MATRIX_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Validates the row offset array of a CSR matrix. One thread per row checks
+// that its offsets are non-negative, monotonically increasing and consistent
+// with the index base and the number of non-zero entries. Defects are
+// combined into the status word with atomic or
+__global__ void check_matrix_csr_row_ptr_kernel(rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                rocsparse_index_base idx_base,
+                                                int* __restrict__ data_status)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    if(row == 0 && row_begin != 0)
+    {
+        atomicOr(data_status, rocsparse_data_status_invalid_offset_ptr);
+    }
+
+    if(row == m - 1 && row_end != nnz)
+    {
+        atomicOr(data_status, rocsparse_data_status_invalid_offset_ptr);
+    }
+
+    if(row_begin < 0 || row_begin > row_end || row_end > nnz)
+    {
+        atomicOr(data_status, rocsparse_data_status_invalid_offset_ptr);
+    }
+}
+
+// Validates the column indices of a CSR matrix. One wavefront per row streams
+// through the row entries, checking each column index against the matrix
+// bounds and against its predecessor for ascending order and duplicates.
+// Defects are combined into the status word with atomic or
+template <rocsparse_int WF_SIZE>
+__global__ void check_matrix_csr_col_ind_kernel(rocsparse_int m,
+                                                rocsparse_int n,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ csr_col_ind,
+                                                rocsparse_index_base idx_base,
+                                                int* __restrict__ data_status)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int lid = gid & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Broken row offsets are reported by the row pointer check, do not
+    // follow them into out of bounds accesses
+    if(row_begin < 0 || row_begin > row_end)
+    {
+        return;
+    }
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col < 0 || col >= n)
+        {
+            atomicOr(data_status, rocsparse_data_status_invalid_index);
+        }
+
+        if(j > row_begin)
+        {
+            rocsparse_int prev = csr_col_ind[j - 1] - idx_base;
+
+            if(prev == col)
+            {
+                atomicOr(data_status, rocsparse_data_status_duplicate_entry);
+            }
+            else if(prev > col)
+            {
+                atomicOr(data_status, rocsparse_data_status_invalid_sorting);
+            }
+        }
+    }
+}
+
+#endif // CHECK_MATRIX_DEVICE_H
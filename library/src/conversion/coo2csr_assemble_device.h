@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef COO2CSR_ASSEMBLE_DEVICE_H
+#define COO2CSR_ASSEMBLE_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Fuse the row and column index of each unassembled entry into a single
+// 64 bit sort key, such that one radix sort establishes the row-major
+// order and duplicates become adjacent
+__global__ void coo2csr_assemble_keys_kernel(rocsparse_int nnz,
+                                             rocsparse_int n,
+                                             const rocsparse_int* __restrict__ coo_row_ind,
+                                             const rocsparse_int* __restrict__ coo_col_ind,
+                                             int64_t* __restrict__ keys,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    keys[gid] = static_cast<int64_t>(coo_row_ind[gid] - idx_base) * n
+                + (coo_col_ind[gid] - idx_base);
+}
+
+// Decompose the merged keys back into row and column indices and place
+// the assembled values. The row indices feed the row pointer construction
+template <typename T>
+__global__ void coo2csr_assemble_extract_kernel(rocsparse_int nnz,
+                                                rocsparse_int n,
+                                                const int64_t* __restrict__ keys,
+                                                const T* __restrict__ vals,
+                                                rocsparse_int* __restrict__ row_ind,
+                                                rocsparse_int* __restrict__ csr_col_ind,
+                                                T* __restrict__ csr_val,
+                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    int64_t key = keys[gid];
+
+    row_ind[gid]     = static_cast<rocsparse_int>(key / n) + idx_base;
+    csr_col_ind[gid] = static_cast<rocsparse_int>(key % n) + idx_base;
+    csr_val[gid]     = vals[gid];
+}
+
+#endif // COO2CSR_ASSEMBLE_DEVICE_H
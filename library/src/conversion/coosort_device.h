@@ -43,4 +43,88 @@ __global__ void coosort_permute_kernel(rocsparse_int        nnz,
     out[gid] = in[perm[gid]];
 }
 
+// Check whether the row indices are sorted in non-descending order. All
+// violating threads store the same value, no atomics are required
+__global__ void coosort_unsorted_rows_kernel(rocsparse_int        nnz,
+                                             const rocsparse_int* coo_row_ind,
+                                             rocsparse_int*       flag)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz - 1)
+    {
+        return;
+    }
+
+    if(coo_row_ind[gid] > coo_row_ind[gid + 1])
+    {
+        *flag = 1;
+    }
+}
+
+// Histogram of the row indices, counting into hist[row]. Used by the low
+// memory counting sort, which replaces the out-of-place radix sort over the
+// rows. Row indices may be zero or one based, the caller sizes the histogram
+// accordingly
+__global__ void coosort_histogram_kernel(rocsparse_int        nnz,
+                                         const rocsparse_int* coo_row_ind,
+                                         rocsparse_int*       hist)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    atomicAdd(&hist[coo_row_ind[gid]], 1);
+}
+
+// Scatter every entry to the final position of its row, bumping the write
+// offset of the row atomically. The sources are pre-copied, so reading and
+// writing the user arrays in the same pass is safe. The order within a row is
+// arbitrary, the subsequent segmented column sort establishes it
+__global__ void coosort_scatter_kernel(rocsparse_int        nnz,
+                                       const rocsparse_int* coo_row_ind,
+                                       const rocsparse_int* src_col,
+                                       const rocsparse_int* src_perm,
+                                       rocsparse_int*       dst_col,
+                                       rocsparse_int*       dst_perm,
+                                       rocsparse_int*       offsets)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int dst = atomicAdd(&offsets[coo_row_ind[gid]], 1);
+
+    dst_col[dst] = src_col[gid];
+
+    if(dst_perm != nullptr)
+    {
+        dst_perm[dst] = src_perm[gid];
+    }
+}
+
+// Rebase a slice of the row offset array to the begin of the current chunk,
+// such that the chunked segmented sort receives offsets relative to its
+// working window
+__global__ void coosort_rebase_offsets_kernel(rocsparse_int        nseg,
+                                              const rocsparse_int* row_ptr,
+                                              rocsparse_int        base,
+                                              rocsparse_int*       seg_offsets)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid > nseg)
+    {
+        return;
+    }
+
+    seg_offsets[gid] = row_ptr[gid] - base;
+}
+
 #endif // COOSORT_DEVICE_H
@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2BSR_DEVICE_H
+#define CSR2BSR_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Maximum supported block dimension, bounded by the per-thread cursor arrays
+#define CSR2BSR_MAX_BLOCK_DIM 32
+
+// Count the number of non-zero blocks per row of blocks. One thread processes
+// one block row, merging the sorted column indices of its CSR rows with one
+// cursor per row. The counts are stored shifted by one, such that an
+// inclusive scan yields the BSR row pointer array.
+static __device__ void csr2bsr_nnzb_per_row_device(rocsparse_int        mb,
+                                                   rocsparse_int        m,
+                                                   rocsparse_int        block_dim,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_int*       bsr_row_ptr,
+                                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= mb)
+    {
+        return;
+    }
+
+    // Cursor into each CSR row of the current block row
+    rocsparse_int cursor[CSR2BSR_MAX_BLOCK_DIM];
+    rocsparse_int row_end[CSR2BSR_MAX_BLOCK_DIM];
+
+    for(rocsparse_int r = 0; r < block_dim; ++r)
+    {
+        rocsparse_int row = gid * block_dim + r;
+
+        cursor[r]  = (row < m) ? csr_row_ptr[row] - idx_base : 0;
+        row_end[r] = (row < m) ? csr_row_ptr[row + 1] - idx_base : 0;
+    }
+
+    rocsparse_int nnzb = 0;
+
+    while(true)
+    {
+        // Find the smallest untouched block column of the current block row
+        rocsparse_int min_block_col = -1;
+
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            if(cursor[r] < row_end[r])
+            {
+                rocsparse_int block_col = (csr_col_ind[cursor[r]] - idx_base) / block_dim;
+
+                if(min_block_col == -1 || block_col < min_block_col)
+                {
+                    min_block_col = block_col;
+                }
+            }
+        }
+
+        if(min_block_col == -1)
+        {
+            break;
+        }
+
+        ++nnzb;
+
+        // Advance all cursors that point into the current block column
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            while(cursor[r] < row_end[r]
+                  && (csr_col_ind[cursor[r]] - idx_base) / block_dim == min_block_col)
+            {
+                ++cursor[r];
+            }
+        }
+    }
+
+    bsr_row_ptr[gid + 1] = nnzb;
+
+    if(gid == 0)
+    {
+        bsr_row_ptr[0] = idx_base;
+    }
+}
+
+// Fill the BSR column indices and values. One thread processes one block row,
+// emitting the non-zero blocks in ascending block column order. The values
+// array is assumed to be zero initialized, only the non-zero entries of each
+// block are written.
+template <typename T>
+static __device__ void csr2bsr_fill_device(rocsparse_int        mb,
+                                           rocsparse_int        m,
+                                           rocsparse_int        block_dim,
+                                           const T*             csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           const rocsparse_int* bsr_row_ptr,
+                                           rocsparse_int*       bsr_col_ind,
+                                           T*                   bsr_val,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= mb)
+    {
+        return;
+    }
+
+    // Cursor into each CSR row of the current block row
+    rocsparse_int cursor[CSR2BSR_MAX_BLOCK_DIM];
+    rocsparse_int row_end[CSR2BSR_MAX_BLOCK_DIM];
+
+    for(rocsparse_int r = 0; r < block_dim; ++r)
+    {
+        rocsparse_int row = gid * block_dim + r;
+
+        cursor[r]  = (row < m) ? csr_row_ptr[row] - idx_base : 0;
+        row_end[r] = (row < m) ? csr_row_ptr[row + 1] - idx_base : 0;
+    }
+
+    rocsparse_int idx = bsr_row_ptr[gid] - idx_base;
+
+    while(true)
+    {
+        // Find the smallest untouched block column of the current block row
+        rocsparse_int min_block_col = -1;
+
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            if(cursor[r] < row_end[r])
+            {
+                rocsparse_int block_col = (csr_col_ind[cursor[r]] - idx_base) / block_dim;
+
+                if(min_block_col == -1 || block_col < min_block_col)
+                {
+                    min_block_col = block_col;
+                }
+            }
+        }
+
+        if(min_block_col == -1)
+        {
+            break;
+        }
+
+        bsr_col_ind[idx] = min_block_col + idx_base;
+
+        // Gather all entries of the current block
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            while(cursor[r] < row_end[r]
+                  && (csr_col_ind[cursor[r]] - idx_base) / block_dim == min_block_col)
+            {
+                rocsparse_int col = csr_col_ind[cursor[r]] - idx_base - min_block_col * block_dim;
+
+                bsr_val[idx * block_dim * block_dim + r * block_dim + col] = csr_val[cursor[r]];
+
+                ++cursor[r];
+            }
+        }
+
+        ++idx;
+    }
+}
+
+#endif // CSR2BSR_DEVICE_H
@@ -48,4 +48,188 @@ __global__ void csr2csc_permute_kernel(rocsparse_int        nnz,
     out2[gid] = in2[idx];
 }
 
+// Symbolic variant of csr2csc_permute_kernel that does not touch the values
+__global__ void csr2csc_permute_symbolic_kernel(rocsparse_int        nnz,
+                                                const rocsparse_int* in,
+                                                const rocsparse_int* map,
+                                                rocsparse_int*       out)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    out[gid] = in[map[gid]];
+}
+
+// Gather the CSR values into their CSC position through the nnz permutation
+// cached by csr2csc_analysis
+template <typename T>
+__global__ void csr2csc_gather_kernel(rocsparse_int        nnz,
+                                      const T*             csr_val,
+                                      const rocsparse_int* map,
+                                      T*                   csc_val)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csc_val[gid] = csr_val[map[gid]];
+}
+
+// Count the entries per column into the (zero initialized) column pointer array,
+// shifted by one such that the subsequent inclusive scan yields the pointers
+__global__ void csr2csc_histogram_kernel(rocsparse_int        nnz,
+                                         const rocsparse_int* csr_col_ind,
+                                         rocsparse_int*       csc_col_ptr,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    atomicAdd(&csc_col_ptr[csr_col_ind[gid] - idx_base + 1], 1);
+}
+
+// Scatter each entry to its column using the running column offsets. The
+// insert position within a column is claimed atomically, such that no stable
+// sort of the column indices is required
+template <typename T>
+__global__ void csr2csc_scatter_kernel(rocsparse_int        nnz,
+                                       const rocsparse_int* row_ind,
+                                       const rocsparse_int* csr_col_ind,
+                                       const T*             csr_val,
+                                       rocsparse_int*       offsets,
+                                       rocsparse_int*       csc_row_ind,
+                                       T*                   csc_val,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int pos = atomicAdd(&offsets[csr_col_ind[gid] - idx_base], 1);
+
+    csc_row_ind[pos] = row_ind[gid];
+    csc_val[pos]     = csr_val[gid];
+}
+
+// Symbolic variant of csr2csc_scatter_kernel that does not touch the values
+__global__ void csr2csc_scatter_symbolic_kernel(rocsparse_int        nnz,
+                                                const rocsparse_int* row_ind,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_int*       offsets,
+                                                rocsparse_int*       csc_row_ind,
+                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int pos = atomicAdd(&offsets[csr_col_ind[gid] - idx_base], 1);
+
+    csc_row_ind[pos] = row_ind[gid];
+}
+
+// Scatter all entries falling into the column range [col_begin, col_end) to
+// their column, one thread per CSR row. The row index is derived from the
+// row pointer on the fly, such that no expanded nnz-sized row index array is
+// required. The running offsets are indexed relative to col_begin
+template <typename T>
+__global__ void csr2csc_chunk_scatter_kernel(rocsparse_int        m,
+                                             rocsparse_int        col_begin,
+                                             rocsparse_int        col_end,
+                                             const T*             csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_int*       offsets,
+                                             rocsparse_int*       csc_row_ind,
+                                             T*                   csc_val,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        rocsparse_int col = csr_col_ind[aj] - idx_base;
+
+        if(col >= col_begin && col < col_end)
+        {
+            rocsparse_int pos = atomicAdd(&offsets[col - col_begin], 1);
+
+            csc_row_ind[pos] = ai + idx_base;
+            csc_val[pos]     = csr_val[aj];
+        }
+    }
+}
+
+// Symbolic variant of csr2csc_chunk_scatter_kernel that does not touch the
+// values
+__global__ void csr2csc_chunk_scatter_symbolic_kernel(rocsparse_int        m,
+                                                      rocsparse_int        col_begin,
+                                                      rocsparse_int        col_end,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_int*       offsets,
+                                                      rocsparse_int*       csc_row_ind,
+                                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        rocsparse_int col = csr_col_ind[aj] - idx_base;
+
+        if(col >= col_begin && col < col_end)
+        {
+            rocsparse_int pos = atomicAdd(&offsets[col - col_begin], 1);
+
+            csc_row_ind[pos] = ai + idx_base;
+        }
+    }
+}
+
+// Shift the column pointer array by the index base
+__global__ void csr2csc_shift_kernel(rocsparse_int n, rocsparse_int* csc_col_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= n + 1)
+    {
+        return;
+    }
+
+    csc_col_ptr[gid] += 1;
+}
+
 #endif // CSR2CSC_DEVICE_H
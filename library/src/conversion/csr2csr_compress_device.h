@@ -0,0 +1,112 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2CSR_COMPRESS_DEVICE_H
+#define CSR2CSR_COMPRESS_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Count the entries per row whose magnitude exceeds the tolerance, shifted
+// by one such that the subsequent inclusive scan yields the compressed row
+// pointers
+template <typename T>
+__global__ void csr2csr_compress_nnz_kernel(rocsparse_int        m,
+                                            const T*             csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            T                    tol,
+                                            rocsparse_int*       csr_row_ptr_C,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        rocsparse_int row_begin = csr_row_ptr[gid] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[gid + 1] - idx_base;
+
+        rocsparse_int row_nnz = 0;
+
+        for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+        {
+            if(fabs(csr_val[aj]) > tol)
+            {
+                ++row_nnz;
+            }
+        }
+
+        csr_row_ptr_C[gid + 1] = row_nnz;
+    }
+
+    if(gid == 0)
+    {
+        csr_row_ptr_C[0] = idx_base;
+    }
+}
+
+// Extract the total number of surviving entries from the compressed row
+// pointer array, corrected by the index base
+__global__ void csr2csr_compress_nnz_extract_kernel(rocsparse_int        m,
+                                                    const rocsparse_int* csr_row_ptr_C,
+                                                    rocsparse_int*       nnz_C,
+                                                    rocsparse_index_base idx_base)
+{
+    *nnz_C = csr_row_ptr_C[m] - idx_base;
+}
+
+// Gather the surviving entries of each row into the compressed CSR matrix
+template <typename T>
+__global__ void csr2csr_compress_fill_kernel(rocsparse_int        m,
+                                             const T*             csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             T                    tol,
+                                             T*                   csr_val_C,
+                                             const rocsparse_int* csr_row_ptr_C,
+                                             rocsparse_int*       csr_col_ind_C,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[gid] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[gid + 1] - idx_base;
+
+    rocsparse_int pos = csr_row_ptr_C[gid] - idx_base;
+
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        if(fabs(csr_val[aj]) > tol)
+        {
+            csr_val_C[pos]     = csr_val[aj];
+            csr_col_ind_C[pos] = csr_col_ind[aj];
+            ++pos;
+        }
+    }
+}
+
+#endif // CSR2CSR_COMPRESS_DEVICE_H
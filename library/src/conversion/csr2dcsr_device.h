@@ -0,0 +1,79 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2DCSR_DEVICE_H
+#define CSR2DCSR_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Flag each non-empty row with one, such that an inclusive scan over the
+// flags yields the compacted position of every non-empty row
+static __device__ void csr2dcsr_flag_device(rocsparse_int        m,
+                                            const rocsparse_int* csr_row_ptr,
+                                            rocsparse_int*       flags)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    flags[gid] = (csr_row_ptr[gid + 1] > csr_row_ptr[gid]) ? 1 : 0;
+}
+
+// Scatter the row index and row offset of each non-empty row into the
+// compressed row arrays, using the scanned flags as write positions
+static __device__ void csr2dcsr_fill_device(rocsparse_int        m,
+                                            rocsparse_int        mc,
+                                            rocsparse_int        nnz,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* flags,
+                                            rocsparse_int*       dcsr_row_ind,
+                                            rocsparse_int*       dcsr_row_ptr,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    // Close the compressed row pointer array
+    if(gid == 0)
+    {
+        dcsr_row_ptr[mc] = nnz + idx_base;
+    }
+
+    if(csr_row_ptr[gid + 1] > csr_row_ptr[gid])
+    {
+        rocsparse_int pos = flags[gid] - 1;
+
+        dcsr_row_ind[pos] = gid + idx_base;
+        dcsr_row_ptr[pos] = csr_row_ptr[gid];
+    }
+}
+
+#endif // CSR2DCSR_DEVICE_H
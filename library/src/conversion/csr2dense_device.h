@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2DENSE_DEVICE_H
+#define CSR2DENSE_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// CSR to column-major dense conversion kernel, one thread per row. The row
+// is cleared first such that padding between explicit zeros and structural
+// zeros is not required, the column-major stores are coalesced over the rows
+template <typename T>
+__global__ void csr2dense_kernel(rocsparse_int        m,
+                                 rocsparse_int        n,
+                                 const T*             csr_val,
+                                 const rocsparse_int* csr_row_ptr,
+                                 const rocsparse_int* csr_col_ind,
+                                 T*                   A,
+                                 rocsparse_int        lda,
+                                 rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    // Clear the dense row
+    for(rocsparse_int j = 0; j < n; ++j)
+    {
+        A[j * lda + ai] = static_cast<T>(0);
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+
+    // Scatter the row entries
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        A[(csr_col_ind[aj] - idx_base) * lda + ai] = csr_val[aj];
+    }
+}
+
+#endif // CSR2DENSE_DEVICE_H
@@ -82,6 +82,14 @@ __global__ void ell_width_kernel_part2(rocsparse_int m, rocsparse_int* workspace
     }
 }
 
+// Clamp the reduced ELL width in the workspace against the user supplied
+// maximum, such that a single pathological row cannot blow up the ELL
+// memory footprint
+__global__ void ell_width_clamp_kernel(rocsparse_int max_width, rocsparse_int* workspace)
+{
+    workspace[0] = min(workspace[0], max_width);
+}
+
 // CSR to ELL format conversion kernel
 template <typename T>
 __global__ void csr2ell_kernel(rocsparse_int        m,
@@ -90,6 +98,7 @@ __global__ void csr2ell_kernel(rocsparse_int        m,
                                const rocsparse_int* csr_col_ind,
                                rocsparse_index_base csr_idx_base,
                                rocsparse_int        ell_width,
+                               rocsparse_int        ell_pitch,
                                rocsparse_int*       ell_col_ind,
                                T*                   ell_val,
                                rocsparse_index_base ell_idx_base)
@@ -114,7 +123,60 @@ __global__ void csr2ell_kernel(rocsparse_int        m,
             break;
         }
 
-        rocsparse_int idx = ELL_IND(ai, p++, m, ell_width);
+        rocsparse_int idx = ELL_IND(ai, p++, ell_pitch, ell_width);
+        ell_col_ind[idx]  = csr_col_ind[aj] - csr_idx_base + ell_idx_base;
+        ell_val[idx]      = csr_val[aj];
+    }
+
+    // Pad remaining ELL structure
+    for(rocsparse_int aj = row_end - row_begin; aj < ell_width; ++aj)
+    {
+        rocsparse_int idx = ELL_IND(ai, aj, ell_pitch, ell_width);
+        ell_col_ind[idx]  = -1;
+        ell_val[idx]      = static_cast<T>(0);
+    }
+}
+
+// Fused CSR to ELL format conversion kernel. In contrast to csr2ell_kernel,
+// the ELL width is read from device memory, such that no host round-trip is
+// required between the width reduction and the conversion. The column-major
+// ELL layout only depends on the slice pitch, hence the width can remain
+// device resident
+template <typename T>
+__global__ void csr2ell_fused_kernel(rocsparse_int        m,
+                                     const T*             csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_index_base csr_idx_base,
+                                     const rocsparse_int* workspace,
+                                     rocsparse_int        ell_pitch,
+                                     rocsparse_int*       ell_col_ind,
+                                     T*                   ell_val,
+                                     rocsparse_index_base ell_idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int ell_width = workspace[0];
+
+    rocsparse_int p = 0;
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - csr_idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - csr_idx_base;
+
+    // Fill ELL matrix, dropping entries beyond the (possibly capped) width
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        if(p >= ell_width)
+        {
+            break;
+        }
+
+        rocsparse_int idx = ELL_IND(ai, p++, ell_pitch, ell_width);
         ell_col_ind[idx]  = csr_col_ind[aj] - csr_idx_base + ell_idx_base;
         ell_val[idx]      = csr_val[aj];
     }
@@ -122,7 +184,7 @@ __global__ void csr2ell_kernel(rocsparse_int        m,
     // Pad remaining ELL structure
     for(rocsparse_int aj = row_end - row_begin; aj < ell_width; ++aj)
     {
-        rocsparse_int idx = ELL_IND(ai, aj, m, ell_width);
+        rocsparse_int idx = ELL_IND(ai, aj, ell_pitch, ell_width);
         ell_col_ind[idx]  = -1;
         ell_val[idx]      = static_cast<T>(0);
     }
@@ -60,6 +60,47 @@ __global__ void hyb_coo_nnz(rocsparse_int        m,
     }
 }
 
+// Compute the ELL-R row length array, i.e. the number of entries each row
+// stores in the ELL part. The remaining entries up to ell_width are padding
+// and need not be visited by the SpMV kernels
+__global__ void hyb_ell_row_nnz(rocsparse_int        m,
+                                rocsparse_int        ell_width,
+                                const rocsparse_int* csr_row_ptr,
+                                rocsparse_int*       ell_row_nnz)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_nnz = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+
+    ell_row_nnz[gid] = (row_nnz < ell_width) ? row_nnz : ell_width;
+}
+
+// Build a histogram of the per row non-zero counts. Rows longer than
+// max_width are clamped into the last bin. Since ELL stores at most
+// max_width entries per row, the clamped histogram still yields the exact
+// ELL fill for every width candidate
+__global__ void hyb_row_histogram(rocsparse_int        m,
+                                  rocsparse_int        max_width,
+                                  const rocsparse_int* csr_row_ptr,
+                                  rocsparse_int*       hist)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_nnz = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+
+    atomicAdd(&hist[min(row_nnz, max_width)], 1);
+}
+
 // CSR to HYB format conversion kernel
 template <typename T>
 __global__ void csr2hyb_kernel(rocsparse_int        m,
@@ -117,4 +158,47 @@ __global__ void csr2hyb_kernel(rocsparse_int        m,
     }
 }
 
+// Values only update kernel. The ELL / COO partition and the index arrays
+// are kept, only the numeric values are rewritten from csr_val, using the
+// per row COO write offsets cached by the conversion. The ELL padding is
+// not touched, since the sparsity pattern is unchanged
+template <typename T>
+__global__ void csr2hyb_update_kernel(rocsparse_int        m,
+                                      const T*             csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      rocsparse_int        ell_width,
+                                      T*                   ell_val,
+                                      T*                   coo_val,
+                                      const rocsparse_int* coo_row_offset,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int p = 0;
+
+    rocsparse_int row_begin = csr_row_ptr[ai] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[ai + 1] - idx_base;
+    rocsparse_int coo_idx   = coo_val ? coo_row_offset[ai] - idx_base : 0;
+
+    // Rewrite HYB values
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        if(p < ell_width)
+        {
+            // Rewrite ELL part
+            ell_val[ELL_IND(ai, p++, m, ell_width)] = csr_val[aj];
+        }
+        else
+        {
+            // Rewrite COO part
+            coo_val[coo_idx++] = csr_val[aj];
+        }
+    }
+}
+
 #endif // CSR2HYB_DEVICE_H
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2SELL_DEVICE_H
+#define CSR2SELL_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Compute the length of each row and initialize the row permutation with the
+// identity, such that the subsequent sigma-window sort yields the mapping from
+// sorted position to original row
+static __device__ void csr2sell_row_length_device(rocsparse_int m,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                                  rocsparse_int* __restrict__ row_length,
+                                                  rocsparse_int* __restrict__ perm)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    row_length[row] = csr_row_ptr[row + 1] - csr_row_ptr[row];
+    perm[row]       = row;
+}
+
+// Segment offsets for the sigma-window sort, the last window is clamped to m
+static __device__ void csr2sell_window_offsets_device(rocsparse_int num_windows,
+                                                      rocsparse_int m,
+                                                      rocsparse_int sigma,
+                                                      rocsparse_int* __restrict__ offsets)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid > num_windows)
+    {
+        return;
+    }
+
+    offsets[gid] = min(gid * sigma, m);
+}
+
+// Compute the width of each slice as the maximum length of its rows. Stored
+// as number of elements per slice, such that an inclusive scan directly
+// yields the slice pointer array
+static __device__ void csr2sell_slice_width_device(rocsparse_int num_slices,
+                                                   rocsparse_int m,
+                                                   rocsparse_int slice_height,
+                                                   const rocsparse_int* __restrict__ row_length,
+                                                   rocsparse_int* __restrict__ slice_ptr)
+{
+    rocsparse_int slice = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(slice >= num_slices)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = slice * slice_height;
+    rocsparse_int row_end   = min(row_begin + slice_height, m);
+
+    rocsparse_int width = 0;
+    for(rocsparse_int r = row_begin; r < row_end; ++r)
+    {
+        width = max(width, row_length[r]);
+    }
+
+    slice_ptr[slice + 1] = width * slice_height;
+
+    if(slice == 0)
+    {
+        slice_ptr[0] = 0;
+    }
+}
+
+// Fill the SELL structure. One thread per row of the padded matrix, writing
+// the row into its column-major slice. Padded entries are marked with column
+// index -1
+template <typename T>
+static __device__ void csr2sell_fill_device(rocsparse_int num_slices,
+                                            rocsparse_int m,
+                                            rocsparse_int slice_height,
+                                            const T* __restrict__ csr_val,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const rocsparse_int* __restrict__ slice_ptr,
+                                            const rocsparse_int* __restrict__ perm,
+                                            rocsparse_int* __restrict__ sell_col_ind,
+                                            T* __restrict__ sell_val,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= num_slices * slice_height)
+    {
+        return;
+    }
+
+    rocsparse_int slice = gid / slice_height;
+    rocsparse_int lane  = gid % slice_height;
+
+    rocsparse_int width = (slice_ptr[slice + 1] - slice_ptr[slice]) / slice_height;
+
+    // Rows beyond m pad the last slice and consist of fill-in only
+    rocsparse_int row_begin = 0;
+    rocsparse_int row_end   = 0;
+
+    if(gid < m)
+    {
+        rocsparse_int row = perm[gid];
+
+        row_begin = csr_row_ptr[row] - idx_base;
+        row_end   = csr_row_ptr[row + 1] - idx_base;
+    }
+
+    for(rocsparse_int p = 0; p < width; ++p)
+    {
+        rocsparse_int idx = slice_ptr[slice] + p * slice_height + lane;
+        rocsparse_int j   = row_begin + p;
+
+        if(j < row_end)
+        {
+            sell_col_ind[idx] = csr_col_ind[j];
+            sell_val[idx]     = csr_val[j];
+        }
+        else
+        {
+            sell_col_ind[idx] = -1;
+            sell_val[idx]     = static_cast<T>(0);
+        }
+    }
+}
+
+#endif // CSR2SELL_DEVICE_H
@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR_BUILDER_DEVICE_H
+#define CSR_BUILDER_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Expands an appended CSR row batch into the zero based COO tail of the
+// builder storage, one wavefront per batch row. The batch rows are placed
+// below the accumulated matrix by row_offset, the batch entries behind the
+// accumulated entries by nnz_offset
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csr_builder_append_kernel(rocsparse_int nrows,
+                                          rocsparse_int row_offset,
+                                          rocsparse_int nnz_offset,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const T* __restrict__ csr_val,
+                                          rocsparse_index_base idx_base,
+                                          rocsparse_int* __restrict__ coo_row_ind,
+                                          rocsparse_int* __restrict__ coo_col_ind,
+                                          T* __restrict__ coo_val)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    for(rocsparse_int row = gid / WF_SIZE; row < nrows; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int aj = row_begin + lid; aj < row_end; aj += WF_SIZE)
+        {
+            coo_row_ind[nnz_offset + aj] = row_offset + row;
+            coo_col_ind[nnz_offset + aj] = csr_col_ind[aj] - idx_base;
+            coo_val[nnz_offset + aj]     = csr_val[aj];
+        }
+    }
+}
+
+// Compacts the zero based COO column indices and values of the builder into
+// the CSR output arrays, restoring the requested index base
+template <typename T>
+__global__ void csr_builder_finalize_kernel(rocsparse_int nnz,
+                                            const rocsparse_int* __restrict__ coo_col_ind,
+                                            const T* __restrict__ coo_val,
+                                            rocsparse_index_base idx_base,
+                                            rocsparse_int* __restrict__ csr_col_ind,
+                                            T* __restrict__ csr_val)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csr_col_ind[gid] = coo_col_ind[gid] + idx_base;
+    csr_val[gid]     = coo_val[gid];
+}
+
+// Shifts the zero based CSR row pointers to index base one
+__global__ void csr_builder_shift_base_kernel(rocsparse_int size,
+                                              rocsparse_int* __restrict__ csr_row_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    ++csr_row_ptr[gid];
+}
+
+#endif // CSR_BUILDER_DEVICE_H
@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR_STACK_DEVICE_H
+#define CSR_STACK_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Binary search for the block that contains the given position, returning
+// the largest block index whose offset is less than or equal to pos
+static __device__ __forceinline__ rocsparse_int
+csr_stack_find_block(rocsparse_int pos, rocsparse_int nbatch, const rocsparse_int* offset)
+{
+    rocsparse_int l = 0;
+    rocsparse_int r = nbatch;
+
+    while(r > l + 1)
+    {
+        rocsparse_int mid = (l + r) >> 1;
+
+        if(offset[mid] <= pos)
+        {
+            l = mid;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    return l;
+}
+
+// Build the row pointer of the stacked block-diagonal matrix. Each thread
+// processes one row, looks up the block it belongs to and shifts the row
+// pointer entry of the block by the number of non-zeros of all preceding
+// blocks
+__global__ void csr_stack_row_ptr_kernel(rocsparse_int total_m,
+                                         rocsparse_int total_nnz,
+                                         rocsparse_int nbatch,
+                                         const rocsparse_int* const* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ row_offset,
+                                         const rocsparse_int* __restrict__ nnz_offset,
+                                         rocsparse_int* __restrict__ stacked_row_ptr,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    // First thread writes the last entry of the stacked row pointer
+    if(gid == 0)
+    {
+        stacked_row_ptr[total_m] = total_nnz + idx_base;
+    }
+
+    // Do not run out of bounds
+    if(gid >= total_m)
+    {
+        return;
+    }
+
+    // Block the current row belongs to
+    rocsparse_int batch = csr_stack_find_block(gid, nbatch, row_offset);
+
+    // Row within the block
+    rocsparse_int local_row = gid - row_offset[batch];
+
+    // The index base of the block entry carries over to the stacked matrix
+    stacked_row_ptr[gid] = csr_row_ptr[batch][local_row] + nnz_offset[batch];
+}
+
+// Copy the column indices and values of all blocks into the stacked
+// block-diagonal matrix. Each thread processes one non-zero entry, looks up
+// the block it belongs to and shifts the column index into the column range
+// of the block
+template <typename T>
+__global__ void csr_stack_entry_kernel(rocsparse_int total_nnz,
+                                       rocsparse_int nbatch,
+                                       const T* const* __restrict__ csr_val,
+                                       const rocsparse_int* const* __restrict__ csr_col_ind,
+                                       const rocsparse_int* __restrict__ col_offset,
+                                       const rocsparse_int* __restrict__ nnz_offset,
+                                       T* __restrict__ stacked_val,
+                                       rocsparse_int* __restrict__ stacked_col_ind)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= total_nnz)
+    {
+        return;
+    }
+
+    // Block the current entry belongs to
+    rocsparse_int batch = csr_stack_find_block(gid, nbatch, nnz_offset);
+
+    // Entry within the block
+    rocsparse_int local_idx = gid - nnz_offset[batch];
+
+    // The index base of the block entry carries over to the stacked matrix
+    stacked_col_ind[gid] = csr_col_ind[batch][local_idx] + col_offset[batch];
+    stacked_val[gid]     = csr_val[batch][local_idx];
+}
+
+#endif // CSR_STACK_DEVICE_H
@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR_UPDATE_DEVICE_H
+#define CSR_UPDATE_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Empty bucket marker of the pattern hash table
+#define CSR_UPDATE_EMPTY 0xFFFFFFFFFFFFFFFFULL
+
+// Packs a zero based (row, col) pair into the hash table key. The packing
+// is unique as long as m * n does not overflow 64 bits
+static inline __device__ unsigned long long
+    csr_update_key(rocsparse_int row, rocsparse_int col, rocsparse_int n)
+{
+    return static_cast<unsigned long long>(row) * n + col;
+}
+
+// Builds the open addressed hash table over the sparsity pattern, one
+// wavefront per row. Each entry inserts its packed (row, col) key with its
+// position in csr_val, collisions are resolved by linear probing. The
+// pattern holds no duplicate keys, such that every insertion claims an
+// empty bucket
+template <rocsparse_int WF_SIZE>
+__global__ void csr_update_build_kernel(rocsparse_int m,
+                                        rocsparse_int n,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        rocsparse_index_base idx_base,
+                                        rocsparse_int        table_size,
+                                        unsigned long long* __restrict__ table,
+                                        rocsparse_int* __restrict__ data)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            unsigned long long key = csr_update_key(row, csr_col_ind[j] - idx_base, n);
+
+            // Compute hash
+            rocsparse_int hash = (key * 103) & (table_size - 1);
+
+            // Hash operation
+            while(atomicCAS(&table[hash], CSR_UPDATE_EMPTY, key) != CSR_UPDATE_EMPTY)
+            {
+                // Collision, compute new hash
+                hash = (hash + 1) & (table_size - 1);
+            }
+
+            data[hash] = j;
+        }
+    }
+}
+
+// Scatters a batch of (row, col, val) triples into csr_val through the
+// pattern hash table, one thread per triple. Triples addressing an entry
+// outside the sparsity pattern are ignored
+template <typename T>
+__global__ void csr_update_scatter_kernel(rocsparse_int nupd,
+                                          const rocsparse_int* __restrict__ upd_row_ind,
+                                          const rocsparse_int* __restrict__ upd_col_ind,
+                                          const T* __restrict__ upd_val,
+                                          rocsparse_int        n,
+                                          rocsparse_index_base idx_base,
+                                          rocsparse_int        table_size,
+                                          const unsigned long long* __restrict__ table,
+                                          const rocsparse_int* __restrict__ data,
+                                          T* __restrict__ csr_val)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nupd)
+    {
+        return;
+    }
+
+    unsigned long long key
+        = csr_update_key(upd_row_ind[gid] - idx_base, upd_col_ind[gid] - idx_base, n);
+
+    // Compute hash
+    rocsparse_int hash = (key * 103) & (table_size - 1);
+
+    // Hash operation
+    while(true)
+    {
+        if(table[hash] == CSR_UPDATE_EMPTY)
+        {
+            // Entry is not part of the sparsity pattern
+            break;
+        }
+        else if(table[hash] == key)
+        {
+            csr_val[data[hash]] = upd_val[gid];
+            break;
+        }
+        else
+        {
+            // Collision, compute new hash
+            hash = (hash + 1) & (table_size - 1);
+        }
+    }
+}
+
+#endif // CSR_UPDATE_DEVICE_H
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRCOLOR_DEVICE_H
+#define CSRCOLOR_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Hash based random weight of a row, used to break ties between neighboring
+// uncolored rows
+static __device__ unsigned int csrcolor_hash(rocsparse_int x)
+{
+    unsigned int h = static_cast<unsigned int>(x);
+
+    h = ((h >> 16) ^ h) * 0x45d9f3b;
+    h = ((h >> 16) ^ h) * 0x45d9f3b;
+    h = (h >> 16) ^ h;
+
+    return h;
+}
+
+// One iteration of Jones-Plassmann-Luby graph coloring. Each uncolored row
+// compares its random weight against all uncolored neighbors. Rows that hold
+// the maximum weight among their uncolored neighborhood are assigned the
+// current color, rows that hold the minimum weight are assigned the
+// subsequent color, such that two independent sets are extracted per
+// iteration. The matrix is interpreted as adjacency structure and is assumed
+// to have a symmetric pattern.
+template <unsigned int BLOCKSIZE>
+__global__ void csrcolor_jpl_kernel(rocsparse_int m,
+                                    rocsparse_int color,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    rocsparse_int* __restrict__ colors,
+                                    rocsparse_int* __restrict__ uncolored,
+                                    rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Skip rows that have already been colored
+    if(colors[row] != -1)
+    {
+        return;
+    }
+
+    // Random weight of the current row
+    unsigned int row_weight = csrcolor_hash(row);
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    bool is_max = true;
+    bool is_min = true;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Skip the diagonal and all neighbors that are already colored
+        if(col == row || colors[col] != -1)
+        {
+            continue;
+        }
+
+        // Random weight of the neighbor, ties are broken by the row index
+        unsigned int col_weight = csrcolor_hash(col);
+
+        if(col_weight > row_weight || (col_weight == row_weight && col > row))
+        {
+            is_max = false;
+        }
+
+        if(col_weight < row_weight || (col_weight == row_weight && col < row))
+        {
+            is_min = false;
+        }
+    }
+
+    // Local maxima and minima form two independent sets
+    if(is_max)
+    {
+        colors[row] = color;
+    }
+    else if(is_min)
+    {
+        colors[row] = color + 1;
+    }
+    else
+    {
+        return;
+    }
+
+    // Count the rows that have been colored in this iteration
+    atomicSub(uncolored, 1);
+}
+
+// Compute the total number of colors, which is the maximum color plus one
+template <rocsparse_int NB>
+__global__ void csrcolor_ncolors_kernel_part1(rocsparse_int m,
+                                              const rocsparse_int* __restrict__ colors,
+                                              rocsparse_int* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    __shared__ rocsparse_int sdata[NB];
+    sdata[tid] = -1;
+
+    for(rocsparse_int idx = gid; idx < m; idx += hipGridDim_x * hipBlockDim_x)
+    {
+        sdata[tid] = max(sdata[tid], colors[idx]);
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_max<rocsparse_int, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+template <rocsparse_int NB>
+__global__ void csrcolor_ncolors_kernel_part2(rocsparse_int m,
+                                              rocsparse_int* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ rocsparse_int sdata[NB];
+    sdata[tid] = -1;
+
+    for(rocsparse_int i = tid; i < m; i += NB)
+    {
+        sdata[tid] = max(sdata[tid], workspace[i]);
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_max<rocsparse_int, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[0] = sdata[0] + 1;
+    }
+}
+
+#endif // CSRCOLOR_DEVICE_H
@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRSTAT_DEVICE_H
+#define CSRSTAT_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Initialize the reduction workspace, the sums are cleared by a memset
+__global__ void csrstat_init_kernel(rocsparse_int* row_min, rocsparse_int* row_max)
+{
+    *row_min = INT32_MAX;
+    *row_max = 0;
+}
+
+// Single pass row length statistics. Each block reduces minimum, maximum,
+// sum and sum of squares of its row lengths and combines them atomically
+// into the workspace. The log2 bucketed histogram is staged in shared
+// memory, bucket 0 counts empty rows, bucket b counts rows with a length
+// in [2^(b-1), 2^b)
+template <rocsparse_int NB>
+__global__ void csrstat_kernel(rocsparse_int        m,
+                               const rocsparse_int* csr_row_ptr,
+                               rocsparse_int*       row_min,
+                               rocsparse_int*       row_max,
+                               double*              sums,
+                               rocsparse_int*       hist)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    __shared__ rocsparse_int smin[NB];
+    __shared__ rocsparse_int smax[NB];
+    __shared__ double        ssum[NB];
+    __shared__ double        ssumsq[NB];
+    __shared__ rocsparse_int shist[32];
+
+    smin[tid]   = INT32_MAX;
+    smax[tid]   = 0;
+    ssum[tid]   = 0.0;
+    ssumsq[tid] = 0.0;
+
+    if(tid < 32)
+    {
+        shist[tid] = 0;
+    }
+
+    __syncthreads();
+
+    for(rocsparse_int idx = gid; idx < m; idx += hipGridDim_x * hipBlockDim_x)
+    {
+        rocsparse_int row_nnz = csr_row_ptr[idx + 1] - csr_row_ptr[idx];
+
+        smin[tid] = min(smin[tid], row_nnz);
+        smax[tid] = max(smax[tid], row_nnz);
+        ssum[tid] += row_nnz;
+        ssumsq[tid] += static_cast<double>(row_nnz) * row_nnz;
+
+        atomicAdd(&shist[(row_nnz == 0) ? 0 : 32 - __clz(row_nnz)], 1);
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_min<rocsparse_int, NB>(tid, smin);
+    rocsparse_blockreduce_max<rocsparse_int, NB>(tid, smax);
+    rocsparse_blockreduce_sum<double, NB>(tid, ssum);
+    rocsparse_blockreduce_sum<double, NB>(tid, ssumsq);
+
+    if(tid == 0)
+    {
+        atomicMin(row_min, smin[0]);
+        atomicMax(row_max, smax[0]);
+        atomicAdd(&sums[0], ssum[0]);
+        atomicAdd(&sums[1], ssumsq[0]);
+    }
+
+    if(tid < 32 && shist[tid] > 0)
+    {
+        atomicAdd(&hist[tid], shist[tid]);
+    }
+}
+
+// Compute mean and variance from the reduced sums
+__global__ void csrstat_finalize_kernel(rocsparse_int m, const double* sums, double* moments)
+{
+    double mean = sums[0] / m;
+
+    moments[0] = mean;
+    moments[1] = sums[1] / m - mean * mean;
+}
+
+#endif // CSRSTAT_DEVICE_H
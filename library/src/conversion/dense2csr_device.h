@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef DENSE2CSR_DEVICE_H
+#define DENSE2CSR_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Count the non-zero entries per row of the column-major dense matrix,
+// shifted by one such that the subsequent inclusive scan yields the row
+// pointers. The column-major accesses are coalesced over the rows
+template <typename T>
+__global__ void dense2csr_nnz_kernel(rocsparse_int        m,
+                                     rocsparse_int        n,
+                                     const T*             A,
+                                     rocsparse_int        lda,
+                                     rocsparse_int*       csr_row_ptr,
+                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(ai < m)
+    {
+        rocsparse_int row_nnz = 0;
+
+        for(rocsparse_int j = 0; j < n; ++j)
+        {
+            if(A[j * lda + ai] != static_cast<T>(0))
+            {
+                ++row_nnz;
+            }
+        }
+
+        csr_row_ptr[ai + 1] = row_nnz;
+    }
+
+    if(ai == 0)
+    {
+        csr_row_ptr[0] = idx_base;
+    }
+}
+
+// Compact the non-zero entries of each row into the CSR arrays
+template <typename T>
+__global__ void dense2csr_fill_kernel(rocsparse_int        m,
+                                      rocsparse_int        n,
+                                      const T*             A,
+                                      rocsparse_int        lda,
+                                      T*                   csr_val,
+                                      const rocsparse_int* csr_row_ptr,
+                                      rocsparse_int*       csr_col_ind,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int pos = csr_row_ptr[ai] - idx_base;
+
+    for(rocsparse_int j = 0; j < n; ++j)
+    {
+        T val = A[j * lda + ai];
+
+        if(val != static_cast<T>(0))
+        {
+            csr_val[pos]     = val;
+            csr_col_ind[pos] = j + idx_base;
+            ++pos;
+        }
+    }
+}
+
+// Extract the total number of non-zero entries from the row pointer array,
+// corrected by the index base
+__global__ void dense2csr_nnz_extract_kernel(rocsparse_int        m,
+                                             const rocsparse_int* csr_row_ptr,
+                                             rocsparse_int*       nnz,
+                                             rocsparse_index_base idx_base)
+{
+    *nnz = csr_row_ptr[m] - idx_base;
+}
+
+#endif // DENSE2CSR_DEVICE_H
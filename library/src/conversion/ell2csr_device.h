@@ -37,6 +37,7 @@ __global__ void ell2csr_index_base(rocsparse_int* __restrict__ nnz)
 __global__ void ell2csr_nnz_per_row(rocsparse_int m,
                                     rocsparse_int n,
                                     rocsparse_int ell_width,
+                                    rocsparse_int ell_pitch,
                                     const rocsparse_int* __restrict__ ell_col_ind,
                                     rocsparse_index_base ell_base,
                                     rocsparse_int* __restrict__ csr_row_ptr,
@@ -58,7 +59,7 @@ __global__ void ell2csr_nnz_per_row(rocsparse_int m,
 
     for(rocsparse_int p = 0; p < ell_width; ++p)
     {
-        rocsparse_int idx = ELL_IND(ai, p, m, ell_width);
+        rocsparse_int idx = ELL_IND(ai, p, ell_pitch, ell_width);
         rocsparse_int col = ell_col_ind[idx] - ell_base;
 
         if(col >= 0 && col < n)
@@ -78,6 +79,7 @@ template <typename T>
 __global__ void ell2csr_fill(rocsparse_int m,
                              rocsparse_int n,
                              rocsparse_int ell_width,
+                             rocsparse_int ell_pitch,
                              const rocsparse_int* __restrict__ ell_col_ind,
                              const T* __restrict__ ell_val,
                              rocsparse_index_base ell_base,
@@ -97,7 +99,7 @@ __global__ void ell2csr_fill(rocsparse_int m,
 
     for(rocsparse_int p = 0; p < ell_width; ++p)
     {
-        rocsparse_int ell_idx = ELL_IND(ai, p, m, ell_width);
+        rocsparse_int ell_idx = ELL_IND(ai, p, ell_pitch, ell_width);
         rocsparse_int ell_col = ell_col_ind[ell_idx] - ell_base;
 
         if(ell_col >= 0 && ell_col < n)
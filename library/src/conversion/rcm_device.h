@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef RCM_DEVICE_H
+#define RCM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Find the row of minimum degree among all rows of the given BFS level,
+// used to select the BFS root of each connected component (level -1, the
+// unvisited rows) and to refine the root towards the periphery (the last
+// level of a sweep). Degree and row index are packed into a single 64 bit
+// key, such that the minimum reduction selects the smallest degree and
+// breaks ties by the smaller row index.
+template <rocsparse_int NB>
+__global__ void rcm_min_degree_kernel_part1(rocsparse_int m,
+                                            rocsparse_int target_level,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ levels,
+                                            unsigned long long* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    __shared__ unsigned long long sdata[NB];
+    sdata[tid] = 0xffffffffffffffffULL;
+
+    for(rocsparse_int row = gid; row < m; row += hipGridDim_x * hipBlockDim_x)
+    {
+        if(levels[row] == target_level)
+        {
+            unsigned long long degree
+                = static_cast<unsigned long long>(csr_row_ptr[row + 1] - csr_row_ptr[row]);
+
+            sdata[tid] = min(sdata[tid], (degree << 32) | static_cast<unsigned long long>(row));
+        }
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_min<unsigned long long, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+template <rocsparse_int NB>
+__global__ void rcm_min_degree_kernel_part2(rocsparse_int m,
+                                            unsigned long long* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ unsigned long long sdata[NB];
+    sdata[tid] = 0xffffffffffffffffULL;
+
+    for(rocsparse_int idx = tid; idx < m; idx += NB)
+    {
+        sdata[tid] = min(sdata[tid], workspace[idx]);
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_min<unsigned long long, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[0] = sdata[0];
+    }
+}
+
+// One iteration of the level synchronous breadth first search. Each row of
+// the current level marks its unvisited neighbors with the subsequent
+// level. Concurrent writes to the same neighbor store the same value, the
+// race is therefore benign. The matrix is interpreted as adjacency
+// structure and is assumed to have a symmetric pattern.
+template <rocsparse_int NB>
+__global__ void rcm_bfs_kernel(rocsparse_int m,
+                               rocsparse_int level,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               rocsparse_int* __restrict__ levels,
+                               rocsparse_int* __restrict__ changed,
+                               rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Skip rows that are not part of the current BFS level
+    if(levels[row] != level)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    bool visited = false;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(levels[col] == -1)
+        {
+            levels[col] = level + 1;
+            visited     = true;
+        }
+    }
+
+    if(visited)
+    {
+        *changed = 1;
+    }
+}
+
+// Reset the levels of the current component back to unvisited, used before
+// the second BFS sweep from the refined peripheral root
+template <rocsparse_int NB>
+__global__ void rcm_reset_kernel(rocsparse_int m,
+                                 rocsparse_int base_level,
+                                 rocsparse_int* __restrict__ levels)
+{
+    rocsparse_int row = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(levels[row] >= base_level)
+    {
+        levels[row] = -1;
+    }
+}
+
+// Pack BFS level and degree of each row into a single 64 bit sort key, such
+// that one radix sort orders the rows by level and by degree within each
+// level, which is the Cuthill-McKee ordering
+template <rocsparse_int NB>
+__global__ void rcm_pack_keys_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ levels,
+                                     unsigned long long* __restrict__ keys)
+{
+    rocsparse_int row = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    unsigned long long level  = static_cast<unsigned long long>(levels[row]);
+    unsigned long long degree = static_cast<unsigned long long>(csr_row_ptr[row + 1]
+                                                                - csr_row_ptr[row]);
+
+    keys[row] = (level << 32) | degree;
+}
+
+// Reverse the Cuthill-McKee ordering, which reduces the fill-in profile of
+// a subsequent factorization without changing the bandwidth
+template <rocsparse_int NB>
+__global__ void rcm_reverse_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ cm_order,
+                                   rocsparse_int* __restrict__ perm)
+{
+    rocsparse_int idx = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(idx >= m)
+    {
+        return;
+    }
+
+    perm[m - 1 - idx] = cm_order[idx];
+}
+
+#endif // RCM_DEVICE_H
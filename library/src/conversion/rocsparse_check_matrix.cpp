@@ -0,0 +1,198 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "check_matrix_device.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+extern "C" rocsparse_status rocsparse_check_matrix_csr(rocsparse_handle       handle,
+                                                       rocsparse_int          m,
+                                                       rocsparse_int          n,
+                                                       rocsparse_int          nnz,
+                                                       const rocsparse_int*   csr_row_ptr,
+                                                       const rocsparse_int*   csr_col_ind,
+                                                       rocsparse_index_base   idx_base,
+                                                       rocsparse_data_status* data_status)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_check_matrix_csr",
+              m,
+              n,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              idx_base,
+              (const void*&)data_status);
+
+    log_bench(handle, "./rocsparse-bench -f check_matrix_csr ", "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(data_status == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(data_status, 0, sizeof(rocsparse_data_status), stream));
+        }
+        else
+        {
+            *data_status = rocsparse_data_status_ok;
+        }
+        return rocsparse_status_success;
+    }
+
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Device status word, defects found by the check kernels are combined
+    // into it with atomic or
+    int* d_status;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(int), (void**)&d_status));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_status, 0, sizeof(int), stream));
+
+#define CHECK_MATRIX_DIM 256
+    // Check the row offsets, one thread per row
+    dim3 row_ptr_blocks((m - 1) / CHECK_MATRIX_DIM + 1);
+    dim3 row_ptr_threads(CHECK_MATRIX_DIM);
+
+    hipLaunchKernelGGL((check_matrix_csr_row_ptr_kernel),
+                       row_ptr_blocks,
+                       row_ptr_threads,
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       idx_base,
+                       d_status);
+
+    // Check the column indices, one wavefront per row
+    if(nnz != 0)
+    {
+        if(handle->wavefront_size == 32)
+        {
+            dim3 col_ind_blocks((m - 1) / (CHECK_MATRIX_DIM / 32) + 1);
+            dim3 col_ind_threads(CHECK_MATRIX_DIM);
+
+            hipLaunchKernelGGL((check_matrix_csr_col_ind_kernel<32>),
+                               col_ind_blocks,
+                               col_ind_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               idx_base,
+                               d_status);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            dim3 col_ind_blocks((m - 1) / (CHECK_MATRIX_DIM / 64) + 1);
+            dim3 col_ind_threads(CHECK_MATRIX_DIM);
+
+            hipLaunchKernelGGL((check_matrix_csr_col_ind_kernel<64>),
+                               col_ind_blocks,
+                               col_ind_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               idx_base,
+                               d_status);
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_status));
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CHECK_MATRIX_DIM
+
+    // Copy the status word back, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(data_status, d_status, sizeof(int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        int h_status;
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(&h_status, d_status, sizeof(int), hipMemcpyDeviceToHost));
+
+        *data_status = static_cast<rocsparse_data_status>(h_status);
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_status));
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_coo2csr_assemble.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scoo2csr_assemble_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    rocsparse_int    n,
+                                                                    rocsparse_int    nnz,
+                                                                    size_t*          buffer_size)
+{
+    return rocsparse_coo2csr_assemble_buffer_size_template<float>(handle, m, n, nnz, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcoo2csr_assemble_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    rocsparse_int    n,
+                                                                    rocsparse_int    nnz,
+                                                                    size_t*          buffer_size)
+{
+    return rocsparse_coo2csr_assemble_buffer_size_template<double>(handle, m, n, nnz, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scoo2csr_assemble(rocsparse_handle     handle,
+                                                        rocsparse_int        m,
+                                                        rocsparse_int        n,
+                                                        rocsparse_int        nnz,
+                                                        const float*         coo_val,
+                                                        const rocsparse_int* coo_row_ind,
+                                                        const rocsparse_int* coo_col_ind,
+                                                        float*               csr_val,
+                                                        rocsparse_int*       csr_row_ptr,
+                                                        rocsparse_int*       csr_col_ind,
+                                                        rocsparse_int*       nnz_C,
+                                                        rocsparse_index_base idx_base,
+                                                        void*                temp_buffer)
+{
+    return rocsparse_coo2csr_assemble_template<float>(handle,
+                                                      m,
+                                                      n,
+                                                      nnz,
+                                                      coo_val,
+                                                      coo_row_ind,
+                                                      coo_col_ind,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      nnz_C,
+                                                      idx_base,
+                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcoo2csr_assemble(rocsparse_handle     handle,
+                                                        rocsparse_int        m,
+                                                        rocsparse_int        n,
+                                                        rocsparse_int        nnz,
+                                                        const double*        coo_val,
+                                                        const rocsparse_int* coo_row_ind,
+                                                        const rocsparse_int* coo_col_ind,
+                                                        double*              csr_val,
+                                                        rocsparse_int*       csr_row_ptr,
+                                                        rocsparse_int*       csr_col_ind,
+                                                        rocsparse_int*       nnz_C,
+                                                        rocsparse_index_base idx_base,
+                                                        void*                temp_buffer)
+{
+    return rocsparse_coo2csr_assemble_template<double>(handle,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       coo_val,
+                                                       coo_row_ind,
+                                                       coo_col_ind,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       nnz_C,
+                                                       idx_base,
+                                                       temp_buffer);
+}
@@ -0,0 +1,393 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_COO2CSR_ASSEMBLE_HPP
+#define ROCSPARSE_COO2CSR_ASSEMBLE_HPP
+
+#include "coo2csr_assemble_device.h"
+#include "coo2csr_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+template <typename T>
+rocsparse_status rocsparse_coo2csr_assemble_buffer_size_template(rocsparse_handle handle,
+                                                                 rocsparse_int    m,
+                                                                 rocsparse_int    n,
+                                                                 rocsparse_int    nnz,
+                                                                 size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcoo2csr_assemble_buffer_size"),
+              m,
+              n,
+              nnz,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Two key arrays for the sort, two value arrays for sort and
+    // reduction, the assembled entry count
+    *buffer_size = 0;
+    *buffer_size += ((sizeof(int64_t) * nnz - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(int64_t) * nnz - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(T) * nnz - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(T) * nnz - 1) / 256 + 1) * 256;
+    *buffer_size += 256;
+
+    // Merged keys cover [0, m * n)
+    unsigned int endbit
+        = 64 - __builtin_clzll(static_cast<uint64_t>(m) * static_cast<uint64_t>(n));
+
+    int64_t*       null64 = nullptr;
+    T*             nullT  = nullptr;
+    rocsparse_int* nullI  = nullptr;
+
+    // The sort and the reduction run one after the other and share the
+    // rocprim scratch space
+    size_t sort_size;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, sort_size, null64, null64, nullT, nullT, nnz, 0, endbit, stream));
+
+    size_t reduce_size;
+    RETURN_IF_HIP_ERROR(rocprim::reduce_by_key(nullptr,
+                                               reduce_size,
+                                               null64,
+                                               nullT,
+                                               nnz,
+                                               null64,
+                                               nullT,
+                                               nullI,
+                                               rocprim::plus<T>(),
+                                               rocprim::equal_to<int64_t>(),
+                                               stream));
+
+    *buffer_size += std::max(sort_size, reduce_size);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_coo2csr_assemble_template(rocsparse_handle     handle,
+                                                     rocsparse_int        m,
+                                                     rocsparse_int        n,
+                                                     rocsparse_int        nnz,
+                                                     const T*             coo_val,
+                                                     const rocsparse_int* coo_row_ind,
+                                                     const rocsparse_int* coo_col_ind,
+                                                     T*                   csr_val,
+                                                     rocsparse_int*       csr_row_ptr,
+                                                     rocsparse_int*       csr_col_ind,
+                                                     rocsparse_int*       nnz_C,
+                                                     rocsparse_index_base idx_base,
+                                                     void*                temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcoo2csr_assemble"),
+              m,
+              n,
+              nnz,
+              (const void*&)coo_val,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)nnz_C,
+              idx_base,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check nnz pointer argument before quick return
+    if(nnz_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        if(m > 0)
+        {
+            if(csr_row_ptr == nullptr)
+            {
+                return rocsparse_status_invalid_pointer;
+            }
+
+#define COO2CSR_DIM 512
+            dim3 coo2csr_blocks((m - 1) / COO2CSR_DIM + 1);
+            dim3 coo2csr_threads(COO2CSR_DIM);
+
+            hipLaunchKernelGGL((coo2csr_kernel),
+                               coo2csr_blocks,
+                               coo2csr_threads,
+                               0,
+                               stream,
+                               m,
+                               0,
+                               (const rocsparse_int*)nullptr,
+                               csr_row_ptr,
+                               idx_base);
+#undef COO2CSR_DIM
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(coo_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    int64_t* keys_in = reinterpret_cast<int64_t*>(ptr);
+    ptr += ((sizeof(int64_t) * nnz - 1) / 256 + 1) * 256;
+
+    int64_t* keys_out = reinterpret_cast<int64_t*>(ptr);
+    ptr += ((sizeof(int64_t) * nnz - 1) / 256 + 1) * 256;
+
+    T* vals_in = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * nnz - 1) / 256 + 1) * 256;
+
+    T* vals_out = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * nnz - 1) / 256 + 1) * 256;
+
+    rocsparse_int* d_nnz = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+#define COO2CSR_ASSEMBLE_DIM 512
+    dim3 assemble_blocks((nnz - 1) / COO2CSR_ASSEMBLE_DIM + 1);
+    dim3 assemble_threads(COO2CSR_ASSEMBLE_DIM);
+
+    // Fuse row and column indices into 64 bit sort keys
+    hipLaunchKernelGGL((coo2csr_assemble_keys_kernel),
+                       assemble_blocks,
+                       assemble_threads,
+                       0,
+                       stream,
+                       nnz,
+                       n,
+                       coo_row_ind,
+                       coo_col_ind,
+                       keys_in,
+                       idx_base);
+
+    // The sort moves the values, the user input must stay intact
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        vals_in, coo_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Merged keys cover [0, m * n)
+    unsigned int endbit
+        = 64 - __builtin_clzll(static_cast<uint64_t>(m) * static_cast<uint64_t>(n));
+
+    size_t rocprim_size;
+
+    // Sort the entries into row-major order, such that duplicates become
+    // adjacent
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys_in, keys_out, vals_in, vals_out, nnz, 0, endbit, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(rocprim_buffer,
+                                                  rocprim_size,
+                                                  keys_in,
+                                                  keys_out,
+                                                  vals_in,
+                                                  vals_out,
+                                                  nnz,
+                                                  0,
+                                                  endbit,
+                                                  stream));
+
+    // Sum the duplicates, re-using the sort input arrays for the
+    // assembled output
+    RETURN_IF_HIP_ERROR(rocprim::reduce_by_key(nullptr,
+                                               rocprim_size,
+                                               keys_out,
+                                               vals_out,
+                                               nnz,
+                                               keys_in,
+                                               vals_in,
+                                               d_nnz,
+                                               rocprim::plus<T>(),
+                                               rocprim::equal_to<int64_t>(),
+                                               stream));
+    RETURN_IF_HIP_ERROR(rocprim::reduce_by_key(rocprim_buffer,
+                                               rocprim_size,
+                                               keys_out,
+                                               vals_out,
+                                               nnz,
+                                               keys_in,
+                                               vals_in,
+                                               d_nnz,
+                                               rocprim::plus<T>(),
+                                               rocprim::equal_to<int64_t>(),
+                                               stream));
+
+    // The assembled entry count determines the remaining launches, the
+    // transfer makes this function blocking
+    rocsparse_int nnz_assembled;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&nnz_assembled, d_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    // Decompose the unique keys into the assembled row indices and the
+    // CSR column indices and values. The freed key array holds the row
+    // indices for the row pointer construction
+    rocsparse_int* row_ind = reinterpret_cast<rocsparse_int*>(keys_out);
+
+    dim3 extract_blocks((nnz_assembled - 1) / COO2CSR_ASSEMBLE_DIM + 1);
+
+    hipLaunchKernelGGL((coo2csr_assemble_extract_kernel<T>),
+                       extract_blocks,
+                       assemble_threads,
+                       0,
+                       stream,
+                       nnz_assembled,
+                       n,
+                       keys_in,
+                       vals_in,
+                       row_ind,
+                       csr_col_ind,
+                       csr_val,
+                       idx_base);
+
+    // Row pointers by binary search over the sorted, unique row indices
+    dim3 coo2csr_blocks((m - 1) / COO2CSR_ASSEMBLE_DIM + 1);
+
+    hipLaunchKernelGGL((coo2csr_kernel),
+                       coo2csr_blocks,
+                       assemble_threads,
+                       0,
+                       stream,
+                       m,
+                       nnz_assembled,
+                       row_ind,
+                       csr_row_ptr,
+                       idx_base);
+#undef COO2CSR_ASSEMBLE_DIM
+
+    // Report the assembled entry count, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C, d_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        *nnz_C = nnz_assembled;
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_COO2CSR_ASSEMBLE_HPP
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "rocsparse_coo2hyb.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scoo2hyb_buffer_size(rocsparse_handle     handle,
+                                                           rocsparse_int        m,
+                                                           rocsparse_int        n,
+                                                           rocsparse_int        nnz,
+                                                           const rocsparse_int* coo_row_ind,
+                                                           const rocsparse_int* coo_col_ind,
+                                                           size_t*              buffer_size)
+{
+    return rocsparse_coo2hyb_buffer_size_template<float>(
+        handle, m, n, nnz, coo_row_ind, coo_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcoo2hyb_buffer_size(rocsparse_handle     handle,
+                                                           rocsparse_int        m,
+                                                           rocsparse_int        n,
+                                                           rocsparse_int        nnz,
+                                                           const rocsparse_int* coo_row_ind,
+                                                           const rocsparse_int* coo_col_ind,
+                                                           size_t*              buffer_size)
+{
+    return rocsparse_coo2hyb_buffer_size_template<double>(
+        handle, m, n, nnz, coo_row_ind, coo_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scoo2hyb(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               float*                    coo_val,
+                                               rocsparse_int*            coo_row_ind,
+                                               rocsparse_int*            coo_col_ind,
+                                               rocsparse_hyb_mat         hyb,
+                                               rocsparse_int             user_ell_width,
+                                               rocsparse_hyb_partition   partition_type,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_coo2hyb_template<float>(handle,
+                                             m,
+                                             n,
+                                             nnz,
+                                             descr,
+                                             coo_val,
+                                             coo_row_ind,
+                                             coo_col_ind,
+                                             hyb,
+                                             user_ell_width,
+                                             partition_type,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcoo2hyb(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               double*                   coo_val,
+                                               rocsparse_int*            coo_row_ind,
+                                               rocsparse_int*            coo_col_ind,
+                                               rocsparse_hyb_mat         hyb,
+                                               rocsparse_int             user_ell_width,
+                                               rocsparse_hyb_partition   partition_type,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_coo2hyb_template<double>(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              descr,
+                                              coo_val,
+                                              coo_row_ind,
+                                              coo_col_ind,
+                                              hyb,
+                                              user_ell_width,
+                                              partition_type,
+                                              temp_buffer);
+}
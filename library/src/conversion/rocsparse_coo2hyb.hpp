@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_COO2HYB_HPP
+#define ROCSPARSE_COO2HYB_HPP
+
+#include "../level1/rocsparse_gthr.hpp"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_csr2hyb.hpp"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_coo2hyb_buffer_size_template(rocsparse_handle     handle,
+                                                        rocsparse_int        m,
+                                                        rocsparse_int        n,
+                                                        rocsparse_int        nnz,
+                                                        const rocsparse_int* coo_row_ind,
+                                                        const rocsparse_int* coo_col_ind,
+                                                        size_t*              buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcoo2hyb_buffer_size"),
+              m,
+              n,
+              nnz,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Sorting stage buffer
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coosort_buffer_size(
+        handle, m, n, nnz, coo_row_ind, coo_col_ind, buffer_size));
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // permutation array
+    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    // sorted values staging array
+    *buffer_size += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+    // row pointer array
+    *buffer_size += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+// Composed ingest pipeline that sorts a COO matrix by row, converts it to
+// CSR and assembles the HYB matrix without host logic between the stages.
+// All intermediate arrays live in the combined user buffer, such that
+// back-to-back matrix conversions do not interleave buffer size queries
+// with the actual work. The COO arrays are sorted in place
+template <typename T>
+rocsparse_status rocsparse_coo2hyb_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        coo_val,
+                                            rocsparse_int*            coo_row_ind,
+                                            rocsparse_int*            coo_col_ind,
+                                            rocsparse_hyb_mat         hyb,
+                                            rocsparse_int             user_ell_width,
+                                            rocsparse_hyb_partition   partition_type,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcoo2hyb"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)coo_val,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)hyb,
+              user_ell_width,
+              partition_type,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f coo2hyb -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    // Check partition type
+    if(partition_type != rocsparse_hyb_partition_max
+       && partition_type != rocsparse_hyb_partition_user
+       && partition_type != rocsparse_hyb_partition_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(coo_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // permutation array
+    rocsparse_int* perm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // sorted values staging array
+    T* tmp_vals = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+
+    // row pointer array
+    rocsparse_int* csr_row_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    // sorting stage buffer
+    void* coosort_buffer = reinterpret_cast<void*>(ptr);
+
+    // Sort the COO matrix by row, tracking the reordering in perm
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, perm));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coosort_by_row(
+        handle, m, n, nnz, coo_row_ind, coo_col_ind, perm, coosort_buffer));
+
+    // Apply the permutation to the values
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template<T>(
+        handle, nnz, coo_val, tmp_vals, perm, rocsparse_index_base_zero));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(coo_val, tmp_vals, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Convert the sorted COO matrix to CSR
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, coo_row_ind, nnz, m, csr_row_ptr, descr->base));
+
+    // Assemble the HYB matrix
+    return rocsparse_csr2hyb_template<T>(handle,
+                                         m,
+                                         n,
+                                         descr,
+                                         coo_val,
+                                         csr_row_ptr,
+                                         coo_col_ind,
+                                         hyb,
+                                         user_ell_width,
+                                         partition_type);
+}
+
+#endif // ROCSPARSE_COO2HYB_HPP
@@ -29,6 +29,7 @@
 
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
+#include <vector>
 
 extern "C" rocsparse_status rocsparse_coosort_buffer_size(rocsparse_handle     handle,
                                                           rocsparse_int        m,
@@ -217,6 +218,37 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
     size_t size        = 0;
     void*  tmp_rocprim = reinterpret_cast<void*>(ptr);
 
+    // Check whether the rows are already sorted. Nearly-sorted input, e.g.
+    // coming out of row-wise assembly, then only requires the segmented sort
+    // of the columns and the device-wide radix sort over the row indices can
+    // be skipped entirely
+    rocsparse_int rows_unsorted = 0;
+
+    if(nnz > 1)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(work1, 0, sizeof(rocsparse_int), stream));
+
+#define COOSORT_DIM 512
+        dim3 coosort_sorted_blocks((nnz - 2) / COOSORT_DIM + 1);
+        dim3 coosort_sorted_threads(COOSORT_DIM);
+#undef COOSORT_DIM
+
+        hipLaunchKernelGGL((coosort_unsorted_rows_kernel),
+                           coosort_sorted_blocks,
+                           coosort_sorted_threads,
+                           0,
+                           stream,
+                           nnz,
+                           coo_row_ind,
+                           work1);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &rows_unsorted, work1, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
     if(perm != nullptr)
     {
         // Create identitiy permutation to keep track of reorderings
@@ -226,10 +258,13 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
         rocprim::double_buffer<rocsparse_int> keys(coo_row_ind, work3);
         rocprim::double_buffer<rocsparse_int> vals(work1, work2);
 
-        RETURN_IF_HIP_ERROR(
-            rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz, startbit, endbit, stream));
-        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
-            tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+        if(rows_unsorted)
+        {
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                nullptr, size, keys, vals, nnz, startbit, endbit, stream));
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+        }
 
         rocsparse_int* output  = keys.current();
         rocsparse_int* mapping = vals.current();
@@ -260,37 +295,43 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
             tmp_rocprim, size, work4, work4, 0, nsegm + 1, rocprim::plus<rocsparse_int>(), stream));
 
-// Reorder columns
+        // Reorder columns, if the rows had to be sorted. For sorted rows, the
+        // identity mapping is skipped and the segmented sort runs in place
+        if(rows_unsorted)
+        {
 #define COOSORT_DIM 512
-        dim3 coosort_blocks((nnz - 1) / COOSORT_DIM + 1);
-        dim3 coosort_threads(COOSORT_DIM);
+            dim3 coosort_blocks((nnz - 1) / COOSORT_DIM + 1);
+            dim3 coosort_threads(COOSORT_DIM);
 #undef COOSORT_DIM
 
-        hipLaunchKernelGGL((coosort_permute_kernel),
-                           coosort_blocks,
-                           coosort_threads,
-                           0,
-                           stream,
-                           nnz,
-                           coo_col_ind,
-                           mapping,
-                           work3);
-
-        hipLaunchKernelGGL((coosort_permute_kernel),
-                           coosort_blocks,
-                           coosort_threads,
-                           0,
-                           stream,
-                           nnz,
-                           perm,
-                           mapping,
-                           alt_map);
+            hipLaunchKernelGGL((coosort_permute_kernel),
+                               coosort_blocks,
+                               coosort_threads,
+                               0,
+                               stream,
+                               nnz,
+                               coo_col_ind,
+                               mapping,
+                               work3);
+
+            hipLaunchKernelGGL((coosort_permute_kernel),
+                               coosort_blocks,
+                               coosort_threads,
+                               0,
+                               stream,
+                               nnz,
+                               perm,
+                               mapping,
+                               alt_map);
+        }
 
         // Sort columns per row
         endbit = rocsparse_clz(n);
 
-        rocprim::double_buffer<rocsparse_int> keys2(work3, coo_col_ind);
-        rocprim::double_buffer<rocsparse_int> vals2(alt_map, perm);
+        rocprim::double_buffer<rocsparse_int> keys2(rows_unsorted ? work3 : coo_col_ind,
+                                                    rows_unsorted ? coo_col_ind : work3);
+        rocprim::double_buffer<rocsparse_int> vals2(rows_unsorted ? alt_map : perm,
+                                                    rows_unsorted ? perm : alt_map);
 
         RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
             nullptr, size, keys2, vals2, nnz, nsegm, work4, work4 + 1, startbit, endbit, stream));
@@ -385,10 +426,13 @@ extern "C" rocsparse_status rocsparse_coosort_by_row(rocsparse_handle handle,
         rocprim::double_buffer<rocsparse_int> keys(coo_row_ind, work3);
         rocprim::double_buffer<rocsparse_int> vals(coo_col_ind, work2);
 
-        RETURN_IF_HIP_ERROR(
-            rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz, startbit, endbit, stream));
-        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
-            tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+        if(rows_unsorted)
+        {
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                nullptr, size, keys, vals, nnz, startbit, endbit, stream));
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+        }
         rocsparse_int* output = keys.current();
 
         // Copy sorted rows, if stored in buffer
@@ -471,3 +515,443 @@ extern "C" rocsparse_status rocsparse_coosort_by_column(rocsparse_handle handle,
 {
     return rocsparse_coosort_by_row(handle, n, m, nnz, coo_col_ind, coo_row_ind, perm, temp_buffer);
 }
+
+// Chunk capacity of the low memory sort path in entries; the bounded working
+// set trades additional passes over the data for a peak footprint that no
+// longer scales with three times nnz
+#define COOSORT_LOWMEM_CHUNK (1 << 22)
+
+extern "C" rocsparse_status rocsparse_coosort_low_mem_buffer_size(rocsparse_handle     handle,
+                                                                  rocsparse_int        m,
+                                                                  rocsparse_int        n,
+                                                                  rocsparse_int        nnz,
+                                                                  const rocsparse_int* coo_row_ind,
+                                                                  const rocsparse_int* coo_col_ind,
+                                                                  size_t*              buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_coosort_low_mem_buffer_size",
+              m,
+              n,
+              nnz,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int chunk = std::min(nnz, (rocsparse_int)COOSORT_LOWMEM_CHUNK);
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // Determine max rocprim buffer size
+    size_t size;
+    *buffer_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, ptr, ptr, std::max(m, n) + 2, rocprim::plus<rocsparse_int>(), stream));
+    *buffer_size = std::max(size, *buffer_size);
+
+    rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
+        nullptr, size, dummy, dummy, chunk, chunk, ptr, ptr + 1, 0, 32, stream));
+    *buffer_size = std::max(size, *buffer_size);
+
+    // Rows larger than the chunk fall back to a device-wide sort of their span
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(nullptr, size, dummy, dummy, nnz, 0, 32, stream));
+    *buffer_size = std::max(size, *buffer_size);
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // row offsets and working copy of the write offsets; sized for both sort
+    // directions
+    *buffer_size += 2 * sizeof(rocsparse_int) * ((std::max(m, n) + 1) / 256 + 1) * 256;
+    // scatter source copies of the columns and the permutation
+    *buffer_size += 2 * sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    // chunk alternate buffers for keys and values
+    *buffer_size += 2 * sizeof(rocsparse_int) * ((chunk - 1) / 256 + 1) * 256;
+    // rebased segment offsets of the current chunk
+    *buffer_size += sizeof(rocsparse_int) * (chunk / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_coosort_by_row_low_mem(rocsparse_handle handle,
+                                                             rocsparse_int    m,
+                                                             rocsparse_int    n,
+                                                             rocsparse_int    nnz,
+                                                             rocsparse_int*   coo_row_ind,
+                                                             rocsparse_int*   coo_col_ind,
+                                                             rocsparse_int*   perm,
+                                                             void*            temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_coosort_by_row_low_mem",
+              m,
+              n,
+              nnz,
+              (const void*&)coo_row_ind,
+              (const void*&)coo_col_ind,
+              (const void*&)perm,
+              (const void*&)temp_buffer);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int chunk = std::min(nnz, (rocsparse_int)COOSORT_LOWMEM_CHUNK);
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Row offsets; the histogram covers zero and one based row indices
+    rocsparse_int* row_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m + 1) / 256 + 1) * 256;
+
+    // Working copy of the offsets, consumed by the scatter
+    rocsparse_int* row_off = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m + 1) / 256 + 1) * 256;
+
+    // Scatter source copies
+    rocsparse_int* scratch_col = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    rocsparse_int* scratch_perm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // Chunk alternate buffers
+    rocsparse_int* chunk_keys = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((chunk - 1) / 256 + 1) * 256;
+
+    rocsparse_int* chunk_vals = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((chunk - 1) / 256 + 1) * 256;
+
+    // Rebased segment offsets of the current chunk
+    rocsparse_int* seg_off = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (chunk / 256 + 1) * 256;
+
+    // Temporary rocprim buffer
+    size_t size        = 0;
+    void*  tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+    // Counting sort by row: histogram of the row indices, scanned into write
+    // offsets. This replaces the out-of-place radix sort over the rows and its
+    // double-buffer copies of rows, columns and permutation
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(row_ptr, 0, sizeof(rocsparse_int) * (m + 2), stream));
+
+#define COOSORT_DIM 512
+    dim3 coosort_nnz_blocks((nnz - 1) / COOSORT_DIM + 1);
+    dim3 coosort_threads(COOSORT_DIM);
+
+    hipLaunchKernelGGL((coosort_histogram_kernel),
+                       coosort_nnz_blocks,
+                       coosort_threads,
+                       0,
+                       stream,
+                       nnz,
+                       coo_row_ind,
+                       row_ptr + 1);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, row_ptr, row_ptr, m + 2, rocprim::plus<rocsparse_int>(), stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        tmp_rocprim, size, row_ptr, row_ptr, m + 2, rocprim::plus<rocsparse_int>(), stream));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        row_off, row_ptr, sizeof(rocsparse_int) * (m + 2), hipMemcpyDeviceToDevice, stream));
+
+    // Copy the scatter sources aside, so the pass can write the user arrays
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        scratch_col, coo_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    if(perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            scratch_perm, perm, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+    }
+
+    hipLaunchKernelGGL((coosort_scatter_kernel),
+                       coosort_nnz_blocks,
+                       coosort_threads,
+                       0,
+                       stream,
+                       nnz,
+                       coo_row_ind,
+                       scratch_col,
+                       perm != nullptr ? scratch_perm : nullptr,
+                       coo_col_ind,
+                       perm,
+                       row_off);
+
+    // Rebuild the sorted row indices from the offsets
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo(handle, row_ptr, nnz, m + 1, coo_row_ind, rocsparse_index_base_zero));
+
+    // The chunked column sort is planned on the host
+    std::vector<rocsparse_int> hrow_ptr(m + 2);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hrow_ptr.data(),
+                                       row_ptr,
+                                       sizeof(rocsparse_int) * (m + 2),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Sort the columns of each row, processing row ranges whose entries and
+    // segments fit the bounded chunk
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
+
+    rocsparse_int r0 = 0;
+    while(r0 < m + 1)
+    {
+        rocsparse_int base = hrow_ptr[r0];
+
+        // Grow the row range as long as it fits the chunk
+        rocsparse_int r1 = r0;
+        while(r1 < m + 1 && hrow_ptr[r1 + 1] - base <= chunk && r1 - r0 < chunk)
+        {
+            ++r1;
+        }
+
+        if(r1 == r0)
+        {
+            // A single row exceeding the chunk is sorted with a device-wide
+            // sort of its span, reusing the drained scatter scratch as the
+            // alternate buffer
+            rocsparse_int row_nnz = hrow_ptr[r0 + 1] - base;
+
+            rocprim::double_buffer<rocsparse_int> keys(coo_col_ind + base, scratch_col);
+            rocprim::double_buffer<rocsparse_int> vals(perm != nullptr ? perm + base : scratch_col,
+                                                       scratch_perm);
+
+            if(perm != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                    nullptr, size, keys, vals, row_nnz, startbit, endbit, stream));
+                RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+                    tmp_rocprim, size, keys, vals, row_nnz, startbit, endbit, stream));
+
+                if(vals.current() != perm + base)
+                {
+                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(perm + base,
+                                                       vals.current(),
+                                                       sizeof(rocsparse_int) * row_nnz,
+                                                       hipMemcpyDeviceToDevice,
+                                                       stream));
+                }
+            }
+            else
+            {
+                RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
+                    nullptr, size, keys, row_nnz, startbit, endbit, stream));
+                RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
+                    tmp_rocprim, size, keys, row_nnz, startbit, endbit, stream));
+            }
+
+            if(keys.current() != coo_col_ind + base)
+            {
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(coo_col_ind + base,
+                                                   keys.current(),
+                                                   sizeof(rocsparse_int) * row_nnz,
+                                                   hipMemcpyDeviceToDevice,
+                                                   stream));
+            }
+
+            r0 = r0 + 1;
+            continue;
+        }
+
+        rocsparse_int nseg     = r1 - r0;
+        rocsparse_int range_nnz = hrow_ptr[r1] - base;
+
+        if(range_nnz > 0)
+        {
+            dim3 coosort_seg_blocks(nseg / COOSORT_DIM + 1);
+
+            hipLaunchKernelGGL((coosort_rebase_offsets_kernel),
+                               coosort_seg_blocks,
+                               coosort_threads,
+                               0,
+                               stream,
+                               nseg,
+                               row_ptr + r0,
+                               base,
+                               seg_off);
+
+            rocprim::double_buffer<rocsparse_int> keys(coo_col_ind + base, chunk_keys);
+            rocprim::double_buffer<rocsparse_int> vals(perm != nullptr ? perm + base : chunk_keys,
+                                                       chunk_vals);
+
+            if(perm != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(nullptr,
+                                                                        size,
+                                                                        keys,
+                                                                        vals,
+                                                                        range_nnz,
+                                                                        nseg,
+                                                                        seg_off,
+                                                                        seg_off + 1,
+                                                                        startbit,
+                                                                        endbit,
+                                                                        stream));
+                RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(tmp_rocprim,
+                                                                        size,
+                                                                        keys,
+                                                                        vals,
+                                                                        range_nnz,
+                                                                        nseg,
+                                                                        seg_off,
+                                                                        seg_off + 1,
+                                                                        startbit,
+                                                                        endbit,
+                                                                        stream));
+
+                if(vals.current() != perm + base)
+                {
+                    RETURN_IF_HIP_ERROR(hipMemcpyAsync(perm + base,
+                                                       vals.current(),
+                                                       sizeof(rocsparse_int) * range_nnz,
+                                                       hipMemcpyDeviceToDevice,
+                                                       stream));
+                }
+            }
+            else
+            {
+                RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys(nullptr,
+                                                                       size,
+                                                                       keys,
+                                                                       range_nnz,
+                                                                       nseg,
+                                                                       seg_off,
+                                                                       seg_off + 1,
+                                                                       startbit,
+                                                                       endbit,
+                                                                       stream));
+                RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys(tmp_rocprim,
+                                                                       size,
+                                                                       keys,
+                                                                       range_nnz,
+                                                                       nseg,
+                                                                       seg_off,
+                                                                       seg_off + 1,
+                                                                       startbit,
+                                                                       endbit,
+                                                                       stream));
+            }
+
+            if(keys.current() != coo_col_ind + base)
+            {
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(coo_col_ind + base,
+                                                   keys.current(),
+                                                   sizeof(rocsparse_int) * range_nnz,
+                                                   hipMemcpyDeviceToDevice,
+                                                   stream));
+            }
+        }
+
+        r0 = r1;
+    }
+#undef COOSORT_DIM
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_coosort_by_column_low_mem(rocsparse_handle handle,
+                                                                rocsparse_int    m,
+                                                                rocsparse_int    n,
+                                                                rocsparse_int    nnz,
+                                                                rocsparse_int*   coo_row_ind,
+                                                                rocsparse_int*   coo_col_ind,
+                                                                rocsparse_int*   perm,
+                                                                void*            temp_buffer)
+{
+    return rocsparse_coosort_by_row_low_mem(
+        handle, n, m, nnz, coo_col_ind, coo_row_ind, perm, temp_buffer);
+}
@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2BSR_HPP
+#define ROCSPARSE_CSR2BSR_HPP
+
+#include "csr2bsr_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+__global__ void csr2bsr_nnzb_per_row_kernel(rocsparse_int mb,
+                                            rocsparse_int m,
+                                            rocsparse_int block_dim,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            rocsparse_int* __restrict__ bsr_row_ptr,
+                                            rocsparse_index_base idx_base)
+{
+    csr2bsr_nnzb_per_row_device(mb, m, block_dim, csr_row_ptr, csr_col_ind, bsr_row_ptr, idx_base);
+}
+
+template <typename T>
+__global__ void csr2bsr_fill_kernel(rocsparse_int mb,
+                                    rocsparse_int m,
+                                    rocsparse_int block_dim,
+                                    const T* __restrict__ csr_val,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr,
+                                    rocsparse_int* __restrict__ bsr_col_ind,
+                                    T* __restrict__ bsr_val,
+                                    rocsparse_index_base idx_base)
+{
+    csr2bsr_fill_device<T>(mb,
+                           m,
+                           block_dim,
+                           csr_val,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_bsr_mat         bsr)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2bsr"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              block_dim,
+              (const void*&)bsr);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The conversion keeps one cursor per row of a block row in registers
+    if(block_dim > CSR2BSR_MAX_BLOCK_DIM)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Block row and column dimensions
+    rocsparse_int mb = (m + block_dim - 1) / block_dim;
+    rocsparse_int nb = (n + block_dim - 1) / block_dim;
+
+    bsr->m         = m;
+    bsr->n         = n;
+    bsr->mb        = mb;
+    bsr->nb        = nb;
+    bsr->block_dim = block_dim;
+
+    // Allocate BSR row pointer array
+    if(bsr->bsr_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(bsr->bsr_row_ptr));
+    }
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&bsr->bsr_row_ptr, sizeof(rocsparse_int) * (mb + 1)));
+
+#define CSR2BSR_DIM 256
+    dim3 csr2bsr_blocks((mb - 1) / CSR2BSR_DIM + 1);
+    dim3 csr2bsr_threads(CSR2BSR_DIM);
+
+    // Count the number of non-zero blocks per block row
+    hipLaunchKernelGGL(csr2bsr_nnzb_per_row_kernel,
+                       csr2bsr_blocks,
+                       csr2bsr_threads,
+                       0,
+                       stream,
+                       mb,
+                       m,
+                       block_dim,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       bsr->bsr_row_ptr,
+                       descr->base);
+
+    // Inclusive scan to obtain the BSR row pointer array
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                bsr->bsr_row_ptr,
+                                                bsr->bsr_row_ptr,
+                                                mb + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    void* rocprim_buffer = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(rocprim_size, &rocprim_buffer));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                bsr->bsr_row_ptr,
+                                                bsr->bsr_row_ptr,
+                                                mb + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(rocprim_buffer));
+
+    // Obtain the number of non-zero blocks
+    rocsparse_int nnzb;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nnzb, bsr->bsr_row_ptr + mb, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    nnzb -= descr->base;
+    bsr->nnzb = nnzb;
+
+    // Allocate BSR column indices and values
+    if(bsr->bsr_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(bsr->bsr_col_ind));
+    }
+    if(bsr->bsr_val != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(bsr->bsr_val));
+    }
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&bsr->bsr_col_ind, sizeof(rocsparse_int) * nnzb));
+    RETURN_IF_HIP_ERROR(
+        hipMalloc(&bsr->bsr_val, sizeof(T) * nnzb * block_dim * block_dim));
+
+    // Padded block entries stay zero
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(bsr->bsr_val, 0, sizeof(T) * nnzb * block_dim * block_dim, stream));
+
+    // Fill the BSR structure
+    hipLaunchKernelGGL(csr2bsr_fill_kernel<T>,
+                       csr2bsr_blocks,
+                       csr2bsr_threads,
+                       0,
+                       stream,
+                       mb,
+                       m,
+                       block_dim,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       bsr->bsr_row_ptr,
+                       bsr->bsr_col_ind,
+                       reinterpret_cast<T*>(bsr->bsr_val),
+                       descr->base);
+#undef CSR2BSR_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2BSR_HPP
@@ -181,3 +181,472 @@ extern "C" rocsparse_status rocsparse_dcsr2csc(rocsparse_handle     handle,
                                               idx_base,
                                               temp_buffer);
 }
+
+extern "C" rocsparse_status rocsparse_csr2csc_analysis(rocsparse_handle     handle,
+                                                       rocsparse_int        m,
+                                                       rocsparse_int        n,
+                                                       rocsparse_int        nnz,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_int*       csc_row_ind,
+                                                       rocsparse_int*       csc_col_ptr,
+                                                       rocsparse_mat_info   info,
+                                                       rocsparse_index_base idx_base,
+                                                       void*                temp_buffer)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csc_analysis",
+              m,
+              n,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)csc_row_ind,
+              (const void*&)csc_col_ptr,
+              (const void*&)info,
+              idx_base,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_col_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
+
+    // Temporary buffer entry points, same layout as rocsparse_csr2csc
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // work1 buffer
+    rocsparse_int* tmp_work1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // work2 buffer
+    rocsparse_int* tmp_work2 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // perm buffer
+    rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+    // Load CSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create identitiy permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, tmp_perm));
+
+    // Stable sort COO by columns
+    rocprim::double_buffer<rocsparse_int> keys(tmp_work1, csc_row_ind);
+    rocprim::double_buffer<rocsparse_int> vals(tmp_perm, tmp_work2);
+
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+
+    // Create column pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.current(), nnz, n, csc_col_ptr, idx_base));
+
+    // Create row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, tmp_work1, idx_base));
+
+    // If the info has been used for a previous analysis, clear it first
+    if(info->csr2csc_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csr2csc_info(info->csr2csc_info));
+        info->csr2csc_info = nullptr;
+    }
+
+    // Create csr2csc info and keep the nnz permutation for the numeric phase
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csr2csc_info(&info->csr2csc_info));
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csr2csc_info->perm, sizeof(rocsparse_int) * nnz));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csr2csc_info->perm,
+                                       vals.current(),
+                                       sizeof(rocsparse_int) * nnz,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    // Store some data to verify correct execution
+    info->csr2csc_info->m   = m;
+    info->csr2csc_info->n   = n;
+    info->csr2csc_info->nnz = nnz;
+
+// Permute the row indices into their CSC position
+#define CSR2CSC_DIM 512
+    dim3 csr2csc_blocks((nnz - 1) / CSR2CSC_DIM + 1);
+    dim3 csr2csc_threads(CSR2CSC_DIM);
+
+    hipLaunchKernelGGL((csr2csc_permute_symbolic_kernel),
+                       csr2csc_blocks,
+                       csr2csc_threads,
+                       0,
+                       stream,
+                       nnz,
+                       tmp_work1,
+                       info->csr2csc_info->perm,
+                       csc_row_ind);
+#undef CSR2CSC_DIM
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2csc_numeric(rocsparse_handle   handle,
+                                                       rocsparse_int      nnz,
+                                                       const float*       csr_val,
+                                                       float*             csc_val,
+                                                       rocsparse_mat_info info)
+{
+    return rocsparse_csr2csc_numeric_template<float>(handle, nnz, csr_val, csc_val, info);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2csc_numeric(rocsparse_handle   handle,
+                                                       rocsparse_int      nnz,
+                                                       const double*      csr_val,
+                                                       double*            csc_val,
+                                                       rocsparse_mat_info info)
+{
+    return rocsparse_csr2csc_numeric_template<double>(handle, nnz, csr_val, csc_val, info);
+}
+
+extern "C" rocsparse_status rocsparse_csr2csc2_buffer_size(rocsparse_handle      handle,
+                                                           rocsparse_int         m,
+                                                           rocsparse_int         n,
+                                                           rocsparse_int         nnz,
+                                                           const rocsparse_int*  csr_row_ptr,
+                                                           const rocsparse_int*  csr_col_ind,
+                                                           rocsparse_action      copy_values,
+                                                           rocsparse_csr2csc_alg alg,
+                                                           size_t*               buffer_size)
+{
+    // The radix sort algorithm requires the original buffer layout
+    if(alg == rocsparse_csr2csc_alg_radix)
+    {
+        return rocsparse_csr2csc_buffer_size(
+            handle, m, n, nnz, csr_row_ptr, csr_col_ind, copy_values, buffer_size);
+    }
+    else if(alg != rocsparse_csr2csc_alg_atomic)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csc2_buffer_size",
+              m,
+              n,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              copy_values,
+              alg,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim buffer size
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, *buffer_size, ptr, ptr, n + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // Expanded row indices and running column offsets
+    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    *buffer_size += sizeof(rocsparse_int) * ((n - 1) / 256 + 1) * 256;
+
+    // Do not return 0 as size
+    if(*buffer_size == 0)
+    {
+        *buffer_size = 4;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2csc2(rocsparse_handle      handle,
+                                                rocsparse_int         m,
+                                                rocsparse_int         n,
+                                                rocsparse_int         nnz,
+                                                const float*          csr_val,
+                                                const rocsparse_int*  csr_row_ptr,
+                                                const rocsparse_int*  csr_col_ind,
+                                                float*                csc_val,
+                                                rocsparse_int*        csc_row_ind,
+                                                rocsparse_int*        csc_col_ptr,
+                                                rocsparse_action      copy_values,
+                                                rocsparse_csr2csc_alg alg,
+                                                rocsparse_index_base  idx_base,
+                                                void*                 temp_buffer)
+{
+    return rocsparse_csr2csc2_template<float>(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csc_val,
+                                              csc_row_ind,
+                                              csc_col_ptr,
+                                              copy_values,
+                                              alg,
+                                              idx_base,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2csc2(rocsparse_handle      handle,
+                                                rocsparse_int         m,
+                                                rocsparse_int         n,
+                                                rocsparse_int         nnz,
+                                                const double*         csr_val,
+                                                const rocsparse_int*  csr_row_ptr,
+                                                const rocsparse_int*  csr_col_ind,
+                                                double*               csc_val,
+                                                rocsparse_int*        csc_row_ind,
+                                                rocsparse_int*        csc_col_ptr,
+                                                rocsparse_action      copy_values,
+                                                rocsparse_csr2csc_alg alg,
+                                                rocsparse_index_base  idx_base,
+                                                void*                 temp_buffer)
+{
+    return rocsparse_csr2csc2_template<double>(handle,
+                                               m,
+                                               n,
+                                               nnz,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csc_val,
+                                               csc_row_ind,
+                                               csc_col_ptr,
+                                               copy_values,
+                                               alg,
+                                               idx_base,
+                                               temp_buffer);
+}
+
+
+extern "C" rocsparse_status rocsparse_csr2csc_chunked_buffer_size(rocsparse_handle handle,
+                                                                  rocsparse_int    m,
+                                                                  rocsparse_int    n,
+                                                                  rocsparse_int    nnz,
+                                                                  size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csr2csc_chunked_buffer_size", m, n, nnz, (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim buffer size
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, *buffer_size, ptr, ptr, n + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // Minimum column offsets chunk, any additional buffer space enlarges the
+    // column ranges and reduces the number of passes over the CSR arrays
+    *buffer_size += sizeof(rocsparse_int) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2csc_chunked(rocsparse_handle     handle,
+                                                       rocsparse_int        m,
+                                                       rocsparse_int        n,
+                                                       rocsparse_int        nnz,
+                                                       const float*         csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       float*               csc_val,
+                                                       rocsparse_int*       csc_row_ind,
+                                                       rocsparse_int*       csc_col_ptr,
+                                                       rocsparse_action     copy_values,
+                                                       rocsparse_index_base idx_base,
+                                                       size_t               buffer_size,
+                                                       void*                temp_buffer)
+{
+    return rocsparse_csr2csc_chunked_template<float>(handle,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csc_val,
+                                                     csc_row_ind,
+                                                     csc_col_ptr,
+                                                     copy_values,
+                                                     idx_base,
+                                                     buffer_size,
+                                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2csc_chunked(rocsparse_handle     handle,
+                                                       rocsparse_int        m,
+                                                       rocsparse_int        n,
+                                                       rocsparse_int        nnz,
+                                                       const double*        csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       double*              csc_val,
+                                                       rocsparse_int*       csc_row_ind,
+                                                       rocsparse_int*       csc_col_ptr,
+                                                       rocsparse_action     copy_values,
+                                                       rocsparse_index_base idx_base,
+                                                       size_t               buffer_size,
+                                                       void*                temp_buffer)
+{
+    return rocsparse_csr2csc_chunked_template<double>(handle,
+                                                      m,
+                                                      n,
+                                                      nnz,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      csc_val,
+                                                      csc_row_ind,
+                                                      csc_col_ptr,
+                                                      copy_values,
+                                                      idx_base,
+                                                      buffer_size,
+                                                      temp_buffer);
+}
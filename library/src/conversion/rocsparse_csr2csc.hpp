@@ -229,4 +229,544 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
+// Numeric phase of the split transpose. The CSC structure and the nnz
+// permutation have been computed by rocsparse_csr2csc_analysis, such that
+// transposing new values of the same sparsity pattern reduces to a single
+// gather pass through the cached permutation instead of a full radix sort
+template <typename T>
+rocsparse_status rocsparse_csr2csc_numeric_template(
+    rocsparse_handle handle, rocsparse_int nnz, const T* csr_val, T* csc_val, rocsparse_mat_info info)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2csc_numeric"),
+              nnz,
+              (const void*&)csr_val,
+              (const void*&)csc_val,
+              (const void*&)info);
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis data
+    if(info->csr2csc_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info->csr2csc_info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+// Gather the values through the cached permutation
+#define CSR2CSC_DIM 512
+    dim3 csr2csc_blocks((nnz - 1) / CSR2CSC_DIM + 1);
+    dim3 csr2csc_threads(CSR2CSC_DIM);
+
+    hipLaunchKernelGGL((csr2csc_gather_kernel<T>),
+                       csr2csc_blocks,
+                       csr2csc_threads,
+                       0,
+                       handle->stream,
+                       nnz,
+                       csr_val,
+                       info->csr2csc_info->perm,
+                       csc_val);
+#undef CSR2CSC_DIM
+
+    return rocsparse_status_success;
+}
+
+// Counting sort based transpose that builds the CSC matrix directly from a
+// column histogram and atomically claimed insert positions. In contrast to
+// rocsparse_csr2csc_template, no stable radix sort over the full column
+// indices is performed, such that only the expanded row indices and the
+// running column offsets are required as temporary storage. Row indices
+// within each column are in undefined order.
+template <typename T>
+rocsparse_status rocsparse_csr2csc_atomic_template(rocsparse_handle     handle,
+                                                   rocsparse_int        m,
+                                                   rocsparse_int        n,
+                                                   rocsparse_int        nnz,
+                                                   const T*             csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   T*                   csc_val,
+                                                   rocsparse_int*       csc_row_ind,
+                                                   rocsparse_int*       csc_col_ptr,
+                                                   rocsparse_action     copy_values,
+                                                   rocsparse_index_base idx_base,
+                                                   void*                temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // row indices buffer
+    rocsparse_int* tmp_rows = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // column offsets buffer
+    rocsparse_int* tmp_offsets = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((n - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+    // Compute the column histogram into the column pointer array
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(csc_col_ptr, 0, sizeof(rocsparse_int) * (n + 1), stream));
+
+#define CSR2CSC_DIM 512
+    dim3 csr2csc_blocks((nnz - 1) / CSR2CSC_DIM + 1);
+    dim3 csr2csc_threads(CSR2CSC_DIM);
+
+    hipLaunchKernelGGL((csr2csc_histogram_kernel),
+                       csr2csc_blocks,
+                       csr2csc_threads,
+                       0,
+                       stream,
+                       nnz,
+                       csr_col_ind,
+                       csc_col_ptr,
+                       idx_base);
+
+    // Create zero based column pointers
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, csc_col_ptr, csc_col_ptr, n + 1, rocprim::plus<rocsparse_int>(), stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        tmp_rocprim, size, csc_col_ptr, csc_col_ptr, n + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    // Initialize the running column offsets with the column start positions
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_offsets, csc_col_ptr, sizeof(rocsparse_int) * n, hipMemcpyDeviceToDevice, stream));
+
+    // Expand the row pointers into row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, tmp_rows, idx_base));
+
+    // Scatter entries to their column
+    if(copy_values == rocsparse_action_numeric)
+    {
+        hipLaunchKernelGGL((csr2csc_scatter_kernel<T>),
+                           csr2csc_blocks,
+                           csr2csc_threads,
+                           0,
+                           stream,
+                           nnz,
+                           tmp_rows,
+                           csr_col_ind,
+                           csr_val,
+                           tmp_offsets,
+                           csc_row_ind,
+                           csc_val,
+                           idx_base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csr2csc_scatter_symbolic_kernel),
+                           csr2csc_blocks,
+                           csr2csc_threads,
+                           0,
+                           stream,
+                           nnz,
+                           tmp_rows,
+                           csr_col_ind,
+                           tmp_offsets,
+                           csc_row_ind,
+                           idx_base);
+    }
+
+    // Adjust the column pointers to the index base
+    if(idx_base == rocsparse_index_base_one)
+    {
+        dim3 csr2csc_shift_blocks(n / CSR2CSC_DIM + 1);
+
+        hipLaunchKernelGGL((csr2csc_shift_kernel),
+                           csr2csc_shift_blocks,
+                           csr2csc_threads,
+                           0,
+                           stream,
+                           n,
+                           csc_col_ptr);
+    }
+#undef CSR2CSC_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2csc2_template(rocsparse_handle      handle,
+                                             rocsparse_int         m,
+                                             rocsparse_int         n,
+                                             rocsparse_int         nnz,
+                                             const T*              csr_val,
+                                             const rocsparse_int*  csr_row_ptr,
+                                             const rocsparse_int*  csr_col_ind,
+                                             T*                    csc_val,
+                                             rocsparse_int*        csc_row_ind,
+                                             rocsparse_int*        csc_col_ptr,
+                                             rocsparse_action      copy_values,
+                                             rocsparse_csr2csc_alg alg,
+                                             rocsparse_index_base  idx_base,
+                                             void*                 temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // The radix sort algorithm is handled by the original conversion routine
+    if(alg == rocsparse_csr2csc_alg_radix)
+    {
+        return rocsparse_csr2csc_template<T>(handle,
+                                             m,
+                                             n,
+                                             nnz,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             csc_val,
+                                             csc_row_ind,
+                                             csc_col_ptr,
+                                             copy_values,
+                                             idx_base,
+                                             temp_buffer);
+    }
+    else if(alg != rocsparse_csr2csc_alg_atomic)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2csc2"),
+              m,
+              n,
+              nnz,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)csc_val,
+              (const void*&)csc_row_ind,
+              (const void*&)csc_col_ptr,
+              copy_values,
+              alg,
+              idx_base,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csr2csc2 -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr && copy_values == rocsparse_action_numeric)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_val == nullptr && copy_values == rocsparse_action_numeric)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_col_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csr2csc_atomic_template<T>(handle,
+                                                m,
+                                                n,
+                                                nnz,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                csc_val,
+                                                csc_row_ind,
+                                                csc_col_ptr,
+                                                copy_values,
+                                                idx_base,
+                                                temp_buffer);
+}
+
+// Chunked transpose that streams the matrix through in column ranges. The
+// size of a column range is derived from the user supplied buffer size, such
+// that the peak temporary device memory is bounded by the caller. Each range
+// re-reads the CSR arrays once, trading additional passes for the ability to
+// convert matrices close to the device memory limit. Row indices within each
+// column are in undefined order
+template <typename T>
+rocsparse_status rocsparse_csr2csc_chunked_template(rocsparse_handle     handle,
+                                                    rocsparse_int        m,
+                                                    rocsparse_int        n,
+                                                    rocsparse_int        nnz,
+                                                    const T*             csr_val,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    T*                   csc_val,
+                                                    rocsparse_int*       csc_row_ind,
+                                                    rocsparse_int*       csc_col_ptr,
+                                                    rocsparse_action     copy_values,
+                                                    rocsparse_index_base idx_base,
+                                                    size_t               buffer_size,
+                                                    void*                temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2csc_chunked"),
+              m,
+              n,
+              nnz,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)csc_val,
+              (const void*&)csc_row_ind,
+              (const void*&)csc_col_ptr,
+              copy_values,
+              idx_base,
+              buffer_size,
+              (const void*&)temp_buffer);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csr2csc_chunked -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr && copy_values == rocsparse_action_numeric)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_val == nullptr && copy_values == rocsparse_action_numeric)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_col_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim scan buffer size
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, csc_col_ptr, csc_col_ptr, n + 1, rocprim::plus<rocsparse_int>(), stream));
+    size = ((size - 1) / 256 + 1) * 256;
+
+    // The remainder of the buffer holds the running column offsets of a
+    // chunk, its size determines the number of columns per pass
+    if(buffer_size < size + sizeof(rocsparse_int))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_int chunk_cols
+        = static_cast<rocsparse_int>((buffer_size - size) / sizeof(rocsparse_int));
+    chunk_cols = chunk_cols > n ? n : chunk_cols;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+    ptr += size;
+
+    // column offsets buffer
+    rocsparse_int* tmp_offsets = reinterpret_cast<rocsparse_int*>(ptr);
+
+    // Compute the column histogram into the column pointer array
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(csc_col_ptr, 0, sizeof(rocsparse_int) * (n + 1), stream));
+
+#define CSR2CSC_DIM 512
+    dim3 csr2csc_nnz_blocks((nnz - 1) / CSR2CSC_DIM + 1);
+    dim3 csr2csc_row_blocks((m - 1) / CSR2CSC_DIM + 1);
+    dim3 csr2csc_threads(CSR2CSC_DIM);
+
+    hipLaunchKernelGGL((csr2csc_histogram_kernel),
+                       csr2csc_nnz_blocks,
+                       csr2csc_threads,
+                       0,
+                       stream,
+                       nnz,
+                       csr_col_ind,
+                       csc_col_ptr,
+                       idx_base);
+
+    // Create zero based column pointers
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        tmp_rocprim, size, csc_col_ptr, csc_col_ptr, n + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    // Stream the matrix through in column ranges
+    for(rocsparse_int col_begin = 0; col_begin < n; col_begin += chunk_cols)
+    {
+        rocsparse_int col_end = col_begin + chunk_cols > n ? n : col_begin + chunk_cols;
+
+        // Initialize the running column offsets with the column start
+        // positions of this range
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(tmp_offsets,
+                                           csc_col_ptr + col_begin,
+                                           sizeof(rocsparse_int) * (col_end - col_begin),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Scatter all entries of this column range
+        if(copy_values == rocsparse_action_numeric)
+        {
+            hipLaunchKernelGGL((csr2csc_chunk_scatter_kernel<T>),
+                               csr2csc_row_blocks,
+                               csr2csc_threads,
+                               0,
+                               stream,
+                               m,
+                               col_begin,
+                               col_end,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               tmp_offsets,
+                               csc_row_ind,
+                               csc_val,
+                               idx_base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csr2csc_chunk_scatter_symbolic_kernel),
+                               csr2csc_row_blocks,
+                               csr2csc_threads,
+                               0,
+                               stream,
+                               m,
+                               col_begin,
+                               col_end,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               tmp_offsets,
+                               csc_row_ind,
+                               idx_base);
+        }
+    }
+
+    // Adjust the column pointers to the index base
+    if(idx_base == rocsparse_index_base_one)
+    {
+        dim3 csr2csc_shift_blocks(n / CSR2CSC_DIM + 1);
+
+        hipLaunchKernelGGL((csr2csc_shift_kernel),
+                           csr2csc_shift_blocks,
+                           csr2csc_threads,
+                           0,
+                           stream,
+                           n,
+                           csc_col_ptr);
+    }
+#undef CSR2CSC_DIM
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSR2CSC_HPP
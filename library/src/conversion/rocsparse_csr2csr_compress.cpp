@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "rocsparse_csr2csr_compress.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2csr_compress_buffer_size(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   rocsparse_int    n,
+                                                                   rocsparse_int    nnz,
+                                                                   size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(
+        handle, "rocsparse_csr2csr_compress_buffer_size", m, n, nnz, (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim buffer size
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, *buffer_size, ptr, ptr, m + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // Do not return 0 as size
+    if(*buffer_size == 0)
+    {
+        *buffer_size = 4;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2csr_compress_nnz(rocsparse_handle          handle,
+                                                            rocsparse_int             m,
+                                                            rocsparse_int             n,
+                                                            rocsparse_int             nnz,
+                                                            const rocsparse_mat_descr descr,
+                                                            const float*              csr_val,
+                                                            const rocsparse_int*      csr_row_ptr,
+                                                            float                     tol,
+                                                            rocsparse_int*            csr_row_ptr_C,
+                                                            rocsparse_int*            nnz_C,
+                                                            void*                     temp_buffer)
+{
+    return rocsparse_csr2csr_compress_nnz_template<float>(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, tol, csr_row_ptr_C, nnz_C, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2csr_compress_nnz(rocsparse_handle          handle,
+                                                            rocsparse_int             m,
+                                                            rocsparse_int             n,
+                                                            rocsparse_int             nnz,
+                                                            const rocsparse_mat_descr descr,
+                                                            const double*             csr_val,
+                                                            const rocsparse_int*      csr_row_ptr,
+                                                            double                    tol,
+                                                            rocsparse_int*            csr_row_ptr_C,
+                                                            rocsparse_int*            nnz_C,
+                                                            void*                     temp_buffer)
+{
+    return rocsparse_csr2csr_compress_nnz_template<double>(
+        handle, m, n, nnz, descr, csr_val, csr_row_ptr, tol, csr_row_ptr_C, nnz_C, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsr2csr_compress(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        float                     tol,
+                                                        float*                    csr_val_C,
+                                                        const rocsparse_int*      csr_row_ptr_C,
+                                                        rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_csr2csr_compress_template<float>(handle,
+                                                      m,
+                                                      n,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      tol,
+                                                      csr_val_C,
+                                                      csr_row_ptr_C,
+                                                      csr_col_ind_C);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2csr_compress(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        double                    tol,
+                                                        double*                   csr_val_C,
+                                                        const rocsparse_int*      csr_row_ptr_C,
+                                                        rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_csr2csr_compress_template<double>(handle,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       tol,
+                                                       csr_val_C,
+                                                       csr_row_ptr_C,
+                                                       csr_col_ind_C);
+}
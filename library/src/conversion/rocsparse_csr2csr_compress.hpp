@@ -0,0 +1,324 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2CSR_COMPRESS_HPP
+#define ROCSPARSE_CSR2CSR_COMPRESS_HPP
+
+#include "csr2csr_compress_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+template <typename T>
+rocsparse_status rocsparse_csr2csr_compress_nnz_template(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T*                  csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         T                         tol,
+                                                         rocsparse_int*            csr_row_ptr_C,
+                                                         rocsparse_int*            nnz_C,
+                                                         void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2csr_compress_nnz"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              tol,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check tolerance
+    if(tol < static_cast<T>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check nnz pointer argument before quick return
+    if(nnz_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSR2CSR_COMPRESS_DIM 512
+    dim3 csr2csr_blocks((m - 1) / CSR2CSR_COMPRESS_DIM + 1);
+    dim3 csr2csr_threads(CSR2CSR_COMPRESS_DIM);
+
+    // Count surviving entries per row
+    hipLaunchKernelGGL((csr2csr_compress_nnz_kernel<T>),
+                       csr2csr_blocks,
+                       csr2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       tol,
+                       csr_row_ptr_C,
+                       descr->base);
+#undef CSR2CSR_COMPRESS_DIM
+
+    // Inclusive sum to obtain the compressed row pointers
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_buffer,
+                                                size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract the compressed nnz, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csr2csr_compress_nnz_extract_kernel),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr_C,
+                           nnz_C,
+                           descr->base);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        *nnz_C -= descr->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2csr_compress_template(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     T                         tol,
+                                                     T*                        csr_val_C,
+                                                     const rocsparse_int*      csr_row_ptr_C,
+                                                     rocsparse_int*            csr_col_ind_C)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2csr_compress"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              tol,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csr2csr_compress -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check tolerance
+    if(tol < static_cast<T>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSR2CSR_COMPRESS_DIM 512
+    dim3 csr2csr_blocks((m - 1) / CSR2CSR_COMPRESS_DIM + 1);
+    dim3 csr2csr_threads(CSR2CSR_COMPRESS_DIM);
+
+    // Gather the surviving entries
+    hipLaunchKernelGGL((csr2csr_compress_fill_kernel<T>),
+                       csr2csr_blocks,
+                       csr2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       tol,
+                       csr_val_C,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       descr->base);
+#undef CSR2CSR_COMPRESS_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2CSR_COMPRESS_HPP
@@ -0,0 +1,241 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2DCSR_HPP
+#define ROCSPARSE_CSR2DCSR_HPP
+
+#include "csr2dcsr_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+__global__ void csr2dcsr_flag_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     rocsparse_int* __restrict__ flags)
+{
+    csr2dcsr_flag_device(m, csr_row_ptr, flags);
+}
+
+__global__ void csr2dcsr_fill_kernel(rocsparse_int mc,
+                                     rocsparse_int m,
+                                     rocsparse_int nnz,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ flags,
+                                     rocsparse_int* __restrict__ dcsr_row_ind,
+                                     rocsparse_int* __restrict__ dcsr_row_ptr,
+                                     rocsparse_index_base idx_base)
+{
+    csr2dcsr_fill_device(m, mc, nnz, csr_row_ptr, flags, dcsr_row_ind, dcsr_row_ptr, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2dcsr_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_dcsr_mat        dcsr)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dcsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2dcsr"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)dcsr);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz > 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dcsr->m   = m;
+    dcsr->n   = n;
+    dcsr->nnz = nnz;
+
+    // Temporary flag storage, one entry per row
+    rocsparse_int* flags = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(rocsparse_int) * m, (void**)&flags));
+
+#define CSR2DCSR_DIM 256
+    dim3 csr2dcsr_blocks((m - 1) / CSR2DCSR_DIM + 1);
+    dim3 csr2dcsr_threads(CSR2DCSR_DIM);
+
+    // Flag the non-empty rows
+    hipLaunchKernelGGL(csr2dcsr_flag_kernel,
+                       csr2dcsr_blocks,
+                       csr2dcsr_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       flags);
+
+    // Inclusive scan to obtain the compacted position of each non-empty row
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, rocprim_size, flags, flags, m, rocprim::plus<rocsparse_int>(), stream));
+
+    void* rocprim_buffer = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(rocprim_size, &rocprim_buffer));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        rocprim_buffer, rocprim_size, flags, flags, m, rocprim::plus<rocsparse_int>(), stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(rocprim_buffer));
+
+    // Obtain the number of non-empty rows
+    rocsparse_int mc;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&mc, flags + m - 1, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    dcsr->mc = mc;
+
+    // Allocate the compressed row arrays
+    if(dcsr->dcsr_row_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_row_ind));
+    }
+    if(dcsr->dcsr_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_row_ptr));
+    }
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&dcsr->dcsr_row_ind, sizeof(rocsparse_int) * mc));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&dcsr->dcsr_row_ptr, sizeof(rocsparse_int) * (mc + 1)));
+
+    // Scatter the non-empty rows
+    hipLaunchKernelGGL(csr2dcsr_fill_kernel,
+                       csr2dcsr_blocks,
+                       csr2dcsr_threads,
+                       0,
+                       stream,
+                       mc,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       flags,
+                       dcsr->dcsr_row_ind,
+                       dcsr->dcsr_row_ptr,
+                       descr->base);
+#undef CSR2DCSR_DIM
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(flags));
+
+    // Column indices and values are identical to the CSR matrix
+    if(dcsr->dcsr_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_col_ind));
+    }
+    if(dcsr->dcsr_val != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_val));
+    }
+
+    if(nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&dcsr->dcsr_col_ind, sizeof(rocsparse_int) * nnz));
+        RETURN_IF_HIP_ERROR(hipMalloc(&dcsr->dcsr_val, sizeof(T) * nnz));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dcsr->dcsr_col_ind,
+                                           csr_col_ind,
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dcsr->dcsr_val, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        dcsr->dcsr_col_ind = nullptr;
+        dcsr->dcsr_val     = nullptr;
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2DCSR_HPP
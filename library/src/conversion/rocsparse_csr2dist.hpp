@@ -0,0 +1,379 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2DIST_HPP
+#define ROCSPARSE_CSR2DIST_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+template <typename T>
+rocsparse_status rocsparse_csr2dist_template(rocsparse_handle*         handles,
+                                             rocsparse_int             ndevice,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_dist_mat        dist)
+{
+    // Check for valid handles and matrix descriptor
+    if(handles == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    for(rocsparse_int p = 0; p < ndevice; ++p)
+    {
+        if(handles[p] == nullptr)
+        {
+            return rocsparse_status_invalid_handle;
+        }
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dist == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handles[0],
+              replaceX<T>("rocsparse_Xcsr2dist"),
+              ndevice,
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)dist);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes ; the column ownership coincides with the row partition,
+    // which restricts the distributed format to square matrices
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ndevice < 1 || (m > 0 && ndevice > m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        dist->ndevice = ndevice;
+        dist->m       = m;
+        dist->n       = n;
+        dist->nnz     = nnz;
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Save the active device, the partitions are set up on their owning
+    // devices
+    int current_device;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&current_device));
+
+    rocsparse_index_base base = descr->base;
+
+    dist->ndevice    = ndevice;
+    dist->m          = m;
+    dist->n          = n;
+    dist->nnz        = nnz;
+    dist->descr.type = rocsparse_matrix_type_general;
+    dist->descr.base = rocsparse_index_base_zero;
+    dist->parts.resize(ndevice);
+
+    // Non-zero balanced row partition ; partition p starts at the first row
+    // whose first entry is at or beyond p/ndevice of the non-zeros
+    std::vector<rocsparse_int> row_part(ndevice + 1);
+
+    row_part[0]       = 0;
+    row_part[ndevice] = m;
+
+    for(rocsparse_int p = 1; p < ndevice; ++p)
+    {
+        rocsparse_int target
+            = static_cast<rocsparse_int>(static_cast<int64_t>(nnz) * p / ndevice) + base;
+
+        row_part[p] = static_cast<rocsparse_int>(
+            std::lower_bound(csr_row_ptr, csr_row_ptr + m + 1, target) - csr_row_ptr);
+
+        // Keep the partitions ordered for extremely skewed matrices
+        row_part[p] = std::max(row_part[p], row_part[p - 1]);
+        row_part[p] = std::min(row_part[p], m);
+    }
+
+    for(rocsparse_int p = 0; p < ndevice; ++p)
+    {
+        _rocsparse_dist_mat_part& part = dist->parts[p];
+
+        part.device    = handles[p]->device;
+        part.row_begin = row_part[p];
+        part.row_end   = row_part[p + 1];
+
+        rocsparse_int local_m   = part.row_end - part.row_begin;
+        rocsparse_int col_begin = part.row_begin;
+        rocsparse_int col_end   = part.row_end;
+
+        // First pass over the rows of this partition to split the non-zeros
+        // into the interior and boundary parts and to collect the halo
+        // columns
+        std::vector<rocsparse_int> halo;
+
+        part.int_nnz = 0;
+        part.bnd_nnz = 0;
+
+        for(rocsparse_int i = part.row_begin; i < part.row_end; ++i)
+        {
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(col >= col_begin && col < col_end)
+                {
+                    ++part.int_nnz;
+                }
+                else
+                {
+                    ++part.bnd_nnz;
+                    halo.push_back(col);
+                }
+            }
+        }
+
+        std::sort(halo.begin(), halo.end());
+        halo.erase(std::unique(halo.begin(), halo.end()), halo.end());
+
+        part.halo_size = static_cast<rocsparse_int>(halo.size());
+
+        // Group the halo entries by owning partition ; the halo columns are
+        // sorted and the partitions own contiguous column ranges
+        part.halo_off.resize(ndevice + 1);
+
+        for(rocsparse_int q = 0; q < ndevice; ++q)
+        {
+            part.halo_off[q] = static_cast<rocsparse_int>(
+                std::lower_bound(halo.begin(), halo.end(), row_part[q]) - halo.begin());
+        }
+        part.halo_off[ndevice] = part.halo_size;
+
+        // Second pass to assemble the interior and boundary sub matrices,
+        // both zero based ; interior column indices are local to this
+        // partition, boundary column indices address the halo buffer
+        std::vector<rocsparse_int> hint_row_ptr(local_m + 1);
+        std::vector<rocsparse_int> hint_col_ind(part.int_nnz);
+        std::vector<T>             hint_val(part.int_nnz);
+        std::vector<rocsparse_int> hbnd_row_ptr(local_m + 1);
+        std::vector<rocsparse_int> hbnd_col_ind(part.bnd_nnz);
+        std::vector<T>             hbnd_val(part.bnd_nnz);
+
+        rocsparse_int int_idx = 0;
+        rocsparse_int bnd_idx = 0;
+
+        hint_row_ptr[0] = 0;
+        hbnd_row_ptr[0] = 0;
+
+        for(rocsparse_int i = part.row_begin; i < part.row_end; ++i)
+        {
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(col >= col_begin && col < col_end)
+                {
+                    hint_col_ind[int_idx] = col - col_begin;
+                    hint_val[int_idx]     = csr_val[j];
+                    ++int_idx;
+                }
+                else
+                {
+                    hbnd_col_ind[bnd_idx] = static_cast<rocsparse_int>(
+                        std::lower_bound(halo.begin(), halo.end(), col) - halo.begin());
+                    hbnd_val[bnd_idx] = csr_val[j];
+                    ++bnd_idx;
+                }
+            }
+
+            hint_row_ptr[i - part.row_begin + 1] = int_idx;
+            hbnd_row_ptr[i - part.row_begin + 1] = bnd_idx;
+        }
+
+        // Upload the partition to its owning device
+        RETURN_IF_HIP_ERROR(hipSetDevice(part.device));
+
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&part.int_row_ptr, sizeof(rocsparse_int) * (local_m + 1)));
+        RETURN_IF_HIP_ERROR(hipMemcpy(part.int_row_ptr,
+                                      hint_row_ptr.data(),
+                                      sizeof(rocsparse_int) * (local_m + 1),
+                                      hipMemcpyHostToDevice));
+
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&part.bnd_row_ptr, sizeof(rocsparse_int) * (local_m + 1)));
+        RETURN_IF_HIP_ERROR(hipMemcpy(part.bnd_row_ptr,
+                                      hbnd_row_ptr.data(),
+                                      sizeof(rocsparse_int) * (local_m + 1),
+                                      hipMemcpyHostToDevice));
+
+        if(part.int_nnz > 0)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMalloc((void**)&part.int_col_ind, sizeof(rocsparse_int) * part.int_nnz));
+            RETURN_IF_HIP_ERROR(hipMalloc(&part.int_val, sizeof(T) * part.int_nnz));
+            RETURN_IF_HIP_ERROR(hipMemcpy(part.int_col_ind,
+                                          hint_col_ind.data(),
+                                          sizeof(rocsparse_int) * part.int_nnz,
+                                          hipMemcpyHostToDevice));
+            RETURN_IF_HIP_ERROR(hipMemcpy(
+                part.int_val, hint_val.data(), sizeof(T) * part.int_nnz, hipMemcpyHostToDevice));
+        }
+
+        if(part.bnd_nnz > 0)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMalloc((void**)&part.bnd_col_ind, sizeof(rocsparse_int) * part.bnd_nnz));
+            RETURN_IF_HIP_ERROR(hipMalloc(&part.bnd_val, sizeof(T) * part.bnd_nnz));
+            RETURN_IF_HIP_ERROR(hipMemcpy(part.bnd_col_ind,
+                                          hbnd_col_ind.data(),
+                                          sizeof(rocsparse_int) * part.bnd_nnz,
+                                          hipMemcpyHostToDevice));
+            RETURN_IF_HIP_ERROR(hipMemcpy(
+                part.bnd_val, hbnd_val.data(), sizeof(T) * part.bnd_nnz, hipMemcpyHostToDevice));
+        }
+
+        if(part.halo_size > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMalloc(&part.halo_x, sizeof(T) * part.halo_size));
+        }
+
+        RETURN_IF_HIP_ERROR(hipStreamCreate(&part.comm_stream));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&part.x_ready, hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&part.halo_sent, hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&part.halo_done, hipEventDisableTiming));
+
+        part.gather_ind.resize(ndevice, nullptr);
+        part.gather_buf.resize(ndevice, nullptr);
+
+        // Gather maps and staging buffers, resident on the owning peer
+        // devices ; gather_ind[q] holds the local x indices this partition
+        // needs from partition q
+        for(rocsparse_int q = 0; q < ndevice; ++q)
+        {
+            rocsparse_int count = part.halo_off[q + 1] - part.halo_off[q];
+
+            if(count == 0)
+            {
+                continue;
+            }
+
+            std::vector<rocsparse_int> hgather(count);
+
+            for(rocsparse_int k = 0; k < count; ++k)
+            {
+                hgather[k] = halo[part.halo_off[q] + k] - row_part[q];
+            }
+
+            RETURN_IF_HIP_ERROR(hipSetDevice(handles[q]->device));
+
+            RETURN_IF_HIP_ERROR(
+                hipMalloc((void**)&part.gather_ind[q], sizeof(rocsparse_int) * count));
+            RETURN_IF_HIP_ERROR(hipMalloc(&part.gather_buf[q], sizeof(T) * count));
+            RETURN_IF_HIP_ERROR(hipMemcpy(part.gather_ind[q],
+                                          hgather.data(),
+                                          sizeof(rocsparse_int) * count,
+                                          hipMemcpyHostToDevice));
+
+            // Enable the direct peer copy from the owning device into the
+            // halo buffer of this partition
+            if(handles[q]->device != part.device)
+            {
+                hipError_t status = hipDeviceEnablePeerAccess(part.device, 0);
+
+                if(status != hipSuccess && status != hipErrorPeerAccessAlreadyEnabled)
+                {
+                    return rocsparse_status_internal_error;
+                }
+            }
+        }
+    }
+
+    RETURN_IF_HIP_ERROR(hipSetDevice(current_device));
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2DIST_HPP
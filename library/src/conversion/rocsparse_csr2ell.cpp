@@ -120,6 +120,8 @@ extern "C" rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          ha
     // Workspace size
     rocsparse_int nblocks = CSR2ELL_DIM;
 
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
     // Get workspace from handle device buffer
     rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(handle->buffer);
 
@@ -204,3 +206,53 @@ extern "C" rocsparse_status rocsparse_dcsr2ell(rocsparse_handle          handle,
                                               ell_val,
                                               ell_col_ind);
 }
+
+extern "C" rocsparse_status rocsparse_scsr2ell_fused(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     const rocsparse_mat_descr csr_descr,
+                                                     const float*              csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const rocsparse_mat_descr ell_descr,
+                                                     rocsparse_int             max_width,
+                                                     float*                    ell_val,
+                                                     rocsparse_int*            ell_col_ind,
+                                                     rocsparse_int*            ell_width)
+{
+    return rocsparse_csr2ell_fused_template<float>(handle,
+                                                   m,
+                                                   csr_descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   ell_descr,
+                                                   max_width,
+                                                   ell_val,
+                                                   ell_col_ind,
+                                                   ell_width);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2ell_fused(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     const rocsparse_mat_descr csr_descr,
+                                                     const double*             csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const rocsparse_mat_descr ell_descr,
+                                                     rocsparse_int             max_width,
+                                                     double*                   ell_val,
+                                                     rocsparse_int*            ell_col_ind,
+                                                     rocsparse_int*            ell_width)
+{
+    return rocsparse_csr2ell_fused_template<double>(handle,
+                                                    m,
+                                                    csr_descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    ell_descr,
+                                                    max_width,
+                                                    ell_val,
+                                                    ell_col_ind,
+                                                    ell_width);
+}
@@ -147,6 +147,7 @@ rocsparse_status rocsparse_csr2ell_template(rocsparse_handle          handle,
                        csr_col_ind,
                        csr_descr->base,
                        ell_width,
+                       ell_get_pitch(ell_descr, m),
                        ell_col_ind,
                        ell_val,
                        ell_descr->base);
@@ -154,4 +155,200 @@ rocsparse_status rocsparse_csr2ell_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csr2ell_fused_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  const rocsparse_mat_descr ell_descr,
+                                                  rocsparse_int             max_width,
+                                                  T*                        ell_val,
+                                                  rocsparse_int*            ell_col_ind,
+                                                  rocsparse_int*            ell_width)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2ell_fused"),
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)ell_descr,
+              max_width,
+              (const void*&)ell_val,
+              (const void*&)ell_col_ind,
+              (const void*&)ell_width);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csr2ell_fused -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(ell_descr->base != rocsparse_index_base_zero && ell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(ell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || max_width < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || max_width == 0)
+    {
+        if(ell_width == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(ell_width, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *ell_width = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_width == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Determine ELL width on device, keeping the result in the handle
+    // workspace such that the conversion can consume it without a host
+    // round-trip
+
+#define CSR2ELL_DIM 256
+    // Workspace size
+    rocsparse_int nblocks = CSR2ELL_DIM;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    // Get workspace from handle device buffer
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(handle->buffer);
+
+    dim3 csr2ell_width_blocks(nblocks);
+    dim3 csr2ell_width_threads(CSR2ELL_DIM);
+
+    // Compute maximum nnz per row
+    hipLaunchKernelGGL((ell_width_kernel_part1<CSR2ELL_DIM>),
+                       csr2ell_width_blocks,
+                       csr2ell_width_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       workspace);
+
+    hipLaunchKernelGGL((ell_width_kernel_part2<CSR2ELL_DIM>),
+                       dim3(1),
+                       csr2ell_width_threads,
+                       0,
+                       stream,
+                       nblocks,
+                       workspace);
+
+    // Cap the width against the user supplied maximum
+    hipLaunchKernelGGL(
+        (ell_width_clamp_kernel), dim3(1), dim3(1), 0, stream, max_width, workspace);
+#undef CSR2ELL_DIM
+
+    // Convert, reading the width from the workspace
+
+#define CSR2ELL_DIM 512
+    dim3 csr2ell_blocks((m - 1) / CSR2ELL_DIM + 1);
+    dim3 csr2ell_threads(CSR2ELL_DIM);
+
+    hipLaunchKernelGGL((csr2ell_fused_kernel<T>),
+                       csr2ell_blocks,
+                       csr2ell_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       workspace,
+                       ell_get_pitch(ell_descr, m),
+                       ell_col_ind,
+                       ell_val,
+                       ell_descr->base);
+#undef CSR2ELL_DIM
+
+    // Copy ELL width back to host, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            ell_width, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(ell_width, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    }
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSR2ELL_HPP
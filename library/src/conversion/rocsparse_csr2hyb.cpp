@@ -53,6 +53,16 @@ extern "C" rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
                                       partition_type);
 }
 
+extern "C" rocsparse_status rocsparse_scsr2hyb_update(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float*              csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      rocsparse_hyb_mat         hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, m, descr, csr_val, csr_row_ptr, hyb);
+}
+
 extern "C" rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
                                                rocsparse_int             m,
                                                rocsparse_int             n,
@@ -75,3 +85,13 @@ extern "C" rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
                                       user_ell_width,
                                       partition_type);
 }
+
+extern "C" rocsparse_status rocsparse_dcsr2hyb_update(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double*             csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      rocsparse_hyb_mat         hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, m, descr, csr_val, csr_row_ptr, hyb);
+}
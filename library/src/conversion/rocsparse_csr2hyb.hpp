@@ -34,6 +34,7 @@
 
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
+#include <vector>
 
 template <typename T>
 rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
@@ -173,6 +174,11 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     {
         RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
     }
+    if(hyb->ell_row_nnz)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_row_nnz));
+        hyb->ell_row_nnz = nullptr;
+    }
     if(hyb->coo_row_ind)
     {
         RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
@@ -185,6 +191,11 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     {
         RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
     }
+    if(hyb->coo_row_offset)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_offset));
+        hyb->coo_row_offset = nullptr;
+    }
 
     // Determine ELL width
 
@@ -199,14 +210,77 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     }
     else if(partition_type == rocsparse_hyb_partition_auto)
     {
-        // ELL width determined by average nnz per row
-        hyb->ell_width = (csr_nnz - 1) / m + 1;
+        // ELL width determined by the row length distribution. Build a
+        // histogram of the per row non-zeros and pick the width that
+        // minimizes the predicted hybmv cost, where ELL entries account
+        // for the zero padded storage and COO entries are penalized for
+        // their atomic updates and irregular access pattern
+
+        // Allocate histogram
+        rocsparse_int* dhist = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->buffer_alloc(sizeof(rocsparse_int) * (max_row_nnz + 1), (void**)&dhist));
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(dhist, 0, sizeof(rocsparse_int) * (max_row_nnz + 1), stream));
+
+        hipLaunchKernelGGL((hyb_row_histogram),
+                           dim3(blocks),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           max_row_nnz,
+                           csr_row_ptr,
+                           dhist);
+
+        // Copy histogram to host, its size is bounded by twice the average
+        // row length
+        std::vector<rocsparse_int> hist(max_row_nnz + 1);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hist.data(),
+                                           dhist,
+                                           sizeof(rocsparse_int) * (max_row_nnz + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(dhist));
+
+        // For each width candidate w, the ELL part stores min(row_nnz, w)
+        // entries per row plus padding up to w, the remaining
+        // csr_nnz - ell_filled entries spill into the COO part
+        rocsparse_int rows_longer = m - hist[0];
+        rocsparse_int ell_filled  = 0;
+
+        double best_cost = 0.0;
+
+        for(rocsparse_int w = 0; w <= max_row_nnz; ++w)
+        {
+            if(w > 0)
+            {
+                ell_filled += rows_longer;
+                rows_longer -= hist[w];
+            }
+
+            // A COO entry is roughly four times as expensive as an ELL
+            // entry in hybmv
+            double cost = static_cast<double>(m) * w
+                          + 4.0 * static_cast<double>(csr_nnz - ell_filled);
+
+            if(w == 0 || cost < best_cost)
+            {
+                best_cost      = cost;
+                hyb->ell_width = w;
+            }
+        }
     }
     else
     {
         // Allocate workspace
         rocsparse_int* workspace = nullptr;
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * blocks));
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->buffer_alloc(sizeof(rocsparse_int) * blocks, (void**)&workspace));
 
         // HYB == ELL - no COO part - compute maximum nnz per row
         hipLaunchKernelGGL((ell_width_kernel_part1<CSR2ELL_DIM>),
@@ -232,7 +306,7 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         // Wait for host transfer to finish
         RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-        RETURN_IF_HIP_ERROR(hipFree(workspace));
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(workspace));
     }
 
     // Re-check ELL width
@@ -250,11 +324,26 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         RETURN_IF_HIP_ERROR(
             hipMalloc((void**)&hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz));
         RETURN_IF_HIP_ERROR(hipMalloc(&hyb->ell_val, sizeof(T) * hyb->ell_nnz));
+
+        // ELL-R row length array, such that the SpMV kernels stop at the
+        // actual row length instead of sweeping ell_width padded entries
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&hyb->ell_row_nnz, sizeof(rocsparse_int) * m));
+
+        hipLaunchKernelGGL((hyb_ell_row_nnz),
+                           dim3(blocks),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           hyb->ell_width,
+                           csr_row_ptr,
+                           hyb->ell_row_nnz);
     }
 
     // Allocate workspace
     rocsparse_int* workspace = NULL;
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * (m + 1), (void**)&workspace));
 
     // If there is a COO part, compute the COO non-zero elements per row
     if(partition_type != rocsparse_hyb_partition_max)
@@ -296,7 +385,7 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                                                         stream));
 
             // Allocate rocprim buffer
-            RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(temp_storage_bytes, &d_temp_storage));
 
             // Do inclusive sum
             RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
@@ -308,7 +397,7 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                                                         stream));
 
             // Clear rocprim buffer
-            RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_temp_storage));
 
             // Obtain coo nnz from workspace
             RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hyb->coo_nnz,
@@ -332,6 +421,17 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         RETURN_IF_HIP_ERROR(
             hipMalloc((void**)&hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
         RETURN_IF_HIP_ERROR(hipMalloc(&hyb->coo_val, sizeof(T) * hyb->coo_nnz));
+
+        // Keep a copy of the per row COO write offsets, such that subsequent
+        // rocsparse_csr2hyb_update() calls can rewrite the numeric values
+        // without re-running the partitioning
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&hyb->coo_row_offset, sizeof(rocsparse_int) * (m + 1)));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hyb->coo_row_offset,
+                                           workspace,
+                                           sizeof(rocsparse_int) * (m + 1),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     dim3 csr2ell_blocks((m - 1) / CSR2ELL_DIM + 1);
@@ -355,10 +455,116 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                        workspace,
                        descr->base);
 
-    RETURN_IF_HIP_ERROR(hipFree(workspace));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(workspace));
 #undef CSR2ELL_DIM
 
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_update_template(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   rocsparse_hyb_mat         hyb)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2hyb_update"),
+              m,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)hyb);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes; the HYB matrix must have been built from a CSR matrix of
+    // the same dimension
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(hyb->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || (hyb->ell_nnz == 0 && hyb->coo_nnz == 0))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The HYB matrix must carry its value arrays and the cached COO write
+    // offsets of the conversion
+    if(hyb->ell_nnz > 0 && hyb->ell_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hyb->coo_nnz > 0 && (hyb->coo_val == nullptr || hyb->coo_row_offset == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSR2HYB_UPDATE_DIM 512
+    dim3 csr2hyb_blocks((m - 1) / CSR2HYB_UPDATE_DIM + 1);
+    dim3 csr2hyb_threads(CSR2HYB_UPDATE_DIM);
+
+    hipLaunchKernelGGL((csr2hyb_update_kernel<T>),
+                       csr2hyb_blocks,
+                       csr2hyb_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       hyb->ell_width,
+                       (T*)hyb->ell_val,
+                       (T*)hyb->coo_val,
+                       hyb->coo_row_offset,
+                       descr->base);
+#undef CSR2HYB_UPDATE_DIM
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSR2HYB_HPP
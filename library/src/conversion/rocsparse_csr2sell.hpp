@@ -0,0 +1,344 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2SELL_HPP
+#define ROCSPARSE_CSR2SELL_HPP
+
+#include "csr2sell_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+__global__ void csr2sell_row_length_kernel(rocsparse_int m,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           rocsparse_int* __restrict__ row_length,
+                                           rocsparse_int* __restrict__ perm)
+{
+    csr2sell_row_length_device(m, csr_row_ptr, row_length, perm);
+}
+
+__global__ void csr2sell_window_offsets_kernel(rocsparse_int num_windows,
+                                               rocsparse_int m,
+                                               rocsparse_int sigma,
+                                               rocsparse_int* __restrict__ offsets)
+{
+    csr2sell_window_offsets_device(num_windows, m, sigma, offsets);
+}
+
+__global__ void csr2sell_slice_width_kernel(rocsparse_int num_slices,
+                                            rocsparse_int m,
+                                            rocsparse_int slice_height,
+                                            const rocsparse_int* __restrict__ row_length,
+                                            rocsparse_int* __restrict__ slice_ptr)
+{
+    csr2sell_slice_width_device(num_slices, m, slice_height, row_length, slice_ptr);
+}
+
+template <typename T>
+__global__ void csr2sell_fill_kernel(rocsparse_int num_slices,
+                                     rocsparse_int m,
+                                     rocsparse_int slice_height,
+                                     const T* __restrict__ csr_val,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const rocsparse_int* __restrict__ slice_ptr,
+                                     const rocsparse_int* __restrict__ perm,
+                                     rocsparse_int* __restrict__ sell_col_ind,
+                                     T* __restrict__ sell_val,
+                                     rocsparse_index_base idx_base)
+{
+    csr2sell_fill_device<T>(num_slices,
+                            m,
+                            slice_height,
+                            csr_val,
+                            csr_row_ptr,
+                            csr_col_ind,
+                            slice_ptr,
+                            perm,
+                            sell_col_ind,
+                            sell_val,
+                            idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2sell_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int             sigma,
+                                             rocsparse_sell_mat        sell)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2sell"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              sigma,
+              (const void*&)sell);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(sigma <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The slice height is matched to the device wavefront size, such that one
+    // wavefront processes one slice without LDS communication
+    rocsparse_int slice_height = handle->wavefront_size;
+    rocsparse_int num_slices   = (m - 1) / slice_height + 1;
+    rocsparse_int num_windows  = (m - 1) / sigma + 1;
+
+    sell->m            = m;
+    sell->n            = n;
+    sell->slice_height = slice_height;
+    sell->sigma        = sigma;
+    sell->num_slices   = num_slices;
+
+    // Allocate slice pointer and permutation arrays
+    if(sell->slice_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->slice_ptr));
+    }
+    if(sell->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->perm));
+    }
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&sell->slice_ptr, sizeof(rocsparse_int) * (num_slices + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&sell->perm, sizeof(rocsparse_int) * m));
+
+    // Temporary storage for row lengths and sort segments
+    rocsparse_int* row_length = nullptr;
+    rocsparse_int* offsets    = nullptr;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * m, (void**)&row_length));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * (num_windows + 1), (void**)&offsets));
+
+#define CSR2SELL_DIM 256
+    // Row lengths and identity permutation
+    hipLaunchKernelGGL(csr2sell_row_length_kernel,
+                       dim3((m - 1) / CSR2SELL_DIM + 1),
+                       dim3(CSR2SELL_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       row_length,
+                       sell->perm);
+
+    // Sort segment offsets
+    hipLaunchKernelGGL(csr2sell_window_offsets_kernel,
+                       dim3(num_windows / CSR2SELL_DIM + 1),
+                       dim3(CSR2SELL_DIM),
+                       0,
+                       stream,
+                       num_windows,
+                       m,
+                       sigma,
+                       offsets);
+
+    // Sort the rows by descending length within each sigma window
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(nullptr,
+                                                                 rocprim_size,
+                                                                 row_length,
+                                                                 row_length,
+                                                                 sell->perm,
+                                                                 sell->perm,
+                                                                 m,
+                                                                 num_windows,
+                                                                 offsets,
+                                                                 offsets + 1,
+                                                                 0,
+                                                                 32,
+                                                                 stream));
+
+    void* rocprim_buffer = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(rocprim_size, &rocprim_buffer));
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(rocprim_buffer,
+                                                                 rocprim_size,
+                                                                 row_length,
+                                                                 row_length,
+                                                                 sell->perm,
+                                                                 sell->perm,
+                                                                 m,
+                                                                 num_windows,
+                                                                 offsets,
+                                                                 offsets + 1,
+                                                                 0,
+                                                                 32,
+                                                                 stream));
+
+    // Compute the slice widths
+    hipLaunchKernelGGL(csr2sell_slice_width_kernel,
+                       dim3((num_slices - 1) / CSR2SELL_DIM + 1),
+                       dim3(CSR2SELL_DIM),
+                       0,
+                       stream,
+                       num_slices,
+                       m,
+                       slice_height,
+                       row_length,
+                       sell->slice_ptr);
+
+    // Inclusive scan to obtain the slice pointer array
+    size_t rocprim_scan_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_scan_size,
+                                                sell->slice_ptr,
+                                                sell->slice_ptr,
+                                                num_slices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    if(rocprim_scan_size > rocprim_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(rocprim_buffer));
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(rocprim_scan_size, &rocprim_buffer));
+    }
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_scan_size,
+                                                sell->slice_ptr,
+                                                sell->slice_ptr,
+                                                num_slices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(rocprim_buffer));
+
+    // Obtain the number of stored elements, including padding
+    rocsparse_int nnz;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nnz, sell->slice_ptr + num_slices, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    sell->nnz = nnz;
+
+    // Allocate SELL column indices and values
+    if(sell->sell_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->sell_col_ind));
+    }
+    if(sell->sell_val != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(sell->sell_val));
+    }
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&sell->sell_col_ind, sizeof(rocsparse_int) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc(&sell->sell_val, sizeof(T) * nnz));
+
+    // Fill the SELL structure
+    hipLaunchKernelGGL(csr2sell_fill_kernel<T>,
+                       dim3((num_slices * slice_height - 1) / CSR2SELL_DIM + 1),
+                       dim3(CSR2SELL_DIM),
+                       0,
+                       stream,
+                       num_slices,
+                       m,
+                       slice_height,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       sell->slice_ptr,
+                       sell->perm,
+                       sell->sell_col_ind,
+                       reinterpret_cast<T*>(sell->sell_val),
+                       descr->base);
+#undef CSR2SELL_DIM
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(offsets));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(row_length));
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2SELL_HPP
@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2SPLIT_HPP
+#define ROCSPARSE_CSR2SPLIT_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <cstring>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+template <typename T>
+rocsparse_status rocsparse_csr2split_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_split_mat       split)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(split == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2split"),
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)split);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        split->device    = handle->device;
+        split->m         = m;
+        split->n         = n;
+        split->nnz       = nnz;
+        split->split_row = m;
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_index_base base = descr->base;
+
+    split->device     = handle->device;
+    split->m          = m;
+    split->n          = n;
+    split->nnz        = nnz;
+    split->descr.type = rocsparse_matrix_type_general;
+    split->descr.base = rocsparse_index_base_zero;
+
+    // Size budget of the device partition ; keep room for x, y and the
+    // staging copies of other routines, and an eighth of free memory as
+    // headroom for allocations outside of the matrix
+    size_t free_mem;
+    size_t total_mem;
+
+    RETURN_IF_HIP_ERROR(hipMemGetInfo(&free_mem, &total_mem));
+
+    size_t reserve = sizeof(T) * (static_cast<size_t>(m) + n) + free_mem / 8;
+    size_t budget  = (free_mem > reserve) ? free_mem - reserve : 0;
+
+    // Largest leading row range whose CSR arrays fit the budget ; the
+    // required bytes grow monotonically with the row count
+    rocsparse_int lo = 0;
+    rocsparse_int hi = m;
+
+    while(lo < hi)
+    {
+        rocsparse_int mid = lo + (hi - lo + 1) / 2;
+
+        size_t bytes = sizeof(rocsparse_int) * (mid + 1)
+                       + (sizeof(rocsparse_int) + sizeof(T))
+                             * static_cast<size_t>(csr_row_ptr[mid] - base);
+
+        if(bytes <= budget)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    split->split_row = lo;
+    split->dev_nnz   = csr_row_ptr[lo] - base;
+    split->host_nnz  = nnz - split->dev_nnz;
+
+    rocsparse_int host_m = m - split->split_row;
+
+    // Upload the device partition, zero based
+    if(split->split_row > 0)
+    {
+        std::vector<rocsparse_int> hdev_row_ptr(split->split_row + 1);
+
+        for(rocsparse_int i = 0; i <= split->split_row; ++i)
+        {
+            hdev_row_ptr[i] = csr_row_ptr[i] - base;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&split->dev_row_ptr,
+                                      sizeof(rocsparse_int) * (split->split_row + 1)));
+        RETURN_IF_HIP_ERROR(hipMemcpy(split->dev_row_ptr,
+                                      hdev_row_ptr.data(),
+                                      sizeof(rocsparse_int) * (split->split_row + 1),
+                                      hipMemcpyHostToDevice));
+
+        if(split->dev_nnz > 0)
+        {
+            std::vector<rocsparse_int> hdev_col_ind(split->dev_nnz);
+
+            for(rocsparse_int j = 0; j < split->dev_nnz; ++j)
+            {
+                hdev_col_ind[j] = csr_col_ind[j] - base;
+            }
+
+            RETURN_IF_HIP_ERROR(
+                hipMalloc((void**)&split->dev_col_ind, sizeof(rocsparse_int) * split->dev_nnz));
+            RETURN_IF_HIP_ERROR(hipMalloc(&split->dev_val, sizeof(T) * split->dev_nnz));
+            RETURN_IF_HIP_ERROR(hipMemcpy(split->dev_col_ind,
+                                          hdev_col_ind.data(),
+                                          sizeof(rocsparse_int) * split->dev_nnz,
+                                          hipMemcpyHostToDevice));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(split->dev_val, csr_val, sizeof(T) * split->dev_nnz, hipMemcpyHostToDevice));
+        }
+    }
+
+    // Keep the host partition in pinned memory, zero based with rebased
+    // row pointers, and set up the staging buffers for splitmv
+    if(host_m > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipHostMalloc((void**)&split->host_row_ptr, sizeof(rocsparse_int) * (host_m + 1)));
+
+        for(rocsparse_int i = 0; i <= host_m; ++i)
+        {
+            split->host_row_ptr[i] = csr_row_ptr[split->split_row + i] - base - split->dev_nnz;
+        }
+
+        if(split->host_nnz > 0)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipHostMalloc((void**)&split->host_col_ind, sizeof(rocsparse_int) * split->host_nnz));
+            RETURN_IF_HIP_ERROR(hipHostMalloc(&split->host_val, sizeof(T) * split->host_nnz));
+
+            for(rocsparse_int j = 0; j < split->host_nnz; ++j)
+            {
+                split->host_col_ind[j] = csr_col_ind[split->dev_nnz + j] - base;
+            }
+
+            memcpy(split->host_val, csr_val + split->dev_nnz, sizeof(T) * split->host_nnz);
+        }
+
+        RETURN_IF_HIP_ERROR(hipHostMalloc(&split->host_x, sizeof(T) * n));
+        RETURN_IF_HIP_ERROR(hipHostMalloc(&split->host_y, sizeof(T) * host_m));
+
+        RETURN_IF_HIP_ERROR(hipStreamCreate(&split->stage_stream));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&split->x_ready, hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&split->y_merged, hipEventDisableTiming));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2SPLIT_HPP
@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_csr_builder.hpp"
+
+#include "rocsparse.h"
+
+extern "C" rocsparse_status rocsparse_csr_builder_size(rocsparse_handle      handle,
+                                                       rocsparse_csr_builder builder,
+                                                       rocsparse_int*        m,
+                                                       rocsparse_int*        n,
+                                                       rocsparse_int*        nnz)
+{
+    // Check for valid handle and builder
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(builder == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr_builder_size",
+              (const void*&)builder,
+              (const void*&)m,
+              (const void*&)n,
+              (const void*&)nnz);
+
+    // Check pointer arguments
+    if(m == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(n == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The builder meta data is host resident, copy it over if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(m, &builder->m, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(n, &builder->n, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz, &builder->nnz, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+    }
+    else
+    {
+        *m   = builder->m;
+        *n   = builder->n;
+        *nnz = builder->nnz;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr_builder_append(rocsparse_handle      handle,
+                                                          rocsparse_csr_builder builder,
+                                                          rocsparse_int         nrows,
+                                                          rocsparse_int         ncols,
+                                                          rocsparse_int         nnz,
+                                                          const float*          csr_val,
+                                                          const rocsparse_int*  csr_row_ptr,
+                                                          const rocsparse_int*  csr_col_ind,
+                                                          rocsparse_index_base  idx_base)
+{
+    return rocsparse_csr_builder_append_template<float>(
+        handle, builder, nrows, ncols, nnz, csr_val, csr_row_ptr, csr_col_ind, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr_builder_append(rocsparse_handle      handle,
+                                                          rocsparse_csr_builder builder,
+                                                          rocsparse_int         nrows,
+                                                          rocsparse_int         ncols,
+                                                          rocsparse_int         nnz,
+                                                          const double*         csr_val,
+                                                          const rocsparse_int*  csr_row_ptr,
+                                                          const rocsparse_int*  csr_col_ind,
+                                                          rocsparse_index_base  idx_base)
+{
+    return rocsparse_csr_builder_append_template<double>(
+        handle, builder, nrows, ncols, nnz, csr_val, csr_row_ptr, csr_col_ind, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_scsr_builder_finalize(rocsparse_handle      handle,
+                                                            rocsparse_csr_builder builder,
+                                                            float*                csr_val,
+                                                            rocsparse_int*        csr_row_ptr,
+                                                            rocsparse_int*        csr_col_ind,
+                                                            rocsparse_index_base  idx_base)
+{
+    return rocsparse_csr_builder_finalize_template<float>(
+        handle, builder, csr_val, csr_row_ptr, csr_col_ind, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr_builder_finalize(rocsparse_handle      handle,
+                                                            rocsparse_csr_builder builder,
+                                                            double*               csr_val,
+                                                            rocsparse_int*        csr_row_ptr,
+                                                            rocsparse_int*        csr_col_ind,
+                                                            rocsparse_index_base  idx_base)
+{
+    return rocsparse_csr_builder_finalize_template<double>(
+        handle, builder, csr_val, csr_row_ptr, csr_col_ind, idx_base);
+}
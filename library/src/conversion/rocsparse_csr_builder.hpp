@@ -0,0 +1,373 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR_BUILDER_HPP
+#define ROCSPARSE_CSR_BUILDER_HPP
+
+#include "csr_builder_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csr_builder_append_template(rocsparse_handle      handle,
+                                                       rocsparse_csr_builder builder,
+                                                       rocsparse_int         nrows,
+                                                       rocsparse_int         ncols,
+                                                       rocsparse_int         nnz,
+                                                       const T*              csr_val,
+                                                       const rocsparse_int*  csr_row_ptr,
+                                                       const rocsparse_int*  csr_col_ind,
+                                                       rocsparse_index_base  idx_base)
+{
+    // Check for valid handle and builder
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(builder == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr_builder_append"),
+              (const void*&)builder,
+              nrows,
+              ncols,
+              nnz,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nrows < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ncols < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The value precision is fixed by the first append
+    if(builder->val_size == 0)
+    {
+        builder->val_size = sizeof(T);
+    }
+    else if(builder->val_size != sizeof(T))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // The matrix grows downwards, the column count to the widest batch
+    if(ncols > builder->n)
+    {
+        builder->n = ncols;
+    }
+
+    // Quick return if possible
+    if(nrows == 0 && nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz != 0 && csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Grow the COO storage geometrically, such that the copies amortize
+    // over the appends
+    if(builder->nnz + nnz > builder->nnz_capacity)
+    {
+        rocsparse_int capacity = builder->nnz_capacity > 0 ? builder->nnz_capacity : 1;
+
+        while(capacity < builder->nnz + nnz)
+        {
+            capacity *= 2;
+        }
+
+        rocsparse_int* coo_row_ind;
+        rocsparse_int* coo_col_ind;
+        T*             coo_val;
+
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * capacity));
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * capacity));
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&coo_val, sizeof(T) * capacity));
+
+        if(builder->nnz > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(coo_row_ind,
+                                               builder->coo_row_ind,
+                                               sizeof(rocsparse_int) * builder->nnz,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(coo_col_ind,
+                                               builder->coo_col_ind,
+                                               sizeof(rocsparse_int) * builder->nnz,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(coo_val,
+                                               builder->coo_val,
+                                               sizeof(T) * builder->nnz,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        // hipFree synchronizes the device, the copies out of the old
+        // storage have completed before it is released
+        if(builder->coo_row_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(builder->coo_row_ind));
+        }
+        if(builder->coo_col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(builder->coo_col_ind));
+        }
+        if(builder->coo_val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(builder->coo_val));
+        }
+
+        builder->coo_row_ind  = coo_row_ind;
+        builder->coo_col_ind  = coo_col_ind;
+        builder->coo_val      = coo_val;
+        builder->nnz_capacity = capacity;
+    }
+
+    // Expand the batch into the COO tail, the kernel performs no cross
+    // lane operations such that the sub wavefront size needs no dispatch
+    // on the hardware wavefront size
+    if(nnz > 0)
+    {
+#define CSR_BUILDER_DIM 512
+        rocsparse_int nnz_per_row = nnz / nrows;
+
+        dim3 csr_builder_blocks((nrows - 1) / CSR_BUILDER_DIM + 1);
+        dim3 csr_builder_threads(CSR_BUILDER_DIM);
+
+        if(nnz_per_row < 8)
+        {
+            hipLaunchKernelGGL((csr_builder_append_kernel<T, 4>),
+                               csr_builder_blocks,
+                               csr_builder_threads,
+                               0,
+                               stream,
+                               nrows,
+                               builder->m,
+                               builder->nnz,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               idx_base,
+                               builder->coo_row_ind,
+                               builder->coo_col_ind,
+                               (T*)builder->coo_val);
+        }
+        else if(nnz_per_row < 32)
+        {
+            hipLaunchKernelGGL((csr_builder_append_kernel<T, 16>),
+                               csr_builder_blocks,
+                               csr_builder_threads,
+                               0,
+                               stream,
+                               nrows,
+                               builder->m,
+                               builder->nnz,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               idx_base,
+                               builder->coo_row_ind,
+                               builder->coo_col_ind,
+                               (T*)builder->coo_val);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csr_builder_append_kernel<T, 64>),
+                               csr_builder_blocks,
+                               csr_builder_threads,
+                               0,
+                               stream,
+                               nrows,
+                               builder->m,
+                               builder->nnz,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               idx_base,
+                               builder->coo_row_ind,
+                               builder->coo_col_ind,
+                               (T*)builder->coo_val);
+        }
+#undef CSR_BUILDER_DIM
+    }
+
+    builder->m += nrows;
+    builder->nnz += nnz;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr_builder_finalize_template(rocsparse_handle      handle,
+                                                         rocsparse_csr_builder builder,
+                                                         T*                    csr_val,
+                                                         rocsparse_int*        csr_row_ptr,
+                                                         rocsparse_int*        csr_col_ind,
+                                                         rocsparse_index_base  idx_base)
+{
+    // Check for valid handle and builder
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(builder == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr_builder_finalize"),
+              (const void*&)builder,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check value precision
+    if(builder->val_size != 0 && builder->val_size != sizeof(T))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(builder->m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(builder->nnz != 0 && csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(builder->nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The appended rows arrive in order, such that the COO storage is row
+    // sorted by construction and the row pointers follow from the coo2csr
+    // machinery
+    if(builder->nnz > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo2csr(handle,
+                                                    builder->coo_row_ind,
+                                                    builder->nnz,
+                                                    builder->m,
+                                                    csr_row_ptr,
+                                                    rocsparse_index_base_zero));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(csr_row_ptr, 0, sizeof(rocsparse_int) * (builder->m + 1), stream));
+    }
+
+#define CSR_BUILDER_DIM 512
+    if(idx_base == rocsparse_index_base_one)
+    {
+        hipLaunchKernelGGL((csr_builder_shift_base_kernel),
+                           dim3(builder->m / CSR_BUILDER_DIM + 1),
+                           dim3(CSR_BUILDER_DIM),
+                           0,
+                           stream,
+                           builder->m + 1,
+                           csr_row_ptr);
+    }
+
+    // Compact the column indices and values
+    if(builder->nnz > 0)
+    {
+        hipLaunchKernelGGL((csr_builder_finalize_kernel<T>),
+                           dim3((builder->nnz - 1) / CSR_BUILDER_DIM + 1),
+                           dim3(CSR_BUILDER_DIM),
+                           0,
+                           stream,
+                           builder->nnz,
+                           builder->coo_col_ind,
+                           (const T*)builder->coo_val,
+                           idx_base,
+                           csr_col_ind,
+                           csr_val);
+    }
+#undef CSR_BUILDER_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR_BUILDER_HPP
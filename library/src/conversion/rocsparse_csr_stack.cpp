@@ -0,0 +1,97 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csr_stack.hpp"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsr_stack(rocsparse_handle            handle,
+                                                 rocsparse_int               nbatch,
+                                                 const rocsparse_int*        m,
+                                                 const rocsparse_int*        n,
+                                                 const rocsparse_int*        nnz,
+                                                 const rocsparse_mat_descr   descr,
+                                                 const float* const*         csr_val,
+                                                 const rocsparse_int* const* csr_row_ptr,
+                                                 const rocsparse_int* const* csr_col_ind,
+                                                 float*                      stacked_val,
+                                                 rocsparse_int*              stacked_row_ptr,
+                                                 rocsparse_int*              stacked_col_ind,
+                                                 rocsparse_int*              row_offset,
+                                                 rocsparse_int*              col_offset,
+                                                 rocsparse_int*              nnz_offset)
+{
+    return rocsparse_csr_stack_template<float>(handle,
+                                               nbatch,
+                                               m,
+                                               n,
+                                               nnz,
+                                               descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               stacked_val,
+                                               stacked_row_ptr,
+                                               stacked_col_ind,
+                                               row_offset,
+                                               col_offset,
+                                               nnz_offset);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr_stack(rocsparse_handle            handle,
+                                                 rocsparse_int               nbatch,
+                                                 const rocsparse_int*        m,
+                                                 const rocsparse_int*        n,
+                                                 const rocsparse_int*        nnz,
+                                                 const rocsparse_mat_descr   descr,
+                                                 const double* const*        csr_val,
+                                                 const rocsparse_int* const* csr_row_ptr,
+                                                 const rocsparse_int* const* csr_col_ind,
+                                                 double*                     stacked_val,
+                                                 rocsparse_int*              stacked_row_ptr,
+                                                 rocsparse_int*              stacked_col_ind,
+                                                 rocsparse_int*              row_offset,
+                                                 rocsparse_int*              col_offset,
+                                                 rocsparse_int*              nnz_offset)
+{
+    return rocsparse_csr_stack_template<double>(handle,
+                                                nbatch,
+                                                m,
+                                                n,
+                                                nnz,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                stacked_val,
+                                                stacked_row_ptr,
+                                                stacked_col_ind,
+                                                row_offset,
+                                                col_offset,
+                                                nnz_offset);
+}
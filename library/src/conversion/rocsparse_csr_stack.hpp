@@ -0,0 +1,270 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR_STACK_HPP
+#define ROCSPARSE_CSR_STACK_HPP
+
+#include "csr_stack_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <cstring>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+template <typename T>
+rocsparse_status rocsparse_csr_stack_template(rocsparse_handle            handle,
+                                              rocsparse_int               nbatch,
+                                              const rocsparse_int*        m,
+                                              const rocsparse_int*        n,
+                                              const rocsparse_int*        nnz,
+                                              const rocsparse_mat_descr   descr,
+                                              const T* const*             csr_val,
+                                              const rocsparse_int* const* csr_row_ptr,
+                                              const rocsparse_int* const* csr_col_ind,
+                                              T*                          stacked_val,
+                                              rocsparse_int*              stacked_row_ptr,
+                                              rocsparse_int*              stacked_col_ind,
+                                              rocsparse_int*              row_offset,
+                                              rocsparse_int*              col_offset,
+                                              rocsparse_int*              nnz_offset)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr_stack"),
+              nbatch,
+              (const void*&)m,
+              (const void*&)n,
+              (const void*&)nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)stacked_val,
+              (const void*&)stacked_row_ptr,
+              (const void*&)stacked_col_ind);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check size
+    if(nbatch < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nbatch == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(m == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(n == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(stacked_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(stacked_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(stacked_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(row_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(col_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check the block sizes and compute the offset bookkeeping. The offsets
+    // are zero based positions in the stacked matrix, independent of the
+    // index base
+    row_offset[0] = 0;
+    col_offset[0] = 0;
+    nnz_offset[0] = 0;
+
+    for(rocsparse_int batch = 0; batch < nbatch; ++batch)
+    {
+        if(m[batch] < 0 || n[batch] < 0 || nnz[batch] < 0)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        if(m[batch] > 0 && csr_row_ptr[batch] == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        if(nnz[batch] > 0 && (csr_val[batch] == nullptr || csr_col_ind[batch] == nullptr))
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        row_offset[batch + 1] = row_offset[batch] + m[batch];
+        col_offset[batch + 1] = col_offset[batch] + n[batch];
+        nnz_offset[batch + 1] = nnz_offset[batch] + nnz[batch];
+    }
+
+    rocsparse_int total_m   = row_offset[nbatch];
+    rocsparse_int total_nnz = nnz_offset[nbatch];
+
+    // Quick return if possible
+    if(total_m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Stage the per block device pointers and the offset bookkeeping in
+    // device memory, such that a single kernel launch covers all blocks.
+    // The pointer arrays are placed in front to keep them aligned
+    size_t ptr_bytes    = sizeof(void*) * nbatch;
+    size_t offset_bytes = sizeof(rocsparse_int) * (nbatch + 1);
+
+    std::vector<char> hstaging(3 * ptr_bytes + 3 * offset_bytes);
+
+    char* hptr = hstaging.data();
+
+    memcpy(hptr, csr_val, ptr_bytes);
+    memcpy(hptr + ptr_bytes, csr_row_ptr, ptr_bytes);
+    memcpy(hptr + 2 * ptr_bytes, csr_col_ind, ptr_bytes);
+    memcpy(hptr + 3 * ptr_bytes, row_offset, offset_bytes);
+    memcpy(hptr + 3 * ptr_bytes + offset_bytes, col_offset, offset_bytes);
+    memcpy(hptr + 3 * ptr_bytes + 2 * offset_bytes, nnz_offset, offset_bytes);
+
+    char* dstaging = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(hstaging.size(), (void**)&dstaging));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(dstaging, hstaging.data(), hstaging.size(), hipMemcpyHostToDevice));
+
+    const T* const*             d_val     = reinterpret_cast<const T* const*>(dstaging);
+    const rocsparse_int* const* d_row_ptr
+        = reinterpret_cast<const rocsparse_int* const*>(dstaging + ptr_bytes);
+    const rocsparse_int* const* d_col_ind
+        = reinterpret_cast<const rocsparse_int* const*>(dstaging + 2 * ptr_bytes);
+    const rocsparse_int* d_row_offset
+        = reinterpret_cast<const rocsparse_int*>(dstaging + 3 * ptr_bytes);
+    const rocsparse_int* d_col_offset
+        = reinterpret_cast<const rocsparse_int*>(dstaging + 3 * ptr_bytes + offset_bytes);
+    const rocsparse_int* d_nnz_offset
+        = reinterpret_cast<const rocsparse_int*>(dstaging + 3 * ptr_bytes + 2 * offset_bytes);
+
+#define CSR_STACK_DIM 256
+    // Assemble the stacked row pointer
+    hipLaunchKernelGGL(csr_stack_row_ptr_kernel,
+                       dim3((total_m - 1) / CSR_STACK_DIM + 1),
+                       dim3(CSR_STACK_DIM),
+                       0,
+                       stream,
+                       total_m,
+                       total_nnz,
+                       nbatch,
+                       d_row_ptr,
+                       d_row_offset,
+                       d_nnz_offset,
+                       stacked_row_ptr,
+                       descr->base);
+
+    // Copy the entries of all blocks, shifting the column indices into the
+    // column range of their block
+    if(total_nnz > 0)
+    {
+        hipLaunchKernelGGL((csr_stack_entry_kernel<T>),
+                           dim3((total_nnz - 1) / CSR_STACK_DIM + 1),
+                           dim3(CSR_STACK_DIM),
+                           0,
+                           stream,
+                           total_nnz,
+                           nbatch,
+                           d_val,
+                           d_col_ind,
+                           d_col_offset,
+                           d_nnz_offset,
+                           stacked_val,
+                           stacked_col_ind);
+    }
+#undef CSR_STACK_DIM
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(dstaging));
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR_STACK_HPP
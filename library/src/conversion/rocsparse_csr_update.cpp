@@ -0,0 +1,233 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_csr_update.hpp"
+
+#include "rocsparse.h"
+
+extern "C" rocsparse_status rocsparse_csr_update_analysis(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr_update_analysis",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info);
+
+    log_bench(handle, "./rocsparse-bench -f csr_update ", "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If the info has been used for a previous analysis, clear it first
+    if(info->csrupd_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrupd_info(info->csrupd_info));
+        info->csrupd_info = nullptr;
+    }
+
+    // Create csrupd info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrupd_info(&info->csrupd_info));
+
+    rocsparse_csrupd_info csrupd = info->csrupd_info;
+
+    // Table size is the smallest power of two of at least twice the number
+    // of non-zero entries, such that the load factor stays below one half
+    // and the linear probe chains remain short
+    rocsparse_int table_size = 2;
+
+    while(table_size < 2 * nnz)
+    {
+        table_size *= 2;
+    }
+
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&csrupd->table, sizeof(unsigned long long) * table_size));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrupd->data, sizeof(rocsparse_int) * table_size));
+
+    csrupd->table_size = table_size;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Mark all buckets empty
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(csrupd->table, 0xFF, sizeof(unsigned long long) * table_size, stream));
+
+    // Fill the table, the kernel performs no cross lane operations such
+    // that the sub wavefront size needs no dispatch on the hardware
+    // wavefront size
+#define CSR_UPDATE_DIM 256
+    rocsparse_int nnz_per_row = nnz / m;
+
+    dim3 csr_update_blocks((m - 1) / CSR_UPDATE_DIM + 1);
+    dim3 csr_update_threads(CSR_UPDATE_DIM);
+
+    if(nnz_per_row < 8)
+    {
+        hipLaunchKernelGGL((csr_update_build_kernel<4>),
+                           csr_update_blocks,
+                           csr_update_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           descr->base,
+                           table_size,
+                           csrupd->table,
+                           csrupd->data);
+    }
+    else if(nnz_per_row < 32)
+    {
+        hipLaunchKernelGGL((csr_update_build_kernel<16>),
+                           csr_update_blocks,
+                           csr_update_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           descr->base,
+                           table_size,
+                           csrupd->table,
+                           csrupd->data);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csr_update_build_kernel<64>),
+                           csr_update_blocks,
+                           csr_update_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           descr->base,
+                           table_size,
+                           csrupd->table,
+                           csrupd->data);
+    }
+#undef CSR_UPDATE_DIM
+
+    // Store some data to verify correct execution
+    csrupd->base        = descr->base;
+    csrupd->m           = m;
+    csrupd->n           = n;
+    csrupd->nnz         = nnz;
+    csrupd->descr       = descr;
+    csrupd->csr_row_ptr = csr_row_ptr;
+    csrupd->csr_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr_update_values(rocsparse_handle     handle,
+                                                         rocsparse_int        nupd,
+                                                         const rocsparse_int* upd_row_ind,
+                                                         const rocsparse_int* upd_col_ind,
+                                                         const float*         upd_val,
+                                                         float*               csr_val,
+                                                         rocsparse_mat_info   info)
+{
+    return rocsparse_csr_update_values_template<float>(
+        handle, nupd, upd_row_ind, upd_col_ind, upd_val, csr_val, info);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr_update_values(rocsparse_handle     handle,
+                                                         rocsparse_int        nupd,
+                                                         const rocsparse_int* upd_row_ind,
+                                                         const rocsparse_int* upd_col_ind,
+                                                         const double*        upd_val,
+                                                         double*              csr_val,
+                                                         rocsparse_mat_info   info)
+{
+    return rocsparse_csr_update_values_template<double>(
+        handle, nupd, upd_row_ind, upd_col_ind, upd_val, csr_val, info);
+}
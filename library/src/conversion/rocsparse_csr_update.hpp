@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR_UPDATE_HPP
+#define ROCSPARSE_CSR_UPDATE_HPP
+
+#include "csr_update_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csr_update_values_template(rocsparse_handle     handle,
+                                                      rocsparse_int        nupd,
+                                                      const rocsparse_int* upd_row_ind,
+                                                      const rocsparse_int* upd_col_ind,
+                                                      const T*             upd_val,
+                                                      T*                   csr_val,
+                                                      rocsparse_mat_info   info)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr_update_values"),
+              nupd,
+              (const void*&)upd_row_ind,
+              (const void*&)upd_col_ind,
+              (const void*&)upd_val,
+              (const void*&)csr_val,
+              (const void*&)info);
+
+    // Check sizes
+    if(nupd < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nupd == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(upd_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(upd_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(upd_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis meta data
+    if(info->csrupd_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrupd_info csrupd = info->csrupd_info;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSR_UPDATE_DIM 256
+    dim3 csr_update_blocks((nupd - 1) / CSR_UPDATE_DIM + 1);
+    dim3 csr_update_threads(CSR_UPDATE_DIM);
+
+    hipLaunchKernelGGL((csr_update_scatter_kernel<T>),
+                       csr_update_blocks,
+                       csr_update_threads,
+                       0,
+                       stream,
+                       nupd,
+                       upd_row_ind,
+                       upd_col_ind,
+                       upd_val,
+                       csrupd->n,
+                       csrupd->base,
+                       csrupd->table_size,
+                       csrupd->table,
+                       csrupd->data,
+                       csr_val);
+#undef CSR_UPDATE_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR_UPDATE_HPP
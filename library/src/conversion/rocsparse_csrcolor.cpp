@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "csrcolor_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrcolor(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int*            ncolors,
+                                               rocsparse_int*            coloring,
+                                               rocsparse_int*            perm)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrcolor",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)ncolors,
+              (const void*&)coloring,
+              (const void*&)perm);
+
+    log_bench(handle, "./rocsparse-bench -f csrcolor", "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(ncolors, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *ncolors = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ncolors == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coloring == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Initialize coloring with -1, representing uncolored rows
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(coloring, 255, sizeof(rocsparse_int) * m, stream));
+
+    // Counter of uncolored rows
+    rocsparse_int* d_uncolored = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(rocsparse_int), (void**)&d_uncolored));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(d_uncolored, &m, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+#define CSRCOLOR_DIM 256
+    dim3 csrcolor_blocks((m - 1) / CSRCOLOR_DIM + 1);
+    dim3 csrcolor_threads(CSRCOLOR_DIM);
+
+    // Jones-Plassmann-Luby iterations, each extracting two independent sets
+    // of rows. The loop terminates, since at least the global maximum is
+    // colored in every iteration.
+    rocsparse_int color     = 0;
+    rocsparse_int uncolored = m;
+
+    while(uncolored > 0)
+    {
+        hipLaunchKernelGGL((csrcolor_jpl_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           color,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           coloring,
+                           d_uncolored,
+                           descr->base);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &uncolored, d_uncolored, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        color += 2;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_uncolored));
+
+    // Determine the total number of colors
+    rocsparse_int* workspace = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * CSRCOLOR_DIM, (void**)&workspace));
+
+    hipLaunchKernelGGL((csrcolor_ncolors_kernel_part1<CSRCOLOR_DIM>),
+                       dim3(CSRCOLOR_DIM),
+                       csrcolor_threads,
+                       0,
+                       stream,
+                       m,
+                       coloring,
+                       workspace);
+
+    hipLaunchKernelGGL((csrcolor_ncolors_kernel_part2<CSRCOLOR_DIM>),
+                       dim3(1),
+                       csrcolor_threads,
+                       0,
+                       stream,
+                       static_cast<rocsparse_int>(CSRCOLOR_DIM),
+                       workspace);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            ncolors, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(ncolors, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(workspace));
+#undef CSRCOLOR_DIM
+
+    // If requested, create a permutation that groups the rows by color, such
+    // that each color forms one large contiguous independent set. The
+    // permutation can be applied with the csrsort permutation machinery, e.g.
+    // rocsparse_sgthr() / rocsparse_dgthr().
+    if(perm != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, perm));
+
+        // Temporary buffers for the stable sort by color
+        rocsparse_int* tmp_keys = nullptr;
+        rocsparse_int* tmp_perm = nullptr;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->buffer_alloc(sizeof(rocsparse_int) * m * 2, (void**)&tmp_keys));
+        tmp_perm = tmp_keys + m;
+
+        // Sort a copy of the coloring, the user array is left untouched
+        rocsparse_int* keys = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(rocsparse_int) * m, (void**)&keys));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            keys, coloring, sizeof(rocsparse_int) * m, hipMemcpyDeviceToDevice, stream));
+
+        rocprim::double_buffer<rocsparse_int> rocprim_keys(keys, tmp_keys);
+        rocprim::double_buffer<rocsparse_int> rocprim_vals(perm, tmp_perm);
+
+        // Obtain rocprim buffer size
+        size_t size = 0;
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            nullptr, size, rocprim_keys, rocprim_vals, m, 0, 32, stream));
+
+        void* rocprim_buffer = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(size, &rocprim_buffer));
+
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            rocprim_buffer, size, rocprim_keys, rocprim_vals, m, 0, 32, stream));
+
+        // Copy the permutation back, if the sort result ended up in the
+        // temporary buffer
+        if(rocprim_vals.current() != perm)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(perm,
+                                               rocprim_vals.current(),
+                                               sizeof(rocsparse_int) * m,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(rocprim_buffer));
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(keys));
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(tmp_keys));
+    }
+
+    return rocsparse_status_success;
+}
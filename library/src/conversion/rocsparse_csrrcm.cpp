@@ -0,0 +1,333 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "definitions.h"
+#include "handle.h"
+#include "rcm_device.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int*            perm)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm);
+
+    log_bench(handle, "./rocsparse-bench -f csrrcm", "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // An empty adjacency structure leaves every row in its own component,
+    // any ordering is a valid (reverse) Cuthill-McKee ordering
+    if(nnz == 0)
+    {
+        return rocsparse_create_identity_permutation(handle, m, perm);
+    }
+
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRRCM_DIM 256
+    dim3 csrrcm_blocks((m - 1) / CSRRCM_DIM + 1);
+    dim3 csrrcm_threads(CSRRCM_DIM);
+
+    // BFS level of each row, initialized with -1, representing unvisited
+    // rows
+    rocsparse_int* levels = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(rocsparse_int) * m, (void**)&levels));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(levels, 255, sizeof(rocsparse_int) * m, stream));
+
+    // Flag raised by BFS iterations that visited at least one row
+    rocsparse_int* d_changed = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(rocsparse_int), (void**)&d_changed));
+
+    // Workspace of the root selection reduction
+    unsigned long long* workspace = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(unsigned long long) * CSRRCM_DIM, (void**)&workspace));
+
+    // Process the connected components of the adjacency graph one by one.
+    // The level counter keeps running across the components, such that the
+    // final sort interleaves no rows of different components
+    rocsparse_int base = 0;
+
+    while(true)
+    {
+        // Select the unvisited row of minimum degree as BFS root. All rows
+        // are visited once the reduction returns an empty key
+        hipLaunchKernelGGL((rcm_min_degree_kernel_part1<CSRRCM_DIM>),
+                           dim3(CSRRCM_DIM),
+                           csrrcm_threads,
+                           0,
+                           stream,
+                           m,
+                           static_cast<rocsparse_int>(-1),
+                           csr_row_ptr,
+                           levels,
+                           workspace);
+
+        hipLaunchKernelGGL((rcm_min_degree_kernel_part2<CSRRCM_DIM>),
+                           dim3(1),
+                           csrrcm_threads,
+                           0,
+                           stream,
+                           static_cast<rocsparse_int>(CSRRCM_DIM),
+                           workspace);
+
+        unsigned long long root_key;
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &root_key, workspace, sizeof(unsigned long long), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(root_key == 0xffffffffffffffffULL)
+        {
+            break;
+        }
+
+        rocsparse_int root = static_cast<rocsparse_int>(root_key & 0xffffffffULL);
+
+        // Two BFS sweeps. The first sweep starts at the row of minimum
+        // degree, the second sweep restarts at a row of minimum degree in
+        // the deepest level of the first sweep, which approximates a
+        // peripheral row and flattens the level structure
+        for(int sweep = 0; sweep < 2; ++sweep)
+        {
+            // Enter the root at the base level
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(levels + root, &base, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+
+            // Level synchronous BFS
+            rocsparse_int level = base;
+
+            while(true)
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(d_changed, 0, sizeof(rocsparse_int), stream));
+
+                hipLaunchKernelGGL((rcm_bfs_kernel<CSRRCM_DIM>),
+                                   csrrcm_blocks,
+                                   csrrcm_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   level,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   levels,
+                                   d_changed,
+                                   descr->base);
+
+                rocsparse_int changed;
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                    &changed, d_changed, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+                RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+                if(changed == 0)
+                {
+                    break;
+                }
+
+                ++level;
+            }
+
+            // A flat component does not profit from a second sweep
+            if(sweep == 1 || level == base)
+            {
+                base = level + 1;
+                break;
+            }
+
+            // Select a row of minimum degree in the deepest level as the
+            // refined root
+            hipLaunchKernelGGL((rcm_min_degree_kernel_part1<CSRRCM_DIM>),
+                               dim3(CSRRCM_DIM),
+                               csrrcm_threads,
+                               0,
+                               stream,
+                               m,
+                               level,
+                               csr_row_ptr,
+                               levels,
+                               workspace);
+
+            hipLaunchKernelGGL((rcm_min_degree_kernel_part2<CSRRCM_DIM>),
+                               dim3(1),
+                               csrrcm_threads,
+                               0,
+                               stream,
+                               static_cast<rocsparse_int>(CSRRCM_DIM),
+                               workspace);
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                &root_key, workspace, sizeof(unsigned long long), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            root = static_cast<rocsparse_int>(root_key & 0xffffffffULL);
+
+            // Clear the component for the second sweep
+            hipLaunchKernelGGL((rcm_reset_kernel<CSRRCM_DIM>),
+                               csrrcm_blocks,
+                               csrrcm_threads,
+                               0,
+                               stream,
+                               m,
+                               base,
+                               levels);
+        }
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(workspace));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_changed));
+
+    // Pack level and degree of each row into a single 64 bit sort key
+    unsigned long long* keys     = nullptr;
+    unsigned long long* tmp_keys = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(unsigned long long) * m * 2, (void**)&keys));
+    tmp_keys = keys + m;
+
+    hipLaunchKernelGGL((rcm_pack_keys_kernel<CSRRCM_DIM>),
+                       csrrcm_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       levels,
+                       keys);
+
+    // Sorting the row indices by the packed keys yields the Cuthill-McKee
+    // ordering
+    rocsparse_int* order     = nullptr;
+    rocsparse_int* tmp_order = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * m * 2, (void**)&order));
+    tmp_order = order + m;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, order));
+
+    rocprim::double_buffer<unsigned long long> rocprim_keys(keys, tmp_keys);
+    rocprim::double_buffer<rocsparse_int>      rocprim_vals(order, tmp_order);
+
+    // Obtain rocprim buffer size
+    size_t size = 0;
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, rocprim_keys, rocprim_vals, m, 0, 64, stream));
+
+    void* rocprim_buffer = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(size, &rocprim_buffer));
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, size, rocprim_keys, rocprim_vals, m, 0, 64, stream));
+
+    // Reverse the Cuthill-McKee ordering
+    hipLaunchKernelGGL((rcm_reverse_kernel<CSRRCM_DIM>),
+                       csrrcm_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       m,
+                       rocprim_vals.current(),
+                       perm);
+
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(rocprim_buffer));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(order));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(keys));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(levels));
+#undef CSRRCM_DIM
+
+    return rocsparse_status_success;
+}
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "rocsparse_csrsort.hpp"
 #include "rocsparse.h"
 
 #include "csrsort_device.h"
@@ -388,3 +389,56 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle          handle,
     }
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status rocsparse_scsrsort_values_buffer_size(rocsparse_handle     handle,
+                                                                  rocsparse_int        m,
+                                                                  rocsparse_int        n,
+                                                                  rocsparse_int        nnz,
+                                                                  const rocsparse_int* csr_row_ptr,
+                                                                  const rocsparse_int* csr_col_ind,
+                                                                  size_t*              buffer_size)
+{
+    return rocsparse_csrsort_values_buffer_size_template<float>(
+        handle, m, n, nnz, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsort_values_buffer_size(rocsparse_handle     handle,
+                                                                  rocsparse_int        m,
+                                                                  rocsparse_int        n,
+                                                                  rocsparse_int        nnz,
+                                                                  const rocsparse_int* csr_row_ptr,
+                                                                  const rocsparse_int* csr_col_ind,
+                                                                  size_t*              buffer_size)
+{
+    return rocsparse_csrsort_values_buffer_size_template<double>(
+        handle, m, n, nnz, csr_row_ptr, csr_col_ind, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scsrsort_values(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      rocsparse_int*            csr_col_ind,
+                                                      float*                    csr_val,
+                                                      void*                     temp_buffer)
+{
+    return rocsparse_csrsort_values_template<float>(
+        handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, csr_val, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsort_values(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      rocsparse_int*            csr_col_ind,
+                                                      double*                   csr_val,
+                                                      void*                     temp_buffer)
+{
+    return rocsparse_csrsort_values_template<double>(
+        handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, csr_val, temp_buffer);
+}
+
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "csrstat_device.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+extern "C" rocsparse_status rocsparse_csrstat(rocsparse_handle     handle,
+                                              rocsparse_int        m,
+                                              const rocsparse_int* csr_row_ptr,
+                                              rocsparse_int*       row_min,
+                                              rocsparse_int*       row_max,
+                                              double*              row_mean,
+                                              double*              row_var,
+                                              rocsparse_int*       hist)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrstat",
+              m,
+              (const void*&)csr_row_ptr,
+              (const void*&)row_min,
+              (const void*&)row_max,
+              (const void*&)row_mean,
+              (const void*&)row_var,
+              (const void*&)hist);
+
+    log_bench(handle, "./rocsparse-bench -f csrstat ", "--mtx <matrix.mtx>");
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(row_min == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(row_max == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(row_mean == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(row_var == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(hist == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(hist, 0, sizeof(rocsparse_int) * 32, stream));
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(row_min, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(row_max, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(row_mean, 0, sizeof(double), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(row_var, 0, sizeof(double), stream));
+        }
+        else
+        {
+            *row_min  = 0;
+            *row_max  = 0;
+            *row_mean = 0.0;
+            *row_var  = 0.0;
+        }
+        return rocsparse_status_success;
+    }
+
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    // Get workspace from handle device buffer, doubles first to keep the
+    // alignment
+    double*        sums    = reinterpret_cast<double*>(handle->buffer);
+    double*        moments = sums + 2;
+    rocsparse_int* iwork   = reinterpret_cast<rocsparse_int*>(moments + 2);
+
+    rocsparse_int* wmin = iwork;
+    rocsparse_int* wmax = iwork + 1;
+
+    // Clear sums and histogram
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(sums, 0, sizeof(double) * 2, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(hist, 0, sizeof(rocsparse_int) * 32, stream));
+
+    hipLaunchKernelGGL((csrstat_init_kernel), dim3(1), dim3(1), 0, stream, wmin, wmax);
+
+#define CSRSTAT_DIM 256
+    // Grid-stride loop over all rows
+    rocsparse_int nblocks = (m - 1) / CSRSTAT_DIM + 1;
+    nblocks               = nblocks > CSRSTAT_DIM ? CSRSTAT_DIM : nblocks;
+
+    hipLaunchKernelGGL((csrstat_kernel<CSRSTAT_DIM>),
+                       dim3(nblocks),
+                       dim3(CSRSTAT_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       wmin,
+                       wmax,
+                       sums,
+                       hist);
+#undef CSRSTAT_DIM
+
+    // Compute mean and variance from the reduced sums
+    hipLaunchKernelGGL((csrstat_finalize_kernel), dim3(1), dim3(1), 0, stream, m, sums, moments);
+
+    // Copy statistics back to host, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            row_min, wmin, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            row_max, wmax, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(row_mean, moments, sizeof(double), hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(row_var, moments + 1, sizeof(double), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(row_min, wmin, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(row_max, wmax, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(row_mean, moments, sizeof(double), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(row_var, moments + 1, sizeof(double), hipMemcpyDeviceToHost));
+    }
+
+    return rocsparse_status_success;
+}
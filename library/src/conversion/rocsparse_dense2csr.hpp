@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_DENSE2CSR_HPP
+#define ROCSPARSE_DENSE2CSR_HPP
+
+#include "definitions.h"
+#include "dense2csr_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+template <typename T>
+rocsparse_status rocsparse_dense2csr_nnz_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  A,
+                                                  rocsparse_int             lda,
+                                                  rocsparse_int*            csr_row_ptr,
+                                                  rocsparse_int*            nnz,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdense2csr_nnz"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)A,
+              lda,
+              (const void*&)csr_row_ptr,
+              (const void*&)nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(lda < std::max(static_cast<rocsparse_int>(1), m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check nnz pointer argument before quick return
+    if(nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define DENSE2CSR_DIM 512
+    dim3 dense2csr_blocks((m - 1) / DENSE2CSR_DIM + 1);
+    dim3 dense2csr_threads(DENSE2CSR_DIM);
+
+    // Count non-zero entries per row
+    hipLaunchKernelGGL((dense2csr_nnz_kernel<T>),
+                       dense2csr_blocks,
+                       dense2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       csr_row_ptr,
+                       descr->base);
+#undef DENSE2CSR_DIM
+
+    // Inclusive sum to obtain the row pointers
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                csr_row_ptr,
+                                                csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_buffer,
+                                                size,
+                                                csr_row_ptr,
+                                                csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract the total nnz, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((dense2csr_nnz_extract_kernel),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           nnz,
+                           descr->base);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        *nnz -= descr->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_dense2csr_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  A,
+                                              rocsparse_int             lda,
+                                              T*                        csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              rocsparse_int*            csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdense2csr"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)A,
+              lda,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind);
+
+    log_bench(handle, "./rocsparse-bench -f dense2csr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(lda < std::max(static_cast<rocsparse_int>(1), m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define DENSE2CSR_DIM 512
+    dim3 dense2csr_blocks((m - 1) / DENSE2CSR_DIM + 1);
+    dim3 dense2csr_threads(DENSE2CSR_DIM);
+
+    // Compact the non-zero entries
+    hipLaunchKernelGGL((dense2csr_fill_kernel<T>),
+                       dense2csr_blocks,
+                       dense2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       descr->base);
+#undef DENSE2CSR_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_DENSE2CSR_HPP
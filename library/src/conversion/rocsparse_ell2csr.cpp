@@ -145,6 +145,7 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
                        m,
                        n,
                        ell_width,
+                       ell_get_pitch(ell_descr, m),
                        ell_col_ind,
                        ell_descr->base,
                        csr_row_ptr,
@@ -164,20 +165,8 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
                                                 stream));
 
     // Get rocprim buffer
-    bool  d_temp_alloc;
-    void* d_temp_storage;
-
-    // Device buffer should be sufficient for rocprim in most cases
-    if(handle->buffer_size >= temp_storage_bytes)
-    {
-        d_temp_storage = handle->buffer;
-        d_temp_alloc   = false;
-    }
-    else
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
-        d_temp_alloc = true;
-    }
+    void* d_temp_storage = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(temp_storage_bytes, &d_temp_storage));
 
     // Perform actual inclusive sum
     RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
@@ -222,11 +211,8 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
         }
     }
 
-    // Free rocprim buffer, if allocated
-    if(d_temp_alloc == true)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
-    }
+    // Free rocprim buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_temp_storage));
 
     return rocsparse_status_success;
 }
@@ -280,3 +266,53 @@ extern "C" rocsparse_status rocsparse_dell2csr(rocsparse_handle          handle,
                                               csr_row_ptr,
                                               csr_col_ind);
 }
+
+extern "C" rocsparse_status rocsparse_cell2csr(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               const rocsparse_mat_descr      ell_descr,
+                                               rocsparse_int                  ell_width,
+                                               const rocsparse_float_complex* ell_val,
+                                               const rocsparse_int*           ell_col_ind,
+                                               const rocsparse_mat_descr      csr_descr,
+                                               rocsparse_float_complex*       csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               rocsparse_int*                 csr_col_ind)
+{
+    return rocsparse_ell2csr_template<rocsparse_float_complex>(handle,
+                                                               m,
+                                                               n,
+                                                               ell_descr,
+                                                               ell_width,
+                                                               ell_val,
+                                                               ell_col_ind,
+                                                               csr_descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_zell2csr(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               const rocsparse_mat_descr       ell_descr,
+                                               rocsparse_int                   ell_width,
+                                               const rocsparse_double_complex* ell_val,
+                                               const rocsparse_int*            ell_col_ind,
+                                               const rocsparse_mat_descr       csr_descr,
+                                               rocsparse_double_complex*       csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               rocsparse_int*                  csr_col_ind)
+{
+    return rocsparse_ell2csr_template<rocsparse_double_complex>(handle,
+                                                                m,
+                                                                n,
+                                                                ell_descr,
+                                                                ell_width,
+                                                                ell_val,
+                                                                ell_col_ind,
+                                                                csr_descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind);
+}
@@ -147,6 +147,7 @@ rocsparse_status rocsparse_ell2csr_template(rocsparse_handle          handle,
                        m,
                        n,
                        ell_width,
+                       ell_get_pitch(ell_descr, m),
                        ell_col_ind,
                        ell_val,
                        ell_descr->base,
@@ -25,10 +25,122 @@
 #include "definitions.h"
 #include "logging.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <hip/hip_runtime.h>
 
 __global__ void init_kernel(){};
 
+/*******************************************************************************
+ * Shared per-device state. The device properties and the staged one constants
+ * are identical for every handle on a device. They are queried and allocated
+ * once and shared by all handles, such that schedulers creating one handle
+ * per worker thread only pay the startup cost for the first handle
+ ******************************************************************************/
+struct _rocsparse_device_context
+{
+    // device id
+    int device;
+    // number of handles sharing this context
+    int refcount;
+    // device properties
+    hipDeviceProp_t properties;
+    // device one ; staged on first use
+    bool    staged = false;
+    float*  sone   = nullptr;
+    double* done   = nullptr;
+};
+
+static std::mutex device_context_mutex;
+static std::vector<_rocsparse_device_context*> device_contexts;
+
+static _rocsparse_device_context* acquire_device_context(int device)
+{
+    std::lock_guard<std::mutex> lock(device_context_mutex);
+
+    for(auto ctx : device_contexts)
+    {
+        if(ctx->device == device)
+        {
+            ++ctx->refcount;
+
+            return ctx;
+        }
+    }
+
+    _rocsparse_device_context* ctx = new _rocsparse_device_context;
+
+    ctx->device   = device;
+    ctx->refcount = 1;
+
+    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&ctx->properties, device));
+
+    device_contexts.push_back(ctx);
+
+    return ctx;
+}
+
+/*******************************************************************************
+ * Stage the device one constants of the shared context on first use. Handle
+ * creation stays free of device allocations, the first routine that needs
+ * the constants pays the upload once per device
+ ******************************************************************************/
+static rocsparse_status stage_device_context(_rocsparse_device_context* ctx)
+{
+    std::lock_guard<std::mutex> lock(device_context_mutex);
+
+    if(ctx->staged)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Device one
+    RETURN_IF_HIP_ERROR(hipMalloc(&ctx->sone, sizeof(float)));
+    RETURN_IF_HIP_ERROR(hipMalloc(&ctx->done, sizeof(double)));
+
+    // Execute empty kernel for initialization
+    hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, 0);
+
+    float  hsone = 1.0f;
+    double hdone = 1.0;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(ctx->sone, &hsone, sizeof(float), hipMemcpyHostToDevice, 0));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(ctx->done, &hdone, sizeof(double), hipMemcpyHostToDevice, 0));
+
+    // Wait for device transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(0));
+
+    ctx->staged = true;
+
+    return rocsparse_status_success;
+}
+
+static void release_device_context(_rocsparse_device_context* ctx)
+{
+    std::lock_guard<std::mutex> lock(device_context_mutex);
+
+    if(--ctx->refcount > 0)
+    {
+        return;
+    }
+
+    PRINT_IF_HIP_ERROR(hipFree(ctx->sone));
+    PRINT_IF_HIP_ERROR(hipFree(ctx->done));
+
+    for(auto it = device_contexts.begin(); it != device_contexts.end(); ++it)
+    {
+        if(*it == ctx)
+        {
+            device_contexts.erase(it);
+            break;
+        }
+    }
+
+    delete ctx;
+}
+
 /*******************************************************************************
  * constructor
  ******************************************************************************/
@@ -36,7 +148,11 @@ _rocsparse_handle::_rocsparse_handle()
 {
     // Default device is active device
     THROW_IF_HIP_ERROR(hipGetDevice(&device));
-    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&properties, device));
+
+    // Shared immutable per-device state
+    device_context = acquire_device_context(device);
+
+    properties = device_context->properties;
 
     // Device wavefront size
     wavefront_size = properties.warpSize;
@@ -45,110 +161,922 @@ _rocsparse_handle::_rocsparse_handle()
     char* str_layer_mode;
     if((str_layer_mode = getenv("ROCSPARSE_LAYER")) == NULL)
     {
-        layer_mode = rocsparse_layer_mode_none;
+        layer_mode = rocsparse_layer_mode_none;
+    }
+    else
+    {
+        layer_mode = (rocsparse_layer_mode)(atoi(str_layer_mode));
+    }
+
+    // Adaptive csrmv tuning variant. A direct override through
+    // ROCSPARSE_CSRMV_TUNING takes precedence, otherwise the selection
+    // table written by the rocsparse-tune client is consulted for an entry
+    // matching this device's architecture
+    char* str_csrmv_tuning;
+    if((str_csrmv_tuning = getenv("ROCSPARSE_CSRMV_TUNING")) != NULL)
+    {
+        csrmv_tuning_override = atoi(str_csrmv_tuning);
+    }
+    else
+    {
+        char* str_tuning_table;
+        if((str_tuning_table = getenv("ROCSPARSE_TUNING_TABLE")) != NULL)
+        {
+            FILE* f = fopen(str_tuning_table, "r");
+            if(f != NULL)
+            {
+                char routine[64];
+                int  arch;
+                int  variant;
+
+                // Table lines are '<gcnArch> <routine> <variant>', lines
+                // starting with '#' are comments
+                char line[256];
+                while(fgets(line, sizeof(line), f) != NULL)
+                {
+                    if(line[0] == '#')
+                    {
+                        continue;
+                    }
+
+                    if(sscanf(line, "%d %63s %d", &arch, routine, &variant) == 3
+                       && arch == properties.gcnArch && strcmp(routine, "csrmv_adaptive") == 0)
+                    {
+                        csrmv_tuning_override = variant;
+                    }
+                }
+
+                fclose(f);
+            }
+        }
+    }
+
+    // Online csrmv kernel selection probing
+    char* str_csrmv_probe;
+    if((str_csrmv_probe = getenv("ROCSPARSE_CSRMV_PROBE")) != NULL)
+    {
+        csrmv_probe = (atoi(str_csrmv_probe) != 0);
+    }
+
+    // Obtain size for coomv device buffer
+    rocsparse_int nthreads = properties.maxThreadsPerBlock;
+    rocsparse_int nprocs   = properties.multiProcessorCount;
+    rocsparse_int nblocks  = (nprocs * nthreads - 1) / 128 + 1;
+    rocsparse_int nwfs     = nblocks * (128 / properties.warpSize);
+
+    size_t coomv_size = (((sizeof(rocsparse_int) + 16) * nwfs - 1) / 256 + 1) * 256;
+
+    // Size the device buffer ; the allocation, along with the scalar ring
+    // and the staged one constants, is deferred to the first routine that
+    // needs it, such that handle creation performs no device allocations
+    buffer_size = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
+
+    // Open log file
+    if(layer_mode & rocsparse_layer_mode_log_trace)
+    {
+        open_log_stream(&log_trace_os, &log_trace_ofs, "ROCSPARSE_LOG_TRACE_PATH");
+    }
+
+    // Open log_bench file
+    if(layer_mode & rocsparse_layer_mode_log_bench)
+    {
+        open_log_stream(&log_bench_os, &log_bench_ofs, "ROCSPARSE_LOG_BENCH_PATH");
+    }
+
+    // Start the logging thread. API threads format their log entries into a
+    // lock-free queue, the thread drains it to the log streams in the
+    // background
+    if(layer_mode != rocsparse_layer_mode_none)
+    {
+        log_queue = new _rocsparse_log_queue;
+        log_shutdown.store(false, std::memory_order_relaxed);
+        log_thread = std::thread(&_rocsparse_handle::log_drain, this);
+    }
+
+    // Create the profiling events
+    if(layer_mode & rocsparse_layer_mode_log_profile)
+    {
+        THROW_IF_HIP_ERROR(hipEventCreate(&profile_start));
+        THROW_IF_HIP_ERROR(hipEventCreate(&profile_stop));
+    }
+}
+
+/*******************************************************************************
+ * destructor
+ ******************************************************************************/
+_rocsparse_handle::~_rocsparse_handle()
+{
+    // Wait for the kernel preloading to finish
+    if(preload_thread.joinable())
+    {
+        preload_thread.join();
+    }
+
+    // Stop the logging thread, remaining entries are drained before the
+    // streams are closed
+    if(log_queue != nullptr)
+    {
+        log_shutdown.store(true, std::memory_order_release);
+        log_cond.notify_one();
+        log_thread.join();
+
+        delete log_queue;
+    }
+
+    PRINT_IF_HIP_ERROR(hipFree(buffer));
+    PRINT_IF_HIP_ERROR(hipFree(scalar_ring));
+    PRINT_IF_HIP_ERROR(hipHostFree(scalar_ring_host));
+
+    // Release the upload staging ring, the events gate outstanding
+    // transfers before the pinned slots are returned
+    for(int i = 0; i < 2; ++i)
+    {
+        if(upload_ring[i] != nullptr)
+        {
+            if(upload_used[i])
+            {
+                PRINT_IF_HIP_ERROR(hipEventSynchronize(upload_done[i]));
+            }
+            PRINT_IF_HIP_ERROR(hipEventDestroy(upload_done[i]));
+            PRINT_IF_HIP_ERROR(hipHostFree(upload_ring[i]));
+        }
+    }
+
+    // Drop the cache references to the csrmv analysis results ; entries
+    // still referenced by a mat_info survive until that info is destroyed
+    for(size_t i = 0; i < csrmv_cache.size(); ++i)
+    {
+        rocsparse_release_csrmv_analysis_data(csrmv_cache[i]);
+    }
+
+    // The staged one constants are owned by the shared device context
+    release_device_context(device_context);
+
+    if(profile_start != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipEventDestroy(profile_start));
+        PRINT_IF_HIP_ERROR(hipEventDestroy(profile_stop));
+    }
+
+    if(prefetch_stream != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipStreamDestroy(prefetch_stream));
+        PRINT_IF_HIP_ERROR(hipEventDestroy(prefetch_done));
+    }
+
+    for(size_t i = 0; i < pool_streams.size(); ++i)
+    {
+        PRINT_IF_HIP_ERROR(hipStreamDestroy(pool_streams[i]));
+        PRINT_IF_HIP_ERROR(hipEventDestroy(pool_events[i]));
+    }
+    if(pool_fork_event != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipEventDestroy(pool_fork_event));
+    }
+    for(size_t i = 0; i < pool_buffer_states.size(); ++i)
+    {
+        PRINT_IF_HIP_ERROR(hipFree(pool_buffer_states[i].ptr));
+    }
+
+    if(priority_stream != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipStreamDestroy(priority_stream));
+        PRINT_IF_HIP_ERROR(hipEventDestroy(priority_join_event));
+    }
+
+    // Close log files
+    if(log_trace_ofs.is_open())
+    {
+        log_trace_ofs.close();
+    }
+    if(log_bench_ofs.is_open())
+    {
+        log_bench_ofs.close();
+    }
+}
+
+/*******************************************************************************
+ * Hand a formatted log entry over to the logging thread
+ ******************************************************************************/
+void _rocsparse_handle::log_enqueue(std::ostream* os, std::string&& payload)
+{
+    // Back off until a slot is available, the drain thread guarantees
+    // progress
+    while(!log_queue->try_push(os, payload))
+    {
+        std::this_thread::yield();
+    }
+
+    log_cond.notify_one();
+}
+
+/*******************************************************************************
+ * Drain loop of the logging thread
+ ******************************************************************************/
+void _rocsparse_handle::log_drain()
+{
+    std::ostream* os;
+    std::string   payload;
+
+    for(;;)
+    {
+        bool drained = false;
+
+        while(log_queue->try_pop(&os, &payload))
+        {
+            *os << payload;
+            drained = true;
+        }
+
+        if(drained)
+        {
+            continue;
+        }
+
+        if(log_shutdown.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        // Sleep until new entries arrive. The wait times out, since the
+        // producers notify without holding the mutex
+        std::unique_lock<std::mutex> lock(log_mutex);
+        log_cond.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
+/*******************************************************************************
+ * Record the start of a profiled operation
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::profile_begin()
+{
+    if(!(layer_mode & rocsparse_layer_mode_log_profile))
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipEventRecord(profile_start, stream));
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * Record the end of a profiled operation and accumulate its statistics. The
+ * elapsed time measurement waits for the operation to finish on the device
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::profile_end(const std::string& name, double nbytes)
+{
+    if(!(layer_mode & rocsparse_layer_mode_log_profile))
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipEventRecord(profile_stop, stream));
+    RETURN_IF_HIP_ERROR(hipEventSynchronize(profile_stop));
+
+    float elapsed;
+    RETURN_IF_HIP_ERROR(hipEventElapsedTime(&elapsed, profile_start, profile_stop));
+
+    std::lock_guard<std::mutex> lock(profile_mutex);
+
+    profile_record& record = profile_table[name];
+
+    record.calls += 1;
+    record.time_ms += elapsed;
+    record.bytes += nbytes;
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * Look up a cached csrmv analysis by its pattern fingerprint. On a hit, the
+ * entry is moved to the most recently used position and a reference is
+ * acquired for the caller
+ ******************************************************************************/
+_rocsparse_csrmv_analysis_data* _rocsparse_handle::csrmv_cache_lookup(uint64_t      hash,
+                                                                      rocsparse_int m,
+                                                                      rocsparse_int n,
+                                                                      rocsparse_int nnz)
+{
+    std::lock_guard<std::mutex> lock(csrmv_cache_mutex);
+
+    for(size_t i = 0; i < csrmv_cache.size(); ++i)
+    {
+        _rocsparse_csrmv_analysis_data* data = csrmv_cache[i];
+
+        if(data->hash == hash && data->m == m && data->n == n && data->nnz == nnz)
+        {
+            csrmv_cache.erase(csrmv_cache.begin() + i);
+            csrmv_cache.push_back(data);
+
+            data->refcount.fetch_add(1, std::memory_order_relaxed);
+
+            return data;
+        }
+    }
+
+    return nullptr;
+}
+
+/*******************************************************************************
+ * Insert a csrmv analysis into the cache, acquiring a reference for the
+ * cache and evicting the least recently used entry when the cache is full
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::csrmv_cache_insert(_rocsparse_csrmv_analysis_data* data)
+{
+    _rocsparse_csrmv_analysis_data* evicted = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(csrmv_cache_mutex);
+
+        if(csrmv_cache.size() == csrmv_cache_capacity)
+        {
+            evicted = csrmv_cache.front();
+            csrmv_cache.erase(csrmv_cache.begin());
+        }
+
+        data->refcount.fetch_add(1, std::memory_order_relaxed);
+        csrmv_cache.push_back(data);
+    }
+
+    if(evicted != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_release_csrmv_analysis_data(evicted));
+    }
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * Exactly like cuSPARSE, rocSPARSE only uses one stream for one API routine
+ ******************************************************************************/
+
+/*******************************************************************************
+ * set stream:
+   This API assumes user has already created a valid stream
+   Associate the following rocsparse API call with this user provided stream
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::set_stream(hipStream_t user_stream)
+{
+    // While a concurrent group is open, the handle stream points at a pool
+    // stream ; the new user stream takes effect once the group is closed
+    if(pool_index >= 0)
+    {
+        pool_saved_stream = user_stream;
+        return rocsparse_status_success;
+    }
+
+    // TODO check if stream is valid
+    stream = user_stream;
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * get stream
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::get_stream(hipStream_t* user_stream) const
+{
+    *user_stream = stream;
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * Allocate the device buffer, the scalar ring and the staged one constants
+ * on first use. Handle creation itself performs no device allocations, such
+ * that per-thread handle pools and short-lived processes pay the setup cost
+ * only for handles that actually reach the device
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::ensure_device_memory(void)
+{
+    if(buffer != nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the shared one constants
+    RETURN_IF_ROCSPARSE_ERROR(stage_device_context(device_context));
+
+    sone = device_context->sone;
+    done = device_context->done;
+
+    // Device scalar ring and its pinned host mirror
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&scalar_ring, scalar_ring_slots * scalar_ring_width));
+    RETURN_IF_HIP_ERROR(
+        hipHostMalloc((void**)&scalar_ring_host, scalar_ring_slots * scalar_ring_width));
+
+    // The device buffer is allocated last, its presence marks the handle
+    // fully initialized
+    RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * Stream-ordered suballocation of temporary device memory from the handle
+ * buffer. Allocations are served by bumping an offset into the buffer and
+ * must be released in reverse allocation order. Releasing is pure host side
+ * bookkeeping - since all work is enqueued to the handle stream, any kernel
+ * still using the region completes before a later routine reuses it, which
+ * avoids the device-wide synchronization of hipMalloc / hipFree between
+ * kernel launches.
+ *
+ * If the buffer is too small, the allocation falls back to a dedicated
+ * hipMalloc and the buffer is grown to the observed demand as soon as all
+ * suballocations have been released, such that the synchronizing
+ * reallocation is paid at most once per high water mark.
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::buffer_alloc(size_t nbytes, void** dev_ptr)
+{
+    // Allocate the device buffer on first use
+    RETURN_IF_ROCSPARSE_ERROR(ensure_device_memory());
+
+    // Pad allocation size to 256 byte granularity
+    nbytes = (nbytes / 256 + 1) * 256;
+
+    // Track the largest demand for deferred buffer growth
+    if(buffer_offset + nbytes > buffer_demand)
+    {
+        buffer_demand = buffer_offset + nbytes;
+    }
+
+    // Grow the drained buffer up front, if the request does not fit
+    if(buffer_stack.empty() && nbytes > buffer_size)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(buffer));
+        buffer_size = buffer_demand;
+        RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    }
+
+    if(buffer_offset + nbytes <= buffer_size)
+    {
+        *dev_ptr = reinterpret_cast<char*>(buffer) + buffer_offset;
+        buffer_stack.push_back(buffer_offset);
+        buffer_offset += nbytes;
+
+        // Account the outstanding temporary memory
+        temp_in_use += nbytes;
+        temp_peak = std::max(temp_peak, temp_in_use);
+
+        return rocsparse_status_success;
+    }
+
+    // Buffer exhausted while suballocations are outstanding, fall back to a
+    // dedicated allocation; the buffer grows to the recorded demand once all
+    // suballocations have been released
+    RETURN_IF_HIP_ERROR(hipMalloc(dev_ptr, nbytes));
+
+    // Fallback allocations carry their size for the accounting on release
+    fallback_sizes.push_back(std::make_pair(*dev_ptr, nbytes));
+    temp_in_use += nbytes;
+    temp_peak = std::max(temp_peak, temp_in_use);
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * Release temporary device memory, in reverse allocation order
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::buffer_free(void* dev_ptr)
+{
+    if(dev_ptr == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    char* pool_begin = reinterpret_cast<char*>(buffer);
+    char* pool_end   = pool_begin + buffer_size;
+    char* ptr        = reinterpret_cast<char*>(dev_ptr);
+
+    if(ptr >= pool_begin && ptr < pool_end)
+    {
+        // Rewind the bump offset
+        temp_in_use -= buffer_offset - buffer_stack.back();
+        buffer_offset = buffer_stack.back();
+        buffer_stack.pop_back();
+    }
+    else
+    {
+        // Dedicated fallback allocation
+        RETURN_IF_HIP_ERROR(hipFree(dev_ptr));
+
+        for(size_t i = 0; i < fallback_sizes.size(); ++i)
+        {
+            if(fallback_sizes[i].first == dev_ptr)
+            {
+                temp_in_use -= fallback_sizes[i].second;
+                fallback_sizes.erase(fallback_sizes.begin() + i);
+                break;
+            }
+        }
+    }
+
+    // Grow the buffer to the observed demand once it drained
+    if(buffer_stack.empty() && buffer_demand > buffer_size)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(buffer));
+        buffer_size = buffer_demand;
+        RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    }
+
+    return rocsparse_status_success;
+}
+
+/*******************************************************************************
+ * Exchange the scratch buffer and its suballocator state with the given per
+ * pool stream slot. The host side release bookkeeping of buffer_free() is
+ * only safe when all work using a scratch region runs on a single stream,
+ * so a concurrent call group swaps the scratch buffer alongside the handle
+ * stream, see rocsparse_concurrent_branch().
+ ******************************************************************************/
+void _rocsparse_handle::swap_buffer_state(_rocsparse_buffer_state& state)
+{
+    std::swap(buffer, state.ptr);
+    std::swap(buffer_size, state.size);
+    std::swap(buffer_offset, state.offset);
+    buffer_stack.swap(state.stack);
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
+ * data gathered during csrmv_analysis. It must be initialized using the
+ * rocsparse_create_csrmv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csrmv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrmv_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Drop a reference to a csrmv analysis and release it once the last
+ * reference is gone.
+ *******************************************************************************/
+rocsparse_status rocsparse_release_csrmv_analysis_data(_rocsparse_csrmv_analysis_data* data)
+{
+    if(data == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(data->refcount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up row blocks
+    if(data->size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->row_blocks));
+    }
+
+    // Clean up narrowed column indices
+    if(data->csr_col_ind_narrow != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->csr_col_ind_narrow));
+    }
+
+    // Clean up delta compressed column indices
+    if(data->col_base != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->col_base));
+    }
+    if(data->col_delta != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->col_delta));
+    }
+
+    // Clean up row length bins
+    if(data->bin_rows != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->bin_rows));
+    }
+
+    // Clean up oversubscription panel boundaries
+    delete[] data->panel_block;
+    delete[] data->panel_nnz;
+
+    // Clean up column panel intersections
+    if(data->col_panel_rows != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->col_panel_rows));
+    }
+    if(data->col_panel_begin != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(data->col_panel_begin));
+    }
+    delete[] data->col_panel_ptr;
+
+    delete data;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Destroy csrmv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Drop the reference to the shared analysis results
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_release_csrmv_analysis_data(info->data));
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_spmv_info is a structure holding the rocsparse spmv info
+ * data gathered during spmv_analysis. It must be initialized using the
+ * rocsparse_create_spmv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_spmv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_spmv_info(rocsparse_spmv_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
     }
     else
     {
-        layer_mode = (rocsparse_layer_mode)(atoi(str_layer_mode));
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_spmv_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
     }
+}
 
-    // Obtain size for coomv device buffer
-    rocsparse_int nthreads = properties.maxThreadsPerBlock;
-    rocsparse_int nprocs   = properties.multiProcessorCount;
-    rocsparse_int nblocks  = (nprocs * nthreads - 1) / 128 + 1;
-    rocsparse_int nwfs     = nblocks * (128 / properties.warpSize);
+/********************************************************************************
+ * \brief Destroy spmv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_spmv_info(rocsparse_spmv_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
 
-    size_t coomv_size = (((sizeof(rocsparse_int) + 16) * nwfs - 1) / 256 + 1) * 256;
+    // Clean up the internal representation
+    if(info->hyb != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_hyb_mat(info->hyb));
+    }
 
-    // Allocate device buffer
-    buffer_size = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
-    THROW_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    if(info->coo_row_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->coo_row_ind));
+    }
 
-    // Device one
-    THROW_IF_HIP_ERROR(hipMalloc(&sone, sizeof(float)));
-    THROW_IF_HIP_ERROR(hipMalloc(&done, sizeof(double)));
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
 
-    // Execute empty kernel for initialization
-    hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, stream);
+/********************************************************************************
+ * \brief rocsparse_csrtr_info is a structure holding the rocsparse csrsv and
+ * csrilu0 data gathered during csrsv_analysis and csrilu0_analysis. It must be
+ * initialized using the rocsparse_create_csrtr_info() routine. It should be
+ * destroyed at the end using rocsparse_destroy_csrtr_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrtr_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
 
-    // Execute memset for initialization
-    THROW_IF_HIP_ERROR(hipMemsetAsync(sone, 0, sizeof(float), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(done, 0, sizeof(double), stream));
+/********************************************************************************
+ * \brief Destroy csrmv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
 
-    float  hsone = 1.0f;
-    double hdone = 1.0;
+    // Clean up
+    if(info->row_map != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->row_map));
+        info->row_map = nullptr;
+    }
 
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(sone, &hsone, sizeof(float), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(done, &hdone, sizeof(double), hipMemcpyHostToDevice, stream));
+    if(info->csr_diag_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csr_diag_ind));
+        info->csr_diag_ind = nullptr;
+    }
 
-    // Wait for device transfer to finish
-    THROW_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    if(info->zero_pivot != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->zero_pivot));
+        info->zero_pivot = nullptr;
+    }
 
-    // Open log file
-    if(layer_mode & rocsparse_layer_mode_log_trace)
+    if(info->inv_diag != nullptr)
     {
-        open_log_stream(&log_trace_os, &log_trace_ofs, "ROCSPARSE_LOG_TRACE_PATH");
+        RETURN_IF_HIP_ERROR(hipFree(info->inv_diag));
+        info->inv_diag = nullptr;
     }
 
-    // Open log_bench file
-    if(layer_mode & rocsparse_layer_mode_log_bench)
+    if(info->level_ptr != nullptr)
     {
-        open_log_stream(&log_bench_os, &log_bench_ofs, "ROCSPARSE_LOG_BENCH_PATH");
+        delete[] info->level_ptr;
+        info->level_ptr = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
     }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
 }
 
-/*******************************************************************************
- * destructor
- ******************************************************************************/
-_rocsparse_handle::~_rocsparse_handle()
+/********************************************************************************
+ * \brief rocsparse_csr2csc_info is a structure holding the nnz permutation
+ * gathered during csr2csc_analysis. It must be initialized using the
+ * rocsparse_create_csr2csc_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csr2csc_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csr2csc_info(rocsparse_csr2csc_info* info)
 {
-    PRINT_IF_HIP_ERROR(hipFree(buffer));
-    PRINT_IF_HIP_ERROR(hipFree(sone));
-    PRINT_IF_HIP_ERROR(hipFree(done));
-
-    // Close log files
-    if(log_trace_ofs.is_open())
+    if(info == nullptr)
     {
-        log_trace_ofs.close();
+        return rocsparse_status_invalid_pointer;
     }
-    if(log_bench_ofs.is_open())
+    else
     {
-        log_bench_ofs.close();
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csr2csc_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
     }
 }
 
-/*******************************************************************************
- * Exactly like cuSPARSE, rocSPARSE only uses one stream for one API routine
- ******************************************************************************/
-
-/*******************************************************************************
- * set stream:
-   This API assumes user has already created a valid stream
-   Associate the following rocsparse API call with this user provided stream
- ******************************************************************************/
-rocsparse_status _rocsparse_handle::set_stream(hipStream_t user_stream)
+/********************************************************************************
+ * \brief Destroy csr2csc info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csr2csc_info(rocsparse_csr2csc_info info)
 {
-    // TODO check if stream is valid
-    stream = user_stream;
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up
+    if(info->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->perm));
+        info->perm = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
     return rocsparse_status_success;
 }
 
-/*******************************************************************************
- * get stream
- ******************************************************************************/
-rocsparse_status _rocsparse_handle::get_stream(hipStream_t* user_stream) const
+/********************************************************************************
+ * \brief rocsparse_csrupd_info is a structure holding the sparsity pattern
+ * hash index gathered during csr_update_analysis. It must be initialized
+ * using the rocsparse_create_csrupd_info() routine. It should be destroyed
+ * at the end using rocsparse_destroy_csrupd_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrupd_info(rocsparse_csrupd_info* info)
 {
-    *user_stream = stream;
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrupd_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy csrupd info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrupd_info(rocsparse_csrupd_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up
+    if(info->table != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->table));
+        info->table = nullptr;
+    }
+
+    if(info->data != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->data));
+        info->data = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
     return rocsparse_status_success;
 }
 
 /********************************************************************************
- * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
- * data gathered during csrmv_analysis. It must be initialized using the
- * rocsparse_create_csrmv_info() routine. It should be destroyed at the end
- * using rocsparse_destroy_csrmv_info().
+ * \brief rocsparse_csriluk_info is a structure holding the factorization
+ * pattern gathered during csriluk_nnz. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
  *******************************************************************************/
-rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info)
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info)
 {
     if(info == nullptr)
     {
@@ -159,7 +1087,7 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info)
         // Allocate
         try
         {
-            *info = new _rocsparse_csrmv_info;
+            *info = new _rocsparse_csriluk_info;
         }
         catch(const rocsparse_status& status)
         {
@@ -170,19 +1098,32 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info)
 }
 
 /********************************************************************************
- * \brief Destroy csrmv info.
+ * \brief Destroy csriluk info.
  *******************************************************************************/
-rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info)
 {
     if(info == nullptr)
     {
         return rocsparse_status_success;
     }
 
-    // Clean up row blocks
-    if(info->size > 0)
+    // Clean up
+    if(info->row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->row_ptr));
+        info->row_ptr = nullptr;
+    }
+
+    if(info->col_ind != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->row_blocks));
+        RETURN_IF_HIP_ERROR(hipFree(info->col_ind));
+        info->col_ind = nullptr;
+    }
+
+    if(info->csrtr_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrtr_info));
+        info->csrtr_info = nullptr;
     }
 
     // Destruct
@@ -198,12 +1139,12 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
 }
 
 /********************************************************************************
- * \brief rocsparse_csrtr_info is a structure holding the rocsparse csrsv and
- * csrilu0 data gathered during csrsv_analysis and csrilu0_analysis. It must be
- * initialized using the rocsparse_create_csrtr_info() routine. It should be
- * destroyed at the end using rocsparse_destroy_csrtr_info().
+ * \brief rocsparse_csrilut_info is a structure holding the factorization
+ * computed during csrilut_nnz. It must be initialized using the
+ * rocsparse_create_csrilut_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csrilut_info().
  *******************************************************************************/
-rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info)
+rocsparse_status rocsparse_create_csrilut_info(rocsparse_csrilut_info* info)
 {
     if(info == nullptr)
     {
@@ -214,7 +1155,7 @@ rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info)
         // Allocate
         try
         {
-            *info = new _rocsparse_csrtr_info;
+            *info = new _rocsparse_csrilut_info;
         }
         catch(const rocsparse_status& status)
         {
@@ -225,9 +1166,9 @@ rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info)
 }
 
 /********************************************************************************
- * \brief Destroy csrmv info.
+ * \brief Destroy csrilut info.
  *******************************************************************************/
-rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
+rocsparse_status rocsparse_destroy_csrilut_info(rocsparse_csrilut_info info)
 {
     if(info == nullptr)
     {
@@ -235,22 +1176,22 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
     }
 
     // Clean up
-    if(info->row_map != nullptr)
+    if(info->row_ptr != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->row_map));
-        info->row_map = nullptr;
+        RETURN_IF_HIP_ERROR(hipFree(info->row_ptr));
+        info->row_ptr = nullptr;
     }
 
-    if(info->csr_diag_ind != nullptr)
+    if(info->col_ind != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->csr_diag_ind));
-        info->csr_diag_ind = nullptr;
+        RETURN_IF_HIP_ERROR(hipFree(info->col_ind));
+        info->col_ind = nullptr;
     }
 
-    if(info->zero_pivot != nullptr)
+    if(info->val != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->zero_pivot));
-        info->zero_pivot = nullptr;
+        RETURN_IF_HIP_ERROR(hipFree(info->val));
+        info->val = nullptr;
     }
 
     // Destruct
@@ -43,6 +43,71 @@ __device__ __forceinline__ void rocsparse_nontemporal_store(rocsparse_int val, r
 __device__ __forceinline__ float rocsparse_fma(float p, float q, float r) { return fma(p, q, r); }
 __device__ __forceinline__ double rocsparse_fma(double p, double q, double r) { return fma(p, q, r); }
 
+// Interleaved complex overloads, operating on the real and imaginary component
+__device__ __forceinline__ rocsparse_float_complex rocsparse_ldg(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__ldg(&ptr->x), __ldg(&ptr->y)); }
+__device__ __forceinline__ rocsparse_double_complex rocsparse_ldg(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__ldg(&ptr->x), __ldg(&ptr->y)); }
+
+__device__ __forceinline__ rocsparse_float_complex rocsparse_nontemporal_load(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__builtin_nontemporal_load(&ptr->x), __builtin_nontemporal_load(&ptr->y)); }
+__device__ __forceinline__ rocsparse_double_complex rocsparse_nontemporal_load(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__builtin_nontemporal_load(&ptr->x), __builtin_nontemporal_load(&ptr->y)); }
+
+__device__ __forceinline__ void rocsparse_nontemporal_store(rocsparse_float_complex val, rocsparse_float_complex* ptr) { __builtin_nontemporal_store(val.x, &ptr->x); __builtin_nontemporal_store(val.y, &ptr->y); }
+__device__ __forceinline__ void rocsparse_nontemporal_store(rocsparse_double_complex val, rocsparse_double_complex* ptr) { __builtin_nontemporal_store(val.x, &ptr->x); __builtin_nontemporal_store(val.y, &ptr->y); }
+
+// Fused multiply-add on the complex components, r + p * q
+__device__ __forceinline__ rocsparse_float_complex rocsparse_fma(rocsparse_float_complex p, rocsparse_float_complex q, rocsparse_float_complex r) { return rocsparse_float_complex(fma(-p.y, q.y, fma(p.x, q.x, r.x)), fma(p.y, q.x, fma(p.x, q.y, r.y))); }
+__device__ __forceinline__ rocsparse_double_complex rocsparse_fma(rocsparse_double_complex p, rocsparse_double_complex q, rocsparse_double_complex r) { return rocsparse_double_complex(fma(-p.y, q.y, fma(p.x, q.x, r.x)), fma(p.y, q.x, fma(p.x, q.y, r.y))); }
+
+// Componentwise atomic addition for complex values
+__device__ __forceinline__ void atomicAdd(rocsparse_float_complex* ptr, rocsparse_float_complex val) { atomicAdd(&ptr->x, val.x); atomicAdd(&ptr->y, val.y); }
+__device__ __forceinline__ void atomicAdd(rocsparse_double_complex* ptr, rocsparse_double_complex val) { atomicAdd(&ptr->x, val.x); atomicAdd(&ptr->y, val.y); }
+
+// 64-bit signed atomics for ILP64 index arrays. Addition coincides with the
+// unsigned primitive in two's complement, min and max order on the signed
+// value through a CAS loop
+__device__ __forceinline__ int64_t atomicAdd(int64_t* ptr, int64_t val) { return (int64_t)atomicAdd((unsigned long long*)ptr, (unsigned long long)val); }
+__device__ __forceinline__ int64_t atomicMin(int64_t* ptr, int64_t val)
+{
+    unsigned long long* uptr = (unsigned long long*)ptr;
+    unsigned long long  old  = *uptr;
+    unsigned long long  assumed;
+
+    do
+    {
+        assumed = old;
+        if((int64_t)assumed <= val)
+        {
+            break;
+        }
+        old = atomicCAS(uptr, assumed, (unsigned long long)val);
+    } while(assumed != old);
+
+    return (int64_t)old;
+}
+__device__ __forceinline__ int64_t atomicMax(int64_t* ptr, int64_t val)
+{
+    unsigned long long* uptr = (unsigned long long*)ptr;
+    unsigned long long  old  = *uptr;
+    unsigned long long  assumed;
+
+    do
+    {
+        assumed = old;
+        if((int64_t)assumed >= val)
+        {
+            break;
+        }
+        old = atomicCAS(uptr, assumed, (unsigned long long)val);
+    } while(assumed != old);
+
+    return (int64_t)old;
+}
+
+// Complex conjugate, identity for real types
+__device__ __forceinline__ float rocsparse_conj(float val) { return val; }
+__device__ __forceinline__ double rocsparse_conj(double val) { return val; }
+__device__ __forceinline__ rocsparse_float_complex rocsparse_conj(rocsparse_float_complex val) { return rocsparse_float_complex(val.x, -val.y); }
+__device__ __forceinline__ rocsparse_double_complex rocsparse_conj(rocsparse_double_complex val) { return rocsparse_double_complex(val.x, -val.y); }
+
 __device__ __forceinline__ float rocsparse_rcp(float val) { return 1.0f / val; }
 __device__ __forceinline__ double rocsparse_rcp(double val) { return 1.0 / val; }
 
@@ -51,6 +116,27 @@ __device__ __forceinline__ int64_t rocsparse_mul24(int64_t x, int64_t y) { retur
 
 __device__ __forceinline__ rocsparse_int rocsparse_mad24(rocsparse_int x, rocsparse_int y, rocsparse_int z) { return rocsparse_mul24(x, y) + z; }
 
+__device__ __forceinline__ float rocsparse_shfl(float var, int src_lane, int width) { return __shfl(var, src_lane, width); }
+__device__ __forceinline__ double rocsparse_shfl(double var, int src_lane, int width) { return __shfl(var, src_lane, width); }
+__device__ __forceinline__ rocsparse_int rocsparse_shfl(rocsparse_int var, int src_lane, int width) { return __shfl(var, src_lane, width); }
+
+__device__ __forceinline__ float rocsparse_shfl_up(float var, unsigned int delta, int width) { return __shfl_up(var, delta, width); }
+__device__ __forceinline__ double rocsparse_shfl_up(double var, unsigned int delta, int width) { return __shfl_up(var, delta, width); }
+__device__ __forceinline__ rocsparse_int rocsparse_shfl_up(rocsparse_int var, unsigned int delta, int width) { return __shfl_up(var, delta, width); }
+
+__device__ __forceinline__ float rocsparse_shfl_down(float var, unsigned int delta, int width) { return __shfl_down(var, delta, width); }
+__device__ __forceinline__ double rocsparse_shfl_down(double var, unsigned int delta, int width) { return __shfl_down(var, delta, width); }
+__device__ __forceinline__ rocsparse_int rocsparse_shfl_down(rocsparse_int var, unsigned int delta, int width) { return __shfl_down(var, delta, width); }
+
+__device__ __forceinline__ rocsparse_float_complex rocsparse_shfl(rocsparse_float_complex var, int src_lane, int width) { return rocsparse_float_complex(__shfl(var.x, src_lane, width), __shfl(var.y, src_lane, width)); }
+__device__ __forceinline__ rocsparse_double_complex rocsparse_shfl(rocsparse_double_complex var, int src_lane, int width) { return rocsparse_double_complex(__shfl(var.x, src_lane, width), __shfl(var.y, src_lane, width)); }
+
+__device__ __forceinline__ rocsparse_float_complex rocsparse_shfl_up(rocsparse_float_complex var, unsigned int delta, int width) { return rocsparse_float_complex(__shfl_up(var.x, delta, width), __shfl_up(var.y, delta, width)); }
+__device__ __forceinline__ rocsparse_double_complex rocsparse_shfl_up(rocsparse_double_complex var, unsigned int delta, int width) { return rocsparse_double_complex(__shfl_up(var.x, delta, width), __shfl_up(var.y, delta, width)); }
+
+__device__ __forceinline__ rocsparse_float_complex rocsparse_shfl_down(rocsparse_float_complex var, unsigned int delta, int width) { return rocsparse_float_complex(__shfl_down(var.x, delta, width), __shfl_down(var.y, delta, width)); }
+__device__ __forceinline__ rocsparse_double_complex rocsparse_shfl_down(rocsparse_double_complex var, unsigned int delta, int width) { return rocsparse_double_complex(__shfl_down(var.x, delta, width), __shfl_down(var.y, delta, width)); }
+
 __device__ __forceinline__ int rocsparse_atomic_load(const int* ptr, int memorder) { return __atomic_load_n(ptr, memorder); }
 
 __device__ __forceinline__ void rocsparse_atomic_store(int* ptr, int val, int memorder) { __atomic_store_n(ptr, val, memorder); }
@@ -87,6 +173,22 @@ __device__ __forceinline__ void rocsparse_blockreduce_max(int i, T* data)
     if(BLOCKSIZE >   1) { if(i <   1 && i +   1 < BLOCKSIZE) { data[i] = max(data[i], data[i +   1]); } __syncthreads(); }
 }
 
+// Block reduce kernel computing blockwide minimum entry
+template <typename T, unsigned int BLOCKSIZE>
+__device__ __forceinline__ void rocsparse_blockreduce_min(int i, T* data)
+{
+    if(BLOCKSIZE > 512) { if(i < 512 && i + 512 < BLOCKSIZE) { data[i] = min(data[i], data[i + 512]); } __syncthreads(); }
+    if(BLOCKSIZE > 256) { if(i < 256 && i + 256 < BLOCKSIZE) { data[i] = min(data[i], data[i + 256]); } __syncthreads(); }
+    if(BLOCKSIZE > 128) { if(i < 128 && i + 128 < BLOCKSIZE) { data[i] = min(data[i], data[i + 128]); } __syncthreads(); }
+    if(BLOCKSIZE >  64) { if(i <  64 && i +  64 < BLOCKSIZE) { data[i] = min(data[i], data[i +  64]); } __syncthreads(); }
+    if(BLOCKSIZE >  32) { if(i <  32 && i +  32 < BLOCKSIZE) { data[i] = min(data[i], data[i +  32]); } __syncthreads(); }
+    if(BLOCKSIZE >  16) { if(i <  16 && i +  16 < BLOCKSIZE) { data[i] = min(data[i], data[i +  16]); } __syncthreads(); }
+    if(BLOCKSIZE >   8) { if(i <   8 && i +   8 < BLOCKSIZE) { data[i] = min(data[i], data[i +   8]); } __syncthreads(); }
+    if(BLOCKSIZE >   4) { if(i <   4 && i +   4 < BLOCKSIZE) { data[i] = min(data[i], data[i +   4]); } __syncthreads(); }
+    if(BLOCKSIZE >   2) { if(i <   2 && i +   2 < BLOCKSIZE) { data[i] = min(data[i], data[i +   2]); } __syncthreads(); }
+    if(BLOCKSIZE >   1) { if(i <   1 && i +   1 < BLOCKSIZE) { data[i] = min(data[i], data[i +   1]); } __syncthreads(); }
+}
+
 // DPP-based wavefront reduction combination of sum and max
 template <unsigned int WFSIZE>
 __device__ __forceinline__ void rocsparse_wfreduce_max(int* maximum)
@@ -212,6 +314,110 @@ __device__ __forceinline__ double rocsparse_wfreduce_sum(double sum)
     sum = temp_sum.val;
     return sum;
 }
+
+// Complex wavefront reduction, reducing real and imaginary part separately
+template <unsigned int WFSIZE>
+__device__ __forceinline__ rocsparse_float_complex rocsparse_wfreduce_sum(rocsparse_float_complex sum)
+{
+    return rocsparse_float_complex(rocsparse_wfreduce_sum<WFSIZE>(sum.x), rocsparse_wfreduce_sum<WFSIZE>(sum.y));
+}
+
+template <unsigned int WFSIZE>
+__device__ __forceinline__ rocsparse_double_complex rocsparse_wfreduce_sum(rocsparse_double_complex sum)
+{
+    return rocsparse_double_complex(rocsparse_wfreduce_sum<WFSIZE>(sum.x), rocsparse_wfreduce_sum<WFSIZE>(sum.y));
+}
 // clang-format on
 
+// Block reduction computing the block-wide sum of the per-thread values.
+// The intra-wavefront steps are performed by the DPP wavefront reduction
+// in registers, only one partial per wavefront goes through the LDS
+// staging array, which must hold at least BLOCKSIZE / WFSIZE entries.
+// Compared to rocsparse_blockreduce_sum, this requires two instead of
+// log2(BLOCKSIZE) barriers. A sub-wavefront size of 32 is valid on both
+// 32 and 64 wide hardware wavefronts, such that callers that do not
+// dispatch on the wavefront size can pass WFSIZE 32 unconditionally.
+// The block-wide sum is returned to all threads of the block
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__device__ __forceinline__ T rocsparse_blockreduce_wf_sum(int i, T val, T* partial)
+{
+    // Intra-wavefront reduction, lane WFSIZE - 1 holds the wavefront sum
+    val = rocsparse_wfreduce_sum<WFSIZE>(val);
+
+    if((i & (WFSIZE - 1)) == WFSIZE - 1)
+    {
+        partial[i / WFSIZE] = val;
+    }
+
+    __syncthreads();
+
+    // The first wavefront combines the per-wavefront partials
+    if(i < BLOCKSIZE / WFSIZE)
+    {
+        val = rocsparse_wfreduce_sum<BLOCKSIZE / WFSIZE>(partial[i]);
+
+        if(i == BLOCKSIZE / WFSIZE - 1)
+        {
+            partial[0] = val;
+        }
+    }
+
+    __syncthreads();
+
+    return partial[0];
+}
+
+// Grid-wide synchronization for persistent kernels. All blocks of the grid
+// must be resident on the device, or the barrier will deadlock. The
+// monotonically increasing generation counter avoids reset races between
+// subsequent barriers
+__device__ __forceinline__ void rocsparse_grid_barrier(int* count, int* generation, int iter)
+{
+    __syncthreads();
+
+    if(hipThreadIdx_x == 0)
+    {
+        __threadfence();
+
+        if(atomicAdd(count, 1) == (iter + 1) * (int)hipGridDim_x - 1)
+        {
+            rocsparse_atomic_store(generation, iter + 1, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            while(rocsparse_atomic_load(generation, __ATOMIC_ACQUIRE) <= iter)
+            {
+            }
+        }
+    }
+
+    __syncthreads();
+}
+
+// Fused elementwise epilogue hook of the SpMV and SpMM output stages. The
+// compile time flags select diagonal scale, vector subtract and clamp,
+// applied in this order, such that the composition is resolved at
+// instantiation time and unused operands are never read
+template <typename T, bool DIAG, bool SUB, bool CLAMP>
+__device__ __forceinline__ T rocsparse_epilogue_apply(
+    rocsparse_int row, T val, const T* diag, const T* vec, T clamp_lo, T clamp_hi)
+{
+    if(DIAG)
+    {
+        val *= rocsparse_ldg(diag + row);
+    }
+
+    if(SUB)
+    {
+        val -= rocsparse_ldg(vec + row);
+    }
+
+    if(CLAMP)
+    {
+        val = (val < clamp_lo) ? clamp_lo : (val > clamp_hi) ? clamp_hi : val;
+    }
+
+    return val;
+}
+
 #endif // COMMON_H
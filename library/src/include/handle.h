@@ -25,16 +25,143 @@
 #ifndef HANDLE_H
 #define HANDLE_H
 
+#include "definitions.h"
 #include "rocsparse.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <hip/hip_runtime_api.h>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 /*! \brief typedefs to opaque info structs */
+struct _rocsparse_csrmv_analysis_data;
 typedef struct _rocsparse_csrmv_info* rocsparse_csrmv_info;
 typedef struct _rocsparse_csrtr_info* rocsparse_csrtr_info;
+typedef struct _rocsparse_csriluk_info* rocsparse_csriluk_info;
+typedef struct _rocsparse_csrilut_info* rocsparse_csrilut_info;
+typedef struct _rocsparse_spmv_info*  rocsparse_spmv_info;
+typedef struct _rocsparse_csr2csc_info* rocsparse_csr2csc_info;
+typedef struct _rocsparse_csrupd_info* rocsparse_csrupd_info;
+
+/********************************************************************************
+ * \brief Bounded multi-producer single-consumer queue of formatted log
+ * entries. Producers claim a slot with a single atomic compare-and-swap and
+ * publish it through the slot sequence number, so logging API threads never
+ * take a lock. The queue is drained to the log streams by a background
+ * thread owned by the handle.
+ *******************************************************************************/
+struct _rocsparse_log_queue
+{
+    // queue capacity, must be a power of two
+    static const size_t capacity = 4096;
+
+    struct entry
+    {
+        std::atomic<size_t> sequence;
+        std::ostream*       os;
+        std::string         payload;
+    };
+
+    _rocsparse_log_queue()
+    {
+        for(size_t i = 0; i < capacity; ++i)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos.store(0, std::memory_order_relaxed);
+        dequeue_pos = 0;
+    }
+
+    // Producer side, fails if the queue is full
+    bool try_push(std::ostream* os, std::string& payload)
+    {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+
+        for(;;)
+        {
+            entry& e = slots[pos & (capacity - 1)];
+
+            size_t    seq  = e.sequence.load(std::memory_order_acquire);
+            ptrdiff_t diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(pos);
+
+            if(diff == 0)
+            {
+                // Claim the slot
+                if(enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    e.os      = os;
+                    e.payload = std::move(payload);
+
+                    // Publish the slot to the consumer
+                    e.sequence.store(pos + 1, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if(diff < 0)
+            {
+                // Queue is full
+                return false;
+            }
+            else
+            {
+                // Slot was claimed by another producer
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer side, must only be called from the drain thread
+    bool try_pop(std::ostream** os, std::string* payload)
+    {
+        entry& e = slots[dequeue_pos & (capacity - 1)];
+
+        size_t    seq  = e.sequence.load(std::memory_order_acquire);
+        ptrdiff_t diff = static_cast<ptrdiff_t>(seq) - static_cast<ptrdiff_t>(dequeue_pos + 1);
+
+        if(diff < 0)
+        {
+            // Queue is empty
+            return false;
+        }
+
+        *os      = e.os;
+        *payload = std::move(e.payload);
+
+        // Hand the slot back to the producers
+        e.sequence.store(dequeue_pos + capacity, std::memory_order_release);
+        ++dequeue_pos;
+
+        return true;
+    }
+
+    entry               slots[capacity];
+    std::atomic<size_t> enqueue_pos;
+    size_t              dequeue_pos;
+};
+
+/*! \brief typedef to the opaque shared per-device state */
+typedef struct _rocsparse_device_context* rocsparse_device_context;
+
+/********************************************************************************
+ * \brief Suballocator state of one scratch buffer, see
+ * _rocsparse_handle::buffer_alloc(). The handle owns one such state per pool
+ * stream in addition to the user facing one, such that grouped calls on
+ * different pool streams never share a scratch region.
+ *******************************************************************************/
+struct _rocsparse_buffer_state
+{
+    size_t              size   = 0;
+    void*               ptr    = nullptr;
+    size_t              offset = 0;
+    std::vector<size_t> stack;
+};
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -42,6 +169,14 @@ typedef struct _rocsparse_csrtr_info* rocsparse_csrtr_info;
  * and the returned handle must be passed
  * to all subsequent library function calls.
  * It should be destroyed at the end using rocsparse_destroy_handle().
+ *
+ * State that is expensive to create and identical for every handle on a
+ * device (the device properties and the staged one constants) lives in a
+ * shared, immutable per-device context, such that handle creation is cheap
+ * after the first handle. Multi-threaded schedulers should create one handle
+ * per worker thread, each with its own stream; the remaining members (stream,
+ * pointer mode, device buffer, scalar ring) form the mutable per-thread
+ * context of a handle and must not be used concurrently.
  *******************************************************************************/
 struct _rocsparse_handle
 {
@@ -55,6 +190,84 @@ struct _rocsparse_handle
     // get stream
     rocsparse_status get_stream(hipStream_t* user_stream) const;
 
+    // allocate the device buffer, the scalar ring and the staged one
+    // constants on first use ; handle creation itself performs no device
+    // allocations
+    rocsparse_status ensure_device_memory(void);
+
+    // allocate temporary device memory from the handle buffer
+    rocsparse_status buffer_alloc(size_t nbytes, void** dev_ptr);
+    // release temporary device memory, in reverse allocation order
+    rocsparse_status buffer_free(void* dev_ptr);
+    // exchange the scratch buffer and its suballocator state with the
+    // given slot, used when a concurrent call group switches pool streams
+    void swap_buffer_state(_rocsparse_buffer_state& state);
+
+    // hand a formatted log entry over to the logging thread
+    void log_enqueue(std::ostream* os, std::string&& payload);
+    // drain loop of the logging thread
+    void log_drain();
+
+    // record the start of a profiled operation
+    rocsparse_status profile_begin();
+    // record the end of a profiled operation and accumulate its statistics
+    rocsparse_status profile_end(const std::string& name, double nbytes);
+
+    // look up a cached csrmv analysis by its pattern fingerprint ; on a
+    // hit, a reference is acquired for the caller
+    _rocsparse_csrmv_analysis_data* csrmv_cache_lookup(uint64_t      hash,
+                                                       rocsparse_int m,
+                                                       rocsparse_int n,
+                                                       rocsparse_int nnz);
+    // insert a csrmv analysis, acquiring a reference for the cache and
+    // evicting the least recently used entry when the cache is full
+    rocsparse_status csrmv_cache_insert(_rocsparse_csrmv_analysis_data* data);
+
+    // stage alpha and beta in a slot of the device scalar ring, such that a
+    // single kernel instantiation taking device pointers serves both pointer
+    // modes. In device pointer mode, the user pointers are passed through
+    template <typename T>
+    rocsparse_status
+        stage_scalars(const T* alpha, const T* beta, const T** d_alpha, const T** d_beta)
+    {
+        if(pointer_mode == rocsparse_pointer_mode_device)
+        {
+            *d_alpha = alpha;
+            *d_beta  = beta;
+
+            return rocsparse_status_success;
+        }
+
+        // Allocate the scalar ring on first use
+        RETURN_IF_ROCSPARSE_ERROR(ensure_device_memory());
+
+        // Once all slots are in flight, wait for the device to catch up
+        // before the first slot is reused. This costs one synchronization
+        // per scalar_ring_slots stagings
+        if(scalar_ring_head == scalar_ring_slots)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+            scalar_ring_head = 0;
+        }
+
+        char* host_slot = scalar_ring_host + scalar_ring_head * scalar_ring_width;
+        char* dev_slot  = scalar_ring + scalar_ring_head * scalar_ring_width;
+
+        ++scalar_ring_head;
+
+        // Fill the pinned host mirror and copy both scalars in one transfer
+        reinterpret_cast<T*>(host_slot)[0] = *alpha;
+        reinterpret_cast<T*>(host_slot)[1] = *beta;
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(dev_slot, host_slot, sizeof(T) * 2, hipMemcpyHostToDevice, stream));
+
+        *d_alpha = reinterpret_cast<const T*>(dev_slot);
+        *d_beta  = reinterpret_cast<const T*>(dev_slot) + 1;
+
+        return rocsparse_status_success;
+    }
+
     // device id
     int device;
     // device properties
@@ -65,20 +278,142 @@ struct _rocsparse_handle
     hipStream_t stream = 0;
     // pointer mode ; default mode is host
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+    // atomics mode ; default mode allows atomic updates
+    rocsparse_atomics_mode atomics_mode = rocsparse_atomics_allowed;
     // logging mode
     rocsparse_layer_mode layer_mode;
-    // device buffer
-    size_t buffer_size;
-    void*  buffer;
-    // device one
-    float*  sone;
-    double* done;
+    // adaptive csrmv tuning variant override, selected at handle creation
+    // from the ROCSPARSE_CSRMV_TUNING environment variable or the
+    // per-architecture selection table named by ROCSPARSE_TUNING_TABLE;
+    // -1 keeps the built-in architecture based selection
+    int csrmv_tuning_override = -1;
+    // online csrmv kernel selection probing, enabled at handle creation
+    // through the ROCSPARSE_CSRMV_PROBE environment variable. The first
+    // calls for an analyzed matrix time the analyzed and the general
+    // kernel against each other and lock in the faster one
+    bool csrmv_probe = false;
+    // managed memory prefetch ; stream and event used to overlap the
+    // hipMemPrefetchAsync of upcoming row panels with the compute of the
+    // current one, created on first use
+    hipStream_t prefetch_stream = nullptr;
+    hipEvent_t  prefetch_done   = nullptr;
+    // stream pool for concurrent call groups ; created on first use by
+    // rocsparse_concurrent_begin(). While a group is open, the handle
+    // stream is swapped to a pool stream such that every routine launched
+    // inside the group picks it up transparently, the user stream is kept
+    // in pool_saved_stream for the duration of the group
+    static const int         stream_pool_size = 4;
+    std::vector<hipStream_t> pool_streams;
+    std::vector<hipEvent_t>  pool_events;
+    // event forking the pool streams off the user stream
+    hipEvent_t  pool_fork_event   = nullptr;
+    hipStream_t pool_saved_stream = 0;
+    // active pool stream ; -1 outside of a group
+    int pool_index = -1;
+    // pool streams used by the current group
+    int pool_used = 0;
+    // per pool stream scratch buffers ; while a group is open, the handle
+    // scratch buffer is swapped alongside the stream, since the release of
+    // a suballocation is host side bookkeeping that is only safe when all
+    // work using the region runs on a single stream. Library internal
+    // temporaries (csrmv merge path, csrsv workspaces, coomv scratch) live
+    // in the scratch buffer as well, so grouped calls must not share it.
+    // The user facing state is parked in pool_saved_buffer for the
+    // duration of the group
+    std::vector<_rocsparse_buffer_state> pool_buffer_states;
+    _rocsparse_buffer_state              pool_saved_buffer;
+    // priority stream for latency critical calls ; created on first use by
+    // rocsparse_priority_begin() with the greatest priority the device
+    // offers. While a section is open, the handle stream is swapped to the
+    // priority stream, such that designated small calls overtake the long
+    // running kernels queued on the user stream. The user stream is
+    // ordered behind the section once rocsparse_priority_end() is called
+    hipStream_t priority_stream       = nullptr;
+    hipStream_t priority_saved_stream = 0;
+    // event joining the section back into the user stream
+    hipEvent_t priority_join_event = nullptr;
+    // a priority section is open
+    bool priority_active = false;
+    // device buffer ; sized at handle creation, allocated on first use
+    size_t buffer_size = 0;
+    void*  buffer      = nullptr;
+    // suballocator state ; bump offset into the buffer, outstanding
+    // allocation offsets and the largest demand observed so far
+    size_t              buffer_offset = 0;
+    size_t              buffer_demand = 0;
+    std::vector<size_t> buffer_stack;
+    // temporary memory accounting ; bytes of outstanding suballocations and
+    // fallback allocations, and the peak observed since handle creation or
+    // the last rocsparse_memory_reset(), such that memory regressions can
+    // be gated like speed regressions. Fallback allocations carry their
+    // size, as hipFree does not report it on release
+    size_t                                temp_in_use = 0;
+    size_t                                temp_peak   = 0;
+    std::vector<std::pair<void*, size_t>> fallback_sizes;
+    // device one ; points into the shared device context, staged on first
+    // use
+    float*  sone = nullptr;
+    double* done = nullptr;
+    // shared immutable per-device state
+    rocsparse_device_context device_context = nullptr;
+    // device scalar ring ; number of slots and slot width in bytes, a slot
+    // holds an alpha/beta pair of any supported precision
+    static const size_t scalar_ring_slots = 512;
+    static const size_t scalar_ring_width = 32;
+    // ring memory, its pinned host mirror and the next free slot
+    char*  scalar_ring      = nullptr;
+    char*  scalar_ring_host = nullptr;
+    size_t scalar_ring_head = 0;
+    // pinned staging ring for chunked asynchronous host to device uploads,
+    // allocated on first use and retained for the handle lifetime. Two
+    // slots alternate, such that filling one overlaps with the transfer of
+    // the other, the events gate the recycling of a slot
+    static const size_t upload_chunk_size = 1 << 25;
+
+    char*      upload_ring[2] = {nullptr, nullptr};
+    hipEvent_t upload_done[2] = {nullptr, nullptr};
+    bool       upload_used[2] = {false, false};
+    int        upload_head    = 0;
 
     // logging streams
     std::ofstream log_trace_ofs;
     std::ofstream log_bench_ofs;
     std::ostream* log_trace_os = nullptr;
     std::ostream* log_bench_os = nullptr;
+
+    // asynchronous kernel preloading ; started at most once by
+    // rocsparse_initialize() and joined on handle destruction
+    std::thread       preload_thread;
+    std::atomic<bool> preload_started{false};
+
+    // asynchronous logging
+    _rocsparse_log_queue*   log_queue = nullptr;
+    std::thread             log_thread;
+    std::atomic<bool>       log_shutdown;
+    std::condition_variable log_cond;
+    std::mutex              log_mutex;
+
+    // small LRU cache of csrmv analysis results keyed by the sparsity
+    // pattern fingerprint, such that identical pattern matrices skip the
+    // row block construction. The most recently used entry sits at the
+    // back, the cache is guarded by csrmv_cache_mutex
+    static const size_t                          csrmv_cache_capacity = 8;
+    std::vector<_rocsparse_csrmv_analysis_data*> csrmv_cache;
+    std::mutex                                   csrmv_cache_mutex;
+
+    // per-routine profiling ; the table maps the routine name to the
+    // accumulated call statistics and is guarded by profile_mutex
+    struct profile_record
+    {
+        uint64_t calls   = 0;
+        double   time_ms = 0.0;
+        double   bytes   = 0.0;
+    };
+    std::map<std::string, profile_record> profile_table;
+    std::mutex                            profile_mutex;
+    // events to measure the device time of a profiled operation
+    hipEvent_t profile_start = nullptr;
+    hipEvent_t profile_stop  = nullptr;
 };
 
 /********************************************************************************
@@ -98,6 +433,16 @@ struct _rocsparse_mat_descr
     rocsparse_diag_type diag_type = rocsparse_diag_type_non_unit;
     // index base
     rocsparse_index_base base = rocsparse_index_base_zero;
+    // ELL storage mode; if set, the column-major ELL slices are padded to a
+    // pitch that is a multiple of 64 elements, such that slice starts remain
+    // aligned to the memory channel interleave for odd m
+    bool ell_pitched = false;
+    // Row range view; if row_range_end >= 0, supporting routines operate on
+    // rows [row_range_begin, row_range_end) only. The row pointers keep their
+    // absolute offsets into the value and column arrays, such that the view
+    // requires no data movement
+    rocsparse_int row_range_begin = 0;
+    rocsparse_int row_range_end   = -1;
 };
 
 /********************************************************************************
@@ -122,12 +467,274 @@ struct _rocsparse_hyb_mat
     rocsparse_int  ell_width   = 0;
     rocsparse_int* ell_col_ind = nullptr;
     void*          ell_val     = nullptr;
+    // ELL-R row length array; holds the number of stored entries of each
+    // ELL row, such that the SpMV kernels stop at the actual row length
+    // instead of sweeping ell_width padded entries for every row
+    rocsparse_int* ell_row_nnz = nullptr;
 
     // COO matrix part
     rocsparse_int  coo_nnz     = 0;
     rocsparse_int* coo_row_ind = nullptr;
     rocsparse_int* coo_col_ind = nullptr;
     void*          coo_val     = nullptr;
+
+    // per row write offsets into the COO part, cached during the conversion
+    // such that rocsparse_csr2hyb_update() can rewrite the numeric values
+    // without re-running the partitioning
+    rocsparse_int* coo_row_offset = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_bsr_mat is a structure holding the rocsparse BSR matrix.
+ * It must be initialized using rocsparse_create_bsr_mat() and the returned
+ * handle must be passed to all subsequent library function calls that involve
+ * the BSR matrix.
+ * It should be destroyed at the end using rocsparse_destroy_bsr_mat().
+ *******************************************************************************/
+struct _rocsparse_bsr_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+
+    // num block rows
+    rocsparse_int mb = 0;
+    // num block cols
+    rocsparse_int nb = 0;
+    // block dimension
+    rocsparse_int block_dim = 0;
+
+    // num non-zero blocks
+    rocsparse_int  nnzb        = 0;
+    rocsparse_int* bsr_row_ptr = nullptr;
+    rocsparse_int* bsr_col_ind = nullptr;
+    void*          bsr_val     = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_dcsr_mat is a structure holding the rocsparse DCSR matrix.
+ * The doubly compressed format stores row indices and row pointers for the
+ * non-empty rows only, such that hypersparse matrices do not pay for their
+ * empty rows. It must be initialized using rocsparse_create_dcsr_mat() and the
+ * returned handle must be passed to all subsequent library function calls that
+ * involve the DCSR matrix.
+ * It should be destroyed at the end using rocsparse_destroy_dcsr_mat().
+ *******************************************************************************/
+struct _rocsparse_dcsr_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+
+    // num non-empty rows
+    rocsparse_int mc = 0;
+
+    // num non-zero entries
+    rocsparse_int  nnz          = 0;
+    rocsparse_int* dcsr_row_ind = nullptr;
+    rocsparse_int* dcsr_row_ptr = nullptr;
+    rocsparse_int* dcsr_col_ind = nullptr;
+    void*          dcsr_val     = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_sell_mat is a structure holding the rocsparse SELL-C-sigma
+ * matrix. It must be initialized using rocsparse_create_sell_mat() and the
+ * returned handle must be passed to all subsequent library function calls that
+ * involve the SELL matrix.
+ * It should be destroyed at the end using rocsparse_destroy_sell_mat().
+ *******************************************************************************/
+struct _rocsparse_sell_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+
+    // slice height C
+    rocsparse_int slice_height = 0;
+    // sorting window sigma
+    rocsparse_int sigma = 0;
+    // num slices
+    rocsparse_int num_slices = 0;
+
+    // num stored elements, including padding
+    rocsparse_int  nnz          = 0;
+    rocsparse_int* slice_ptr    = nullptr;
+    rocsparse_int* perm         = nullptr;
+    rocsparse_int* sell_col_ind = nullptr;
+    void*          sell_val     = nullptr;
+};
+
+/********************************************************************************
+ * \brief _rocsparse_dist_mat_part holds one row partition of a distributed
+ * matrix, resident on a single device. The rows are split into an interior
+ * part that references only locally owned x entries and a boundary part that
+ * references the halo entries gathered from the other partitions, such that
+ * the interior SpMV can overlap the halo exchange.
+ *******************************************************************************/
+struct _rocsparse_dist_mat_part
+{
+    // device owning this partition
+    int device = 0;
+
+    // global row range [row_begin, row_end)
+    rocsparse_int row_begin = 0;
+    rocsparse_int row_end   = 0;
+
+    // interior sub matrix ; zero based local column indices
+    rocsparse_int  int_nnz     = 0;
+    rocsparse_int* int_row_ptr = nullptr;
+    rocsparse_int* int_col_ind = nullptr;
+    void*          int_val     = nullptr;
+
+    // boundary sub matrix ; column indices address the halo buffer
+    rocsparse_int  bnd_nnz     = 0;
+    rocsparse_int* bnd_row_ptr = nullptr;
+    rocsparse_int* bnd_col_ind = nullptr;
+    void*          bnd_val     = nullptr;
+
+    // halo buffer holding the gathered remote x entries, grouped by owning
+    // partition through the halo_off prefix sums
+    rocsparse_int              halo_size = 0;
+    void*                      halo_x    = nullptr;
+    std::vector<rocsparse_int> halo_off;
+
+    // per peer gather map and staging buffer, resident on the peer device ;
+    // gather_ind[q] holds the local x indices this partition needs from
+    // partition q
+    std::vector<rocsparse_int*> gather_ind;
+    std::vector<void*>          gather_buf;
+
+    // communication stream for the halo gathers and peer copies, such that
+    // they overlap the interior SpMV on the handle stream
+    hipStream_t comm_stream = nullptr;
+
+    // x entries are valid on the handle stream
+    hipEvent_t x_ready = nullptr;
+    // outgoing halo entries have been sent
+    hipEvent_t halo_sent = nullptr;
+    // boundary SpMV has consumed the halo buffer
+    hipEvent_t halo_done = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_dist_mat is a structure holding a matrix partitioned by
+ * rows across multiple devices. It must be initialized using
+ * rocsparse_create_dist_mat() and the returned handle must be passed to all
+ * subsequent library function calls that involve the distributed matrix.
+ * It should be destroyed at the end using rocsparse_destroy_dist_mat().
+ *******************************************************************************/
+struct _rocsparse_dist_mat
+{
+    // num row partitions
+    rocsparse_int ndevice = 0;
+
+    // global num rows
+    rocsparse_int m = 0;
+    // global num cols
+    rocsparse_int n = 0;
+    // global num non-zeros
+    rocsparse_int nnz = 0;
+
+    // zero based general descriptor used for the partition SpMVs
+    _rocsparse_mat_descr descr;
+
+    // row partitions
+    std::vector<_rocsparse_dist_mat_part> parts;
+};
+
+/********************************************************************************
+ * \brief rocsparse_split_mat is a structure holding a CSR matrix split by
+ * rows between the device and the host. The leading rows are device resident
+ * and run through csrmv, the trailing rows stay on the host and run through a
+ * multithreaded host SpMV, such that matrices slightly beyond device memory
+ * degrade gracefully instead of going fully out of core. It must be
+ * initialized using rocsparse_create_split_mat() and destroyed at the end
+ * using rocsparse_destroy_split_mat().
+ *******************************************************************************/
+struct _rocsparse_split_mat
+{
+    // device owning the device partition
+    int device = 0;
+
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+    // num non-zeros
+    rocsparse_int nnz = 0;
+
+    // zero based general descriptor used for the device SpMV
+    _rocsparse_mat_descr descr;
+
+    // first host resident row ; split_row == m keeps the entire matrix on
+    // the device
+    rocsparse_int split_row = 0;
+
+    // device partition, rows [0, split_row), zero based
+    rocsparse_int  dev_nnz     = 0;
+    rocsparse_int* dev_row_ptr = nullptr;
+    rocsparse_int* dev_col_ind = nullptr;
+    void*          dev_val     = nullptr;
+
+    // host partition, rows [split_row, m), zero based with rebased row
+    // pointers, held in pinned memory
+    rocsparse_int  host_nnz      = 0;
+    rocsparse_int* host_row_ptr  = nullptr;
+    rocsparse_int* host_col_ind  = nullptr;
+    void*          host_val      = nullptr;
+
+    // pinned staging buffers for x and the host part of y, sized n and
+    // m - split_row entries
+    void* host_x = nullptr;
+    void* host_y = nullptr;
+
+    // staging stream for the x and y copies, such that they overlap the
+    // device SpMV on the handle stream
+    hipStream_t stage_stream = nullptr;
+
+    // x and y entries are valid on the handle stream
+    hipEvent_t x_ready = nullptr;
+    // host part of y has been merged back
+    hipEvent_t y_merged = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csr_builder is a structure holding a sparse matrix under
+ * incremental construction. It must be initialized using
+ * rocsparse_create_csr_builder() and the returned builder must be passed to
+ * all subsequent library function calls that append to or finalize the
+ * matrix.
+ * It should be destroyed at the end using rocsparse_destroy_csr_builder().
+ *
+ * Appended row batches are expanded into zero based COO storage that grows
+ * geometrically, such that an append costs device work proportional to the
+ * batch instead of the accumulated matrix. The rows arrive in order, so the
+ * COO arrays stay row sorted by construction and the finalize compaction
+ * reduces to the coo2csr row pointer build.
+ *******************************************************************************/
+struct _rocsparse_csr_builder
+{
+    // num rows appended so far
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+    // num non-zero entries appended so far
+    rocsparse_int nnz = 0;
+
+    // capacity of the COO arrays in non-zero entries
+    rocsparse_int nnz_capacity = 0;
+
+    // zero based COO storage of the appended batches
+    rocsparse_int* coo_row_ind = nullptr;
+    rocsparse_int* coo_col_ind = nullptr;
+    void*          coo_val     = nullptr;
+
+    // size of a value element in bytes, fixed by the first append
+    size_t val_size = 0;
 };
 
 /********************************************************************************
@@ -142,8 +749,66 @@ struct _rocsparse_mat_info
     // info structs
     rocsparse_csrmv_info csrmv_info       = nullptr;
     rocsparse_csrtr_info csrilu0_info     = nullptr;
+    rocsparse_csrtr_info csric0_info      = nullptr;
     rocsparse_csrtr_info csrsv_upper_info = nullptr;
     rocsparse_csrtr_info csrsv_lower_info = nullptr;
+    rocsparse_csriluk_info csriluk_info   = nullptr;
+    rocsparse_csrilut_info csrilut_info   = nullptr;
+    rocsparse_spmv_info  spmv_info        = nullptr;
+    rocsparse_csr2csc_info csr2csc_info   = nullptr;
+    rocsparse_csrupd_info csrupd_info     = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_spmat_descr is a structure holding the generic API sparse
+ * matrix descriptor. It bundles the dimensions, the storage format, the data
+ * type and the array pointers of a sparse matrix with an owned legacy matrix
+ * descriptor and info structure, such that the generic routines can dispatch
+ * to the existing typed templates. It must be initialized using e.g.
+ * rocsparse_create_csr_descr() and should be destroyed at the end using
+ * rocsparse_destroy_spmat_descr().
+ *******************************************************************************/
+struct _rocsparse_spmat_descr
+{
+    // num rows
+    rocsparse_int rows = 0;
+    // num cols
+    rocsparse_int cols = 0;
+    // num non-zeros
+    rocsparse_int nnz = 0;
+
+    // array pointers, typed according to data_type
+    void* row_data = nullptr;
+    void* col_data = nullptr;
+    void* val_data = nullptr;
+
+    // storage format
+    rocsparse_format format = rocsparse_format_csr;
+    // data type of val_data
+    rocsparse_datatype data_type = rocsparse_datatype_f32_r;
+
+    // owned legacy descriptor, carries index base and matrix type
+    rocsparse_mat_descr descr = nullptr;
+    // owned info structure, holds analysis meta data gathered on this matrix
+    rocsparse_mat_info info = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_dnvec_descr is a structure holding the generic API dense
+ * vector descriptor. It must be initialized using
+ * rocsparse_create_dnvec_descr() and should be destroyed at the end using
+ * rocsparse_destroy_dnvec_descr().
+ *******************************************************************************/
+struct _rocsparse_dnvec_descr
+{
+    // num elements
+    rocsparse_int size = 0;
+
+    // array pointer, typed according to data_type
+    void* values = nullptr;
+
+    // data type of values
+    rocsparse_datatype data_type = rocsparse_datatype_f32_r;
 };
 
 /********************************************************************************
@@ -152,12 +817,100 @@ struct _rocsparse_mat_info
  * rocsparse_create_csrmv_info() routine. It should be destroyed at the end
  * rocsparse_destroy_csrmv_info().
  *******************************************************************************/
-struct _rocsparse_csrmv_info
+/********************************************************************************
+ * \brief _rocsparse_csrmv_analysis_data holds the analysis results of a
+ * sparsity pattern. It is shared between the handle analysis cache and every
+ * csrmv info attached to a matrix with that pattern, and is released once
+ * the last reference is dropped.
+ *******************************************************************************/
+struct _rocsparse_csrmv_analysis_data
 {
+    // pattern fingerprint
+    uint64_t      hash = 0;
+    rocsparse_int m    = 0;
+    rocsparse_int n    = 0;
+    rocsparse_int nnz  = 0;
+
     // num row blocks
     size_t size = 0;
     // row blocks
     unsigned long long* row_blocks = nullptr;
+    // tuning variant of the adaptive kernel, selected at analysis time from
+    // the per-architecture table; the row block packing depends on it
+    int tuning = 0;
+    // merge path kernel selected; chosen during analysis for heavily
+    // skewed row length distributions
+    bool use_merge_path = false;
+    // 32-bit copy of the column indices, built during analysis for ILP64
+    // builds when the column count fits, such that the adaptive kernel
+    // does not pay doubled csr_col_ind bandwidth for matrices that only
+    // overflow in nnz
+    int32_t* csr_col_ind_narrow = nullptr;
+    // delta compressed column indices, built during analysis when every row
+    // block spans a column range of less than 2^16. col_base holds the
+    // smallest column index touched by each row block, col_delta the 16-bit
+    // offset of every non-zero from the base of its block, such that the
+    // adaptive kernel reads two instead of four or eight bytes per column
+    // index
+    rocsparse_int* col_base  = nullptr;
+    uint16_t*      col_delta = nullptr;
+    // row length binned kernels selected; chosen during analysis for short
+    // mean row lengths, where a full wavefront per row runs at low lane
+    // utilization. The rows are bucketed by length into a thread per row,
+    // a quarter wavefront per row and a wavefront per row bin, stored back
+    // to back in bin_rows
+    bool           use_binned_path = false;
+    rocsparse_int  bin_size[3]     = {0, 0, 0};
+    rocsparse_int* bin_rows        = nullptr;
+
+    // managed memory oversubscription ; row panel boundaries for the
+    // prefetch scheduled execution, built at analysis time when the csr
+    // arrays are managed and exceed the free device memory. panel_block
+    // holds the first row block and panel_nnz the first non-zero of each
+    // panel, both host resident with one terminating entry
+    bool           oversubscribed = false;
+    rocsparse_int  num_panels     = 0;
+    size_t*        panel_block    = nullptr;
+    rocsparse_int* panel_nnz      = nullptr;
+
+    // column blocked execution ; chosen during analysis for very wide
+    // matrices, where the x gathers span a column range far beyond the L2
+    // cache. The rows are pre-split into column panels and the compute step
+    // runs panel by panel, such that each pass only gathers from an L2
+    // sized slice of x. col_panel_ptr is host resident and holds the start
+    // of each panel in the intersection arrays, col_panel_rows the row and
+    // col_panel_begin the first non-zero of each row panel intersection
+    bool           use_col_blocked = false;
+    rocsparse_int  num_col_panels  = 0;
+    rocsparse_int* col_panel_ptr   = nullptr;
+    rocsparse_int* col_panel_rows  = nullptr;
+    rocsparse_int* col_panel_begin = nullptr;
+
+    // online kernel selection probing state ; only touched when probing
+    // is enabled on the handle. The first calls alternate between the
+    // analyzed and the general kernel under event timing, probe_time
+    // accumulates the elapsed time of each candidate. Once both have been
+    // timed often enough, probe_winner locks in the faster one
+    int   probe_call    = 0;
+    int   probe_winner  = -1;
+    float probe_time[2] = {0.0f, 0.0f};
+
+    // reference count ; held by the handle cache and by every csrmv info
+    // that shares this analysis
+    std::atomic<int> refcount{1};
+};
+
+/********************************************************************************
+ * \brief Drop a reference to a csrmv analysis and release it once the last
+ * reference is gone.
+ *******************************************************************************/
+rocsparse_status rocsparse_release_csrmv_analysis_data(_rocsparse_csrmv_analysis_data* data);
+
+struct _rocsparse_csrmv_info
+{
+    // analysis results, shared with the handle analysis cache and with
+    // other matrices of identical sparsity pattern
+    _rocsparse_csrmv_analysis_data* data = nullptr;
 
     // some data to verify correct execution
     rocsparse_operation         trans;
@@ -182,11 +935,73 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info);
 
+/********************************************************************************
+ * \brief Internal sparse matrix storage formats, selected by spmv_analysis
+ * based on the row length distribution of the matrix.
+ *******************************************************************************/
+typedef enum rocsparse_spmv_format_
+{
+    rocsparse_spmv_format_csr = 0,
+    rocsparse_spmv_format_coo = 1,
+    rocsparse_spmv_format_ell = 2,
+    rocsparse_spmv_format_hyb = 3
+} rocsparse_spmv_format;
+
+/********************************************************************************
+ * \brief rocsparse_spmv_info is a structure holding the rocsparse spmv info
+ * data gathered during spmv_analysis. It must be initialized using the
+ * rocsparse_create_spmv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_spmv_info().
+ *******************************************************************************/
+struct _rocsparse_spmv_info
+{
+    // selected storage format
+    rocsparse_spmv_format format = rocsparse_spmv_format_csr;
+
+    // row length statistics
+    double        mean_row_nnz = 0.0;
+    double        var_row_nnz  = 0.0;
+    rocsparse_int max_row_nnz  = 0;
+
+    // ELL / HYB representation
+    rocsparse_hyb_mat hyb = nullptr;
+    // COO row indices, column indices and values are shared with the CSR
+    // matrix
+    rocsparse_int* coo_row_ind = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_operation         trans;
+    rocsparse_int               m;
+    rocsparse_int               n;
+    rocsparse_int               nnz;
+    const _rocsparse_mat_descr* descr;
+    const rocsparse_int*        csr_row_ptr;
+    const rocsparse_int*        csr_col_ind;
+};
+
+/********************************************************************************
+ * \brief rocsparse_spmv_info is a structure holding the rocsparse spmv info
+ * data gathered during spmv_analysis. It must be initialized using the
+ * rocsparse_create_spmv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_spmv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_spmv_info(rocsparse_spmv_info* info);
+
+/********************************************************************************
+ * \brief Destroy spmv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_spmv_info(rocsparse_spmv_info info);
+
 struct _rocsparse_csrtr_info
 {
     // maximum non-zero entries per row
     rocsparse_int max_nnz = 0;
 
+    // number of depth levels in the dependency graph
+    rocsparse_int nlevels = 0;
+    // host array to hold the offset into the row map for each level
+    rocsparse_int* level_ptr = nullptr;
+
     // device array to hold row permutation
     rocsparse_int* row_map = nullptr;
     // device array to hold pointer to diagonal entry
@@ -194,6 +1009,17 @@ struct _rocsparse_csrtr_info
     // device pointer to hold zero pivot
     rocsparse_int* zero_pivot = nullptr;
 
+    // device array to hold the reciprocal diagonal entries, stored in the
+    // value precision of the analyzed matrix. Optional, filled by
+    // csrsv_analysis where matrix values are available, such that the solve
+    // replaces the dependent division on its critical path by a
+    // multiplication. A zero entry marks a structurally missing or
+    // numerically zero diagonal entry
+    void* inv_diag = nullptr;
+    // value array the reciprocals have been computed from, the solve falls
+    // back to the in-loop division when applied to different values
+    const void* inv_diag_val = nullptr;
+
     // some data to verify correct execution
     rocsparse_int               m;
     rocsparse_int               nnz;
@@ -215,6 +1041,129 @@ rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info);
 
+struct _rocsparse_csriluk_info
+{
+    // fill level
+    rocsparse_int level = 0;
+    // number of non-zero entries of the factorization pattern
+    rocsparse_int nnz = 0;
+
+    // device array to hold the row pointers of the factorization pattern
+    rocsparse_int* row_ptr = nullptr;
+    // device array to hold the column indices of the factorization pattern
+    rocsparse_int* col_ind = nullptr;
+
+    // dependency meta data for the numerical factorization
+    rocsparse_csrtr_info csrtr_info = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_int               m;
+    const _rocsparse_mat_descr* descr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the factorization
+ * pattern gathered during csriluk_nnz. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info);
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info);
+
+struct _rocsparse_csrilut_info
+{
+    // number of non-zero entries of the factorization
+    rocsparse_int nnz = 0;
+
+    // device array to hold the row pointers of the factorization
+    rocsparse_int* row_ptr = nullptr;
+    // device array to hold the column indices of the factorization
+    rocsparse_int* col_ind = nullptr;
+    // device array to hold the values of the factorization
+    void* val = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_int               m;
+    const _rocsparse_mat_descr* descr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrilut_info is a structure holding the factorization
+ * computed during csrilut_nnz. It must be initialized using the
+ * rocsparse_create_csrilut_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csrilut_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrilut_info(rocsparse_csrilut_info* info);
+
+/********************************************************************************
+ * \brief Destroy csrilut info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrilut_info(rocsparse_csrilut_info info);
+
+struct _rocsparse_csr2csc_info
+{
+    // device array mapping each CSC entry to the CSR entry it originates
+    // from, such that repeated numeric transposes of the same sparsity
+    // pattern reduce to a single gather through this permutation
+    rocsparse_int* perm = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csr2csc_info is a structure holding the nnz permutation
+ * gathered during csr2csc_analysis. It must be initialized using the
+ * rocsparse_create_csr2csc_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csr2csc_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csr2csc_info(rocsparse_csr2csc_info* info);
+
+/********************************************************************************
+ * \brief Destroy csr2csc info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csr2csc_info(rocsparse_csr2csc_info info);
+
+struct _rocsparse_csrupd_info
+{
+    // open addressed hash table over the sparsity pattern; table holds the
+    // packed (row, col) keys, data the position of the keyed entry in
+    // csr_val. Empty buckets are marked with all bits set
+    rocsparse_int       table_size = 0;
+    unsigned long long* table      = nullptr;
+    rocsparse_int*      data       = nullptr;
+
+    // index base of the analyzed matrix, the update triples use it too
+    rocsparse_index_base base = rocsparse_index_base_zero;
+
+    // some data to verify correct execution
+    rocsparse_int               m;
+    rocsparse_int               n;
+    rocsparse_int               nnz;
+    const _rocsparse_mat_descr* descr;
+    const rocsparse_int*        csr_row_ptr;
+    const rocsparse_int*        csr_col_ind;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrupd_info is a structure holding the sparsity pattern
+ * hash index gathered during csr_update_analysis. It must be initialized
+ * using the rocsparse_create_csrupd_info() routine. It should be destroyed
+ * at the end using rocsparse_destroy_csrupd_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrupd_info(rocsparse_csrupd_info* info);
+
+/********************************************************************************
+ * \brief Destroy csrupd info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrupd_info(rocsparse_csrupd_info info);
+
 /********************************************************************************
  * \brief ELL format indexing
  *******************************************************************************/
@@ -222,4 +1171,14 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info);
 #define ELL_IND_EL(i, el, m, width) (el) + (width) * (i)
 #define ELL_IND(i, el, m, width) ELL_IND_ROW(i, el, m, width)
 
+// Slice pitch of a pitched ELL matrix, rounded up to 64 element boundaries
+#define ELL_PITCH(m) ((((m)-1) / 64 + 1) * 64)
+
+// Number of elements each ELL slice occupies, honoring the storage mode of
+// the matrix descriptor
+static inline rocsparse_int ell_get_pitch(const rocsparse_mat_descr descr, rocsparse_int m)
+{
+    return (descr != nullptr && descr->ell_pitched && m > 0) ? ELL_PITCH(m) : m;
+}
+
 #endif // HANDLE_H
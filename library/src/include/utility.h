@@ -30,7 +30,9 @@
 #include "rocsparse.h"
 
 #include <algorithm>
+#include <dlfcn.h>
 #include <fstream>
+#include <sstream>
 #include <string>
 
 // Return the leftmost significant bit position
@@ -63,40 +65,55 @@ static inline void rocsparse_one(const rocsparse_handle handle, double** one)
 // log_function will call log_arguments to log function
 // arguments with a comma separator
 template <typename H, typename... Ts>
-void log_trace(rocsparse_handle handle, H head, Ts&... xs)
+void log_trace_arguments(rocsparse_handle handle, H head, Ts&... xs)
 {
-    if(nullptr != handle)
-    {
-        if(handle->layer_mode & rocsparse_layer_mode_log_trace)
-        {
-            std::string comma_separator = ",";
+    std::string comma_separator = ",";
 
-            std::ostream* os = handle->log_trace_os;
-            log_arguments(*os, comma_separator, head, xs...);
-        }
-    }
+    // Format into a local buffer and hand the entry over to the logging
+    // thread, such that the stream write does not delay the API call
+    std::ostringstream os;
+    log_arguments(os, comma_separator, head, xs...);
+
+    handle->log_enqueue(handle->log_trace_os, os.str());
 }
 
+// Short-circuit before the log arguments are evaluated, constructing the
+// function name string with replaceX in every call is measurable in hot
+// iteration loops when logging is disabled
+#define log_trace(handle, ...)                                                          \
+    do                                                                                  \
+    {                                                                                   \
+        if(nullptr != (handle) && ((handle)->layer_mode & rocsparse_layer_mode_log_trace)) \
+        {                                                                               \
+            log_trace_arguments(handle, __VA_ARGS__);                                   \
+        }                                                                               \
+    } while(0)
+
 // if bench logging is turned on with
 // (handle->layer_mode & rocsparse_layer_mode_log_bench) == true
 // then
 // log_bench will call log_arguments to log a string that
 // can be input to the executable rocsparse-bench.
 template <typename H, typename... Ts>
-void log_bench(rocsparse_handle handle, H head, std::string precision, Ts&... xs)
+void log_bench_arguments(rocsparse_handle handle, H head, std::string precision, Ts&... xs)
 {
-    if(nullptr != handle)
-    {
-        if(handle->layer_mode & rocsparse_layer_mode_log_bench)
-        {
-            std::string space_separator = " ";
+    std::string space_separator = " ";
 
-            std::ostream* os = handle->log_bench_os;
-            log_arguments(*os, space_separator, head, precision, xs...);
-        }
-    }
+    std::ostringstream os;
+    log_arguments(os, space_separator, head, precision, xs...);
+
+    handle->log_enqueue(handle->log_bench_os, os.str());
 }
 
+#define log_bench(handle, ...)                                                          \
+    do                                                                                  \
+    {                                                                                   \
+        if(nullptr != (handle) && ((handle)->layer_mode & rocsparse_layer_mode_log_bench)) \
+        {                                                                               \
+            log_bench_arguments(handle, __VA_ARGS__);                                   \
+        }                                                                               \
+    } while(0)
+
 // replaces X in string with s, d, c, z or h depending on typename T
 template <typename T>
 std::string replaceX(std::string input_string)
@@ -109,7 +126,6 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'd');
     }
-    /*
     else if(std::is_same<T, rocsparse_float_complex>::value)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'c');
@@ -118,12 +134,131 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'z');
     }
-    else if(std::is_same<T, rocsparse_half>::value)
+    return input_string;
+}
+
+// roctx entry points, resolved once per process. The library does not link
+// against roctracer; the symbols are taken from the already loaded profiler
+// libraries or from libroctx64 directly, such that range annotation works
+// under rocprofiler without an instrumentation rebuild and stays inert when
+// no profiler is attached
+struct rocsparse_roctx_api
+{
+    int (*push)(const char*) = nullptr;
+    int (*pop)()             = nullptr;
+};
+
+inline const rocsparse_roctx_api& rocsparse_roctx()
+{
+    static rocsparse_roctx_api api = [] {
+        rocsparse_roctx_api a;
+
+        void* push = dlsym(RTLD_DEFAULT, "roctxRangePushA");
+        void* pop  = dlsym(RTLD_DEFAULT, "roctxRangePop");
+
+        if(push == nullptr || pop == nullptr)
+        {
+            void* lib = dlopen("libroctx64.so", RTLD_NOW | RTLD_LOCAL);
+
+            if(lib != nullptr)
+            {
+                push = dlsym(lib, "roctxRangePushA");
+                pop  = dlsym(lib, "roctxRangePop");
+            }
+        }
+
+        if(push != nullptr && pop != nullptr)
+        {
+            a.push = reinterpret_cast<int (*)(const char*)>(push);
+            a.pop  = reinterpret_cast<int (*)()>(pop);
+        }
+
+        return a;
+    }();
+
+    return api;
+}
+
+// Scoped roctx range around an API call. Routines instantiate the scope
+// after the argument validation, analogous to the profiling scope below.
+// When the roctx layer is not active or no profiler is attached, neither
+// the routine name nor any range is created
+template <typename T>
+struct rocsparse_roctx_scope
+{
+    rocsparse_roctx_scope(rocsparse_handle handle, const char* name)
+        : active(handle != nullptr && (handle->layer_mode & rocsparse_layer_mode_log_roctx)
+                 && rocsparse_roctx().push != nullptr)
     {
-        std::replace(input_string.begin(), input_string.end(), 'X', 'h');
+        if(active)
+        {
+            rocsparse_roctx().push(replaceX<T>(name).c_str());
+        }
+    }
+
+    ~rocsparse_roctx_scope()
+    {
+        if(active)
+        {
+            rocsparse_roctx().pop();
+        }
+    }
+
+    bool active;
+};
+
+// Mark an internal phase of an API call with a nested roctx range, such
+// that timelines separate analysis, temp buffer setup and the kernel
+// launches of an operation. The begin / end pair brackets linear phases
+// without requiring a scope; a range left open by an error return only
+// affects the already failing profile
+static inline void rocsparse_roctx_phase_begin(rocsparse_handle handle, const char* name)
+{
+    if(handle != nullptr && (handle->layer_mode & rocsparse_layer_mode_log_roctx)
+       && rocsparse_roctx().push != nullptr)
+    {
+        rocsparse_roctx().push(name);
     }
-    */
-    return input_string;
 }
 
+static inline void rocsparse_roctx_phase_end(rocsparse_handle handle)
+{
+    if(handle != nullptr && (handle->layer_mode & rocsparse_layer_mode_log_roctx)
+       && rocsparse_roctx().pop != nullptr)
+    {
+        rocsparse_roctx().pop();
+    }
+}
+
+// Scoped profiling helper. Measures the device time between construction and
+// destruction and accumulates it on the handles per-routine profiling table.
+// Routines instantiate the scope after the argument validation, such that all
+// launch paths are covered. When the profile layer is not active, neither the
+// routine name nor any event is created
+template <typename T>
+struct rocsparse_profile_scope
+{
+    rocsparse_profile_scope(rocsparse_handle handle, const char* name, double nbytes)
+        : handle(handle), nbytes(nbytes)
+    {
+        if(handle->layer_mode & rocsparse_layer_mode_log_profile)
+        {
+            this->name = replaceX<T>(name);
+            handle->profile_begin();
+        }
+    }
+
+    ~rocsparse_profile_scope()
+    {
+        if(handle->layer_mode & rocsparse_layer_mode_log_profile)
+        {
+            handle->profile_end(name, nbytes);
+        }
+    }
+
+    rocsparse_handle handle;
+    std::string      name;
+    double           nbytes;
+};
+
 #endif // UTILITY_H
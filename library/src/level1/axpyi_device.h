@@ -46,4 +46,28 @@ __device__ void axpyi_device(rocsparse_int        nnz,
     y[x_ind[idx] - idx_base] += alpha * x_val[idx];
 }
 
+// Strided batched y = a * x + y, processing one batch member per workgroup
+// such that the whole ensemble is covered by a single kernel launch. All
+// batch members share the sparsity pattern x_ind, the values and the dense
+// vector of batch i are expected at x_val + i * x_stride and
+// y + i * y_stride
+template <typename T>
+__device__ void axpyi_batched_device(rocsparse_int        nnz,
+                                     T                    alpha,
+                                     const T*             x_val,
+                                     const rocsparse_int* x_ind,
+                                     rocsparse_int        x_stride,
+                                     T*                   y,
+                                     rocsparse_int        y_stride,
+                                     rocsparse_index_base idx_base)
+{
+    const T* batch_x = x_val + hipBlockIdx_x * x_stride;
+    T*       batch_y = y + hipBlockIdx_x * y_stride;
+
+    for(rocsparse_int idx = hipThreadIdx_x; idx < nnz; idx += hipBlockDim_x)
+    {
+        batch_y[x_ind[idx] - idx_base] += alpha * batch_x[idx];
+    }
+}
+
 #endif // AXPYI_DEVICE_H
@@ -20,3 +20,85 @@
  * THE SOFTWARE.
  *
  * ************************************************************************ */
+
+#pragma once
+#ifndef DOTCI_DEVICE_H
+#define DOTCI_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Single-pass device-wide reduction, see doti_kernel. Each workgroup
+// reduces its grid-stride range into a partial, the workgroup that finishes
+// last combines all partials, such that the scalar is ready at the end of a
+// single kernel launch
+template <typename T, rocsparse_int NB>
+__global__ void dotci_kernel(rocsparse_int        nnz,
+                             const T*             x_val,
+                             const rocsparse_int* x_ind,
+                             const T*             y,
+                             T*                   workspace,
+                             unsigned int*        counter,
+                             T*                   result,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockDim_x * hipBlockIdx_x + tid;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int idx = gid; idx < nnz; idx += hipGridDim_x * hipBlockDim_x)
+    {
+        sum += y[x_ind[idx] - idx_base] * rocsparse_conj(x_val[idx]);
+    }
+
+    // Intra-wavefront steps of the reduction run in registers, only one
+    // partial per wavefront goes through LDS
+    __shared__ T sdata[NB / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, NB, 32>(tid, sum, sdata);
+
+    // Flag raised by the workgroup that publishes the last partial
+    __shared__ bool last;
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sum;
+
+        // Make the partial visible to the other workgroups before
+        // incrementing the counter
+        __threadfence();
+
+        last = (atomicAdd(counter, 1) == hipGridDim_x - 1);
+    }
+
+    __syncthreads();
+
+    // The last workgroup combines the partials of all workgroups
+    if(last)
+    {
+        sum = static_cast<T>(0);
+
+        for(rocsparse_int i = tid; i < hipGridDim_x; i += NB)
+        {
+            sum += workspace[i];
+        }
+
+        sum = rocsparse_blockreduce_wf_sum<T, NB, 32>(tid, sum, sdata);
+
+        if(tid == 0)
+        {
+            if(result)
+            {
+                *result = sum;
+            }
+            else
+            {
+                workspace[0] = sum;
+            }
+        }
+    }
+}
+
+#endif // DOTCI_DEVICE_H
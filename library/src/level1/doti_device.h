@@ -29,62 +29,114 @@
 
 #include <hip/hip_runtime.h>
 
+// Single-pass device-wide reduction. Each workgroup reduces its grid-stride
+// range into a partial, the workgroup that finishes last combines all
+// partials, such that the scalar is ready at the end of a single kernel
+// launch. The counter is expected to be zero on entry. If result is a null
+// pointer, the combined value is written to workspace[0] instead, from
+// where it can be copied to a host side result.
 template <typename T, rocsparse_int NB>
-__global__ void doti_kernel_part1(rocsparse_int        nnz,
-                                  const T*             x_val,
-                                  const rocsparse_int* x_ind,
-                                  const T*             y,
-                                  T*                   workspace,
-                                  rocsparse_index_base idx_base)
+__global__ void doti_kernel(rocsparse_int        nnz,
+                            const T*             x_val,
+                            const rocsparse_int* x_ind,
+                            const T*             y,
+                            T*                   workspace,
+                            unsigned int*        counter,
+                            T*                   result,
+                            rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
     rocsparse_int gid = hipBlockDim_x * hipBlockIdx_x + tid;
 
-    __shared__ T sdata[NB];
-    sdata[tid] = static_cast<T>(0);
+    T sum = static_cast<T>(0);
 
     for(rocsparse_int idx = gid; idx < nnz; idx += hipGridDim_x * hipBlockDim_x)
     {
-        sdata[tid] += y[x_ind[idx] - idx_base] * x_val[idx];
+        sum += y[x_ind[idx] - idx_base] * x_val[idx];
     }
 
-    __syncthreads();
+    // Intra-wavefront steps of the reduction run in registers, only one
+    // partial per wavefront goes through LDS
+    __shared__ T sdata[NB / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, NB, 32>(tid, sum, sdata);
 
-    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+    // Flag raised by the workgroup that publishes the last partial
+    __shared__ bool last;
 
     if(tid == 0)
     {
-        workspace[hipBlockIdx_x] = sdata[0];
+        workspace[hipBlockIdx_x] = sum;
+
+        // Make the partial visible to the other workgroups before
+        // incrementing the counter
+        __threadfence();
+
+        last = (atomicAdd(counter, 1) == hipGridDim_x - 1);
+    }
+
+    __syncthreads();
+
+    // The last workgroup combines the partials of all workgroups
+    if(last)
+    {
+        sum = static_cast<T>(0);
+
+        for(rocsparse_int i = tid; i < hipGridDim_x; i += NB)
+        {
+            sum += workspace[i];
+        }
+
+        sum = rocsparse_blockreduce_wf_sum<T, NB, 32>(tid, sum, sdata);
+
+        if(tid == 0)
+        {
+            if(result)
+            {
+                *result = sum;
+            }
+            else
+            {
+                workspace[0] = sum;
+            }
+        }
     }
 }
 
+// Strided batched dot product, processing one batch member per workgroup.
+// All batch members share the sparsity pattern x_ind, the values and the
+// dense vector of batch i are expected at x_val + i * x_stride and
+// y + i * y_stride. The reduced value of each batch member is written to
+// result[i], no second reduction pass is required
 template <typename T, rocsparse_int NB>
-__global__ void doti_kernel_part2(rocsparse_int n, T* workspace, T* result)
+__global__ void doti_batched_kernel(rocsparse_int        nnz,
+                                    const T*             x_val,
+                                    const rocsparse_int* x_ind,
+                                    rocsparse_int        x_stride,
+                                    const T*             y,
+                                    rocsparse_int        y_stride,
+                                    T*                   result,
+                                    rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
 
-    __shared__ T sdata[NB];
-    sdata[tid] = static_cast<T>(0);
+    const T* batch_x = x_val + hipBlockIdx_x * x_stride;
+    const T* batch_y = y + hipBlockIdx_x * y_stride;
+
+    T sum = static_cast<T>(0);
 
-    for(rocsparse_int i = tid; i < n; i += NB)
+    for(rocsparse_int idx = tid; idx < nnz; idx += NB)
     {
-        sdata[tid] += workspace[i];
+        sum += batch_y[x_ind[idx] - idx_base] * batch_x[idx];
     }
 
-    __syncthreads();
+    __shared__ T sdata[NB / 32];
 
-    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+    sum = rocsparse_blockreduce_wf_sum<T, NB, 32>(tid, sum, sdata);
 
     if(tid == 0)
     {
-        if(result)
-        {
-            *result = sdata[0];
-        }
-        else
-        {
-            workspace[0] = sdata[0];
-        }
+        result[hipBlockIdx_x] = sum;
     }
 }
 
@@ -0,0 +1,233 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef DOTII_DEVICE_H
+#define DOTII_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Sparse-sparse dot product. Each thread intersects one entry of x against
+// the sorted index list of y by binary search, only matching indices
+// contribute to the sum. The caller is expected to pass the shorter vector
+// as x, the dot product is symmetric. The partials are combined by the same
+// single-pass reduction as in doti_kernel, the counter is expected to be
+// zero on entry. If result is a null pointer, the combined value is written
+// to workspace[0] instead, from where it can be copied to a host side
+// result.
+template <typename T, rocsparse_int NB>
+__global__ void dotii_kernel(rocsparse_int        x_nnz,
+                             const T*             x_val,
+                             const rocsparse_int* x_ind,
+                             rocsparse_int        y_nnz,
+                             const T*             y_val,
+                             const rocsparse_int* y_ind,
+                             T*                   workspace,
+                             unsigned int*        counter,
+                             T*                   result)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockDim_x * hipBlockIdx_x + tid;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int idx = gid; idx < x_nnz; idx += hipGridDim_x * hipBlockDim_x)
+    {
+        // Index to look up in y, both vectors share the index base
+        rocsparse_int key = x_ind[idx];
+
+        // Binary search for the matching entry of y
+        rocsparse_int l = 0;
+        rocsparse_int r = y_nnz - 1;
+
+        while(l < r)
+        {
+            rocsparse_int mid = (l + r) >> 1;
+
+            if(y_ind[mid] < key)
+            {
+                l = mid + 1;
+            }
+            else
+            {
+                r = mid;
+            }
+        }
+
+        // Check if a match has been found
+        if(y_ind[l] == key)
+        {
+            sum = rocsparse_fma(x_val[idx], y_val[l], sum);
+        }
+    }
+
+    // Intra-wavefront steps of the reduction run in registers, only one
+    // partial per wavefront goes through LDS
+    __shared__ T sdata[NB / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, NB, 32>(tid, sum, sdata);
+
+    // Flag raised by the workgroup that publishes the last partial
+    __shared__ bool last;
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sum;
+
+        // Make the partial visible to the other workgroups before
+        // incrementing the counter
+        __threadfence();
+
+        last = (atomicAdd(counter, 1) == hipGridDim_x - 1);
+    }
+
+    __syncthreads();
+
+    // The last workgroup combines the partials of all workgroups
+    if(last)
+    {
+        sum = static_cast<T>(0);
+
+        for(rocsparse_int i = tid; i < hipGridDim_x; i += NB)
+        {
+            sum += workspace[i];
+        }
+
+        sum = rocsparse_blockreduce_wf_sum<T, NB, 32>(tid, sum, sdata);
+
+        if(tid == 0)
+        {
+            if(result)
+            {
+                *result = sum;
+            }
+            else
+            {
+                workspace[0] = sum;
+            }
+        }
+    }
+}
+
+// Batched sparse-sparse dot product, processing one vector pair per
+// wavefront. The vectors are stored back to back, the entries of pair i are
+// expected at x_ptr[i] .. x_ptr[i+1] and y_ptr[i] .. y_ptr[i+1]. Each lane
+// intersects one entry of the shorter vector of its pair against the sorted
+// index list of the longer one by binary search, the lanes combine their
+// partials by a wavefront reduction and write the scalar to result[i]
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void dotii_batched_kernel(rocsparse_int batch_count,
+                                     const T* __restrict__ x_val,
+                                     const rocsparse_int* __restrict__ x_ind,
+                                     const rocsparse_int* __restrict__ x_ptr,
+                                     const T* __restrict__ y_val,
+                                     const rocsparse_int* __restrict__ y_ind,
+                                     const rocsparse_int* __restrict__ y_ptr,
+                                     T* __restrict__ result,
+                                     rocsparse_index_base idx_base)
+{
+    int           lid = hipThreadIdx_x & (WF_SIZE - 1);
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= batch_count)
+    {
+        return;
+    }
+
+    // Entry ranges of the current vector pair
+    rocsparse_int x_begin = x_ptr[idx] - idx_base;
+    rocsparse_int x_end   = x_ptr[idx + 1] - idx_base;
+    rocsparse_int y_begin = y_ptr[idx] - idx_base;
+    rocsparse_int y_end   = y_ptr[idx + 1] - idx_base;
+
+    // Iterate over the shorter vector and binary search the longer one,
+    // the dot product is symmetric
+    const T*             a_val   = x_val;
+    const rocsparse_int* a_ind   = x_ind;
+    rocsparse_int        a_begin = x_begin;
+    rocsparse_int        a_end   = x_end;
+    const T*             b_val   = y_val;
+    const rocsparse_int* b_ind   = y_ind;
+    rocsparse_int        b_begin = y_begin;
+    rocsparse_int        b_end   = y_end;
+
+    if(y_end - y_begin < x_end - x_begin)
+    {
+        a_val   = y_val;
+        a_ind   = y_ind;
+        a_begin = y_begin;
+        a_end   = y_end;
+        b_val   = x_val;
+        b_ind   = x_ind;
+        b_begin = x_begin;
+        b_end   = x_end;
+    }
+
+    T sum = static_cast<T>(0);
+
+    // Each lane processes one entry
+    for(rocsparse_int j = a_begin + lid; j < a_end; j += WF_SIZE)
+    {
+        // Index to look up, both vectors share the index base
+        rocsparse_int key = a_ind[j];
+
+        // Binary search for the matching entry of the longer vector
+        rocsparse_int l = b_begin;
+        rocsparse_int r = b_end - 1;
+
+        while(l < r)
+        {
+            rocsparse_int mid = (l + r) >> 1;
+
+            if(b_ind[mid] < key)
+            {
+                l = mid + 1;
+            }
+            else
+            {
+                r = mid;
+            }
+        }
+
+        // Check if a match has been found
+        if(l < b_end && b_ind[l] == key)
+        {
+            sum = rocsparse_fma(a_val[j], b_val[l], sum);
+        }
+    }
+
+    // Obtain wavefront sum
+    sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+    // Last lane of each wavefront writes the scalar of its pair
+    if(lid == WF_SIZE - 1)
+    {
+        result[idx] = sum;
+    }
+}
+
+#endif // DOTII_DEVICE_H
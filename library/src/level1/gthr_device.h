@@ -44,4 +44,102 @@ __global__ void gthr_kernel(rocsparse_int        nnz,
     x_val[idx] = y[x_ind[idx] - idx_base];
 }
 
+// 128 bit wide copy of four consecutive dense entries
+static __device__ __forceinline__ void gthr_wide_copy(const float* src, float* dst)
+{
+    *reinterpret_cast<float4*>(dst) = *reinterpret_cast<const float4*>(src);
+}
+
+static __device__ __forceinline__ void gthr_wide_copy(const double* src, double* dst)
+{
+    *reinterpret_cast<double2*>(dst)     = *reinterpret_cast<const double2*>(src);
+    *reinterpret_cast<double2*>(dst + 2) = *reinterpret_cast<const double2*>(src + 2);
+}
+
+static __device__ __forceinline__ void gthr_wide_copy(const rocsparse_float_complex* src,
+                                                      rocsparse_float_complex*       dst)
+{
+    *reinterpret_cast<float4*>(dst)     = *reinterpret_cast<const float4*>(src);
+    *reinterpret_cast<float4*>(dst + 2) = *reinterpret_cast<const float4*>(src + 2);
+}
+
+static __device__ __forceinline__ void gthr_wide_copy(const rocsparse_double_complex* src,
+                                                      rocsparse_double_complex*       dst)
+{
+    *reinterpret_cast<double2*>(dst)     = *reinterpret_cast<const double2*>(src);
+    *reinterpret_cast<double2*>(dst + 1) = *reinterpret_cast<const double2*>(src + 1);
+    *reinterpret_cast<double2*>(dst + 2) = *reinterpret_cast<const double2*>(src + 2);
+    *reinterpret_cast<double2*>(dst + 3) = *reinterpret_cast<const double2*>(src + 3);
+}
+
+// Vectorized gather, processing four entries per thread. The four sparse
+// indices are read with a single 128 bit transaction. If they form a
+// contiguous run in y and source and destination are 128 bit aligned, the
+// dense side is copied with full width vector instructions as well,
+// otherwise the four entries are gathered individually. The 128 bit index
+// read only holds four indices for 32-bit rocsparse_int, ILP64 builds take
+// the scalar path.
+template <typename T>
+__global__ void gthr_vector_kernel(rocsparse_int        nnz,
+                                   const T*             y,
+                                   T*                   x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int idx = (hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x) * 4;
+
+    if(sizeof(rocsparse_int) == sizeof(int) && idx + 4 <= nnz
+       && reinterpret_cast<uintptr_t>(x_ind + idx) % sizeof(int4) == 0)
+    {
+        int4 ind = *reinterpret_cast<const int4*>(x_ind + idx);
+
+        const T* src = y + ind.x - idx_base;
+
+        if(ind.y == ind.x + 1 && ind.z == ind.x + 2 && ind.w == ind.x + 3
+           && reinterpret_cast<uintptr_t>(src) % sizeof(int4) == 0
+           && reinterpret_cast<uintptr_t>(x_val + idx) % sizeof(int4) == 0)
+        {
+            gthr_wide_copy(src, x_val + idx);
+        }
+        else
+        {
+            x_val[idx]     = y[ind.x - idx_base];
+            x_val[idx + 1] = y[ind.y - idx_base];
+            x_val[idx + 2] = y[ind.z - idx_base];
+            x_val[idx + 3] = y[ind.w - idx_base];
+        }
+    }
+    else
+    {
+        rocsparse_int end = (idx + 4 < nnz) ? idx + 4 : nnz;
+
+        for(rocsparse_int i = idx; i < end; ++i)
+        {
+            x_val[i] = y[x_ind[i] - idx_base];
+        }
+    }
+}
+
+// Strided batched gather, processing one batch member per workgroup. All
+// batch members share the sparsity pattern x_ind, the values and the dense
+// vector of batch i are expected at x_val + i * x_stride and
+// y + i * y_stride
+template <typename T>
+__global__ void gthr_batched_kernel(rocsparse_int        nnz,
+                                    const T*             y,
+                                    rocsparse_int        y_stride,
+                                    T*                   x_val,
+                                    const rocsparse_int* x_ind,
+                                    rocsparse_int        x_stride,
+                                    rocsparse_index_base idx_base)
+{
+    const T* batch_y = y + hipBlockIdx_x * y_stride;
+    T*       batch_x = x_val + hipBlockIdx_x * x_stride;
+
+    for(rocsparse_int idx = hipThreadIdx_x; idx < nnz; idx += hipBlockDim_x)
+    {
+        batch_x[idx] = batch_y[x_ind[idx] - idx_base];
+    }
+}
+
 #endif // GTHR_DEVICE_H
@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef LEVEL1_CHAIN_DEVICE_H
+#define LEVEL1_CHAIN_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Maximum number of operations of a fused level 1 chain
+#define LEVEL1_CHAIN_MAX_OPS 8
+
+// Operation list of a fused level 1 chain, passed to the kernel by value.
+// In host pointer mode, the scalars are embedded. In device pointer mode,
+// the kernel reads the scalars from the device array instead
+template <typename T>
+struct level1_chain_params
+{
+    rocsparse_int nops;
+    int           op[LEVEL1_CHAIN_MAX_OPS];
+    T             scalar[2 * LEVEL1_CHAIN_MAX_OPS];
+};
+
+// Fused chain of level 1 operations over a shared index set. Each thread
+// processes one sparse vector entry, x_val is loaded into a register once,
+// carried through all operations of the chain and written back at most
+// once. The dense entry y[x_ind] is re-read per operation, it stays in
+// cache as each thread touches a single dense location. The sparse indices
+// must be free of duplicates, since the operations of a chain see the
+// intermediate values of y.
+template <typename T, rocsparse_int NB>
+__global__ void level1_chain_kernel(rocsparse_int        nnz,
+                                    T*                   x_val,
+                                    const rocsparse_int* x_ind,
+                                    T*                   y,
+                                    level1_chain_params<T> params,
+                                    const T* __restrict__ scalars,
+                                    rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int ind = x_ind[gid] - idx_base;
+
+    // Sparse value, kept in a register across the chain
+    T val = x_val[gid];
+
+    // Write back only if an operation modified the sparse value
+    bool modified = false;
+
+    for(rocsparse_int i = 0; i < params.nops; ++i)
+    {
+        T s0 = (scalars != nullptr) ? scalars[2 * i] : params.scalar[2 * i];
+        T s1 = (scalars != nullptr) ? scalars[2 * i + 1] : params.scalar[2 * i + 1];
+
+        switch(params.op[i])
+        {
+        case rocsparse_level1_op_axpyi:
+        {
+            y[ind] = rocsparse_fma(s0, val, y[ind]);
+            break;
+        }
+        case rocsparse_level1_op_gthr:
+        {
+            val      = y[ind];
+            modified = true;
+            break;
+        }
+        case rocsparse_level1_op_gthrz:
+        {
+            val      = y[ind];
+            y[ind]   = static_cast<T>(0);
+            modified = true;
+            break;
+        }
+        case rocsparse_level1_op_sctr:
+        {
+            y[ind] = val;
+            break;
+        }
+        case rocsparse_level1_op_scal:
+        {
+            val *= s0;
+            modified = true;
+            break;
+        }
+        case rocsparse_level1_op_roti:
+        {
+            T yr = y[ind];
+
+            y[ind]   = s0 * yr - s1 * val;
+            val      = s0 * val + s1 * yr;
+            modified = true;
+            break;
+        }
+        }
+    }
+
+    if(modified)
+    {
+        x_val[gid] = val;
+    }
+}
+
+#endif // LEVEL1_CHAIN_DEVICE_H
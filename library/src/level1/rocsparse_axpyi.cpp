@@ -51,3 +51,57 @@ extern "C" rocsparse_status rocsparse_daxpyi(rocsparse_handle     handle,
 {
     return rocsparse_axpyi_template<double>(handle, nnz, alpha, x_val, x_ind, y, idx_base);
 }
+
+extern "C" rocsparse_status rocsparse_saxpyi_batched(rocsparse_handle     handle,
+                                                     rocsparse_int        nnz,
+                                                     const float*         alpha,
+                                                     const float*         x_val,
+                                                     const rocsparse_int* x_ind,
+                                                     rocsparse_int        x_stride,
+                                                     float*               y,
+                                                     rocsparse_int        y_stride,
+                                                     rocsparse_int        batch_count,
+                                                     rocsparse_index_base idx_base)
+{
+    return rocsparse_axpyi_batched_template<float>(
+        handle, nnz, alpha, x_val, x_ind, x_stride, y, y_stride, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_daxpyi_batched(rocsparse_handle     handle,
+                                                     rocsparse_int        nnz,
+                                                     const double*        alpha,
+                                                     const double*        x_val,
+                                                     const rocsparse_int* x_ind,
+                                                     rocsparse_int        x_stride,
+                                                     double*              y,
+                                                     rocsparse_int        y_stride,
+                                                     rocsparse_int        batch_count,
+                                                     rocsparse_index_base idx_base)
+{
+    return rocsparse_axpyi_batched_template<double>(
+        handle, nnz, alpha, x_val, x_ind, x_stride, y, y_stride, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_caxpyi(rocsparse_handle               handle,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_float_complex* alpha,
+                                             const rocsparse_float_complex* x_val,
+                                             const rocsparse_int*           x_ind,
+                                             rocsparse_float_complex*       y,
+                                             rocsparse_index_base           idx_base)
+{
+    return rocsparse_axpyi_template<rocsparse_float_complex>(
+        handle, nnz, alpha, x_val, x_ind, y, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_zaxpyi(rocsparse_handle                handle,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_double_complex* x_val,
+                                             const rocsparse_int*            x_ind,
+                                             rocsparse_double_complex*       y,
+                                             rocsparse_index_base            idx_base)
+{
+    return rocsparse_axpyi_template<rocsparse_double_complex>(
+        handle, nnz, alpha, x_val, x_ind, y, idx_base);
+}
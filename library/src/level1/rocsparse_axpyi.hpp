@@ -59,6 +59,37 @@ __global__ void axpyi_kernel_device_scalar(rocsparse_int        nnz,
     axpyi_device(nnz, *alpha, x_val, x_ind, y, idx_base);
 }
 
+template <typename T>
+__global__ void axpyi_batched_kernel_host_scalar(rocsparse_int        nnz,
+                                                 T                    alpha,
+                                                 const T*             x_val,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        x_stride,
+                                                 T*                   y,
+                                                 rocsparse_int        y_stride,
+                                                 rocsparse_index_base idx_base)
+{
+    axpyi_batched_device(nnz, alpha, x_val, x_ind, x_stride, y, y_stride, idx_base);
+}
+
+template <typename T>
+__global__ void axpyi_batched_kernel_device_scalar(rocsparse_int        nnz,
+                                                   const T*             alpha,
+                                                   const T*             x_val,
+                                                   const rocsparse_int* x_ind,
+                                                   rocsparse_int        x_stride,
+                                                   T*                   y,
+                                                   rocsparse_int        y_stride,
+                                                   rocsparse_index_base idx_base)
+{
+    if(*alpha == static_cast<T>(0))
+    {
+        return;
+    }
+
+    axpyi_batched_device(nnz, *alpha, x_val, x_ind, x_stride, y, y_stride, idx_base);
+}
+
 template <typename T>
 rocsparse_status rocsparse_axpyi_template(rocsparse_handle     handle,
                                           rocsparse_int        nnz,
@@ -183,4 +214,147 @@ rocsparse_status rocsparse_axpyi_template(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_axpyi_batched_template(rocsparse_handle     handle,
+                                                  rocsparse_int        nnz,
+                                                  const T*             alpha,
+                                                  const T*             x_val,
+                                                  const rocsparse_int* x_ind,
+                                                  rocsparse_int        x_stride,
+                                                  T*                   y,
+                                                  rocsparse_int        y_stride,
+                                                  rocsparse_int        batch_count,
+                                                  rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xaxpyi_batched"),
+                  nnz,
+                  *alpha,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  x_stride,
+                  (const void*&)y,
+                  y_stride,
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xaxpyi_batched"),
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  x_stride,
+                  (const void*&)y,
+                  y_stride,
+                  batch_count);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(x_stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(y_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define AXPYI_DIM 256
+    // One workgroup per batch member
+    dim3 axpyi_blocks(batch_count);
+    dim3 axpyi_threads(AXPYI_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((axpyi_batched_kernel_device_scalar<T>),
+                           axpyi_blocks,
+                           axpyi_threads,
+                           0,
+                           stream,
+                           nnz,
+                           alpha,
+                           x_val,
+                           x_ind,
+                           x_stride,
+                           y,
+                           y_stride,
+                           idx_base);
+    }
+    else
+    {
+        if(*alpha == 0.0)
+        {
+            return rocsparse_status_success;
+        }
+
+        hipLaunchKernelGGL((axpyi_batched_kernel_host_scalar<T>),
+                           axpyi_blocks,
+                           axpyi_threads,
+                           0,
+                           stream,
+                           nnz,
+                           *alpha,
+                           x_val,
+                           x_ind,
+                           x_stride,
+                           y,
+                           y_stride,
+                           idx_base);
+    }
+#undef AXPYI_DIM
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_AXPYI_HPP
@@ -25,6 +25,7 @@
 #ifndef ROCSPARSE_DOTCI_HPP
 #define ROCSPARSE_DOTCI_HPP
 
+#include "definitions.h"
 #include "dotci_device.h"
 #include "handle.h"
 #include "rocsparse.h"
@@ -41,7 +42,127 @@ rocsparse_status rocsparse_dotci_template(rocsparse_handle     handle,
                                           T*                   result,
                                           rocsparse_index_base idx_base)
 {
-    return rocsparse_status_not_implemented;
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xdotci"),
+                  nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)y,
+                  *result,
+                  idx_base);
+
+        log_bench(handle, "./rocsparse-bench -f dotci -r", replaceX<T>("X"), "--mtx <vector.mtx> ");
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xdotci"),
+                  nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)y,
+                  (const void*&)result,
+                  idx_base);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check size
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define DOTCI_DIM 256
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    // Get workspace from handle device buffer, the workgroup counter of the
+    // single-pass reduction is placed behind the partials. The buffer is
+    // shared scratch space, so the counter has to be cleared on every call
+    T*            workspace = reinterpret_cast<T*>(handle->buffer);
+    unsigned int* counter   = reinterpret_cast<unsigned int*>(workspace + DOTCI_DIM);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(counter, 0, sizeof(unsigned int), stream));
+
+    // In device pointer mode, the reduced value is written to device memory by
+    // the last workgroup and no host synchronization takes place
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((dotci_kernel<T, DOTCI_DIM>),
+                           dim3(DOTCI_DIM),
+                           dim3(DOTCI_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
+                           workspace,
+                           counter,
+                           result,
+                           idx_base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((dotci_kernel<T, DOTCI_DIM>),
+                           dim3(DOTCI_DIM),
+                           dim3(DOTCI_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
+                           workspace,
+                           counter,
+                           (T*)nullptr,
+                           idx_base);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+    }
+#undef DOTCI_DIM
+
+    return rocsparse_status_success;
 }
 
 #endif // ROCSPARSE_DOTCI_HPP
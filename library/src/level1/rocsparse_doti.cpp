@@ -51,28 +51,56 @@ extern "C" rocsparse_status rocsparse_ddoti(rocsparse_handle     handle,
 {
     return rocsparse_doti_template<double>(handle, nnz, x_val, x_ind, y, result, idx_base);
 }
-/*
-extern "C" rocsparse_status rocsparse_sdoti(rocsparse_handle handle,
-                                            rocsparse_int nnz,
+extern "C" rocsparse_status rocsparse_cdoti(rocsparse_handle               handle,
+                                            rocsparse_int                  nnz,
                                             const rocsparse_float_complex* x_val,
-                                            const rocsparse_int* x_ind,
+                                            const rocsparse_int*           x_ind,
                                             const rocsparse_float_complex* y,
-                                            rocsparse_float_complex* result,
-                                            rocsparse_index_base idx_base)
+                                            rocsparse_float_complex*       result,
+                                            rocsparse_index_base           idx_base)
 {
-    return rocsparse_doti_template<rocsparse_float_complex>(handle, nnz, x_val, x_ind, y, result,
-idx_base);
+    return rocsparse_doti_template<rocsparse_float_complex>(
+        handle, nnz, x_val, x_ind, y, result, idx_base);
 }
 
-extern "C" rocsparse_status rocsparse_ddoti(rocsparse_handle handle,
-                                            rocsparse_int nnz,
+extern "C" rocsparse_status rocsparse_zdoti(rocsparse_handle                handle,
+                                            rocsparse_int                   nnz,
                                             const rocsparse_double_complex* x_val,
-                                            const rocsparse_int* x_ind,
+                                            const rocsparse_int*            x_ind,
                                             const rocsparse_double_complex* y,
-                                            rocsparse_double_complex* result,
-                                            rocsparse_index_base idx_base)
+                                            rocsparse_double_complex*       result,
+                                            rocsparse_index_base            idx_base)
+{
+    return rocsparse_doti_template<rocsparse_double_complex>(
+        handle, nnz, x_val, x_ind, y, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_sdoti_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const float*         x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    const float*         y,
+                                                    rocsparse_int        y_stride,
+                                                    float*               result,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+{
+    return rocsparse_doti_batched_template<float>(
+        handle, nnz, x_val, x_ind, x_stride, y, y_stride, result, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_ddoti_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const double*        x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    const double*        y,
+                                                    rocsparse_int        y_stride,
+                                                    double*              result,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
 {
-    return rocsparse_doti_template<rocsparse_double_complex>(handle, nnz, x_val, x_ind, y, result,
-idx_base);
+    return rocsparse_doti_batched_template<double>(
+        handle, nnz, x_val, x_ind, x_stride, y, y_stride, result, batch_count, idx_base);
 }
-*/
@@ -114,42 +114,47 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
     hipStream_t stream = handle->stream;
 
 #define DOTI_DIM 256
-    // Get workspace from handle device buffer
-    T* workspace = reinterpret_cast<T*>(handle->buffer);
-
-    hipLaunchKernelGGL((doti_kernel_part1<T, DOTI_DIM>),
-                       dim3(DOTI_DIM),
-                       dim3(DOTI_DIM),
-                       0,
-                       stream,
-                       nnz,
-                       x_val,
-                       x_ind,
-                       y,
-                       workspace,
-                       idx_base);
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    // Get workspace from handle device buffer, the workgroup counter of the
+    // single-pass reduction is placed behind the partials. The buffer is
+    // shared scratch space, so the counter has to be cleared on every call
+    T*            workspace = reinterpret_cast<T*>(handle->buffer);
+    unsigned int* counter   = reinterpret_cast<unsigned int*>(workspace + DOTI_DIM);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(counter, 0, sizeof(unsigned int), stream));
 
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        hipLaunchKernelGGL((doti_kernel_part2<T, DOTI_DIM>),
-                           dim3(1),
+        hipLaunchKernelGGL((doti_kernel<T, DOTI_DIM>),
+                           dim3(DOTI_DIM),
                            dim3(DOTI_DIM),
                            0,
                            stream,
-                           DOTI_DIM,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
                            workspace,
-                           result);
+                           counter,
+                           result,
+                           idx_base);
     }
     else
     {
-        hipLaunchKernelGGL((doti_kernel_part2<T, DOTI_DIM>),
-                           dim3(1),
+        hipLaunchKernelGGL((doti_kernel<T, DOTI_DIM>),
+                           dim3(DOTI_DIM),
                            dim3(DOTI_DIM),
                            0,
                            stream,
-                           DOTI_DIM,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
                            workspace,
-                           nullptr);
+                           counter,
+                           (T*)nullptr,
+                           idx_base);
 
         RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
     }
@@ -158,4 +163,144 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_doti_batched_template(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const T*             x_val,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        x_stride,
+                                                 const T*             y,
+                                                 rocsparse_int        y_stride,
+                                                 T*                   result,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdoti_batched"),
+              nnz,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              x_stride,
+              (const void*&)y,
+              y_stride,
+              (const void*&)result,
+              batch_count,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(x_stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(y_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define DOTI_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // Each workgroup reduces its batch member and writes the scalar
+        // directly to device memory
+        hipLaunchKernelGGL((doti_batched_kernel<T, DOTI_DIM>),
+                           dim3(batch_count),
+                           dim3(DOTI_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           x_stride,
+                           y,
+                           y_stride,
+                           result,
+                           idx_base);
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+        // Get workspace from handle device buffer. The batch is processed in
+        // chunks that fit into the buffer, each chunk is copied back to the
+        // host result array
+        T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+        rocsparse_int chunk_size = handle->buffer_size / sizeof(T);
+
+        for(rocsparse_int batch = 0; batch < batch_count; batch += chunk_size)
+        {
+            rocsparse_int chunk
+                = (batch_count - batch < chunk_size) ? batch_count - batch : chunk_size;
+
+            hipLaunchKernelGGL((doti_batched_kernel<T, DOTI_DIM>),
+                               dim3(chunk),
+                               dim3(DOTI_DIM),
+                               0,
+                               stream,
+                               nnz,
+                               x_val + batch * x_stride,
+                               x_ind,
+                               x_stride,
+                               y + batch * y_stride,
+                               y_stride,
+                               workspace,
+                               idx_base);
+
+            RETURN_IF_HIP_ERROR(hipMemcpy(
+                result + batch, workspace, sizeof(T) * chunk, hipMemcpyDeviceToHost));
+        }
+    }
+#undef DOTI_DIM
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_DOTI_HPP
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_dotii.hpp"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_sdotii(rocsparse_handle     handle,
+                                             rocsparse_int        x_nnz,
+                                             const float*         x_val,
+                                             const rocsparse_int* x_ind,
+                                             rocsparse_int        y_nnz,
+                                             const float*         y_val,
+                                             const rocsparse_int* y_ind,
+                                             float*               result,
+                                             rocsparse_index_base idx_base)
+{
+    return rocsparse_dotii_template<float>(
+        handle, x_nnz, x_val, x_ind, y_nnz, y_val, y_ind, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_ddotii(rocsparse_handle     handle,
+                                             rocsparse_int        x_nnz,
+                                             const double*        x_val,
+                                             const rocsparse_int* x_ind,
+                                             rocsparse_int        y_nnz,
+                                             const double*        y_val,
+                                             const rocsparse_int* y_ind,
+                                             double*              result,
+                                             rocsparse_index_base idx_base)
+{
+    return rocsparse_dotii_template<double>(
+        handle, x_nnz, x_val, x_ind, y_nnz, y_val, y_ind, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_cdotii(rocsparse_handle               handle,
+                                             rocsparse_int                  x_nnz,
+                                             const rocsparse_float_complex* x_val,
+                                             const rocsparse_int*           x_ind,
+                                             rocsparse_int                  y_nnz,
+                                             const rocsparse_float_complex* y_val,
+                                             const rocsparse_int*           y_ind,
+                                             rocsparse_float_complex*       result,
+                                             rocsparse_index_base           idx_base)
+{
+    return rocsparse_dotii_template<rocsparse_float_complex>(
+        handle, x_nnz, x_val, x_ind, y_nnz, y_val, y_ind, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_zdotii(rocsparse_handle                handle,
+                                             rocsparse_int                   x_nnz,
+                                             const rocsparse_double_complex* x_val,
+                                             const rocsparse_int*            x_ind,
+                                             rocsparse_int                   y_nnz,
+                                             const rocsparse_double_complex* y_val,
+                                             const rocsparse_int*            y_ind,
+                                             rocsparse_double_complex*       result,
+                                             rocsparse_index_base            idx_base)
+{
+    return rocsparse_dotii_template<rocsparse_double_complex>(
+        handle, x_nnz, x_val, x_ind, y_nnz, y_val, y_ind, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_sdotii_batched(rocsparse_handle     handle,
+                                                     rocsparse_int        batch_count,
+                                                     const float*         x_val,
+                                                     const rocsparse_int* x_ind,
+                                                     const rocsparse_int* x_ptr,
+                                                     const float*         y_val,
+                                                     const rocsparse_int* y_ind,
+                                                     const rocsparse_int* y_ptr,
+                                                     float*               result,
+                                                     rocsparse_index_base idx_base)
+{
+    return rocsparse_dotii_batched_template<float>(
+        handle, batch_count, x_val, x_ind, x_ptr, y_val, y_ind, y_ptr, result, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_ddotii_batched(rocsparse_handle     handle,
+                                                     rocsparse_int        batch_count,
+                                                     const double*        x_val,
+                                                     const rocsparse_int* x_ind,
+                                                     const rocsparse_int* x_ptr,
+                                                     const double*        y_val,
+                                                     const rocsparse_int* y_ind,
+                                                     const rocsparse_int* y_ptr,
+                                                     double*              result,
+                                                     rocsparse_index_base idx_base)
+{
+    return rocsparse_dotii_batched_template<double>(
+        handle, batch_count, x_val, x_ind, x_ptr, y_val, y_ind, y_ptr, result, idx_base);
+}
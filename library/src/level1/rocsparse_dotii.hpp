@@ -0,0 +1,373 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_DOTII_HPP
+#define ROCSPARSE_DOTII_HPP
+
+#include "definitions.h"
+#include "dotii_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_dotii_template(rocsparse_handle     handle,
+                                          rocsparse_int        x_nnz,
+                                          const T*             x_val,
+                                          const rocsparse_int* x_ind,
+                                          rocsparse_int        y_nnz,
+                                          const T*             y_val,
+                                          const rocsparse_int* y_ind,
+                                          T*                   result,
+                                          rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdotii"),
+              x_nnz,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              y_nnz,
+              (const void*&)y_val,
+              (const void*&)y_ind,
+              (const void*&)result,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(x_nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(y_nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(x_nnz == 0 || y_nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Iterate over the shorter vector and binary search the longer one,
+    // the dot product is symmetric
+    if(y_nnz < x_nnz)
+    {
+        rocsparse_int        tmp_nnz = x_nnz;
+        const T*             tmp_val = x_val;
+        const rocsparse_int* tmp_ind = x_ind;
+
+        x_nnz = y_nnz;
+        x_val = y_val;
+        x_ind = y_ind;
+        y_nnz = tmp_nnz;
+        y_val = tmp_val;
+        y_ind = tmp_ind;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define DOTII_DIM 256
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    // Get workspace from handle device buffer, the workgroup counter of the
+    // single-pass reduction is placed behind the partials. The buffer is
+    // shared scratch space, so the counter has to be cleared on every call
+    T*            workspace = reinterpret_cast<T*>(handle->buffer);
+    unsigned int* counter   = reinterpret_cast<unsigned int*>(workspace + DOTII_DIM);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(counter, 0, sizeof(unsigned int), stream));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((dotii_kernel<T, DOTII_DIM>),
+                           dim3(DOTII_DIM),
+                           dim3(DOTII_DIM),
+                           0,
+                           stream,
+                           x_nnz,
+                           x_val,
+                           x_ind,
+                           y_nnz,
+                           y_val,
+                           y_ind,
+                           workspace,
+                           counter,
+                           result);
+    }
+    else
+    {
+        hipLaunchKernelGGL((dotii_kernel<T, DOTII_DIM>),
+                           dim3(DOTII_DIM),
+                           dim3(DOTII_DIM),
+                           0,
+                           stream,
+                           x_nnz,
+                           x_val,
+                           x_ind,
+                           y_nnz,
+                           y_val,
+                           y_ind,
+                           workspace,
+                           counter,
+                           (T*)nullptr);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+    }
+#undef DOTII_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_dotii_batched_template(rocsparse_handle     handle,
+                                                  rocsparse_int        batch_count,
+                                                  const T*             x_val,
+                                                  const rocsparse_int* x_ind,
+                                                  const rocsparse_int* x_ptr,
+                                                  const T*             y_val,
+                                                  const rocsparse_int* y_ind,
+                                                  const rocsparse_int* y_ptr,
+                                                  T*                   result,
+                                                  rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xdotii_batched"),
+              batch_count,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              (const void*&)x_ptr,
+              (const void*&)y_val,
+              (const void*&)y_ind,
+              (const void*&)y_ptr,
+              (const void*&)result,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check size
+    if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define DOTII_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // Each wavefront reduces its vector pair and writes the scalar
+        // directly to device memory
+        dim3 dotii_blocks((batch_count * handle->wavefront_size - 1) / DOTII_DIM + 1);
+        dim3 dotii_threads(DOTII_DIM);
+
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((dotii_batched_kernel<T, DOTII_DIM, 32>),
+                               dotii_blocks,
+                               dotii_threads,
+                               0,
+                               stream,
+                               batch_count,
+                               x_val,
+                               x_ind,
+                               x_ptr,
+                               y_val,
+                               y_ind,
+                               y_ptr,
+                               result,
+                               idx_base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((dotii_batched_kernel<T, DOTII_DIM, 64>),
+                               dotii_blocks,
+                               dotii_threads,
+                               0,
+                               stream,
+                               batch_count,
+                               x_val,
+                               x_ind,
+                               x_ptr,
+                               y_val,
+                               y_ind,
+                               y_ptr,
+                               result,
+                               idx_base);
+        }
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+        // Get workspace from handle device buffer. The batch is processed in
+        // chunks that fit into the buffer, each chunk is copied back to the
+        // host result array
+        T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+        rocsparse_int chunk_size = handle->buffer_size / sizeof(T);
+
+        for(rocsparse_int batch = 0; batch < batch_count; batch += chunk_size)
+        {
+            rocsparse_int chunk
+                = (batch_count - batch < chunk_size) ? batch_count - batch : chunk_size;
+
+            dim3 dotii_blocks((chunk * handle->wavefront_size - 1) / DOTII_DIM + 1);
+            dim3 dotii_threads(DOTII_DIM);
+
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((dotii_batched_kernel<T, DOTII_DIM, 32>),
+                                   dotii_blocks,
+                                   dotii_threads,
+                                   0,
+                                   stream,
+                                   chunk,
+                                   x_val,
+                                   x_ind,
+                                   x_ptr + batch,
+                                   y_val,
+                                   y_ind,
+                                   y_ptr + batch,
+                                   workspace,
+                                   idx_base);
+            }
+            else
+            {
+                hipLaunchKernelGGL((dotii_batched_kernel<T, DOTII_DIM, 64>),
+                                   dotii_blocks,
+                                   dotii_threads,
+                                   0,
+                                   stream,
+                                   chunk,
+                                   x_val,
+                                   x_ind,
+                                   x_ptr + batch,
+                                   y_val,
+                                   y_ind,
+                                   y_ptr + batch,
+                                   workspace,
+                                   idx_base);
+            }
+
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(result + batch, workspace, sizeof(T) * chunk, hipMemcpyDeviceToHost));
+        }
+    }
+#undef DOTII_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_DOTII_HPP
@@ -49,3 +49,53 @@ extern "C" rocsparse_status rocsparse_dgthr(rocsparse_handle     handle,
 {
     return rocsparse_gthr_template<double>(handle, nnz, y, x_val, x_ind, idx_base);
 }
+
+extern "C" rocsparse_status rocsparse_sgthr_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const float*         y,
+                                                    rocsparse_int        y_stride,
+                                                    float*               x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+{
+    return rocsparse_gthr_batched_template<float>(
+        handle, nnz, y, y_stride, x_val, x_ind, x_stride, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dgthr_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const double*        y,
+                                                    rocsparse_int        y_stride,
+                                                    double*              x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+{
+    return rocsparse_gthr_batched_template<double>(
+        handle, nnz, y, y_stride, x_val, x_ind, x_stride, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_cgthr(rocsparse_handle               handle,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_float_complex* y,
+                                            rocsparse_float_complex*       x_val,
+                                            const rocsparse_int*           x_ind,
+                                            rocsparse_index_base           idx_base)
+{
+    return rocsparse_gthr_template<rocsparse_float_complex>(
+        handle, nnz, y, x_val, x_ind, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_zgthr(rocsparse_handle                handle,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_double_complex* y,
+                                            rocsparse_double_complex*       x_val,
+                                            const rocsparse_int*            x_ind,
+                                            rocsparse_index_base            idx_base)
+{
+    return rocsparse_gthr_template<rocsparse_double_complex>(
+        handle, nnz, y, x_val, x_ind, idx_base);
+}
@@ -93,11 +93,130 @@ rocsparse_status rocsparse_gthr_template(rocsparse_handle     handle,
     hipStream_t stream = handle->stream;
 
 #define GTHR_DIM 512
-    dim3 gthr_blocks((nnz - 1) / GTHR_DIM + 1);
+    // Vectorized kernel processing four entries per thread, falling back to
+    // one entry per thread for small vectors where the wide transactions
+    // cannot be amortized
+    if(nnz >= GTHR_DIM)
+    {
+        dim3 gthr_blocks((nnz - 1) / (GTHR_DIM * 4) + 1);
+        dim3 gthr_threads(GTHR_DIM);
+
+        hipLaunchKernelGGL((gthr_vector_kernel<T>),
+                           gthr_blocks,
+                           gthr_threads,
+                           0,
+                           stream,
+                           nnz,
+                           y,
+                           x_val,
+                           x_ind,
+                           idx_base);
+    }
+    else
+    {
+        dim3 gthr_blocks((nnz - 1) / GTHR_DIM + 1);
+        dim3 gthr_threads(GTHR_DIM);
+
+        hipLaunchKernelGGL(
+            (gthr_kernel<T>), gthr_blocks, gthr_threads, 0, stream, nnz, y, x_val, x_ind, idx_base);
+    }
+#undef GTHR_DIM
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gthr_batched_template(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const T*             y,
+                                                 rocsparse_int        y_stride,
+                                                 T*                   x_val,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        x_stride,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgthr_batched"),
+              nnz,
+              (const void*&)y,
+              y_stride,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              x_stride,
+              batch_count,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(x_stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(y_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define GTHR_DIM 512
+    // One workgroup per batch member
+    dim3 gthr_blocks(batch_count);
     dim3 gthr_threads(GTHR_DIM);
 
-    hipLaunchKernelGGL(
-        (gthr_kernel<T>), gthr_blocks, gthr_threads, 0, stream, nnz, y, x_val, x_ind, idx_base);
+    hipLaunchKernelGGL((gthr_batched_kernel<T>),
+                       gthr_blocks,
+                       gthr_threads,
+                       0,
+                       stream,
+                       nnz,
+                       y,
+                       y_stride,
+                       x_val,
+                       x_ind,
+                       x_stride,
+                       idx_base);
 #undef GTHR_DIM
     return rocsparse_status_success;
 }
@@ -49,3 +49,25 @@ extern "C" rocsparse_status rocsparse_dgthrz(rocsparse_handle     handle,
 {
     return rocsparse_gthrz_template<double>(handle, nnz, y, x_val, x_ind, idx_base);
 }
+
+extern "C" rocsparse_status rocsparse_cgthrz(rocsparse_handle         handle,
+                                             rocsparse_int            nnz,
+                                             rocsparse_float_complex* y,
+                                             rocsparse_float_complex* x_val,
+                                             const rocsparse_int*     x_ind,
+                                             rocsparse_index_base     idx_base)
+{
+    return rocsparse_gthrz_template<rocsparse_float_complex>(
+        handle, nnz, y, x_val, x_ind, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_zgthrz(rocsparse_handle          handle,
+                                             rocsparse_int             nnz,
+                                             rocsparse_double_complex* y,
+                                             rocsparse_double_complex* x_val,
+                                             const rocsparse_int*      x_ind,
+                                             rocsparse_index_base      idx_base)
+{
+    return rocsparse_gthrz_template<rocsparse_double_complex>(
+        handle, nnz, y, x_val, x_ind, idx_base);
+}
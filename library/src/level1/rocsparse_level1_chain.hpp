@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_LEVEL1_CHAIN_HPP
+#define ROCSPARSE_LEVEL1_CHAIN_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "level1_chain_device.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+// Returns true if the operation consumes at least one scalar
+static inline bool level1_chain_op_has_scalar(rocsparse_level1_op op)
+{
+    return op == rocsparse_level1_op_axpyi || op == rocsparse_level1_op_scal
+           || op == rocsparse_level1_op_roti;
+}
+
+template <typename T>
+rocsparse_status rocsparse_level1_chain_template(rocsparse_handle           handle,
+                                                 rocsparse_int              nnz,
+                                                 T*                         x_val,
+                                                 const rocsparse_int*       x_ind,
+                                                 T*                         y,
+                                                 rocsparse_int              nops,
+                                                 const rocsparse_level1_op* ops,
+                                                 const T*                   scalars,
+                                                 rocsparse_index_base       idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xlevel1_chain"),
+              nnz,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              (const void*&)y,
+              nops,
+              (const void*&)ops,
+              (const void*&)scalars,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nops < 0 || nops > LEVEL1_CHAIN_MAX_OPS)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || nops == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ops == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Validate the operation list, the scalars are only required if at
+    // least one operation consumes them
+    bool need_scalars = false;
+
+    for(rocsparse_int i = 0; i < nops; ++i)
+    {
+        if(ops[i] != rocsparse_level1_op_axpyi && ops[i] != rocsparse_level1_op_gthr
+           && ops[i] != rocsparse_level1_op_gthrz && ops[i] != rocsparse_level1_op_sctr
+           && ops[i] != rocsparse_level1_op_scal && ops[i] != rocsparse_level1_op_roti)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        need_scalars |= level1_chain_op_has_scalar(ops[i]);
+    }
+
+    if(need_scalars && scalars == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Pack the operation list into the kernel parameters
+    level1_chain_params<T> params;
+
+    params.nops = nops;
+
+    for(rocsparse_int i = 0; i < nops; ++i)
+    {
+        params.op[i] = ops[i];
+    }
+
+#define LEVEL1_CHAIN_DIM 256
+    dim3 chain_blocks((nnz - 1) / LEVEL1_CHAIN_DIM + 1);
+    dim3 chain_threads(LEVEL1_CHAIN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device, the kernel reads the scalars from
+        // the device array
+        hipLaunchKernelGGL((level1_chain_kernel<T, LEVEL1_CHAIN_DIM>),
+                           chain_blocks,
+                           chain_threads,
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
+                           params,
+                           scalars,
+                           idx_base);
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host, embed the scalars into the kernel
+        // parameters
+        for(rocsparse_int i = 0; i < 2 * nops; ++i)
+        {
+            params.scalar[i] = (scalars != nullptr) ? scalars[i] : static_cast<T>(0);
+        }
+
+        hipLaunchKernelGGL((level1_chain_kernel<T, LEVEL1_CHAIN_DIM>),
+                           chain_blocks,
+                           chain_threads,
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
+                           params,
+                           (const T*)nullptr,
+                           idx_base);
+    }
+#undef LEVEL1_CHAIN_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_LEVEL1_CHAIN_HPP
@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_NRM2I_HPP
+#define ROCSPARSE_NRM2I_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+#include "nrm2i_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_nrm2i_template(rocsparse_handle handle,
+                                          rocsparse_int    nnz,
+                                          const T*         x_val,
+                                          T*               result)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle, replaceX<T>("rocsparse_Xnrm2i"), nnz, (const void*&)x_val, *result);
+
+        log_bench(handle, "./rocsparse-bench -f nrm2i -r", replaceX<T>("X"), "--mtx <vector.mtx> ");
+    }
+    else
+    {
+        log_trace(
+            handle, replaceX<T>("rocsparse_Xnrm2i"), nnz, (const void*&)x_val, (const void*&)result);
+    }
+
+    // Check size
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(result == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(result, 0, sizeof(T), handle->stream));
+        }
+        else
+        {
+            *result = static_cast<T>(0);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define NRM2I_DIM 256
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    // Get workspace from handle device buffer
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    hipLaunchKernelGGL((nrm2i_kernel_part1<T, NRM2I_DIM>),
+                       dim3(NRM2I_DIM),
+                       dim3(NRM2I_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       x_val,
+                       workspace);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((nrm2i_kernel_part2<T, NRM2I_DIM>),
+                           dim3(1),
+                           dim3(NRM2I_DIM),
+                           0,
+                           stream,
+                           NRM2I_DIM,
+                           workspace,
+                           result);
+    }
+    else
+    {
+        hipLaunchKernelGGL((nrm2i_kernel_part2<T, NRM2I_DIM>),
+                           dim3(1),
+                           dim3(NRM2I_DIM),
+                           0,
+                           stream,
+                           NRM2I_DIM,
+                           workspace,
+                           nullptr);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+    }
+#undef NRM2I_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_NRM2I_HPP
@@ -53,3 +53,35 @@ extern "C" rocsparse_status rocsparse_droti(rocsparse_handle     handle,
 {
     return rocsparse_roti_template<double>(handle, nnz, x_val, x_ind, y, c, s, idx_base);
 }
+
+extern "C" rocsparse_status rocsparse_sroti_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    float*               x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    float*               y,
+                                                    rocsparse_int        y_stride,
+                                                    const float*         c,
+                                                    const float*         s,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+{
+    return rocsparse_roti_batched_template<float>(
+        handle, nnz, x_val, x_ind, x_stride, y, y_stride, c, s, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_droti_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    double*              x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    double*              y,
+                                                    rocsparse_int        y_stride,
+                                                    const double*        c,
+                                                    const double*        s,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+{
+    return rocsparse_roti_batched_template<double>(
+        handle, nnz, x_val, x_ind, x_stride, y, y_stride, c, s, batch_count, idx_base);
+}
@@ -61,6 +61,39 @@ __global__ void roti_kernel_device_scalar(rocsparse_int        nnz,
     roti_device(nnz, x_val, x_ind, y, *c, *s, idx_base);
 }
 
+template <typename T>
+__global__ void roti_batched_kernel_host_scalar(rocsparse_int        nnz,
+                                                T*                   x_val,
+                                                const rocsparse_int* x_ind,
+                                                rocsparse_int        x_stride,
+                                                T*                   y,
+                                                rocsparse_int        y_stride,
+                                                T                    c,
+                                                T                    s,
+                                                rocsparse_index_base idx_base)
+{
+    roti_batched_device(nnz, x_val, x_ind, x_stride, y, y_stride, c, s, idx_base);
+}
+
+template <typename T>
+__global__ void roti_batched_kernel_device_scalar(rocsparse_int        nnz,
+                                                  T*                   x_val,
+                                                  const rocsparse_int* x_ind,
+                                                  rocsparse_int        x_stride,
+                                                  T*                   y,
+                                                  rocsparse_int        y_stride,
+                                                  const T*             c,
+                                                  const T*             s,
+                                                  rocsparse_index_base idx_base)
+{
+    if(*c == static_cast<T>(1) && *s == static_cast<T>(0))
+    {
+        return;
+    }
+
+    roti_batched_device(nnz, x_val, x_ind, x_stride, y, y_stride, *c, *s, idx_base);
+}
+
 template <typename T>
 rocsparse_status rocsparse_roti_template(rocsparse_handle     handle,
                                          rocsparse_int        nnz,
@@ -189,4 +222,158 @@ rocsparse_status rocsparse_roti_template(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_roti_batched_template(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 T*                   x_val,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        x_stride,
+                                                 T*                   y,
+                                                 rocsparse_int        y_stride,
+                                                 const T*             c,
+                                                 const T*             s,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xroti_batched"),
+                  nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  x_stride,
+                  (const void*&)y,
+                  y_stride,
+                  *c,
+                  *s,
+                  batch_count,
+                  idx_base);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xroti_batched"),
+                  nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  x_stride,
+                  (const void*&)y,
+                  y_stride,
+                  (const void*&)c,
+                  (const void*&)s,
+                  batch_count,
+                  idx_base);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(x_stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(y_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(c == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(s == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define ROTI_DIM 512
+    // One workgroup per batch member
+    dim3 roti_blocks(batch_count);
+    dim3 roti_threads(ROTI_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((roti_batched_kernel_device_scalar<T>),
+                           roti_blocks,
+                           roti_threads,
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           x_stride,
+                           y,
+                           y_stride,
+                           c,
+                           s,
+                           idx_base);
+    }
+    else
+    {
+        if(*c == static_cast<T>(1) && *s == static_cast<T>(0))
+        {
+            return rocsparse_status_success;
+        }
+
+        hipLaunchKernelGGL((roti_batched_kernel_host_scalar<T>),
+                           roti_blocks,
+                           roti_threads,
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           x_stride,
+                           y,
+                           y_stride,
+                           *c,
+                           *s,
+                           idx_base);
+    }
+#undef ROTI_DIM
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_ROTI_HPP
@@ -49,3 +49,74 @@ extern "C" rocsparse_status rocsparse_dsctr(rocsparse_handle     handle,
 {
     return rocsparse_sctr_template<double>(handle, nnz, x_val, x_ind, y, idx_base);
 }
+
+extern "C" rocsparse_status rocsparse_ssctr_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const float*         x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    float*               y,
+                                                    rocsparse_int        y_stride,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+{
+    return rocsparse_sctr_batched_template<float>(
+        handle, nnz, x_val, x_ind, x_stride, y, y_stride, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dsctr_batched(rocsparse_handle     handle,
+                                                    rocsparse_int        nnz,
+                                                    const double*        x_val,
+                                                    const rocsparse_int* x_ind,
+                                                    rocsparse_int        x_stride,
+                                                    double*              y,
+                                                    rocsparse_int        y_stride,
+                                                    rocsparse_int        batch_count,
+                                                    rocsparse_index_base idx_base)
+{
+    return rocsparse_sctr_batched_template<double>(
+        handle, nnz, x_val, x_ind, x_stride, y, y_stride, batch_count, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_csctr(rocsparse_handle               handle,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_float_complex* x_val,
+                                            const rocsparse_int*           x_ind,
+                                            rocsparse_float_complex*       y,
+                                            rocsparse_index_base           idx_base)
+{
+    return rocsparse_sctr_template<rocsparse_float_complex>(
+        handle, nnz, x_val, x_ind, y, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_zsctr(rocsparse_handle                handle,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_double_complex* x_val,
+                                            const rocsparse_int*            x_ind,
+                                            rocsparse_double_complex*       y,
+                                            rocsparse_index_base            idx_base)
+{
+    return rocsparse_sctr_template<rocsparse_double_complex>(
+        handle, nnz, x_val, x_ind, y, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_ssctr_add(rocsparse_handle     handle,
+                                                rocsparse_int        nnz,
+                                                const float*         x_val,
+                                                const rocsparse_int* x_ind,
+                                                float*               y,
+                                                rocsparse_index_base idx_base)
+{
+    return rocsparse_sctr_add_template<float>(handle, nnz, x_val, x_ind, y, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dsctr_add(rocsparse_handle     handle,
+                                                rocsparse_int        nnz,
+                                                const double*        x_val,
+                                                const rocsparse_int* x_ind,
+                                                double*              y,
+                                                rocsparse_index_base idx_base)
+{
+    return rocsparse_sctr_add_template<double>(handle, nnz, x_val, x_ind, y, idx_base);
+}
+
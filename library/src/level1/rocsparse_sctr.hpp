@@ -92,12 +92,209 @@ rocsparse_status rocsparse_sctr_template(rocsparse_handle     handle,
     // Stream
     hipStream_t stream = handle->stream;
 
+#define SCTR_DIM 512
+    // Vectorized kernel processing four entries per thread, falling back to
+    // one entry per thread for small vectors where the wide transactions
+    // cannot be amortized
+    if(nnz >= SCTR_DIM)
+    {
+        dim3 sctr_blocks((nnz - 1) / (SCTR_DIM * 4) + 1);
+        dim3 sctr_threads(SCTR_DIM);
+
+        hipLaunchKernelGGL((sctr_vector_kernel<T>),
+                           sctr_blocks,
+                           sctr_threads,
+                           0,
+                           stream,
+                           nnz,
+                           x_val,
+                           x_ind,
+                           y,
+                           idx_base);
+    }
+    else
+    {
+        dim3 sctr_blocks((nnz - 1) / SCTR_DIM + 1);
+        dim3 sctr_threads(SCTR_DIM);
+
+        hipLaunchKernelGGL(
+            (sctr_kernel<T>), sctr_blocks, sctr_threads, 0, stream, nnz, x_val, x_ind, y, idx_base);
+    }
+#undef SCTR_DIM
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_sctr_batched_template(rocsparse_handle     handle,
+                                                 rocsparse_int        nnz,
+                                                 const T*             x_val,
+                                                 const rocsparse_int* x_ind,
+                                                 rocsparse_int        x_stride,
+                                                 T*                   y,
+                                                 rocsparse_int        y_stride,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xsctr_batched"),
+              nnz,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              x_stride,
+              (const void*&)y,
+              y_stride,
+              batch_count,
+              idx_base);
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(x_stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(y_stride < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define SCTR_DIM 512
+    // One workgroup per batch member
+    dim3 sctr_blocks(batch_count);
+    dim3 sctr_threads(SCTR_DIM);
+
+    hipLaunchKernelGGL((sctr_batched_kernel<T>),
+                       sctr_blocks,
+                       sctr_threads,
+                       0,
+                       stream,
+                       nnz,
+                       x_val,
+                       x_ind,
+                       x_stride,
+                       y,
+                       y_stride,
+                       idx_base);
+#undef SCTR_DIM
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_sctr_add_template(rocsparse_handle     handle,
+                                             rocsparse_int        nnz,
+                                             const T*             x_val,
+                                             const rocsparse_int* x_ind,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xsctr_add"),
+              nnz,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              (const void*&)y,
+              idx_base);
+
+    log_bench(handle, "./rocsparse-bench -f sctr_add -r", replaceX<T>("X"), "--mtx <vector.mtx> ");
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check size
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
 #define SCTR_DIM 512
     dim3 sctr_blocks((nnz - 1) / SCTR_DIM + 1);
     dim3 sctr_threads(SCTR_DIM);
 
-    hipLaunchKernelGGL(
-        (sctr_kernel<T>), sctr_blocks, sctr_threads, 0, stream, nnz, x_val, x_ind, y, idx_base);
+    hipLaunchKernelGGL((sctr_add_kernel<T>),
+                       sctr_blocks,
+                       sctr_threads,
+                       0,
+                       stream,
+                       nnz,
+                       x_val,
+                       x_ind,
+                       y,
+                       idx_base);
 #undef SCTR_DIM
     return rocsparse_status_success;
 }
@@ -0,0 +1,254 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_TOPK_HPP
+#define ROCSPARSE_TOPK_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+#include "topk_device.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+// Radix sortable key type for each supported precision
+template <typename T>
+struct topk_key;
+
+template <>
+struct topk_key<float>
+{
+    typedef unsigned int type;
+};
+
+template <>
+struct topk_key<double>
+{
+    typedef unsigned long long type;
+};
+
+template <typename T>
+rocsparse_status rocsparse_topk_buffer_size_template(rocsparse_handle handle,
+                                                     rocsparse_int    nnz,
+                                                     rocsparse_int    k,
+                                                     size_t*          buffer_size)
+{
+    typedef typename topk_key<T>::type key_type;
+
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, replaceX<T>("rocsparse_Xtopk_buffer_size"), nnz, k, (const void*&)buffer_size);
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0 || k > nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || k == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim buffer size
+    key_type*      dummy_keys = reinterpret_cast<key_type*>(buffer_size);
+    rocsparse_int* dummy_perm = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    rocprim::double_buffer<key_type>      keys(dummy_keys, dummy_keys);
+    rocprim::double_buffer<rocsparse_int> perm(dummy_perm, dummy_perm);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs_desc(
+        nullptr, *buffer_size, keys, perm, nnz, 0, sizeof(key_type) * 8, stream));
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // keys buffer
+    *buffer_size += sizeof(key_type) * 2 * ((nnz - 1) / 256 + 1) * 256;
+
+    // perm buffer
+    *buffer_size += sizeof(rocsparse_int) * 2 * ((nnz - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_topk_template(rocsparse_handle     handle,
+                                         rocsparse_int        nnz,
+                                         rocsparse_int        k,
+                                         const T*             x_val,
+                                         const rocsparse_int* x_ind,
+                                         T*                   y_val,
+                                         rocsparse_int*       y_ind,
+                                         void*                temp_buffer)
+{
+    typedef typename topk_key<T>::type key_type;
+
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xtopk"),
+              nnz,
+              k,
+              (const void*&)x_val,
+              (const void*&)x_ind,
+              (const void*&)y_val,
+              (const void*&)y_ind,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f topk -r", replaceX<T>("X"), "--mtx <vector.mtx> ");
+
+    // Check sizes
+    if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0 || k > nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(nnz == 0 || k == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // keys buffer
+    key_type* tmp_keys = reinterpret_cast<key_type*>(ptr);
+    ptr += sizeof(key_type) * ((nnz - 1) / 256 + 1) * 256;
+
+    key_type* tmp_keys_alt = reinterpret_cast<key_type*>(ptr);
+    ptr += sizeof(key_type) * ((nnz - 1) / 256 + 1) * 256;
+
+    // perm buffer
+    rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    rocsparse_int* tmp_perm_alt = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+#define TOPK_DIM 256
+    dim3 topk_blocks((nnz - 1) / TOPK_DIM + 1);
+    dim3 topk_threads(TOPK_DIM);
+
+    // Compute magnitude keys and identity permutation
+    hipLaunchKernelGGL((topk_keys_kernel<T, key_type>),
+                       topk_blocks,
+                       topk_threads,
+                       0,
+                       stream,
+                       nnz,
+                       x_val,
+                       tmp_keys,
+                       tmp_perm);
+
+    // Sort the permutation by descending magnitude
+    size_t size;
+
+    rocprim::double_buffer<key_type>      keys(tmp_keys, tmp_keys_alt);
+    rocprim::double_buffer<rocsparse_int> perm(tmp_perm, tmp_perm_alt);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs_desc(
+        nullptr, size, keys, perm, nnz, 0, sizeof(key_type) * 8, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs_desc(
+        tmp_rocprim, size, keys, perm, nnz, 0, sizeof(key_type) * 8, stream));
+
+    // Gather the k largest magnitude entries
+    dim3 topk_gather_blocks((k - 1) / TOPK_DIM + 1);
+
+    hipLaunchKernelGGL((topk_gather_kernel<T>),
+                       topk_gather_blocks,
+                       topk_threads,
+                       0,
+                       stream,
+                       k,
+                       x_val,
+                       x_ind,
+                       perm.current(),
+                       y_val,
+                       y_ind);
+#undef TOPK_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_TOPK_HPP
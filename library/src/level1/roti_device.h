@@ -52,4 +52,36 @@ __device__ void roti_device(rocsparse_int        nnz,
     y[i]       = c * yr - s * xr;
 }
 
+// Strided batched Givens rotation, processing one batch member per
+// workgroup. Gather from y, rotation and scatter back to y happen in a
+// single pass over the shared sparsity pattern x_ind, the values and the
+// dense vector of batch i are expected at x_val + i * x_stride and
+// y + i * y_stride. The indices of a batch member must be free of
+// duplicates, they do not need to be sorted
+template <typename T>
+__device__ void roti_batched_device(rocsparse_int        nnz,
+                                    T*                   x_val,
+                                    const rocsparse_int* x_ind,
+                                    rocsparse_int        x_stride,
+                                    T*                   y,
+                                    rocsparse_int        y_stride,
+                                    T                    c,
+                                    T                    s,
+                                    rocsparse_index_base idx_base)
+{
+    T* batch_x = x_val + hipBlockIdx_x * x_stride;
+    T* batch_y = y + hipBlockIdx_x * y_stride;
+
+    for(rocsparse_int idx = hipThreadIdx_x; idx < nnz; idx += hipBlockDim_x)
+    {
+        rocsparse_int i = x_ind[idx] - idx_base;
+
+        T xr = batch_x[idx];
+        T yr = batch_y[i];
+
+        batch_x[idx] = c * xr + s * yr;
+        batch_y[i]   = c * yr - s * xr;
+    }
+}
+
 #endif // ROTI_DEVICE_H
@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TOPK_DEVICE_H
+#define TOPK_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Radix sortable magnitude key. The bit pattern of a non-negative IEEE floating
+// point number compares monotonically as unsigned integer, such that sorting the
+// keys orders the entries by absolute value.
+static __device__ __forceinline__ unsigned int topk_magnitude_key(float val)
+{
+    return __float_as_uint(fabsf(val));
+}
+
+static __device__ __forceinline__ unsigned long long topk_magnitude_key(double val)
+{
+    return static_cast<unsigned long long>(__double_as_longlong(fabs(val)));
+}
+
+// Compute the magnitude key of each sparse entry and initialize the
+// identity permutation that tracks the entry positions through the sort
+template <typename T, typename K>
+__global__ void topk_keys_kernel(rocsparse_int nnz, const T* x_val, K* keys, rocsparse_int* perm)
+{
+    rocsparse_int idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx >= nnz)
+    {
+        return;
+    }
+
+    keys[idx] = topk_magnitude_key(x_val[idx]);
+    perm[idx] = idx;
+}
+
+// Gather the k largest magnitude entries using the sorted permutation
+template <typename T>
+__global__ void topk_gather_kernel(rocsparse_int        k,
+                                   const T*             x_val,
+                                   const rocsparse_int* x_ind,
+                                   const rocsparse_int* perm,
+                                   T*                   y_val,
+                                   rocsparse_int*       y_ind)
+{
+    rocsparse_int idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx >= k)
+    {
+        return;
+    }
+
+    rocsparse_int pos = perm[idx];
+
+    y_val[idx] = x_val[pos];
+    y_ind[idx] = x_ind[pos];
+}
+
+#endif // TOPK_DEVICE_H
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRMV_DEVICE_H
+#define BSRMV_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// BSR SpMV for general, non-transposed matrices. Each thread processes one
+// row of the matrix, such that the row of each block it touches is kept in
+// registers while streaming through the block row.
+template <typename T>
+static __device__ void bsrmvn_general_device(rocsparse_int        m,
+                                             rocsparse_int        n,
+                                             rocsparse_int        block_dim,
+                                             T                    alpha,
+                                             const rocsparse_int* bsr_row_ptr,
+                                             const rocsparse_int* bsr_col_ind,
+                                             const T*             bsr_val,
+                                             const T*             x,
+                                             T                    beta,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int block_row = row / block_dim;
+    rocsparse_int local_row = row % block_dim;
+
+    rocsparse_int row_start = bsr_row_ptr[block_row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[block_row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    // Loop over non-zero blocks
+    for(rocsparse_int j = row_start; j < row_end; ++j)
+    {
+        rocsparse_int block_col = rocsparse_nontemporal_load(bsr_col_ind + j) - idx_base;
+        const T*      block_val = bsr_val + j * block_dim * block_dim + local_row * block_dim;
+
+        // Loop over the columns of the current block; padded entries of the
+        // last block column are zero and must not touch x
+        for(rocsparse_int c = 0; c < block_dim; ++c)
+        {
+            rocsparse_int col = block_col * block_dim + c;
+
+            if(col < n)
+            {
+                sum = rocsparse_fma(
+                    rocsparse_nontemporal_load(block_val + c), rocsparse_ldg(x + col), sum);
+            }
+        }
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        T yv = rocsparse_nontemporal_load(y + row);
+        rocsparse_nontemporal_store(rocsparse_fma(beta, yv, alpha * sum), y + row);
+    }
+    else
+    {
+        rocsparse_nontemporal_store(alpha * sum, y + row);
+    }
+}
+
+#endif // BSRMV_DEVICE_H
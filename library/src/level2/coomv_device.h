@@ -29,73 +29,95 @@
 
 #include <hip/hip_runtime.h>
 
-// Scale kernel for beta != 1.0
-template <typename T>
-__device__ void coomv_scale_device(rocsparse_int size, T beta, T* __restrict__ data)
-{
-    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-
-    if(gid >= size)
-    {
-        return;
-    }
-
-    data[gid] *= beta;
-}
-
 // Implementation motivated by papers 'Efficient Sparse Matrix-Vector Multiplication on CUDA',
 // 'Implementing Sparse Matrix-Vector Multiplication on Throughput-Oriented Processors' and
-// 'Segmented operations for sparse matrix computation on vector multiprocessors'
+// 'Segmented operations for sparse matrix computation on vector multiprocessors'.
+// Partial row sums are combined by a shuffle based segmented reduction that
+// is held entirely in registers within each wavefront.
+// Rows that span wavefront boundaries are completed with atomic additions,
+// such that no intermediate workgroup results have to round-trip through
+// global memory and a second reduction kernel. The scaling of y with beta is
+// fused into the kernel, such that no standalone scaling kernel has to be
+// launched up front.
+//
+// In deterministic mode, selected by passing non-null slot arrays, the
+// boundary rows are not completed atomically. Instead, each wavefront stores
+// the partial sum of the first and the last row of its range to a fixed slot
+// and coomvn_slot_combine_device adds the slots up in wavefront order, such
+// that the floating point additions always execute in the same order and the
+// results are bitwise reproducible run-to-run. Rows that are fully contained
+// in a single wavefronts range have exactly one writer and are updated
+// directly
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
-static __device__ void coomvn_general_wf_reduce(rocsparse_int        nnz,
+static __device__ void coomvn_general_wf_reduce(rocsparse_int        m,
+                                                rocsparse_int        nnz,
                                                 rocsparse_int        loops,
                                                 T                    alpha,
                                                 const rocsparse_int* coo_row_ind,
                                                 const rocsparse_int* coo_col_ind,
                                                 const T*             coo_val,
                                                 const T*             x,
+                                                T                    beta,
                                                 T*                   y,
-                                                rocsparse_int*       row_block_red,
-                                                T*                   val_block_red,
+                                                rocsparse_int*       slot_row,
+                                                T*                   slot_val,
+                                                int*                 count,
+                                                int*                 generation,
                                                 rocsparse_index_base idx_base)
 {
     rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    rocsparse_int tid = hipThreadIdx_x;
+
+    // Scale y with beta, covering also the rows that have no non-zero
+    // entries and are never touched by the scatter stage
+    if(beta == static_cast<T>(0))
+    {
+        for(rocsparse_int i = gid; i < m; i += hipGridDim_x * hipBlockDim_x)
+        {
+            y[i] = static_cast<T>(0);
+        }
+    }
+    else if(beta != static_cast<T>(1))
+    {
+        for(rocsparse_int i = gid; i < m; i += hipGridDim_x * hipBlockDim_x)
+        {
+            y[i] *= beta;
+        }
+    }
+
+    // The partial row sums scatter into y with atomic additions, the
+    // scaling must therefore have completed device wide before the
+    // reduction starts
+    rocsparse_grid_barrier(count, generation, 0);
 
     // Lane index (0,...,WF_SIZE)
     rocsparse_int lid = gid % WF_SIZE;
     // Wavefront index
     rocsparse_int wid = gid / WF_SIZE;
 
-    // Initialize block buffers
-    if(lid == 0)
-    {
-        rocsparse_nontemporal_store(-1, row_block_red + wid);
-        rocsparse_nontemporal_store(static_cast<T>(0), val_block_red + wid);
-    }
-
     // Global COO array index start for current wavefront
     rocsparse_int offset = wid * loops * WF_SIZE;
 
-    // Shared memory to hold row indices and values for segmented reduction
-    __shared__ rocsparse_int shared_row[BLOCKSIZE];
-    __shared__ T             shared_val[BLOCKSIZE];
-
-    // Initialize shared memory
-    shared_row[tid] = -1;
-    shared_val[tid] = static_cast<T>(0);
-
-    __syncthreads();
-
-    // Quick return when thread is out of bounds
-    if(offset + lid >= nnz)
+    // Quick return when the wavefront is out of bounds. Partially filled
+    // wavefronts keep all of their lanes, such that the shuffle based
+    // segmented reduction below operates on fully active wavefronts
+    if(offset >= nnz)
     {
         return;
     }
 
+    // First row of this wavefronts range, the only row that can be shared
+    // with the preceding wavefront
+    rocsparse_int first_row
+        = (slot_row != nullptr) ? rocsparse_nontemporal_load(coo_row_ind + offset) - idx_base : -1;
+
     rocsparse_int row;
     T             val;
 
+    // Row index and partial sum of the last lane, carried over from the
+    // previous iteration
+    rocsparse_int prev_row = -1;
+    T             prev_val = static_cast<T>(0);
+
     // Current threads index into COO structure
     rocsparse_int idx = offset + lid;
 
@@ -117,134 +139,165 @@ static __device__ void coomvn_general_wf_reduce(rocsparse_int        nnz,
             val = static_cast<T>(0);
         }
 
-        // First thread in wavefront checks row index from previous loop
+        // First lane in wavefront checks row index from previous loop
         // if it has been completed or if additional rows have to be
         // appended.
         if(idx > offset && lid == 0)
         {
-            rocsparse_int prevrow = shared_row[tid + WF_SIZE - 1];
-            if(row == prevrow)
+            if(row == prev_row)
             {
-                val += shared_val[tid + WF_SIZE - 1];
+                val += prev_val;
             }
-            else if(prevrow >= 0)
+            else if(prev_row >= 0)
             {
-                y[prevrow] += shared_val[tid + WF_SIZE - 1];
+                if(slot_row == nullptr)
+                {
+                    atomicAdd(y + prev_row, prev_val);
+                }
+                else if(prev_row == first_row)
+                {
+                    slot_row[2 * wid] = prev_row;
+                    slot_val[2 * wid] = prev_val;
+                }
+                else
+                {
+                    // Row begins and ends within this wavefronts range,
+                    // there is no second writer
+                    y[prev_row] += prev_val;
+                }
             }
         }
 
-        __syncthreads();
-
-        // Update shared buffers
-        shared_row[tid] = row;
-        shared_val[tid] = val;
-
-        __syncthreads();
-
 #pragma unroll
-        // Segmented wavefront reduction
+        // Segmented wavefront reduction in registers
         for(rocsparse_int j = 1; j < WF_SIZE; j <<= 1)
         {
-            if(lid >= j)
+            rocsparse_int peer_row = rocsparse_shfl_up(row, j, WF_SIZE);
+            T             peer_val = rocsparse_shfl_up(val, j, WF_SIZE);
+
+            if(lid >= j && row == peer_row)
             {
-                if(row == shared_row[tid - j])
-                {
-                    val += shared_val[tid - j];
-                }
+                val += peer_val;
             }
-            __syncthreads();
-
-            shared_val[tid] = val;
-
-            __syncthreads();
         }
 
+        rocsparse_int next_row = rocsparse_shfl_down(row, 1, WF_SIZE);
+
         // All lanes but the last one write their result in y.
         // The last value might need to be appended by the next iteration.
         if(lid < WF_SIZE - 1)
         {
-            if(row != shared_row[tid + 1] && row >= 0)
+            if(row != next_row && row >= 0)
             {
-                y[row] += val;
+                if(slot_row == nullptr)
+                {
+                    atomicAdd(y + row, val);
+                }
+                else if(row == first_row)
+                {
+                    slot_row[2 * wid] = row;
+                    slot_val[2 * wid] = val;
+                }
+                else
+                {
+                    y[row] += val;
+                }
             }
         }
 
+        // Broadcast the last lanes row and partial sum for the next
+        // iteration
+        prev_row = rocsparse_shfl(row, WF_SIZE - 1, WF_SIZE);
+        prev_val = rocsparse_shfl(val, WF_SIZE - 1, WF_SIZE);
+
         // Keep going for the next iteration
         idx += WF_SIZE;
     }
 
-    // Write last entries into buffers for segmented block reduction
-    if(lid == WF_SIZE - 1)
+    // The last row of each wavefront can span into the next wavefronts
+    // work and is therefore completed atomically
+    if(lid == WF_SIZE - 1 && row >= 0)
     {
-        rocsparse_nontemporal_store(row, row_block_red + wid);
-        rocsparse_nontemporal_store(val, val_block_red + wid);
+        if(slot_row == nullptr)
+        {
+            atomicAdd(y + row, val);
+        }
+        else if(row == first_row)
+        {
+            slot_row[2 * wid] = row;
+            slot_val[2 * wid] = val;
+        }
+        else
+        {
+            slot_row[2 * wid + 1] = row;
+            slot_val[2 * wid + 1] = val;
+        }
     }
 }
 
-// Segmented block reduction kernel
-template <typename T, rocsparse_int BLOCKSIZE>
-static __device__ void segmented_blockreduce(const rocsparse_int* rows, T* vals)
+// Ordered combine of the boundary row partials written by the deterministic
+// mode of coomvn_general_wf_reduce. The slots are sorted by row index by
+// construction, one thread per slot detects whether it holds the first
+// partial of its row and, if so, adds up all partials of the row in slot
+// order. Empty slots carry a row index of -1 and are skipped
+template <typename T>
+static __device__ void coomvn_slot_combine_device(rocsparse_int        nslots,
+                                                  const rocsparse_int* slot_row,
+                                                  const T*             slot_val,
+                                                  T*                   y)
 {
-    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-#pragma unroll
-    for(rocsparse_int j = 1; j < BLOCKSIZE; j <<= 1)
+    if(gid >= nslots)
     {
-        T val = static_cast<T>(0);
-        if(tid >= j)
-        {
-            if(rows[tid] == rows[tid - j])
-            {
-                val = vals[tid - j];
-            }
-        }
-        __syncthreads();
-
-        vals[tid] += val;
-        __syncthreads();
+        return;
     }
-}
 
-// Do the final block reduction of the block reduction buffers back into global memory
-template <typename T, rocsparse_int BLOCKSIZE>
-__global__ void coomvn_general_block_reduce(rocsparse_int nnz,
-                                            const rocsparse_int* __restrict__ row_block_red,
-                                            const T* __restrict__ val_block_red,
-                                            T* y)
-{
-    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int row = slot_row[gid];
 
-    // Quick return when thread is out of bounds
-    if(tid >= nnz)
+    if(row < 0)
     {
         return;
     }
 
-    // Shared memory to hold row indices and values for segmented reduction
-    __shared__ rocsparse_int shared_row[BLOCKSIZE];
-    __shared__ T             shared_val[BLOCKSIZE];
-
-    // Loop over blocks that are subject for segmented reduction
-    for(rocsparse_int i = tid; i < nnz; i += BLOCKSIZE)
+    // Only the slot holding the first partial of a row performs the combine
+    for(rocsparse_int s = gid - 1; s >= 0; --s)
     {
-        // Copy data to reduction buffers
-        shared_row[tid] = row_block_red[i];
-        shared_val[tid] = val_block_red[i];
+        rocsparse_int r = slot_row[s];
+
+        if(r < 0)
+        {
+            continue;
+        }
 
-        __syncthreads();
+        if(r == row)
+        {
+            return;
+        }
+
+        break;
+    }
+
+    T sum = slot_val[gid];
 
-        // Do segmented block reduction
-        segmented_blockreduce<T, BLOCKSIZE>(shared_row, shared_val);
+    for(rocsparse_int s = gid + 1; s < nslots; ++s)
+    {
+        rocsparse_int r = slot_row[s];
 
-        // Add reduced sum to y if valid
-        rocsparse_int row = shared_row[tid];
-        if(row != shared_row[tid + 1] && row >= 0)
+        if(r < 0)
         {
-            y[row] += shared_val[tid];
+            continue;
         }
 
-        __syncthreads();
+        if(r != row)
+        {
+            break;
+        }
+
+        sum += slot_val[s];
     }
+
+    y[row] += sum;
 }
 
 #endif // COOMV_DEVICE_H
@@ -28,13 +28,21 @@
 #include "common.h"
 
 #include <hip/hip_runtime.h>
+#include <limits>
 
-template <typename T, rocsparse_int WF_SIZE>
+// The matrix values are stored in type A and converted to the compute type T
+// on load, such that half or single precision storage can be combined with
+// higher precision accumulation. In host pointer mode, the scalar values
+// are known at dispatch time. ALPHA_ONE drops the per element multiply by
+// alpha, BETA_ZERO prunes the beta branch entirely, such that y is never
+// read.
+template <typename A, typename T, rocsparse_int WF_SIZE, bool ALPHA_ONE = false,
+          bool BETA_ZERO = false>
 static __device__ void csrmvn_general_device(rocsparse_int        m,
                                              T                    alpha,
                                              const rocsparse_int* row_offset,
                                              const rocsparse_int* csr_col_ind,
-                                             const T*             csr_val,
+                                             const A*             csr_val,
                                              const T*             x,
                                              T                    beta,
                                              T*                   y,
@@ -57,8 +65,11 @@ static __device__ void csrmvn_general_device(rocsparse_int        m,
         // Loop over non-zero elements
         for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
         {
-            sum = rocsparse_fma(
-                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+            T val = static_cast<T>(csr_val[j]);
+
+            sum = rocsparse_fma(ALPHA_ONE ? val : alpha * val,
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
         }
 
         // Obtain row sum using parallel reduction
@@ -66,6 +77,238 @@ static __device__ void csrmvn_general_device(rocsparse_int        m,
 
         // First thread of each wavefront writes result into global memory
         if(lid == WF_SIZE - 1)
+        {
+            if(BETA_ZERO || beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+// General CSR SpMV with int8 quantized matrix values. The integer values
+// are widened in registers, the row sum is accumulated and reduced in the
+// compute type and dequantized once per row by the per row scale factor.
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_quant_device(rocsparse_int        m,
+                                           T                    alpha,
+                                           const rocsparse_int* row_offset,
+                                           const rocsparse_int* csr_col_ind,
+                                           const int8_t*        csr_val,
+                                           const T*             csr_scale,
+                                           const T*             x,
+                                           T                    beta,
+                                           T*                   y,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(static_cast<T>(csr_val[j]),
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of each wavefront dequantizes the row sum and writes
+        // the result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            sum *= alpha * rocsparse_ldg(csr_scale + row);
+
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+// Row length binned SpMV. Each instantiation processes one bin of rows of
+// similar length through the bin_rows indirection, with WF_SIZE lanes per
+// row; WF_SIZE == 1 degenerates to one thread per row. Every row belongs
+// to exactly one bin, hence each instantiation carries the full beta
+// update for its rows.
+template <typename A, typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_binned_device(rocsparse_int        nrows,
+                                            const rocsparse_int* bin_rows,
+                                            T                    alpha,
+                                            const rocsparse_int* row_offset,
+                                            const rocsparse_int* csr_col_ind,
+                                            const A*             csr_val,
+                                            const T*             x,
+                                            T                    beta,
+                                            T*                   y,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over the rows of the bin
+    for(rocsparse_int i = gid / WF_SIZE; i < nrows; i += nwf)
+    {
+        rocsparse_int row = bin_rows[i];
+
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]),
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+// Column blocked SpMV. Each wavefront processes one row panel
+// intersection: the consecutive non-zeros of one row whose column indices
+// fall into the current column panel, such that all x gathers of a launch
+// stay within an L2 sized slice of x. y has been scaled by beta upfront
+// and the panels run back to back on the same stream, hence the read
+// modify write of y is ordered between the launches
+template <typename A, typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_colblock_device(rocsparse_int        nsect,
+                                              const rocsparse_int* sect_rows,
+                                              const rocsparse_int* sect_begin,
+                                              rocsparse_int        col_end,
+                                              T                    alpha,
+                                              const rocsparse_int* row_offset,
+                                              const rocsparse_int* csr_col_ind,
+                                              const A*             csr_val,
+                                              const T*             x,
+                                              T*                   y,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over the row panel intersections
+    for(rocsparse_int i = gid / WF_SIZE; i < nsect; i += nwf)
+    {
+        rocsparse_int row       = sect_rows[i];
+        rocsparse_int row_start = sect_begin[i];
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over the non-zero elements of the panel. The column indices
+        // are sorted, each lane stops at its first entry beyond the panel
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(col >= col_end)
+            {
+                break;
+            }
+
+            sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]), rocsparse_ldg(x + col), sum);
+        }
+
+        // Obtain the panel row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of each wavefront accumulates the panel row sum
+        if(lid == WF_SIZE - 1)
+        {
+            y[row] = y[row] + sum;
+        }
+    }
+}
+
+// Masked SpMV. Only the rows listed in mask_row_ind are computed, all
+// other entries of y are left untouched and their matrix rows are never
+// read. The mask indirection matches the bin_rows indirection of the
+// binned path, with the mask indices following the index base of the
+// matrix
+template <typename A, typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_masked_device(rocsparse_int        num_masked,
+                                            const rocsparse_int* mask_row_ind,
+                                            T                    alpha,
+                                            const rocsparse_int* row_offset,
+                                            const rocsparse_int* csr_col_ind,
+                                            const A*             csr_val,
+                                            const T*             x,
+                                            T                    beta,
+                                            T*                   y,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over the masked rows
+    for(rocsparse_int i = gid / WF_SIZE; i < num_masked; i += nwf)
+    {
+        rocsparse_int row = mask_row_ind[i] - idx_base;
+
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]),
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
         {
             if(beta == static_cast<T>(0))
             {
@@ -79,6 +322,180 @@ static __device__ void csrmvn_general_device(rocsparse_int        m,
     }
 }
 
+// General CSR SpMV with a fused elementwise epilogue in the output stage.
+// The epilogue flags are resolved at instantiation time through
+// rocsparse_epilogue_apply, such that the fused pass costs no extra pass
+// over y compared to the plain general kernel
+template <typename A, typename T, rocsparse_int WF_SIZE, bool DIAG, bool SUB, bool CLAMP>
+static __device__ void csrmvn_epilogue_device(rocsparse_int        m,
+                                              T                    alpha,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              const A*             csr_val,
+                                              const T*             x,
+                                              T                    beta,
+                                              T*                   y,
+                                              const T*             diag,
+                                              const T*             vec,
+                                              T                    clamp_lo,
+                                              T                    clamp_hi,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]),
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of each wavefront applies the epilogue and writes the
+        // result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta != static_cast<T>(0))
+            {
+                sum = rocsparse_fma(beta, y[row], sum);
+            }
+
+            y[row] = rocsparse_epilogue_apply<T, DIAG, SUB, CLAMP>(
+                row, sum, diag, vec, clamp_lo, clamp_hi);
+        }
+    }
+}
+
+// Semiring operators of the semiring SpMV. combine joins a matrix entry
+// with a vector entry, reduce folds the combined values of a row and
+// identity is the neutral element of reduce. A beta equal to the identity
+// skips the y read entirely, such that y never pollutes the result
+template <typename T>
+struct csrmv_semiring_min_plus
+{
+    static __device__ __forceinline__ T combine(T a, T b)
+    {
+        return a + b;
+    }
+    static __device__ __forceinline__ T reduce(T a, T b)
+    {
+        return (a < b) ? a : b;
+    }
+    static __device__ __host__ __forceinline__ T identity()
+    {
+        return std::numeric_limits<T>::infinity();
+    }
+};
+
+template <typename T>
+struct csrmv_semiring_max_times
+{
+    static __device__ __forceinline__ T combine(T a, T b)
+    {
+        return a * b;
+    }
+    static __device__ __forceinline__ T reduce(T a, T b)
+    {
+        return (a > b) ? a : b;
+    }
+    static __device__ __host__ __forceinline__ T identity()
+    {
+        return -std::numeric_limits<T>::infinity();
+    }
+};
+
+template <typename T>
+struct csrmv_semiring_or_and
+{
+    static __device__ __forceinline__ T combine(T a, T b)
+    {
+        return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+    static __device__ __forceinline__ T reduce(T a, T b)
+    {
+        return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+    static __device__ __host__ __forceinline__ T identity()
+    {
+        return static_cast<T>(0);
+    }
+};
+
+// Semiring SpMV, y = beta (x) y (+) alpha (x) A (x) x with (+) and (x) the
+// reduce and combine operators of the semiring. Structured like the general
+// kernel, with the shuffle based reduction replacing the sum specific DPP
+// primitives
+template <typename T, typename SEMIRING, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_semiring_device(rocsparse_int        m,
+                                              T                    alpha,
+                                              const rocsparse_int* row_offset,
+                                              const rocsparse_int* csr_col_ind,
+                                              const T*             csr_val,
+                                              const T*             x,
+                                              T                    beta,
+                                              T*                   y,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = SEMIRING::identity();
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            T val = SEMIRING::combine(alpha, csr_val[j]);
+
+            sum = SEMIRING::reduce(
+                sum, SEMIRING::combine(val, rocsparse_ldg(x + csr_col_ind[j] - idx_base)));
+        }
+
+        // Obtain row result using shuffle based parallel reduction
+        for(rocsparse_int j = WF_SIZE >> 1; j > 0; j >>= 1)
+        {
+            sum = SEMIRING::reduce(sum, rocsparse_shfl_down(sum, j, WF_SIZE));
+        }
+
+        // First lane of each wavefront writes result into global memory
+        if(lid == 0)
+        {
+            if(beta == SEMIRING::identity())
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = SEMIRING::reduce(SEMIRING::combine(beta, y[row]), sum);
+            }
+        }
+    }
+}
+
 template <typename T>
 static inline __device__ T sum2_reduce(
     T cur_sum, T* partial, rocsparse_int lid, rocsparse_int max_size, rocsparse_int reduc_size)
@@ -92,7 +509,40 @@ static inline __device__ T sum2_reduce(
     return cur_sum;
 }
 
-template <typename T,
+// Computes y = alpha * A * x + beta * y and, if z is not a null pointer,
+// additionally folds gamma * z into the output stage. The fused update saves
+// a full read-modify-write pass over the vectors for callers that chain
+// SpMV with an axpy, such as the polynomial apply.
+//
+// In deterministic mode, selected by passing a non-null wg_partials array,
+// the workgroups collaborating on a long row do not finalize it with atomic
+// additions. Instead, each workgroup stores its partial sum to the slot of
+// its row block and csrmvn_adaptive_fixup_device combines the slots in row
+// block order, such that the floating point additions always execute in the
+// same order and the results are bitwise reproducible run-to-run. The spin
+// loop release of the first workgroup is skipped, beta and gamma are applied
+// by the fix-up pass for these rows
+
+// Column index proxy of the delta compressed adaptive path. The analysis
+// step stores the smallest column index touched by each row block in
+// col_base and the 16-bit offset of every non-zero from the base of its
+// block in col_delta, such that the kernel reads two instead of four or
+// eight bytes per column index. Subscripting reproduces the raw csr_col_ind
+// entries, including the index base
+struct csrmv_delta_cols
+{
+    const rocsparse_int* __restrict__ col_base;
+    const uint16_t* __restrict__ col_delta;
+
+    __device__ rocsparse_int operator[](rocsparse_int j) const
+    {
+        return col_base[hipBlockIdx_x] + static_cast<rocsparse_int>(col_delta[j]);
+    }
+};
+
+template <typename A,
+          typename T,
+          typename J,
           rocsparse_int BLOCKSIZE,
           rocsparse_int BLOCK_MULTIPLIER,
           rocsparse_int ROWS_FOR_VECTOR,
@@ -102,11 +552,14 @@ template <typename T,
 __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
                                        T                    alpha,
                                        const rocsparse_int* csr_row_ptr,
-                                       const rocsparse_int* csr_col_ind,
-                                       const T*             csr_val,
+                                       J                    csr_col_ind,
+                                       const A*             csr_val,
                                        const T*             x,
                                        T                    beta,
                                        T*                   y,
+                                       T                    gamma,
+                                       const T*             z,
+                                       T*                   wg_partials,
                                        rocsparse_index_base idx_base)
 {
     __shared__ T  partialSums[BLOCKSIZE];
@@ -188,10 +641,25 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
         rocsparse_int col = csr_row_ptr[row] + lid - idx_base;
         if(gid != (gridDim.x - 1))
         {
+            // Software pipelined streaming. The matrix entries of the next
+            // chunk are fetched into registers while the gathered products
+            // of the current chunk are computed and stored, such that the
+            // streaming loads overlap with the dependent accesses of x
+            A             pre_val = csr_val[col];
+            rocsparse_int pre_col = csr_col_ind[col];
+
             for(rocsparse_int i = 0; i < BLOCKSIZE; i += WG_SIZE)
             {
-                partialSums[lid + i]
-                    = alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                A             cur_val = pre_val;
+                rocsparse_int cur_col = pre_col;
+
+                if(i + WG_SIZE < BLOCKSIZE)
+                {
+                    pre_val = csr_val[col + i + WG_SIZE];
+                    pre_col = csr_col_ind[col + i + WG_SIZE];
+                }
+
+                partialSums[lid + i] = alpha * static_cast<T>(cur_val) * x[cur_col - idx_base];
             }
         }
         else
@@ -206,7 +674,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
             for(rocsparse_int i = 0; col + i < csr_row_ptr[stop_row] - idx_base; i += WG_SIZE)
             {
                 partialSums[lid + i]
-                    = alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                    = alpha * static_cast<T>(csr_val[col + i]) * x[csr_col_ind[col + i] - idx_base];
             }
         }
         __syncthreads();
@@ -267,6 +735,12 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
                 {
                     temp_sum = rocsparse_fma(beta, y[local_row], temp_sum);
                 }
+
+                if(z != nullptr)
+                {
+                    temp_sum = rocsparse_fma(gamma, z[local_row], temp_sum);
+                }
+
                 y[local_row] = temp_sum;
             }
         }
@@ -297,6 +771,11 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
                     temp_sum = rocsparse_fma(beta, y[local_row], temp_sum);
                 }
 
+                if(z != nullptr)
+                {
+                    temp_sum = rocsparse_fma(gamma, z[local_row], temp_sum);
+                }
+
                 y[local_row] = temp_sum;
                 local_row += WG_SIZE;
             }
@@ -329,25 +808,25 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
             for(rocsparse_int j = vecStart + lid; j < vecEnd; j += WG_SIZE)
             {
                 temp_sum
-                    = rocsparse_fma(alpha * csr_val[j], x[csr_col_ind[j] - idx_base], temp_sum);
+                    = rocsparse_fma(alpha * static_cast<T>(csr_val[j]), x[csr_col_ind[j] - idx_base], temp_sum);
             }
 
-            partialSums[lid] = temp_sum;
-
-            __syncthreads();
-
-            // Reduce partial sums
-            rocsparse_blockreduce_sum<T, WG_SIZE>(lid, partialSums);
+            // Reduce partial sums. The intra-wavefront steps run in
+            // registers, only the per-wavefront partials go through LDS
+            temp_sum = rocsparse_blockreduce_wf_sum<T, WG_SIZE, 32>(lid, temp_sum, partialSums);
 
             if(lid == 0)
             {
-                temp_sum = partialSums[0];
-
                 if(beta != static_cast<T>(0))
                 {
                     temp_sum = rocsparse_fma(beta, y[row], temp_sum);
                 }
 
+                if(z != nullptr)
+                {
+                    temp_sum = rocsparse_fma(gamma, z[row], temp_sum);
+                }
+
                 y[row] = temp_sum;
             }
             ++row;
@@ -371,28 +850,40 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
         rocsparse_int first_wg_in_row = gid - (row_blocks[gid] & ((1ULL << WG_BITS) - 1ULL));
         rocsparse_int compare_value   = row_blocks[gid] & (1ULL << WG_BITS);
 
-        // Bit 24 in the first workgroup is the flag that everyone waits on.
-        if(gid == first_wg_in_row && lid == 0)
+        // In deterministic mode, the workgroups do not scatter into y and no
+        // initialization of the output has to be synchronized on
+        if(wg_partials == nullptr)
         {
-            // The first workgroup handles the output initialization.
-            T out_val = y[row];
-            temp_sum  = (beta - static_cast<T>(1)) * out_val;
-            atomicXor(&row_blocks[first_wg_in_row], (1ULL << WG_BITS)); // Release other workgroups.
-        }
-        // For every other workgroup, bit 24 holds the value they wait on.
-        // If your bit 24 == first_wg's bit 24, you spin loop.
-        // The first workgroup will eventually flip this bit, and you can move forward.
-        __syncthreads();
-        while(gid != first_wg_in_row && lid == 0
-              && ((atomicMax(&row_blocks[first_wg_in_row], 0ULL) & (1ULL << WG_BITS))
-                  == compare_value))
-            ;
-        __syncthreads();
+            // Bit 24 in the first workgroup is the flag that everyone waits on.
+            if(gid == first_wg_in_row && lid == 0)
+            {
+                // The first workgroup handles the output initialization.
+                T out_val = y[row];
+                temp_sum  = (beta - static_cast<T>(1)) * out_val;
 
-        // After you've passed the barrier, update your local flag to make sure that
-        // the next time through, you know what to wait on.
-        if(gid != first_wg_in_row && lid == 0)
-            row_blocks[gid] ^= (1ULL << WG_BITS);
+                if(z != nullptr)
+                {
+                    temp_sum = rocsparse_fma(gamma, z[row], temp_sum);
+                }
+
+                atomicXor(&row_blocks[first_wg_in_row],
+                          (1ULL << WG_BITS)); // Release other workgroups.
+            }
+            // For every other workgroup, bit 24 holds the value they wait on.
+            // If your bit 24 == first_wg's bit 24, you spin loop.
+            // The first workgroup will eventually flip this bit, and you can move forward.
+            __syncthreads();
+            while(gid != first_wg_in_row && lid == 0
+                  && ((atomicMax(&row_blocks[first_wg_in_row], 0ULL) & (1ULL << WG_BITS))
+                      == compare_value))
+                ;
+            __syncthreads();
+
+            // After you've passed the barrier, update your local flag to make sure that
+            // the next time through, you know what to wait on.
+            if(gid != first_wg_in_row && lid == 0)
+                row_blocks[gid] ^= (1ULL << WG_BITS);
+        }
 
         // All but the final workgroup in a long-row collaboration have the same start_row
         // and stop_row. They only run for one iteration.
@@ -401,19 +892,823 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
         // Then dump the partially reduced answers into the LDS for inter-work-item reduction.
         for(rocsparse_int j = vecStart + lid; j < vecEnd; j += WG_SIZE)
         {
-            temp_sum = rocsparse_fma(alpha * csr_val[j], x[csr_col_ind[j] - idx_base], temp_sum);
+            temp_sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]), x[csr_col_ind[j] - idx_base], temp_sum);
+        }
+
+        // Reduce partial sums. The intra-wavefront steps run in registers,
+        // only the per-wavefront partials go through LDS
+        temp_sum = rocsparse_blockreduce_wf_sum<T, WG_SIZE, 32>(lid, temp_sum, partialSums);
+
+        if(lid == 0)
+        {
+            if(wg_partials != nullptr)
+            {
+                // Fixed slot per row block, combined in row block order by
+                // the fix-up pass
+                wg_partials[gid] = temp_sum;
+            }
+            else
+            {
+                atomicAdd(y + row, temp_sum);
+            }
+        }
+    }
+}
+
+// Ordered combine of the long row partials written by the deterministic mode
+// of csrmvn_adaptive_device. One thread per row block detects whether its
+// block is the first workgroup of a long row and, if so, adds up the partials
+// of all row blocks of that row in order and finalizes the output with beta
+// and, for the fused polynomial apply, gamma * z
+template <typename T, rocsparse_int WG_BITS, rocsparse_int ROW_BITS>
+static __device__ void csrmvn_adaptive_fixup_device(rocsparse_int             nblocks,
+                                                    const unsigned long long* row_blocks,
+                                                    const T*                  wg_partials,
+                                                    T                         beta,
+                                                    T*                        y,
+                                                    T                         gamma,
+                                                    const T*                  z)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nblocks)
+    {
+        return;
+    }
+
+    rocsparse_int row = ((row_blocks[gid] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int stop_row
+        = ((row_blocks[gid + 1] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int wg = row_blocks[gid] & ((1ULL << WG_BITS) - 1ULL);
+
+    // Only the first workgroup of a long row, recognizable by carrying the
+    // same start and stop row and workgroup id zero, performs the combine.
+    // The flag bits are untouched in deterministic mode, the decode is stable
+    if(stop_row != row || wg != 0)
+    {
+        return;
+    }
+
+    T temp_sum = wg_partials[gid];
+
+    // All subsequent row blocks of the same row, the last one holds the
+    // partial of the final workgroup
+    for(rocsparse_int u = gid + 1; u < nblocks; ++u)
+    {
+        rocsparse_int row_u
+            = ((row_blocks[u] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+
+        if(row_u != row)
+        {
+            break;
+        }
+
+        temp_sum += wg_partials[u];
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        temp_sum = rocsparse_fma(beta, y[row], temp_sum);
+    }
+
+    if(z != nullptr)
+    {
+        temp_sum = rocsparse_fma(gamma, z[row], temp_sum);
+    }
+
+    y[row] = temp_sum;
+}
+
+// General CSR SpMV for transposed matrices. Each wavefront processes one row
+// of A and scatters its partial products into y using atomic additions, such
+// that no transposed copy of the matrix is required. CONJ selects the
+// conjugate transposed product, conjugating each stored entry on the fly.
+template <typename T, rocsparse_int WF_SIZE, bool CONJ>
+static __device__ void csrmvt_general_device(rocsparse_int        m,
+                                             T                    alpha,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const T*             csr_val,
+                                             const T*             x,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T row_val = alpha * rocsparse_ldg(x + row);
+
+        // Scatter each non-zero entry of the current row
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            T val = CONJ ? rocsparse_conj(csr_val[j]) : csr_val[j];
+
+            atomicAdd(y + csr_col_ind[j] - idx_base, val * row_val);
+        }
+    }
+}
+
+// General CSR SpMV on a row panel whose value and column index slices have
+// been staged into device memory by the out-of-core path. row_offset holds
+// the unmodified offsets of the panel rows, shift rebases them into the
+// staged slices. y points to the first row of the panel.
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_panel_device(rocsparse_int        nrows,
+                                           T                    alpha,
+                                           rocsparse_int        shift,
+                                           const rocsparse_int* row_offset,
+                                           const rocsparse_int* csr_col_ind,
+                                           const T*             csr_val,
+                                           const T*             x,
+                                           T                    beta,
+                                           T*                   y,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over the rows of the panel
+    for(rocsparse_int row = gid / WF_SIZE; row < nrows; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - shift;
+        rocsparse_int row_end   = row_offset[row + 1] - shift;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]),
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+// General CSR SpMV for symmetric matrices with single triangle storage.
+// Each wavefront processes one stored row and contributes every entry to
+// both y[row] and y[col], such that only one triangle of the matrix has to
+// be stored and read. All contributions scatter into y using atomic
+// additions, y has to be scaled by beta in advance.
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvs_general_device(rocsparse_int        m,
+                                             T                    alpha,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             const T*             csr_val,
+                                             const T*             x,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over the stored rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T row_val = alpha * rocsparse_ldg(x + row);
+        T sum     = static_cast<T>(0);
+
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+            T             val = csr_val[j];
+
+            // Contribution of the stored entry to y[row]
+            sum = rocsparse_fma(val, rocsparse_ldg(x + col), sum);
+
+            // Contribution of the mirrored entry to y[col]
+            if(col != row)
+            {
+                atomicAdd(y + col, val * row_val);
+            }
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of each wavefront scatters the row sum
+        if(lid == WF_SIZE - 1)
+        {
+            atomicAdd(y + row, alpha * sum);
         }
+    }
+}
 
-        partialSums[lid] = temp_sum;
+// Scale kernel for beta != 1.0
+template <typename T>
+__device__ void csrmv_scale_device(rocsparse_int size, T beta, T* __restrict__ data)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    data[gid] *= beta;
+}
+
+// Find the row such that csr_row_ptr[row] <= idx < csr_row_ptr[row + 1]
+// using binary search on the row offset array
+static inline __device__ rocsparse_int csrmv_merge_row_search(rocsparse_int        idx,
+                                                              rocsparse_int        m,
+                                                              const rocsparse_int* csr_row_ptr,
+                                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int left  = 0;
+    rocsparse_int right = m;
+
+    while(right - left > 1)
+    {
+        rocsparse_int mid = (left + right) >> 1;
+
+        if(rocsparse_ldg(csr_row_ptr + mid) - idx_base <= idx)
+        {
+            left = mid;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+
+    return left;
+}
+
+// Merge path style CSR SpMV that distributes the non-zero entries equally
+// among all wavefronts, regardless of the row length distribution. The row
+// index of each non-zero entry is recovered by binary search on the row
+// offset array. Partial row results are combined by segmented reduction,
+// analogously to the COO SpMV kernel.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_merge_device(rocsparse_int        m,
+                                           rocsparse_int        nnz,
+                                           rocsparse_int        loops,
+                                           T                    alpha,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           const T*             csr_val,
+                                           const T*             x,
+                                           T*                   y,
+                                           rocsparse_int*       row_block_red,
+                                           T*                   val_block_red,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int tid = hipThreadIdx_x;
+
+    // Lane index (0,...,WF_SIZE)
+    rocsparse_int lid = gid % WF_SIZE;
+    // Wavefront index
+    rocsparse_int wid = gid / WF_SIZE;
+
+    // Initialize block buffers
+    if(lid == 0)
+    {
+        rocsparse_nontemporal_store(-1, row_block_red + wid);
+        rocsparse_nontemporal_store(static_cast<T>(0), val_block_red + wid);
+    }
+
+    // Global non-zero index start for current wavefront
+    rocsparse_int offset = wid * loops * WF_SIZE;
+
+    // Shared memory to hold row indices and values for segmented reduction
+    __shared__ rocsparse_int shared_row[BLOCKSIZE];
+    __shared__ T             shared_val[BLOCKSIZE];
+
+    // Initialize shared memory
+    shared_row[tid] = -1;
+    shared_val[tid] = static_cast<T>(0);
+
+    __syncthreads();
+
+    // Quick return when thread is out of bounds
+    if(offset + lid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row;
+    T             val;
+
+    // Current threads index into CSR structure
+    rocsparse_int idx = offset + lid;
+
+    // Each thread processes 'loop' non-zero entries
+    while(idx < offset + loops * WF_SIZE)
+    {
+        // Get corresponding CSR entry, if not out of bounds.
+        // This can happen when processing more than 1 entry if
+        // nnz % WF_SIZE != 0
+        if(idx < nnz)
+        {
+            row = csrmv_merge_row_search(idx, m, csr_row_ptr, idx_base);
+            val = alpha * rocsparse_nontemporal_load(csr_val + idx)
+                  * rocsparse_ldg(x + rocsparse_nontemporal_load(csr_col_ind + idx) - idx_base);
+        }
+        else
+        {
+            row = -1;
+            val = static_cast<T>(0);
+        }
+
+        // First thread in wavefront checks row index from previous loop
+        // if it has been completed or if additional rows have to be
+        // appended.
+        if(idx > offset && lid == 0)
+        {
+            rocsparse_int prevrow = shared_row[tid + WF_SIZE - 1];
+            if(row == prevrow)
+            {
+                val += shared_val[tid + WF_SIZE - 1];
+            }
+            else if(prevrow >= 0)
+            {
+                y[prevrow] += shared_val[tid + WF_SIZE - 1];
+            }
+        }
 
         __syncthreads();
 
-        // Reduce partial sums
-        rocsparse_blockreduce_sum<T, WG_SIZE>(lid, partialSums);
+        // Update shared buffers
+        shared_row[tid] = row;
+        shared_val[tid] = val;
 
-        if(lid == 0)
+        __syncthreads();
+
+#pragma unroll
+        // Segmented wavefront reduction
+        for(rocsparse_int j = 1; j < WF_SIZE; j <<= 1)
+        {
+            if(lid >= j)
+            {
+                if(row == shared_row[tid - j])
+                {
+                    val += shared_val[tid - j];
+                }
+            }
+            __syncthreads();
+
+            shared_val[tid] = val;
+
+            __syncthreads();
+        }
+
+        // All lanes but the last one write their result in y.
+        // The last value might need to be appended by the next iteration.
+        if(lid < WF_SIZE - 1)
+        {
+            if(row != shared_row[tid + 1] && row >= 0)
+            {
+                y[row] += val;
+            }
+        }
+
+        // Keep going for the next iteration
+        idx += WF_SIZE;
+    }
+
+    // Write last entries into buffers for segmented block reduction
+    if(lid == WF_SIZE - 1)
+    {
+        rocsparse_nontemporal_store(row, row_block_red + wid);
+        rocsparse_nontemporal_store(val, val_block_red + wid);
+    }
+}
+
+// Segmented block reduction kernel
+template <typename T, rocsparse_int BLOCKSIZE>
+static __device__ void csrmvn_merge_segmented_blockreduce(const rocsparse_int* rows, T* vals)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+#pragma unroll
+    for(rocsparse_int j = 1; j < BLOCKSIZE; j <<= 1)
+    {
+        T val = static_cast<T>(0);
+        if(tid >= j)
+        {
+            if(rows[tid] == rows[tid - j])
+            {
+                val = vals[tid - j];
+            }
+        }
+        __syncthreads();
+
+        vals[tid] += val;
+        __syncthreads();
+    }
+}
+
+// Do the final block reduction of the block reduction buffers back into global memory
+template <typename T, rocsparse_int BLOCKSIZE>
+__global__ void csrmvn_merge_block_reduce(rocsparse_int nnz,
+                                          const rocsparse_int* __restrict__ row_block_red,
+                                          const T* __restrict__ val_block_red,
+                                          T* y)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    // Quick return when thread is out of bounds
+    if(tid >= nnz)
+    {
+        return;
+    }
+
+    // Shared memory to hold row indices and values for segmented reduction
+    __shared__ rocsparse_int shared_row[BLOCKSIZE];
+    __shared__ T             shared_val[BLOCKSIZE];
+
+    // Loop over blocks that are subject for segmented reduction
+    for(rocsparse_int i = tid; i < nnz; i += BLOCKSIZE)
+    {
+        // Copy data to reduction buffers
+        shared_row[tid] = row_block_red[i];
+        shared_val[tid] = val_block_red[i];
+
+        __syncthreads();
+
+        // Do segmented block reduction
+        csrmvn_merge_segmented_blockreduce<T, BLOCKSIZE>(shared_row, shared_val);
+
+        // Add reduced sum to y if valid
+        rocsparse_int row = shared_row[tid];
+        if(row != shared_row[tid + 1] && row >= 0)
+        {
+            y[row] += shared_val[tid];
+        }
+
+        __syncthreads();
+    }
+}
+
+// Persistent CSR SpMV for general, non-transposed matrices. The grid stays
+// resident and performs niter iterations of z := alpha * A * z + beta * z,
+// separated by grid-wide barriers, such that the per-iteration kernel launch
+// latency is removed from the hot loop. The iterations ping-pong between y
+// and tmp, starting from x
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_persistent_device(rocsparse_int        m,
+                                                rocsparse_int        niter,
+                                                T                    alpha,
+                                                const rocsparse_int* row_offset,
+                                                const rocsparse_int* csr_col_ind,
+                                                const T*             csr_val,
+                                                const T*             x,
+                                                T                    beta,
+                                                T*                   y,
+                                                T*                   tmp,
+                                                int*                 count,
+                                                int*                 generation,
+                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    for(rocsparse_int iter = 0; iter < niter; ++iter)
+    {
+        // Even iterations write y, odd iterations write tmp
+        const T* xin  = (iter == 0) ? x : ((iter & 1) ? y : tmp);
+        T*       xout = (iter & 1) ? tmp : y;
+
+        // Loop over rows
+        for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+        {
+            rocsparse_int row_start = row_offset[row] - idx_base;
+            rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+            T sum = static_cast<T>(0);
+
+            // Loop over non-zero elements
+            for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+            {
+                sum = rocsparse_fma(
+                    alpha * csr_val[j], rocsparse_ldg(xin + csr_col_ind[j] - idx_base), sum);
+            }
+
+            // Obtain row sum using parallel reduction
+            sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+            // First thread of each wavefront writes result into global memory
+            if(lid == WF_SIZE - 1)
+            {
+                xout[row] = rocsparse_fma(beta, xin[row], sum);
+            }
+        }
+
+        // All rows must be written before the next iteration reads them
+        rocsparse_grid_barrier(count, generation, iter);
+    }
+}
+
+// Fused matrix powers for general, non-transposed matrices. The grid stays
+// resident and computes the Krylov basis vectors A * x, A^2 * x, ..., A^s * x
+// into the columns of y, separated by grid-wide barriers. Each wavefront
+// revisits the same rows for every power, such that its matrix tiles stay
+// cache resident across the powers
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_powers_device(rocsparse_int        m,
+                                            rocsparse_int        s,
+                                            const rocsparse_int* row_offset,
+                                            const rocsparse_int* csr_col_ind,
+                                            const T*             csr_val,
+                                            const T*             x,
+                                            T*                   y,
+                                            rocsparse_int        ldy,
+                                            int*                 count,
+                                            int*                 generation,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    for(rocsparse_int p = 0; p < s; ++p)
+    {
+        // Power p + 1 reads the previous basis vector and writes column p
+        const T* xin  = (p == 0) ? x : y + (p - 1) * ldy;
+        T*       xout = y + p * ldy;
+
+        // Loop over rows
+        for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+        {
+            rocsparse_int row_start = row_offset[row] - idx_base;
+            rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+            T sum = static_cast<T>(0);
+
+            // Loop over non-zero elements
+            for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+            {
+                sum = rocsparse_fma(
+                    csr_val[j], rocsparse_ldg(xin + csr_col_ind[j] - idx_base), sum);
+            }
+
+            // Obtain row sum using parallel reduction
+            sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+            // First thread of each wavefront writes result into global memory
+            if(lid == WF_SIZE - 1)
+            {
+                xout[row] = sum;
+            }
+        }
+
+        // The full basis vector must be written before the next power reads it
+        rocsparse_grid_barrier(count, generation, p);
+    }
+}
+
+// CSR SpMV over multiple dense vectors for general, non-transposed matrices.
+// Each wavefront processes one row and keeps one partial sum per vector in
+// registers, such that csr_val and csr_col_ind are read only once for all
+// right-hand sides
+template <typename T, rocsparse_int NRHS, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_general_multi_device(rocsparse_int        m,
+                                                   T                    alpha,
+                                                   const rocsparse_int* row_offset,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   const T*             csr_val,
+                                                   const T*             x,
+                                                   rocsparse_int        ldx,
+                                                   T                    beta,
+                                                   T*                   y,
+                                                   rocsparse_int        ldy,
+                                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum[NRHS];
+
+        for(rocsparse_int r = 0; r < NRHS; ++r)
+        {
+            sum[r] = static_cast<T>(0);
+        }
+
+        // Loop over non-zero elements, matrix entries are shared by all
+        // right-hand sides
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            T             val = alpha * csr_val[j];
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            for(rocsparse_int r = 0; r < NRHS; ++r)
+            {
+                sum[r] = rocsparse_fma(val, rocsparse_ldg(x + col + r * ldx), sum[r]);
+            }
+        }
+
+        // Obtain row sums using parallel reduction
+        for(rocsparse_int r = 0; r < NRHS; ++r)
+        {
+            sum[r] = rocsparse_wfreduce_sum<WF_SIZE>(sum[r]);
+        }
+
+        // First thread of each wavefront writes results into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            for(rocsparse_int r = 0; r < NRHS; ++r)
+            {
+                if(beta == static_cast<T>(0))
+                {
+                    y[row + r * ldy] = sum[r];
+                }
+                else
+                {
+                    y[row + r * ldy] = rocsparse_fma(beta, y[row + r * ldy], sum[r]);
+                }
+            }
+        }
+    }
+}
+
+// General CSR SpMV with a fused dot product epilogue. Each wavefront
+// folds the freshly computed y element into x^T * y while it is still in
+// registers, the block partial sums are reduced in LDS and written to the
+// workspace, which a single block reduction kernel finalizes.
+template <typename T, rocsparse_int NB, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_dot_device(rocsparse_int        m,
+                                         T                    alpha,
+                                         const rocsparse_int* row_offset,
+                                         const rocsparse_int* csr_col_ind,
+                                         const T*             csr_val,
+                                         const T*             x,
+                                         T                    beta,
+                                         T*                   y,
+                                         T*                   workspace,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    T dot = static_cast<T>(0);
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
         {
-            atomicAdd(y + row, partialSums[0]);
+            sum = rocsparse_fma(alpha * csr_val[j],
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of each wavefront writes the result into global memory
+        // and accumulates its dot product contribution
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta != static_cast<T>(0))
+            {
+                sum = rocsparse_fma(beta, y[row], sum);
+            }
+
+            y[row] = sum;
+
+            dot = rocsparse_fma(rocsparse_ldg(x + row), sum, dot);
+        }
+    }
+
+    // Reduce the per thread contributions of the block
+    __shared__ T sdata[NB];
+    sdata[tid] = dot;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+// Strided batched CSR SpMV over multiple value arrays that share one
+// sparsity pattern and one x. Each wavefront loads the column index and
+// the x element of an entry once and combines them with the values of up
+// to NBATCH batch members, which are accumulated in registers.
+template <typename T, rocsparse_int NBATCH, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_general_batched_device(rocsparse_int        m,
+                                                     T                    alpha,
+                                                     const rocsparse_int* row_offset,
+                                                     const rocsparse_int* csr_col_ind,
+                                                     const T*             csr_val,
+                                                     rocsparse_int        stride,
+                                                     const T*             x,
+                                                     T                    beta,
+                                                     T*                   y,
+                                                     rocsparse_int        stride_y,
+                                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum[NBATCH];
+
+        for(rocsparse_int b = 0; b < NBATCH; ++b)
+        {
+            sum[b] = static_cast<T>(0);
+        }
+
+        // Loop over non-zero elements, the pattern and x are shared by
+        // all batch members
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+            T             xv  = alpha * rocsparse_ldg(x + col);
+
+            for(rocsparse_int b = 0; b < NBATCH; ++b)
+            {
+                sum[b] = rocsparse_fma(csr_val[j + b * stride], xv, sum[b]);
+            }
+        }
+
+        // Obtain row sums using parallel reduction
+        for(rocsparse_int b = 0; b < NBATCH; ++b)
+        {
+            sum[b] = rocsparse_wfreduce_sum<WF_SIZE>(sum[b]);
+        }
+
+        // First thread of each wavefront writes results into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            for(rocsparse_int b = 0; b < NBATCH; ++b)
+            {
+                if(beta == static_cast<T>(0))
+                {
+                    y[row + b * stride_y] = sum[b];
+                }
+                else
+                {
+                    y[row + b * stride_y] = rocsparse_fma(beta, y[row + b * stride_y], sum[b]);
+                }
+            }
         }
     }
 }
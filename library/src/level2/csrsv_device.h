@@ -28,6 +28,7 @@
 #include "common.h"
 
 #include <hip/hip_runtime.h>
+#include <limits>
 
 template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __global__ void csrsv_analysis_lower_kernel(rocsparse_int m,
@@ -277,12 +278,49 @@ __global__ void csrsv_analysis_upper_kernel(rocsparse_int m,
     }
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+// Invert the diagonal entries once at analysis time, such that the solve
+// replaces the dependent division on its critical path by a multiplication.
+// A zero reciprocal marks a structurally missing or numerically zero
+// diagonal entry, the solve translates it into a zero pivot
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrsv_inv_diag_kernel(rocsparse_int m,
+                                      const T* __restrict__ csr_val,
+                                      const rocsparse_int* __restrict__ csr_diag_ind,
+                                      T* __restrict__ inv_diag)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    if(row_diag == -1)
+    {
+        // Structurally missing diagonal entry
+        inv_diag[row] = static_cast<T>(0);
+        return;
+    }
+
+    T diag_val = csr_val[row_diag];
+
+    inv_diag[row] = (diag_val == static_cast<T>(0)) ? static_cast<T>(0)
+                                                    : rocsparse_rcp(diag_val);
+}
+
+// The matrix values are stored in type A and computed in type T, such that
+// e.g. fp32 stored factors can be applied within an fp64 solve. The uniform
+// precision path instantiates A == T
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __device__ void csrsv_device(rocsparse_int m,
                              T             alpha,
                              const rocsparse_int* __restrict__ csr_row_ptr,
                              const rocsparse_int* __restrict__ csr_col_ind,
-                             const T* __restrict__ csr_val,
+                             const A* __restrict__ csr_val,
+                             const A* __restrict__ inv_diag,
                              const T* __restrict__ x,
                              T* __restrict__ y,
                              int* __restrict__ done_array,
@@ -324,17 +362,38 @@ __device__ void csrsv_device(rocsparse_int m,
         local_sum = alpha * rocsparse_nontemporal_load(x + row);
     }
 
+    // If the reciprocal diagonal has been cached by the analysis, load it
+    // up front instead of inverting the diagonal entry on the critical path
+    if(diag_type == rocsparse_diag_type_non_unit && inv_diag != nullptr)
+    {
+        T inv = static_cast<T>(rocsparse_nontemporal_load(inv_diag + row));
+
+        if(inv == static_cast<T>(0))
+        {
+            // Structural or numerical zero pivot found, avoid division
+            // by 0 and store index for later use.
+            if(lid == 0)
+            {
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            inv = static_cast<T>(1);
+        }
+
+        diagonal[wid] = inv;
+    }
+
     for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
     {
         // Current column this lane operates on
         rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
 
         // Local value this lane operates with
-        T local_val = rocsparse_nontemporal_load(csr_val + j);
+        T local_val = static_cast<T>(rocsparse_nontemporal_load(csr_val + j));
 
         // Check for numerical zero
         if(local_val == static_cast<T>(0) && local_col == row
-           && diag_type == rocsparse_diag_type_non_unit)
+           && diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
         {
             // Numerical zero pivot found, avoid division by 0
             // and store index for later use.
@@ -358,7 +417,7 @@ __device__ void csrsv_device(rocsparse_int m,
             {
                 // If diagonal type is non unit, do division by diagonal entry
                 // This is not required for unit diagonal for obvious reasons
-                if(diag_type == rocsparse_diag_type_non_unit)
+                if(diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
                 {
                     diagonal[wid] = rocsparse_rcp(local_val);
                 }
@@ -381,7 +440,7 @@ __device__ void csrsv_device(rocsparse_int m,
             {
                 // If diagonal type is non unit, do division by diagonal entry
                 // This is not required for unit diagonal for obvious reasons
-                if(diag_type == rocsparse_diag_type_non_unit)
+                if(diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
                 {
                     diagonal[wid] = rocsparse_rcp(local_val);
                 }
@@ -416,4 +475,857 @@ __device__ void csrsv_device(rocsparse_int m,
     }
 }
 
+// Solve of a small factor by a single persistent workgroup. y and the done
+// flags of all rows live in LDS, such that the dependency spin loops and
+// the gathers of already resolved entries avoid the global memory latency
+// that dominates small solves. The factor values are read once each and
+// remain streamed from global memory. A row only depends on rows with a
+// smaller map index, hence the wavefront holding the smallest unresolved
+// index can always proceed and the workgroup cannot deadlock
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__device__ void csrsv_lds_device(rocsparse_int m,
+                                 T             alpha,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 const A* __restrict__ csr_val,
+                                 const A* __restrict__ inv_diag,
+                                 const T* __restrict__ x,
+                                 T* __restrict__ y,
+                                 rocsparse_int* __restrict__ map,
+                                 rocsparse_int* __restrict__ zero_pivot,
+                                 rocsparse_index_base idx_base,
+                                 rocsparse_fill_mode  fill_mode,
+                                 rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // y and the done flags of all rows, resident in LDS
+    extern __shared__ char csrsv_lds[];
+
+    T*   local_y    = reinterpret_cast<T*>(csrsv_lds);
+    int* local_done = reinterpret_cast<int*>(local_y + m);
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    // Initialize the done flags
+    for(rocsparse_int i = hipThreadIdx_x; i < m; i += BLOCKSIZE)
+    {
+        local_done[i] = 0;
+    }
+
+    // Wait for initialization to finish
+    __syncthreads();
+
+    // One wavefront per row, in map order
+    for(rocsparse_int idx = wid; idx < m; idx += BLOCKSIZE / WF_SIZE)
+    {
+        // Get the row this warp will operate on
+        rocsparse_int row = map[idx];
+
+        // Current row entry point and exit point
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Local summation variable.
+        T local_sum = static_cast<T>(0);
+
+        if(lid == 0)
+        {
+            // Lane 0 initializes its local sum with alpha and x
+            local_sum = alpha * rocsparse_nontemporal_load(x + row);
+        }
+
+        // If the reciprocal diagonal has been cached by the analysis, load it
+        // up front instead of inverting the diagonal entry on the critical path
+        if(diag_type == rocsparse_diag_type_non_unit && inv_diag != nullptr)
+        {
+            T inv = static_cast<T>(rocsparse_nontemporal_load(inv_diag + row));
+
+            if(inv == static_cast<T>(0))
+            {
+                // Structural or numerical zero pivot found, avoid division
+                // by 0 and store index for later use.
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+
+                inv = static_cast<T>(1);
+            }
+
+            diagonal[wid] = inv;
+        }
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            // Current column this lane operates on
+            rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+            // Local value this lane operates with
+            T local_val = static_cast<T>(rocsparse_nontemporal_load(csr_val + j));
+
+            // Check for numerical zero
+            if(local_val == static_cast<T>(0) && local_col == row
+               && diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
+            {
+                // Numerical zero pivot found, avoid division by 0
+                // and store index for later use.
+                atomicMin(zero_pivot, row + idx_base);
+                local_val = static_cast<T>(1);
+            }
+
+            // Differentiate upper and lower triangular mode
+            if(fill_mode == rocsparse_fill_mode_upper)
+            {
+                // Processing upper triangular
+
+                // Ignore all entries that are below the diagonal
+                if(local_col < row)
+                {
+                    continue;
+                }
+
+                // Diagonal entry
+                if(local_col == row)
+                {
+                    // If diagonal type is non unit, do division by diagonal entry
+                    // This is not required for unit diagonal for obvious reasons
+                    if(diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
+                    {
+                        diagonal[wid] = rocsparse_rcp(local_val);
+                    }
+
+                    continue;
+                }
+            }
+            else if(fill_mode == rocsparse_fill_mode_lower)
+            {
+                // Processing lower triangular
+
+                // Ignore all entries that are above the diagonal
+                if(local_col > row)
+                {
+                    break;
+                }
+
+                // Diagonal entry
+                if(local_col == row)
+                {
+                    // If diagonal type is non unit, do division by diagonal entry
+                    // This is not required for unit diagonal for obvious reasons
+                    if(diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
+                    {
+                        diagonal[wid] = rocsparse_rcp(local_val);
+                    }
+
+                    break;
+                }
+            }
+
+            // Spin loop on the LDS flag until dependency has been resolved
+            while(!rocsparse_atomic_load(&local_done[local_col], __ATOMIC_ACQUIRE))
+                ;
+
+            // Local sum computation for each lane, gathering from LDS
+            local_sum = rocsparse_fma(-local_val, local_y[local_col], local_sum);
+        }
+
+        // Gather all local sums for each lane
+        local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+        // If we have non unit diagonal, take the diagonal into account
+        // For unit diagonal, this would be multiplication with one
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            local_sum *= diagonal[wid];
+        }
+
+        if(lid == WF_SIZE - 1)
+        {
+            // Write the "row is done" flag and store the rows result in LDS
+            local_y[row] = local_sum;
+            rocsparse_atomic_store(&local_done[row], 1, __ATOMIC_RELEASE);
+        }
+    }
+
+    // Wait for all rows to be resolved
+    __syncthreads();
+
+    // Write the solution back to global memory
+    for(rocsparse_int i = hipThreadIdx_x; i < m; i += BLOCKSIZE)
+    {
+        rocsparse_nontemporal_store(local_y[i], &y[i]);
+    }
+}
+
+// Fused application of an ILU0 style factorization, i.e. the lower solve
+// L * z = alpha * x directly followed by the upper solve U * y = z within a
+// single kernel launch. The first m wavefronts perform the lower solve, the
+// remaining m wavefronts the upper solve. Each upper solve row spins on the
+// lower solve completion flag of its own right-hand side entry only, such
+// that upper rows start as soon as their lower dependencies are resolved,
+// without draining the whole lower solve first. The lower factor is applied
+// with a unit diagonal and the upper factor with a non-unit diagonal,
+// matching the combined factor computed by csrilu0
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__device__ void csrsv_lu_device(rocsparse_int m,
+                                T             alpha,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                const T* __restrict__ inv_diag,
+                                const T* __restrict__ x,
+                                T* __restrict__ y,
+                                T* __restrict__ z,
+                                int* __restrict__ done_lower,
+                                int* __restrict__ done_upper,
+                                rocsparse_int* __restrict__ map_lower,
+                                rocsparse_int* __restrict__ map_upper,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index into the row maps, the lower solve covers [0, m), the upper
+    // solve [m, 2m)
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    // Do not run out of bounds
+    if(idx >= 2 * m)
+    {
+        return;
+    }
+
+    if(idx < m)
+    {
+        // Lower solve phase, L * z = alpha * x with unit diagonal
+
+        // Get the row this warp will operate on
+        rocsparse_int row = map_lower[idx];
+
+        // Current row entry point and exit point
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Local summation variable.
+        T local_sum = static_cast<T>(0);
+
+        if(lid == 0)
+        {
+            // Lane 0 initializes its local sum with alpha and x
+            local_sum = alpha * rocsparse_nontemporal_load(x + row);
+        }
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            // Current column this lane operates on
+            rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+            // Ignore the diagonal and the upper part of the combined factor
+            if(local_col >= row)
+            {
+                break;
+            }
+
+            // Local value this lane operates with
+            T local_val = rocsparse_nontemporal_load(csr_val + j);
+
+            // Spin loop until dependency has been resolved
+            while(!rocsparse_atomic_load(&done_lower[local_col], __ATOMIC_ACQUIRE))
+                ;
+
+            // Local sum computation for each lane
+            local_sum = rocsparse_fma(-local_val, z[local_col], local_sum);
+        }
+
+        // Gather all local sums for each lane
+        local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+        if(lid == WF_SIZE - 1)
+        {
+            // Write the "row is done" flag and store the rows result in z
+            rocsparse_nontemporal_store(local_sum, &z[row]);
+            rocsparse_atomic_store(&done_lower[row], 1, __ATOMIC_RELEASE);
+        }
+    }
+    else
+    {
+        // Upper solve phase, U * y = z with non-unit diagonal
+
+        // Get the row this warp will operate on
+        rocsparse_int row = map_upper[idx - m];
+
+        // Current row entry point and exit point
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Local summation variable.
+        T local_sum = static_cast<T>(0);
+
+        if(lid == 0)
+        {
+            // Lane 0 initializes its local sum with the right-hand side
+            // entry produced by the lower solve
+            while(!rocsparse_atomic_load(&done_lower[row], __ATOMIC_ACQUIRE))
+                ;
+
+            local_sum = z[row];
+        }
+
+        // If the reciprocal diagonal of the upper factor has been cached by
+        // the analysis, load it up front instead of inverting the diagonal
+        // entry on the critical path
+        if(inv_diag != nullptr)
+        {
+            T inv = rocsparse_nontemporal_load(inv_diag + row);
+
+            if(inv == static_cast<T>(0))
+            {
+                // Structural or numerical zero pivot found, avoid division
+                // by 0 and store index for later use.
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+
+                inv = static_cast<T>(1);
+            }
+
+            diagonal[wid] = inv;
+        }
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            // Current column this lane operates on
+            rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+            // Ignore the lower part of the combined factor
+            if(local_col < row)
+            {
+                continue;
+            }
+
+            // Local value this lane operates with
+            T local_val = rocsparse_nontemporal_load(csr_val + j);
+
+            // Diagonal entry
+            if(local_col == row)
+            {
+                if(inv_diag == nullptr)
+                {
+                    // Check for numerical zero
+                    if(local_val == static_cast<T>(0))
+                    {
+                        // Numerical zero pivot found, avoid division by 0
+                        // and store index for later use.
+                        atomicMin(zero_pivot, row + idx_base);
+                        local_val = static_cast<T>(1);
+                    }
+
+                    diagonal[wid] = rocsparse_rcp(local_val);
+                }
+
+                continue;
+            }
+
+            // Spin loop until dependency has been resolved
+            while(!rocsparse_atomic_load(&done_upper[local_col], __ATOMIC_ACQUIRE))
+                ;
+
+            // Local sum computation for each lane
+            local_sum = rocsparse_fma(-local_val, y[local_col], local_sum);
+        }
+
+        // Gather all local sums for each lane
+        local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+        // Divide by the diagonal entry
+        local_sum *= diagonal[wid];
+
+        if(lid == WF_SIZE - 1)
+        {
+            // Write the "row is done" flag and store the rows result in y
+            rocsparse_nontemporal_store(local_sum, &y[row]);
+            rocsparse_atomic_store(&done_upper[row], 1, __ATOMIC_RELEASE);
+        }
+    }
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__device__ void csrsv_level_device(rocsparse_int nrows,
+                                   T             alpha,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   const A* __restrict__ csr_val,
+                                   const A* __restrict__ inv_diag,
+                                   const T* __restrict__ x,
+                                   T* __restrict__ y,
+                                   rocsparse_int* __restrict__ map,
+                                   rocsparse_int offset,
+                                   rocsparse_int* __restrict__ zero_pivot,
+                                   rocsparse_index_base idx_base,
+                                   rocsparse_fill_mode  fill_mode,
+                                   rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    // Do not run out of the current levels bounds
+    if(idx >= nrows)
+    {
+        return;
+    }
+
+    // Get the row this warp will operate on
+    rocsparse_int row = map[idx + offset];
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Local summation variable.
+    T local_sum = static_cast<T>(0);
+
+    if(lid == 0)
+    {
+        // Lane 0 initializes its local sum with alpha and x
+        local_sum = alpha * rocsparse_nontemporal_load(x + row);
+    }
+
+    // If the reciprocal diagonal has been cached by the analysis, load it
+    // up front instead of inverting the diagonal entry on the critical path
+    if(diag_type == rocsparse_diag_type_non_unit && inv_diag != nullptr)
+    {
+        T inv = static_cast<T>(rocsparse_nontemporal_load(inv_diag + row));
+
+        if(inv == static_cast<T>(0))
+        {
+            // Structural or numerical zero pivot found, avoid division
+            // by 0 and store index for later use.
+            if(lid == 0)
+            {
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            inv = static_cast<T>(1);
+        }
+
+        diagonal[wid] = inv;
+    }
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Local value this lane operates with
+        T local_val = static_cast<T>(rocsparse_nontemporal_load(csr_val + j));
+
+        // Check for numerical zero
+        if(local_val == static_cast<T>(0) && local_col == row
+           && diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
+        {
+            // Numerical zero pivot found, avoid division by 0
+            // and store index for later use.
+            atomicMin(zero_pivot, row + idx_base);
+            local_val = static_cast<T>(1);
+        }
+
+        // Differentiate upper and lower triangular mode
+        if(fill_mode == rocsparse_fill_mode_upper)
+        {
+            // Processing upper triangular
+
+            // Ignore all entries that are below the diagonal
+            if(local_col < row)
+            {
+                continue;
+            }
+
+            // Diagonal entry
+            if(local_col == row)
+            {
+                // If diagonal type is non unit, do division by diagonal entry
+                // This is not required for unit diagonal for obvious reasons
+                if(diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
+                {
+                    diagonal[wid] = rocsparse_rcp(local_val);
+                }
+
+                continue;
+            }
+        }
+        else if(fill_mode == rocsparse_fill_mode_lower)
+        {
+            // Processing lower triangular
+
+            // Ignore all entries that are above the diagonal
+            if(local_col > row)
+            {
+                break;
+            }
+
+            // Diagonal entry
+            if(local_col == row)
+            {
+                // If diagonal type is non unit, do division by diagonal entry
+                // This is not required for unit diagonal for obvious reasons
+                if(diag_type == rocsparse_diag_type_non_unit && inv_diag == nullptr)
+                {
+                    diagonal[wid] = rocsparse_rcp(local_val);
+                }
+
+                break;
+            }
+        }
+
+        // All dependencies have been resolved by previous level kernel
+        // launches, y can be accessed without spinning
+        local_sum = rocsparse_fma(-local_val, y[local_col], local_sum);
+    }
+
+    // Gather all local sums for each lane
+    local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+    // If we have non unit diagonal, take the diagonal into account
+    // For unit diagonal, this would be multiplication with one
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        local_sum *= diagonal[wid];
+    }
+
+    if(lid == WF_SIZE - 1)
+    {
+        // Store the rows result in y
+        rocsparse_nontemporal_store(local_sum, &y[row]);
+    }
+}
+
+// Initialize the transposed solve with the scaled right-hand side. The
+// column driven substitution updates y in place, starting from alpha * x
+template <typename T, unsigned int BLOCKSIZE>
+__device__ void csrsv_t_init_device(rocsparse_int m, T alpha, const T* x, T* y)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    y[gid] = alpha * rocsparse_nontemporal_load(x + gid);
+}
+
+// One level of the transposed triangular solve, driven by the stored (non
+// transposed) pattern. The rows of the stored factor are the columns of
+// the transposed factor. Each wavefront finalizes one column by dividing
+// its right-hand side entry by the diagonal and scatters the mirrored
+// updates into the right-hand side entries of the remaining columns.
+// Levels are processed from the deepest to the shallowest: every column
+// that updates column j lies in a strictly deeper level of the non
+// transposed dependency graph, hence y[row] holds the fully updated
+// right-hand side when the level containing row is launched.
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__device__ void csrsv_t_level_device(rocsparse_int nrows,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const A* __restrict__ csr_val,
+                                     const A* __restrict__ inv_diag,
+                                     const rocsparse_int* __restrict__ csr_diag_ind,
+                                     T* __restrict__ y,
+                                     const rocsparse_int* __restrict__ map,
+                                     rocsparse_int offset,
+                                     rocsparse_int* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base,
+                                     rocsparse_fill_mode  fill_mode,
+                                     rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of the current levels bounds
+    if(idx >= nrows)
+    {
+        return;
+    }
+
+    // Get the row this warp will operate on
+    rocsparse_int row = map[idx + offset];
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Inverse of the diagonal entry, obtained from the diagonal entry point
+    // that has been computed during the analysis step
+    T diagonal = static_cast<T>(1);
+
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        if(inv_diag != nullptr)
+        {
+            // Reciprocal diagonal cached by the analysis, a zero entry marks
+            // a structural or numerical zero pivot
+            diagonal = static_cast<T>(rocsparse_nontemporal_load(inv_diag + row));
+
+            if(diagonal == static_cast<T>(0))
+            {
+                // Avoid multiplication by 0 and store index for later use
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+
+                diagonal = static_cast<T>(1);
+            }
+        }
+        else
+        {
+            rocsparse_int row_diag = csr_diag_ind[row];
+
+            if(row_diag == -1)
+            {
+                // Structural zero pivot found, store index for later use
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+            }
+            else
+            {
+                T diag_val = static_cast<T>(csr_val[row_diag]);
+
+                if(diag_val == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    if(lid == 0)
+                    {
+                        atomicMin(zero_pivot, row + idx_base);
+                    }
+
+                    diag_val = static_cast<T>(1);
+                }
+
+                diagonal = rocsparse_rcp(diag_val);
+            }
+        }
+    }
+
+    // Finalize the column, all updates from deeper levels have arrived.
+    // Each lane computes the identical value, such that no broadcast is
+    // required for the subsequent scatter
+    T local_sum = y[row] * diagonal;
+
+    if(lid == WF_SIZE - 1)
+    {
+        rocsparse_nontemporal_store(local_sum, &y[row]);
+    }
+
+    // Scatter the mirrored updates into the right-hand side entries of the
+    // remaining columns
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Skip the diagonal and all entries outside of the triangle
+        if(fill_mode == rocsparse_fill_mode_upper)
+        {
+            if(local_col <= row)
+            {
+                continue;
+            }
+        }
+        else if(fill_mode == rocsparse_fill_mode_lower)
+        {
+            if(local_col >= row)
+            {
+                continue;
+            }
+        }
+
+        // The stored entry (row, col) is the entry (col, row) of the
+        // transposed factor
+        atomicAdd(&y[local_col],
+                  -static_cast<T>(rocsparse_nontemporal_load(csr_val + j)) * local_sum);
+    }
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__device__ void csrsv_jacobi_device(rocsparse_int m,
+                                    T             alpha,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const A* __restrict__ csr_val,
+                                    const A* __restrict__ inv_diag,
+                                    const rocsparse_int* __restrict__ csr_diag_ind,
+                                    const T* __restrict__ x,
+                                    const T* __restrict__ y_in,
+                                    T* __restrict__ y_out,
+                                    rocsparse_int* __restrict__ zero_pivot,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_fill_mode  fill_mode,
+                                    rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Row that the wavefront will operate on
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Inverse of the diagonal entry, obtained from the diagonal entry point
+    // that has been computed during the analysis step
+    T diagonal = static_cast<T>(1);
+
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        if(inv_diag != nullptr)
+        {
+            // Reciprocal diagonal cached by the analysis, a zero entry marks
+            // a structural or numerical zero pivot
+            diagonal = static_cast<T>(rocsparse_nontemporal_load(inv_diag + row));
+
+            if(diagonal == static_cast<T>(0))
+            {
+                // Avoid multiplication by 0 and store index for later use
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+
+                diagonal = static_cast<T>(1);
+            }
+        }
+        else
+        {
+            rocsparse_int row_diag = csr_diag_ind[row];
+
+            if(row_diag == -1)
+            {
+                // Structural zero pivot found, store index for later use
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+            }
+            else
+            {
+                T diag_val = static_cast<T>(csr_val[row_diag]);
+
+                if(diag_val == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    if(lid == 0)
+                    {
+                        atomicMin(zero_pivot, row + idx_base);
+                    }
+
+                    diag_val = static_cast<T>(1);
+                }
+
+                diagonal = rocsparse_rcp(diag_val);
+            }
+        }
+    }
+
+    // Local summation variable.
+    T local_sum = static_cast<T>(0);
+
+    if(lid == 0)
+    {
+        // Lane 0 initializes its local sum with alpha and x
+        local_sum = alpha * rocsparse_nontemporal_load(x + row);
+    }
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Differentiate upper and lower triangular mode
+        if(fill_mode == rocsparse_fill_mode_upper)
+        {
+            // Ignore the diagonal and all entries below it
+            if(local_col <= row)
+            {
+                continue;
+            }
+        }
+        else if(fill_mode == rocsparse_fill_mode_lower)
+        {
+            // Ignore the diagonal and all entries above it
+            if(local_col >= row)
+            {
+                break;
+            }
+        }
+
+        // Instead of resolving the dependency, use the approximation of y
+        // from the previous sweep
+        local_sum = rocsparse_fma(-static_cast<T>(rocsparse_nontemporal_load(csr_val + j)),
+                                  rocsparse_ldg(y_in + local_col),
+                                  local_sum);
+    }
+
+    // Gather all local sums for each lane
+    local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+    if(lid == WF_SIZE - 1)
+    {
+        // If we have non unit diagonal, take the diagonal into account
+        // For unit diagonal, this would be multiplication with one
+        local_sum *= diagonal;
+
+        // Store the rows result of this sweep in y
+        rocsparse_nontemporal_store(local_sum, &y_out[row]);
+    }
+}
+
+// Convert the internal zero pivot representation into the user facing one.
+// If no zero pivot has been found, -1 is written to position, otherwise the
+// pivot index itself. This allows querying the pivot status without
+// synchronizing the stream.
+static __global__ void csrsv_zero_pivot_kernel(const rocsparse_int* __restrict__ zero_pivot,
+                                               rocsparse_int* __restrict__ position)
+{
+    rocsparse_int pivot = *zero_pivot;
+
+    *position = (pivot == std::numeric_limits<rocsparse_int>::max()) ? -1 : pivot;
+}
+
+// Reset the zero pivot to "no pivot found". Initializing on the device keeps
+// the solve stage free of host transfers, such that it can be captured into
+// a hipGraph
+static __global__ void csrsv_reset_zero_pivot_kernel(rocsparse_int* __restrict__ zero_pivot)
+{
+    *zero_pivot = std::numeric_limits<rocsparse_int>::max();
+}
+
 #endif // CSRSV_DEVICE_H
@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef DCSRMV_DEVICE_H
+#define DCSRMV_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Scale y by beta over all m rows. The accumulation kernel only visits the
+// non-empty rows of the matrix, while beta applies to every entry of y
+template <typename T>
+static __device__ void dcsrmv_scale_device(rocsparse_int m, T beta, T* y)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        y[gid] = static_cast<T>(0);
+    }
+    else
+    {
+        y[gid] = beta * y[gid];
+    }
+}
+
+// Doubly compressed SpMV, scheduling one wavefront per non-empty row. The
+// compressed row index array scatters the row results into y, such that no
+// wavefront is ever issued for an empty row
+template <typename T, rocsparse_int WF_SIZE>
+static __device__ void dcsrmvn_general_device(rocsparse_int        mc,
+                                              T                    alpha,
+                                              const rocsparse_int* dcsr_row_ind,
+                                              const rocsparse_int* dcsr_row_ptr,
+                                              const rocsparse_int* dcsr_col_ind,
+                                              const T*             dcsr_val,
+                                              const T*             x,
+                                              T*                   y,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over the non-empty rows
+    for(rocsparse_int i = gid / WF_SIZE; i < mc; i += nwf)
+    {
+        // Each wavefront processes one non-empty row
+        rocsparse_int row_start = dcsr_row_ptr[i] - idx_base;
+        rocsparse_int row_end   = dcsr_row_ptr[i + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(
+                dcsr_val[j], rocsparse_ldg(x + dcsr_col_ind[j] - idx_base), sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // First thread of each wavefront accumulates the result into the
+        // uncompressed row of y, which has already been scaled by beta
+        if(lid == WF_SIZE - 1)
+        {
+            rocsparse_int row = dcsr_row_ind[i] - idx_base;
+
+            y[row] = rocsparse_fma(alpha, sum, y[row]);
+        }
+    }
+}
+
+#endif // DCSRMV_DEVICE_H
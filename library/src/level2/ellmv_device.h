@@ -35,6 +35,7 @@ template <typename T>
 static __device__ void ellmvn_device(rocsparse_int        m,
                                      rocsparse_int        n,
                                      rocsparse_int        ell_width,
+                                     rocsparse_int        ell_pitch,
                                      T                    alpha,
                                      const rocsparse_int* ell_col_ind,
                                      const T*             ell_val,
@@ -53,7 +54,7 @@ static __device__ void ellmvn_device(rocsparse_int        m,
     T sum = static_cast<T>(0);
     for(rocsparse_int p = 0; p < ell_width; ++p)
     {
-        rocsparse_int idx = ELL_IND(ai, p, m, ell_width);
+        rocsparse_int idx = ELL_IND(ai, p, ell_pitch, ell_width);
         rocsparse_int col = rocsparse_nontemporal_load(ell_col_ind + idx) - idx_base;
 
         if(col >= 0 && col < n)
@@ -78,4 +79,103 @@ static __device__ void ellmvn_device(rocsparse_int        m,
     }
 }
 
+// ELL-R SpMV for general, non-transposed matrices. The per row lengths
+// bound the column loop, such that each thread stops at the actual row
+// length instead of sweeping ell_width padded entries and checking their
+// column indices
+template <typename T>
+static __device__ void ellmvn_row_device(rocsparse_int        m,
+                                         rocsparse_int        ell_width,
+                                         rocsparse_int        ell_pitch,
+                                         T                    alpha,
+                                         const rocsparse_int* ell_col_ind,
+                                         const T*             ell_val,
+                                         const rocsparse_int* ell_row_nnz,
+                                         const T*             x,
+                                         T                    beta,
+                                         T*                   y,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockDim_x * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_nnz = rocsparse_nontemporal_load(ell_row_nnz + ai);
+
+    T sum = static_cast<T>(0);
+    for(rocsparse_int p = 0; p < row_nnz; ++p)
+    {
+        rocsparse_int idx = ELL_IND(ai, p, ell_pitch, ell_width);
+        rocsparse_int col = rocsparse_nontemporal_load(ell_col_ind + idx) - idx_base;
+
+        sum = rocsparse_fma(rocsparse_nontemporal_load(ell_val + idx), rocsparse_ldg(x + col), sum);
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        T yv = rocsparse_nontemporal_load(y + ai);
+        rocsparse_nontemporal_store(rocsparse_fma(beta, yv, alpha * sum), y + ai);
+    }
+    else
+    {
+        rocsparse_nontemporal_store(alpha * sum, y + ai);
+    }
+}
+
+// ELL SpMV for general, transposed matrices; each thread scatters the
+// entries of one row of A into y, thus y has to be scaled by beta in advance
+template <typename T>
+static __device__ void ellmvt_device(rocsparse_int        m,
+                                     rocsparse_int        n,
+                                     rocsparse_int        ell_width,
+                                     rocsparse_int        ell_pitch,
+                                     T                    alpha,
+                                     const rocsparse_int* ell_col_ind,
+                                     const T*             ell_val,
+                                     const T*             x,
+                                     T*                   y,
+                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockDim_x * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    T row_val = alpha * rocsparse_ldg(x + ai);
+
+    for(rocsparse_int p = 0; p < ell_width; ++p)
+    {
+        rocsparse_int idx = ELL_IND(ai, p, ell_pitch, ell_width);
+        rocsparse_int col = rocsparse_nontemporal_load(ell_col_ind + idx) - idx_base;
+
+        if(col >= 0 && col < n)
+        {
+            atomicAdd(y + col, rocsparse_nontemporal_load(ell_val + idx) * row_val);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+// Scale kernel for beta != 1.0
+template <typename T>
+static __device__ void ellmv_scale_device(rocsparse_int size, T beta, T* __restrict__ data)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    data[gid] *= beta;
+}
+
 #endif // ELLMV_DEVICE_H
@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMVI_DEVICE_H
+#define GEMVI_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Dense matrix times sparse vector for non-transposed, column ordered matrices.
+// Each thread processes one row of A and accumulates only the columns selected
+// by the sparse indices of x, such that consecutive threads read consecutive
+// matrix entries within a column.
+template <typename T>
+static __device__ void gemvin_device(rocsparse_int        m,
+                                     rocsparse_int        n,
+                                     T                    alpha,
+                                     const T*             A,
+                                     rocsparse_int        lda,
+                                     rocsparse_int        nnz,
+                                     const T*             x_val,
+                                     const rocsparse_int* x_ind,
+                                     T                    beta,
+                                     T*                   y,
+                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockDim_x * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    T sum = static_cast<T>(0);
+    for(rocsparse_int j = 0; j < nnz; ++j)
+    {
+        rocsparse_int col = rocsparse_ldg(x_ind + j) - idx_base;
+
+        sum = rocsparse_fma(rocsparse_ldg(A + col * lda + row), rocsparse_ldg(x_val + j), sum);
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+    }
+    else
+    {
+        y[row] = alpha * sum;
+    }
+}
+
+#endif // GEMVI_DEVICE_H
@@ -0,0 +1,263 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSRMV_HPP
+#define ROCSPARSE_BSRMV_HPP
+
+#include "bsrmv_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void bsrmvn_kernel_host_pointer(rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int block_dim,
+                                           T             alpha,
+                                           const rocsparse_int* __restrict__ bsr_row_ptr,
+                                           const rocsparse_int* __restrict__ bsr_col_ind,
+                                           const T* __restrict__ bsr_val,
+                                           const T* __restrict__ x,
+                                           T beta,
+                                           T* __restrict__ y,
+                                           rocsparse_index_base idx_base)
+{
+    bsrmvn_general_device<T>(
+        m, n, block_dim, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
+}
+
+template <typename T>
+__global__ void bsrmvn_kernel_device_pointer(rocsparse_int m,
+                                             rocsparse_int n,
+                                             rocsparse_int block_dim,
+                                             const T*      alpha,
+                                             const rocsparse_int* __restrict__ bsr_row_ptr,
+                                             const rocsparse_int* __restrict__ bsr_col_ind,
+                                             const T* __restrict__ bsr_val,
+                                             const T* __restrict__ x,
+                                             const T* beta,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    bsrmvn_general_device<T>(
+        m, n, block_dim, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_bsr_mat   bsr,
+                                          const T*                  x,
+                                          const T*                  beta,
+                                          T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv"),
+                  trans,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f bsrmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv"),
+                  trans,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(bsr->m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr->n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr->nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr->block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check BSR structure
+    if(bsr->nnzb > 0)
+    {
+        if(bsr->bsr_row_ptr == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(bsr->bsr_col_ind == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(bsr->bsr_val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(bsr->m == 0 || bsr->n == 0 || bsr->nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different bsrmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define BSRMVN_DIM 256
+        dim3 bsrmvn_blocks((bsr->m - 1) / BSRMVN_DIM + 1);
+        dim3 bsrmvn_threads(BSRMVN_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((bsrmvn_kernel_device_pointer<T>),
+                               bsrmvn_blocks,
+                               bsrmvn_threads,
+                               0,
+                               stream,
+                               bsr->m,
+                               bsr->n,
+                               bsr->block_dim,
+                               alpha,
+                               bsr->bsr_row_ptr,
+                               bsr->bsr_col_ind,
+                               reinterpret_cast<const T*>(bsr->bsr_val),
+                               x,
+                               beta,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL((bsrmvn_kernel_host_pointer<T>),
+                               bsrmvn_blocks,
+                               bsrmvn_threads,
+                               0,
+                               stream,
+                               bsr->m,
+                               bsr->n,
+                               bsr->block_dim,
+                               *alpha,
+                               bsr->bsr_row_ptr,
+                               bsr->bsr_col_ind,
+                               reinterpret_cast<const T*>(bsr->bsr_val),
+                               x,
+                               *beta,
+                               y,
+                               descr->base);
+        }
+#undef BSRMVN_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_BSRMV_HPP
@@ -65,3 +65,39 @@ extern "C" rocsparse_status rocsparse_dcoomv(rocsparse_handle          handle,
     return rocsparse_coomv_template<double>(
         handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
 }
+
+extern "C" rocsparse_status rocsparse_ccoomv(rocsparse_handle               handle,
+                                             rocsparse_operation            trans,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  n,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_float_complex* alpha,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* coo_val,
+                                             const rocsparse_int*           coo_row_ind,
+                                             const rocsparse_int*           coo_col_ind,
+                                             const rocsparse_float_complex* x,
+                                             const rocsparse_float_complex* beta,
+                                             rocsparse_float_complex*       y)
+{
+    return rocsparse_coomv_template<rocsparse_float_complex>(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
+extern "C" rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
+                                             rocsparse_operation             trans,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   n,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* coo_val,
+                                             const rocsparse_int*            coo_row_ind,
+                                             const rocsparse_int*            coo_col_ind,
+                                             const rocsparse_double_complex* x,
+                                             const rocsparse_double_complex* beta,
+                                             rocsparse_double_complex*       y)
+{
+    return rocsparse_coomv_template<rocsparse_double_complex>(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
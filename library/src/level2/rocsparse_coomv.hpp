@@ -33,76 +33,48 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T>
-__global__ void coomv_scale_host_pointer(rocsparse_int size, T beta, T* __restrict__ data)
-{
-    coomv_scale_device<T>(size, beta, data);
-}
-
-template <typename T>
-__global__ void
-    coomv_scale_device_pointer(rocsparse_int size, const T* __restrict__ beta, T* __restrict__ data)
-{
-    if(*beta == static_cast<T>(1))
-    {
-        return;
-    }
-
-    coomv_scale_device<T>(size, *beta, data);
-}
-
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __launch_bounds__(128) __global__
-    void coomvn_wf_host_pointer(rocsparse_int nnz,
-                                rocsparse_int loops,
-                                T             alpha,
-                                const rocsparse_int* __restrict__ coo_row_ind,
-                                const rocsparse_int* __restrict__ coo_col_ind,
-                                const T* __restrict__ coo_val,
-                                const T* __restrict__ x,
-                                T* __restrict__ y,
-                                rocsparse_int* __restrict__ row_block_red,
-                                T* __restrict__ val_block_red,
-                                rocsparse_index_base idx_base)
+    void coomvn_wf_kernel(rocsparse_int m,
+                          rocsparse_int nnz,
+                          rocsparse_int loops,
+                          const T*      alpha,
+                          const rocsparse_int* __restrict__ coo_row_ind,
+                          const rocsparse_int* __restrict__ coo_col_ind,
+                          const T* __restrict__ coo_val,
+                          const T* __restrict__ x,
+                          const T* beta,
+                          T* __restrict__ y,
+                          rocsparse_int* __restrict__ slot_row,
+                          T* __restrict__ slot_val,
+                          int* __restrict__ count,
+                          int* __restrict__ generation,
+                          rocsparse_index_base idx_base)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
+    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(m,
+                                                    nnz,
                                                     loops,
-                                                    alpha,
+                                                    *alpha,
                                                     coo_row_ind,
                                                     coo_col_ind,
                                                     coo_val,
                                                     x,
+                                                    *beta,
                                                     y,
-                                                    row_block_red,
-                                                    val_block_red,
+                                                    slot_row,
+                                                    slot_val,
+                                                    count,
+                                                    generation,
                                                     idx_base);
 }
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
-__launch_bounds__(128) __global__
-    void coomvn_wf_device_pointer(rocsparse_int nnz,
-                                  rocsparse_int loops,
-                                  const T*      alpha,
-                                  const rocsparse_int* __restrict__ coo_row_ind,
-                                  const rocsparse_int* __restrict__ coo_col_ind,
-                                  const T* __restrict__ coo_val,
-                                  const T* __restrict__ x,
-                                  T* __restrict__ y,
-                                  rocsparse_int* __restrict__ row_block_red,
-                                  T* __restrict__ val_block_red,
-                                  rocsparse_index_base idx_base)
+template <typename T>
+__global__ void coomvn_slot_combine_kernel(rocsparse_int nslots,
+                                           const rocsparse_int* __restrict__ slot_row,
+                                           const T* __restrict__ slot_val,
+                                           T* __restrict__ y)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
-                                                    loops,
-                                                    *alpha,
-                                                    coo_row_ind,
-                                                    coo_col_ind,
-                                                    coo_val,
-                                                    x,
-                                                    y,
-                                                    row_block_red,
-                                                    val_block_red,
-                                                    idx_base);
+    coomvn_slot_combine_device<T>(nslots, slot_row, slot_val, y);
 }
 
 template <typename T>
@@ -237,6 +209,15 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profile the operation ; the matrix data, x and y are each moved once
+    rocsparse_profile_scope<T> profile(handle,
+                                       "rocsparse_Xcoomv",
+                                       static_cast<double>(sizeof(T)) * (nnz + n + 2.0 * m)
+                                           + static_cast<double>(sizeof(rocsparse_int)) * 2.0
+                                                 * nnz);
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xcoomv");
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -244,6 +225,9 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
     if(trans == rocsparse_operation_none)
     {
 #define COOMVN_DIM 128
+        // The fused scaling phase synchronizes with the reduction phase by a
+        // grid-wide barrier, which requires all blocks of the grid to be
+        // resident on the device
         rocsparse_int maxthreads = handle->properties.maxThreadsPerBlock;
         rocsparse_int nprocs     = handle->properties.multiProcessorCount;
         rocsparse_int maxblocks  = (nprocs * maxthreads - 1) / COOMVN_DIM + 1;
@@ -256,149 +240,118 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
         dim3 coomvn_blocks(nblocks);
         dim3 coomvn_threads(COOMVN_DIM);
 
-        // Buffer
-        char* ptr = reinterpret_cast<char*>(handle->buffer);
-        ptr += 256;
+        if(handle->pointer_mode == rocsparse_pointer_mode_host
+           && *alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        // Barrier counters
+        int* count;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(int) * 2, (void**)&count));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(count, 0, sizeof(int) * 2, stream));
+
+        // Deterministic mode: each wavefront stores the partials of its two
+        // boundary rows to fixed slots instead of atomically updating y, the
+        // slots are combined in order by a fix-up kernel afterwards
+        rocsparse_int  nslots   = 2 * nwfs;
+        rocsparse_int* slot_row = nullptr;
+        T*             slot_val = nullptr;
 
-        // row block reduction buffer
-        rocsparse_int* row_block_red = reinterpret_cast<rocsparse_int*>(ptr);
-        ptr += ((sizeof(rocsparse_int) * nwfs - 1) / 256 + 1) * 256;
+        if(handle->atomics_mode == rocsparse_atomics_not_allowed)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(
+                (sizeof(T) + sizeof(rocsparse_int)) * nslots, (void**)&slot_val));
+
+            slot_row = (rocsparse_int*)(slot_val + nslots);
 
-        // val block reduction buffer
-        T* val_block_red = reinterpret_cast<T*>(ptr);
+            // Empty slots are marked with a row index of -1
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(slot_row, 0xFF, sizeof(rocsparse_int) * nslots, stream));
+        }
 
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        if(handle->wavefront_size == 32)
         {
-            // Scale y with beta
-            hipLaunchKernelGGL((coomv_scale_device_pointer<T>),
-                               dim3((m - 1) / 1024 + 1),
-                               dim3(1024),
+            hipLaunchKernelGGL((coomvn_wf_kernel<T, COOMVN_DIM, 32>),
+                               coomvn_blocks,
+                               coomvn_threads,
                                0,
                                stream,
                                m,
-                               beta,
-                               y);
-
-            if(handle->wavefront_size == 32)
-            {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 32>),
-                                   coomvn_blocks,
-                                   coomvn_threads,
-                                   0,
-                                   stream,
-                                   nnz,
-                                   nloops,
-                                   alpha,
-                                   coo_row_ind,
-                                   coo_col_ind,
-                                   coo_val,
-                                   x,
-                                   y,
-                                   row_block_red,
-                                   val_block_red,
-                                   descr->base);
-            }
-            else if(handle->wavefront_size == 64)
-            {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 64>),
-                                   coomvn_blocks,
-                                   coomvn_threads,
-                                   0,
-                                   stream,
-                                   nnz,
-                                   nloops,
-                                   alpha,
-                                   coo_row_ind,
-                                   coo_col_ind,
-                                   coo_val,
-                                   x,
-                                   y,
-                                   row_block_red,
-                                   val_block_red,
-                                   descr->base);
-            }
-            else
-            {
-                return rocsparse_status_arch_mismatch;
-            }
+                               nnz,
+                               nloops,
+                               d_alpha,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               d_beta,
+                               y,
+                               slot_row,
+                               slot_val,
+                               count,
+                               count + 1,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((coomvn_wf_kernel<T, COOMVN_DIM, 64>),
+                               coomvn_blocks,
+                               coomvn_threads,
+                               0,
+                               stream,
+                               m,
+                               nnz,
+                               nloops,
+                               d_alpha,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               d_beta,
+                               y,
+                               slot_row,
+                               slot_val,
+                               count,
+                               count + 1,
+                               descr->base);
         }
         else
         {
-            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            if(slot_val != nullptr)
             {
-                return rocsparse_status_success;
+                RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(slot_val));
             }
 
-            // If beta == 0.0 we need to set y to 0
-            if(*beta == static_cast<T>(0))
-            {
-                RETURN_IF_HIP_ERROR(hipMemsetAsync(y, 0, sizeof(T) * m, stream));
-            }
-            else if(*beta != static_cast<T>(1))
-            {
-                hipLaunchKernelGGL((coomv_scale_host_pointer<T>),
-                                   dim3((m - 1) / 1024 + 1),
-                                   dim3(1024),
-                                   0,
-                                   stream,
-                                   m,
-                                   *beta,
-                                   y);
-            }
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(count));
+            return rocsparse_status_arch_mismatch;
+        }
 
-            if(handle->wavefront_size == 32)
-            {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 32>),
-                                   coomvn_blocks,
-                                   coomvn_threads,
-                                   0,
-                                   stream,
-                                   nnz,
-                                   nloops,
-                                   *alpha,
-                                   coo_row_ind,
-                                   coo_col_ind,
-                                   coo_val,
-                                   x,
-                                   y,
-                                   row_block_red,
-                                   val_block_red,
-                                   descr->base);
-            }
-            else if(handle->wavefront_size == 64)
-            {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 64>),
-                                   coomvn_blocks,
-                                   coomvn_threads,
-                                   0,
-                                   stream,
-                                   nnz,
-                                   nloops,
-                                   *alpha,
-                                   coo_row_ind,
-                                   coo_col_ind,
-                                   coo_val,
-                                   x,
-                                   y,
-                                   row_block_red,
-                                   val_block_red,
-                                   descr->base);
-            }
-            else
-            {
-                return rocsparse_status_arch_mismatch;
-            }
+        if(slot_val != nullptr)
+        {
+            // Ordered combine of the boundary row partials
+            hipLaunchKernelGGL((coomvn_slot_combine_kernel<T>),
+                               dim3((nslots - 1) / COOMVN_DIM + 1),
+                               dim3(COOMVN_DIM),
+                               0,
+                               stream,
+                               nslots,
+                               slot_row,
+                               slot_val,
+                               y);
+
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(slot_val));
         }
 
-        hipLaunchKernelGGL((coomvn_general_block_reduce<T, COOMVN_DIM>),
-                           dim3(1),
-                           coomvn_threads,
-                           0,
-                           stream,
-                           nwfs,
-                           row_block_red,
-                           val_block_red,
-                           y);
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(count));
 #undef COOMVN_DIM
     }
     else
@@ -144,3 +144,815 @@ extern "C" rocsparse_status rocsparse_dcsrmv(rocsparse_handle          handle,
                                             beta,
                                             y);
 }
+
+extern "C" rocsparse_status rocsparse_scsrmv_masked(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    rocsparse_int             num_masked,
+                                                    const rocsparse_int*      mask_row_ind,
+                                                    const float*              alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const float*              x,
+                                                    const float*              beta,
+                                                    float*                    y)
+{
+    return rocsparse_csrmv_masked_template<float>(handle,
+                                                  trans,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  num_masked,
+                                                  mask_row_ind,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  x,
+                                                  beta,
+                                                  y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_masked(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    rocsparse_int             num_masked,
+                                                    const rocsparse_int*      mask_row_ind,
+                                                    const double*             alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const double*             csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const double*             x,
+                                                    const double*             beta,
+                                                    double*                   y)
+{
+    return rocsparse_csrmv_masked_template<double>(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   num_masked,
+                                                   mask_row_ind,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   x,
+                                                   beta,
+                                                   y);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_epilogue(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const float*              alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float*              csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      const float*              x,
+                                                      const float*              beta,
+                                                      float*                    y,
+                                                      rocsparse_epilogue        epilogue,
+                                                      const float*              diag,
+                                                      const float*              vec,
+                                                      const float*              clamp_lo,
+                                                      const float*              clamp_hi)
+{
+    return rocsparse_csrmv_epilogue_template<float>(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    x,
+                                                    beta,
+                                                    y,
+                                                    epilogue,
+                                                    diag,
+                                                    vec,
+                                                    clamp_lo,
+                                                    clamp_hi);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_epilogue(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const double*             alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double*             csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      const double*             x,
+                                                      const double*             beta,
+                                                      double*                   y,
+                                                      rocsparse_epilogue        epilogue,
+                                                      const double*             diag,
+                                                      const double*             vec,
+                                                      const double*             clamp_lo,
+                                                      const double*             clamp_hi)
+{
+    return rocsparse_csrmv_epilogue_template<double>(handle,
+                                                     trans,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     alpha,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     x,
+                                                     beta,
+                                                     y,
+                                                     epilogue,
+                                                     diag,
+                                                     vec,
+                                                     clamp_lo,
+                                                     clamp_hi);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_multi(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             nnz,
+                                                   rocsparse_int             nrhs,
+                                                   const float*              alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float*              csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const float*              x,
+                                                   rocsparse_int             ldx,
+                                                   const float*              beta,
+                                                   float*                    y,
+                                                   rocsparse_int             ldy)
+{
+    return rocsparse_csrmv_multi_template<float>(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 nrhs,
+                                                 alpha,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 x,
+                                                 ldx,
+                                                 beta,
+                                                 y,
+                                                 ldy);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_multi(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             nnz,
+                                                   rocsparse_int             nrhs,
+                                                   const double*             alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double*             csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const double*             x,
+                                                   rocsparse_int             ldx,
+                                                   const double*             beta,
+                                                   double*                   y,
+                                                   rocsparse_int             ldy)
+{
+    return rocsparse_csrmv_multi_template<double>(handle,
+                                                  trans,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  nrhs,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  x,
+                                                  ldx,
+                                                  beta,
+                                                  y,
+                                                  ldy);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_semiring(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const float*              alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float*              csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      const float*              x,
+                                                      const float*              beta,
+                                                      float*                    y,
+                                                      rocsparse_semiring        semiring)
+{
+    return rocsparse_csrmv_semiring_template<float>(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    x,
+                                                    beta,
+                                                    y,
+                                                    semiring);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_semiring(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const double*             alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double*             csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      const double*             x,
+                                                      const double*             beta,
+                                                      double*                   y,
+                                                      rocsparse_semiring        semiring)
+{
+    return rocsparse_csrmv_semiring_template<double>(handle,
+                                                     trans,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     alpha,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     x,
+                                                     beta,
+                                                     y,
+                                                     semiring);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_persistent(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        rocsparse_int             niter,
+                                                        const float*              alpha,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        const float*              x,
+                                                        const float*              beta,
+                                                        float*                    y)
+{
+    return rocsparse_csrmv_persistent_template<float>(handle,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      nnz,
+                                                      niter,
+                                                      alpha,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      x,
+                                                      beta,
+                                                      y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_persistent(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        rocsparse_int             niter,
+                                                        const double*             alpha,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        const double*             x,
+                                                        const double*             beta,
+                                                        double*                   y)
+{
+    return rocsparse_csrmv_persistent_template<double>(handle,
+                                                       trans,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       niter,
+                                                       alpha,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       x,
+                                                       beta,
+                                                       y);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_powers(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    rocsparse_int             s,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const float*              x,
+                                                    float*                    y,
+                                                    rocsparse_int             ldy)
+{
+    return rocsparse_csrmv_powers_template<float>(
+        handle, trans, m, n, nnz, s, descr, csr_val, csr_row_ptr, csr_col_ind, x, y, ldy);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_powers(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    rocsparse_int             s,
+                                                    const rocsparse_mat_descr descr,
+                                                    const double*             csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const double*             x,
+                                                    double*                   y,
+                                                    rocsparse_int             ldy)
+{
+    return rocsparse_csrmv_powers_template<double>(
+        handle, trans, m, n, nnz, s, descr, csr_val, csr_row_ptr, csr_col_ind, x, y, ldy);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_polynomial(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        rocsparse_int             degree,
+                                                        const float*              coeffs,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        const float*              x,
+                                                        float*                    y)
+{
+    return rocsparse_csrmv_polynomial_template<float>(handle,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      nnz,
+                                                      degree,
+                                                      coeffs,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      x,
+                                                      y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_polynomial(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        rocsparse_int             degree,
+                                                        const double*             coeffs,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        const double*             x,
+                                                        double*                   y)
+{
+    return rocsparse_csrmv_polynomial_template<double>(handle,
+                                                       trans,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       degree,
+                                                       coeffs,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       info,
+                                                       x,
+                                                       y);
+}
+
+extern "C" rocsparse_status rocsparse_hscsrmv_mixed(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const float*              alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const rocsparse_half*     csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const float*              x,
+                                                    const float*              beta,
+                                                    float*                    y)
+{
+    return rocsparse_csrmv_mixed_template<__half, float>(handle,
+                                                         trans,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         alpha,
+                                                         descr,
+                                                         reinterpret_cast<const __half*>(csr_val),
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         info,
+                                                         x,
+                                                         beta,
+                                                         y);
+}
+
+extern "C" rocsparse_status rocsparse_sdcsrmv_mixed(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const double*             alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const double*             x,
+                                                    const double*             beta,
+                                                    double*                   y)
+{
+    return rocsparse_csrmv_mixed_template<float, double>(handle,
+                                                         trans,
+                                                         m,
+                                                         n,
+                                                         nnz,
+                                                         alpha,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         info,
+                                                         x,
+                                                         beta,
+                                                         y);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmv(rocsparse_handle               handle,
+                                             rocsparse_operation            trans,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  n,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_float_complex* alpha,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_mat_info             info,
+                                             const rocsparse_float_complex* x,
+                                             const rocsparse_float_complex* beta,
+                                             rocsparse_float_complex*       y)
+{
+    return rocsparse_csrmv_template<rocsparse_float_complex>(handle,
+                                                             trans,
+                                                             m,
+                                                             n,
+                                                             nnz,
+                                                             alpha,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info,
+                                                             x,
+                                                             beta,
+                                                             y);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmv(rocsparse_handle                handle,
+                                             rocsparse_operation             trans,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   n,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info,
+                                             const rocsparse_double_complex* x,
+                                             const rocsparse_double_complex* beta,
+                                             rocsparse_double_complex*       y)
+{
+    return rocsparse_csrmv_template<rocsparse_double_complex>(handle,
+                                                              trans,
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              alpha,
+                                                              descr,
+                                                              csr_val,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              info,
+                                                              x,
+                                                              beta,
+                                                              y);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_ooc(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const float*              alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const float*              x,
+                                                 const float*              beta,
+                                                 float*                    y)
+{
+    return rocsparse_csrmv_ooc_template<float>(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               nnz,
+                                               alpha,
+                                               descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               x,
+                                               beta,
+                                               y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_ooc(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const double*             alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const double*             x,
+                                                 const double*             beta,
+                                                 double*                   y)
+{
+    return rocsparse_csrmv_ooc_template<double>(handle,
+                                                trans,
+                                                m,
+                                                n,
+                                                nnz,
+                                                alpha,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                x,
+                                                beta,
+                                                y);
+}
+
+extern "C" rocsparse_status rocsparse_qscsrmv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const int8_t*             csr_val,
+                                              const float*              csr_scale,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_csrmv_quant_template<float>(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 alpha,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_scale,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 x,
+                                                 beta,
+                                                 y);
+}
+
+extern "C" rocsparse_status rocsparse_qdcsrmv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const double*             alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const int8_t*             csr_val,
+                                              const double*             csr_scale,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const double*             x,
+                                              const double*             beta,
+                                              double*                   y)
+{
+    return rocsparse_csrmv_quant_template<double>(handle,
+                                                  trans,
+                                                  m,
+                                                  n,
+                                                  nnz,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_scale,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  x,
+                                                  beta,
+                                                  y);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_batched(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     rocsparse_int             batch_count,
+                                                     const float*              alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const float*              csr_val,
+                                                     rocsparse_int             csr_val_stride,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const float*              x,
+                                                     const float*              beta,
+                                                     float*                    y,
+                                                     rocsparse_int             y_stride)
+{
+    return rocsparse_csrmv_batched_template<float>(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   batch_count,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_val_stride,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   x,
+                                                   beta,
+                                                   y,
+                                                   y_stride);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_batched(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     rocsparse_int             batch_count,
+                                                     const double*             alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const double*             csr_val,
+                                                     rocsparse_int             csr_val_stride,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const double*             x,
+                                                     const double*             beta,
+                                                     double*                   y,
+                                                     rocsparse_int             y_stride)
+{
+    return rocsparse_csrmv_batched_template<double>(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    batch_count,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_val_stride,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    x,
+                                                    beta,
+                                                    y,
+                                                    y_stride);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_dot(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const float*              alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const float*              x,
+                                                 const float*              beta,
+                                                 float*                    y,
+                                                 float*                    dot)
+{
+    return rocsparse_csrmv_dot_template<float>(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               nnz,
+                                               alpha,
+                                               descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               x,
+                                               beta,
+                                               y,
+                                               dot);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_dot(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const double*             alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const double*             x,
+                                                 const double*             beta,
+                                                 double*                   y,
+                                                 double*                   dot)
+{
+    return rocsparse_csrmv_dot_template<double>(handle,
+                                                trans,
+                                                m,
+                                                n,
+                                                nnz,
+                                                alpha,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                x,
+                                                beta,
+                                                y,
+                                                dot);
+}
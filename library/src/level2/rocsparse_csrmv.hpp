@@ -31,25 +31,134 @@
 #include "handle.h"
 #include "utility.h"
 
+#include <algorithm>
+#include <limits>
+
+#include <hip/hip_fp16.h>
 #include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+// Row block encoding widths of the adaptive csrmv kernel
+static const rocsparse_int csrmv_row_bits = 32;
+static const rocsparse_int csrmv_wg_bits  = 24;
 
-#define BLOCKSIZE 1024
-#define BLOCK_MULTIPLIER 3
-#define ROWS_FOR_VECTOR 1
-#define WG_BITS 24
-#define ROW_BITS 32
-#define WG_SIZE 256
+// Per-architecture tuning table for the adaptive csrmv kernel constants.
+// The packing of the row blocks structure depends on these, hence the
+// variant is selected once at analysis time, stored with the analysis data
+// and dispatched on by both the analysis and the compute kernels
+template <int VARIANT>
+struct csrmv_adaptive_config;
 
-__attribute__((unused)) static unsigned int flp2(unsigned int x)
+// Baseline packing, tuned on Vega10
+template <>
+struct csrmv_adaptive_config<0>
 {
-    x |= (x >> 1);
-    x |= (x >> 2);
-    x |= (x >> 4);
-    x |= (x >> 8);
-    x |= (x >> 16);
-    return x - (x >> 1);
+    static const rocsparse_int block_size       = 1024;
+    static const rocsparse_int block_multiplier = 3;
+    static const rocsparse_int rows_for_vector  = 1;
+    static const rocsparse_int wg_size          = 256;
+};
+
+// Wider row blocks and workgroups for the compute parts with large LDS and
+// high CU counts (gfx906 and newer)
+template <>
+struct csrmv_adaptive_config<1>
+{
+    static const rocsparse_int block_size       = 2048;
+    static const rocsparse_int block_multiplier = 4;
+    static const rocsparse_int rows_for_vector  = 1;
+    static const rocsparse_int wg_size          = 512;
+};
+
+// Narrower row blocks for the parts with few CUs (pre Vega), yielding
+// enough blocks to cover the device at small sizes
+template <>
+struct csrmv_adaptive_config<2>
+{
+    static const rocsparse_int block_size       = 512;
+    static const rocsparse_int block_multiplier = 2;
+    static const rocsparse_int rows_for_vector  = 2;
+    static const rocsparse_int wg_size          = 256;
+};
+
+// Wavefront-32 parts (RDNA class). The row blocks cover less non-zeros,
+// as the shorter wavefronts reduce the amount of work a workgroup retires
+// per pass, and long rows split across more workgroups
+template <>
+struct csrmv_adaptive_config<3>
+{
+    static const rocsparse_int block_size       = 1024;
+    static const rocsparse_int block_multiplier = 3;
+    static const rocsparse_int rows_for_vector  = 2;
+    static const rocsparse_int wg_size          = 256;
+};
+
+// Select the tuning variant for the given device architecture
+static inline int csrmv_adaptive_select_tuning(const hipDeviceProp_t& prop)
+{
+    if(prop.warpSize == 32)
+    {
+        return 3;
+    }
+    else if(prop.gcnArch >= 906)
+    {
+        return 1;
+    }
+    else if(prop.gcnArch < 900)
+    {
+        return 2;
+    }
+    return 0;
+}
+
+// Runtime access to per-variant constants for the launch configuration
+static inline rocsparse_int csrmv_adaptive_block_size(int tuning)
+{
+    switch(tuning)
+    {
+    case 1:
+        return csrmv_adaptive_config<1>::block_size;
+    case 2:
+        return csrmv_adaptive_config<2>::block_size;
+    case 3:
+        return csrmv_adaptive_config<3>::block_size;
+    }
+    return csrmv_adaptive_config<0>::block_size;
+}
+
+static inline rocsparse_int csrmv_adaptive_wg_size(int tuning)
+{
+    switch(tuning)
+    {
+    case 1:
+        return csrmv_adaptive_config<1>::wg_size;
+    case 2:
+        return csrmv_adaptive_config<2>::wg_size;
+    case 3:
+        return csrmv_adaptive_config<3>::wg_size;
+    }
+    return csrmv_adaptive_config<0>::wg_size;
 }
 
+// Row length bounds of the binned general path. Rows with at most
+// csrmv_bin_thread_nnz entries run with a single thread per row, rows
+// with at most csrmv_bin_subwf_nnz entries with a quarter wavefront, all
+// longer rows with a full wavefront
+static const rocsparse_int csrmv_bin_thread_nnz = 4;
+static const rocsparse_int csrmv_bin_subwf_nnz  = 32;
+
+// Column panel width of the column blocked path, in x entries. Sized such
+// that the x slice of one panel fits the L2 cache of current devices in
+// double precision. The path is only selected when x exceeds the panel
+// width by a wide margin, such that cache resident vectors keep running
+// the adaptive kernel in a single pass
+static const rocsparse_int csrmv_col_panel_width = 1 << 20;
+
+// Number of timed calls per candidate of the online kernel selection
+// probing. Enough calls to smooth out launch jitter, few enough that the
+// probe cost vanishes against the subsequent calls it is amortized over
+static const int csrmv_probe_calls = 4;
+
 // Short rows in CSR-Adaptive are batched together into a single row block.
 // If there are a relatively small number of these, then we choose to do
 // a horizontal reduction (groups of threads all reduce the same row).
@@ -61,237 +170,543 @@ __attribute__((unused)) static unsigned int flp2(unsigned int x)
 // workgroup size of 256 and 4 rows, you could have 64 threads
 // working on each row. If you have 5 rows, only 32 threads could
 // reliably work on each row because our reduction assumes power-of-2.
-static unsigned long long numThreadsForReduction(unsigned long long num_rows)
-{
-#if defined(__INTEL_COMPILER)
-    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-    unsigned long long bit_returned;
-    _BitScanReverse(&bit_returned, (num_rows - 1));
-    return WG_SIZE >> (bit_returned + 1);
-#else
-    return flp2(WG_SIZE / num_rows);
-#endif
+template <rocsparse_int WGSIZE>
+static __device__ unsigned long long csrmv_num_threads_for_reduction(rocsparse_int num_rows)
+{
+    unsigned int x = WGSIZE / num_rows;
+
+    x |= (x >> 1);
+    x |= (x >> 2);
+    x |= (x >> 4);
+    x |= (x >> 8);
+    x |= (x >> 16);
+
+    return x - (x >> 1);
 }
 
-static void ComputeRowBlocks(unsigned long long*  rowBlocks,
-                             size_t&              rowBlockSize,
-                             const rocsparse_int* rowDelimiters,
-                             rocsparse_int        nRows,
-                             bool                 allocate_row_blocks = true)
+// First pass of the device side row block construction. Each thread
+// classifies one row and computes the number of row block entries this row
+// contributes, such that a subsequent exclusive scan yields each rows write
+// offset into the row blocks array.
+//
+// A row longer than BLOCKSIZE / 2 non-zeros is processed by the CSR-Vector /
+// CSR-LongRows case and contributes one entry per assigned workgroup. Runs
+// of shorter rows are cut whenever a row crosses a BLOCKSIZE / 2 boundary of
+// the non-zero offset space, which guarantees that no CSR-Stream block
+// exceeds BLOCKSIZE non-zeros while keeping the block boundaries independent
+// per row.
+//
+// Additionally, the maximum number of non-zeros per row is gathered, such
+// that the host can select between the adaptive and the merge path kernel.
+template <rocsparse_int NB,
+          rocsparse_int BLOCKDIM,
+          rocsparse_int BLOCKMULT,
+          rocsparse_int WGBITS>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_count_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     rocsparse_int* __restrict__ entry_count,
+                                     rocsparse_int* __restrict__ max_nnz,
+                                     rocsparse_index_base idx_base)
 {
-    unsigned long long* rowBlocksBase;
-
-    // Start at one because of rowBlock[0]
-    rocsparse_int total_row_blocks = 1;
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * NB + tid;
 
-    if(allocate_row_blocks)
-    {
-        rowBlocksBase = rowBlocks;
-        *rowBlocks    = 0;
-        ++rowBlocks;
-    }
+    __shared__ rocsparse_int sdata[NB];
+    sdata[tid] = 0;
 
-    unsigned long long sum = 0;
-    unsigned long long i;
-    unsigned long long last_i = 0;
+    rocsparse_int entries = 0;
 
-    // Check to ensure nRows can fit in 32 bits
-    if(static_cast<unsigned long long>(nRows)
-       > static_cast<unsigned long long>(std::pow(2, ROW_BITS)))
+    if(gid == m)
     {
-        fprintf(stderr, "nrow does not fit in 32 bits\n");
-        exit(1);
+        // Terminating row block entry
+        entries = 1;
     }
-
-    rocsparse_int consecutive_long_rows = 0;
-    for(i = 1; i <= static_cast<unsigned long long>(nRows); ++i)
+    else if(gid < m)
     {
-        rocsparse_int row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-        sum += row_length;
+        rocsparse_int row_begin = csr_row_ptr[gid] - idx_base;
+        rocsparse_int row_nnz   = csr_row_ptr[gid + 1] - idx_base - row_begin;
+
+        sdata[tid] = row_nnz;
 
-        // The following section of code calculates whether you're moving between
-        // a series of "short" rows and a series of "long" rows.
-        // This is because the reduction in CSR-Adaptive likes things to be
-        // roughly the same length. Long rows can be reduced horizontally.
-        // Short rows can be reduced one-thread-per-row. Try not to mix them.
-        if(row_length > 128)
+        // A row block boundary is placed in front of each long row, behind
+        // each long row and whenever the preceding row crosses a
+        // BLOCKSIZE / 2 boundary of the non-zero offset space
+        bool is_long  = row_nnz > BLOCKDIM / 2;
+        bool is_start = (gid == 0) || is_long;
+
+        if(!is_start)
         {
-            ++consecutive_long_rows;
+            rocsparse_int prev_begin = csr_row_ptr[gid - 1] - idx_base;
+
+            is_start = (row_begin - prev_begin > BLOCKDIM / 2)
+                       || (prev_begin / (BLOCKDIM / 2) != row_begin / (BLOCKDIM / 2));
         }
-        else if(consecutive_long_rows > 0)
+
+        if(is_start)
         {
-            // If it turns out we WERE in a long-row region, cut if off now.
-            if(row_length < 32) // Now we're in a short-row region
+            if(is_long)
             {
-                consecutive_long_rows = -1;
+                // CSR-Vector / CSR-LongRows case; one entry per workgroup
+                // assigned to this row, limited by the number of workgroups
+                // that fit into WGBITS bits
+                rocsparse_int num_wg = (row_nnz - 1) / (BLOCKMULT * BLOCKDIM) + 1;
+
+                entries = (num_wg < (1 << WGBITS)) ? num_wg : (1 << WGBITS);
             }
             else
             {
-                consecutive_long_rows++;
+                // CSR-Stream case; single entry
+                entries = 1;
             }
         }
+    }
 
-        // If you just entered into a "long" row from a series of short rows,
-        // then we need to make sure we cut off those short rows. Put them in
-        // their own workgroup.
-        if(consecutive_long_rows == 1)
-        {
-            // Assuming there *was* a previous workgroup. If not, nothing to do here.
-            if(i - last_i > 1)
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
+    if(gid <= m)
+    {
+        entry_count[gid] = entries;
+    }
 
-                    // If this row fits into CSR-Stream, calculate how many rows
-                    // can be used to do a parallel reduction.
-                    // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                    {
-                        *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
+    __syncthreads();
 
-                    ++rowBlocks;
-                }
+    // Obtain maximum non-zeros per row
+    rocsparse_blockreduce_max<rocsparse_int, NB>(tid, sdata);
 
-                ++total_row_blocks;
-                last_i = i - 1;
-                sum    = row_length;
-            }
-        }
-        else if(consecutive_long_rows == -1)
-        {
-            // We see the first short row after some long ones that
-            // didn't previously fill up a row block.
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                }
+    if(tid == 0)
+    {
+        atomicMax(max_nnz, sdata[0]);
+    }
+}
 
-                ++rowBlocks;
-            }
+// Second pass of the device side row block construction. Each thread
+// scatters the row block entries of its row to the offset obtained by the
+// exclusive scan over the entry counters.
+template <rocsparse_int NB, rocsparse_int ROWBITS>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_fill_kernel(rocsparse_int m,
+                                    const rocsparse_int* __restrict__ entry_count,
+                                    const rocsparse_int* __restrict__ entry_offset,
+                                    unsigned long long* __restrict__ row_blocks)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
 
-            ++total_row_blocks;
-            last_i                = i - 1;
-            sum                   = row_length;
-            consecutive_long_rows = 0;
-        }
+    if(gid > m)
+    {
+        return;
+    }
 
-        // Now, what's up with this row? What did it do?
+    rocsparse_int entries = entry_count[gid];
 
-        // exactly one row results in non-zero elements to be greater than blockSize
-        // This is csr-vector case; bottom WGBITS == workgroup ID
-        if((i - last_i == 1) && sum > static_cast<unsigned long long>(BLOCKSIZE))
-        {
-            rocsparse_int numWGReq = static_cast<rocsparse_int>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCKSIZE)));
+    if(entries == 0)
+    {
+        return;
+    }
 
-            // Check to ensure #workgroups can fit in WGBITS bits, if not
-            // then the last workgroup will do all the remaining work
-            numWGReq = (numWGReq < static_cast<rocsparse_int>(std::pow(2, WG_BITS)))
-                           ? numWGReq
-                           : static_cast<rocsparse_int>(std::pow(2, WG_BITS));
+    unsigned long long* dst = row_blocks + entry_offset[gid];
 
-            if(allocate_row_blocks)
-            {
-                for(rocsparse_int w = 1; w < numWGReq; ++w)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                    *rowBlocks |= static_cast<unsigned long long>(w);
-                    ++rowBlocks;
-                }
+    // Emit one entry per workgroup; the workgroup ID within a long row is
+    // stored in the lower WGBITS bits. CSR-Stream blocks emit a single
+    // entry with cleared lower bits.
+    for(rocsparse_int w = 0; w < entries; ++w)
+    {
+        dst[w] = (static_cast<unsigned long long>(gid) << (64 - ROWBITS))
+                 | static_cast<unsigned long long>(w);
+    }
+}
 
-                *rowBlocks = (i << (64 - ROW_BITS));
-                ++rowBlocks;
-            }
+// Third pass of the device side row block construction. For CSR-Stream
+// blocks that span multiple rows, the number of threads that team up on the
+// parallel reduction of each row is pre-computed and stored in the lower
+// bits of the row block entry.
+template <rocsparse_int NB,
+          rocsparse_int ROWBITS,
+          rocsparse_int WGBITS,
+          rocsparse_int WGSIZE,
+          rocsparse_int ROWSFORVECTOR>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_reduction_kernel(rocsparse_int nblocks,
+                                         unsigned long long* __restrict__ row_blocks)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
 
-            total_row_blocks += numWGReq;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // more than one row results in non-zero elements to be greater than blockSize
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<unsigned long long>(BLOCKSIZE))
-        {
-            // This row won't fit, so back off one.
-            --i;
+    if(gid >= nblocks)
+    {
+        return;
+    }
 
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
+    // Skip the non-leading entries of long rows
+    if((row_blocks[gid] & ((1ULL << WGBITS) - 1ULL)) != 0ULL)
+    {
+        return;
+    }
 
-                ++rowBlocks;
-            }
+    rocsparse_int row      = (row_blocks[gid] >> (64 - ROWBITS)) & ((1ULL << ROWBITS) - 1ULL);
+    rocsparse_int stop_row = (row_blocks[gid + 1] >> (64 - ROWBITS)) & ((1ULL << ROWBITS) - 1ULL);
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
+    if(stop_row - row > ROWSFORVECTOR)
+    {
+        row_blocks[gid] |= csrmv_num_threads_for_reduction<WGSIZE>(stop_row - row);
+    }
+}
+
+// Narrow the column indices to 32 bits. Used by ILP64 builds when the
+// column count fits, such that the adaptive kernel does not pay doubled
+// csr_col_ind bandwidth for matrices that only overflow in nnz
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_narrow_kernel(rocsparse_int nnz,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      int32_t* __restrict__ csr_col_ind_narrow)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csr_col_ind_narrow[gid] = static_cast<int32_t>(csr_col_ind[gid]);
+}
+
+// Find the smallest column index touched by each row block as the base of
+// the delta compressed column indices. One workgroup per row block, the
+// non-final workgroups of a long row decode an empty row range and take the
+// whole row instead, such that every workgroup of the row agrees on the
+// base. If any block spans a column range that does not fit 16 bits, the
+// exceeded flag is raised and the compression is abandoned
+template <rocsparse_int NB, rocsparse_int ROWBITS>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_delta_base_kernel(const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const unsigned long long* __restrict__ row_blocks,
+                                          rocsparse_int* __restrict__ col_base,
+                                          int* __restrict__ exceeded,
+                                          rocsparse_index_base idx_base)
+{
+    __shared__ rocsparse_int smin[NB];
+    __shared__ rocsparse_int smax[NB];
+
+    rocsparse_int gid = hipBlockIdx_x;
+    rocsparse_int lid = hipThreadIdx_x;
+
+    rocsparse_int row      = (row_blocks[gid] >> (64 - ROWBITS)) & ((1ULL << ROWBITS) - 1ULL);
+    rocsparse_int stop_row = (row_blocks[gid + 1] >> (64 - ROWBITS)) & ((1ULL << ROWBITS) - 1ULL);
+
+    if(stop_row == row)
+    {
+        stop_row = row + 1;
+    }
+
+    rocsparse_int min_col = std::numeric_limits<rocsparse_int>::max();
+    rocsparse_int max_col = 0;
+
+    for(rocsparse_int j = csr_row_ptr[row] - idx_base + lid; j < csr_row_ptr[stop_row] - idx_base;
+        j += NB)
+    {
+        min_col = min(min_col, csr_col_ind[j]);
+        max_col = max(max_col, csr_col_ind[j]);
+    }
+
+    smin[lid] = min_col;
+    smax[lid] = max_col;
+    __syncthreads();
+
+    rocsparse_blockreduce_min<rocsparse_int, NB>(lid, smin);
+    rocsparse_blockreduce_max<rocsparse_int, NB>(lid, smax);
+
+    if(lid == 0)
+    {
+        col_base[gid] = smin[0];
+
+        if(smax[0] - smin[0] >= 65536)
+        {
+            atomicOr(exceeded, 1);
         }
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if(sum == static_cast<unsigned long long>(BLOCKSIZE))
+    }
+}
+
+// Store the 16-bit offset of every non-zero from the base of its row block.
+// The workgroups of a long row cover the same row range and write identical
+// deltas, the overlap is benign
+template <rocsparse_int NB, rocsparse_int ROWBITS>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_delta_fill_kernel(const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const unsigned long long* __restrict__ row_blocks,
+                                          const rocsparse_int* __restrict__ col_base,
+                                          uint16_t* __restrict__ col_delta,
+                                          rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x;
+    rocsparse_int lid = hipThreadIdx_x;
+
+    rocsparse_int row      = (row_blocks[gid] >> (64 - ROWBITS)) & ((1ULL << ROWBITS) - 1ULL);
+    rocsparse_int stop_row = (row_blocks[gid + 1] >> (64 - ROWBITS)) & ((1ULL << ROWBITS) - 1ULL);
+
+    if(stop_row == row)
+    {
+        stop_row = row + 1;
+    }
+
+    rocsparse_int base = col_base[gid];
+
+    for(rocsparse_int j = csr_row_ptr[row] - idx_base + lid; j < csr_row_ptr[stop_row] - idx_base;
+        j += NB)
+    {
+        col_delta[j] = static_cast<uint16_t>(csr_col_ind[j] - base);
+    }
+}
+
+// Classify a row into one of the three length bins of the binned general
+// path
+static __device__ int csrmv_bin_of_row(rocsparse_int row_nnz)
+{
+    if(row_nnz <= csrmv_bin_thread_nnz)
+    {
+        return 0;
+    }
+    else if(row_nnz <= csrmv_bin_subwf_nnz)
+    {
+        return 1;
+    }
+    return 2;
+}
+
+// Count the rows per length bin for the binned general path
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_bin_count_kernel(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         rocsparse_int* __restrict__ bin_count)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    atomicAdd(&bin_count[csrmv_bin_of_row(csr_row_ptr[gid + 1] - csr_row_ptr[gid])], 1);
+}
+
+// Scatter the row indices into their length bins. Each row is appended
+// through an atomically incremented per bin cursor, the order of the rows
+// within a bin does not matter
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_bin_scatter_kernel(rocsparse_int m,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           rocsparse_int* __restrict__ bin_cursor,
+                                           rocsparse_int* __restrict__ bin_rows)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    int bin = csrmv_bin_of_row(csr_row_ptr[gid + 1] - csr_row_ptr[gid]);
+
+    bin_rows[atomicAdd(&bin_cursor[bin], 1)] = gid;
+}
+
+// Count the row intersections per column panel for the column blocked
+// path. Each thread scans the sorted column indices of one row and counts
+// one intersection per panel the row has entries in. Unsorted column
+// indices raise the flag, the column blocked path is skipped in that case
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_col_panel_count_kernel(rocsparse_int m,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               rocsparse_int* __restrict__ panel_count,
+                                               int* __restrict__ unsorted,
+                                               rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[gid] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[gid + 1] - idx_base;
+
+    rocsparse_int prev_col   = -1;
+    rocsparse_int prev_panel = -1;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col < prev_col)
         {
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
+            *unsorted = 1;
 
-                ++rowBlocks;
-            }
+            return;
+        }
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
+        rocsparse_int panel = col / csrmv_col_panel_width;
+
+        if(panel != prev_panel)
+        {
+            atomicAdd(&panel_count[panel], 1);
         }
+
+        prev_col   = col;
+        prev_panel = panel;
+    }
+}
+
+// Scatter the row panel intersections into their column panels. Each
+// intersection is appended through an atomically incremented per panel
+// cursor, the order of the intersections within a panel does not matter
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_col_panel_scatter_kernel(rocsparse_int m,
+                                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                                 rocsparse_int* __restrict__ panel_cursor,
+                                                 rocsparse_int* __restrict__ col_panel_rows,
+                                                 rocsparse_int* __restrict__ col_panel_begin,
+                                                 rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * NB + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
     }
 
-    // If we didn't fill a row block with the last row, make sure we don't lose it.
-    if(allocate_row_blocks
-       && (*(rowBlocks - 1) >> (64 - ROW_BITS)) != static_cast<unsigned long long>(nRows))
+    rocsparse_int row_begin = csr_row_ptr[gid] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[gid + 1] - idx_base;
+
+    rocsparse_int prev_panel = -1;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
     {
-        *rowBlocks = (static_cast<unsigned long long>(nRows) << (64 - ROW_BITS));
-        if((nRows - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
+        rocsparse_int panel = (csr_col_ind[j] - idx_base) / csrmv_col_panel_width;
+
+        if(panel != prev_panel)
         {
-            *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
+            rocsparse_int pos = atomicAdd(&panel_cursor[panel], 1);
+
+            col_panel_rows[pos]  = gid;
+            col_panel_begin[pos] = j;
         }
 
-        ++rowBlocks;
+        prev_panel = panel;
+    }
+}
+
+// 64 bit fingerprint of an index array. Each entry is mixed with its
+// position, the partial hashes are combined with xor, which is insensitive
+// to the reduction order, such that no ordering has to be enforced between
+// the thread blocks
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csrmv_analysis_hash_kernel(rocsparse_int size,
+                                    const rocsparse_int* __restrict__ data,
+                                    unsigned long long seed,
+                                    unsigned long long* __restrict__ hash)
+{
+    __shared__ unsigned long long sdata[NB];
+
+    rocsparse_int tid = hipThreadIdx_x;
+
+    unsigned long long h = 0ULL;
+
+    for(rocsparse_int i = hipBlockIdx_x * NB + tid; i < size; i += hipGridDim_x * NB)
+    {
+        unsigned long long x = static_cast<unsigned long long>(data[i]) + seed
+                               + 0x9e3779b97f4a7c15ULL * static_cast<unsigned long long>(i);
+
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+
+        h ^= x;
     }
 
-    ++total_row_blocks;
+    sdata[tid] = h;
+
+    __syncthreads();
 
-    if(allocate_row_blocks)
+    for(rocsparse_int s = NB >> 1; s > 0; s >>= 1)
     {
-        size_t dist = std::distance(rowBlocksBase, rowBlocks);
-        assert((2 * dist) <= rowBlockSize);
-        // Update the size of rowBlocks to reflect the actual amount of memory used
-        // We're multiplying the size by two because the extended precision form of
-        // CSR-Adaptive requires more space for the final global reduction.
-        rowBlockSize = 2 * dist;
+        if(tid < s)
+        {
+            sdata[tid] ^= sdata[tid + s];
+        }
+
+        __syncthreads();
     }
-    else
+
+    if(tid == 0)
     {
-        rowBlockSize = 2 * total_row_blocks;
+        atomicXor(hash, sdata[0]);
     }
 }
 
+// Fingerprint the sparsity pattern with a device side hash of csr_row_ptr
+// and csr_col_ind, seeded differently per array to keep their
+// contributions apart
+static inline rocsparse_status rocsparse_csrmv_pattern_hash(rocsparse_handle     handle,
+                                                            rocsparse_int        m,
+                                                            rocsparse_int        nnz,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            const rocsparse_int* csr_col_ind,
+                                                            uint64_t*            hash)
+{
+    hipStream_t stream = handle->stream;
+
+    unsigned long long* d_hash;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(unsigned long long), (void**)&d_hash));
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_hash, 0, sizeof(unsigned long long), stream));
+
+#define CSRMV_HASH_DIM 1024
+#define CSRMV_HASH_MAX_BLOCKS 1024
+    hipLaunchKernelGGL((csrmv_analysis_hash_kernel<CSRMV_HASH_DIM>),
+                       dim3(std::min((m + CSRMV_HASH_DIM) / CSRMV_HASH_DIM,
+                                     (rocsparse_int)CSRMV_HASH_MAX_BLOCKS)),
+                       dim3(CSRMV_HASH_DIM),
+                       0,
+                       stream,
+                       m + 1,
+                       csr_row_ptr,
+                       0x85ebca6b0ed5a2edULL,
+                       d_hash);
+
+    hipLaunchKernelGGL((csrmv_analysis_hash_kernel<CSRMV_HASH_DIM>),
+                       dim3(std::min((nnz - 1) / CSRMV_HASH_DIM + 1,
+                                     (rocsparse_int)CSRMV_HASH_MAX_BLOCKS)),
+                       dim3(CSRMV_HASH_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       csr_col_ind,
+                       0xc2b2ae3d27d4eb4fULL,
+                       d_hash);
+#undef CSRMV_HASH_MAX_BLOCKS
+#undef CSRMV_HASH_DIM
+
+    unsigned long long h_hash;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &h_hash, d_hash, sizeof(unsigned long long), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_hash));
+
+    *hash = h_hash;
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
@@ -376,6 +791,10 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Allocate the handle device memory here ; the compute stage promises
+    // to issue no allocations, such that it can be captured into a hipGraph
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
     // Clear csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
 
@@ -385,126 +804,1055 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     // Stream
     hipStream_t stream = handle->stream;
 
-    // row blocks size
-    info->csrmv_info->size = 0;
+    // Check to ensure m can fit in the row bits of the row block encoding
+    if(static_cast<unsigned long long>(m) > (1ULL << csrmv_row_bits))
+    {
+        return rocsparse_status_invalid_size;
+    }
 
-    // Temporary arrays to hold device data
-    std::vector<rocsparse_int> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToHost, stream));
+    // Fingerprint the sparsity pattern and look it up in the handle
+    // analysis cache ; matrices with identical pattern reuse the cached
+    // results and skip the row block construction entirely
+    uint64_t fingerprint;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrmv_pattern_hash(handle, m, nnz, csr_row_ptr, csr_col_ind, &fingerprint));
 
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    _rocsparse_csrmv_analysis_data* data = handle->csrmv_cache_lookup(fingerprint, m, n, nnz);
 
-    // Determine row blocks array size
-    ComputeRowBlocks((unsigned long long*)NULL, info->csrmv_info->size, hptr.data(), m, false);
+    if(data != nullptr)
+    {
+        info->csrmv_info->data = data;
 
-    // Create row blocks structure
-    std::vector<unsigned long long> row_blocks(info->csrmv_info->size, 0);
+        // Store some pointers to verify correct execution
+        info->csrmv_info->trans       = trans;
+        info->csrmv_info->m           = m;
+        info->csrmv_info->n           = n;
+        info->csrmv_info->nnz         = nnz;
+        info->csrmv_info->descr       = descr;
+        info->csrmv_info->csr_row_ptr = csr_row_ptr;
+        info->csrmv_info->csr_col_ind = csr_col_ind;
 
-    ComputeRowBlocks(row_blocks.data(), info->csrmv_info->size, hptr.data(), m, true);
+        return rocsparse_status_success;
+    }
 
-    // Allocate memory on device to hold csrmv info, if required
-    if(info->csrmv_info->size > 0)
-    {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->row_blocks,
-                                      sizeof(unsigned long long) * info->csrmv_info->size));
+    // Fresh analysis ; the results are shared through the handle cache
+    data = new _rocsparse_csrmv_analysis_data;
 
-        // Copy row blocks information to device
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->row_blocks,
-                                           row_blocks.data(),
-                                           sizeof(unsigned long long) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
+    data->hash = fingerprint;
+    data->m    = m;
+    data->n    = n;
+    data->nnz  = nnz;
 
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Select the tuning variant for this device; the row block packing
+    // depends on it and must match the kernels dispatched at compute time.
+    // A valid override from the handle's tuning table takes precedence over
+    // the built-in architecture based selection
+    if(handle->csrmv_tuning_override >= 0 && handle->csrmv_tuning_override <= 3)
+    {
+        data->tuning = handle->csrmv_tuning_override;
+    }
+    else
+    {
+        data->tuning = csrmv_adaptive_select_tuning(handle->properties);
     }
 
-    // Store some pointers to verify correct execution
-    info->csrmv_info->trans       = trans;
-    info->csrmv_info->m           = m;
-    info->csrmv_info->n           = n;
-    info->csrmv_info->nnz         = nnz;
-    info->csrmv_info->descr       = descr;
-    info->csrmv_info->csr_row_ptr = csr_row_ptr;
-    info->csrmv_info->csr_col_ind = csr_col_ind;
+    info->csrmv_info->data = data;
 
-    return rocsparse_status_success;
-}
+#define CSRMV_ANALYSIS_DIM 1024
+    dim3 analysis_blocks(m / CSRMV_ANALYSIS_DIM + 1);
+    dim3 analysis_threads(CSRMV_ANALYSIS_DIM);
 
-template <typename T, rocsparse_int WF_SIZE>
-__global__ void csrmvn_general_kernel_host_pointer(rocsparse_int m,
-                                                   T             alpha,
-                                                   const rocsparse_int* __restrict__ csr_row_ptr,
-                                                   const rocsparse_int* __restrict__ csr_col_ind,
-                                                   const T* __restrict__ csr_val,
-                                                   const T* __restrict__ x,
-                                                   T beta,
-                                                   T* __restrict__ y,
-                                                   rocsparse_index_base idx_base)
-{
-    csrmvn_general_device<T, WF_SIZE>(
-        m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
-}
+    // Obtain rocprim exclusive scan buffer size
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                (rocsparse_int*)nullptr,
+                                                (rocsparse_int*)nullptr,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
 
-template <typename T, rocsparse_int WF_SIZE>
-__global__ void csrmvn_general_kernel_device_pointer(rocsparse_int m,
-                                                     const T*      alpha,
-                                                     const rocsparse_int* __restrict__ csr_row_ptr,
-                                                     const rocsparse_int* __restrict__ csr_col_ind,
-                                                     const T* __restrict__ csr_val,
-                                                     const T* __restrict__ x,
-                                                     const T* beta,
-                                                     T* __restrict__ y,
-                                                     rocsparse_index_base idx_base)
-{
-    csrmvn_general_device<T, WF_SIZE>(
-        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
-}
+    // Temporary device buffers to construct the row blocks structure
+    char* buffer;
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(((sizeof(rocsparse_int) * (2 * (m + 1) + 1) - 1) / 256 + 1) * 256
+                                 + rocprim_size,
+                             (void**)&buffer));
 
-template <typename T>
-__launch_bounds__(WG_SIZE) __global__
-    void csrmvn_adaptive_kernel_host_pointer(unsigned long long* __restrict__ row_blocks,
-                                             T alpha,
-                                             const rocsparse_int* __restrict__ csr_row_ptr,
-                                             const rocsparse_int* __restrict__ csr_col_ind,
-                                             const T* __restrict__ csr_val,
-                                             const T* __restrict__ x,
-                                             T beta,
-                                             T* __restrict__ y,
-                                             rocsparse_index_base idx_base)
-{
-    csrmvn_adaptive_device<T,
-                           BLOCKSIZE,
-                           BLOCK_MULTIPLIER,
-                           ROWS_FOR_VECTOR,
-                           WG_BITS,
-                           ROW_BITS,
-                           WG_SIZE>(
-        row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
-}
+    char* ptr = buffer;
 
-template <typename T>
-__launch_bounds__(WG_SIZE) __global__
-    void csrmvn_adaptive_kernel_device_pointer(unsigned long long* __restrict__ row_blocks,
-                                               const T* alpha,
-                                               const rocsparse_int* __restrict__ csr_row_ptr,
-                                               const rocsparse_int* __restrict__ csr_col_ind,
-                                               const T* __restrict__ csr_val,
-                                               const T* __restrict__ x,
-                                               const T* beta,
-                                               T* __restrict__ y,
-                                               rocsparse_index_base idx_base)
+    // entry counter per row
+    rocsparse_int* entry_count = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m + 1);
+
+    // entry offset per row
+    rocsparse_int* entry_offset = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m + 1);
+
+    // maximum non-zeros per row
+    rocsparse_int* d_max_nnz = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr = buffer + ((sizeof(rocsparse_int) * (2 * (m + 1) + 1) - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    // Initialize maximum non-zeros per row
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_max_nnz, 0, sizeof(rocsparse_int), stream));
+
+    // Classify each row and count its row block entries
+#define LAUNCH_CSRMV_ANALYSIS_COUNT(VARIANT)                                          \
+    hipLaunchKernelGGL((csrmv_analysis_count_kernel<CSRMV_ANALYSIS_DIM,               \
+                                                    csrmv_adaptive_config<VARIANT>::block_size, \
+                                                    csrmv_adaptive_config<VARIANT>::block_multiplier, \
+                                                    csrmv_wg_bits>),                  \
+                       analysis_blocks,                                               \
+                       analysis_threads,                                              \
+                       0,                                                             \
+                       stream,                                                        \
+                       m,                                                             \
+                       csr_row_ptr,                                                   \
+                       entry_count,                                                   \
+                       d_max_nnz,                                                     \
+                       descr->base)
+
+    switch(data->tuning)
+    {
+    case 1:
+        LAUNCH_CSRMV_ANALYSIS_COUNT(1);
+        break;
+    case 2:
+        LAUNCH_CSRMV_ANALYSIS_COUNT(2);
+        break;
+    case 3:
+        LAUNCH_CSRMV_ANALYSIS_COUNT(3);
+        break;
+    default:
+        LAUNCH_CSRMV_ANALYSIS_COUNT(0);
+        break;
+    }
+#undef LAUNCH_CSRMV_ANALYSIS_COUNT
+
+    // Exclusive scan to obtain the entry offsets
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                entry_count,
+                                                entry_offset,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Obtain the total number of row block entries and the maximum
+    // non-zeros per row
+    rocsparse_int total_entries;
+    rocsparse_int max_row_nnz;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(&total_entries,
+                                       entry_offset + m,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &max_row_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Account for the terminating entry
+    ++total_entries;
+
+    rocsparse_int avg_row_nnz = (nnz - 1) / m + 1;
+
+    // Heavily skewed row length distributions load imbalance the adaptive
+    // kernel, as a single row can bind thousands of workgroups. Select the
+    // merge path kernel instead, which splits the non-zero entries equally
+    // among all wavefronts and does not require the row blocks structure.
+    if(max_row_nnz > csrmv_adaptive_block_size(data->tuning) && max_row_nnz > 64 * avg_row_nnz)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(buffer));
+
+        data->use_merge_path = true;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->csrmv_cache_insert(data));
+
+        // Store some pointers to verify correct execution
+        info->csrmv_info->trans       = trans;
+        info->csrmv_info->m           = m;
+        info->csrmv_info->n           = n;
+        info->csrmv_info->nnz         = nnz;
+        info->csrmv_info->descr       = descr;
+        info->csrmv_info->csr_row_ptr = csr_row_ptr;
+        info->csrmv_info->csr_col_ind = csr_col_ind;
+
+        return rocsparse_status_success;
+    }
+
+    // Very wide matrices gather x over a column range that exceeds the L2
+    // cache by orders of magnitude, such that almost every x access misses.
+    // Pre-split the rows into column panels, such that the compute step can
+    // run panel by panel and each pass only gathers from an L2 sized slice
+    // of x. The panel splitting requires sorted column indices within each
+    // row and falls back to the other kernels otherwise
+    if(n >= 16 * csrmv_col_panel_width)
+    {
+        rocsparse_int num_col_panels = (n - 1) / csrmv_col_panel_width + 1;
+
+        // Per panel cursors plus a flag raised on unsorted column indices,
+        // used to count the row panel intersections first and rewound to
+        // the panel start offsets for the scatter pass
+        rocsparse_int* panel_cursor = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(
+            sizeof(rocsparse_int) * num_col_panels + sizeof(int), (void**)&panel_cursor));
+
+        int* d_unsorted = reinterpret_cast<int*>(panel_cursor + num_col_panels);
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(
+            panel_cursor, 0, sizeof(rocsparse_int) * num_col_panels + sizeof(int), stream));
+
+        hipLaunchKernelGGL((csrmv_analysis_col_panel_count_kernel<CSRMV_ANALYSIS_DIM>),
+                           analysis_blocks,
+                           analysis_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           panel_cursor,
+                           d_unsorted,
+                           descr->base);
+
+        std::vector<rocsparse_int> h_panel_count(num_col_panels);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_panel_count.data(),
+                                           panel_cursor,
+                                           sizeof(rocsparse_int) * num_col_panels,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        int h_unsorted;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&h_unsorted, d_unsorted, sizeof(int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(h_unsorted == 0)
+        {
+            // Exclusive scan of the counts yields the panel start offsets
+            data->num_col_panels = num_col_panels;
+            data->col_panel_ptr  = new rocsparse_int[num_col_panels + 1];
+
+            data->col_panel_ptr[0] = 0;
+            for(rocsparse_int panel = 0; panel < num_col_panels; ++panel)
+            {
+                data->col_panel_ptr[panel + 1]
+                    = data->col_panel_ptr[panel] + h_panel_count[panel];
+            }
+
+            rocsparse_int num_col_entries = data->col_panel_ptr[num_col_panels];
+
+            RETURN_IF_HIP_ERROR(hipMalloc((void**)&data->col_panel_rows,
+                                          sizeof(rocsparse_int) * num_col_entries));
+            RETURN_IF_HIP_ERROR(hipMalloc((void**)&data->col_panel_begin,
+                                          sizeof(rocsparse_int) * num_col_entries));
+
+            // Rewind the cursors to the start of each panel
+            RETURN_IF_HIP_ERROR(hipMemcpy(panel_cursor,
+                                          data->col_panel_ptr,
+                                          sizeof(rocsparse_int) * num_col_panels,
+                                          hipMemcpyHostToDevice));
+
+            hipLaunchKernelGGL((csrmv_analysis_col_panel_scatter_kernel<CSRMV_ANALYSIS_DIM>),
+                               analysis_blocks,
+                               analysis_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               panel_cursor,
+                               data->col_panel_rows,
+                               data->col_panel_begin,
+                               descr->base);
+
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(panel_cursor));
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(buffer));
+
+            data->use_col_blocked = true;
+
+            RETURN_IF_ROCSPARSE_ERROR(handle->csrmv_cache_insert(data));
+
+            // Store some pointers to verify correct execution
+            info->csrmv_info->trans       = trans;
+            info->csrmv_info->m           = m;
+            info->csrmv_info->n           = n;
+            info->csrmv_info->nnz         = nnz;
+            info->csrmv_info->descr       = descr;
+            info->csrmv_info->csr_row_ptr = csr_row_ptr;
+            info->csrmv_info->csr_col_ind = csr_col_ind;
+
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(panel_cursor));
+    }
+
+    // Short mean row lengths leave most lanes of a wavefront per row idle.
+    // Bucket the rows by length instead, such that short rows run with a
+    // single thread or a quarter wavefront, and skip the row blocks
+    // construction entirely
+    if(avg_row_nnz <= 2 * csrmv_bin_thread_nnz)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(buffer));
+
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&data->bin_rows, sizeof(rocsparse_int) * m));
+
+        // Per bin cursors, used to count the rows per bin first and rewound
+        // to the bin start offsets for the scatter pass
+        rocsparse_int* bin_cursor = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->buffer_alloc(sizeof(rocsparse_int) * 3, (void**)&bin_cursor));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(bin_cursor, 0, sizeof(rocsparse_int) * 3, stream));
+
+        hipLaunchKernelGGL((csrmv_analysis_bin_count_kernel<CSRMV_ANALYSIS_DIM>),
+                           analysis_blocks,
+                           analysis_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           bin_cursor);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(data->bin_size,
+                                           bin_cursor,
+                                           sizeof(rocsparse_int) * 3,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // Rewind the cursors to the start of each bin
+        rocsparse_int bin_offset[3];
+        bin_offset[0] = 0;
+        bin_offset[1] = data->bin_size[0];
+        bin_offset[2] = data->bin_size[0] + data->bin_size[1];
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(bin_cursor, bin_offset, sizeof(rocsparse_int) * 3, hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL((csrmv_analysis_bin_scatter_kernel<CSRMV_ANALYSIS_DIM>),
+                           analysis_blocks,
+                           analysis_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           bin_cursor,
+                           data->bin_rows);
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(bin_cursor));
+
+        data->use_binned_path = true;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->csrmv_cache_insert(data));
+
+        // Store some pointers to verify correct execution
+        info->csrmv_info->trans       = trans;
+        info->csrmv_info->m           = m;
+        info->csrmv_info->n           = n;
+        info->csrmv_info->nnz         = nnz;
+        info->csrmv_info->descr       = descr;
+        info->csrmv_info->csr_row_ptr = csr_row_ptr;
+        info->csrmv_info->csr_col_ind = csr_col_ind;
+
+        return rocsparse_status_success;
+    }
+
+    // We're multiplying the size by two because the extended precision form
+    // of CSR-Adaptive requires more space for the final global reduction.
+    data->size = 2 * total_entries;
+
+    // Allocate memory on device to hold csrmv info
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&data->row_blocks, sizeof(unsigned long long) * data->size));
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(data->row_blocks, 0, sizeof(unsigned long long) * data->size, stream));
+
+    // Scatter the row block entries
+    hipLaunchKernelGGL((csrmv_analysis_fill_kernel<CSRMV_ANALYSIS_DIM, csrmv_row_bits>),
+                       analysis_blocks,
+                       analysis_threads,
+                       0,
+                       stream,
+                       m,
+                       entry_count,
+                       entry_offset,
+                       data->row_blocks);
+
+    // Pre-compute the number of reduction threads for CSR-Stream blocks
+#define LAUNCH_CSRMV_ANALYSIS_REDUCTION(VARIANT)                                      \
+    hipLaunchKernelGGL((csrmv_analysis_reduction_kernel<CSRMV_ANALYSIS_DIM,           \
+                                                        csrmv_row_bits,               \
+                                                        csrmv_wg_bits,                \
+                                                        csrmv_adaptive_config<VARIANT>::wg_size, \
+                                                        csrmv_adaptive_config<VARIANT>::rows_for_vector>), \
+                       dim3((total_entries - 1) / CSRMV_ANALYSIS_DIM + 1),            \
+                       analysis_threads,                                              \
+                       0,                                                             \
+                       stream,                                                        \
+                       total_entries - 1,                                             \
+                       data->row_blocks)
+
+    switch(data->tuning)
+    {
+    case 1:
+        LAUNCH_CSRMV_ANALYSIS_REDUCTION(1);
+        break;
+    case 2:
+        LAUNCH_CSRMV_ANALYSIS_REDUCTION(2);
+        break;
+    case 3:
+        LAUNCH_CSRMV_ANALYSIS_REDUCTION(3);
+        break;
+    default:
+        LAUNCH_CSRMV_ANALYSIS_REDUCTION(0);
+        break;
+    }
+#undef LAUNCH_CSRMV_ANALYSIS_REDUCTION
+
+    // Managed memory oversubscription: if the csr arrays are managed and
+    // exceed the free device memory, derive row panel boundaries from the
+    // row blocks, such that the compute step can prefetch upcoming panels
+    // while processing the current one instead of faulting page by page
+    hipPointerAttribute_t attributes;
+    if(hipPointerGetAttributes(&attributes, (void*)csr_val) == hipSuccess && attributes.isManaged)
+    {
+        size_t free_mem;
+        size_t total_mem;
+        RETURN_IF_HIP_ERROR(hipMemGetInfo(&free_mem, &total_mem));
+
+        size_t footprint
+            = (sizeof(T) + sizeof(rocsparse_int)) * nnz + sizeof(rocsparse_int) * (m + 1);
+
+        if(footprint > free_mem)
+        {
+            // Panels cover a quarter of the free device memory each, such
+            // that the current and the prefetched panel leave headroom for
+            // the vectors and the row blocks
+            rocsparse_int panel_nnz_target
+                = free_mem / (4 * (sizeof(T) + sizeof(rocsparse_int)));
+
+            std::vector<unsigned long long> h_row_blocks(total_entries);
+            RETURN_IF_HIP_ERROR(hipMemcpy(h_row_blocks.data(),
+                                          data->row_blocks,
+                                          sizeof(unsigned long long) * total_entries,
+                                          hipMemcpyDeviceToHost));
+
+            std::vector<rocsparse_int> h_row_ptr(m + 1);
+            RETURN_IF_HIP_ERROR(hipMemcpy(h_row_ptr.data(),
+                                          csr_row_ptr,
+                                          sizeof(rocsparse_int) * (m + 1),
+                                          hipMemcpyDeviceToHost));
+
+            std::vector<size_t>        panel_block(1, 0);
+            std::vector<rocsparse_int> panel_nnz(1, 0);
+
+            // Cut a panel whenever the non-zeros since the last cut exceed
+            // the target; row block boundaries are the only valid cuts, as
+            // each workgroup processes one row block entry
+            for(rocsparse_int i = 1; i < total_entries - 1; ++i)
+            {
+                rocsparse_int row = (h_row_blocks[i] >> (64 - csrmv_row_bits))
+                                    & ((1ULL << csrmv_row_bits) - 1ULL);
+
+                rocsparse_int row_begin = h_row_ptr[row] - descr->base;
+
+                if(row_begin - panel_nnz.back() >= panel_nnz_target)
+                {
+                    panel_block.push_back(i);
+                    panel_nnz.push_back(row_begin);
+                }
+            }
+
+            panel_block.push_back(total_entries - 1);
+            panel_nnz.push_back(nnz);
+
+            if(panel_block.size() > 2)
+            {
+                data->num_panels  = (rocsparse_int)panel_block.size() - 1;
+                data->panel_block = new size_t[panel_block.size()];
+                data->panel_nnz   = new rocsparse_int[panel_nnz.size()];
+
+                std::copy(panel_block.begin(), panel_block.end(), data->panel_block);
+                std::copy(panel_nnz.begin(), panel_nnz.end(), data->panel_nnz);
+
+                data->oversubscribed = true;
+            }
+        }
+    }
+
+    // Delta compress the column indices if every row block spans a column
+    // range of less than 2^16: one base column per row block plus a 16-bit
+    // offset per non-zero, such that the adaptive kernel reads a quarter
+    // (ILP64: an eighth) of the csr_col_ind bytes for banded patterns.
+    // Skipped under oversubscription, where the compute step offsets the row
+    // blocks panel by panel and the per block base would not line up
+    if(!data->oversubscribed)
+    {
+        int* exceeded;
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(int), (void**)&exceeded));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(exceeded, 0, sizeof(int), stream));
+
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&data->col_base, sizeof(rocsparse_int) * (total_entries - 1)));
+
+        hipLaunchKernelGGL((csrmv_analysis_delta_base_kernel<CSRMV_ANALYSIS_DIM, csrmv_row_bits>),
+                           dim3(total_entries - 1),
+                           analysis_threads,
+                           0,
+                           stream,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           data->row_blocks,
+                           data->col_base,
+                           exceeded,
+                           descr->base);
+
+        int h_exceeded;
+        RETURN_IF_HIP_ERROR(hipMemcpy(&h_exceeded, exceeded, sizeof(int), hipMemcpyDeviceToHost));
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(exceeded));
+
+        if(h_exceeded == 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMalloc((void**)&data->col_delta, sizeof(uint16_t) * nnz));
+
+            hipLaunchKernelGGL(
+                (csrmv_analysis_delta_fill_kernel<CSRMV_ANALYSIS_DIM, csrmv_row_bits>),
+                dim3(total_entries - 1),
+                analysis_threads,
+                0,
+                stream,
+                csr_row_ptr,
+                csr_col_ind,
+                data->row_blocks,
+                data->col_base,
+                data->col_delta,
+                descr->base);
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipFree(data->col_base));
+            data->col_base = nullptr;
+        }
+    }
+
+#if defined(rocsparse_ILP64)
+    // Build a 32-bit copy of the column indices if the column count fits,
+    // such that the adaptive kernel reads half the csr_col_ind bytes.
+    // Skipped under oversubscription, where the copy would not fit either,
+    // and when the delta compression succeeded, which the compute step
+    // prefers
+    if(data->col_delta == nullptr && !data->oversubscribed
+       && n <= std::numeric_limits<int32_t>::max())
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&data->csr_col_ind_narrow, sizeof(int32_t) * nnz));
+
+        hipLaunchKernelGGL((csrmv_analysis_narrow_kernel<CSRMV_ANALYSIS_DIM>),
+                           dim3((nnz - 1) / CSRMV_ANALYSIS_DIM + 1),
+                           analysis_threads,
+                           0,
+                           stream,
+                           nnz,
+                           csr_col_ind,
+                           data->csr_col_ind_narrow);
+    }
+#endif
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(buffer));
+#undef CSRMV_ANALYSIS_DIM
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->csrmv_cache_insert(data));
+
+    // Store some pointers to verify correct execution
+    info->csrmv_info->trans       = trans;
+    info->csrmv_info->m           = m;
+    info->csrmv_info->n           = n;
+    info->csrmv_info->nnz         = nnz;
+    info->csrmv_info->descr       = descr;
+    info->csrmv_info->csr_row_ptr = csr_row_ptr;
+    info->csrmv_info->csr_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+// All csrmv kernels take alpha and beta by device pointer. In host pointer
+// mode, the scalars are staged into the handle's device scalar ring, such
+// that a single instantiation serves both pointer modes. If the scalar
+// values are known at dispatch time, ALPHA_ONE and BETA_ZERO select
+// specialized instantiations that skip the corresponding scalar load
+template <typename A, typename T, rocsparse_int WF_SIZE, bool ALPHA_ONE = false,
+          bool BETA_ZERO = false>
+__global__ void csrmvn_general_kernel(rocsparse_int m,
+                                      const T*      alpha,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const A* __restrict__ csr_val,
+                                      const T* __restrict__ x,
+                                      const T* beta,
+                                      T* __restrict__ y,
+                                      rocsparse_index_base idx_base)
+{
+    csrmvn_general_device<A, T, WF_SIZE, ALPHA_ONE, BETA_ZERO>(
+        m,
+        ALPHA_ONE ? static_cast<T>(1) : *alpha,
+        csr_row_ptr,
+        csr_col_ind,
+        csr_val,
+        x,
+        BETA_ZERO ? static_cast<T>(0) : *beta,
+        y,
+        idx_base);
+}
+
+template <typename A, typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_binned_kernel(rocsparse_int nrows,
+                                     const rocsparse_int* __restrict__ bin_rows,
+                                     const T* alpha,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const A* __restrict__ csr_val,
+                                     const T* __restrict__ x,
+                                     const T* beta,
+                                     T* __restrict__ y,
+                                     rocsparse_index_base idx_base)
+{
+    csrmvn_binned_device<A, T, WF_SIZE>(
+        nrows, bin_rows, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+template <typename A, typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_colblock_kernel(rocsparse_int nsect,
+                                       const rocsparse_int* __restrict__ sect_rows,
+                                       const rocsparse_int* __restrict__ sect_begin,
+                                       rocsparse_int col_end,
+                                       const T*      alpha,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const A* __restrict__ csr_val,
+                                       const T* __restrict__ x,
+                                       T* __restrict__ y,
+                                       rocsparse_index_base idx_base)
+{
+    csrmvn_colblock_device<A, T, WF_SIZE>(
+        nsect, sect_rows, sect_begin, col_end, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename A, typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_masked_kernel(rocsparse_int num_masked,
+                                     const rocsparse_int* __restrict__ mask_row_ind,
+                                     const T* alpha,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const A* __restrict__ csr_val,
+                                     const T* __restrict__ x,
+                                     const T* beta,
+                                     T* __restrict__ y,
+                                     rocsparse_index_base idx_base)
+{
+    csrmvn_masked_device<A, T, WF_SIZE>(
+        num_masked, mask_row_ind, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+template <typename A, typename T, rocsparse_int WF_SIZE, bool DIAG, bool SUB, bool CLAMP>
+__global__ void csrmvn_epilogue_kernel(rocsparse_int m,
+                                       const T*      alpha,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const A* __restrict__ csr_val,
+                                       const T* __restrict__ x,
+                                       const T* beta,
+                                       T* __restrict__ y,
+                                       const T* __restrict__ diag,
+                                       const T* __restrict__ vec,
+                                       const T*             clamp_lo,
+                                       const T*             clamp_hi,
+                                       rocsparse_index_base idx_base)
+{
+    csrmvn_epilogue_device<A, T, WF_SIZE, DIAG, SUB, CLAMP>(
+        m,
+        *alpha,
+        csr_row_ptr,
+        csr_col_ind,
+        csr_val,
+        x,
+        *beta,
+        y,
+        diag,
+        vec,
+        CLAMP ? *clamp_lo : static_cast<T>(0),
+        CLAMP ? *clamp_hi : static_cast<T>(0),
+        idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_panel_kernel(rocsparse_int nrows,
+                                    const T*      alpha,
+                                    rocsparse_int shift,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const T* __restrict__ csr_val,
+                                    const T* __restrict__ x,
+                                    const T* beta,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    csrmvn_panel_device<T, WF_SIZE>(
+        nrows, *alpha, shift, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_quant_kernel(rocsparse_int m,
+                                    const T*      alpha,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const int8_t* __restrict__ csr_val,
+                                    const T* __restrict__ csr_scale,
+                                    const T* __restrict__ x,
+                                    const T* beta,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    csrmvn_quant_device<T, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, csr_scale, x, *beta, y, idx_base);
+}
+
+template <typename T, typename SEMIRING, rocsparse_int WF_SIZE>
+__global__ void csrmvn_semiring_kernel(rocsparse_int m,
+                                       const T*      alpha,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const T* __restrict__ x,
+                                       const T* beta,
+                                       T* __restrict__ y,
+                                       rocsparse_index_base idx_base)
+{
+    csrmvn_semiring_device<T, SEMIRING, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_persistent_kernel(rocsparse_int m,
+                                         rocsparse_int niter,
+                                         const T*      alpha,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                         const T* __restrict__ csr_val,
+                                         const T* __restrict__ x,
+                                         const T* beta,
+                                         T* __restrict__ y,
+                                         T* __restrict__ tmp,
+                                         int* __restrict__ count,
+                                         int* __restrict__ generation,
+                                         rocsparse_index_base idx_base)
+{
+    csrmvn_persistent_device<T, WF_SIZE>(m,
+                                         niter,
+                                         *alpha,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         csr_val,
+                                         x,
+                                         *beta,
+                                         y,
+                                         tmp,
+                                         count,
+                                         generation,
+                                         idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvn_powers_kernel(rocsparse_int m,
+                                     rocsparse_int s,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     const T* __restrict__ x,
+                                     T* __restrict__ y,
+                                     rocsparse_int ldy,
+                                     int* __restrict__ count,
+                                     int* __restrict__ generation,
+                                     rocsparse_index_base idx_base)
+{
+    csrmvn_powers_device<T, WF_SIZE>(
+        m, s, csr_row_ptr, csr_col_ind, csr_val, x, y, ldy, count, generation, idx_base);
+}
+
+template <typename T, rocsparse_int NRHS, rocsparse_int WF_SIZE>
+__global__ void csrmvn_general_multi_kernel(rocsparse_int m,
+                                            const T*      alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            const T* __restrict__ x,
+                                            rocsparse_int ldx,
+                                            const T*      beta,
+                                            T* __restrict__ y,
+                                            rocsparse_int        ldy,
+                                            rocsparse_index_base idx_base)
+{
+    csrmvn_general_multi_device<T, NRHS, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, ldx, *beta, y, ldy, idx_base);
+}
+
+template <typename T, rocsparse_int NB, rocsparse_int WF_SIZE>
+__global__ void csrmvn_dot_kernel(rocsparse_int m,
+                                  const T*      alpha,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const T* __restrict__ csr_val,
+                                  const T* __restrict__ x,
+                                  const T* beta,
+                                  T* __restrict__ y,
+                                  T* __restrict__ workspace,
+                                  rocsparse_index_base idx_base)
+{
+    csrmvn_dot_device<T, NB, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, workspace, idx_base);
+}
+
+template <typename T, rocsparse_int NB>
+__global__ void csrmv_dot_reduce_kernel(rocsparse_int n, T* workspace, T* result)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ T sdata[NB];
+    sdata[tid] = static_cast<T>(0);
+
+    for(rocsparse_int i = tid; i < n; i += NB)
+    {
+        sdata[tid] += workspace[i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        if(result)
+        {
+            *result = sdata[0];
+        }
+        else
+        {
+            workspace[0] = sdata[0];
+        }
+    }
+}
+
+template <typename T, rocsparse_int NBATCH, rocsparse_int WF_SIZE>
+__global__ void csrmvn_general_batched_kernel(rocsparse_int m,
+                                              const T*      alpha,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ csr_val,
+                                              rocsparse_int stride,
+                                              const T* __restrict__ x,
+                                              const T* beta,
+                                              T* __restrict__ y,
+                                              rocsparse_int        stride_y,
+                                              rocsparse_index_base idx_base)
+{
+    csrmvn_general_batched_device<T, NBATCH, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, stride, x, *beta, y, stride_y, idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE, bool CONJ>
+__global__ void csrmvt_general_kernel(rocsparse_int m,
+                                      const T*      alpha,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const T* __restrict__ csr_val,
+                                      const T* __restrict__ x,
+                                      T* __restrict__ y,
+                                      rocsparse_index_base idx_base)
+{
+    csrmvt_general_device<T, WF_SIZE, CONJ>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void csrmvs_general_kernel(rocsparse_int m,
+                                      const T*      alpha,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const T* __restrict__ csr_val,
+                                      const T* __restrict__ x,
+                                      T* __restrict__ y,
+                                      rocsparse_index_base idx_base)
+{
+    csrmvs_general_device<T, WF_SIZE>(m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename A, typename T, typename J, int VARIANT>
+__launch_bounds__(csrmv_adaptive_config<VARIANT>::wg_size) __global__
+    void csrmvn_adaptive_kernel(unsigned long long* __restrict__ row_blocks,
+                                const T* alpha,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                J csr_col_ind,
+                                const A* __restrict__ csr_val,
+                                const T* __restrict__ x,
+                                const T* beta,
+                                T* __restrict__ y,
+                                T* __restrict__ wg_partials,
+                                rocsparse_index_base idx_base)
+{
+    csrmvn_adaptive_device<A,
+                           T,
+                           J,
+                           csrmv_adaptive_config<VARIANT>::block_size,
+                           csrmv_adaptive_config<VARIANT>::block_multiplier,
+                           csrmv_adaptive_config<VARIANT>::rows_for_vector,
+                           csrmv_wg_bits,
+                           csrmv_row_bits,
+                           csrmv_adaptive_config<VARIANT>::wg_size>(
+        row_blocks,
+        *alpha,
+        csr_row_ptr,
+        csr_col_ind,
+        csr_val,
+        x,
+        *beta,
+        y,
+        static_cast<T>(0),
+        static_cast<const T*>(nullptr),
+        wg_partials,
+        idx_base);
+}
+
+// Ordered combine of the long row partials written in deterministic mode
+template <typename T>
+__global__ void csrmvn_adaptive_fixup_kernel(rocsparse_int nblocks,
+                                             const unsigned long long* __restrict__ row_blocks,
+                                             const T* __restrict__ wg_partials,
+                                             const T* beta,
+                                             T* __restrict__ y)
+{
+    csrmvn_adaptive_fixup_device<T, csrmv_wg_bits, csrmv_row_bits>(
+        nblocks, row_blocks, wg_partials, *beta, y, static_cast<T>(0), nullptr);
+}
+
+// Fused polynomial variant of the adaptive kernel, computing
+// y = alpha * A * x + beta * y + gamma * z in a single pass. The polynomial
+// coefficients are host values by contract, hence the scalars are passed by
+// value instead of through staged device pointers
+template <typename A, typename T, typename J, int VARIANT>
+__launch_bounds__(csrmv_adaptive_config<VARIANT>::wg_size) __global__
+    void csrmvn_adaptive_poly_kernel(unsigned long long* __restrict__ row_blocks,
+                                     T alpha,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     J csr_col_ind,
+                                     const A* __restrict__ csr_val,
+                                     const T* __restrict__ x,
+                                     T beta,
+                                     T* __restrict__ y,
+                                     T gamma,
+                                     const T* __restrict__ z,
+                                     T* __restrict__ wg_partials,
+                                     rocsparse_index_base idx_base)
+{
+    csrmvn_adaptive_device<A,
+                           T,
+                           J,
+                           csrmv_adaptive_config<VARIANT>::block_size,
+                           csrmv_adaptive_config<VARIANT>::block_multiplier,
+                           csrmv_adaptive_config<VARIANT>::rows_for_vector,
+                           csrmv_wg_bits,
+                           csrmv_row_bits,
+                           csrmv_adaptive_config<VARIANT>::wg_size>(
+        row_blocks,
+        alpha,
+        csr_row_ptr,
+        csr_col_ind,
+        csr_val,
+        x,
+        beta,
+        y,
+        gamma,
+        z,
+        wg_partials,
+        idx_base);
+}
+
+// Ordered combine of the long row partials for the fused polynomial apply,
+// the scalars are host values passed by value
+template <typename T>
+__global__ void csrmvn_adaptive_poly_fixup_kernel(rocsparse_int nblocks,
+                                                  const unsigned long long* __restrict__ row_blocks,
+                                                  const T* __restrict__ wg_partials,
+                                                  T* __restrict__ y,
+                                                  T gamma,
+                                                  const T* __restrict__ z)
+{
+    csrmvn_adaptive_fixup_device<T, csrmv_wg_bits, csrmv_row_bits>(
+        nblocks, row_blocks, wg_partials, static_cast<T>(0), y, gamma, z);
+}
+
+// Degree zero of the polynomial apply, y = alpha * x
+template <typename T>
+__global__ void csrmv_poly_scale_kernel(rocsparse_int size,
+                                        T             alpha,
+                                        const T* __restrict__ x,
+                                        T* __restrict__ y)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    y[gid] = alpha * x[gid];
+}
+
+template <typename T>
+__global__ void
+    csrmv_scale_kernel(rocsparse_int size, const T* __restrict__ beta, T* __restrict__ data)
+{
+    if(*beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    csrmv_scale_device<T>(size, *beta, data);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(128) __global__
+    void csrmvn_merge_kernel(rocsparse_int m,
+                             rocsparse_int nnz,
+                             rocsparse_int loops,
+                             const T*      alpha,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             const T* __restrict__ x,
+                             T* __restrict__ y,
+                             rocsparse_int* __restrict__ row_block_red,
+                             T* __restrict__ val_block_red,
+                             rocsparse_index_base idx_base)
 {
-    csrmvn_adaptive_device<T,
-                           BLOCKSIZE,
-                           BLOCK_MULTIPLIER,
-                           ROWS_FOR_VECTOR,
-                           WG_BITS,
-                           ROW_BITS,
-                           WG_SIZE>(
-        row_blocks, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+    csrmvn_merge_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                               nnz,
+                                               loops,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               x,
+                                               y,
+                                               row_block_red,
+                                               val_block_red,
+                                               idx_base);
 }
 
 template <typename T>
@@ -584,7 +1932,8 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -603,6 +1952,10 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_size;
     }
+    else if(descr->type == rocsparse_matrix_type_symmetric && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
 
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
@@ -640,18 +1993,94 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
-    if(info == nullptr)
+    // Apply the row range view, if set. The row pointers of the range keep
+    // their absolute offsets into csr_val and csr_col_ind, such that
+    // restricting the operation to rows [begin, end) only shifts csr_row_ptr
+    // and y - no matrix data is moved
+    if(descr->row_range_end >= 0)
     {
-        // If csrmv info is not available, call csrmv general
-        return rocsparse_csrmv_general_template(
-            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        if(descr->row_range_end > m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+        {
+            // TODO
+            return rocsparse_status_not_implemented;
+        }
+
+        m = descr->row_range_end - descr->row_range_begin;
+        csr_row_ptr += descr->row_range_begin;
+        y += descr->row_range_begin;
+
+        // Quick return on an empty view
+        if(m == 0)
+        {
+            return rocsparse_status_success;
+        }
     }
-    else if(info->csrmv_info == nullptr)
+
+    // Profile the operation ; the matrix data, x and y are each moved once
+    rocsparse_profile_scope<T> profile(handle,
+                                       "rocsparse_Xcsrmv",
+                                       static_cast<double>(sizeof(T)) * (nnz + n + 2.0 * m)
+                                           + static_cast<double>(sizeof(rocsparse_int))
+                                                 * (nnz + m + 1.0));
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xcsrmv");
+
+    // Symmetric matrices store a single triangle, each stored entry
+    // contributes to both y[row] and y[col]. The transposed product
+    // coincides with the non-transposed product. The conjugate transposed
+    // product of a complex symmetric matrix does not, conj(A) has no
+    // dedicated kernel
+    if(descr->type == rocsparse_matrix_type_symmetric)
     {
-        // If csrmv info is not available, call csrmv general
+        if(trans == rocsparse_operation_conjugate_transpose
+           && (std::is_same<T, rocsparse_float_complex>::value
+               || std::is_same<T, rocsparse_double_complex>::value))
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        return rocsparse_csrmv_symm_template(
+            handle, m, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+
+    if(info == nullptr || trans != rocsparse_operation_none || descr->row_range_end >= 0)
+    {
+        // If csrmv info is not available, the matrix is transposed or a row
+        // range view is set (the adaptive row blocks describe the full
+        // matrix), call csrmv general
+        return rocsparse_csrmv_general_template(
+            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else if(info->csrmv_info == nullptr || info->csrmv_info->data == nullptr)
+    {
+        // If csrmv info is not available, call csrmv general
         return rocsparse_csrmv_general_template(
             handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
     }
+    else if(handle->csrmv_probe && info->csrmv_info->data->probe_winner != 0)
+    {
+        // Online kernel selection probing ; the first calls time the
+        // analyzed kernel against the general kernel, afterwards the
+        // winner runs directly
+        return rocsparse_csrmv_probe_template(handle,
+                                              trans,
+                                              m,
+                                              n,
+                                              nnz,
+                                              alpha,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info->csrmv_info,
+                                              x,
+                                              beta,
+                                              y);
+    }
     else
     {
         // If csrmv info is available, call csrmv adaptive
@@ -672,6 +2101,194 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     }
 }
 
+template <typename T>
+rocsparse_status rocsparse_csrmv_symm_template(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const T*                  alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               const T*                  x,
+                                               const T*                  beta,
+                                               T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The mirrored contributions scatter into y, thus y has to be scaled
+    // by beta in advance
+#define CSRMVS_DIM 256
+    dim3 csrmvs_blocks((m - 1) / (CSRMVS_DIM / handle->wavefront_size) + 1);
+    dim3 csrmvs_threads(CSRMVS_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    // Scale y with beta
+    hipLaunchKernelGGL((csrmv_scale_kernel<T>),
+                       dim3((m - 1) / 1024 + 1),
+                       dim3(1024),
+                       0,
+                       stream,
+                       m,
+                       d_beta,
+                       y);
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrmvs_general_kernel<T, 32>),
+                           csrmvs_blocks,
+                           csrmvs_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->base);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((csrmvs_general_kernel<T, 64>),
+                           csrmvs_blocks,
+                           csrmvs_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRMVS_DIM
+
+    return rocsparse_status_success;
+}
+
+// Launch helper of the general csrmvn kernel, selecting the wavefront size
+// by the average number of non-zeros per row. ALPHA_ONE and BETA_ZERO pick
+// compile time specialized instantiations for scalar values known at
+// dispatch time
+template <typename A, typename T, bool ALPHA_ONE, bool BETA_ZERO>
+static rocsparse_status rocsparse_csrmvn_general_launch(rocsparse_handle     handle,
+                                                        rocsparse_int        m,
+                                                        rocsparse_int        nnz_per_row,
+                                                        const T*             alpha,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        const rocsparse_int* csr_col_ind,
+                                                        const A*             csr_val,
+                                                        const T*             x,
+                                                        const T*             beta,
+                                                        T*                   y,
+                                                        rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMVN_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_DIM);
+
+    rocsparse_int wf_size;
+
+    if(nnz_per_row < 4)
+    {
+        wf_size = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wf_size = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wf_size = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wf_size = 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        wf_size = 32;
+    }
+    else
+    {
+        wf_size = 64;
+    }
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+#define LAUNCH_CSRMVN_GENERAL(wfsize)                                                  \
+    hipLaunchKernelGGL((csrmvn_general_kernel<A, T, wfsize, ALPHA_ONE, BETA_ZERO>),    \
+                       csrmvn_blocks,                                                  \
+                       csrmvn_threads,                                                 \
+                       0,                                                              \
+                       stream,                                                         \
+                       m,                                                              \
+                       alpha,                                                          \
+                       csr_row_ptr,                                                    \
+                       csr_col_ind,                                                    \
+                       csr_val,                                                        \
+                       x,                                                              \
+                       beta,                                                           \
+                       y,                                                              \
+                       idx_base)
+
+    if(wf_size == 2)
+    {
+        LAUNCH_CSRMVN_GENERAL(2);
+    }
+    else if(wf_size == 4)
+    {
+        LAUNCH_CSRMVN_GENERAL(4);
+    }
+    else if(wf_size == 8)
+    {
+        LAUNCH_CSRMVN_GENERAL(8);
+    }
+    else if(wf_size == 16)
+    {
+        LAUNCH_CSRMVN_GENERAL(16);
+    }
+    else if(wf_size == 32)
+    {
+        LAUNCH_CSRMVN_GENERAL(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_GENERAL(64);
+    }
+#undef LAUNCH_CSRMVN_GENERAL
+#undef CSRMVN_DIM
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          handle,
                                                   rocsparse_operation       trans,
@@ -693,423 +2310,164 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          hand
     // Run different csrmv kernels
     if(trans == rocsparse_operation_none)
     {
-#define CSRMVN_DIM 512
         rocsparse_int nnz_per_row = nnz / m;
 
-        dim3 csrmvn_blocks((m - 1) / CSRMVN_DIM + 1);
-        dim3 csrmvn_threads(CSRMVN_DIM);
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
 
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        // In host pointer mode, the scalar values are known at dispatch time
+        // and the common cases are served by compile time specialized kernel
+        // instantiations. beta == 0 prunes the read of y entirely,
+        // alpha == 1 drops the per element multiply
+        bool alpha_one = handle->pointer_mode == rocsparse_pointer_mode_host
+                         && *alpha == static_cast<T>(1);
+        bool beta_zero = handle->pointer_mode == rocsparse_pointer_mode_host
+                         && *beta == static_cast<T>(0);
+
+        if(alpha_one && beta_zero)
         {
-            if(handle->wavefront_size == 32)
-            {
-                if(nnz_per_row < 4)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 8)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 16)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 32)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-            }
-            else if(handle->wavefront_size == 64)
-            {
-                if(nnz_per_row < 4)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 8)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 16)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 32)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 64)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-                else
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 64>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
-                }
-            }
-            else
-            {
-                return rocsparse_status_arch_mismatch;
-            }
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmvn_general_launch<T, T, true, true>(handle,
+                                                                                         m,
+                                                                                         nnz_per_row,
+                                                                                         d_alpha,
+                                                                                         csr_row_ptr,
+                                                                                         csr_col_ind,
+                                                                                         csr_val,
+                                                                                         x,
+                                                                                         d_beta,
+                                                                                         y,
+                                                                                         descr->base)));
+        }
+        else if(beta_zero)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmvn_general_launch<T, T, false, true>(handle,
+                                                                                          m,
+                                                                                          nnz_per_row,
+                                                                                          d_alpha,
+                                                                                          csr_row_ptr,
+                                                                                          csr_col_ind,
+                                                                                          csr_val,
+                                                                                          x,
+                                                                                          d_beta,
+                                                                                          y,
+                                                                                          descr->base)));
+        }
+        else if(alpha_one)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmvn_general_launch<T, T, true, false>(handle,
+                                                                                          m,
+                                                                                          nnz_per_row,
+                                                                                          d_alpha,
+                                                                                          csr_row_ptr,
+                                                                                          csr_col_ind,
+                                                                                          csr_val,
+                                                                                          x,
+                                                                                          d_beta,
+                                                                                          y,
+                                                                                          descr->base)));
         }
         else
         {
-            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmvn_general_launch<T, T, false, false>(handle,
+                                                                                           m,
+                                                                                           nnz_per_row,
+                                                                                           d_alpha,
+                                                                                           csr_row_ptr,
+                                                                                           csr_col_ind,
+                                                                                           csr_val,
+                                                                                           x,
+                                                                                           d_beta,
+                                                                                           y,
+                                                                                           descr->base)));
+        }
+    }
+    else
+    {
+        // Transposed and conjugate transposed SpMV scatter into y, thus
+        // y has to be scaled by beta in advance. The conjugate transposed
+        // kernels conjugate each stored entry on the fly.
+#define CSRMVT_DIM 256
+        dim3 csrmvt_blocks((m - 1) / (CSRMVT_DIM / handle->wavefront_size) + 1);
+        dim3 csrmvt_threads(CSRMVT_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        // Scale y with beta
+        hipLaunchKernelGGL((csrmv_scale_kernel<T>),
+                           dim3((n - 1) / 1024 + 1),
+                           dim3(1024),
+                           0,
+                           stream,
+                           n,
+                           d_beta,
+                           y);
+
+#define LAUNCH_CSRMVT_GENERAL(wfsize, conj)                        \
+    hipLaunchKernelGGL((csrmvt_general_kernel<T, wfsize, conj>),   \
+                       csrmvt_blocks,                              \
+                       csrmvt_threads,                             \
+                       0,                                          \
+                       stream,                                     \
+                       m,                                          \
+                       d_alpha,                                    \
+                       csr_row_ptr,                                \
+                       csr_col_ind,                                \
+                       csr_val,                                    \
+                       x,                                          \
+                       y,                                          \
+                       descr->base)
+
+        bool conj = (trans == rocsparse_operation_conjugate_transpose);
+
+        if(handle->wavefront_size == 32)
+        {
+            if(conj)
             {
-                return rocsparse_status_success;
+                LAUNCH_CSRMVT_GENERAL(32, true);
             }
-
-            if(handle->wavefront_size == 32)
+            else
             {
-                if(nnz_per_row < 4)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 8)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 16)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 32)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
+                LAUNCH_CSRMVT_GENERAL(32, false);
             }
-            else if(handle->wavefront_size == 64)
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            if(conj)
             {
-                if(nnz_per_row < 4)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 8)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 16)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 32)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else if(nnz_per_row < 64)
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
-                else
-                {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 64>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
-                }
+                LAUNCH_CSRMVT_GENERAL(64, true);
             }
             else
             {
-                return rocsparse_status_arch_mismatch;
+                LAUNCH_CSRMVT_GENERAL(64, false);
             }
         }
-#undef CSRMVN_DIM
-    }
-    else
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+#undef LAUNCH_CSRMVT_GENERAL
+#undef CSRMVT_DIM
     }
     return rocsparse_status_success;
 }
@@ -1160,60 +2518,4350 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // If the analysis step selected the merge path kernel, run it instead
+    if(info->data->use_merge_path)
+    {
+        return rocsparse_csrmv_merge_template(
+            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+
+    // If the analysis step bucketed the rows by length, run the binned
+    // general kernels instead
+    if(info->data->use_binned_path)
+    {
+        return rocsparse_csrmv_binned_template(handle,
+                                               trans,
+                                               m,
+                                               n,
+                                               nnz,
+                                               alpha,
+                                               descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               info,
+                                               x,
+                                               beta,
+                                               y);
+    }
+
+    // If the analysis step split the rows into column panels, run the
+    // column blocked kernels instead
+    if(info->data->use_col_blocked)
+    {
+        return rocsparse_csrmv_colblock_template(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 alpha,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 info,
+                                                 x,
+                                                 beta,
+                                                 y);
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
     // Run different csrmv kernels
     if(trans == rocsparse_operation_none)
     {
-        dim3 csrmvn_blocks((info->size / 2) - 1);
-        dim3 csrmvn_threads(WG_SIZE);
+        dim3 csrmvn_blocks((info->data->size / 2) - 1);
+        dim3 csrmvn_threads(csrmv_adaptive_wg_size(info->data->tuning));
 
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
         {
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_device_pointer<T>),
-                               csrmvn_blocks,
-                               csrmvn_threads,
-                               0,
-                               stream,
-                               info->row_blocks,
-                               alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               beta,
-                               y,
-                               descr->base);
+            return rocsparse_status_success;
         }
-        else
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        unsigned long long* row_blocks_ptr = info->data->row_blocks;
+
+        // Deterministic mode: the workgroups of a long row write their
+        // partial sums to fixed slots instead of atomically updating y, an
+        // ordered fix-up pass combines the slots afterwards
+        T* wg_partials = nullptr;
+
+        if(handle->atomics_mode == rocsparse_atomics_not_allowed)
         {
-            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->buffer_alloc(sizeof(T) * csrmvn_blocks.x, (void**)&wg_partials));
+        }
+
+#define CSRMVN_FIXUP_DIM 256
+#define LAUNCH_CSRMVN_ADAPTIVE_FIXUP()                                          \
+    hipLaunchKernelGGL((csrmvn_adaptive_fixup_kernel<T>),                       \
+                       dim3((csrmvn_blocks.x - 1) / CSRMVN_FIXUP_DIM + 1),      \
+                       dim3(CSRMVN_FIXUP_DIM),                                  \
+                       0,                                                       \
+                       stream,                                                  \
+                       (rocsparse_int)csrmvn_blocks.x,                          \
+                       row_blocks_ptr,                                          \
+                       wg_partials,                                             \
+                       d_beta,                                                  \
+                       y)
+
+#define LAUNCH_CSRMVN_ADAPTIVE(VARIANT, J, col_ind)                             \
+    hipLaunchKernelGGL((csrmvn_adaptive_kernel<T, T, J, VARIANT>),              \
+                       csrmvn_blocks,                                           \
+                       csrmvn_threads,                                          \
+                       0,                                                       \
+                       stream,                                                  \
+                       row_blocks_ptr,                                          \
+                       d_alpha,                                                 \
+                       csr_row_ptr,                                             \
+                       col_ind,                                                 \
+                       csr_val,                                                 \
+                       x,                                                       \
+                       d_beta,                                                  \
+                       y,                                                       \
+                       wg_partials,                                             \
+                       descr->base)
+
+        // Use the delta compressed column indices if the analysis step
+        // built them
+        if(info->data->col_delta != nullptr)
+        {
+            csrmv_delta_cols delta_cols = {info->data->col_base, info->data->col_delta};
+
+            switch(info->data->tuning)
             {
-                return rocsparse_status_success;
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE(1, csrmv_delta_cols, delta_cols);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE(2, csrmv_delta_cols, delta_cols);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE(3, csrmv_delta_cols, delta_cols);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE(0, csrmv_delta_cols, delta_cols);
+                break;
             }
 
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_host_pointer<T>),
-                               csrmvn_blocks,
-                               csrmvn_threads,
-                               0,
-                               stream,
-                               info->row_blocks,
-                               *alpha,
-                               csr_row_ptr,
-                               csr_col_ind,
-                               csr_val,
-                               x,
-                               *beta,
-                               y,
-                               descr->base);
+            if(wg_partials != nullptr)
+            {
+                LAUNCH_CSRMVN_ADAPTIVE_FIXUP();
+
+                RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(wg_partials));
+            }
+
+            return rocsparse_status_success;
         }
-    }
-    else
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
+
+#if defined(rocsparse_ILP64)
+        // Use the narrowed 32-bit column indices if the analysis step
+        // built them
+        if(info->data->csr_col_ind_narrow != nullptr)
+        {
+            switch(info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE(1, const int32_t*, info->data->csr_col_ind_narrow);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE(2, const int32_t*, info->data->csr_col_ind_narrow);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE(3, const int32_t*, info->data->csr_col_ind_narrow);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE(0, const int32_t*, info->data->csr_col_ind_narrow);
+                break;
+            }
+
+            if(wg_partials != nullptr)
+            {
+                LAUNCH_CSRMVN_ADAPTIVE_FIXUP();
+
+                RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(wg_partials));
+            }
+
+            return rocsparse_status_success;
+        }
+#endif
+
+        // Oversubscribed managed matrices run panel by panel, with the
+        // prefetch of the next panel overlapping the compute of the
+        // current one. The fix-up pass of the deterministic mode requires the
+        // partial slots of the whole grid, such matrices run unsplit there
+        rocsparse_int num_panels
+            = (info->data->oversubscribed && wg_partials == nullptr) ? info->data->num_panels : 1;
+
+        if(num_panels > 1)
+        {
+            if(handle->prefetch_stream == nullptr)
+            {
+                RETURN_IF_HIP_ERROR(
+                    hipStreamCreateWithFlags(&handle->prefetch_stream, hipStreamNonBlocking));
+                RETURN_IF_HIP_ERROR(
+                    hipEventCreateWithFlags(&handle->prefetch_done, hipEventDisableTiming));
+            }
+
+            // The first panel is prefetched on the compute stream, such
+            // that the kernel is ordered behind it
+            RETURN_IF_HIP_ERROR(hipMemPrefetchAsync(
+                csr_val, sizeof(T) * info->data->panel_nnz[1], handle->device, stream));
+            RETURN_IF_HIP_ERROR(hipMemPrefetchAsync(csr_col_ind,
+                                                    sizeof(rocsparse_int) * info->data->panel_nnz[1],
+                                                    handle->device,
+                                                    stream));
+        }
+
+        for(rocsparse_int panel = 0; panel < num_panels; ++panel)
+        {
+            if(num_panels > 1)
+            {
+                if(panel > 0)
+                {
+                    // The compute of this panel must not start before its
+                    // prefetch has finished
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, handle->prefetch_done, 0));
+                }
+
+                if(panel + 1 < num_panels)
+                {
+                    rocsparse_int begin = info->data->panel_nnz[panel + 1];
+                    rocsparse_int end   = info->data->panel_nnz[panel + 2];
+
+                    RETURN_IF_HIP_ERROR(hipMemPrefetchAsync(csr_val + begin,
+                                                            sizeof(T) * (end - begin),
+                                                            handle->device,
+                                                            handle->prefetch_stream));
+                    RETURN_IF_HIP_ERROR(hipMemPrefetchAsync(csr_col_ind + begin,
+                                                            sizeof(rocsparse_int) * (end - begin),
+                                                            handle->device,
+                                                            handle->prefetch_stream));
+                    RETURN_IF_HIP_ERROR(
+                        hipEventRecord(handle->prefetch_done, handle->prefetch_stream));
+                }
+
+                csrmvn_blocks = dim3(info->data->panel_block[panel + 1]
+                                     - info->data->panel_block[panel]);
+                row_blocks_ptr = info->data->row_blocks + info->data->panel_block[panel];
+            }
+
+            switch(info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE(1, const rocsparse_int*, csr_col_ind);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE(2, const rocsparse_int*, csr_col_ind);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE(3, const rocsparse_int*, csr_col_ind);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE(0, const rocsparse_int*, csr_col_ind);
+                break;
+            }
+        }
+
+        if(wg_partials != nullptr)
+        {
+            LAUNCH_CSRMVN_ADAPTIVE_FIXUP();
+
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(wg_partials));
+        }
+#undef LAUNCH_CSRMVN_ADAPTIVE
+#undef LAUNCH_CSRMVN_ADAPTIVE_FIXUP
+#undef CSRMVN_FIXUP_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+// Online kernel selection. The analysis heuristics choose well for most
+// sparsity patterns, but a slice of matrices ends up on the slower of the
+// available kernels. With probing enabled, the first calls for an
+// analyzed matrix alternate between the analyzed kernel and the general
+// kernel under event timing, and the faster one is locked in once both
+// have been timed csrmv_probe_calls times. The event synchronization
+// serializes the probe calls, amortized over the subsequent calls that
+// run the winner directly this is noise
+template <typename T>
+rocsparse_status rocsparse_csrmv_probe_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_csrmv_info      info,
+                                                const T*                  x,
+                                                const T*                  beta,
+                                                T*                        y)
+{
+    _rocsparse_csrmv_analysis_data* data = info->data;
+
+    // The general kernel won the probe
+    if(data->probe_winner == 1)
+    {
+        return rocsparse_csrmv_general_template(
+            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+
+    // Alternate the candidates over the probe calls
+    int candidate = data->probe_call % 2;
+
+    hipEvent_t probe_start;
+    hipEvent_t probe_stop;
+
+    RETURN_IF_HIP_ERROR(hipEventCreate(&probe_start));
+    RETURN_IF_HIP_ERROR(hipEventCreate(&probe_stop));
+
+    RETURN_IF_HIP_ERROR(hipEventRecord(probe_start, handle->stream));
+
+    rocsparse_status status;
+    if(candidate == 0)
+    {
+        status = rocsparse_csrmv_adaptive_template(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   info,
+                                                   x,
+                                                   beta,
+                                                   y);
+    }
+    else
+    {
+        status = rocsparse_csrmv_general_template(
+            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+
+    if(status != rocsparse_status_success)
+    {
+        PRINT_IF_HIP_ERROR(hipEventDestroy(probe_start));
+        PRINT_IF_HIP_ERROR(hipEventDestroy(probe_stop));
+
+        return status;
+    }
+
+    RETURN_IF_HIP_ERROR(hipEventRecord(probe_stop, handle->stream));
+    RETURN_IF_HIP_ERROR(hipEventSynchronize(probe_stop));
+
+    float elapsed;
+    RETURN_IF_HIP_ERROR(hipEventElapsedTime(&elapsed, probe_start, probe_stop));
+
+    RETURN_IF_HIP_ERROR(hipEventDestroy(probe_start));
+    RETURN_IF_HIP_ERROR(hipEventDestroy(probe_stop));
+
+    data->probe_time[candidate] += elapsed;
+
+    // Lock in the faster candidate once both have been timed often enough.
+    // Ties keep the analyzed kernel
+    if(++data->probe_call == 2 * csrmv_probe_calls)
+    {
+        data->probe_winner = (data->probe_time[0] <= data->probe_time[1]) ? 0 : 1;
+    }
+
+    return rocsparse_status_success;
+}
+
+// The matrix values are stored in type A and computed in type T, analogous
+// to the general kernels; the uniform precision path instantiates A == T
+template <typename A, typename T>
+rocsparse_status rocsparse_csrmv_binned_template(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const T*                  alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const A*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_csrmv_info      info,
+                                                 const T*                  x,
+                                                 const T*                  beta,
+                                                 T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different csrmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define CSRMVN_BINNED_DIM 256
+        if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        _rocsparse_csrmv_analysis_data* data = info->data;
+
+        // One kernel per non-empty bin. Every row belongs to exactly one
+        // bin, hence each kernel carries the full beta update for its rows
+        if(data->bin_size[0] > 0)
+        {
+            // Thread per row bin
+            hipLaunchKernelGGL((csrmvn_binned_kernel<A, T, 1>),
+                               dim3((data->bin_size[0] - 1) / CSRMVN_BINNED_DIM + 1),
+                               dim3(CSRMVN_BINNED_DIM),
+                               0,
+                               stream,
+                               data->bin_size[0],
+                               data->bin_rows,
+                               d_alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               d_beta,
+                               y,
+                               descr->base);
+        }
+
+#define LAUNCH_CSRMVN_BINNED(WF_SIZE, bin)                                              \
+    hipLaunchKernelGGL((csrmvn_binned_kernel<A, T, WF_SIZE>),                           \
+                       dim3((data->bin_size[bin] * WF_SIZE - 1) / CSRMVN_BINNED_DIM + 1), \
+                       dim3(CSRMVN_BINNED_DIM),                                         \
+                       0,                                                               \
+                       stream,                                                          \
+                       data->bin_size[bin],                                             \
+                       data->bin_rows + data->bin_size[0]                               \
+                           + (bin == 2 ? data->bin_size[1] : 0),                        \
+                       d_alpha,                                                         \
+                       csr_row_ptr,                                                     \
+                       csr_col_ind,                                                     \
+                       csr_val,                                                         \
+                       x,                                                               \
+                       d_beta,                                                          \
+                       y,                                                               \
+                       descr->base)
+
+        if(handle->wavefront_size == 32)
+        {
+            if(data->bin_size[1] > 0)
+            {
+                // Quarter wavefront per row bin
+                LAUNCH_CSRMVN_BINNED(8, 1);
+            }
+            if(data->bin_size[2] > 0)
+            {
+                // Wavefront per row bin
+                LAUNCH_CSRMVN_BINNED(32, 2);
+            }
+        }
+        else
+        {
+            if(data->bin_size[1] > 0)
+            {
+                // Quarter wavefront per row bin
+                LAUNCH_CSRMVN_BINNED(16, 1);
+            }
+            if(data->bin_size[2] > 0)
+            {
+                // Wavefront per row bin
+                LAUNCH_CSRMVN_BINNED(64, 2);
+            }
+        }
+#undef LAUNCH_CSRMVN_BINNED
+#undef CSRMVN_BINNED_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+// Column blocked SpMV. The rows have been pre-split into column panels at
+// analysis time, the panels run back to back on the same stream, such that
+// each launch only gathers from an L2 sized slice of x. The matrix values
+// are stored in type A and computed in type T, analogous to the general
+// kernels
+template <typename A, typename T>
+rocsparse_status rocsparse_csrmv_colblock_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const A*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_csrmv_info      info,
+                                                   const T*                  x,
+                                                   const T*                  beta,
+                                                   T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different csrmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define CSRMVN_COLBLOCK_DIM 256
+        if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        _rocsparse_csrmv_analysis_data* data = info->data;
+
+        // The panel passes only accumulate into y, apply beta upfront over
+        // the full vector
+        hipLaunchKernelGGL((csrmv_scale_kernel<T>),
+                           dim3((m - 1) / CSRMVN_COLBLOCK_DIM + 1),
+                           dim3(CSRMVN_COLBLOCK_DIM),
+                           0,
+                           stream,
+                           m,
+                           d_beta,
+                           y);
+
+#define LAUNCH_CSRMVN_COLBLOCK(WF_SIZE)                                                 \
+    hipLaunchKernelGGL((csrmvn_colblock_kernel<A, T, WF_SIZE>),                         \
+                       dim3((nsect * WF_SIZE - 1) / CSRMVN_COLBLOCK_DIM + 1),           \
+                       dim3(CSRMVN_COLBLOCK_DIM),                                       \
+                       0,                                                               \
+                       stream,                                                          \
+                       nsect,                                                           \
+                       data->col_panel_rows + data->col_panel_ptr[panel],               \
+                       data->col_panel_begin + data->col_panel_ptr[panel],              \
+                       col_end,                                                         \
+                       d_alpha,                                                         \
+                       csr_row_ptr,                                                     \
+                       csr_col_ind,                                                     \
+                       csr_val,                                                         \
+                       x,                                                               \
+                       y,                                                               \
+                       descr->base)
+
+        // One launch per non-empty column panel; every row panel
+        // intersection belongs to exactly one launch
+        for(rocsparse_int panel = 0; panel < data->num_col_panels; ++panel)
+        {
+            rocsparse_int nsect = data->col_panel_ptr[panel + 1] - data->col_panel_ptr[panel];
+
+            if(nsect == 0)
+            {
+                continue;
+            }
+
+            rocsparse_int col_begin = panel * csrmv_col_panel_width;
+            rocsparse_int col_end
+                = (n - col_begin < csrmv_col_panel_width) ? n : col_begin + csrmv_col_panel_width;
+
+            if(handle->wavefront_size == 32)
+            {
+                LAUNCH_CSRMVN_COLBLOCK(32);
+            }
+            else
+            {
+                LAUNCH_CSRMVN_COLBLOCK(64);
+            }
+        }
+#undef LAUNCH_CSRMVN_COLBLOCK
+#undef CSRMVN_COLBLOCK_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+// Masked SpMV, computing only the rows listed in mask_row_ind. The mask
+// indirection reuses the row list machinery of the binned path, such that
+// the matrix traffic of unlisted rows is skipped entirely and their y
+// entries remain untouched
+template <typename T>
+rocsparse_status rocsparse_csrmv_masked_template(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 rocsparse_int             num_masked,
+                                                 const rocsparse_int*      mask_row_ind,
+                                                 const T*                  alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const T*                  x,
+                                                 const T*                  beta,
+                                                 T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_masked"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  num_masked,
+                  (const void*&)mask_row_ind,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_masked"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  num_masked,
+                  (const void*&)mask_row_ind,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // The transposed product scatters into unlisted rows of y, which
+    // contradicts the mask semantics
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(num_masked < 0 || num_masked > m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0 || num_masked == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(mask_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+#define CSRMVN_MASKED_DIM 256
+    // Select the wavefront fraction per row as in the general kernel. The
+    // average row length of the full matrix stands in for the masked rows,
+    // whose lengths are not known on the host
+    rocsparse_int nnz_per_row = nnz / m;
+
+    rocsparse_int wf_size;
+
+    if(nnz_per_row < 4)
+    {
+        wf_size = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wf_size = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wf_size = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wf_size = 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        wf_size = 32;
+    }
+    else
+    {
+        wf_size = 64;
+    }
+
+#define LAUNCH_CSRMVN_MASKED(WF_SIZE)                                                  \
+    hipLaunchKernelGGL((csrmvn_masked_kernel<T, T, WF_SIZE>),                          \
+                       dim3((num_masked * WF_SIZE - 1) / CSRMVN_MASKED_DIM + 1),       \
+                       dim3(CSRMVN_MASKED_DIM),                                        \
+                       0,                                                              \
+                       stream,                                                         \
+                       num_masked,                                                     \
+                       mask_row_ind,                                                   \
+                       d_alpha,                                                        \
+                       csr_row_ptr,                                                    \
+                       csr_col_ind,                                                    \
+                       csr_val,                                                        \
+                       x,                                                              \
+                       d_beta,                                                         \
+                       y,                                                              \
+                       descr->base)
+
+    if(wf_size == 2)
+    {
+        LAUNCH_CSRMVN_MASKED(2);
+    }
+    else if(wf_size == 4)
+    {
+        LAUNCH_CSRMVN_MASKED(4);
+    }
+    else if(wf_size == 8)
+    {
+        LAUNCH_CSRMVN_MASKED(8);
+    }
+    else if(wf_size == 16)
+    {
+        LAUNCH_CSRMVN_MASKED(16);
+    }
+    else if(wf_size == 32)
+    {
+        LAUNCH_CSRMVN_MASKED(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_MASKED(64);
+    }
+#undef LAUNCH_CSRMVN_MASKED
+#undef CSRMVN_MASKED_DIM
+
+    return rocsparse_status_success;
+}
+
+// Launch helper of the epilogue fused csrmvn kernel, selecting the
+// wavefront size by the average number of non-zeros per row as in the
+// general kernel
+template <typename T, bool DIAG, bool SUB, bool CLAMP>
+static rocsparse_status rocsparse_csrmvn_epilogue_launch(rocsparse_handle     handle,
+                                                         rocsparse_int        m,
+                                                         rocsparse_int        nnz_per_row,
+                                                         const T*             alpha,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         const T*             csr_val,
+                                                         const T*             x,
+                                                         const T*             beta,
+                                                         T*                   y,
+                                                         const T*             diag,
+                                                         const T*             vec,
+                                                         const T*             clamp_lo,
+                                                         const T*             clamp_hi,
+                                                         rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMVN_EPILOGUE_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_EPILOGUE_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_EPILOGUE_DIM);
+
+    rocsparse_int wf_size;
+
+    if(nnz_per_row < 4)
+    {
+        wf_size = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wf_size = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wf_size = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wf_size = 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        wf_size = 32;
+    }
+    else
+    {
+        wf_size = 64;
+    }
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+#define LAUNCH_CSRMVN_EPILOGUE(wfsize)                                                 \
+    hipLaunchKernelGGL((csrmvn_epilogue_kernel<T, T, wfsize, DIAG, SUB, CLAMP>),       \
+                       csrmvn_blocks,                                                  \
+                       csrmvn_threads,                                                 \
+                       0,                                                              \
+                       stream,                                                         \
+                       m,                                                              \
+                       alpha,                                                          \
+                       csr_row_ptr,                                                    \
+                       csr_col_ind,                                                    \
+                       csr_val,                                                        \
+                       x,                                                              \
+                       beta,                                                           \
+                       y,                                                              \
+                       diag,                                                           \
+                       vec,                                                            \
+                       clamp_lo,                                                       \
+                       clamp_hi,                                                       \
+                       idx_base)
+
+    if(wf_size == 2)
+    {
+        LAUNCH_CSRMVN_EPILOGUE(2);
+    }
+    else if(wf_size == 4)
+    {
+        LAUNCH_CSRMVN_EPILOGUE(4);
+    }
+    else if(wf_size == 8)
+    {
+        LAUNCH_CSRMVN_EPILOGUE(8);
+    }
+    else if(wf_size == 16)
+    {
+        LAUNCH_CSRMVN_EPILOGUE(16);
+    }
+    else if(wf_size == 32)
+    {
+        LAUNCH_CSRMVN_EPILOGUE(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_EPILOGUE(64);
+    }
+#undef LAUNCH_CSRMVN_EPILOGUE
+#undef CSRMVN_EPILOGUE_DIM
+
+    return rocsparse_status_success;
+}
+
+// SpMV with a fused elementwise epilogue on y, replacing the follow-up
+// elementwise kernel and its extra read and write of y. Composed epilogues
+// are applied in the order diagonal scale, vector subtract, clamp
+template <typename T>
+rocsparse_status rocsparse_csrmv_epilogue_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const T*                  x,
+                                                   const T*                  beta,
+                                                   T*                        y,
+                                                   rocsparse_epilogue        epilogue,
+                                                   const T*                  diag,
+                                                   const T*                  vec,
+                                                   const T*                  clamp_lo,
+                                                   const T*                  clamp_hi)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_epilogue"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y,
+                  epilogue,
+                  (const void*&)diag,
+                  (const void*&)vec,
+                  (const void*&)clamp_lo,
+                  (const void*&)clamp_hi);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_epilogue"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  epilogue,
+                  (const void*&)diag,
+                  (const void*&)vec,
+                  (const void*&)clamp_lo,
+                  (const void*&)clamp_hi);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check the epilogue selection
+    if(epilogue
+       & ~(rocsparse_epilogue_diag_scale | rocsparse_epilogue_vector_sub
+           | rocsparse_epilogue_clamp))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    bool diag_on  = (epilogue & rocsparse_epilogue_diag_scale) != 0;
+    bool sub_on   = (epilogue & rocsparse_epilogue_vector_sub) != 0;
+    bool clamp_on = (epilogue & rocsparse_epilogue_clamp) != 0;
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(diag_on && diag == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sub_on && vec == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(clamp_on && (clamp_lo == nullptr || clamp_hi == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes. No early out for alpha == 0 and beta == 1, the
+    // epilogue has to be applied in any case
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    // The clamp bounds are staged through the same ring, such that the
+    // kernel reads all scalars from device memory in both pointer modes
+    const T* d_clamp_lo = d_alpha;
+    const T* d_clamp_hi = d_alpha;
+
+    if(clamp_on)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->stage_scalars(clamp_lo, clamp_hi, &d_clamp_lo, &d_clamp_hi));
+    }
+
+    rocsparse_int nnz_per_row = nnz / m;
+
+#define DISPATCH_CSRMVN_EPILOGUE(D, S, C)                                                        \
+    rocsparse_csrmvn_epilogue_launch<T, D, S, C>(handle,                                         \
+                                                 m,                                              \
+                                                 nnz_per_row,                                    \
+                                                 d_alpha,                                        \
+                                                 csr_row_ptr,                                    \
+                                                 csr_col_ind,                                    \
+                                                 csr_val,                                        \
+                                                 x,                                              \
+                                                 d_beta,                                         \
+                                                 y,                                              \
+                                                 diag,                                           \
+                                                 vec,                                            \
+                                                 d_clamp_lo,                                     \
+                                                 d_clamp_hi,                                     \
+                                                 descr->base)
+
+    if(diag_on)
+    {
+        if(sub_on)
+        {
+            return clamp_on ? DISPATCH_CSRMVN_EPILOGUE(true, true, true)
+                            : DISPATCH_CSRMVN_EPILOGUE(true, true, false);
+        }
+        else
+        {
+            return clamp_on ? DISPATCH_CSRMVN_EPILOGUE(true, false, true)
+                            : DISPATCH_CSRMVN_EPILOGUE(true, false, false);
+        }
+    }
+    else
+    {
+        if(sub_on)
+        {
+            return clamp_on ? DISPATCH_CSRMVN_EPILOGUE(false, true, true)
+                            : DISPATCH_CSRMVN_EPILOGUE(false, true, false);
+        }
+        else
+        {
+            return clamp_on ? DISPATCH_CSRMVN_EPILOGUE(false, false, true)
+                            : DISPATCH_CSRMVN_EPILOGUE(false, false, false);
+        }
+    }
+#undef DISPATCH_CSRMVN_EPILOGUE
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  x,
+                                                const T*                  beta,
+                                                T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different csrmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define CSRMVN_MERGE_DIM 128
+        rocsparse_int maxthreads = handle->properties.maxThreadsPerBlock;
+        rocsparse_int nprocs     = handle->properties.multiProcessorCount;
+        rocsparse_int maxblocks  = (nprocs * maxthreads - 1) / CSRMVN_MERGE_DIM + 1;
+        rocsparse_int minblocks  = (nnz - 1) / CSRMVN_MERGE_DIM + 1;
+
+        rocsparse_int nblocks = maxblocks < minblocks ? maxblocks : minblocks;
+        rocsparse_int nwfs    = nblocks * (CSRMVN_MERGE_DIM / handle->wavefront_size);
+        rocsparse_int nloops  = (nnz / handle->wavefront_size + 1) / nwfs + 1;
+
+        dim3 csrmvn_blocks(nblocks);
+        dim3 csrmvn_threads(CSRMVN_MERGE_DIM);
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+        // Buffer
+        char* ptr = reinterpret_cast<char*>(handle->buffer);
+        ptr += 256;
+
+        // row block reduction buffer
+        rocsparse_int* row_block_red = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += ((sizeof(rocsparse_int) * nwfs - 1) / 256 + 1) * 256;
+
+        // val block reduction buffer
+        T* val_block_red = reinterpret_cast<T*>(ptr);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        // Scale y with beta
+        hipLaunchKernelGGL((csrmv_scale_kernel<T>),
+                           dim3((m - 1) / 1024 + 1),
+                           dim3(1024),
+                           0,
+                           stream,
+                           m,
+                           d_beta,
+                           y);
+
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrmvn_merge_kernel<T, CSRMVN_MERGE_DIM, 32>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               stream,
+                               m,
+                               nnz,
+                               nloops,
+                               d_alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               row_block_red,
+                               val_block_red,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrmvn_merge_kernel<T, CSRMVN_MERGE_DIM, 64>),
+                               csrmvn_blocks,
+                               csrmvn_threads,
+                               0,
+                               stream,
+                               m,
+                               nnz,
+                               nloops,
+                               d_alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               row_block_red,
+                               val_block_red,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        hipLaunchKernelGGL((csrmvn_merge_block_reduce<T, CSRMVN_MERGE_DIM>),
+                           dim3(1),
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           nwfs,
+                           row_block_red,
+                           val_block_red,
+                           y);
+#undef CSRMVN_MERGE_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+template <typename T, rocsparse_int NRHS>
+static rocsparse_status rocsparse_csrmv_multi_launch(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const T*                  x,
+                                                     rocsparse_int             ldx,
+                                                     const T*                  beta,
+                                                     T*                        y,
+                                                     rocsparse_int             ldy)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMVN_MULTI_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_MULTI_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_MULTI_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrmvn_general_multi_kernel<T, NRHS, 32>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           ldx,
+                           d_beta,
+                           y,
+                           ldy,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_general_multi_kernel<T, NRHS, 64>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           ldx,
+                           d_beta,
+                           y,
+                           ldy,
+                           descr->base);
+    }
+#undef CSRMVN_MULTI_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_multi_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                rocsparse_int             nrhs,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  x,
+                                                rocsparse_int             ldx,
+                                                const T*                  beta,
+                                                T*                        y,
+                                                rocsparse_int             ldy)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_multi"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  nrhs,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  ldx,
+                  *beta,
+                  (const void*&)y,
+                  ldy);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_multi"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  nrhs,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  ldx,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  ldy);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldx < n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldy < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0 || nrhs == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Process the right-hand sides in batches of up to 8 vectors, which are
+    // held in registers while the matrix is streamed once per batch
+    rocsparse_int done = 0;
+
+    while(nrhs - done > 0)
+    {
+        rocsparse_int batch = nrhs - done;
+
+        const T* xb = x + done * ldx;
+        T*       yb = y + done * ldy;
+
+        if(batch >= 8)
+        {
+            batch = 8;
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_multi_launch<T, 8>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, xb, ldx, beta, yb, ldy)));
+        }
+        else if(batch == 7)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_multi_launch<T, 7>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, xb, ldx, beta, yb, ldy)));
+        }
+        else if(batch == 6)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_multi_launch<T, 6>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, xb, ldx, beta, yb, ldy)));
+        }
+        else if(batch == 5)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_multi_launch<T, 5>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, xb, ldx, beta, yb, ldy)));
+        }
+        else if(batch == 4)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_multi_launch<T, 4>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, xb, ldx, beta, yb, ldy)));
+        }
+        else if(batch == 3)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_multi_launch<T, 3>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, xb, ldx, beta, yb, ldy)));
+        }
+        else if(batch == 2)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_multi_launch<T, 2>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, xb, ldx, beta, yb, ldy)));
+        }
+        else
+        {
+            // Single remaining vector
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template<T>(handle,
+                                                                  trans,
+                                                                  m,
+                                                                  n,
+                                                                  nnz,
+                                                                  alpha,
+                                                                  descr,
+                                                                  csr_val,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  nullptr,
+                                                                  xb,
+                                                                  beta,
+                                                                  yb));
+        }
+
+        done += batch;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Launch helper of the semiring kernel, selecting the wavefront size by
+// the average number of non-zeros per row like the general path
+template <typename T, typename SEMIRING>
+static rocsparse_status rocsparse_csrmvn_semiring_launch(rocsparse_handle     handle,
+                                                         rocsparse_int        m,
+                                                         rocsparse_int        nnz_per_row,
+                                                         const T*             alpha,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         const T*             csr_val,
+                                                         const T*             x,
+                                                         const T*             beta,
+                                                         T*                   y,
+                                                         rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMVN_SEMIRING_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_SEMIRING_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_SEMIRING_DIM);
+
+    rocsparse_int wf_size;
+
+    if(nnz_per_row < 4)
+    {
+        wf_size = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wf_size = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wf_size = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wf_size = 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        wf_size = 32;
+    }
+    else
+    {
+        wf_size = 64;
+    }
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+#define LAUNCH_CSRMVN_SEMIRING(wfsize)                                                 \
+    hipLaunchKernelGGL((csrmvn_semiring_kernel<T, SEMIRING, wfsize>),                  \
+                       csrmvn_blocks,                                                  \
+                       csrmvn_threads,                                                 \
+                       0,                                                              \
+                       stream,                                                         \
+                       m,                                                              \
+                       alpha,                                                          \
+                       csr_row_ptr,                                                    \
+                       csr_col_ind,                                                    \
+                       csr_val,                                                        \
+                       x,                                                              \
+                       beta,                                                           \
+                       y,                                                              \
+                       idx_base)
+
+    if(wf_size == 2)
+    {
+        LAUNCH_CSRMVN_SEMIRING(2);
+    }
+    else if(wf_size == 4)
+    {
+        LAUNCH_CSRMVN_SEMIRING(4);
+    }
+    else if(wf_size == 8)
+    {
+        LAUNCH_CSRMVN_SEMIRING(8);
+    }
+    else if(wf_size == 16)
+    {
+        LAUNCH_CSRMVN_SEMIRING(16);
+    }
+    else if(wf_size == 32)
+    {
+        LAUNCH_CSRMVN_SEMIRING(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_SEMIRING(64);
+    }
+#undef LAUNCH_CSRMVN_SEMIRING
+#undef CSRMVN_SEMIRING_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_semiring_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const T*                  x,
+                                                   const T*                  beta,
+                                                   T*                        y,
+                                                   rocsparse_semiring        semiring)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_semiring"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y,
+                  semiring);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_semiring"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  semiring);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Conventional arithmetic runs through the tuned csrmv path
+    if(semiring == rocsparse_semiring_plus_times)
+    {
+        return rocsparse_csrmv_template<T>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           nullptr,
+                                           x,
+                                           beta,
+                                           y);
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    rocsparse_int nnz_per_row = nnz / m;
+
+    switch(semiring)
+    {
+    case rocsparse_semiring_min_plus:
+        return (rocsparse_csrmvn_semiring_launch<T, csrmv_semiring_min_plus<T>>(handle,
+                                                                                m,
+                                                                                nnz_per_row,
+                                                                                d_alpha,
+                                                                                csr_row_ptr,
+                                                                                csr_col_ind,
+                                                                                csr_val,
+                                                                                x,
+                                                                                d_beta,
+                                                                                y,
+                                                                                descr->base));
+    case rocsparse_semiring_max_times:
+        return (rocsparse_csrmvn_semiring_launch<T, csrmv_semiring_max_times<T>>(handle,
+                                                                                 m,
+                                                                                 nnz_per_row,
+                                                                                 d_alpha,
+                                                                                 csr_row_ptr,
+                                                                                 csr_col_ind,
+                                                                                 csr_val,
+                                                                                 x,
+                                                                                 d_beta,
+                                                                                 y,
+                                                                                 descr->base));
+    case rocsparse_semiring_or_and:
+        return (rocsparse_csrmvn_semiring_launch<T, csrmv_semiring_or_and<T>>(handle,
+                                                                              m,
+                                                                              nnz_per_row,
+                                                                              d_alpha,
+                                                                              csr_row_ptr,
+                                                                              csr_col_ind,
+                                                                              csr_val,
+                                                                              x,
+                                                                              d_beta,
+                                                                              y,
+                                                                              descr->base));
+    default:
+        return rocsparse_status_invalid_value;
+    }
+}
+
+template <typename T, rocsparse_int NBATCH>
+static rocsparse_status rocsparse_csrmv_batched_launch(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       const T*                  alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const T*                  csr_val,
+                                                       rocsparse_int             stride,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       const T*                  x,
+                                                       const T*                  beta,
+                                                       T*                        y,
+                                                       rocsparse_int             stride_y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMVN_BATCHED_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_BATCHED_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_BATCHED_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrmvn_general_batched_kernel<T, NBATCH, 32>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           stride,
+                           x,
+                           d_beta,
+                           y,
+                           stride_y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_general_batched_kernel<T, NBATCH, 64>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           stride,
+                           x,
+                           d_beta,
+                           y,
+                           stride_y,
+                           descr->base);
+    }
+#undef CSRMVN_BATCHED_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_batched_template(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             nnz,
+                                                  rocsparse_int             batch_count,
+                                                  const T*                  alpha,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  rocsparse_int             stride,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  const T*                  x,
+                                                  const T*                  beta,
+                                                  T*                        y,
+                                                  rocsparse_int             stride_y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_batched"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  batch_count,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  stride,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y,
+                  stride_y);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_batched"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  batch_count,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  stride,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  stride_y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_y < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Process the batch members in tiles of up to 8 value arrays, which
+    // are accumulated in registers while the pattern and x are read once
+    // per tile
+    rocsparse_int done = 0;
+
+    while(batch_count - done > 0)
+    {
+        rocsparse_int batch = batch_count - done;
+
+        const T* vb = csr_val + done * stride;
+        T*       yb = y + done * stride_y;
+
+        if(batch >= 8)
+        {
+            batch = 8;
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_batched_launch<T, 8>(
+                handle, m, alpha, descr, vb, stride, csr_row_ptr, csr_col_ind, x, beta, yb, stride_y)));
+        }
+        else if(batch == 7)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_batched_launch<T, 7>(
+                handle, m, alpha, descr, vb, stride, csr_row_ptr, csr_col_ind, x, beta, yb, stride_y)));
+        }
+        else if(batch == 6)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_batched_launch<T, 6>(
+                handle, m, alpha, descr, vb, stride, csr_row_ptr, csr_col_ind, x, beta, yb, stride_y)));
+        }
+        else if(batch == 5)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_batched_launch<T, 5>(
+                handle, m, alpha, descr, vb, stride, csr_row_ptr, csr_col_ind, x, beta, yb, stride_y)));
+        }
+        else if(batch == 4)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_batched_launch<T, 4>(
+                handle, m, alpha, descr, vb, stride, csr_row_ptr, csr_col_ind, x, beta, yb, stride_y)));
+        }
+        else if(batch == 3)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_batched_launch<T, 3>(
+                handle, m, alpha, descr, vb, stride, csr_row_ptr, csr_col_ind, x, beta, yb, stride_y)));
+        }
+        else if(batch == 2)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_batched_launch<T, 2>(
+                handle, m, alpha, descr, vb, stride, csr_row_ptr, csr_col_ind, x, beta, yb, stride_y)));
+        }
+        else
+        {
+            // Single remaining batch member
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template<T>(handle,
+                                                                  trans,
+                                                                  m,
+                                                                  n,
+                                                                  nnz,
+                                                                  alpha,
+                                                                  descr,
+                                                                  vb,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  nullptr,
+                                                                  x,
+                                                                  beta,
+                                                                  yb));
+        }
+
+        done += batch;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_persistent_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     rocsparse_int             niter,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const T*                  x,
+                                                     const T*                  beta,
+                                                     T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_persistent"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  niter,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_persistent"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  niter,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // The iterated operator is only square
+    if(m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(niter < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Zero iterations leave x unchanged
+    if(niter == 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(y, x, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+        return rocsparse_status_success;
+    }
+
+    // Workspace for the ping-pong buffer and the barrier counters
+    T*   tmp;
+    int* count;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(T) * m + sizeof(int) * 2, (void**)&tmp));
+    count = reinterpret_cast<int*>(tmp + m);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(count, 0, sizeof(int) * 2, stream));
+
+#define CSRMV_PERSISTENT_DIM 256
+    // The barrier requires all blocks of the grid to be resident on the
+    // device, limit the grid accordingly
+    rocsparse_int max_blocks = handle->properties.multiProcessorCount * 4;
+    rocsparse_int req_blocks
+        = (m - 1) / (CSRMV_PERSISTENT_DIM / handle->wavefront_size) + 1;
+
+    dim3 csrmv_blocks((req_blocks < max_blocks) ? req_blocks : max_blocks);
+    dim3 csrmv_threads(CSRMV_PERSISTENT_DIM);
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrmvn_persistent_kernel<T, 32>),
+                           csrmv_blocks,
+                           csrmv_threads,
+                           0,
+                           stream,
+                           m,
+                           niter,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           d_beta,
+                           y,
+                           tmp,
+                           count,
+                           count + 1,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_persistent_kernel<T, 64>),
+                           csrmv_blocks,
+                           csrmv_threads,
+                           0,
+                           stream,
+                           m,
+                           niter,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           d_beta,
+                           y,
+                           tmp,
+                           count,
+                           count + 1,
+                           descr->base);
+    }
+#undef CSRMV_PERSISTENT_DIM
+
+    // An even number of iterations leaves the result in the ping-pong buffer
+    if(niter % 2 == 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(y, tmp, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(tmp));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_powers_template(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 rocsparse_int             s,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const T*                  x,
+                                                 T*                        y,
+                                                 rocsparse_int             ldy)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmv_powers"),
+              trans,
+              m,
+              n,
+              nnz,
+              s,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)x,
+              (const void*&)y,
+              ldy);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // The iterated operator is only square
+    if(m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(s < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldy < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || s == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Workspace for the barrier counters
+    int* count;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(int) * 2, (void**)&count));
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(count, 0, sizeof(int) * 2, stream));
+
+#define CSRMV_POWERS_DIM 256
+    // The barrier requires all blocks of the grid to be resident on the
+    // device, limit the grid accordingly
+    rocsparse_int max_blocks = handle->properties.multiProcessorCount * 4;
+    rocsparse_int req_blocks = (m - 1) / (CSRMV_POWERS_DIM / handle->wavefront_size) + 1;
+
+    dim3 csrmv_blocks((req_blocks < max_blocks) ? req_blocks : max_blocks);
+    dim3 csrmv_threads(CSRMV_POWERS_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrmvn_powers_kernel<T, 32>),
+                           csrmv_blocks,
+                           csrmv_threads,
+                           0,
+                           stream,
+                           m,
+                           s,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           ldy,
+                           count,
+                           count + 1,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_powers_kernel<T, 64>),
+                           csrmv_blocks,
+                           csrmv_threads,
+                           0,
+                           stream,
+                           m,
+                           s,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           ldy,
+                           count,
+                           count + 1,
+                           descr->base);
+    }
+#undef CSRMV_POWERS_DIM
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(count));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_polynomial_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     rocsparse_int             degree,
+                                                     const T*                  coeffs,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     const T*                  x,
+                                                     T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmv_polynomial"),
+              trans,
+              m,
+              n,
+              nnz,
+              degree,
+              (const void*&)coeffs,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)x,
+              (const void*&)y);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // The iterated operator is only square
+    if(m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(degree < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(coeffs == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // For a degree zero polynomial or an empty matrix, the result reduces to
+    // the constant term times x
+    if(degree == 0 || nnz == 0)
+    {
+        hipLaunchKernelGGL((csrmv_poly_scale_kernel<T>),
+                           dim3((m - 1) / 1024 + 1),
+                           dim3(1024),
+                           0,
+                           stream,
+                           m,
+                           coeffs[0],
+                           x,
+                           y);
+
+        return rocsparse_status_success;
+    }
+
+    // The fused updates live in the output stage of the adaptive kernel,
+    // meta data from the analysis step is required
+    if(info->csrmv_info == nullptr || info->csrmv_info->data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrmv_info csrmv_info = info->csrmv_info;
+
+    // Check if info matches current matrix and options
+    if(csrmv_info->trans != trans)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csrmv_info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->n != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv_info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csrmv_info->csr_row_ptr != csr_row_ptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrmv_info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The merge path, binned and column blocked kernels do not carry the
+    // fused output stage
+    if(csrmv_info->data->use_merge_path || csrmv_info->data->use_binned_path
+       || csrmv_info->data->use_col_blocked)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Horner evaluation of y = p(A) * x. The leading coefficient is folded
+    // into the first matrix vector product and the remaining terms into the
+    // fused output stages, such that the whole smoother runs in exactly
+    // degree kernel launches
+    //
+    //   v <- c_degree * (A * x) + c_{degree-1} * x
+    //   v <- A * v + c_k * x    for k = degree - 2, ..., 0
+
+    // Intermediates ping-pong between y and a temporary vector, laid out
+    // such that the last launch writes y and no launch reads its own output
+    T* tmp = nullptr;
+
+    if(degree > 1)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(T) * m, (void**)&tmp));
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(tmp, 0, sizeof(T) * m, stream));
+    }
+
+    dim3 csrmvn_blocks((csrmv_info->data->size / 2) - 1);
+    dim3 csrmvn_threads(csrmv_adaptive_wg_size(csrmv_info->data->tuning));
+
+    unsigned long long* row_blocks_ptr = csrmv_info->data->row_blocks;
+
+    // Deterministic mode: the workgroups of a long row write their partial
+    // sums to fixed slots instead of atomically updating the output, an
+    // ordered fix-up pass combines the slots after each Horner step
+    T* wg_partials = nullptr;
+
+    if(handle->atomics_mode == rocsparse_atomics_not_allowed)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->buffer_alloc(sizeof(T) * csrmvn_blocks.x, (void**)&wg_partials));
+    }
+
+#define LAUNCH_CSRMVN_ADAPTIVE_POLY(VARIANT, J, col_ind)                 \
+    hipLaunchKernelGGL((csrmvn_adaptive_poly_kernel<T, T, J, VARIANT>),  \
+                       csrmvn_blocks,                                    \
+                       csrmvn_threads,                                   \
+                       0,                                                \
+                       stream,                                           \
+                       row_blocks_ptr,                                   \
+                       h_alpha,                                          \
+                       csr_row_ptr,                                      \
+                       col_ind,                                          \
+                       csr_val,                                          \
+                       in,                                               \
+                       static_cast<T>(0),                                \
+                       out,                                              \
+                       coeffs[degree - 1 - step],                        \
+                       x,                                                \
+                       wg_partials,                                      \
+                       descr->base)
+
+    const T* in = x;
+
+    for(rocsparse_int step = 0; step < degree; ++step)
+    {
+        T h_alpha = (step == 0) ? coeffs[degree] : static_cast<T>(1);
+        T* out    = ((degree - 1 - step) % 2 == 0) ? y : tmp;
+
+        // Use the delta compressed column indices if the analysis step
+        // built them
+        if(csrmv_info->data->col_delta != nullptr)
+        {
+            csrmv_delta_cols delta_cols = {csrmv_info->data->col_base,
+                                           csrmv_info->data->col_delta};
+
+            switch(csrmv_info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(1, csrmv_delta_cols, delta_cols);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(2, csrmv_delta_cols, delta_cols);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(3, csrmv_delta_cols, delta_cols);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(0, csrmv_delta_cols, delta_cols);
+                break;
+            }
+        }
+#if defined(rocsparse_ILP64)
+        // Use the narrowed 32-bit column indices if the analysis step
+        // built them
+        else if(csrmv_info->data->csr_col_ind_narrow != nullptr)
+        {
+            switch(csrmv_info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(1, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(2, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(3, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(0, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            }
+        }
+#endif
+        else
+        {
+            switch(csrmv_info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(1, const rocsparse_int*, csr_col_ind);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(2, const rocsparse_int*, csr_col_ind);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(3, const rocsparse_int*, csr_col_ind);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE_POLY(0, const rocsparse_int*, csr_col_ind);
+                break;
+            }
+        }
+
+        if(wg_partials != nullptr)
+        {
+#define CSRMVN_FIXUP_DIM 256
+            hipLaunchKernelGGL((csrmvn_adaptive_poly_fixup_kernel<T>),
+                               dim3((csrmvn_blocks.x - 1) / CSRMVN_FIXUP_DIM + 1),
+                               dim3(CSRMVN_FIXUP_DIM),
+                               0,
+                               stream,
+                               (rocsparse_int)csrmvn_blocks.x,
+                               row_blocks_ptr,
+                               wg_partials,
+                               out,
+                               coeffs[degree - 1 - step],
+                               x);
+#undef CSRMVN_FIXUP_DIM
+        }
+
+        in = out;
+    }
+#undef LAUNCH_CSRMVN_ADAPTIVE_POLY
+
+    if(wg_partials != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(wg_partials));
+    }
+
+    if(tmp != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(tmp));
+    }
+
+    return rocsparse_status_success;
+}
+
+
+// Mixed precision csrmv. The matrix values are stored in type A and all
+// computations, including the LDS reductions, are carried out in type T. The
+// sparsity structure is traversed by the same general and adaptive kernels as
+// the uniform precision path, only the value loads are widened.
+template <typename A, typename T>
+rocsparse_status rocsparse_csrmv_mixed_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const T*                  x,
+                                                const T*                  beta,
+                                                T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Build routine name for logging, e.g. rocsparse_hscsrmv_mixed for half
+    // precision storage with single precision compute
+    std::string name = "rocsparse_";
+    name += std::is_same<A, __half>::value ? "h" : "s";
+    name += std::is_same<T, double>::value ? "d" : "s";
+    name += "csrmv_mixed";
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  name,
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y,
+                  (const void*&)info);
+    }
+    else
+    {
+        log_trace(handle,
+                  name,
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  (const void*&)info);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Mixed precision kernels are only available for the non-transposed case
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If csrmv meta data from the analysis step is available and the adaptive
+    // kernel has been selected, run CSR-Adaptive. The merge path kernel has
+    // not been generalized to mixed precision, fall back to csrmv general in
+    // that case.
+    if(info != nullptr && info->csrmv_info != nullptr && info->csrmv_info->data != nullptr
+       && !info->csrmv_info->data->use_merge_path)
+    {
+        rocsparse_csrmv_info csrmv_info = info->csrmv_info;
+
+        // Check if info matches current matrix and options
+        if(csrmv_info->trans != trans)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(csrmv_info->m != m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(csrmv_info->n != n)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(csrmv_info->nnz != nnz)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(csrmv_info->descr != descr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(csrmv_info->csr_row_ptr != csr_row_ptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csrmv_info->csr_col_ind != csr_col_ind)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        // If the analysis step bucketed the rows by length, run the binned
+        // general kernels instead
+        if(csrmv_info->data->use_binned_path)
+        {
+            return rocsparse_csrmv_binned_template(handle,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   nnz,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csrmv_info,
+                                                   x,
+                                                   beta,
+                                                   y);
+        }
+
+        // If the analysis step split the rows into column panels, run the
+        // column blocked kernels instead
+        if(csrmv_info->data->use_col_blocked)
+        {
+            return rocsparse_csrmv_colblock_template(handle,
+                                                     trans,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     alpha,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csrmv_info,
+                                                     x,
+                                                     beta,
+                                                     y);
+        }
+
+        dim3 csrmvn_blocks((csrmv_info->data->size / 2) - 1);
+        dim3 csrmvn_threads(csrmv_adaptive_wg_size(csrmv_info->data->tuning));
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        unsigned long long* row_blocks_ptr = csrmv_info->data->row_blocks;
+
+        // Deterministic mode: the workgroups of a long row write their
+        // partial sums to fixed slots instead of atomically updating y, an
+        // ordered fix-up pass combines the slots afterwards
+        T* wg_partials = nullptr;
+
+        if(handle->atomics_mode == rocsparse_atomics_not_allowed)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                handle->buffer_alloc(sizeof(T) * csrmvn_blocks.x, (void**)&wg_partials));
+        }
+
+#define CSRMVN_FIXUP_DIM 256
+#define LAUNCH_CSRMVN_ADAPTIVE_FIXUP()                                          \
+    hipLaunchKernelGGL((csrmvn_adaptive_fixup_kernel<T>),                       \
+                       dim3((csrmvn_blocks.x - 1) / CSRMVN_FIXUP_DIM + 1),      \
+                       dim3(CSRMVN_FIXUP_DIM),                                  \
+                       0,                                                       \
+                       stream,                                                  \
+                       (rocsparse_int)csrmvn_blocks.x,                          \
+                       row_blocks_ptr,                                          \
+                       wg_partials,                                             \
+                       d_beta,                                                  \
+                       y)
+
+#define LAUNCH_CSRMVN_ADAPTIVE(VARIANT, J, col_ind)                             \
+    hipLaunchKernelGGL((csrmvn_adaptive_kernel<A, T, J, VARIANT>),              \
+                       csrmvn_blocks,                                           \
+                       csrmvn_threads,                                          \
+                       0,                                                       \
+                       stream,                                                  \
+                       row_blocks_ptr,                                          \
+                       d_alpha,                                                 \
+                       csr_row_ptr,                                             \
+                       col_ind,                                                 \
+                       csr_val,                                                 \
+                       x,                                                       \
+                       d_beta,                                                  \
+                       y,                                                       \
+                       wg_partials,                                             \
+                       descr->base)
+
+        // Use the delta compressed column indices if the analysis step
+        // built them
+        if(csrmv_info->data->col_delta != nullptr)
+        {
+            csrmv_delta_cols delta_cols = {csrmv_info->data->col_base,
+                                           csrmv_info->data->col_delta};
+
+            switch(csrmv_info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE(1, csrmv_delta_cols, delta_cols);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE(2, csrmv_delta_cols, delta_cols);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE(3, csrmv_delta_cols, delta_cols);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE(0, csrmv_delta_cols, delta_cols);
+                break;
+            }
+
+            if(wg_partials != nullptr)
+            {
+                LAUNCH_CSRMVN_ADAPTIVE_FIXUP();
+
+                RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(wg_partials));
+            }
+
+            return rocsparse_status_success;
+        }
+
+#if defined(rocsparse_ILP64)
+        // Use the narrowed 32-bit column indices if the analysis step
+        // built them
+        if(csrmv_info->data->csr_col_ind_narrow != nullptr)
+        {
+            switch(csrmv_info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE(1, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE(2, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE(3, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE(0, const int32_t*, csrmv_info->data->csr_col_ind_narrow);
+                break;
+            }
+
+            if(wg_partials != nullptr)
+            {
+                LAUNCH_CSRMVN_ADAPTIVE_FIXUP();
+
+                RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(wg_partials));
+            }
+
+            return rocsparse_status_success;
+        }
+#endif
+
+        // Oversubscribed managed matrices run panel by panel, with the
+        // prefetch of the next panel overlapping the compute of the
+        // current one. The fix-up pass of the deterministic mode requires the
+        // partial slots of the whole grid, such matrices run unsplit there
+        rocsparse_int num_panels = (csrmv_info->data->oversubscribed && wg_partials == nullptr)
+                                       ? csrmv_info->data->num_panels
+                                       : 1;
+
+        if(num_panels > 1)
+        {
+            if(handle->prefetch_stream == nullptr)
+            {
+                RETURN_IF_HIP_ERROR(
+                    hipStreamCreateWithFlags(&handle->prefetch_stream, hipStreamNonBlocking));
+                RETURN_IF_HIP_ERROR(
+                    hipEventCreateWithFlags(&handle->prefetch_done, hipEventDisableTiming));
+            }
+
+            // The first panel is prefetched on the compute stream, such
+            // that the kernel is ordered behind it
+            RETURN_IF_HIP_ERROR(hipMemPrefetchAsync(
+                csr_val, sizeof(A) * csrmv_info->data->panel_nnz[1], handle->device, stream));
+            RETURN_IF_HIP_ERROR(
+                hipMemPrefetchAsync(csr_col_ind,
+                                    sizeof(rocsparse_int) * csrmv_info->data->panel_nnz[1],
+                                    handle->device,
+                                    stream));
+        }
+
+        for(rocsparse_int panel = 0; panel < num_panels; ++panel)
+        {
+            if(num_panels > 1)
+            {
+                if(panel > 0)
+                {
+                    // The compute of this panel must not start before its
+                    // prefetch has finished
+                    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, handle->prefetch_done, 0));
+                }
+
+                if(panel + 1 < num_panels)
+                {
+                    rocsparse_int begin = csrmv_info->data->panel_nnz[panel + 1];
+                    rocsparse_int end   = csrmv_info->data->panel_nnz[panel + 2];
+
+                    RETURN_IF_HIP_ERROR(hipMemPrefetchAsync(csr_val + begin,
+                                                            sizeof(A) * (end - begin),
+                                                            handle->device,
+                                                            handle->prefetch_stream));
+                    RETURN_IF_HIP_ERROR(hipMemPrefetchAsync(csr_col_ind + begin,
+                                                            sizeof(rocsparse_int) * (end - begin),
+                                                            handle->device,
+                                                            handle->prefetch_stream));
+                    RETURN_IF_HIP_ERROR(
+                        hipEventRecord(handle->prefetch_done, handle->prefetch_stream));
+                }
+
+                csrmvn_blocks = dim3(csrmv_info->data->panel_block[panel + 1]
+                                     - csrmv_info->data->panel_block[panel]);
+                row_blocks_ptr = csrmv_info->data->row_blocks + csrmv_info->data->panel_block[panel];
+            }
+
+            switch(csrmv_info->data->tuning)
+            {
+            case 1:
+                LAUNCH_CSRMVN_ADAPTIVE(1, const rocsparse_int*, csr_col_ind);
+                break;
+            case 2:
+                LAUNCH_CSRMVN_ADAPTIVE(2, const rocsparse_int*, csr_col_ind);
+                break;
+            case 3:
+                LAUNCH_CSRMVN_ADAPTIVE(3, const rocsparse_int*, csr_col_ind);
+                break;
+            default:
+                LAUNCH_CSRMVN_ADAPTIVE(0, const rocsparse_int*, csr_col_ind);
+                break;
+            }
+        }
+
+        if(wg_partials != nullptr)
+        {
+            LAUNCH_CSRMVN_ADAPTIVE_FIXUP();
+
+            RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(wg_partials));
+        }
+#undef LAUNCH_CSRMVN_ADAPTIVE
+#undef LAUNCH_CSRMVN_ADAPTIVE_FIXUP
+#undef CSRMVN_FIXUP_DIM
+
+        return rocsparse_status_success;
+    }
+
+#define CSRMVN_MIXED_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_MIXED_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_MIXED_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrmvn_general_kernel<A, T, 32>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           d_beta,
+                           y,
+                           descr->base);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((csrmvn_general_kernel<A, T, 64>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           d_alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           d_beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRMVN_MIXED_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_ooc_template(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const T*                  alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const T*                  x,
+                                              const T*                  beta,
+                                              T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_ooc"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_ooc -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_ooc"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // The transposed product scatters across the full y, which defeats
+        // the row panel decomposition
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Profile the operation ; the matrix data crosses the PCIe bus once
+    rocsparse_profile_scope<T> profile(handle,
+                                       "rocsparse_Xcsrmv_ooc",
+                                       static_cast<double>(sizeof(T)) * (nnz + n + 2.0 * m)
+                                           + static_cast<double>(sizeof(rocsparse_int))
+                                                 * (nnz + m + 1.0));
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xcsrmv_ooc");
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+#define CSRMV_OOC_DIM 512
+#define CSRMV_OOC_NNZ (4 * 1024 * 1024)
+#define CSRMV_OOC_ROWS (1024 * 1024)
+
+    // The panel budget must cover the longest row, otherwise the panel
+    // walk below cannot make progress
+    rocsparse_int max_row_nnz = 0;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_nnz = csr_row_ptr[i + 1] - csr_row_ptr[i];
+        max_row_nnz           = max_row_nnz < row_nnz ? row_nnz : max_row_nnz;
+    }
+
+    rocsparse_int panel_nnz  = std::max(static_cast<rocsparse_int>(CSRMV_OOC_NNZ), max_row_nnz);
+    rocsparse_int panel_rows = std::min(static_cast<rocsparse_int>(CSRMV_OOC_ROWS), m);
+
+    // Double buffered staging area, each half receives the row pointer,
+    // column index and value slices of one panel
+    rocsparse_int* stage_row = nullptr;
+    rocsparse_int* stage_col = nullptr;
+    T*             stage_val = nullptr;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * (panel_rows + 1) * 2, (void**)&stage_row));
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * panel_nnz * 2, (void**)&stage_col));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(T) * panel_nnz * 2, (void**)&stage_val));
+
+    // Dedicated copy stream, such that the upload of the next panel
+    // overlaps with the compute of the current panel. Non blocking, such
+    // that a default handle stream does not serialize the copies
+    hipStream_t copy_stream;
+    RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&copy_stream, hipStreamNonBlocking));
+
+    hipEvent_t ev_copy[2];
+    hipEvent_t ev_compute[2];
+
+    for(int i = 0; i < 2; ++i)
+    {
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&ev_copy[i], hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&ev_compute[i], hipEventDisableTiming));
+    }
+
+    // Select the wavefront fraction per row as in the resident general
+    // kernel
+    rocsparse_int nnz_per_row = nnz / m;
+
+    rocsparse_int wf_size;
+    if(nnz_per_row < 4)
+    {
+        wf_size = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wf_size = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wf_size = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wf_size = 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        wf_size = 32;
+    }
+    else
+    {
+        wf_size = 64;
+    }
+
+    dim3 csrmvn_threads(CSRMV_OOC_DIM);
+
+    // Walk the host row pointer array, cutting panels that fit the entry
+    // and row budget of one staging half, and ping pong the halves
+    rocsparse_int r0     = 0;
+    rocsparse_int ipanel = 0;
+
+    while(r0 < m)
+    {
+        rocsparse_int e0 = csr_row_ptr[r0];
+        rocsparse_int r1 = r0;
+
+        while(r1 < m && r1 - r0 < panel_rows && csr_row_ptr[r1 + 1] - e0 <= panel_nnz)
+        {
+            ++r1;
+        }
+
+        rocsparse_int nrows   = r1 - r0;
+        rocsparse_int entries = csr_row_ptr[r1] - e0;
+        rocsparse_int half    = ipanel & 1;
+
+        rocsparse_int* panel_row = stage_row + half * (panel_rows + 1);
+        rocsparse_int* panel_col = stage_col + half * panel_nnz;
+        T*             panel_val = stage_val + half * panel_nnz;
+
+        // The staging half is reused once the compute of its previous
+        // panel has finished
+        if(ipanel > 1)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(copy_stream, ev_compute[half], 0));
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(panel_row,
+                                           csr_row_ptr + r0,
+                                           sizeof(rocsparse_int) * (nrows + 1),
+                                           hipMemcpyHostToDevice,
+                                           copy_stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(panel_col,
+                                           csr_col_ind + (e0 - descr->base),
+                                           sizeof(rocsparse_int) * entries,
+                                           hipMemcpyHostToDevice,
+                                           copy_stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(panel_val,
+                                           csr_val + (e0 - descr->base),
+                                           sizeof(T) * entries,
+                                           hipMemcpyHostToDevice,
+                                           copy_stream));
+        RETURN_IF_HIP_ERROR(hipEventRecord(ev_copy[half], copy_stream));
+
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, ev_copy[half], 0));
+
+#define LAUNCH_CSRMVN_OOC(WFSIZE)                                             \
+    hipLaunchKernelGGL((csrmvn_panel_kernel<T, WFSIZE>),                      \
+                       dim3((nrows * WFSIZE - 1) / CSRMV_OOC_DIM + 1),        \
+                       csrmvn_threads,                                        \
+                       0,                                                     \
+                       stream,                                                \
+                       nrows,                                                 \
+                       d_alpha,                                               \
+                       e0,                                                    \
+                       panel_row,                                             \
+                       panel_col,                                             \
+                       panel_val,                                             \
+                       x,                                                     \
+                       d_beta,                                                \
+                       y + r0,                                                \
+                       descr->base)
+
+        switch(wf_size)
+        {
+        case 2:
+            LAUNCH_CSRMVN_OOC(2);
+            break;
+        case 4:
+            LAUNCH_CSRMVN_OOC(4);
+            break;
+        case 8:
+            LAUNCH_CSRMVN_OOC(8);
+            break;
+        case 16:
+            LAUNCH_CSRMVN_OOC(16);
+            break;
+        case 32:
+            LAUNCH_CSRMVN_OOC(32);
+            break;
+        default:
+            LAUNCH_CSRMVN_OOC(64);
+            break;
+        }
+#undef LAUNCH_CSRMVN_OOC
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(ev_compute[half], stream));
+
+        r0 = r1;
+        ++ipanel;
+    }
+
+    // The staging area and the host arrays must stay valid until the last
+    // panel has been consumed
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    for(int i = 0; i < 2; ++i)
+    {
+        RETURN_IF_HIP_ERROR(hipEventDestroy(ev_copy[i]));
+        RETURN_IF_HIP_ERROR(hipEventDestroy(ev_compute[i]));
+    }
+
+    RETURN_IF_HIP_ERROR(hipStreamDestroy(copy_stream));
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(stage_val));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(stage_col));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(stage_row));
+#undef CSRMV_OOC_ROWS
+#undef CSRMV_OOC_NNZ
+#undef CSRMV_OOC_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_quant_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const int8_t*             csr_val,
+                                                const T*                  csr_scale,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  x,
+                                                const T*                  beta,
+                                                T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Build routine name for logging, e.g. rocsparse_qscsrmv for int8
+    // quantized storage with single precision compute
+    std::string name = "rocsparse_q";
+    name += std::is_same<T, double>::value ? "d" : "s";
+    name += "csrmv";
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  name,
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_scale,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+    }
+    else
+    {
+        log_trace(handle,
+                  name,
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_scale,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quantized kernels are only available for the non-transposed case
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_scale == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Profile the operation ; the matrix values cross as single bytes, the
+    // scale factors once per row
+    rocsparse_profile_scope<T> profile(handle,
+                                       name.c_str(),
+                                       static_cast<double>(sizeof(int8_t)) * nnz
+                                           + static_cast<double>(sizeof(T)) * (n + 3.0 * m)
+                                           + static_cast<double>(sizeof(rocsparse_int))
+                                                 * (nnz + m + 1.0));
+
+    rocsparse_roctx_scope<T> roctx(handle, name.c_str());
+
+    if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+#define CSRMVN_QUANT_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_QUANT_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_QUANT_DIM);
+
+    // Select the wavefront fraction per row as in the uniform precision
+    // general kernel
+    rocsparse_int nnz_per_row = nnz / m;
+
+    rocsparse_int wf_size;
+    if(nnz_per_row < 4)
+    {
+        wf_size = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wf_size = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wf_size = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wf_size = 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        wf_size = 32;
+    }
+    else
+    {
+        wf_size = 64;
+    }
+
+#define LAUNCH_CSRMVN_QUANT(WFSIZE)                   \
+    hipLaunchKernelGGL((csrmvn_quant_kernel<T, WFSIZE>), \
+                       csrmvn_blocks,                 \
+                       csrmvn_threads,                \
+                       0,                             \
+                       stream,                        \
+                       m,                             \
+                       d_alpha,                       \
+                       csr_row_ptr,                   \
+                       csr_col_ind,                   \
+                       csr_val,                       \
+                       csr_scale,                     \
+                       x,                             \
+                       d_beta,                        \
+                       y,                             \
+                       descr->base)
+
+    switch(wf_size)
+    {
+    case 2:
+        LAUNCH_CSRMVN_QUANT(2);
+        break;
+    case 4:
+        LAUNCH_CSRMVN_QUANT(4);
+        break;
+    case 8:
+        LAUNCH_CSRMVN_QUANT(8);
+        break;
+    case 16:
+        LAUNCH_CSRMVN_QUANT(16);
+        break;
+    case 32:
+        LAUNCH_CSRMVN_QUANT(32);
+        break;
+    default:
+        LAUNCH_CSRMVN_QUANT(64);
+        break;
+    }
+#undef LAUNCH_CSRMVN_QUANT
+#undef CSRMVN_QUANT_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_dot_template(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const T*                  alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const T*                  x,
+                                              const T*                  beta,
+                                              T*                        y,
+                                              T*                        dot)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_dot"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y,
+                  (const void*&)dot);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_dot"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  (const void*&)dot);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // The epilogue computes x^T * y, which requires a square matrix
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dot == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes. No early out for alpha == 0 and beta == 1, the
+    // dot product has to be computed in any case
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+#define CSRMV_DOT_DIM 256
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    // Get workspace from handle device buffer
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    // Select the wavefront fraction per row as in the general kernel
+    rocsparse_int nnz_per_row = nnz / m;
+
+    rocsparse_int wf_size;
+    if(nnz_per_row < 4)
+    {
+        wf_size = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wf_size = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wf_size = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wf_size = 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        wf_size = 32;
+    }
+    else
+    {
+        wf_size = 64;
+    }
+
+#define LAUNCH_CSRMVN_DOT(WFSIZE)                                          \
+    hipLaunchKernelGGL((csrmvn_dot_kernel<T, CSRMV_DOT_DIM, WFSIZE>),      \
+                       dim3(CSRMV_DOT_DIM),                                \
+                       dim3(CSRMV_DOT_DIM),                                \
+                       0,                                                  \
+                       stream,                                             \
+                       m,                                                  \
+                       d_alpha,                                            \
+                       csr_row_ptr,                                        \
+                       csr_col_ind,                                        \
+                       csr_val,                                            \
+                       x,                                                  \
+                       d_beta,                                             \
+                       y,                                                  \
+                       workspace,                                          \
+                       descr->base)
+
+    switch(wf_size)
+    {
+    case 2:
+        LAUNCH_CSRMVN_DOT(2);
+        break;
+    case 4:
+        LAUNCH_CSRMVN_DOT(4);
+        break;
+    case 8:
+        LAUNCH_CSRMVN_DOT(8);
+        break;
+    case 16:
+        LAUNCH_CSRMVN_DOT(16);
+        break;
+    case 32:
+        LAUNCH_CSRMVN_DOT(32);
+        break;
+    default:
+        LAUNCH_CSRMVN_DOT(64);
+        break;
+    }
+#undef LAUNCH_CSRMVN_DOT
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmv_dot_reduce_kernel<T, CSRMV_DOT_DIM>),
+                           dim3(1),
+                           dim3(CSRMV_DOT_DIM),
+                           0,
+                           stream,
+                           static_cast<rocsparse_int>(CSRMV_DOT_DIM),
+                           workspace,
+                           dot);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmv_dot_reduce_kernel<T, CSRMV_DOT_DIM>),
+                           dim3(1),
+                           dim3(CSRMV_DOT_DIM),
+                           0,
+                           stream,
+                           static_cast<rocsparse_int>(CSRMV_DOT_DIM),
+                           workspace,
+                           (T*)nullptr);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(dot, workspace, sizeof(T), hipMemcpyDeviceToHost));
+    }
+#undef CSRMV_DOT_DIM
+
     return rocsparse_status_success;
 }
 
@@ -63,6 +63,56 @@ extern "C" rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle
         handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_scsrsv_buffer_size_batched(rocsparse_handle    handle,
+                                                                 rocsparse_operation trans,
+                                                                 rocsparse_int       m,
+                                                                 rocsparse_int       nnz,
+                                                                 const rocsparse_mat_descr descr,
+                                                                 const float*              csr_val,
+                                                                 const rocsparse_int* csr_row_ptr,
+                                                                 const rocsparse_int* csr_col_ind,
+                                                                 rocsparse_mat_info   info,
+                                                                 rocsparse_int        batch_count,
+                                                                 size_t*              buffer_size)
+{
+    return rocsparse_csrsv_batched_buffer_size_template<float>(handle,
+                                                               trans,
+                                                               m,
+                                                               nnz,
+                                                               descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               info,
+                                                               batch_count,
+                                                               buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsv_buffer_size_batched(rocsparse_handle    handle,
+                                                                 rocsparse_operation trans,
+                                                                 rocsparse_int       m,
+                                                                 rocsparse_int       nnz,
+                                                                 const rocsparse_mat_descr descr,
+                                                                 const double*             csr_val,
+                                                                 const rocsparse_int* csr_row_ptr,
+                                                                 const rocsparse_int* csr_col_ind,
+                                                                 rocsparse_mat_info   info,
+                                                                 rocsparse_int        batch_count,
+                                                                 size_t*              buffer_size)
+{
+    return rocsparse_csrsv_batched_buffer_size_template<double>(handle,
+                                                                trans,
+                                                                m,
+                                                                nnz,
+                                                                descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                info,
+                                                                batch_count,
+                                                                buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
                                                       rocsparse_operation       trans,
                                                       rocsparse_int             m,
@@ -224,6 +274,151 @@ extern "C" rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle          han
                                                   temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_sdcsrsv_solve(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const double*             alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ind,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const double*             x,
+                                                    double*                   y,
+                                                    rocsparse_solve_policy    policy,
+                                                    void*                     temp_buffer)
+{
+    return rocsparse_csrsv_solve_mixed_template<float, double>(handle,
+                                                               trans,
+                                                               m,
+                                                               nnz,
+                                                               alpha,
+                                                               descr,
+                                                               csr_val,
+                                                               csr_row_ind,
+                                                               csr_col_ind,
+                                                               info,
+                                                               x,
+                                                               y,
+                                                               policy,
+                                                               temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsrsv_lu_solve(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const float*              alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float*              csr_val,
+                                                      const rocsparse_int*      csr_row_ind,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      const float*              x,
+                                                      float*                    y,
+                                                      void*                     temp_buffer)
+{
+    return rocsparse_csrsv_lu_solve_template<float>(
+        handle, trans, m, nnz, alpha, descr, csr_val, csr_row_ind, csr_col_ind, info, x, y, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsv_lu_solve(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const double*             alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double*             csr_val,
+                                                      const rocsparse_int*      csr_row_ind,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      const double*             x,
+                                                      double*                   y,
+                                                      void*                     temp_buffer)
+{
+    return rocsparse_csrsv_lu_solve_template<double>(
+        handle, trans, m, nnz, alpha, descr, csr_val, csr_row_ind, csr_col_ind, info, x, y, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsrsv_solve_batched(rocsparse_handle          handle,
+                                                           rocsparse_operation       trans,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             nnz,
+                                                           const float*              alpha,
+                                                           const rocsparse_mat_descr descr,
+                                                           const float*              csr_val,
+                                                           rocsparse_int             batch_stride,
+                                                           const rocsparse_int*      csr_row_ind,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           rocsparse_mat_info        info,
+                                                           const float*              x,
+                                                           rocsparse_int             x_stride,
+                                                           float*                    y,
+                                                           rocsparse_int             y_stride,
+                                                           rocsparse_int             batch_count,
+                                                           rocsparse_solve_policy    policy,
+                                                           void*                     temp_buffer)
+{
+    return rocsparse_csrsv_solve_batched_template<float>(handle,
+                                                         trans,
+                                                         m,
+                                                         nnz,
+                                                         alpha,
+                                                         descr,
+                                                         csr_val,
+                                                         batch_stride,
+                                                         csr_row_ind,
+                                                         csr_col_ind,
+                                                         info,
+                                                         x,
+                                                         x_stride,
+                                                         y,
+                                                         y_stride,
+                                                         batch_count,
+                                                         policy,
+                                                         temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsv_solve_batched(rocsparse_handle          handle,
+                                                           rocsparse_operation       trans,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             nnz,
+                                                           const double*             alpha,
+                                                           const rocsparse_mat_descr descr,
+                                                           const double*             csr_val,
+                                                           rocsparse_int             batch_stride,
+                                                           const rocsparse_int*      csr_row_ind,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           rocsparse_mat_info        info,
+                                                           const double*             x,
+                                                           rocsparse_int             x_stride,
+                                                           double*                   y,
+                                                           rocsparse_int             y_stride,
+                                                           rocsparse_int             batch_count,
+                                                           rocsparse_solve_policy    policy,
+                                                           void*                     temp_buffer)
+{
+    return rocsparse_csrsv_solve_batched_template<double>(handle,
+                                                          trans,
+                                                          m,
+                                                          nnz,
+                                                          alpha,
+                                                          descr,
+                                                          csr_val,
+                                                          batch_stride,
+                                                          csr_row_ind,
+                                                          csr_col_ind,
+                                                          info,
+                                                          x,
+                                                          x_stride,
+                                                          y,
+                                                          y_stride,
+                                                          batch_count,
+                                                          policy,
+                                                          temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
                                                        const rocsparse_mat_descr descr,
                                                        rocsparse_mat_info        info,
@@ -343,3 +538,138 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
 
     return rocsparse_status_success;
 }
+
+// Context of an asynchronous zero pivot query, passed through
+// hipStreamAddCallback and released once the callback has been invoked
+struct rocsparse_zero_pivot_callback_data
+{
+    rocsparse_zero_pivot_callback callback;
+    void*                         user_data;
+    rocsparse_int                 pivot;
+};
+
+static void csrsv_zero_pivot_callback_run(hipStream_t stream, hipError_t status, void* data)
+{
+    rocsparse_zero_pivot_callback_data* ctx
+        = reinterpret_cast<rocsparse_zero_pivot_callback_data*>(data);
+
+    // If no zero pivot is found, report -1
+    rocsparse_int pivot
+        = (ctx->pivot == std::numeric_limits<rocsparse_int>::max()) ? -1 : ctx->pivot;
+
+    ctx->callback(pivot, ctx->user_data);
+
+    delete ctx;
+}
+
+extern "C" rocsparse_status rocsparse_csrsv_zero_pivot_async(rocsparse_handle          handle,
+                                                             const rocsparse_mat_descr descr,
+                                                             rocsparse_mat_info        info,
+                                                             rocsparse_int*            position,
+                                                             rocsparse_zero_pivot_callback callback,
+                                                             void*                         user_data)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrsv_zero_pivot_async",
+              (const void*&)info,
+              (const void*&)position,
+              (const void*&)callback,
+              (const void*&)user_data);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Determine the info meta data place
+    rocsparse_csrtr_info csrsv = nullptr;
+
+    // For hipSPARSE compatibility mode, we allow descr == nullptr
+    // In this case, only lower OR upper is populated and we can use the right
+    // info meta data
+    if(descr == nullptr)
+    {
+        if(info->csrsv_lower_info != nullptr)
+        {
+            csrsv = info->csrsv_lower_info;
+        }
+        else
+        {
+            csrsv = info->csrsv_upper_info;
+        }
+    }
+    else
+    {
+        // Switch between upper and lower triangular
+        if(descr->fill_mode == rocsparse_fill_mode_lower)
+        {
+            csrsv = info->csrsv_lower_info;
+        }
+        else
+        {
+            csrsv = info->csrsv_upper_info;
+        }
+    }
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, always report -1.
+    if(csrsv == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+
+        if(callback != nullptr)
+        {
+            rocsparse_zero_pivot_callback_data* ctx = new rocsparse_zero_pivot_callback_data;
+
+            ctx->callback  = callback;
+            ctx->user_data = user_data;
+            ctx->pivot     = std::numeric_limits<rocsparse_int>::max();
+
+            RETURN_IF_HIP_ERROR(hipStreamAddCallback(stream, csrsv_zero_pivot_callback_run, ctx, 0));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Write the pivot status to position on the device, without
+    // synchronizing the stream
+    hipLaunchKernelGGL(csrsv_zero_pivot_kernel,
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       csrsv->zero_pivot,
+                       position);
+
+    if(callback != nullptr)
+    {
+        rocsparse_zero_pivot_callback_data* ctx = new rocsparse_zero_pivot_callback_data;
+
+        ctx->callback  = callback;
+        ctx->user_data = user_data;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&ctx->pivot,
+                                           csrsv->zero_pivot,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipStreamAddCallback(stream, csrsv_zero_pivot_callback_run, ctx, 0));
+    }
+
+    return rocsparse_status_success;
+}
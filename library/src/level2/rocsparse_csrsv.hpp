@@ -34,6 +34,8 @@
 #include "csrsv_device.h"
 
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
@@ -157,6 +159,132 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csrsv_batched_buffer_size_template(rocsparse_handle          handle,
+                                                              rocsparse_operation       trans,
+                                                              rocsparse_int             m,
+                                                              rocsparse_int             nnz,
+                                                              const rocsparse_mat_descr descr,
+                                                              const T*                  csr_val,
+                                                              const rocsparse_int* csr_row_ptr,
+                                                              const rocsparse_int* csr_col_ind,
+                                                              rocsparse_mat_info   info,
+                                                              rocsparse_int        batch_count,
+                                                              size_t*              buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrsv_batched_buffer_size"),
+              trans,
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              batch_count,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || batch_count == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // rocsparse_int max_nnz
+    *buffer_size = 256;
+
+    // rocsparse_int done_array[m * batch_count], each matrix of the batch
+    // requires its own set of done flags during the solve phase
+    *buffer_size += sizeof(int) * ((m * batch_count - 1) / 256 + 1) * 256;
+
+    // rocsparse_int workspace
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // rocsparse_int workspace2
+    *buffer_size += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    size_t         rocprim_size = 0;
+    rocsparse_int* ptr          = reinterpret_cast<rocsparse_int*>(buffer_size);
+    int*           ptr2         = reinterpret_cast<int*>(buffer_size);
+
+    rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+    rocprim::double_buffer<rocsparse_int> dummy2(ptr2, ptr2);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, rocprim_size, dummy2, dummy, m, 0, 32, stream));
+
+    // rocprim buffer
+    *buffer_size += rocprim_size;
+
+    return rocsparse_status_success;
+}
+
 static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handle,
                                                  rocsparse_operation       trans,
                                                  rocsparse_int             m,
@@ -164,12 +292,15 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
                                                  const rocsparse_mat_descr descr,
                                                  const rocsparse_int*      csr_row_ptr,
                                                  const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_fill_mode       fill_mode,
                                                  rocsparse_csrtr_info      info,
                                                  void*                     temp_buffer)
 {
     // Stream
     hipStream_t stream = handle->stream;
 
+    rocsparse_roctx_phase_begin(handle, "csrtr_analysis setup");
+
     // Buffer
     char* ptr = reinterpret_cast<char*>(temp_buffer);
 
@@ -213,6 +344,9 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
     // Wait for device transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
+    rocsparse_roctx_phase_end(handle);
+    rocsparse_roctx_phase_begin(handle, "csrtr_analysis depth");
+
 // Run analysis
 #define CSRILU0_DIM 1024
     dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRILU0_DIM + 1);
@@ -220,7 +354,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
 
     if(handle->wavefront_size == 32)
     {
-        if(descr->fill_mode == rocsparse_fill_mode_upper)
+        if(fill_mode == rocsparse_fill_mode_upper)
         {
             hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRILU0_DIM, 32>),
                                csrsv_blocks,
@@ -236,7 +370,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
                                info->zero_pivot,
                                descr->base);
         }
-        else if(descr->fill_mode == rocsparse_fill_mode_lower)
+        else if(fill_mode == rocsparse_fill_mode_lower)
         {
             hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRILU0_DIM, 32>),
                                csrsv_blocks,
@@ -255,7 +389,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
     }
     else if(handle->wavefront_size == 64)
     {
-        if(descr->fill_mode == rocsparse_fill_mode_upper)
+        if(fill_mode == rocsparse_fill_mode_upper)
         {
             hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRILU0_DIM, 64>),
                                csrsv_blocks,
@@ -271,7 +405,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
                                info->zero_pivot,
                                descr->base);
         }
-        else if(descr->fill_mode == rocsparse_fill_mode_lower)
+        else if(fill_mode == rocsparse_fill_mode_lower)
         {
             hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRILU0_DIM, 64>),
                                csrsv_blocks,
@@ -301,6 +435,9 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
+    rocsparse_roctx_phase_end(handle);
+    rocsparse_roctx_phase_begin(handle, "csrtr_analysis level sort");
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, workspace));
 
     size_t rocprim_size;
@@ -325,6 +462,37 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
                                            stream));
     }
 
+    // Extract level information from the sorted depths, such that the level
+    // based solve policy can launch one kernel per dependency level
+    std::vector<int> depth(m);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        depth.data(), keys.current(), sizeof(int) * m, hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Depths are 1 based, the largest depth equals the number of levels
+    info->nlevels   = depth[m - 1];
+    info->level_ptr = new rocsparse_int[info->nlevels + 1];
+
+    // Rows of level l are stored at row_map[level_ptr[l]] up to
+    // row_map[level_ptr[l + 1]]
+    info->level_ptr[0] = 0;
+
+    rocsparse_int current_level = 1;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        while(current_level < depth[i])
+        {
+            info->level_ptr[current_level++] = i;
+        }
+    }
+
+    while(current_level <= info->nlevels)
+    {
+        info->level_ptr[current_level++] = m;
+    }
+
     // Store some pointers to verify correct execution
     info->m           = m;
     info->nnz         = nnz;
@@ -332,6 +500,8 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle          handl
     info->csr_row_ptr = csr_row_ptr;
     info->csr_col_ind = csr_col_ind;
 
+    rocsparse_roctx_phase_end(handle);
+
     return rocsparse_status_success;
 }
 
@@ -398,7 +568,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(solve != rocsparse_solve_policy_auto && solve != rocsparse_solve_policy_level
+       && solve != rocsparse_solve_policy_jacobi)
     {
         return rocsparse_status_invalid_value;
     }
@@ -437,11 +608,30 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xcsrsv_analysis");
+
+    // Allocate the handle device memory here ; the solve stage promises to
+    // issue no allocations, such that it can be captured into a hipGraph
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
     // Switch between lower and upper triangular analysis
     if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
-        // This is currently the only case where we need upper triangular analysis,
-        // therefore we ignore the analysis policy
+        // Differentiate the analysis policies
+        if(analysis == rocsparse_analysis_policy_reuse)
+        {
+            // We try to re-use already analyzed upper part, if available.
+            // It is the user's responsibility that this data is still valid,
+            // since he passed the 'reuse' flag.
+
+            // If csrsv meta data is already available, do nothing. This can
+            // e.g. be the case, if it has been gathered by a csrilu0 analysis
+            // that was called with the 'shared' policy.
+            if(info->csrsv_upper_info != nullptr)
+            {
+                return rocsparse_status_success;
+            }
+        }
 
         // Clear csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
@@ -457,6 +647,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                            descr,
                                                            csr_row_ptr,
                                                            csr_col_ind,
+                                                           rocsparse_fill_mode_upper,
                                                            info->csrsv_upper_info,
                                                            temp_buffer));
     }
@@ -484,6 +675,12 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                 reuse = info->csrilu0_info;
             }
 
+            // csric0 meta data
+            if(reuse == nullptr && info->csric0_info != nullptr)
+            {
+                reuse = info->csric0_info;
+            }
+
             // TODO add more crossover data here
 
             // If data has been found, use it
@@ -512,20 +709,50 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                            descr,
                                                            csr_row_ptr,
                                                            csr_col_ind,
+                                                           rocsparse_fill_mode_lower,
                                                            info->csrsv_lower_info,
                                                            temp_buffer));
     }
 
+    // Cache the reciprocal diagonal entries, such that the solve replaces
+    // the dependent division on its critical path by a multiplication
+    rocsparse_csrtr_info csrtr = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsv_upper_info
+                                     : info->csrsv_lower_info;
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&csrtr->inv_diag, sizeof(T) * m));
+
+#define CSRSV_DIM 1024
+    dim3 inv_diag_blocks((m - 1) / CSRSV_DIM + 1);
+    dim3 inv_diag_threads(CSRSV_DIM);
+
+    hipLaunchKernelGGL((csrsv_inv_diag_kernel<T, CSRSV_DIM>),
+                       inv_diag_blocks,
+                       inv_diag_threads,
+                       0,
+                       handle->stream,
+                       m,
+                       csr_val,
+                       csrtr->csr_diag_ind,
+                       reinterpret_cast<T*>(csrtr->inv_diag));
+#undef CSRSV_DIM
+
+    // Remember the value array the reciprocals have been computed from, the
+    // solve falls back to the in-loop division when applied to different
+    // values
+    csrtr->inv_diag_val = csr_val;
+
     return rocsparse_status_success;
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrsv_host_pointer(rocsparse_int m,
                             T             alpha,
                             const rocsparse_int* __restrict__ csr_row_ptr,
                             const rocsparse_int* __restrict__ csr_col_ind,
-                            const T* __restrict__ csr_val,
+                            const A* __restrict__ csr_val,
+                            const A* __restrict__ inv_diag,
                             const T* __restrict__ x,
                             T* __restrict__ y,
                             int* __restrict__ done_array,
@@ -536,29 +763,31 @@ __launch_bounds__(BLOCKSIZE) __global__
                             rocsparse_fill_mode  fill_mode,
                             rocsparse_diag_type  diag_type)
 {
-    csrsv_device<T, BLOCKSIZE, WF_SIZE>(m,
-                                        alpha,
-                                        csr_row_ptr,
-                                        csr_col_ind,
-                                        csr_val,
-                                        x,
-                                        y,
-                                        done_array,
-                                        map,
-                                        offset,
-                                        zero_pivot,
-                                        idx_base,
-                                        fill_mode,
-                                        diag_type);
+    csrsv_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                           alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val,
+                                           inv_diag,
+                                           x,
+                                           y,
+                                           done_array,
+                                           map,
+                                           offset,
+                                           zero_pivot,
+                                           idx_base,
+                                           fill_mode,
+                                           diag_type);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrsv_device_pointer(rocsparse_int m,
                               const T*      alpha,
                               const rocsparse_int* __restrict__ csr_row_ptr,
                               const rocsparse_int* __restrict__ csr_col_ind,
-                              const T* __restrict__ csr_val,
+                              const A* __restrict__ csr_val,
+                              const A* __restrict__ inv_diag,
                               const T* __restrict__ x,
                               T* __restrict__ y,
                               int* __restrict__ done_array,
@@ -569,30 +798,433 @@ __launch_bounds__(BLOCKSIZE) __global__
                               rocsparse_fill_mode  fill_mode,
                               rocsparse_diag_type  diag_type)
 {
-    csrsv_device<T, BLOCKSIZE, WF_SIZE>(m,
-                                        *alpha,
-                                        csr_row_ptr,
-                                        csr_col_ind,
-                                        csr_val,
-                                        x,
-                                        y,
-                                        done_array,
-                                        map,
-                                        offset,
-                                        zero_pivot,
-                                        idx_base,
-                                        fill_mode,
-                                        diag_type);
+    csrsv_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                           *alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val,
+                                           inv_diag,
+                                           x,
+                                           y,
+                                           done_array,
+                                           map,
+                                           offset,
+                                           zero_pivot,
+                                           idx_base,
+                                           fill_mode,
+                                           diag_type);
 }
 
-template <typename T>
-rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle,
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_lds_host_pointer(rocsparse_int m,
+                                T             alpha,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const A* __restrict__ csr_val,
+                                const A* __restrict__ inv_diag,
+                                const T* __restrict__ x,
+                                T* __restrict__ y,
+                                rocsparse_int* __restrict__ map,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base,
+                                rocsparse_fill_mode  fill_mode,
+                                rocsparse_diag_type  diag_type)
+{
+    csrsv_lds_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               inv_diag,
+                                               x,
+                                               y,
+                                               map,
+                                               zero_pivot,
+                                               idx_base,
+                                               fill_mode,
+                                               diag_type);
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_lds_device_pointer(rocsparse_int m,
+                                  const T*      alpha,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const A* __restrict__ csr_val,
+                                  const A* __restrict__ inv_diag,
+                                  const T* __restrict__ x,
+                                  T* __restrict__ y,
+                                  rocsparse_int* __restrict__ map,
+                                  rocsparse_int* __restrict__ zero_pivot,
+                                  rocsparse_index_base idx_base,
+                                  rocsparse_fill_mode  fill_mode,
+                                  rocsparse_diag_type  diag_type)
+{
+    csrsv_lds_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               inv_diag,
+                                               x,
+                                               y,
+                                               map,
+                                               zero_pivot,
+                                               idx_base,
+                                               fill_mode,
+                                               diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_lu_host_pointer(rocsparse_int m,
+                               T             alpha,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const T* __restrict__ csr_val,
+                               const T* __restrict__ inv_diag,
+                               const T* __restrict__ x,
+                               T* __restrict__ y,
+                               T* __restrict__ z,
+                               int* __restrict__ done_lower,
+                               int* __restrict__ done_upper,
+                               rocsparse_int* __restrict__ map_lower,
+                               rocsparse_int* __restrict__ map_upper,
+                               rocsparse_int* __restrict__ zero_pivot,
+                               rocsparse_index_base idx_base)
+{
+    csrsv_lu_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                           alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val,
+                                           inv_diag,
+                                           x,
+                                           y,
+                                           z,
+                                           done_lower,
+                                           done_upper,
+                                           map_lower,
+                                           map_upper,
+                                           zero_pivot,
+                                           idx_base);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_lu_device_pointer(rocsparse_int m,
+                                 const T*      alpha,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 const T* __restrict__ csr_val,
+                                 const T* __restrict__ inv_diag,
+                                 const T* __restrict__ x,
+                                 T* __restrict__ y,
+                                 T* __restrict__ z,
+                                 int* __restrict__ done_lower,
+                                 int* __restrict__ done_upper,
+                                 rocsparse_int* __restrict__ map_lower,
+                                 rocsparse_int* __restrict__ map_upper,
+                                 rocsparse_int* __restrict__ zero_pivot,
+                                 rocsparse_index_base idx_base)
+{
+    csrsv_lu_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                           *alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val,
+                                           inv_diag,
+                                           x,
+                                           y,
+                                           z,
+                                           done_lower,
+                                           done_upper,
+                                           map_lower,
+                                           map_upper,
+                                           zero_pivot,
+                                           idx_base);
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_batched_host_pointer(rocsparse_int m,
+                                    T             alpha,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const A* __restrict__ csr_val,
+                                    rocsparse_int batch_stride,
+                                    const T* __restrict__ x,
+                                    rocsparse_int x_stride,
+                                    T* __restrict__ y,
+                                    rocsparse_int y_stride,
+                                    int* __restrict__ done_array,
+                                    rocsparse_int* __restrict__ map,
+                                    rocsparse_int* __restrict__ zero_pivot,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_fill_mode  fill_mode,
+                                    rocsparse_diag_type  diag_type)
+{
+    // Shift values, vectors and done flags to the matrix of the current
+    // batch. All matrices of a batch share the same sparsity pattern.
+    // Each matrix of the batch carries its own values, the reciprocal
+    // diagonal cached by the analysis does not apply
+    csrsv_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                           alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val + hipBlockIdx_y * batch_stride,
+                                           static_cast<const A*>(nullptr),
+                                           x + hipBlockIdx_y * x_stride,
+                                           y + hipBlockIdx_y * y_stride,
+                                           done_array + hipBlockIdx_y * m,
+                                           map,
+                                           0,
+                                           zero_pivot,
+                                           idx_base,
+                                           fill_mode,
+                                           diag_type);
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_batched_device_pointer(rocsparse_int m,
+                                      const T*      alpha,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const A* __restrict__ csr_val,
+                                      rocsparse_int batch_stride,
+                                      const T* __restrict__ x,
+                                      rocsparse_int x_stride,
+                                      T* __restrict__ y,
+                                      rocsparse_int y_stride,
+                                      int* __restrict__ done_array,
+                                      rocsparse_int* __restrict__ map,
+                                      rocsparse_int* __restrict__ zero_pivot,
+                                      rocsparse_index_base idx_base,
+                                      rocsparse_fill_mode  fill_mode,
+                                      rocsparse_diag_type  diag_type)
+{
+    // Shift values, vectors and done flags to the matrix of the current
+    // batch. All matrices of a batch share the same sparsity pattern.
+    // Each matrix of the batch carries its own values, the reciprocal
+    // diagonal cached by the analysis does not apply
+    csrsv_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                           *alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val + hipBlockIdx_y * batch_stride,
+                                           static_cast<const A*>(nullptr),
+                                           x + hipBlockIdx_y * x_stride,
+                                           y + hipBlockIdx_y * y_stride,
+                                           done_array + hipBlockIdx_y * m,
+                                           map,
+                                           0,
+                                           zero_pivot,
+                                           idx_base,
+                                           fill_mode,
+                                           diag_type);
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_level_host_pointer(rocsparse_int nrows,
+                                  T             alpha,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const A* __restrict__ csr_val,
+                                  const A* __restrict__ inv_diag,
+                                  const T* __restrict__ x,
+                                  T* __restrict__ y,
+                                  rocsparse_int* __restrict__ map,
+                                  rocsparse_int offset,
+                                  rocsparse_int* __restrict__ zero_pivot,
+                                  rocsparse_index_base idx_base,
+                                  rocsparse_fill_mode  fill_mode,
+                                  rocsparse_diag_type  diag_type)
+{
+    csrsv_level_device<A, T, BLOCKSIZE, WF_SIZE>(nrows,
+                                                 alpha,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 inv_diag,
+                                                 x,
+                                                 y,
+                                                 map,
+                                                 offset,
+                                                 zero_pivot,
+                                                 idx_base,
+                                                 fill_mode,
+                                                 diag_type);
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_level_device_pointer(rocsparse_int nrows,
+                                    const T*      alpha,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const A* __restrict__ csr_val,
+                                    const A* __restrict__ inv_diag,
+                                    const T* __restrict__ x,
+                                    T* __restrict__ y,
+                                    rocsparse_int* __restrict__ map,
+                                    rocsparse_int offset,
+                                    rocsparse_int* __restrict__ zero_pivot,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_fill_mode  fill_mode,
+                                    rocsparse_diag_type  diag_type)
+{
+    csrsv_level_device<A, T, BLOCKSIZE, WF_SIZE>(nrows,
+                                                 *alpha,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 inv_diag,
+                                                 x,
+                                                 y,
+                                                 map,
+                                                 offset,
+                                                 zero_pivot,
+                                                 idx_base,
+                                                 fill_mode,
+                                                 diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_t_init_host_pointer(rocsparse_int m,
+                                   T             alpha,
+                                   const T* __restrict__ x,
+                                   T* __restrict__ y)
+{
+    csrsv_t_init_device<T, BLOCKSIZE>(m, alpha, x, y);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_t_init_device_pointer(rocsparse_int m,
+                                     const T*      alpha,
+                                     const T* __restrict__ x,
+                                     T* __restrict__ y)
+{
+    csrsv_t_init_device<T, BLOCKSIZE>(m, *alpha, x, y);
+}
+
+// The transposed level kernel does not consume alpha, the right-hand side
+// has been scaled by the initialization kernel. A single wrapper covers
+// both pointer modes
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_t_level_kernel(rocsparse_int nrows,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              const A* __restrict__ csr_val,
+                              const A* __restrict__ inv_diag,
+                              const rocsparse_int* __restrict__ csr_diag_ind,
+                              T* __restrict__ y,
+                              const rocsparse_int* __restrict__ map,
+                              rocsparse_int offset,
+                              rocsparse_int* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode  fill_mode,
+                              rocsparse_diag_type  diag_type)
+{
+    csrsv_t_level_device<A, T, BLOCKSIZE, WF_SIZE>(nrows,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   csr_val,
+                                                   inv_diag,
+                                                   csr_diag_ind,
+                                                   y,
+                                                   map,
+                                                   offset,
+                                                   zero_pivot,
+                                                   idx_base,
+                                                   fill_mode,
+                                                   diag_type);
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_jacobi_host_pointer(rocsparse_int m,
+                                   T             alpha,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   const A* __restrict__ csr_val,
+                                   const A* __restrict__ inv_diag,
+                                   const rocsparse_int* __restrict__ csr_diag_ind,
+                                   const T* __restrict__ x,
+                                   const T* __restrict__ y_in,
+                                   T* __restrict__ y_out,
+                                   rocsparse_int* __restrict__ zero_pivot,
+                                   rocsparse_index_base idx_base,
+                                   rocsparse_fill_mode  fill_mode,
+                                   rocsparse_diag_type  diag_type)
+{
+    csrsv_jacobi_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                                  alpha,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  inv_diag,
+                                                  csr_diag_ind,
+                                                  x,
+                                                  y_in,
+                                                  y_out,
+                                                  zero_pivot,
+                                                  idx_base,
+                                                  fill_mode,
+                                                  diag_type);
+}
+
+template <typename A, typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_jacobi_device_pointer(rocsparse_int m,
+                                     const T*      alpha,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const A* __restrict__ csr_val,
+                                     const A* __restrict__ inv_diag,
+                                     const rocsparse_int* __restrict__ csr_diag_ind,
+                                     const T* __restrict__ x,
+                                     const T* __restrict__ y_in,
+                                     T* __restrict__ y_out,
+                                     rocsparse_int* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base,
+                                     rocsparse_fill_mode  fill_mode,
+                                     rocsparse_diag_type  diag_type)
+{
+    csrsv_jacobi_device<A, T, BLOCKSIZE, WF_SIZE>(m,
+                                                  *alpha,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  inv_diag,
+                                                  csr_diag_ind,
+                                                  x,
+                                                  y_in,
+                                                  y_out,
+                                                  zero_pivot,
+                                                  idx_base,
+                                                  fill_mode,
+                                                  diag_type);
+}
+
+// Kernel dispatch shared by the uniform and mixed precision solve. The
+// matrix values are stored in type A and all computations are carried out
+// in type T, the uniform precision path instantiates A == T. All arguments
+// have been validated by the calling template
+template <typename A, typename T>
+rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle,
                                                 rocsparse_operation       trans,
                                                 rocsparse_int             m,
                                                 rocsparse_int             nnz,
                                                 const T*                  alpha,
                                                 const rocsparse_mat_descr descr,
-                                                const T*                  csr_val,
+                                                const A*                  csr_val,
                                                 const rocsparse_int*      csr_row_ptr,
                                                 const rocsparse_int*      csr_col_ind,
                                                 rocsparse_mat_info        info,
@@ -601,28 +1233,1011 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                                 rocsparse_solve_policy    policy,
                                                 void*                     temp_buffer)
 {
-    // Check for valid handle and matrix descriptor
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-    else if(descr == nullptr)
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    // done array
+    int* done_array = reinterpret_cast<int*>(ptr);
+
+    rocsparse_csrtr_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsv_upper_info
+                                     : info->csrsv_lower_info;
+
+    if(csrsv == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
-    else if(info == nullptr)
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        return rocsparse_status_invalid_pointer;
+        hipLaunchKernelGGL(
+            (csrsv_reset_zero_pivot_kernel), dim3(1), dim3(1), 0, stream, csrsv->zero_pivot);
     }
 
-    // Logging
-    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    // Reciprocal diagonal cached by the analysis. It is only valid if it has
+    // been computed from the value array of this solve, meta data re-used
+    // from a values-agnostic analysis or applied to different values falls
+    // back to the in-loop division
+    const A* inv_diag = (csrsv->inv_diag_val == csr_val)
+                            ? reinterpret_cast<const A*>(csrsv->inv_diag)
+                            : nullptr;
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    // Transposed solve, driven by the stored (non transposed) pattern such
+    // that no transposed factor has to be materialized. The rows of the
+    // stored factor are the columns of the transposed factor, each column
+    // finalizes its own right-hand side entry and scatters updates into the
+    // entries of the remaining columns. Processing the levels of the non
+    // transposed dependency graph from the deepest to the shallowest
+    // resolves all reverse dependencies, as every column that updates
+    // column j lies in a strictly deeper level. This requires the level
+    // meta data, the solve policy is ignored as neither the spin loop nor
+    // the Jacobi kernel can gather along columns.
+    if(trans == rocsparse_operation_transpose
+       || trans == rocsparse_operation_conjugate_transpose)
     {
-        log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsv"),
-                  trans,
-                  m,
-                  nnz,
+        // Real valued precisions, conjugate transpose equals transpose
+        if(csrsv->nlevels <= 0)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        // Initialize the right-hand side with alpha * x
+        dim3 init_blocks((m - 1) / CSRSV_DIM + 1);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrsv_t_init_device_pointer<T, CSRSV_DIM>),
+                               init_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               x,
+                               y);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrsv_t_init_host_pointer<T, CSRSV_DIM>),
+                               init_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               x,
+                               y);
+        }
+
+        for(rocsparse_int level = csrsv->nlevels - 1; level >= 0; --level)
+        {
+            rocsparse_int offset = csrsv->level_ptr[level];
+            rocsparse_int nrows  = csrsv->level_ptr[level + 1] - offset;
+
+            // Skip empty levels
+            if(nrows == 0)
+            {
+                continue;
+            }
+
+            dim3 level_blocks((handle->wavefront_size * nrows - 1) / CSRSV_DIM + 1);
+
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((csrsv_t_level_kernel<A, T, CSRSV_DIM, 32>),
+                                   level_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   nrows,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   inv_diag,
+                                   csrsv->csr_diag_ind,
+                                   y,
+                                   csrsv->row_map,
+                                   offset,
+                                   csrsv->zero_pivot,
+                                   descr->base,
+                                   descr->fill_mode,
+                                   descr->diag_type);
+            }
+            else if(handle->wavefront_size == 64)
+            {
+                hipLaunchKernelGGL((csrsv_t_level_kernel<A, T, CSRSV_DIM, 64>),
+                                   level_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   nrows,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   inv_diag,
+                                   csrsv->csr_diag_ind,
+                                   y,
+                                   csrsv->row_map,
+                                   offset,
+                                   csrsv->zero_pivot,
+                                   descr->base,
+                                   descr->fill_mode,
+                                   descr->diag_type);
+            }
+            else
+            {
+                return rocsparse_status_arch_mismatch;
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Jacobi based solve policy, approximate the solution by a fixed number
+    // of fully parallel Jacobi sweeps on the triangular system, instead of
+    // resolving the dependencies between the rows. The first sweep starts
+    // from the zero vector, such that it yields the diagonally scaled
+    // right-hand side as initial guess.
+    if(policy == rocsparse_solve_policy_jacobi)
+    {
+#define CSRSV_JACOBI_SWEEPS 5
+        // Approximation of y from the previous sweep, the buffer space of the
+        // unused done array and workspace is large enough to hold it
+        T* y_tmp = reinterpret_cast<T*>(ptr);
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(y_tmp, 0, sizeof(T) * m, stream));
+
+        for(rocsparse_int sweep = 0; sweep < CSRSV_JACOBI_SWEEPS; ++sweep)
+        {
+            // Ping pong between the temporary array and y, the odd number of
+            // sweeps ends on y
+            const T* y_in  = (sweep % 2 == 0) ? y_tmp : y;
+            T*       y_out = (sweep % 2 == 0) ? y : y_tmp;
+
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                // rocsparse_pointer_mode_device
+                if(handle->wavefront_size == 32)
+                {
+                    hipLaunchKernelGGL((csrsv_jacobi_device_pointer<A, T, CSRSV_DIM, 32>),
+                                       csrsv_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       csrsv->csr_diag_ind,
+                                       x,
+                                       y_in,
+                                       y_out,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else if(handle->wavefront_size == 64)
+                {
+                    hipLaunchKernelGGL((csrsv_jacobi_device_pointer<A, T, CSRSV_DIM, 64>),
+                                       csrsv_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       csrsv->csr_diag_ind,
+                                       x,
+                                       y_in,
+                                       y_out,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else
+                {
+                    return rocsparse_status_arch_mismatch;
+                }
+            }
+            else
+            {
+                // rocsparse_pointer_mode_host
+                if(handle->wavefront_size == 32)
+                {
+                    hipLaunchKernelGGL((csrsv_jacobi_host_pointer<A, T, CSRSV_DIM, 32>),
+                                       csrsv_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       *alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       csrsv->csr_diag_ind,
+                                       x,
+                                       y_in,
+                                       y_out,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else if(handle->wavefront_size == 64)
+                {
+                    hipLaunchKernelGGL((csrsv_jacobi_host_pointer<A, T, CSRSV_DIM, 64>),
+                                       csrsv_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       m,
+                                       *alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       csrsv->csr_diag_ind,
+                                       x,
+                                       y_in,
+                                       y_out,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else
+                {
+                    return rocsparse_status_arch_mismatch;
+                }
+            }
+        }
+#undef CSRSV_JACOBI_SWEEPS
+
+        return rocsparse_status_success;
+    }
+
+    // Level based solve policy, launch one kernel per dependency level such
+    // that no wavefront has to spin wait on its dependencies. This can be
+    // beneficial for matrices with long dependency chains. If no level meta
+    // data is available, e.g. when re-using analysis data gathered by a
+    // routine that does not extract levels, we fall back to the spin loop
+    // based kernel.
+    if(policy == rocsparse_solve_policy_level && csrsv->nlevels > 0)
+    {
+        for(rocsparse_int level = 0; level < csrsv->nlevels; ++level)
+        {
+            rocsparse_int offset = csrsv->level_ptr[level];
+            rocsparse_int nrows  = csrsv->level_ptr[level + 1] - offset;
+
+            // Skip empty levels
+            if(nrows == 0)
+            {
+                continue;
+            }
+
+            dim3 level_blocks((handle->wavefront_size * nrows - 1) / CSRSV_DIM + 1);
+
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                // rocsparse_pointer_mode_device
+                if(handle->wavefront_size == 32)
+                {
+                    hipLaunchKernelGGL((csrsv_level_device_pointer<A, T, CSRSV_DIM, 32>),
+                                       level_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       nrows,
+                                       alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       x,
+                                       y,
+                                       csrsv->row_map,
+                                       offset,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else if(handle->wavefront_size == 64)
+                {
+                    hipLaunchKernelGGL((csrsv_level_device_pointer<A, T, CSRSV_DIM, 64>),
+                                       level_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       nrows,
+                                       alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       x,
+                                       y,
+                                       csrsv->row_map,
+                                       offset,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else
+                {
+                    return rocsparse_status_arch_mismatch;
+                }
+            }
+            else
+            {
+                // rocsparse_pointer_mode_host
+                if(handle->wavefront_size == 32)
+                {
+                    hipLaunchKernelGGL((csrsv_level_host_pointer<A, T, CSRSV_DIM, 32>),
+                                       level_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       nrows,
+                                       *alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       x,
+                                       y,
+                                       csrsv->row_map,
+                                       offset,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else if(handle->wavefront_size == 64)
+                {
+                    hipLaunchKernelGGL((csrsv_level_host_pointer<A, T, CSRSV_DIM, 64>),
+                                       level_blocks,
+                                       csrsv_threads,
+                                       0,
+                                       stream,
+                                       nrows,
+                                       *alpha,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       inv_diag,
+                                       x,
+                                       y,
+                                       csrsv->row_map,
+                                       offset,
+                                       csrsv->zero_pivot,
+                                       descr->base,
+                                       descr->fill_mode,
+                                       descr->diag_type);
+                }
+                else
+                {
+                    return rocsparse_status_arch_mismatch;
+                }
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Small factors are solved by a single persistent workgroup that keeps
+    // y and the done flags of all rows in LDS, such that the dependency
+    // spin loops and the gathers of resolved entries avoid the global
+    // memory latency that dominates these latency critical solves. The
+    // factor values are read once each and remain streamed from global
+    // memory, hence only y and the flags have to fit the LDS budget
+    size_t lds_size = (sizeof(T) + sizeof(int)) * m;
+
+    if(lds_size + 1024 <= handle->properties.sharedMemPerBlock)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            // rocsparse_pointer_mode_device
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((csrsv_lds_device_pointer<A, T, CSRSV_DIM, 32>),
+                                   dim3(1),
+                                   csrsv_threads,
+                                   lds_size,
+                                   stream,
+                                   m,
+                                   alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   inv_diag,
+                                   x,
+                                   y,
+                                   csrsv->row_map,
+                                   csrsv->zero_pivot,
+                                   descr->base,
+                                   descr->fill_mode,
+                                   descr->diag_type);
+            }
+            else if(handle->wavefront_size == 64)
+            {
+                hipLaunchKernelGGL((csrsv_lds_device_pointer<A, T, CSRSV_DIM, 64>),
+                                   dim3(1),
+                                   csrsv_threads,
+                                   lds_size,
+                                   stream,
+                                   m,
+                                   alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   inv_diag,
+                                   x,
+                                   y,
+                                   csrsv->row_map,
+                                   csrsv->zero_pivot,
+                                   descr->base,
+                                   descr->fill_mode,
+                                   descr->diag_type);
+            }
+            else
+            {
+                return rocsparse_status_arch_mismatch;
+            }
+        }
+        else
+        {
+            // rocsparse_pointer_mode_host
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((csrsv_lds_host_pointer<A, T, CSRSV_DIM, 32>),
+                                   dim3(1),
+                                   csrsv_threads,
+                                   lds_size,
+                                   stream,
+                                   m,
+                                   *alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   inv_diag,
+                                   x,
+                                   y,
+                                   csrsv->row_map,
+                                   csrsv->zero_pivot,
+                                   descr->base,
+                                   descr->fill_mode,
+                                   descr->diag_type);
+            }
+            else if(handle->wavefront_size == 64)
+            {
+                hipLaunchKernelGGL((csrsv_lds_host_pointer<A, T, CSRSV_DIM, 64>),
+                                   dim3(1),
+                                   csrsv_threads,
+                                   lds_size,
+                                   stream,
+                                   m,
+                                   *alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   inv_diag,
+                                   x,
+                                   y,
+                                   csrsv->row_map,
+                                   csrsv->zero_pivot,
+                                   descr->base,
+                                   descr->fill_mode,
+                                   descr->diag_type);
+            }
+            else
+            {
+                return rocsparse_status_arch_mismatch;
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsv_device_pointer<A, T, CSRSV_DIM, 32>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               done_array,
+                               csrsv->row_map,
+                               0,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsv_device_pointer<A, T, CSRSV_DIM, 64>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               done_array,
+                               csrsv->row_map,
+                               0,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsv_host_pointer<A, T, CSRSV_DIM, 32>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               done_array,
+                               csrsv->row_map,
+                               0,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsv_host_pointer<A, T, CSRSV_DIM, 64>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               done_array,
+                               csrsv->row_map,
+                               0,
+                               csrsv->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRSV_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const T*                  x,
+                                                T*                        y,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsv"),
+                  trans,
+                  m,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)y,
+                  policy,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrsv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "--alpha",
+                  *alpha);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsv"),
+                  trans,
+                  m,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)y,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_level
+       && policy != rocsparse_solve_policy_jacobi)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xcsrsv_solve");
+
+    return rocsparse_csrsv_solve_dispatch<T, T>(handle,
+                                                trans,
+                                                m,
+                                                nnz,
+                                                alpha,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                info,
+                                                x,
+                                                y,
+                                                policy,
+                                                temp_buffer);
+}
+
+// Mixed precision triangular solve. The factor values are stored in type A
+// and the substitution, including the diagonal inversion, is carried out in
+// type T. This allows e.g. fp32 stored incomplete factorizations to
+// precondition an fp64 solver without materializing an fp64 copy of the
+// factors. The analysis is precision agnostic, meta data gathered by the
+// uniform precision analysis routines can be re-used
+template <typename A, typename T>
+rocsparse_status rocsparse_csrsv_solve_mixed_template(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const T*                  alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const A*                  csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      const T*                  x,
+                                                      T*                        y,
+                                                      rocsparse_solve_policy    policy,
+                                                      void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Build routine name for logging, e.g. rocsparse_sdcsrsv_solve for
+    // single precision storage with double precision compute
+    std::string name = "rocsparse_";
+    name += std::is_same<A, float>::value ? "s" : "d";
+    name += std::is_same<T, double>::value ? "d" : "s";
+    name += "csrsv_solve";
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  name,
+                  trans,
+                  m,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)y,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+    else
+    {
+        log_trace(handle,
+                  name,
+                  trans,
+                  m,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)y,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_level
+       && policy != rocsparse_solve_policy_jacobi)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csrsv_solve_dispatch<A, T>(handle,
+                                                trans,
+                                                m,
+                                                nnz,
+                                                alpha,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                info,
+                                                x,
+                                                y,
+                                                policy,
+                                                temp_buffer);
+}
+
+// Fused triangular solve of an ILU0 style factorization, i.e.
+// y = U^-1 * L^-1 * (alpha * x) in a single kernel launch. Both solves run
+// in the same grid and each upper solve row spins on the lower solve
+// completion flag of its own right-hand side entry, such that the upper
+// solve starts as soon as its lower dependencies are resolved, instead of
+// draining the whole lower solve at a kernel boundary. The intermediate
+// vector is consumed shortly after it is produced and typically remains
+// cache resident. The analysis meta data of both triangles is required,
+// gathered by csrsv_analysis with a lower and an upper fill mode descriptor
+template <typename T>
+rocsparse_status rocsparse_csrsv_lu_solve_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   const T*                  x,
+                                                   T*                        y,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsv_lu_solve"),
+                  trans,
+                  m,
+                  nnz,
                   *alpha,
                   (const void*&)descr,
                   (const void*&)csr_val,
@@ -631,31 +2246,330 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                   (const void*&)info,
                   (const void*&)x,
                   (const void*&)y,
-                  policy,
                   (const void*&)temp_buffer);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsv_lu_solve"),
+                  trans,
+                  m,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)y,
+                  (const void*&)temp_buffer);
+    }
 
-        log_bench(handle,
-                  "./rocsparse-bench -f csrsv -r",
-                  replaceX<T>("X"),
-                  "--mtx <matrix.mtx> ",
-                  "--alpha",
-                  *alpha);
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // The fused solve gathers along rows in both phases
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Both triangles must have been analyzed
+    rocsparse_csrtr_info lower = info->csrsv_lower_info;
+    rocsparse_csrtr_info upper = info->csrsv_upper_info;
+
+    if(lower == nullptr || upper == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer, the done array and workspace regions of the analysis buffer
+    // hold the two completion flag arrays
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    int* done_lower = reinterpret_cast<int*>(ptr);
+    ptr += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    int* done_upper = reinterpret_cast<int*>(ptr);
+
+    // Workspace for the intermediate vector of the lower solve
+    T* z;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(T) * m, (void**)&z));
+
+    // The lower factor is applied with a unit diagonal, re-initialize its
+    // zero pivot to remove structural zeros
+    hipLaunchKernelGGL(
+        (csrsv_reset_zero_pivot_kernel), dim3(1), dim3(1), 0, stream, lower->zero_pivot);
+
+    // Reciprocal diagonal of the upper factor cached by the analysis. It is
+    // only valid if it has been computed from the value array of this solve,
+    // meta data re-used from a values-agnostic analysis or applied to
+    // different values falls back to the in-loop division
+    const T* inv_diag = (upper->inv_diag_val == csr_val)
+                            ? reinterpret_cast<const T*>(upper->inv_diag)
+                            : nullptr;
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_lower, 0, sizeof(int) * m, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_upper, 0, sizeof(int) * m, stream));
+
+#define CSRSV_DIM 1024
+    // One wavefront per lower solve row and one per upper solve row
+    dim3 csrsv_blocks((handle->wavefront_size * 2 * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsv_lu_device_pointer<T, CSRSV_DIM, 32>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               z,
+                               done_lower,
+                               done_upper,
+                               lower->row_map,
+                               upper->row_map,
+                               upper->zero_pivot,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsv_lu_device_pointer<T, CSRSV_DIM, 64>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               z,
+                               done_lower,
+                               done_upper,
+                               lower->row_map,
+                               upper->row_map,
+                               upper->zero_pivot,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsv_lu_host_pointer<T, CSRSV_DIM, 32>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               z,
+                               done_lower,
+                               done_upper,
+                               lower->row_map,
+                               upper->row_map,
+                               upper->zero_pivot,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsv_lu_host_pointer<T, CSRSV_DIM, 64>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               inv_diag,
+                               x,
+                               y,
+                               z,
+                               done_lower,
+                               done_upper,
+                               lower->row_map,
+                               upper->row_map,
+                               upper->zero_pivot,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRSV_DIM
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(z));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsv_solve_batched_template(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const T*                  alpha,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        rocsparse_int             batch_stride,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        const T*                  x,
+                                                        rocsparse_int             x_stride,
+                                                        T*                        y,
+                                                        rocsparse_int             y_stride,
+                                                        rocsparse_int             batch_count,
+                                                        rocsparse_solve_policy    policy,
+                                                        void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsv_solve_batched"),
+                  trans,
+                  m,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  batch_stride,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  x_stride,
+                  (const void*&)y,
+                  y_stride,
+                  batch_count,
+                  policy,
+                  (const void*&)temp_buffer);
     }
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsv"),
+                  replaceX<T>("rocsparse_Xcsrsv_solve_batched"),
                   trans,
                   m,
                   nnz,
                   (const void*&)alpha,
                   (const void*&)descr,
                   (const void*&)csr_val,
+                  batch_stride,
                   (const void*&)csr_row_ptr,
                   (const void*&)csr_col_ind,
                   (const void*&)info,
                   (const void*&)x,
+                  x_stride,
                   (const void*&)y,
+                  y_stride,
+                  batch_count,
                   policy,
                   (const void*&)temp_buffer);
     }
@@ -671,6 +2585,13 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         return rocsparse_status_not_implemented;
     }
 
+    // Check solve policy, the batched routine processes all matrices
+    // concurrently and does not support level scheduling
+    if(policy != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -680,9 +2601,25 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     {
         return rocsparse_status_invalid_size;
     }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(x_stride < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(y_stride < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
 
     // Quick return if possible
-    if(m == 0 || nnz == 0)
+    if(m == 0 || nnz == 0 || batch_count == 0)
     {
         return rocsparse_status_success;
     }
@@ -725,12 +2662,9 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
 
     ptr += 256;
 
-    // done array
+    // done array, one set of flags per matrix of the batch
     int* done_array = reinterpret_cast<int*>(ptr);
 
-    // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
-
     rocsparse_csrtr_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
                                      ? info->csrsv_upper_info
                                      : info->csrsv_lower_info;
@@ -743,16 +2677,17 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            csrsv->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        hipLaunchKernelGGL(
+            (csrsv_reset_zero_pivot_kernel), dim3(1), dim3(1), 0, stream, csrsv->zero_pivot);
     }
 
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m * batch_count, stream));
+
+// The batch dimension is mapped to the second grid dimension, such that all
+// matrices of the batch are processed concurrently across the workgroups
 #define CSRSV_DIM 1024
-    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1, batch_count);
     dim3 csrsv_threads(CSRSV_DIM);
 
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -760,7 +2695,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         // rocsparse_pointer_mode_device
         if(handle->wavefront_size == 32)
         {
-            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 32>),
+            hipLaunchKernelGGL((csrsv_batched_device_pointer<T, T, CSRSV_DIM, 32>),
                                csrsv_blocks,
                                csrsv_threads,
                                0,
@@ -770,11 +2705,13 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
+                               batch_stride,
                                x,
+                               x_stride,
                                y,
+                               y_stride,
                                done_array,
                                csrsv->row_map,
-                               0,
                                csrsv->zero_pivot,
                                descr->base,
                                descr->fill_mode,
@@ -782,7 +2719,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         }
         else if(handle->wavefront_size == 64)
         {
-            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64>),
+            hipLaunchKernelGGL((csrsv_batched_device_pointer<T, T, CSRSV_DIM, 64>),
                                csrsv_blocks,
                                csrsv_threads,
                                0,
@@ -792,11 +2729,13 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
+                               batch_stride,
                                x,
+                               x_stride,
                                y,
+                               y_stride,
                                done_array,
                                csrsv->row_map,
-                               0,
                                csrsv->zero_pivot,
                                descr->base,
                                descr->fill_mode,
@@ -812,7 +2751,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         // rocsparse_pointer_mode_host
         if(handle->wavefront_size == 32)
         {
-            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 32>),
+            hipLaunchKernelGGL((csrsv_batched_host_pointer<T, T, CSRSV_DIM, 32>),
                                csrsv_blocks,
                                csrsv_threads,
                                0,
@@ -822,11 +2761,13 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
+                               batch_stride,
                                x,
+                               x_stride,
                                y,
+                               y_stride,
                                done_array,
                                csrsv->row_map,
-                               0,
                                csrsv->zero_pivot,
                                descr->base,
                                descr->fill_mode,
@@ -834,7 +2775,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         }
         else if(handle->wavefront_size == 64)
         {
-            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64>),
+            hipLaunchKernelGGL((csrsv_batched_host_pointer<T, T, CSRSV_DIM, 64>),
                                csrsv_blocks,
                                csrsv_threads,
                                0,
@@ -844,11 +2785,13 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
+                               batch_stride,
                                x,
+                               x_stride,
                                y,
+                               y_stride,
                                done_array,
                                csrsv->row_map,
-                               0,
                                csrsv->zero_pivot,
                                descr->base,
                                descr->fill_mode,
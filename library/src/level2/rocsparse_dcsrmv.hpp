@@ -0,0 +1,296 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_DCSRMV_HPP
+#define ROCSPARSE_DCSRMV_HPP
+
+#include "dcsrmv_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void dcsrmv_scale_kernel(rocsparse_int m, const T* __restrict__ beta, T* __restrict__ y)
+{
+    if(*beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    dcsrmv_scale_device<T>(m, *beta, y);
+}
+
+template <typename T, rocsparse_int WF_SIZE>
+__global__ void dcsrmvn_general_kernel(rocsparse_int mc,
+                                       const T*      alpha,
+                                       const rocsparse_int* __restrict__ dcsr_row_ind,
+                                       const rocsparse_int* __restrict__ dcsr_row_ptr,
+                                       const rocsparse_int* __restrict__ dcsr_col_ind,
+                                       const T* __restrict__ dcsr_val,
+                                       const T* __restrict__ x,
+                                       T* __restrict__ y,
+                                       rocsparse_index_base idx_base)
+{
+    if(*alpha == static_cast<T>(0))
+    {
+        return;
+    }
+
+    dcsrmvn_general_device<T, WF_SIZE>(
+        mc, *alpha, dcsr_row_ind, dcsr_row_ptr, dcsr_col_ind, dcsr_val, x, y, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_dcsrmv_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_dcsr_mat  dcsr,
+                                           const T*                  x,
+                                           const T*                  beta,
+                                           T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dcsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xdcsrmv"),
+                  trans,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)dcsr,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f dcsrmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xdcsrmv"),
+                  trans,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)dcsr,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(dcsr->m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(dcsr->n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(dcsr->mc < 0 || dcsr->mc > dcsr->m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(dcsr->nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check DCSR structure
+    if(dcsr->nnz > 0)
+    {
+        if(dcsr->dcsr_row_ind == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(dcsr->dcsr_row_ptr == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(dcsr->dcsr_col_ind == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(dcsr->dcsr_val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(dcsr->m == 0 || dcsr->n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Quick return before staging the scalars
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    const T* d_alpha = nullptr;
+    const T* d_beta  = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define DCSRMV_DIM 512
+    // Scale all m rows of y by beta. The accumulation below only touches the
+    // non-empty rows, while beta also applies to the rows without non-zeros
+    hipLaunchKernelGGL((dcsrmv_scale_kernel<T>),
+                       dim3((dcsr->m - 1) / DCSRMV_DIM + 1),
+                       dim3(DCSRMV_DIM),
+                       0,
+                       stream,
+                       dcsr->m,
+                       d_beta,
+                       y);
+
+    // Accumulate alpha * A * x over the non-empty rows only
+    if(dcsr->mc > 0 && dcsr->nnz > 0)
+    {
+        dim3 dcsrmv_blocks((dcsr->mc - 1) / DCSRMV_DIM + 1);
+        dim3 dcsrmv_threads(DCSRMV_DIM);
+
+        // Select the wavefront size by the average number of non-zeros
+        // per non-empty row
+        rocsparse_int nnz_per_row = dcsr->nnz / dcsr->mc;
+
+        if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+#define LAUNCH_DCSRMVN_GENERAL(wfsize)                         \
+    hipLaunchKernelGGL((dcsrmvn_general_kernel<T, wfsize>),    \
+                       dcsrmv_blocks,                          \
+                       dcsrmv_threads,                         \
+                       0,                                      \
+                       stream,                                 \
+                       dcsr->mc,                               \
+                       d_alpha,                                \
+                       dcsr->dcsr_row_ind,                     \
+                       dcsr->dcsr_row_ptr,                     \
+                       dcsr->dcsr_col_ind,                     \
+                       reinterpret_cast<const T*>(dcsr->dcsr_val), \
+                       x,                                      \
+                       y,                                      \
+                       descr->base)
+
+        if(nnz_per_row < 4)
+        {
+            LAUNCH_DCSRMVN_GENERAL(2);
+        }
+        else if(nnz_per_row < 8)
+        {
+            LAUNCH_DCSRMVN_GENERAL(4);
+        }
+        else if(nnz_per_row < 16)
+        {
+            LAUNCH_DCSRMVN_GENERAL(8);
+        }
+        else if(nnz_per_row < 32)
+        {
+            LAUNCH_DCSRMVN_GENERAL(16);
+        }
+        else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+        {
+            LAUNCH_DCSRMVN_GENERAL(32);
+        }
+        else
+        {
+            LAUNCH_DCSRMVN_GENERAL(64);
+        }
+#undef LAUNCH_DCSRMVN_GENERAL
+    }
+#undef DCSRMV_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_DCSRMV_HPP
@@ -0,0 +1,53 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_distmv.hpp"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_sdistmv(rocsparse_handle*        handles,
+                                              rocsparse_operation      trans,
+                                              const float*             alpha,
+                                              const rocsparse_dist_mat dist,
+                                              const float* const*      x,
+                                              const float*             beta,
+                                              float* const*            y)
+{
+    return rocsparse_distmv_template(handles, trans, alpha, dist, x, beta, y);
+}
+
+extern "C" rocsparse_status rocsparse_ddistmv(rocsparse_handle*        handles,
+                                              rocsparse_operation      trans,
+                                              const double*            alpha,
+                                              const rocsparse_dist_mat dist,
+                                              const double* const*     x,
+                                              const double*            beta,
+                                              double* const*           y)
+{
+    return rocsparse_distmv_template(handles, trans, alpha, dist, x, beta, y);
+}
@@ -0,0 +1,328 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_DISTMV_HPP
+#define ROCSPARSE_DISTMV_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_csrmv.hpp"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void distmv_gather_kernel(rocsparse_int size,
+                                     const T* __restrict__ x,
+                                     const rocsparse_int* __restrict__ ind,
+                                     T* __restrict__ buf)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    buf[gid] = x[ind[gid]];
+}
+
+// Device pointer to the constant one of the handle, such that the boundary
+// SpMV can accumulate with beta == 1 in both pointer modes
+template <typename T>
+static const T* rocsparse_dist_one(rocsparse_handle handle);
+
+template <>
+inline const float* rocsparse_dist_one<float>(rocsparse_handle handle)
+{
+    static const float h_one = 1.0f;
+
+    return handle->pointer_mode == rocsparse_pointer_mode_device ? handle->sone : &h_one;
+}
+
+template <>
+inline const double* rocsparse_dist_one<double>(rocsparse_handle handle)
+{
+    static const double h_one = 1.0;
+
+    return handle->pointer_mode == rocsparse_pointer_mode_device ? handle->done : &h_one;
+}
+
+template <typename T>
+rocsparse_status rocsparse_distmv_template(rocsparse_handle*        handles,
+                                           rocsparse_operation      trans,
+                                           const T*                 alpha,
+                                           const rocsparse_dist_mat dist,
+                                           const T* const*          x,
+                                           const T*                 beta,
+                                           T* const*                y)
+{
+    // Check for valid handles and matrix
+    if(handles == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(dist == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    for(rocsparse_int p = 0; p < dist->ndevice; ++p)
+    {
+        if(handles[p] == nullptr)
+        {
+            return rocsparse_status_invalid_handle;
+        }
+    }
+
+    // Logging
+    log_trace(handles[0],
+              replaceX<T>("rocsparse_Xdistmv"),
+              trans,
+              (const void*&)alpha,
+              (const void*&)dist,
+              (const void*&)x,
+              (const void*&)beta,
+              (const void*&)y);
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(dist->m == 0 || dist->nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    for(rocsparse_int p = 0; p < dist->ndevice; ++p)
+    {
+        if(x[p] == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(y[p] == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // The boundary SpMV passes the staged one constant as beta, which is
+    // allocated on first use
+    for(rocsparse_int p = 0; p < dist->ndevice; ++p)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handles[p]->ensure_device_memory());
+    }
+
+    // Profile the operation ; the matrix data, x and y are each moved once,
+    // the halo entries twice
+    rocsparse_profile_scope<T> profile(
+        handles[0],
+        "rocsparse_Xdistmv",
+        static_cast<double>(sizeof(T)) * (dist->nnz + dist->n + 2.0 * dist->m)
+            + static_cast<double>(sizeof(rocsparse_int)) * (dist->nnz + dist->m + 1.0));
+
+    rocsparse_roctx_scope<T> roctx(handles[0], "rocsparse_Xdistmv");
+
+    // Save the active device
+    int current_device;
+    RETURN_IF_HIP_ERROR(hipGetDevice(&current_device));
+
+    // Start the halo exchange ; each partition gathers the x entries the
+    // other partitions need into a staging buffer and sends them through a
+    // direct peer copy, all on the communication stream, such that the
+    // exchange overlaps the interior SpMV on the handle stream
+    for(rocsparse_int p = 0; p < dist->ndevice; ++p)
+    {
+        _rocsparse_dist_mat_part& part = dist->parts[p];
+
+        RETURN_IF_HIP_ERROR(hipSetDevice(part.device));
+
+        // The communication stream may not read x before the handle stream
+        // has produced it
+        RETURN_IF_HIP_ERROR(hipEventRecord(part.x_ready, handles[p]->stream));
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(part.comm_stream, part.x_ready, 0));
+
+        for(rocsparse_int r = 0; r < dist->ndevice; ++r)
+        {
+            _rocsparse_dist_mat_part& recv = dist->parts[r];
+
+            if(r == p)
+            {
+                continue;
+            }
+
+            rocsparse_int count = recv.halo_off[p + 1] - recv.halo_off[p];
+
+            if(count == 0)
+            {
+                continue;
+            }
+
+            // The halo buffer may still be read by the boundary SpMV of the
+            // previous operation
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(part.comm_stream, recv.halo_done, 0));
+
+#define DISTMV_GATHER_DIM 256
+            hipLaunchKernelGGL((distmv_gather_kernel<T>),
+                               dim3((count - 1) / DISTMV_GATHER_DIM + 1),
+                               dim3(DISTMV_GATHER_DIM),
+                               0,
+                               part.comm_stream,
+                               count,
+                               x[p],
+                               recv.gather_ind[p],
+                               (T*)recv.gather_buf[p]);
+#undef DISTMV_GATHER_DIM
+
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyPeerAsync((T*)recv.halo_x + recv.halo_off[p],
+                                   recv.device,
+                                   recv.gather_buf[p],
+                                   part.device,
+                                   sizeof(T) * count,
+                                   part.comm_stream));
+        }
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(part.halo_sent, part.comm_stream));
+    }
+
+    // Interior SpMV, overlapping the halo exchange
+    for(rocsparse_int p = 0; p < dist->ndevice; ++p)
+    {
+        _rocsparse_dist_mat_part& part = dist->parts[p];
+
+        rocsparse_int local_m = part.row_end - part.row_begin;
+
+        RETURN_IF_HIP_ERROR(hipSetDevice(part.device));
+
+        if(part.int_nnz > 0)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template<T>(handles[p],
+                                                                  trans,
+                                                                  local_m,
+                                                                  local_m,
+                                                                  part.int_nnz,
+                                                                  alpha,
+                                                                  &dist->descr,
+                                                                  (const T*)part.int_val,
+                                                                  part.int_row_ptr,
+                                                                  part.int_col_ind,
+                                                                  nullptr,
+                                                                  x[p],
+                                                                  beta,
+                                                                  y[p]));
+        }
+        else
+        {
+            // The partition has no interior entries, y must still be scaled
+            // by beta
+            const T* d_beta;
+            const T* d_dummy;
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                handles[p]->stage_scalars(beta, beta, &d_beta, &d_dummy));
+
+            hipLaunchKernelGGL((csrmv_scale_kernel<T>),
+                               dim3((local_m - 1) / 1024 + 1),
+                               dim3(1024),
+                               0,
+                               handles[p]->stream,
+                               local_m,
+                               d_beta,
+                               y[p]);
+        }
+    }
+
+    // Boundary SpMV, accumulating the halo contributions into y once the
+    // exchange has arrived
+    for(rocsparse_int p = 0; p < dist->ndevice; ++p)
+    {
+        _rocsparse_dist_mat_part& part = dist->parts[p];
+
+        rocsparse_int local_m = part.row_end - part.row_begin;
+
+        RETURN_IF_HIP_ERROR(hipSetDevice(part.device));
+
+        for(rocsparse_int q = 0; q < dist->ndevice; ++q)
+        {
+            if(q == p || part.halo_off[q + 1] == part.halo_off[q])
+            {
+                continue;
+            }
+
+            RETURN_IF_HIP_ERROR(
+                hipStreamWaitEvent(handles[p]->stream, dist->parts[q].halo_sent, 0));
+        }
+
+        if(part.bnd_nnz > 0)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template<T>(handles[p],
+                                                                  trans,
+                                                                  local_m,
+                                                                  part.halo_size,
+                                                                  part.bnd_nnz,
+                                                                  alpha,
+                                                                  &dist->descr,
+                                                                  (const T*)part.bnd_val,
+                                                                  part.bnd_row_ptr,
+                                                                  part.bnd_col_ind,
+                                                                  nullptr,
+                                                                  (const T*)part.halo_x,
+                                                                  rocsparse_dist_one<T>(handles[p]),
+                                                                  y[p]));
+        }
+
+        // The halo buffer may be overwritten by the next operation once the
+        // boundary SpMV has finished
+        RETURN_IF_HIP_ERROR(hipEventRecord(part.halo_done, handles[p]->stream));
+    }
+
+    RETURN_IF_HIP_ERROR(hipSetDevice(current_device));
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_DISTMV_HPP
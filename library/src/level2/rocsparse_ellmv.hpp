@@ -37,6 +37,7 @@ template <typename T>
 __global__ void ellmvn_kernel_host_pointer(rocsparse_int m,
                                            rocsparse_int n,
                                            rocsparse_int ell_width,
+                                           rocsparse_int ell_pitch,
                                            T             alpha,
                                            const rocsparse_int* __restrict__ ell_col_ind,
                                            const T* __restrict__ ell_val,
@@ -45,13 +46,14 @@ __global__ void ellmvn_kernel_host_pointer(rocsparse_int m,
                                            T* __restrict__ y,
                                            rocsparse_index_base idx_base)
 {
-    ellmvn_device(m, n, ell_width, alpha, ell_col_ind, ell_val, x, beta, y, idx_base);
+    ellmvn_device(m, n, ell_width, ell_pitch, alpha, ell_col_ind, ell_val, x, beta, y, idx_base);
 }
 
 template <typename T>
 __global__ void ellmvn_kernel_device_pointer(rocsparse_int m,
                                              rocsparse_int n,
                                              rocsparse_int ell_width,
+                                             rocsparse_int ell_pitch,
                                              const T*      alpha,
                                              const rocsparse_int* __restrict__ ell_col_ind,
                                              const T* __restrict__ ell_val,
@@ -60,7 +62,29 @@ __global__ void ellmvn_kernel_device_pointer(rocsparse_int m,
                                              T* __restrict__ y,
                                              rocsparse_index_base idx_base)
 {
-    ellmvn_device(m, n, ell_width, *alpha, ell_col_ind, ell_val, x, *beta, y, idx_base);
+    ellmvn_device(m, n, ell_width, ell_pitch, *alpha, ell_col_ind, ell_val, x, *beta, y, idx_base);
+}
+
+template <typename T>
+__global__ void ellmvt_kernel(rocsparse_int m,
+                              rocsparse_int n,
+                              rocsparse_int ell_width,
+                              rocsparse_int ell_pitch,
+                              const T*      alpha,
+                              const rocsparse_int* __restrict__ ell_col_ind,
+                              const T* __restrict__ ell_val,
+                              const T* __restrict__ x,
+                              T* __restrict__ y,
+                              rocsparse_index_base idx_base)
+{
+    ellmvt_device(m, n, ell_width, ell_pitch, *alpha, ell_col_ind, ell_val, x, y, idx_base);
+}
+
+template <typename T>
+__global__ void
+    ellmv_scale_kernel(rocsparse_int size, const T* __restrict__ beta, T* __restrict__ data)
+{
+    ellmv_scale_device<T>(size, *beta, data);
 }
 
 template <typename T>
@@ -193,9 +217,21 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Profile the operation ; the matrix data, x and y are each moved once
+    rocsparse_profile_scope<T> profile(
+        handle,
+        "rocsparse_Xellmv",
+        static_cast<double>(sizeof(T)) * (static_cast<double>(m) * ell_width + n + 2.0 * m)
+            + static_cast<double>(sizeof(rocsparse_int)) * m * ell_width);
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xellmv");
+
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Slice pitch of the ELL storage
+    rocsparse_int ell_pitch = ell_get_pitch(descr, m);
+
     // Run different ellmv kernels
     if(trans == rocsparse_operation_none)
     {
@@ -213,6 +249,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
                                m,
                                n,
                                ell_width,
+                               ell_pitch,
                                alpha,
                                ell_col_ind,
                                ell_val,
@@ -236,6 +273,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
                                m,
                                n,
                                ell_width,
+                               ell_pitch,
                                *alpha,
                                ell_col_ind,
                                ell_val,
@@ -248,8 +286,53 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        // Transposed and conjugate transposed SpMV scatter into y, thus
+        // y has to be scaled by beta in advance. For real matrices, the
+        // conjugate transposed product coincides with the transposed
+        // product.
+#define ELLMVT_DIM 256
+        dim3 ellmvt_blocks((m - 1) / ELLMVT_DIM + 1);
+        dim3 ellmvt_threads(ELLMVT_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // Stage the scalars, such that a single kernel instantiation covers
+        // both pointer modes
+        const T* d_alpha;
+        const T* d_beta;
+
+        RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+        // Scale y with beta
+        hipLaunchKernelGGL((ellmv_scale_kernel<T>),
+                           dim3((n - 1) / 1024 + 1),
+                           dim3(1024),
+                           0,
+                           stream,
+                           n,
+                           d_beta,
+                           y);
+
+        hipLaunchKernelGGL((ellmvt_kernel<T>),
+                           ellmvt_blocks,
+                           ellmvt_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           ell_width,
+                           ell_pitch,
+                           d_alpha,
+                           ell_col_ind,
+                           ell_val,
+                           x,
+                           y,
+                           descr->base);
+#undef ELLMVT_DIM
     }
     return rocsparse_status_success;
 }
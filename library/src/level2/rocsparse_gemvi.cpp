@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gemvi.hpp"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_sgemvi(rocsparse_handle     handle,
+                                             rocsparse_operation  trans,
+                                             rocsparse_int        m,
+                                             rocsparse_int        n,
+                                             const float*         alpha,
+                                             const float*         A,
+                                             rocsparse_int        lda,
+                                             rocsparse_int        nnz,
+                                             const float*         x_val,
+                                             const rocsparse_int* x_ind,
+                                             const float*         beta,
+                                             float*               y,
+                                             rocsparse_index_base idx_base)
+{
+    return rocsparse_gemvi_template<float>(
+        handle, trans, m, n, alpha, A, lda, nnz, x_val, x_ind, beta, y, idx_base);
+}
+
+extern "C" rocsparse_status rocsparse_dgemvi(rocsparse_handle     handle,
+                                             rocsparse_operation  trans,
+                                             rocsparse_int        m,
+                                             rocsparse_int        n,
+                                             const double*        alpha,
+                                             const double*        A,
+                                             rocsparse_int        lda,
+                                             rocsparse_int        nnz,
+                                             const double*        x_val,
+                                             const rocsparse_int* x_ind,
+                                             const double*        beta,
+                                             double*              y,
+                                             rocsparse_index_base idx_base)
+{
+    return rocsparse_gemvi_template<double>(
+        handle, trans, m, n, alpha, A, lda, nnz, x_val, x_ind, beta, y, idx_base);
+}
@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_GEMVI_HPP
+#define ROCSPARSE_GEMVI_HPP
+
+#include "definitions.h"
+#include "gemvi_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void gemvin_kernel_host_pointer(rocsparse_int m,
+                                           rocsparse_int n,
+                                           T             alpha,
+                                           const T* __restrict__ A,
+                                           rocsparse_int lda,
+                                           rocsparse_int nnz,
+                                           const T* __restrict__ x_val,
+                                           const rocsparse_int* __restrict__ x_ind,
+                                           T beta,
+                                           T* __restrict__ y,
+                                           rocsparse_index_base idx_base)
+{
+    gemvin_device(m, n, alpha, A, lda, nnz, x_val, x_ind, beta, y, idx_base);
+}
+
+template <typename T>
+__global__ void gemvin_kernel_device_pointer(rocsparse_int m,
+                                             rocsparse_int n,
+                                             const T*      alpha,
+                                             const T* __restrict__ A,
+                                             rocsparse_int lda,
+                                             rocsparse_int nnz,
+                                             const T* __restrict__ x_val,
+                                             const rocsparse_int* __restrict__ x_ind,
+                                             const T* beta,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    gemvin_device(m, n, *alpha, A, lda, nnz, x_val, x_ind, *beta, y, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_gemvi_template(rocsparse_handle     handle,
+                                          rocsparse_operation  trans,
+                                          rocsparse_int        m,
+                                          rocsparse_int        n,
+                                          const T*             alpha,
+                                          const T*             A,
+                                          rocsparse_int        lda,
+                                          rocsparse_int        nnz,
+                                          const T*             x_val,
+                                          const rocsparse_int* x_ind,
+                                          const T*             beta,
+                                          T*                   y,
+                                          rocsparse_index_base idx_base)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xgemvi"),
+                  trans,
+                  m,
+                  n,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  *beta,
+                  (const void*&)y,
+                  idx_base);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f gemvi -r",
+                  replaceX<T>("X"),
+                  "--mtx <vector.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xgemvi"),
+                  trans,
+                  m,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  idx_base);
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0 || nnz > n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check leading dimension of A
+    if(lda < std::max(static_cast<rocsparse_int>(1), m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz != 0 && x_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz != 0 && x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different gemvi kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define GEMVIN_DIM 512
+        dim3 gemvin_blocks((m - 1) / GEMVIN_DIM + 1);
+        dim3 gemvin_threads(GEMVIN_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((gemvin_kernel_device_pointer<T>),
+                               gemvin_blocks,
+                               gemvin_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               alpha,
+                               A,
+                               lda,
+                               nnz,
+                               x_val,
+                               x_ind,
+                               beta,
+                               y,
+                               idx_base);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL((gemvin_kernel_host_pointer<T>),
+                               gemvin_blocks,
+                               gemvin_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               *alpha,
+                               A,
+                               lda,
+                               nnz,
+                               x_val,
+                               x_ind,
+                               *beta,
+                               y,
+                               idx_base);
+        }
+#undef GEMVIN_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_GEMVI_HPP
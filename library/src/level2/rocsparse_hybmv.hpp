@@ -26,13 +26,117 @@
 #define ROCSPARSE_HYBMV_HPP
 
 #include "definitions.h"
+#include "ellmv_device.h"
 #include "handle.h"
+#include "hybmv_device.h"
 #include "rocsparse.h"
 #include "rocsparse_coomv.hpp"
 #include "rocsparse_ellmv.hpp"
 #include "utility.h"
 
-#include <hip/hip_runtime_api.h>
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void hybmv_fused_kernel_host_pointer(rocsparse_int m,
+                                                rocsparse_int n,
+                                                rocsparse_int ell_width,
+                                                rocsparse_int coo_nnz,
+                                                T             alpha,
+                                                const rocsparse_int* __restrict__ ell_col_ind,
+                                                const T* __restrict__ ell_val,
+                                                const rocsparse_int* __restrict__ ell_row_nnz,
+                                                const rocsparse_int* __restrict__ coo_row_ind,
+                                                const rocsparse_int* __restrict__ coo_col_ind,
+                                                const T* __restrict__ coo_val,
+                                                const T* __restrict__ x,
+                                                T beta,
+                                                T* __restrict__ y,
+                                                rocsparse_index_base idx_base)
+{
+    hybmv_fused_device<T>(m,
+                          n,
+                          ell_width,
+                          coo_nnz,
+                          alpha,
+                          ell_col_ind,
+                          ell_val,
+                          ell_row_nnz,
+                          coo_row_ind,
+                          coo_col_ind,
+                          coo_val,
+                          x,
+                          beta,
+                          y,
+                          idx_base);
+}
+
+template <typename T>
+__global__ void hybmv_fused_kernel_device_pointer(rocsparse_int m,
+                                                  rocsparse_int n,
+                                                  rocsparse_int ell_width,
+                                                  rocsparse_int coo_nnz,
+                                                  const T*      alpha,
+                                                  const rocsparse_int* __restrict__ ell_col_ind,
+                                                  const T* __restrict__ ell_val,
+                                                  const rocsparse_int* __restrict__ ell_row_nnz,
+                                                  const rocsparse_int* __restrict__ coo_row_ind,
+                                                  const rocsparse_int* __restrict__ coo_col_ind,
+                                                  const T* __restrict__ coo_val,
+                                                  const T* __restrict__ x,
+                                                  const T* beta,
+                                                  T* __restrict__ y,
+                                                  rocsparse_index_base idx_base)
+{
+    hybmv_fused_device<T>(m,
+                          n,
+                          ell_width,
+                          coo_nnz,
+                          *alpha,
+                          ell_col_ind,
+                          ell_val,
+                          ell_row_nnz,
+                          coo_row_ind,
+                          coo_col_ind,
+                          coo_val,
+                          x,
+                          *beta,
+                          y,
+                          idx_base);
+}
+
+template <typename T>
+__global__ void ellmvn_row_kernel_host_pointer(rocsparse_int m,
+                                               rocsparse_int ell_width,
+                                               rocsparse_int ell_pitch,
+                                               T             alpha,
+                                               const rocsparse_int* __restrict__ ell_col_ind,
+                                               const T* __restrict__ ell_val,
+                                               const rocsparse_int* __restrict__ ell_row_nnz,
+                                               const T* __restrict__ x,
+                                               T beta,
+                                               T* __restrict__ y,
+                                               rocsparse_index_base idx_base)
+{
+    ellmvn_row_device(
+        m, ell_width, ell_pitch, alpha, ell_col_ind, ell_val, ell_row_nnz, x, beta, y, idx_base);
+}
+
+template <typename T>
+__global__ void ellmvn_row_kernel_device_pointer(rocsparse_int m,
+                                                 rocsparse_int ell_width,
+                                                 rocsparse_int ell_pitch,
+                                                 const T*      alpha,
+                                                 const rocsparse_int* __restrict__ ell_col_ind,
+                                                 const T* __restrict__ ell_val,
+                                                 const rocsparse_int* __restrict__ ell_row_nnz,
+                                                 const T* __restrict__ x,
+                                                 const T* beta,
+                                                 T* __restrict__ y,
+                                                 rocsparse_index_base idx_base)
+{
+    ellmvn_row_device(
+        m, ell_width, ell_pitch, *alpha, ell_col_ind, ell_val, ell_row_nnz, x, *beta, y, idx_base);
+}
 
 template <typename T>
 rocsparse_status rocsparse_hybmv_template(rocsparse_handle          handle,
@@ -184,24 +288,155 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle          handle,
         return rocsparse_status_success;
     }
 
+    // Profile the operation ; the ELL and COO parts, x and y are each moved
+    // once
+    rocsparse_profile_scope<T> profile(
+        handle,
+        "rocsparse_Xhybmv",
+        static_cast<double>(sizeof(T)) * (hyb->ell_nnz + hyb->coo_nnz + hyb->n + 2.0 * hyb->m)
+            + static_cast<double>(sizeof(rocsparse_int)) * (hyb->ell_nnz + 2.0 * hyb->coo_nnz));
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xhybmv");
+
     // Run different hybmv kernels
     if(trans == rocsparse_operation_none)
     {
+        // If the COO part is small compared to the matrix, process it fused
+        // with the ELL part in a single kernel. The second, dependent launch
+        // over y would be mostly latency in this case
+        if(hyb->ell_nnz > 0 && hyb->coo_nnz > 0 && hyb->coo_nnz <= hyb->m)
+        {
+#define HYBMV_FUSED_DIM 512
+            dim3 hybmv_blocks((hyb->m - 1) / HYBMV_FUSED_DIM + 1);
+            dim3 hybmv_threads(HYBMV_FUSED_DIM);
+
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                hipLaunchKernelGGL((hybmv_fused_kernel_device_pointer<T>),
+                                   hybmv_blocks,
+                                   hybmv_threads,
+                                   0,
+                                   handle->stream,
+                                   hyb->m,
+                                   hyb->n,
+                                   hyb->ell_width,
+                                   hyb->coo_nnz,
+                                   alpha,
+                                   hyb->ell_col_ind,
+                                   (T*)hyb->ell_val,
+                                   hyb->ell_row_nnz,
+                                   hyb->coo_row_ind,
+                                   hyb->coo_col_ind,
+                                   (T*)hyb->coo_val,
+                                   x,
+                                   beta,
+                                   y,
+                                   descr->base);
+            }
+            else
+            {
+                if(*alpha == 0.0 && *beta == 1.0)
+                {
+                    return rocsparse_status_success;
+                }
+
+                hipLaunchKernelGGL((hybmv_fused_kernel_host_pointer<T>),
+                                   hybmv_blocks,
+                                   hybmv_threads,
+                                   0,
+                                   handle->stream,
+                                   hyb->m,
+                                   hyb->n,
+                                   hyb->ell_width,
+                                   hyb->coo_nnz,
+                                   *alpha,
+                                   hyb->ell_col_ind,
+                                   (T*)hyb->ell_val,
+                                   hyb->ell_row_nnz,
+                                   hyb->coo_row_ind,
+                                   hyb->coo_col_ind,
+                                   (T*)hyb->coo_val,
+                                   x,
+                                   *beta,
+                                   y,
+                                   descr->base);
+            }
+#undef HYBMV_FUSED_DIM
+            return rocsparse_status_success;
+        }
+
         // ELL part
         if(hyb->ell_nnz > 0)
         {
-            RETURN_IF_ROCSPARSE_ERROR(rocsparse_ellmv_template(handle,
-                                                               trans,
-                                                               hyb->m,
-                                                               hyb->n,
-                                                               alpha,
-                                                               descr,
-                                                               (T*)hyb->ell_val,
-                                                               hyb->ell_col_ind,
-                                                               hyb->ell_width,
-                                                               x,
-                                                               beta,
-                                                               y));
+            // ELL-R, if the row length array is present, the SpMV kernel
+            // stops at the actual row length instead of sweeping ell_width
+            // padded entries for every row
+            if(hyb->ell_row_nnz != nullptr)
+            {
+#define ELLMVR_DIM 512
+                dim3 ellmvr_blocks((hyb->m - 1) / ELLMVR_DIM + 1);
+                dim3 ellmvr_threads(ELLMVR_DIM);
+
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    hipLaunchKernelGGL((ellmvn_row_kernel_device_pointer<T>),
+                                       ellmvr_blocks,
+                                       ellmvr_threads,
+                                       0,
+                                       handle->stream,
+                                       hyb->m,
+                                       hyb->ell_width,
+                                       hyb->m,
+                                       alpha,
+                                       hyb->ell_col_ind,
+                                       (T*)hyb->ell_val,
+                                       hyb->ell_row_nnz,
+                                       x,
+                                       beta,
+                                       y,
+                                       descr->base);
+                }
+                else
+                {
+                    if(*alpha == 0.0 && *beta == 1.0)
+                    {
+                        return rocsparse_status_success;
+                    }
+
+                    hipLaunchKernelGGL((ellmvn_row_kernel_host_pointer<T>),
+                                       ellmvr_blocks,
+                                       ellmvr_threads,
+                                       0,
+                                       handle->stream,
+                                       hyb->m,
+                                       hyb->ell_width,
+                                       hyb->m,
+                                       *alpha,
+                                       hyb->ell_col_ind,
+                                       (T*)hyb->ell_val,
+                                       hyb->ell_row_nnz,
+                                       x,
+                                       *beta,
+                                       y,
+                                       descr->base);
+                }
+#undef ELLMVR_DIM
+            }
+            else
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_ellmv_template(handle,
+                                                                   trans,
+                                                                   hyb->m,
+                                                                   hyb->n,
+                                                                   alpha,
+                                                                   descr,
+                                                                   (T*)hyb->ell_val,
+                                                                   hyb->ell_col_ind,
+                                                                   hyb->ell_width,
+                                                                   x,
+                                                                   beta,
+                                                                   y));
+            }
         }
 
         // COO part
@@ -212,6 +447,9 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle          handle,
                 // Beta is applied by ELL part, IF ell_nnz > 0
                 if(hyb->ell_nnz > 0)
                 {
+                    // The staged one constant is allocated on first use
+                    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
                     T* coo_beta = NULL;
                     rocsparse_one(handle, &coo_beta);
 
@@ -0,0 +1,288 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SPLITMV_HPP
+#define ROCSPARSE_SPLITMV_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_csrmv.hpp"
+#include "utility.h"
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <thread>
+#include <vector>
+
+// Host SpMV over the rows [row_begin, row_end) of the host partition, run
+// by one of the worker threads. x and the host part of y have been staged
+// to pinned memory beforehand, the host rows of the two partitions are
+// disjoint, hence the workers and the device SpMV merge into y without
+// synchronization
+template <typename T>
+static void rocsparse_splitmv_host_rows(rocsparse_int        row_begin,
+                                        rocsparse_int        row_end,
+                                        T                    alpha,
+                                        const T*             val,
+                                        const rocsparse_int* row_ptr,
+                                        const rocsparse_int* col_ind,
+                                        const T*             x,
+                                        T                    beta,
+                                        T*                   y)
+{
+    for(rocsparse_int i = row_begin; i < row_end; ++i)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = row_ptr[i]; j < row_ptr[i + 1]; ++j)
+        {
+            sum = std::fma(val[j], x[col_ind[j]], sum);
+        }
+
+        // beta == 0 prunes the read of y, matching the device kernels on
+        // uninitialized y
+        y[i] = (beta == static_cast<T>(0)) ? alpha * sum : std::fma(beta, y[i], alpha * sum);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_splitmv_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            const T*                  alpha,
+                                            const rocsparse_split_mat split,
+                                            const T*                  x,
+                                            const T*                  beta,
+                                            T*                        y)
+{
+    // Check for valid handle and matrix
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(split == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xsplitmv"),
+              trans,
+              (const void*&)alpha,
+              (const void*&)split,
+              (const void*&)x,
+              (const void*&)beta,
+              (const void*&)y);
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(split->m == 0 || split->nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Fully device resident matrix, run a plain csrmv
+    if(split->split_row == split->m)
+    {
+        return rocsparse_csrmv_template<T>(handle,
+                                           trans,
+                                           split->m,
+                                           split->n,
+                                           split->dev_nnz,
+                                           alpha,
+                                           &split->descr,
+                                           (const T*)split->dev_val,
+                                           split->dev_row_ptr,
+                                           split->dev_col_ind,
+                                           nullptr,
+                                           x,
+                                           beta,
+                                           y);
+    }
+
+    rocsparse_int host_m = split->m - split->split_row;
+
+    // Profile the operation ; the matrix data, x and y are each moved once,
+    // x and the host part of y additionally over the staging copies
+    rocsparse_profile_scope<T> profile(
+        handle,
+        "rocsparse_Xsplitmv",
+        static_cast<double>(sizeof(T)) * (split->nnz + 2.0 * split->n + split->m + 2.0 * host_m)
+            + static_cast<double>(sizeof(rocsparse_int)) * (split->nnz + split->m + 1.0));
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xsplitmv");
+
+    // Stage x and the host part of y to the host on the staging stream ;
+    // the staging stream may not read them before the handle stream has
+    // produced them
+    RETURN_IF_HIP_ERROR(hipEventRecord(split->x_ready, handle->stream));
+    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(split->stage_stream, split->x_ready, 0));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        split->host_x, x, sizeof(T) * split->n, hipMemcpyDeviceToHost, split->stage_stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(split->host_y,
+                                       y + split->split_row,
+                                       sizeof(T) * host_m,
+                                       hipMemcpyDeviceToHost,
+                                       split->stage_stream));
+
+    // The host loop needs the scalar values, in device pointer mode they
+    // are staged alongside
+    T h_alpha;
+    T h_beta;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &h_alpha, alpha, sizeof(T), hipMemcpyDeviceToHost, split->stage_stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&h_beta, beta, sizeof(T), hipMemcpyDeviceToHost, split->stage_stream));
+    }
+    else
+    {
+        h_alpha = *alpha;
+        h_beta  = *beta;
+    }
+
+    // Device SpMV over the leading rows, overlapping the staging copies
+    // and the host compute
+    if(split->split_row > 0)
+    {
+        if(split->dev_nnz > 0)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template<T>(handle,
+                                                                  trans,
+                                                                  split->split_row,
+                                                                  split->n,
+                                                                  split->dev_nnz,
+                                                                  alpha,
+                                                                  &split->descr,
+                                                                  (const T*)split->dev_val,
+                                                                  split->dev_row_ptr,
+                                                                  split->dev_col_ind,
+                                                                  nullptr,
+                                                                  x,
+                                                                  beta,
+                                                                  y));
+        }
+        else
+        {
+            // The device partition has no entries, y must still be scaled
+            // by beta
+            const T* d_beta;
+            const T* d_dummy;
+
+            RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(beta, beta, &d_beta, &d_dummy));
+
+            hipLaunchKernelGGL((csrmv_scale_kernel<T>),
+                               dim3((split->split_row - 1) / 1024 + 1),
+                               dim3(1024),
+                               0,
+                               handle->stream,
+                               split->split_row,
+                               d_beta,
+                               y);
+        }
+    }
+
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(split->stage_stream));
+
+    // Multithreaded host SpMV over the trailing rows
+    rocsparse_int nthread
+        = static_cast<rocsparse_int>(std::thread::hardware_concurrency());
+
+    nthread = (nthread < 1) ? 1 : nthread;
+    nthread = (nthread > host_m) ? host_m : nthread;
+
+    rocsparse_int chunk = (host_m - 1) / nthread + 1;
+
+    std::vector<std::thread> workers;
+
+    for(rocsparse_int t = 0; t < nthread; ++t)
+    {
+        rocsparse_int row_begin = t * chunk;
+        rocsparse_int row_end   = (host_m - row_begin < chunk) ? host_m : row_begin + chunk;
+
+        workers.emplace_back(rocsparse_splitmv_host_rows<T>,
+                             row_begin,
+                             row_end,
+                             h_alpha,
+                             (const T*)split->host_val,
+                             split->host_row_ptr,
+                             split->host_col_ind,
+                             (const T*)split->host_x,
+                             h_beta,
+                             (T*)split->host_y);
+    }
+
+    for(auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    // Merge the host results back into y ; the handle stream may not run
+    // subsequent operations before the merge has arrived
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(y + split->split_row,
+                                       split->host_y,
+                                       sizeof(T) * host_m,
+                                       hipMemcpyHostToDevice,
+                                       split->stage_stream));
+
+    RETURN_IF_HIP_ERROR(hipEventRecord(split->y_merged, split->stage_stream));
+    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(handle->stream, split->y_merged, 0));
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SPLITMV_HPP
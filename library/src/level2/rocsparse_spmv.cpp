@@ -0,0 +1,316 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "rocsparse_spmv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_sspmv_analysis(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const float*              csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info)
+{
+    return rocsparse_spmv_analysis_template<float>(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_dspmv_analysis(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const double*             csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info)
+{
+    return rocsparse_spmv_analysis_template<double>(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_spmv_clear(rocsparse_handle handle, rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_spmv_clear", (const void*&)info);
+
+    // Destroy spmv info struct
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_spmv_info(info->spmv_info));
+    info->spmv_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sspmv(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const float*              alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            const float*              x,
+                                            const float*              beta,
+                                            float*                    y)
+{
+    return rocsparse_spmv_template<float>(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          x,
+                                          beta,
+                                          y);
+}
+
+extern "C" rocsparse_status rocsparse_dspmv(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const double*             alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            const double*             x,
+                                            const double*             beta,
+                                            double*                   y)
+{
+    return rocsparse_spmv_template<double>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+}
+
+extern "C" rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
+                                           rocsparse_operation         trans,
+                                           const void*                 alpha,
+                                           const rocsparse_spmat_descr mat,
+                                           const rocsparse_dnvec_descr x,
+                                           const void*                 beta,
+                                           const rocsparse_dnvec_descr y,
+                                           rocsparse_datatype          compute_type)
+{
+    // Check for valid handle and descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(mat == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmv",
+              trans,
+              (const void*&)alpha,
+              (const void*&)mat,
+              (const void*&)x,
+              (const void*&)beta,
+              (const void*&)y,
+              compute_type);
+
+    // Check pointer arguments
+    if(alpha == nullptr || beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The vectors must match the compute precision, only the matrix values
+    // may be stored in a narrower precision
+    if(x->data_type != compute_type || y->data_type != compute_type)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Only CSR storage format is supported
+    if(mat->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    const rocsparse_int* csr_row_ptr = static_cast<const rocsparse_int*>(mat->row_data);
+    const rocsparse_int* csr_col_ind = static_cast<const rocsparse_int*>(mat->col_data);
+
+    // Dispatch on the storage and compute precision. Uniform precision maps
+    // onto the typed templates, the narrower storage precisions map onto the
+    // mixed precision templates
+    if(mat->data_type == rocsparse_datatype_f32_r && compute_type == rocsparse_datatype_f32_r)
+    {
+        return rocsparse_csrmv_template<float>(handle,
+                                               trans,
+                                               mat->rows,
+                                               mat->cols,
+                                               mat->nnz,
+                                               static_cast<const float*>(alpha),
+                                               mat->descr,
+                                               static_cast<const float*>(mat->val_data),
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               mat->info,
+                                               static_cast<const float*>(x->values),
+                                               static_cast<const float*>(beta),
+                                               static_cast<float*>(y->values));
+    }
+    else if(mat->data_type == rocsparse_datatype_f64_r
+            && compute_type == rocsparse_datatype_f64_r)
+    {
+        return rocsparse_csrmv_template<double>(handle,
+                                                trans,
+                                                mat->rows,
+                                                mat->cols,
+                                                mat->nnz,
+                                                static_cast<const double*>(alpha),
+                                                mat->descr,
+                                                static_cast<const double*>(mat->val_data),
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                mat->info,
+                                                static_cast<const double*>(x->values),
+                                                static_cast<const double*>(beta),
+                                                static_cast<double*>(y->values));
+    }
+    else if(mat->data_type == rocsparse_datatype_f32_c
+            && compute_type == rocsparse_datatype_f32_c)
+    {
+        return rocsparse_csrmv_template<rocsparse_float_complex>(
+            handle,
+            trans,
+            mat->rows,
+            mat->cols,
+            mat->nnz,
+            static_cast<const rocsparse_float_complex*>(alpha),
+            mat->descr,
+            static_cast<const rocsparse_float_complex*>(mat->val_data),
+            csr_row_ptr,
+            csr_col_ind,
+            mat->info,
+            static_cast<const rocsparse_float_complex*>(x->values),
+            static_cast<const rocsparse_float_complex*>(beta),
+            static_cast<rocsparse_float_complex*>(y->values));
+    }
+    else if(mat->data_type == rocsparse_datatype_f64_c
+            && compute_type == rocsparse_datatype_f64_c)
+    {
+        return rocsparse_csrmv_template<rocsparse_double_complex>(
+            handle,
+            trans,
+            mat->rows,
+            mat->cols,
+            mat->nnz,
+            static_cast<const rocsparse_double_complex*>(alpha),
+            mat->descr,
+            static_cast<const rocsparse_double_complex*>(mat->val_data),
+            csr_row_ptr,
+            csr_col_ind,
+            mat->info,
+            static_cast<const rocsparse_double_complex*>(x->values),
+            static_cast<const rocsparse_double_complex*>(beta),
+            static_cast<rocsparse_double_complex*>(y->values));
+    }
+    else if(mat->data_type == rocsparse_datatype_f32_r
+            && compute_type == rocsparse_datatype_f64_r)
+    {
+        return rocsparse_csrmv_mixed_template<float, double>(
+            handle,
+            trans,
+            mat->rows,
+            mat->cols,
+            mat->nnz,
+            static_cast<const double*>(alpha),
+            mat->descr,
+            static_cast<const float*>(mat->val_data),
+            csr_row_ptr,
+            csr_col_ind,
+            mat->info,
+            static_cast<const double*>(x->values),
+            static_cast<const double*>(beta),
+            static_cast<double*>(y->values));
+    }
+    else if(mat->data_type == rocsparse_datatype_f16_r
+            && compute_type == rocsparse_datatype_f32_r)
+    {
+        return rocsparse_csrmv_mixed_template<__half, float>(
+            handle,
+            trans,
+            mat->rows,
+            mat->cols,
+            mat->nnz,
+            static_cast<const float*>(alpha),
+            mat->descr,
+            static_cast<const __half*>(mat->val_data),
+            csr_row_ptr,
+            csr_col_ind,
+            mat->info,
+            static_cast<const float*>(x->values),
+            static_cast<const float*>(beta),
+            static_cast<float*>(y->values));
+    }
+
+    // Remaining precision combinations are not supported
+    return rocsparse_status_not_implemented;
+}
@@ -0,0 +1,402 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SPMV_HPP
+#define ROCSPARSE_SPMV_HPP
+
+#include "../conversion/rocsparse_csr2hyb.hpp"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_coomv.hpp"
+#include "rocsparse_csrmv.hpp"
+#include "rocsparse_hybmv.hpp"
+#include "utility.h"
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+
+// Row length statistics of the matrix, gathered in a single pass. The sum
+// and the sum of squares are accumulated in double precision to obtain mean
+// and variance of the row length distribution
+template <rocsparse_int BLOCKSIZE>
+__global__ void spmv_analysis_stats_kernel(rocsparse_int m,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           double* __restrict__ row_nnz_sum,
+                                           double* __restrict__ row_nnz_sqsum,
+                                           rocsparse_int* __restrict__ max_row_nnz)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    rocsparse_int row_nnz = 0;
+
+    if(gid < m)
+    {
+        row_nnz = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+    }
+
+    __shared__ double        sdata[BLOCKSIZE];
+    __shared__ rocsparse_int smax[BLOCKSIZE];
+
+    smax[tid] = row_nnz;
+
+    // Sum of row lengths
+    sdata[tid] = static_cast<double>(row_nnz);
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<double, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        atomicAdd(row_nnz_sum, sdata[0]);
+    }
+
+    // Sum of squared row lengths
+    __syncthreads();
+
+    sdata[tid] = static_cast<double>(row_nnz) * static_cast<double>(row_nnz);
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<double, BLOCKSIZE>(tid, sdata);
+
+    rocsparse_blockreduce_max<rocsparse_int, BLOCKSIZE>(tid, smax);
+
+    if(tid == 0)
+    {
+        atomicAdd(row_nnz_sqsum, sdata[0]);
+        atomicMax(max_row_nnz, smax[0]);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_spmv_analysis_template(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xspmv_analysis"),
+              trans,
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Clear spmv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_spmv_info(info->spmv_info));
+
+    // Create spmv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_spmv_info(&info->spmv_info));
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Gather row length statistics
+    double*        d_sum;
+    double*        d_sqsum;
+    rocsparse_int* d_max;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(double) * 2 + sizeof(rocsparse_int), (void**)&d_sum));
+    d_sqsum = d_sum + 1;
+    d_max   = reinterpret_cast<rocsparse_int*>(d_sqsum + 1);
+
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(d_sum, 0, sizeof(double) * 2 + sizeof(rocsparse_int), stream));
+
+#define SPMV_ANALYSIS_DIM 256
+    hipLaunchKernelGGL((spmv_analysis_stats_kernel<SPMV_ANALYSIS_DIM>),
+                       dim3((m - 1) / SPMV_ANALYSIS_DIM + 1),
+                       dim3(SPMV_ANALYSIS_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       d_sum,
+                       d_sqsum,
+                       d_max);
+#undef SPMV_ANALYSIS_DIM
+
+    double        stats[2];
+    rocsparse_int max_row_nnz;
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(stats, d_sum, sizeof(double) * 2, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&max_row_nnz, d_max, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_sum));
+
+    double mean = stats[0] / m;
+    double var  = stats[1] / m - mean * mean;
+
+    info->spmv_info->mean_row_nnz = mean;
+    info->spmv_info->var_row_nnz  = var;
+    info->spmv_info->max_row_nnz  = max_row_nnz;
+
+    // Select the storage format based on the row length distribution.
+    // Long rows are handled best by the adaptive CSR kernel. Uniform short
+    // rows fit ELL with bounded fill-in. Mostly uniform distributions with
+    // few outliers go to HYB, heavily skewed short-row distributions to COO
+    if(mean >= 32.0)
+    {
+        info->spmv_info->format = rocsparse_spmv_format_csr;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_analysis_template<T>(
+            handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+    }
+    else if(max_row_nnz <= 2.0 * mean + 1.0)
+    {
+        info->spmv_info->format = rocsparse_spmv_format_ell;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_hyb_mat(&info->spmv_info->hyb));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_template<T>(handle,
+                                                                m,
+                                                                n,
+                                                                descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                info->spmv_info->hyb,
+                                                                0,
+                                                                rocsparse_hyb_partition_max));
+    }
+    else if(std::sqrt(var) <= 2.0 * mean)
+    {
+        info->spmv_info->format = rocsparse_spmv_format_hyb;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_hyb_mat(&info->spmv_info->hyb));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_template<T>(handle,
+                                                                m,
+                                                                n,
+                                                                descr,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                info->spmv_info->hyb,
+                                                                0,
+                                                                rocsparse_hyb_partition_auto));
+    }
+    else
+    {
+        info->spmv_info->format = rocsparse_spmv_format_coo;
+
+        // COO column indices and values are shared with the CSR matrix,
+        // only the row indices need to be expanded
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&info->spmv_info->coo_row_ind, sizeof(rocsparse_int) * nnz));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2coo(
+            handle, csr_row_ptr, nnz, m, info->spmv_info->coo_row_ind, descr->base));
+    }
+
+    // Store some pointers to verify correct execution
+    info->spmv_info->trans       = trans;
+    info->spmv_info->m           = m;
+    info->spmv_info->n           = n;
+    info->spmv_info->nnz         = nnz;
+    info->spmv_info->descr       = descr;
+    info->spmv_info->csr_row_ptr = csr_row_ptr;
+    info->spmv_info->csr_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_spmv_template(rocsparse_handle          handle,
+                                         rocsparse_operation       trans,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         rocsparse_int             nnz,
+                                         const T*                  alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const T*                  csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         const T*                  x,
+                                         const T*                  beta,
+                                         T*                        y)
+{
+    // Check for valid handle, matrix descriptor and info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Without analysis meta data, fall back to CSR
+    if(info->spmv_info == nullptr)
+    {
+        return rocsparse_csrmv_template<T>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           nullptr,
+                                           x,
+                                           beta,
+                                           y);
+    }
+
+    // Check if analysis meta data fits the matrix
+    if(info->spmv_info->trans != trans || info->spmv_info->m != m || info->spmv_info->n != n
+       || info->spmv_info->nnz != nnz || info->spmv_info->descr != descr
+       || info->spmv_info->csr_row_ptr != csr_row_ptr
+       || info->spmv_info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Run the kernel that was selected during analysis
+    switch(info->spmv_info->format)
+    {
+    case rocsparse_spmv_format_csr:
+        return rocsparse_csrmv_template<T>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+    case rocsparse_spmv_format_ell:
+    case rocsparse_spmv_format_hyb:
+        return rocsparse_hybmv_template<T>(
+            handle, trans, alpha, descr, info->spmv_info->hyb, x, beta, y);
+    case rocsparse_spmv_format_coo:
+        return rocsparse_coomv_template<T>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           info->spmv_info->coo_row_ind,
+                                           csr_col_ind,
+                                           x,
+                                           beta,
+                                           y);
+    }
+
+    return rocsparse_status_internal_error;
+}
+
+#endif // ROCSPARSE_SPMV_HPP
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SELLMV_DEVICE_H
+#define SELLMV_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// SELL-C-sigma SpMV for general, non-transposed matrices. One thread per row
+// of the padded matrix, such that the lanes of a wavefront stream through
+// their slice with unit stride. The slice height matches the wavefront size
+// and the column-major slice layout keeps all accesses coalesced
+template <typename T>
+static __device__ void sellmvn_device(rocsparse_int        m,
+                                      rocsparse_int        n,
+                                      rocsparse_int        slice_height,
+                                      T                    alpha,
+                                      const rocsparse_int* slice_ptr,
+                                      const rocsparse_int* perm,
+                                      const rocsparse_int* sell_col_ind,
+                                      const T*             sell_val,
+                                      const T*             x,
+                                      T                    beta,
+                                      T*                   y,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockDim_x * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int slice = ai / slice_height;
+    rocsparse_int lane  = ai % slice_height;
+
+    rocsparse_int slice_begin = slice_ptr[slice];
+    rocsparse_int slice_end   = slice_ptr[slice + 1];
+    rocsparse_int width       = (slice_end - slice_begin) / slice_height;
+
+    T sum = static_cast<T>(0);
+    for(rocsparse_int p = 0; p < width; ++p)
+    {
+        rocsparse_int idx = slice_begin + p * slice_height + lane;
+        rocsparse_int col = rocsparse_nontemporal_load(sell_col_ind + idx) - idx_base;
+
+        if(col >= 0 && col < n)
+        {
+            sum = rocsparse_fma(
+                rocsparse_nontemporal_load(sell_val + idx), rocsparse_ldg(x + col), sum);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Scatter the result through the row permutation of the sigma sort
+    rocsparse_int row = perm[ai];
+
+    if(beta != static_cast<T>(0))
+    {
+        y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+    }
+    else
+    {
+        y[row] = alpha * sum;
+    }
+}
+
+#endif // SELLMV_DEVICE_H
@@ -0,0 +1,241 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRMM_DEVICE_H
+#define BSRMM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Accumulator fragments of the 16x16x4 matrix core instructions, four
+// result rows per lane
+typedef float rocsparse_f32x4 __attribute__((ext_vector_type(4)));
+typedef double rocsparse_f64x4 __attribute__((ext_vector_type(4)));
+
+template <typename T>
+struct rocsparse_mfma_frag;
+
+template <>
+struct rocsparse_mfma_frag<float>
+{
+    typedef rocsparse_f32x4 type;
+};
+
+template <>
+struct rocsparse_mfma_frag<double>
+{
+    typedef rocsparse_f64x4 type;
+};
+
+// 16x16x4 matrix core fragment update. On architectures without the
+// matrix core instructions this compiles to a pass through, the host
+// dispatch never selects the MFMA kernel there
+static __device__ __forceinline__ rocsparse_f32x4
+    rocsparse_mfma_16x16x4(float a, float b, rocsparse_f32x4 c)
+{
+#if defined(__gfx908__) || defined(__gfx90a__)
+    return __builtin_amdgcn_mfma_f32_16x16x4f32(a, b, c, 0, 0, 0);
+#else
+    return c;
+#endif
+}
+
+static __device__ __forceinline__ rocsparse_f64x4
+    rocsparse_mfma_16x16x4(double a, double b, rocsparse_f64x4 c)
+{
+#if defined(__gfx90a__)
+    return __builtin_amdgcn_mfma_f64_16x16x4f64(a, b, c, 0, 0, 0);
+#else
+    return c;
+#endif
+}
+
+// Scale the dense matrix C by beta
+template <typename T>
+static __device__ void bsrmm_scale_device(
+    rocsparse_int m, rocsparse_int n, T beta, T* __restrict__ data, rocsparse_int ld)
+{
+    rocsparse_int gidx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gidy = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(gidx >= m || gidy >= n)
+    {
+        return;
+    }
+
+    data[gidx + gidy * ld] *= beta;
+}
+
+// BSR SpMM for general, non-transposed matrices. Each block column of the
+// grid processes one column of C, each thread computes one entry, keeping
+// the row of each touched block in registers while streaming through the
+// block row, analogous to the bsrmv kernel
+template <typename T, rocsparse_int BLOCKSIZE>
+static __device__ void bsrmmnn_general_device(rocsparse_int m,
+                                              rocsparse_int n,
+                                              rocsparse_int k,
+                                              rocsparse_int block_dim,
+                                              T             alpha,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr,
+                                              const rocsparse_int* __restrict__ bsr_col_ind,
+                                              const T* __restrict__ bsr_val,
+                                              const T* __restrict__ B,
+                                              rocsparse_int ldb,
+                                              T             beta,
+                                              T* __restrict__ C,
+                                              rocsparse_int        ldc,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int col = hipBlockIdx_y;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int block_row = row / block_dim;
+    rocsparse_int local_row = row % block_dim;
+
+    rocsparse_int row_start = bsr_row_ptr[block_row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[block_row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    // Loop over non-zero blocks
+    for(rocsparse_int j = row_start; j < row_end; ++j)
+    {
+        rocsparse_int block_col = rocsparse_nontemporal_load(bsr_col_ind + j) - idx_base;
+        const T*      block_val = bsr_val + j * block_dim * block_dim + local_row * block_dim;
+
+        // Loop over the columns of the current block; padded entries of the
+        // last block column are zero and must not touch B
+        for(rocsparse_int c = 0; c < block_dim; ++c)
+        {
+            rocsparse_int colB = block_col * block_dim + c;
+
+            if(colB < k)
+            {
+                sum = rocsparse_fma(rocsparse_nontemporal_load(block_val + c),
+                                    rocsparse_ldg(B + colB + col * ldb),
+                                    sum);
+            }
+        }
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        C[row + col * ldc] = alpha * sum;
+    }
+    else
+    {
+        C[row + col * ldc] = rocsparse_fma(beta, C[row + col * ldc], alpha * sum);
+    }
+}
+
+// BSR SpMM using the 16x16x4 matrix core fragment shape. One wavefront
+// computes the product of a block row of A with a 16 column panel of B,
+// each non-zero 16x16 block is fed to the matrix cores as four k-slices
+// of depth four. Within a slice, lane l supplies A(l % 16, l / 16) and
+// B(l / 16, l % 16) and accumulates rows 4 * (l / 16) .. 4 * (l / 16) + 3
+// of column l % 16 of the result tile. The block values stay in the
+// fragment registers, no per-value column index is fetched within a block
+template <typename T>
+static __device__ void bsrmmnn_mfma_device(rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int k,
+                                           T             alpha,
+                                           const rocsparse_int* __restrict__ bsr_row_ptr,
+                                           const rocsparse_int* __restrict__ bsr_col_ind,
+                                           const T* __restrict__ bsr_val,
+                                           const T* __restrict__ B,
+                                           rocsparse_int ldb,
+                                           T             beta,
+                                           T* __restrict__ C,
+                                           rocsparse_int        ldc,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int block_row = hipBlockIdx_x;
+    rocsparse_int lane      = hipThreadIdx_x;
+
+    // Column of B and C processed by this lane
+    rocsparse_int col  = hipBlockIdx_y * 16 + (lane & 15);
+    rocsparse_int kgrp = lane >> 4;
+
+    rocsparse_int row_start = bsr_row_ptr[block_row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[block_row + 1] - idx_base;
+
+    typename rocsparse_mfma_frag<T>::type acc = {};
+
+    // Loop over non-zero blocks
+    for(rocsparse_int j = row_start; j < row_end; ++j)
+    {
+        rocsparse_int block_col = rocsparse_nontemporal_load(bsr_col_ind + j) - idx_base;
+        const T*      block_val = bsr_val + j * 256;
+
+        // Four k-slices of depth four cover the 16 block columns
+        for(rocsparse_int s = 0; s < 4; ++s)
+        {
+            rocsparse_int kk = (s << 2) + kgrp;
+
+            // Row-major block storage, padded entries are zero
+            T a = rocsparse_nontemporal_load(block_val + (lane & 15) * 16 + kk);
+
+            // Rows of B beyond the padded column bound must not be read
+            rocsparse_int rowB = (block_col << 4) + kk;
+
+            T b = (rowB < k && col < n) ? rocsparse_ldg(B + rowB + col * ldb)
+                                        : static_cast<T>(0);
+
+            acc = rocsparse_mfma_16x16x4(a, b, acc);
+        }
+    }
+
+    if(col >= n)
+    {
+        return;
+    }
+
+    // Write back the four result rows held by this lane, guarding the
+    // padded rows of the last block row
+    for(rocsparse_int i = 0; i < 4; ++i)
+    {
+        rocsparse_int row = (block_row << 4) + (kgrp << 2) + i;
+
+        if(row < m)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                C[row + col * ldc] = alpha * acc[i];
+            }
+            else
+            {
+                C[row + col * ldc] = rocsparse_fma(beta, C[row + col * ldc], alpha * acc[i]);
+            }
+        }
+    }
+}
+
+#endif // BSRMM_DEVICE_H
@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef COOMM_DEVICE_H
+#define COOMM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Scale C with beta up front, covering also the rows that have no non-zero
+// entries and are never touched by the scatter stage of the reduction kernel
+template <typename T>
+static __device__ void coommn_scale_device(rocsparse_int m,
+                                           rocsparse_int n,
+                                           T             beta,
+                                           T*            C,
+                                           rocsparse_int ldc)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m * n)
+    {
+        return;
+    }
+
+    rocsparse_int row = gid % m;
+    rocsparse_int col = gid / m;
+
+    if(beta == static_cast<T>(0))
+    {
+        C[row + col * ldc] = static_cast<T>(0);
+    }
+    else if(beta != static_cast<T>(1))
+    {
+        C[row + col * ldc] *= beta;
+    }
+}
+
+// Non-zero parallel COO SpMM for general, non-transposed matrices. The
+// non-zero entries are partitioned evenly across the wavefronts, such that
+// pathologically imbalanced row lengths cannot idle workgroups, and the
+// partial row sums are combined by the same shuffle based segmented
+// reduction as in coomvn_general_wf_reduce, carried over a register tile of
+// COLS columns of the dense matrices. Each matrix entry is read once per
+// column tile and re-used for all columns of the tile. Rows that span
+// wavefront boundaries are completed with atomic additions. C has to be
+// scaled with beta before the reduction starts, as the partial sums scatter
+// with atomic additions
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int COLS>
+static __device__ void coommn_general_wf_reduce(rocsparse_int        m,
+                                                rocsparse_int        n,
+                                                rocsparse_int        nnz,
+                                                rocsparse_int        loops,
+                                                T                    alpha,
+                                                const rocsparse_int* coo_row_ind,
+                                                const rocsparse_int* coo_col_ind,
+                                                const T*             coo_val,
+                                                const T*             B,
+                                                rocsparse_int        ldb,
+                                                T*                   C,
+                                                rocsparse_int        ldc,
+                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    // Lane index (0,...,WF_SIZE)
+    rocsparse_int lid = gid % WF_SIZE;
+    // Wavefront index
+    rocsparse_int wid = gid / WF_SIZE;
+
+    // Column tile this block operates on
+    rocsparse_int col_begin = hipBlockIdx_y * COLS;
+
+    // Global COO array index start for current wavefront
+    rocsparse_int offset = wid * loops * WF_SIZE;
+
+    // Quick return when the wavefront is out of bounds. Partially filled
+    // wavefronts keep all of their lanes, such that the shuffle based
+    // segmented reduction below operates on fully active wavefronts
+    if(offset >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row;
+    T             val[COLS];
+
+    // Row index and partial sums of the last lane, carried over from the
+    // previous iteration
+    rocsparse_int prev_row = -1;
+    T             prev_val[COLS];
+
+    for(rocsparse_int c = 0; c < COLS; ++c)
+    {
+        prev_val[c] = static_cast<T>(0);
+    }
+
+    // Current threads index into COO structure
+    rocsparse_int idx = offset + lid;
+
+    // Each thread processes 'loop' COO entries
+    while(idx < offset + loops * WF_SIZE)
+    {
+        // Get corresponding COO entry, if not out of bounds.
+        // This can happen when processing more than 1 entry if
+        // nnz % WF_SIZE != 0
+        if(idx < nnz)
+        {
+            row               = rocsparse_nontemporal_load(coo_row_ind + idx) - idx_base;
+            rocsparse_int col = rocsparse_nontemporal_load(coo_col_ind + idx) - idx_base;
+            T             mat = alpha * rocsparse_nontemporal_load(coo_val + idx);
+
+            for(rocsparse_int c = 0; c < COLS; ++c)
+            {
+                val[c] = (col_begin + c < n)
+                             ? mat * rocsparse_ldg(B + col + (col_begin + c) * ldb)
+                             : static_cast<T>(0);
+            }
+        }
+        else
+        {
+            row = -1;
+
+            for(rocsparse_int c = 0; c < COLS; ++c)
+            {
+                val[c] = static_cast<T>(0);
+            }
+        }
+
+        // First lane in wavefront checks row index from previous loop
+        // if it has been completed or if additional rows have to be
+        // appended.
+        if(idx > offset && lid == 0)
+        {
+            if(row == prev_row)
+            {
+                for(rocsparse_int c = 0; c < COLS; ++c)
+                {
+                    val[c] += prev_val[c];
+                }
+            }
+            else if(prev_row >= 0)
+            {
+                for(rocsparse_int c = 0; c < COLS; ++c)
+                {
+                    if(col_begin + c < n)
+                    {
+                        atomicAdd(C + prev_row + (col_begin + c) * ldc, prev_val[c]);
+                    }
+                }
+            }
+        }
+
+#pragma unroll
+        // Segmented wavefront reduction in registers, carried over the
+        // whole column tile
+        for(rocsparse_int j = 1; j < WF_SIZE; j <<= 1)
+        {
+            rocsparse_int peer_row = rocsparse_shfl_up(row, j, WF_SIZE);
+
+            for(rocsparse_int c = 0; c < COLS; ++c)
+            {
+                T peer_val = rocsparse_shfl_up(val[c], j, WF_SIZE);
+
+                if(lid >= j && row == peer_row)
+                {
+                    val[c] += peer_val;
+                }
+            }
+        }
+
+        rocsparse_int next_row = rocsparse_shfl_down(row, 1, WF_SIZE);
+
+        // All lanes but the last one write their result in C.
+        // The last value might need to be appended by the next iteration.
+        if(lid < WF_SIZE - 1)
+        {
+            if(row != next_row && row >= 0)
+            {
+                for(rocsparse_int c = 0; c < COLS; ++c)
+                {
+                    if(col_begin + c < n)
+                    {
+                        atomicAdd(C + row + (col_begin + c) * ldc, val[c]);
+                    }
+                }
+            }
+        }
+
+        // Broadcast the last lanes row and partial sums for the next
+        // iteration
+        prev_row = rocsparse_shfl(row, WF_SIZE - 1, WF_SIZE);
+
+        for(rocsparse_int c = 0; c < COLS; ++c)
+        {
+            prev_val[c] = rocsparse_shfl(val[c], WF_SIZE - 1, WF_SIZE);
+        }
+
+        // Keep going for the next iteration
+        idx += WF_SIZE;
+    }
+
+    // The last row of each wavefront can span into the next wavefronts
+    // work and is therefore completed atomically
+    if(lid == WF_SIZE - 1 && row >= 0)
+    {
+        for(rocsparse_int c = 0; c < COLS; ++c)
+        {
+            if(col_begin + c < n)
+            {
+                atomicAdd(C + row + (col_begin + c) * ldc, val[c]);
+            }
+        }
+    }
+}
+
+#endif // COOMM_DEVICE_H
@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRGEAM_DEVICE_H
+#define CSRGEAM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+__global__ void csrgeam_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// Fill the row pointer array of an all empty matrix C
+template <unsigned int BLOCKSIZE>
+__global__ void csrgeam_row_ptr_fill_kernel(rocsparse_int size,
+                                            rocsparse_int* __restrict__ csr_row_ptr,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < size)
+    {
+        csr_row_ptr[gid] = idx_base;
+    }
+}
+
+// Count the number of non-zero entries per row of C, which is the size of the
+// union of the column indices of the corresponding rows of A and B. Since the
+// column indices per row are sorted, the union can be obtained by a merge.
+// The counts are written shifted by one, such that an inclusive scan yields
+// the row pointer array of C.
+template <unsigned int BLOCKSIZE>
+__global__ void csrgeam_nnz_per_row_kernel(rocsparse_int m,
+                                           const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                           const rocsparse_int* __restrict__ csr_col_ind_A,
+                                           const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                           const rocsparse_int* __restrict__ csr_col_ind_B,
+                                           rocsparse_int* __restrict__ csr_row_ptr_C,
+                                           rocsparse_index_base idx_base_A,
+                                           rocsparse_index_base idx_base_B,
+                                           rocsparse_index_base idx_base_C)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        csr_row_ptr_C[0] = idx_base_C;
+    }
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_A     = csr_row_ptr_A[gid] - idx_base_A;
+    rocsparse_int row_end_A = csr_row_ptr_A[gid + 1] - idx_base_A;
+    rocsparse_int row_B     = csr_row_ptr_B[gid] - idx_base_B;
+    rocsparse_int row_end_B = csr_row_ptr_B[gid + 1] - idx_base_B;
+
+    rocsparse_int nnz = 0;
+
+    // Merge the sorted column indices of both rows
+    while(row_A < row_end_A && row_B < row_end_B)
+    {
+        rocsparse_int col_A = csr_col_ind_A[row_A] - idx_base_A;
+        rocsparse_int col_B = csr_col_ind_B[row_B] - idx_base_B;
+
+        if(col_A <= col_B)
+        {
+            ++row_A;
+        }
+
+        if(col_B <= col_A)
+        {
+            ++row_B;
+        }
+
+        ++nnz;
+    }
+
+    // Remainder of either row
+    nnz += (row_end_A - row_A) + (row_end_B - row_B);
+
+    csr_row_ptr_C[gid + 1] = nnz;
+}
+
+// Fill the column indices and values of C, merging the sorted rows of A and B
+// and adding up the values of column indices that appear in both matrices.
+// Each thread processes one row.
+template <typename T, unsigned int BLOCKSIZE>
+static __device__ void csrgeam_fill_device(rocsparse_int m,
+                                           T             alpha,
+                                           const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                           const rocsparse_int* __restrict__ csr_col_ind_A,
+                                           const T* __restrict__ csr_val_A,
+                                           T beta,
+                                           const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                           const rocsparse_int* __restrict__ csr_col_ind_B,
+                                           const T* __restrict__ csr_val_B,
+                                           const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                           rocsparse_int* __restrict__ csr_col_ind_C,
+                                           T* __restrict__ csr_val_C,
+                                           rocsparse_index_base idx_base_A,
+                                           rocsparse_index_base idx_base_B,
+                                           rocsparse_index_base idx_base_C)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_A     = csr_row_ptr_A[gid] - idx_base_A;
+    rocsparse_int row_end_A = csr_row_ptr_A[gid + 1] - idx_base_A;
+    rocsparse_int row_B     = csr_row_ptr_B[gid] - idx_base_B;
+    rocsparse_int row_end_B = csr_row_ptr_B[gid + 1] - idx_base_B;
+
+    rocsparse_int idx = csr_row_ptr_C[gid] - idx_base_C;
+
+    // Merge the sorted column indices of both rows
+    while(row_A < row_end_A && row_B < row_end_B)
+    {
+        rocsparse_int col_A = csr_col_ind_A[row_A] - idx_base_A;
+        rocsparse_int col_B = csr_col_ind_B[row_B] - idx_base_B;
+
+        if(col_A == col_B)
+        {
+            csr_col_ind_C[idx] = col_A + idx_base_C;
+            csr_val_C[idx]     = rocsparse_fma(alpha, csr_val_A[row_A], beta * csr_val_B[row_B]);
+            ++row_A;
+            ++row_B;
+        }
+        else if(col_A < col_B)
+        {
+            csr_col_ind_C[idx] = col_A + idx_base_C;
+            csr_val_C[idx]     = alpha * csr_val_A[row_A];
+            ++row_A;
+        }
+        else
+        {
+            csr_col_ind_C[idx] = col_B + idx_base_C;
+            csr_val_C[idx]     = beta * csr_val_B[row_B];
+            ++row_B;
+        }
+
+        ++idx;
+    }
+
+    // Remainder of row A
+    while(row_A < row_end_A)
+    {
+        csr_col_ind_C[idx] = csr_col_ind_A[row_A] - idx_base_A + idx_base_C;
+        csr_val_C[idx]     = alpha * csr_val_A[row_A];
+        ++row_A;
+        ++idx;
+    }
+
+    // Remainder of row B
+    while(row_B < row_end_B)
+    {
+        csr_col_ind_C[idx] = csr_col_ind_B[row_B] - idx_base_B + idx_base_C;
+        csr_val_C[idx]     = beta * csr_val_B[row_B];
+        ++row_B;
+        ++idx;
+    }
+}
+
+#endif // CSRGEAM_DEVICE_H
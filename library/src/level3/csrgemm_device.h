@@ -0,0 +1,272 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRGEMM_DEVICE_H
+#define CSRGEMM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+__global__ void csrgemm_index_base(rocsparse_int* __restrict__ nnz)
+{
+    --(*nnz);
+}
+
+// Fill the row pointer array of an all empty matrix C
+template <unsigned int BLOCKSIZE>
+__global__ void csrgemm_row_ptr_fill_kernel(rocsparse_int size,
+                                            rocsparse_int* __restrict__ csr_row_ptr,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < size)
+    {
+        csr_row_ptr[gid] = idx_base;
+    }
+}
+
+// Number of intermediate products per row of C, which is the sum of the row
+// lengths of B over all column indices of the corresponding row of A. The
+// counts are written shifted by one, such that an inclusive scan yields the
+// offsets into the expanded product array.
+template <unsigned int BLOCKSIZE>
+__global__ void csrgemm_products_kernel(rocsparse_int m,
+                                        const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                        const rocsparse_int* __restrict__ csr_col_ind_A,
+                                        const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                        rocsparse_int* __restrict__ prod_ptr,
+                                        rocsparse_index_base idx_base_A)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        prod_ptr[0] = 0;
+    }
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr_A[gid] - idx_base_A;
+    rocsparse_int row_end   = csr_row_ptr_A[gid + 1] - idx_base_A;
+
+    rocsparse_int prods = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+        prods += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+    }
+
+    prod_ptr[gid + 1] = prods;
+}
+
+// Expand all intermediate products of a row into the product array. Each
+// wavefront processes one row of C, iterating over the column indices of the
+// corresponding row of A, while the lanes stride over the according row of B.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrgemm_expand_symbolic_kernel(rocsparse_int m,
+                                               const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                               const rocsparse_int* __restrict__ csr_col_ind_A,
+                                               const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                               const rocsparse_int* __restrict__ csr_col_ind_B,
+                                               const rocsparse_int* __restrict__ prod_ptr,
+                                               rocsparse_int* __restrict__ expanded_col,
+                                               rocsparse_index_base idx_base_A,
+                                               rocsparse_index_base idx_base_B)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end   = csr_row_ptr_A[row + 1] - idx_base_A;
+    rocsparse_int offset    = prod_ptr[row];
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+
+        rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(rocsparse_int i = row_begin_B + lid; i < row_end_B; i += WF_SIZE)
+        {
+            expanded_col[offset + (i - row_begin_B)] = csr_col_ind_B[i] - idx_base_B;
+        }
+
+        offset += row_end_B - row_begin_B;
+    }
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrgemm_expand_numeric_kernel(rocsparse_int m,
+                                              const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                              const rocsparse_int* __restrict__ csr_col_ind_A,
+                                              const T* __restrict__ csr_val_A,
+                                              const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                              const rocsparse_int* __restrict__ csr_col_ind_B,
+                                              const T* __restrict__ csr_val_B,
+                                              const rocsparse_int* __restrict__ prod_ptr,
+                                              rocsparse_int* __restrict__ expanded_col,
+                                              T* __restrict__ expanded_val,
+                                              rocsparse_index_base idx_base_A,
+                                              rocsparse_index_base idx_base_B)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end   = csr_row_ptr_A[row + 1] - idx_base_A;
+    rocsparse_int offset    = prod_ptr[row];
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+        T             val_A = csr_val_A[j];
+
+        rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(rocsparse_int i = row_begin_B + lid; i < row_end_B; i += WF_SIZE)
+        {
+            expanded_col[offset + (i - row_begin_B)] = csr_col_ind_B[i] - idx_base_B;
+            expanded_val[offset + (i - row_begin_B)] = val_A * csr_val_B[i];
+        }
+
+        offset += row_end_B - row_begin_B;
+    }
+}
+
+// Count the number of unique column indices per row of the sorted product
+// array. The counts are written shifted by one, such that an inclusive scan
+// yields the row pointer array of C.
+template <unsigned int BLOCKSIZE>
+__global__ void csrgemm_nnz_per_row_kernel(rocsparse_int m,
+                                           const rocsparse_int* __restrict__ prod_ptr,
+                                           const rocsparse_int* __restrict__ expanded_col,
+                                           rocsparse_int* __restrict__ csr_row_ptr_C,
+                                           rocsparse_index_base idx_base_C)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        csr_row_ptr_C[0] = idx_base_C;
+    }
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = prod_ptr[gid];
+    rocsparse_int row_end   = prod_ptr[gid + 1];
+
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        // Column indices are sorted, duplicates are adjacent
+        if(j == row_begin || expanded_col[j] != expanded_col[j - 1])
+        {
+            ++nnz;
+        }
+    }
+
+    csr_row_ptr_C[gid + 1] = nnz;
+}
+
+// Compress the sorted product array into the CSR arrays of C, summing up the
+// values of duplicate column indices. Each thread processes one row.
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrgemm_compress_kernel(rocsparse_int m,
+                                        const rocsparse_int* __restrict__ prod_ptr,
+                                        const rocsparse_int* __restrict__ expanded_col,
+                                        const T* __restrict__ expanded_val,
+                                        const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                        rocsparse_int* __restrict__ csr_col_ind_C,
+                                        T* __restrict__ csr_val_C,
+                                        rocsparse_index_base idx_base_C)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = prod_ptr[gid];
+    rocsparse_int row_end   = prod_ptr[gid + 1];
+
+    if(row_begin == row_end)
+    {
+        return;
+    }
+
+    rocsparse_int idx = csr_row_ptr_C[gid] - idx_base_C;
+
+    rocsparse_int col = expanded_col[row_begin];
+    T             sum = expanded_val[row_begin];
+
+    for(rocsparse_int j = row_begin + 1; j < row_end; ++j)
+    {
+        if(expanded_col[j] == col)
+        {
+            sum += expanded_val[j];
+        }
+        else
+        {
+            csr_col_ind_C[idx] = col + idx_base_C;
+            csr_val_C[idx]     = sum;
+            ++idx;
+
+            col = expanded_col[j];
+            sum = expanded_val[j];
+        }
+    }
+
+    csr_col_ind_C[idx] = col + idx_base_C;
+    csr_val_C[idx]     = sum;
+}
+
+#endif // CSRGEMM_DEVICE_H
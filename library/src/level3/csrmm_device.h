@@ -29,7 +29,20 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+// The matrix values are stored in type A and converted to the compute type T
+// when staged to LDS, such that half or single precision storage can be
+// combined with higher precision accumulation.
+//
+// ALPHA_ONE and BETA_ZERO select compile-time specialized variants for the
+// common alpha == 1 and beta == 0 cases. ALPHA_ONE drops the scaling multiply
+// when staging the matrix values and BETA_ZERO prunes the beta branch in the
+// epilogue, such that C is never read.
+template <typename A,
+          typename T,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int WF_SIZE,
+          bool          ALPHA_ONE = false,
+          bool          BETA_ZERO = false>
 static __device__ void csrmmnn_general_device(rocsparse_int M,
                                               rocsparse_int N,
                                               rocsparse_int K,
@@ -37,7 +50,7 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
                                               T             alpha,
                                               const rocsparse_int* __restrict__ csr_row_ptr,
                                               const rocsparse_int* __restrict__ csr_col_ind,
-                                              const T* __restrict__ csr_val,
+                                              const A* __restrict__ csr_val,
                                               const T* __restrict__ B,
                                               rocsparse_int ldb,
                                               T             beta,
@@ -72,7 +85,9 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
             __syncthreads();
 
             shared_col[wid][lid] = (k < row_end) ? csr_col_ind[k] - idx_base : 0;
-            shared_val[wid][lid] = (k < row_end) ? alpha * csr_val[k] : static_cast<T>(0);
+            shared_val[wid][lid] = (k < row_end) ? (ALPHA_ONE ? static_cast<T>(csr_val[k])
+                                                             : alpha * static_cast<T>(csr_val[k]))
+                                                 : static_cast<T>(0);
 
             __syncthreads();
 
@@ -84,7 +99,7 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
 
         if(col < N)
         {
-            if(beta == static_cast<T>(0))
+            if(BETA_ZERO || beta == static_cast<T>(0))
             {
                 C[row + colC] = sum;
             }
@@ -96,6 +111,243 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
     }
 }
 
+// csrmmnn with a fused elementwise epilogue in the output stage. The
+// epilogue flags are resolved at instantiation time through
+// rocsparse_epilogue_apply and operate per row of C, broadcast across its
+// columns, such that the fused pass costs no extra pass over C compared
+// to the plain general kernel
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, bool DIAG, bool SUB, bool CLAMP>
+static __device__ void csrmmnn_epilogue_device(rocsparse_int M,
+                                               rocsparse_int N,
+                                               rocsparse_int K,
+                                               rocsparse_int nnz,
+                                               T             alpha,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               const T* __restrict__ csr_val,
+                                               const T* __restrict__ B,
+                                               rocsparse_int ldb,
+                                               T             beta,
+                                               T* __restrict__ C,
+                                               rocsparse_int ldc,
+                                               const T* __restrict__ diag,
+                                               const T* __restrict__ vec,
+                                               T                    clamp_lo,
+                                               T                    clamp_hi,
+                                               rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = gid & (WF_SIZE - 1);
+    rocsparse_int wid = tid / WF_SIZE;
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+    rocsparse_int col = lid + hipBlockIdx_y * WF_SIZE;
+
+    rocsparse_int colB = col * ldb;
+    rocsparse_int colC = col * ldc;
+
+    __shared__ rocsparse_int shared_col[BLOCKSIZE / WF_SIZE][WF_SIZE];
+    __shared__ T             shared_val[BLOCKSIZE / WF_SIZE][WF_SIZE];
+
+    for(rocsparse_int row = gid / WF_SIZE; row < M; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = row_start; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int k = j + lid;
+
+            __syncthreads();
+
+            shared_col[wid][lid] = (k < row_end) ? csr_col_ind[k] - idx_base : 0;
+            shared_val[wid][lid]
+                = (k < row_end) ? alpha * static_cast<T>(csr_val[k]) : static_cast<T>(0);
+
+            __syncthreads();
+
+            for(rocsparse_int i = 0; i < WF_SIZE && col < N; ++i)
+            {
+                sum = rocsparse_fma(shared_val[wid][i], B[shared_col[wid][i] + colB], sum);
+            }
+        }
+
+        if(col < N)
+        {
+            if(beta != static_cast<T>(0))
+            {
+                sum = rocsparse_fma(beta, C[row + colC], sum);
+            }
+
+            C[row + colC] = rocsparse_epilogue_apply<T, DIAG, SUB, CLAMP>(
+                row, sum, diag, vec, clamp_lo, clamp_hi);
+        }
+    }
+}
+
+// Row-major variant of csrmmnn_general_device. B and C are stored row-major
+// with leading dimensions ldb and ldc. The thread mapping is unchanged, each
+// wavefront processes one row of A and consecutive lanes own consecutive
+// columns of B and C, such that the row-major dense accesses are coalesced
+// and no transposes of B and C are required.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+static __device__ void csrmmnn_row_major_device(rocsparse_int M,
+                                                rocsparse_int N,
+                                                rocsparse_int K,
+                                                rocsparse_int nnz,
+                                                T             alpha,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ csr_col_ind,
+                                                const T* __restrict__ csr_val,
+                                                const T* __restrict__ B,
+                                                rocsparse_int ldb,
+                                                T             beta,
+                                                T* __restrict__ C,
+                                                rocsparse_int        ldc,
+                                                rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = gid & (WF_SIZE - 1);
+    rocsparse_int wid = tid / WF_SIZE;
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+    rocsparse_int col = lid + hipBlockIdx_y * WF_SIZE;
+
+    __shared__ rocsparse_int shared_col[BLOCKSIZE / WF_SIZE][WF_SIZE];
+    __shared__ T             shared_val[BLOCKSIZE / WF_SIZE][WF_SIZE];
+
+    for(rocsparse_int row = gid / WF_SIZE; row < M; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = row_start; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int k = j + lid;
+
+            __syncthreads();
+
+            shared_col[wid][lid] = (k < row_end) ? csr_col_ind[k] - idx_base : 0;
+            shared_val[wid][lid] = (k < row_end) ? alpha * csr_val[k] : static_cast<T>(0);
+
+            __syncthreads();
+
+            for(rocsparse_int i = 0; i < WF_SIZE && col < N; ++i)
+            {
+                sum = rocsparse_fma(shared_val[wid][i], B[shared_col[wid][i] * ldb + col], sum);
+            }
+        }
+
+        if(col < N)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                C[row * ldc + col] = sum;
+            }
+            else
+            {
+                C[row * ldc + col] = rocsparse_fma(beta, C[row * ldc + col], sum);
+            }
+        }
+    }
+}
+
+// Tiled variant for wide dense B. Each wavefront processes a column tile of
+// TILE * WF_SIZE columns, such that the LDS staged entries of A are re-used
+// across the whole tile and the per nonzero index computations are amortized.
+// The additional columns per thread are accumulated in registers.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE>
+static __device__ void csrmmnn_tile_device(rocsparse_int M,
+                                           rocsparse_int N,
+                                           rocsparse_int K,
+                                           rocsparse_int nnz,
+                                           T             alpha,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           const rocsparse_int* __restrict__ csr_col_ind,
+                                           const T* __restrict__ csr_val,
+                                           const T* __restrict__ B,
+                                           rocsparse_int ldb,
+                                           T             beta,
+                                           T* __restrict__ C,
+                                           rocsparse_int        ldc,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = gid & (WF_SIZE - 1);
+    rocsparse_int wid = tid / WF_SIZE;
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+    rocsparse_int col = lid + hipBlockIdx_y * (WF_SIZE * TILE);
+
+    __shared__ rocsparse_int shared_col[BLOCKSIZE / WF_SIZE][WF_SIZE];
+    __shared__ T             shared_val[BLOCKSIZE / WF_SIZE][WF_SIZE];
+
+    for(rocsparse_int row = gid / WF_SIZE; row < M; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum[TILE];
+
+        for(rocsparse_int t = 0; t < TILE; ++t)
+        {
+            sum[t] = static_cast<T>(0);
+        }
+
+        for(rocsparse_int j = row_start; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int k = j + lid;
+
+            __syncthreads();
+
+            shared_col[wid][lid] = (k < row_end) ? csr_col_ind[k] - idx_base : 0;
+            shared_val[wid][lid] = (k < row_end) ? alpha * csr_val[k] : static_cast<T>(0);
+
+            __syncthreads();
+
+            // Each staged entry of A is re-used for all TILE column groups
+            for(rocsparse_int i = 0; i < WF_SIZE; ++i)
+            {
+                rocsparse_int rowB    = shared_col[wid][i];
+                T             local_val = shared_val[wid][i];
+
+                for(rocsparse_int t = 0; t < TILE; ++t)
+                {
+                    rocsparse_int local_col = col + t * WF_SIZE;
+
+                    if(local_col < N)
+                    {
+                        sum[t] = rocsparse_fma(
+                            local_val, rocsparse_ldg(B + rowB + local_col * ldb), sum[t]);
+                    }
+                }
+            }
+        }
+
+        for(rocsparse_int t = 0; t < TILE; ++t)
+        {
+            rocsparse_int local_col = col + t * WF_SIZE;
+
+            if(local_col < N)
+            {
+                if(beta == static_cast<T>(0))
+                {
+                    C[row + local_col * ldc] = sum[t];
+                }
+                else
+                {
+                    C[row + local_col * ldc]
+                        = rocsparse_fma(beta, C[row + local_col * ldc], sum[t]);
+                }
+            }
+        }
+    }
+}
+
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 static __device__ void csrmmnt_general_device(rocsparse_int offset,
                                               rocsparse_int ncol,
@@ -169,4 +421,171 @@ static __device__ void csrmmnt_general_device(rocsparse_int offset,
     }
 }
 
+// Register-blocked variant of csrmmnt_general_device for wide B. Each
+// wavefront accumulates TILE column groups of the column block in registers,
+// such that the LDS staged entries of A are re-used across the whole
+// TILE * WF_SIZE wide tile and each cached row of B^T serves TILE times as
+// many columns before it is evicted. The inner loop over the WF_SIZE staged
+// sub-columns is unrolled over the register tile.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE>
+static __device__ void csrmmnt_tile_device(rocsparse_int offset,
+                                           rocsparse_int ncol,
+                                           rocsparse_int M,
+                                           rocsparse_int N,
+                                           rocsparse_int K,
+                                           rocsparse_int nnz,
+                                           T             alpha,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           const rocsparse_int* __restrict__ csr_col_ind,
+                                           const T* __restrict__ csr_val,
+                                           const T* __restrict__ B,
+                                           rocsparse_int ldb,
+                                           T             beta,
+                                           T* __restrict__ C,
+                                           rocsparse_int        ldc,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int row = gid / WF_SIZE;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int wid = tid / WF_SIZE;
+
+    if(row >= M)
+    {
+        return;
+    }
+
+    __shared__ rocsparse_int shared_col[BLOCKSIZE / WF_SIZE][WF_SIZE];
+    __shared__ T             shared_val[BLOCKSIZE / WF_SIZE][WF_SIZE];
+
+    rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int l = offset; l < ncol; l += WF_SIZE * TILE)
+    {
+        rocsparse_int col = l + lid;
+
+        T sum[TILE];
+
+        for(rocsparse_int t = 0; t < TILE; ++t)
+        {
+            sum[t] = static_cast<T>(0);
+        }
+
+        for(rocsparse_int j = row_start; j < row_end; j += WF_SIZE)
+        {
+            rocsparse_int k = j + lid;
+
+            __syncthreads();
+
+            shared_col[wid][lid] = (k < row_end) ? N * (csr_col_ind[k] - idx_base) : 0;
+            shared_val[wid][lid] = (k < row_end) ? alpha * csr_val[k] : static_cast<T>(0);
+
+            __syncthreads();
+
+            // Each staged entry serves all TILE column groups
+            for(rocsparse_int i = 0; i < WF_SIZE; ++i)
+            {
+                rocsparse_int colB      = shared_col[wid][i];
+                T             local_val = shared_val[wid][i];
+
+                for(rocsparse_int t = 0; t < TILE; ++t)
+                {
+                    rocsparse_int local_col = col + t * WF_SIZE;
+
+                    T val_B = (local_col < ncol) ? rocsparse_ldg(B + local_col + colB)
+                                                 : static_cast<T>(0);
+                    sum[t]  = rocsparse_fma(local_val, val_B, sum[t]);
+                }
+            }
+        }
+
+        for(rocsparse_int t = 0; t < TILE; ++t)
+        {
+            rocsparse_int local_col = col + t * WF_SIZE;
+
+            if(local_col < ncol)
+            {
+                if(beta == static_cast<T>(0))
+                {
+                    C[row + local_col * ldc] = sum[t];
+                }
+                else
+                {
+                    C[row + local_col * ldc]
+                        = rocsparse_fma(beta, C[row + local_col * ldc], sum[t]);
+                }
+            }
+        }
+    }
+}
+
+// Scale kernel for beta != 1.0
+template <typename T>
+static __device__ void csrmm_scale_device(
+    rocsparse_int m, rocsparse_int n, T beta, T* __restrict__ data, rocsparse_int ld)
+{
+    rocsparse_int gidx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gidy = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(gidx < m && gidy < n)
+    {
+        data[gidx + gidy * ld] *= beta;
+    }
+}
+
+// General CSR SpMM for transposed A. Each wavefront processes one row of A,
+// while the lanes own a column tile of B. The partial products are scattered
+// into C using atomic additions, such that no transposed copy of the matrix
+// is required. C has to be scaled by beta in advance. Since each entry of B
+// is read only once per row, the atomic traffic is amortized over the whole
+// column tile. CONJ selects the conjugate transposed product, conjugating
+// each stored entry on the fly.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, bool CONJ>
+static __device__ void csrmmtn_general_device(rocsparse_int M,
+                                              rocsparse_int N,
+                                              rocsparse_int K,
+                                              rocsparse_int nnz,
+                                              T             alpha,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ csr_val,
+                                              const T* __restrict__ B,
+                                              rocsparse_int ldb,
+                                              T* __restrict__ C,
+                                              rocsparse_int        ldc,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = gid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+    rocsparse_int col = lid + hipBlockIdx_y * WF_SIZE;
+
+    if(col >= N)
+    {
+        return;
+    }
+
+    rocsparse_int colB = col * ldb;
+    rocsparse_int colC = col * ldc;
+
+    for(rocsparse_int row = gid / WF_SIZE; row < M; row += nwf)
+    {
+        rocsparse_int row_start = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T row_val = alpha * rocsparse_ldg(B + row + colB);
+
+        // Scatter each non-zero entry of the current row
+        for(rocsparse_int j = row_start; j < row_end; ++j)
+        {
+            T val = CONJ ? rocsparse_conj(csr_val[j]) : csr_val[j];
+
+            atomicAdd(&C[csr_col_ind[j] - idx_base + colC], val * row_val);
+        }
+    }
+}
+
 #endif // CSRMM_DEVICE_H
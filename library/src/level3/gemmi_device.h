@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMMI_DEVICE_H
+#define GEMMI_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Scale the dense matrix C by beta
+template <typename T>
+static __device__ void
+    gemmi_scale_device(rocsparse_int m, rocsparse_int n, T beta, T* __restrict__ data, rocsparse_int ld)
+{
+    rocsparse_int gidx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gidy = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(gidx >= m || gidy >= n)
+    {
+        return;
+    }
+
+    data[gidx + gidy * ld] *= beta;
+}
+
+// Dense matrix sparse matrix multiplication C := alpha * A * B^T + beta * C,
+// with B^T given in CSR storage format, such that each CSR row of B^T holds
+// one column of the sparse right-hand side of the product. Each block column
+// of the grid processes one column of C, each thread computes one entry. The
+// threads of a wavefront read consecutive entries of a column of the dense A,
+// such that the A loads are coalesced, while the CSR structure of the short
+// B^T row is broadcast from cache.
+template <typename T, rocsparse_int BLOCKSIZE>
+static __device__ void gemmi_general_device(rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int k,
+                                            rocsparse_int nnz,
+                                            T             alpha,
+                                            const T* __restrict__ A,
+                                            rocsparse_int lda,
+                                            const T* __restrict__ csr_val,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            T beta,
+                                            T* __restrict__ C,
+                                            rocsparse_int        ldc,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int col = hipBlockIdx_y;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[col] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[col + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        sum = rocsparse_fma(csr_val[j],
+                            rocsparse_ldg(A + row + (csr_col_ind[j] - idx_base) * lda),
+                            sum);
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        C[row + col * ldc] = alpha * sum;
+    }
+    else
+    {
+        C[row + col * ldc] = rocsparse_fma(beta, C[row + col * ldc], alpha * sum);
+    }
+}
+
+#endif // GEMMI_DEVICE_H
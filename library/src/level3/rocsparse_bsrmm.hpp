@@ -0,0 +1,359 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSRMM_HPP
+#define ROCSPARSE_BSRMM_HPP
+
+#include "bsrmm_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void bsrmm_scale_kernel(
+    rocsparse_int m, rocsparse_int n, const T* __restrict__ beta, T* __restrict__ data, rocsparse_int ld)
+{
+    if(*beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    bsrmm_scale_device<T>(m, n, *beta, data, ld);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE>
+__launch_bounds__(256) __global__ void bsrmmnn_general_kernel(rocsparse_int m,
+                                                              rocsparse_int n,
+                                                              rocsparse_int k,
+                                                              rocsparse_int block_dim,
+                                                              const T*      alpha,
+                                                              const rocsparse_int* __restrict__ bsr_row_ptr,
+                                                              const rocsparse_int* __restrict__ bsr_col_ind,
+                                                              const T* __restrict__ bsr_val,
+                                                              const T* __restrict__ B,
+                                                              rocsparse_int ldb,
+                                                              const T*      beta,
+                                                              T* __restrict__ C,
+                                                              rocsparse_int        ldc,
+                                                              rocsparse_index_base idx_base)
+{
+    if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    bsrmmnn_general_device<T, BLOCKSIZE>(m,
+                                         n,
+                                         k,
+                                         block_dim,
+                                         *alpha,
+                                         bsr_row_ptr,
+                                         bsr_col_ind,
+                                         bsr_val,
+                                         B,
+                                         ldb,
+                                         *beta,
+                                         C,
+                                         ldc,
+                                         idx_base);
+}
+
+template <typename T>
+__launch_bounds__(64) __global__ void bsrmmnn_mfma_kernel(rocsparse_int m,
+                                                          rocsparse_int n,
+                                                          rocsparse_int k,
+                                                          const T*      alpha,
+                                                          const rocsparse_int* __restrict__ bsr_row_ptr,
+                                                          const rocsparse_int* __restrict__ bsr_col_ind,
+                                                          const T* __restrict__ bsr_val,
+                                                          const T* __restrict__ B,
+                                                          rocsparse_int ldb,
+                                                          const T*      beta,
+                                                          T* __restrict__ C,
+                                                          rocsparse_int        ldc,
+                                                          rocsparse_index_base idx_base)
+{
+    if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    bsrmmnn_mfma_device<T>(
+        m, n, k, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, B, ldb, *beta, C, ldc, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             n,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_bsr_mat   bsr,
+                                          const T*                  B,
+                                          rocsparse_int             ldb,
+                                          const T*                  beta,
+                                          T*                        C,
+                                          rocsparse_int             ldc)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmm"),
+                  trans_A,
+                  trans_B,
+                  n,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmm"),
+                  trans_A,
+                  trans_B,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr->m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr->n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr->nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr->block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check BSR structure
+    if(bsr->nnzb > 0)
+    {
+        if(bsr->bsr_row_ptr == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(bsr->bsr_col_ind == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(bsr->bsr_val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions
+    rocsparse_int one = 1;
+    if(ldb < std::max(one, bsr->n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldc < std::max(one, bsr->m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(bsr->m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Quick return before staging the scalars
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Stage the scalars through the pinned ring, such that the kernels
+    // read them from device memory in either pointer mode
+    const T* d_alpha = nullptr;
+    const T* d_beta  = nullptr;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    // If the sparse matrix is empty, the product reduces to C := beta * C
+    if(bsr->nnzb == 0)
+    {
+        dim3 scale_blocks((bsr->m - 1) / 16 + 1, (n - 1) / 16 + 1);
+        dim3 scale_threads(16, 16);
+
+        hipLaunchKernelGGL((bsrmm_scale_kernel<T>),
+                           scale_blocks,
+                           scale_threads,
+                           0,
+                           stream,
+                           bsr->m,
+                           n,
+                           d_beta,
+                           C,
+                           ldc);
+
+        return rocsparse_status_success;
+    }
+
+    // The 16x16x4 matrix core fragments of gfx908 and newer map one 16x16
+    // block times a 16 column panel of B onto four fragment updates.
+    // Double precision fragments require gfx90a
+    if(bsr->block_dim == 16 && handle->wavefront_size == 64
+       && handle->properties.gcnArch >= (sizeof(T) == 8 ? 910 : 908))
+    {
+        dim3 bsrmm_blocks(bsr->mb, (n - 1) / 16 + 1);
+        dim3 bsrmm_threads(64);
+
+        hipLaunchKernelGGL((bsrmmnn_mfma_kernel<T>),
+                           bsrmm_blocks,
+                           bsrmm_threads,
+                           0,
+                           stream,
+                           bsr->m,
+                           n,
+                           bsr->n,
+                           d_alpha,
+                           bsr->bsr_row_ptr,
+                           bsr->bsr_col_ind,
+                           reinterpret_cast<const T*>(bsr->bsr_val),
+                           B,
+                           ldb,
+                           d_beta,
+                           C,
+                           ldc,
+                           descr->base);
+
+        return rocsparse_status_success;
+    }
+
+#define BSRMM_DIM 256
+    dim3 bsrmm_blocks((bsr->m - 1) / BSRMM_DIM + 1, n);
+    dim3 bsrmm_threads(BSRMM_DIM);
+
+    hipLaunchKernelGGL((bsrmmnn_general_kernel<T, BSRMM_DIM>),
+                       bsrmm_blocks,
+                       bsrmm_threads,
+                       0,
+                       stream,
+                       bsr->m,
+                       n,
+                       bsr->n,
+                       bsr->block_dim,
+                       d_alpha,
+                       bsr->bsr_row_ptr,
+                       bsr->bsr_col_ind,
+                       reinterpret_cast<const T*>(bsr->bsr_val),
+                       B,
+                       ldb,
+                       d_beta,
+                       C,
+                       ldc,
+                       descr->base);
+#undef BSRMM_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_BSRMM_HPP
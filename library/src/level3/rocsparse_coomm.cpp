@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse.h"
+
+#include "rocsparse_coomm.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scoomm(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             k,
+                                             rocsparse_int             nnz,
+                                             const float*              alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              coo_val,
+                                             const rocsparse_int*      coo_row_ind,
+                                             const rocsparse_int*      coo_col_ind,
+                                             const float*              B,
+                                             rocsparse_int             ldb,
+                                             const float*              beta,
+                                             float*                    C,
+                                             rocsparse_int             ldc)
+{
+    return rocsparse_coomm_template<float>(handle,
+                                           trans_A,
+                                           trans_B,
+                                           m,
+                                           n,
+                                           k,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           coo_val,
+                                           coo_row_ind,
+                                           coo_col_ind,
+                                           B,
+                                           ldb,
+                                           beta,
+                                           C,
+                                           ldc);
+}
+
+extern "C" rocsparse_status rocsparse_dcoomm(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             k,
+                                             rocsparse_int             nnz,
+                                             const double*             alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             coo_val,
+                                             const rocsparse_int*      coo_row_ind,
+                                             const rocsparse_int*      coo_col_ind,
+                                             const double*             B,
+                                             rocsparse_int             ldb,
+                                             const double*             beta,
+                                             double*                   C,
+                                             rocsparse_int             ldc)
+{
+    return rocsparse_coomm_template<double>(handle,
+                                            trans_A,
+                                            trans_B,
+                                            m,
+                                            n,
+                                            k,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            coo_val,
+                                            coo_row_ind,
+                                            coo_col_ind,
+                                            B,
+                                            ldb,
+                                            beta,
+                                            C,
+                                            ldc);
+}
+
+extern "C" rocsparse_status rocsparse_ccoomm(rocsparse_handle               handle,
+                                             rocsparse_operation            trans_A,
+                                             rocsparse_operation            trans_B,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  n,
+                                             rocsparse_int                  k,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_float_complex* alpha,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* coo_val,
+                                             const rocsparse_int*           coo_row_ind,
+                                             const rocsparse_int*           coo_col_ind,
+                                             const rocsparse_float_complex* B,
+                                             rocsparse_int                  ldb,
+                                             const rocsparse_float_complex* beta,
+                                             rocsparse_float_complex*       C,
+                                             rocsparse_int                  ldc)
+{
+    return rocsparse_coomm_template<rocsparse_float_complex>(handle,
+                                                             trans_A,
+                                                             trans_B,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             nnz,
+                                                             alpha,
+                                                             descr,
+                                                             coo_val,
+                                                             coo_row_ind,
+                                                             coo_col_ind,
+                                                             B,
+                                                             ldb,
+                                                             beta,
+                                                             C,
+                                                             ldc);
+}
+
+extern "C" rocsparse_status rocsparse_zcoomm(rocsparse_handle                handle,
+                                             rocsparse_operation             trans_A,
+                                             rocsparse_operation             trans_B,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   n,
+                                             rocsparse_int                   k,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* coo_val,
+                                             const rocsparse_int*            coo_row_ind,
+                                             const rocsparse_int*            coo_col_ind,
+                                             const rocsparse_double_complex* B,
+                                             rocsparse_int                   ldb,
+                                             const rocsparse_double_complex* beta,
+                                             rocsparse_double_complex*       C,
+                                             rocsparse_int                   ldc)
+{
+    return rocsparse_coomm_template<rocsparse_double_complex>(handle,
+                                                              trans_A,
+                                                              trans_B,
+                                                              m,
+                                                              n,
+                                                              k,
+                                                              nnz,
+                                                              alpha,
+                                                              descr,
+                                                              coo_val,
+                                                              coo_row_ind,
+                                                              coo_col_ind,
+                                                              B,
+                                                              ldb,
+                                                              beta,
+                                                              C,
+                                                              ldc);
+}
@@ -0,0 +1,345 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_COOMM_HPP
+#define ROCSPARSE_COOMM_HPP
+
+#include "coomm_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void coommn_scale_kernel(
+    rocsparse_int m, rocsparse_int n, const T* beta, T* __restrict__ C, rocsparse_int ldc)
+{
+    coommn_scale_device<T>(m, n, *beta, C, ldc);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int COLS>
+__launch_bounds__(128) __global__
+    void coommn_wf_kernel(rocsparse_int m,
+                          rocsparse_int n,
+                          rocsparse_int nnz,
+                          rocsparse_int loops,
+                          const T*      alpha,
+                          const rocsparse_int* __restrict__ coo_row_ind,
+                          const rocsparse_int* __restrict__ coo_col_ind,
+                          const T* __restrict__ coo_val,
+                          const T* __restrict__ B,
+                          rocsparse_int ldb,
+                          T* __restrict__ C,
+                          rocsparse_int        ldc,
+                          rocsparse_index_base idx_base)
+{
+    coommn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE, COLS>(m,
+                                                          n,
+                                                          nnz,
+                                                          loops,
+                                                          *alpha,
+                                                          coo_row_ind,
+                                                          coo_col_ind,
+                                                          coo_val,
+                                                          B,
+                                                          ldb,
+                                                          C,
+                                                          ldc,
+                                                          idx_base);
+}
+
+// Non-zero parallel COO SpMM. The flat partitioning of the non-zero entries
+// across the wavefronts makes the kernel insensitive to the row length
+// distribution, such that heavy-tailed matrices, where single rows hold a
+// substantial share of all non-zeros, cannot idle workgroups the way the
+// row parallel csrmm kernels do
+template <typename T>
+rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          rocsparse_int             nnz,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  coo_val,
+                                          const rocsparse_int*      coo_row_ind,
+                                          const rocsparse_int*      coo_col_ind,
+                                          const T*                  B,
+                                          rocsparse_int             ldb,
+                                          const T*                  beta,
+                                          T*                        C,
+                                          rocsparse_int             ldc)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcoomm"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcoomm"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(coo_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check leading dimension of B
+    rocsparse_int one = 1;
+    if(ldb < std::max(one, k))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check leading dimension of C
+    if(ldc < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Profile the operation ; the matrix data and B are each moved once per
+    // column tile, C is read and written once
+    rocsparse_profile_scope<T> profile(
+        handle,
+        "rocsparse_Xcoomm",
+        static_cast<double>(sizeof(T)) * (static_cast<double>(nnz) * n + 2.0 * m * n + nnz)
+            + static_cast<double>(sizeof(rocsparse_int)) * 2.0 * nnz);
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xcoomm");
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define COOMMN_DIM 128
+#define COOMMN_TILE 4
+    rocsparse_int maxthreads = handle->properties.maxThreadsPerBlock;
+    rocsparse_int nprocs     = handle->properties.multiProcessorCount;
+    rocsparse_int maxblocks  = (nprocs * maxthreads - 1) / COOMMN_DIM + 1;
+    rocsparse_int minblocks  = (nnz - 1) / COOMMN_DIM + 1;
+
+    rocsparse_int nblocks = maxblocks < minblocks ? maxblocks : minblocks;
+    rocsparse_int nwfs    = nblocks * (COOMMN_DIM / handle->wavefront_size);
+    rocsparse_int nloops  = (nnz / handle->wavefront_size + 1) / nwfs + 1;
+
+    dim3 coommn_blocks(nblocks, (n - 1) / COOMMN_TILE + 1);
+    dim3 coommn_threads(COOMMN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    // The partial row sums scatter into C with atomic additions, C is
+    // therefore scaled with beta by a separate kernel up front. The grid
+    // of the reduction kernel is two dimensional, such that the fused,
+    // grid barrier based scaling of coomv does not carry over
+    hipLaunchKernelGGL((coommn_scale_kernel<T>),
+                       dim3((m * n - 1) / COOMMN_DIM + 1),
+                       coommn_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       d_beta,
+                       C,
+                       ldc);
+
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((coommn_wf_kernel<T, COOMMN_DIM, 32, COOMMN_TILE>),
+                           coommn_blocks,
+                           coommn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           nnz,
+                           nloops,
+                           d_alpha,
+                           coo_row_ind,
+                           coo_col_ind,
+                           coo_val,
+                           B,
+                           ldb,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((coommn_wf_kernel<T, COOMMN_DIM, 64, COOMMN_TILE>),
+                           coommn_blocks,
+                           coommn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           nnz,
+                           nloops,
+                           d_alpha,
+                           coo_row_ind,
+                           coo_col_ind,
+                           coo_val,
+                           B,
+                           ldb,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef COOMMN_TILE
+#undef COOMMN_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_COOMM_HPP
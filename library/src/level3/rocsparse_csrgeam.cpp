@@ -0,0 +1,474 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_csrgeam.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+extern "C" rocsparse_status rocsparse_csrgeam_buffer_size(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          const rocsparse_mat_descr descr_A,
+                                                          rocsparse_int             nnz_A,
+                                                          const rocsparse_int*      csr_row_ptr_A,
+                                                          const rocsparse_int*      csr_col_ind_A,
+                                                          const rocsparse_mat_descr descr_B,
+                                                          rocsparse_int             nnz_B,
+                                                          const rocsparse_int*      csr_row_ptr_B,
+                                                          const rocsparse_int*      csr_col_ind_B,
+                                                          size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgeam_buffer_size",
+              m,
+              n,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_B->base != rocsparse_index_base_zero
+            && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_A < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || (nnz_A == 0 && nnz_B == 0))
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // rocPRIM scan scratch, required to assemble the row pointer array of C
+    rocsparse_int* dummy = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, *buffer_size, dummy, dummy, m + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr descr_A,
+                                                  rocsparse_int             nnz_A,
+                                                  const rocsparse_int*      csr_row_ptr_A,
+                                                  const rocsparse_int*      csr_col_ind_A,
+                                                  const rocsparse_mat_descr descr_B,
+                                                  rocsparse_int             nnz_B,
+                                                  const rocsparse_int*      csr_row_ptr_B,
+                                                  const rocsparse_int*      csr_col_ind_B,
+                                                  const rocsparse_mat_descr descr_C,
+                                                  rocsparse_int*            csr_row_ptr_C,
+                                                  rocsparse_int*            nnz_C,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgeam_nnz",
+              m,
+              n,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_B->base != rocsparse_index_base_zero
+            && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_C->base != rocsparse_index_base_zero
+            && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_A < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSRGEAM_DIM 256
+    // If A and B are empty, C is empty aswell
+    if(n == 0 || (nnz_A == 0 && nnz_B == 0))
+    {
+        dim3 csrgeam_blocks(m / CSRGEAM_DIM + 1);
+        dim3 csrgeam_threads(CSRGEAM_DIM);
+
+        hipLaunchKernelGGL((csrgeam_row_ptr_fill_kernel<CSRGEAM_DIM>),
+                           csrgeam_blocks,
+                           csrgeam_threads,
+                           0,
+                           stream,
+                           m + 1,
+                           csr_row_ptr_C,
+                           descr_C->base);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    if(csr_row_ptr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Count the non-zero entries per row of C
+    dim3 csrgeam_blocks((m - 1) / CSRGEAM_DIM + 1);
+    dim3 csrgeam_threads(CSRGEAM_DIM);
+
+    hipLaunchKernelGGL((csrgeam_nnz_per_row_kernel<CSRGEAM_DIM>),
+                       csrgeam_blocks,
+                       csrgeam_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_row_ptr_C,
+                       descr_A->base,
+                       descr_B->base,
+                       descr_C->base);
+#undef CSRGEAM_DIM
+
+    // rocPRIM scan scratch size
+    size_t scan_size;
+    rocsparse_int* dummy = reinterpret_cast<rocsparse_int*>(&scan_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, scan_size, dummy, dummy, m + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    // Inclusive scan to obtain the row pointer array of C
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_buffer,
+                                                scan_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract and adjust nnz
+    if(descr_C->base == rocsparse_index_base_one)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+            // Adjust nnz according to index base
+            hipLaunchKernelGGL((csrgeam_index_base), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+            // Adjust nnz according to index base
+            *nnz_C -= descr_C->base;
+        }
+    }
+    else
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrgeam(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const float*              alpha,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const float*              csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const float*              beta,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const float*              csr_val_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               const rocsparse_mat_descr descr_C,
+                                               float*                    csr_val_C,
+                                               const rocsparse_int*      csr_row_ptr_C,
+                                               rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_csrgeam_template<float>(handle,
+                                             m,
+                                             n,
+                                             alpha,
+                                             descr_A,
+                                             nnz_A,
+                                             csr_val_A,
+                                             csr_row_ptr_A,
+                                             csr_col_ind_A,
+                                             beta,
+                                             descr_B,
+                                             nnz_B,
+                                             csr_val_B,
+                                             csr_row_ptr_B,
+                                             csr_col_ind_B,
+                                             descr_C,
+                                             csr_val_C,
+                                             csr_row_ptr_C,
+                                             csr_col_ind_C);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrgeam(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const double*             alpha,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const double*             csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const double*             beta,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const double*             csr_val_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               const rocsparse_mat_descr descr_C,
+                                               double*                   csr_val_C,
+                                               const rocsparse_int*      csr_row_ptr_C,
+                                               rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_csrgeam_template<double>(handle,
+                                              m,
+                                              n,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              beta,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_val_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              descr_C,
+                                              csr_val_C,
+                                              csr_row_ptr_C,
+                                              csr_col_ind_C);
+}
@@ -0,0 +1,654 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_csrgemm.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+extern "C" rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans_A,
+                                                          rocsparse_operation       trans_B,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          rocsparse_int             k,
+                                                          const rocsparse_mat_descr descr_A,
+                                                          rocsparse_int             nnz_A,
+                                                          const rocsparse_int*      csr_row_ptr_A,
+                                                          const rocsparse_int*      csr_col_ind_A,
+                                                          const rocsparse_mat_descr descr_B,
+                                                          rocsparse_int             nnz_B,
+                                                          const rocsparse_int*      csr_row_ptr_B,
+                                                          const rocsparse_int*      csr_col_ind_B,
+                                                          size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgemm_buffer_size",
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)buffer_size);
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_B->base != rocsparse_index_base_zero
+            && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_A < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    if(csr_row_ptr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // rocPRIM scan scratch size
+    size_t scan_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_scan_size(stream, m, &scan_size));
+
+    // The buffer size depends on the total number of intermediate products,
+    // which is computed in a temporary workspace
+    rocsparse_int* prod_ptr = nullptr;
+    void*          scan_temp = nullptr;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int) * (m + 1), (void**)&prod_ptr));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(scan_size, &scan_temp));
+
+    rocsparse_int total;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_products(handle,
+                                                         m,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         csr_row_ptr_B,
+                                                         descr_A->base,
+                                                         prod_ptr,
+                                                         scan_temp,
+                                                         scan_size,
+                                                         &total));
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(scan_temp));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(prod_ptr));
+
+    // Intermediate product offsets
+    *buffer_size = sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+    // rocPRIM scan scratch
+    *buffer_size += scan_size;
+
+    if(total > 0)
+    {
+        // Expanded column indices, rocPRIM does not support in-place sorting
+        *buffer_size += 2 * sizeof(rocsparse_int) * ((total - 1) / 256 + 1) * 256;
+        // Expanded values, stored in double precision sized slots
+        *buffer_size += 2 * sizeof(double) * ((total - 1) / 256 + 1) * 256;
+
+        // rocPRIM sort scratch
+        size_t sort_size;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_sort_size(stream, m, total, &sort_size));
+        *buffer_size += sort_size;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans_A,
+                                                  rocsparse_operation       trans_B,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             k,
+                                                  const rocsparse_mat_descr descr_A,
+                                                  rocsparse_int             nnz_A,
+                                                  const rocsparse_int*      csr_row_ptr_A,
+                                                  const rocsparse_int*      csr_col_ind_A,
+                                                  const rocsparse_mat_descr descr_B,
+                                                  rocsparse_int             nnz_B,
+                                                  const rocsparse_int*      csr_row_ptr_B,
+                                                  const rocsparse_int*      csr_col_ind_B,
+                                                  const rocsparse_mat_descr descr_C,
+                                                  rocsparse_int*            csr_row_ptr_C,
+                                                  rocsparse_int*            nnz_C,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgemm_nnz",
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)temp_buffer);
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_B->base != rocsparse_index_base_zero
+            && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_C->base != rocsparse_index_base_zero
+            && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_A < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSRGEMM_DIM 256
+    // If A or B is empty, C is empty aswell
+    if(n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        dim3 csrgemm_blocks(m / CSRGEMM_DIM + 1);
+        dim3 csrgemm_threads(CSRGEMM_DIM);
+
+        hipLaunchKernelGGL((csrgemm_row_ptr_fill_kernel<CSRGEMM_DIM>),
+                           csrgemm_blocks,
+                           csrgemm_threads,
+                           0,
+                           stream,
+                           m + 1,
+                           csr_row_ptr_C,
+                           descr_C->base);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    if(csr_row_ptr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // rocPRIM scan scratch size
+    size_t scan_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_scan_size(stream, m, &scan_size));
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Intermediate product offsets
+    rocsparse_int* prod_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    // rocPRIM scan scratch
+    void* scan_temp = reinterpret_cast<void*>(ptr);
+    ptr += scan_size;
+
+    // Compute the intermediate product offsets, blocking the stream
+    rocsparse_int total;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_products(handle,
+                                                         m,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         csr_row_ptr_B,
+                                                         descr_A->base,
+                                                         prod_ptr,
+                                                         scan_temp,
+                                                         scan_size,
+                                                         &total));
+
+    // C has no entries
+    if(total == 0)
+    {
+        dim3 csrgemm_blocks(m / CSRGEMM_DIM + 1);
+        dim3 csrgemm_threads(CSRGEMM_DIM);
+
+        hipLaunchKernelGGL((csrgemm_row_ptr_fill_kernel<CSRGEMM_DIM>),
+                           csrgemm_blocks,
+                           csrgemm_threads,
+                           0,
+                           stream,
+                           m + 1,
+                           csr_row_ptr_C,
+                           descr_C->base);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Expanded column indices, rocPRIM does not support in-place sorting
+    rocsparse_int* expanded_col0 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((total - 1) / 256 + 1) * 256;
+    rocsparse_int* expanded_col1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((total - 1) / 256 + 1) * 256;
+
+    // Skip the expanded value arrays, they are not required for the
+    // symbolic computation
+    ptr += 2 * sizeof(double) * ((total - 1) / 256 + 1) * 256;
+
+    // rocPRIM sort scratch
+    void*  sort_temp = reinterpret_cast<void*>(ptr);
+    size_t sort_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_sort_size(stream, m, total, &sort_size));
+
+    // Expand the column indices of all intermediate products
+#define CSRGEMM_SUB_WF_SIZE 32
+    dim3 csrgemm_expand_blocks((m * CSRGEMM_SUB_WF_SIZE - 1) / CSRGEMM_DIM + 1);
+    dim3 csrgemm_expand_threads(CSRGEMM_DIM);
+
+    hipLaunchKernelGGL((csrgemm_expand_symbolic_kernel<CSRGEMM_DIM, CSRGEMM_SUB_WF_SIZE>),
+                       csrgemm_expand_blocks,
+                       csrgemm_expand_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       prod_ptr,
+                       expanded_col0,
+                       descr_A->base,
+                       descr_B->base);
+#undef CSRGEMM_SUB_WF_SIZE
+
+    // Sort the intermediate products of each row by column index
+    rocprim::double_buffer<rocsparse_int> keys(expanded_col0, expanded_col1);
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys(
+        sort_temp, sort_size, keys, total, m, prod_ptr, prod_ptr + 1, 0, 32, stream));
+
+    // Count the unique column indices per row
+    dim3 csrgemm_nnz_blocks((m - 1) / CSRGEMM_DIM + 1);
+    dim3 csrgemm_nnz_threads(CSRGEMM_DIM);
+
+    hipLaunchKernelGGL((csrgemm_nnz_per_row_kernel<CSRGEMM_DIM>),
+                       csrgemm_nnz_blocks,
+                       csrgemm_nnz_threads,
+                       0,
+                       stream,
+                       m,
+                       prod_ptr,
+                       keys.current(),
+                       csr_row_ptr_C,
+                       descr_C->base);
+#undef CSRGEMM_DIM
+
+    // Inclusive scan to obtain the row pointer array of C
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(scan_temp,
+                                                scan_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract and adjust nnz
+    if(descr_C->base == rocsparse_index_base_one)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+            // Adjust nnz according to index base
+            hipLaunchKernelGGL((csrgemm_index_base), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+            // Adjust nnz according to index base
+            *nnz_C -= descr_C->base;
+        }
+    }
+    else
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrgemm(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             k,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const float*              csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const float*              csr_val_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               const rocsparse_mat_descr descr_C,
+                                               float*                    csr_val_C,
+                                               const rocsparse_int*      csr_row_ptr_C,
+                                               rocsparse_int*            csr_col_ind_C,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_template<float>(handle,
+                                             trans_A,
+                                             trans_B,
+                                             m,
+                                             n,
+                                             k,
+                                             descr_A,
+                                             nnz_A,
+                                             csr_val_A,
+                                             csr_row_ptr_A,
+                                             csr_col_ind_A,
+                                             descr_B,
+                                             nnz_B,
+                                             csr_val_B,
+                                             csr_row_ptr_B,
+                                             csr_col_ind_B,
+                                             descr_C,
+                                             csr_val_C,
+                                             csr_row_ptr_C,
+                                             csr_col_ind_C,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrgemm(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             k,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const double*             csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const double*             csr_val_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               const rocsparse_mat_descr descr_C,
+                                               double*                   csr_val_C,
+                                               const rocsparse_int*      csr_row_ptr_C,
+                                               rocsparse_int*            csr_col_ind_C,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_template<double>(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_val_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              descr_C,
+                                              csr_val_C,
+                                              csr_row_ptr_C,
+                                              csr_col_ind_C,
+                                              temp_buffer);
+}
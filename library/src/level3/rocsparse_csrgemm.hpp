@@ -0,0 +1,423 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRGEMM_HPP
+#define ROCSPARSE_CSRGEMM_HPP
+
+#include "csrgemm_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+// csrgemm follows an expand / sort / compress scheme. All intermediate
+// products a_ik * b_kj are expanded into a temporary array, sorted by column
+// index per row of C using a segmented radix sort and finally compressed by
+// summing up duplicate column entries.
+//
+// The temporary storage buffer is laid out in 256 byte aligned chunks, in
+// order: the intermediate product offsets (m + 1 entries), the rocPRIM scan
+// scratch, two expanded column index arrays, two expanded value arrays and
+// the rocPRIM sort scratch. The value arrays use double precision sized
+// slots, such that the layout does not depend on the precision and the nnz
+// step can be precision agnostic. All offsets only depend on the number of
+// rows and the number of intermediate products, such that the nnz and the
+// compute step recover the offsets computed by rocsparse_csrgemm_buffer_size.
+
+// Scratch size of the rocPRIM scan primitive, 256 byte aligned
+static inline rocsparse_status
+rocsparse_csrgemm_scan_size(hipStream_t stream, rocsparse_int m, size_t* scan_size)
+{
+    rocsparse_int* dummy = reinterpret_cast<rocsparse_int*>(scan_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, *scan_size, dummy, dummy, m + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    *scan_size = ((*scan_size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+// Scratch size of the rocPRIM segmented sort primitives, 256 byte aligned
+static inline rocsparse_status rocsparse_csrgemm_sort_size(hipStream_t   stream,
+                                                           rocsparse_int m,
+                                                           rocsparse_int total,
+                                                           size_t*       sort_size)
+{
+    rocsparse_int* dummy_int    = reinterpret_cast<rocsparse_int*>(sort_size);
+    float*         dummy_float  = reinterpret_cast<float*>(sort_size);
+    double*        dummy_double = reinterpret_cast<double*>(sort_size);
+
+    rocprim::double_buffer<rocsparse_int> dummy_keys(dummy_int, dummy_int);
+    rocprim::double_buffer<float>         dummy_fvals(dummy_float, dummy_float);
+    rocprim::double_buffer<double>        dummy_dvals(dummy_double, dummy_double);
+
+    size_t size;
+    *sort_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_keys(
+        nullptr, size, dummy_keys, total, m, dummy_int, dummy_int + 1, 0, 32, stream));
+    *sort_size = std::max(size, *sort_size);
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
+        nullptr, size, dummy_keys, dummy_fvals, total, m, dummy_int, dummy_int + 1, 0, 32, stream));
+    *sort_size = std::max(size, *sort_size);
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
+        nullptr, size, dummy_keys, dummy_dvals, total, m, dummy_int, dummy_int + 1, 0, 32, stream));
+    *sort_size = std::max(size, *sort_size);
+
+    *sort_size = ((*sort_size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+// Computes the intermediate product offsets of each row of C by an inclusive
+// scan over the per row product counts. The total number of intermediate
+// products is returned on the host, blocking the stream.
+static inline rocsparse_status rocsparse_csrgemm_products(rocsparse_handle     handle,
+                                                          rocsparse_int        m,
+                                                          const rocsparse_int* csr_row_ptr_A,
+                                                          const rocsparse_int* csr_col_ind_A,
+                                                          const rocsparse_int* csr_row_ptr_B,
+                                                          rocsparse_index_base idx_base_A,
+                                                          rocsparse_int*       prod_ptr,
+                                                          void*                scan_temp,
+                                                          size_t               scan_size,
+                                                          rocsparse_int*       total)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRGEMM_DIM 256
+    dim3 csrgemm_blocks((m - 1) / CSRGEMM_DIM + 1);
+    dim3 csrgemm_threads(CSRGEMM_DIM);
+
+    hipLaunchKernelGGL((csrgemm_products_kernel<CSRGEMM_DIM>),
+                       csrgemm_blocks,
+                       csrgemm_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       prod_ptr,
+                       idx_base_A);
+#undef CSRGEMM_DIM
+
+    // Inclusive scan to obtain the offsets into the expanded product array
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        scan_temp, scan_size, prod_ptr, prod_ptr, m + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    // Obtain the total number of intermediate products
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(total, prod_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             k,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnz_A,
+                                            const T*                  csr_val_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnz_B,
+                                            const T*                  csr_val_B,
+                                            const rocsparse_int*      csr_row_ptr_B,
+                                            const rocsparse_int*      csr_col_ind_B,
+                                            const rocsparse_mat_descr descr_C,
+                                            T*                        csr_val_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            rocsparse_int*            csr_col_ind_C,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrgemm -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_B->base != rocsparse_index_base_zero
+            && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(descr_C->base != rocsparse_index_base_zero
+            && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    else if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_A < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // rocPRIM scan scratch size
+    size_t scan_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_scan_size(stream, m, &scan_size));
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Intermediate product offsets
+    rocsparse_int* prod_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    // rocPRIM scan scratch
+    void* scan_temp = reinterpret_cast<void*>(ptr);
+    ptr += scan_size;
+
+    // Compute the intermediate product offsets, blocking the stream
+    rocsparse_int total;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_products(handle,
+                                                         m,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         csr_row_ptr_B,
+                                                         descr_A->base,
+                                                         prod_ptr,
+                                                         scan_temp,
+                                                         scan_size,
+                                                         &total));
+
+    // C has no entries
+    if(total == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Expanded column indices, rocPRIM does not support in-place sorting
+    rocsparse_int* expanded_col0 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((total - 1) / 256 + 1) * 256;
+    rocsparse_int* expanded_col1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((total - 1) / 256 + 1) * 256;
+
+    // Expanded values, stored in double precision sized slots
+    T* expanded_val0 = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(double) * ((total - 1) / 256 + 1) * 256;
+    T* expanded_val1 = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(double) * ((total - 1) / 256 + 1) * 256;
+
+    // rocPRIM sort scratch
+    void*  sort_temp = reinterpret_cast<void*>(ptr);
+    size_t sort_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_sort_size(stream, m, total, &sort_size));
+
+    // Expand all intermediate products
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB_WF_SIZE 32
+    dim3 csrgemm_expand_blocks((m * CSRGEMM_SUB_WF_SIZE - 1) / CSRGEMM_DIM + 1);
+    dim3 csrgemm_expand_threads(CSRGEMM_DIM);
+
+    hipLaunchKernelGGL((csrgemm_expand_numeric_kernel<T, CSRGEMM_DIM, CSRGEMM_SUB_WF_SIZE>),
+                       csrgemm_expand_blocks,
+                       csrgemm_expand_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       csr_val_B,
+                       prod_ptr,
+                       expanded_col0,
+                       expanded_val0,
+                       descr_A->base,
+                       descr_B->base);
+
+    // Sort the intermediate products of each row by column index
+    rocprim::double_buffer<rocsparse_int> keys(expanded_col0, expanded_col1);
+    rocprim::double_buffer<T>             vals(expanded_val0, expanded_val1);
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
+        sort_temp, sort_size, keys, vals, total, m, prod_ptr, prod_ptr + 1, 0, 32, stream));
+
+    // Compress the sorted products into C
+    dim3 csrgemm_compress_blocks((m - 1) / CSRGEMM_DIM + 1);
+    dim3 csrgemm_compress_threads(CSRGEMM_DIM);
+
+    hipLaunchKernelGGL((csrgemm_compress_kernel<T, CSRGEMM_DIM>),
+                       csrgemm_compress_blocks,
+                       csrgemm_compress_threads,
+                       0,
+                       stream,
+                       m,
+                       prod_ptr,
+                       keys.current(),
+                       vals.current(),
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       descr_C->base);
+#undef CSRGEMM_SUB_WF_SIZE
+#undef CSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRGEMM_HPP
@@ -104,3 +104,409 @@ extern "C" rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
                                             C,
                                             ldc);
 }
+
+extern "C" rocsparse_status rocsparse_scsrmm_epilogue(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_B,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             k,
+                                                      rocsparse_int             nnz,
+                                                      const float*              alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const float*              csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      const float*              B,
+                                                      rocsparse_int             ldb,
+                                                      const float*              beta,
+                                                      float*                    C,
+                                                      rocsparse_int             ldc,
+                                                      rocsparse_epilogue        epilogue,
+                                                      const float*              diag,
+                                                      const float*              vec,
+                                                      const float*              clamp_lo,
+                                                      const float*              clamp_hi)
+{
+    return rocsparse_csrmm_epilogue_template<float>(handle,
+                                                    trans_A,
+                                                    trans_B,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    B,
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    ldc,
+                                                    epilogue,
+                                                    diag,
+                                                    vec,
+                                                    clamp_lo,
+                                                    clamp_hi);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmm_epilogue(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_B,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             k,
+                                                      rocsparse_int             nnz,
+                                                      const double*             alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double*             csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      const double*             B,
+                                                      rocsparse_int             ldb,
+                                                      const double*             beta,
+                                                      double*                   C,
+                                                      rocsparse_int             ldc,
+                                                      rocsparse_epilogue        epilogue,
+                                                      const double*             diag,
+                                                      const double*             vec,
+                                                      const double*             clamp_lo,
+                                                      const double*             clamp_hi)
+{
+    return rocsparse_csrmm_epilogue_template<double>(handle,
+                                                     trans_A,
+                                                     trans_B,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     nnz,
+                                                     alpha,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     B,
+                                                     ldb,
+                                                     beta,
+                                                     C,
+                                                     ldc,
+                                                     epilogue,
+                                                     diag,
+                                                     vec,
+                                                     clamp_lo,
+                                                     clamp_hi);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmm_batched(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             k,
+                                                     rocsparse_int             nnz,
+                                                     const float*              alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const float*              csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const float*              B,
+                                                     rocsparse_int             ldb,
+                                                     rocsparse_int             batch_stride_B,
+                                                     const float*              beta,
+                                                     float*                    C,
+                                                     rocsparse_int             ldc,
+                                                     rocsparse_int             batch_stride_C,
+                                                     rocsparse_int             batch_count)
+{
+    return rocsparse_csrmm_batched_template<float>(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   nnz,
+                                                   alpha,
+                                                   descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   B,
+                                                   ldb,
+                                                   batch_stride_B,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   batch_stride_C,
+                                                   batch_count);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmm_batched(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             n,
+                                                     rocsparse_int             k,
+                                                     rocsparse_int             nnz,
+                                                     const double*             alpha,
+                                                     const rocsparse_mat_descr descr,
+                                                     const double*             csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const double*             B,
+                                                     rocsparse_int             ldb,
+                                                     rocsparse_int             batch_stride_B,
+                                                     const double*             beta,
+                                                     double*                   C,
+                                                     rocsparse_int             ldc,
+                                                     rocsparse_int             batch_stride_C,
+                                                     rocsparse_int             batch_count)
+{
+    return rocsparse_csrmm_batched_template<double>(handle,
+                                                    trans_A,
+                                                    trans_B,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    B,
+                                                    ldb,
+                                                    batch_stride_B,
+                                                    beta,
+                                                    C,
+                                                    ldc,
+                                                    batch_stride_C,
+                                                    batch_count);
+}
+
+extern "C" rocsparse_status rocsparse_hscsrmm(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_half*     csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const float*              B,
+                                              rocsparse_int             ldb,
+                                              const float*              beta,
+                                              float*                    C,
+                                              rocsparse_int             ldc)
+{
+    return rocsparse_csrmm_mixed_template<__half, float>(handle,
+                                                         trans_A,
+                                                         trans_B,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         nnz,
+                                                         alpha,
+                                                         descr,
+                                                         reinterpret_cast<const __half*>(csr_val),
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         B,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         ldc);
+}
+
+extern "C" rocsparse_status rocsparse_sdcsrmm(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              rocsparse_int             nnz,
+                                              const double*             alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const double*             B,
+                                              rocsparse_int             ldb,
+                                              const double*             beta,
+                                              double*                   C,
+                                              rocsparse_int             ldc)
+{
+    return rocsparse_csrmm_mixed_template<float, double>(handle,
+                                                         trans_A,
+                                                         trans_B,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         nnz,
+                                                         alpha,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         B,
+                                                         ldb,
+                                                         beta,
+                                                         C,
+                                                         ldc);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmm2(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_order           order,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const float*              B,
+                                              rocsparse_int             ldb,
+                                              const float*              beta,
+                                              float*                    C,
+                                              rocsparse_int             ldc)
+{
+    return rocsparse_csrmm2_template<float>(handle,
+                                            trans_A,
+                                            trans_B,
+                                            order,
+                                            m,
+                                            n,
+                                            k,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            B,
+                                            ldb,
+                                            beta,
+                                            C,
+                                            ldc);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmm2(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_order           order,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              rocsparse_int             nnz,
+                                              const double*             alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const double*             B,
+                                              rocsparse_int             ldb,
+                                              const double*             beta,
+                                              double*                   C,
+                                              rocsparse_int             ldc)
+{
+    return rocsparse_csrmm2_template<double>(handle,
+                                             trans_A,
+                                             trans_B,
+                                             order,
+                                             m,
+                                             n,
+                                             k,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             B,
+                                             ldb,
+                                             beta,
+                                             C,
+                                             ldc);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmm(rocsparse_handle               handle,
+                                             rocsparse_operation            trans_A,
+                                             rocsparse_operation            trans_B,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  n,
+                                             rocsparse_int                  k,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_float_complex* alpha,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             const rocsparse_float_complex* B,
+                                             rocsparse_int                  ldb,
+                                             const rocsparse_float_complex* beta,
+                                             rocsparse_float_complex*       C,
+                                             rocsparse_int                  ldc)
+{
+    return rocsparse_csrmm_template<rocsparse_float_complex>(handle,
+                                                             trans_A,
+                                                             trans_B,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             nnz,
+                                                             alpha,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             B,
+                                                             ldb,
+                                                             beta,
+                                                             C,
+                                                             ldc);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmm(rocsparse_handle                handle,
+                                             rocsparse_operation             trans_A,
+                                             rocsparse_operation             trans_B,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   n,
+                                             rocsparse_int                   k,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             const rocsparse_double_complex* B,
+                                             rocsparse_int                   ldb,
+                                             const rocsparse_double_complex* beta,
+                                             rocsparse_double_complex*       C,
+                                             rocsparse_int                   ldc)
+{
+    return rocsparse_csrmm_template<rocsparse_double_complex>(handle,
+                                                              trans_A,
+                                                              trans_B,
+                                                              m,
+                                                              n,
+                                                              k,
+                                                              nnz,
+                                                              alpha,
+                                                              descr,
+                                                              csr_val,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              B,
+                                                              ldb,
+                                                              beta,
+                                                              C,
+                                                              ldc);
+}
@@ -30,9 +30,15 @@
 #include "rocsparse.h"
 #include "utility.h"
 
+#include <hip/hip_fp16.h>
 #include <hip/hip_runtime.h>
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+template <typename A,
+          typename T,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int WF_SIZE,
+          bool          ALPHA_ONE = false,
+          bool          BETA_ZERO = false>
 __launch_bounds__(256) __global__
     void csrmmnn_kernel_host_pointer(rocsparse_int m,
                                      rocsparse_int n,
@@ -41,7 +47,7 @@ __launch_bounds__(256) __global__
                                      T             alpha,
                                      const rocsparse_int* __restrict__ csr_row_ptr,
                                      const rocsparse_int* __restrict__ csr_col_ind,
-                                     const T* __restrict__ csr_val,
+                                     const A* __restrict__ csr_val,
                                      const T* __restrict__ B,
                                      rocsparse_int ldb,
                                      T             beta,
@@ -49,11 +55,11 @@ __launch_bounds__(256) __global__
                                      rocsparse_int        ldc,
                                      rocsparse_index_base idx_base)
 {
-    csrmmnn_general_device<T, BLOCKSIZE, WF_SIZE>(
+    csrmmnn_general_device<A, T, BLOCKSIZE, WF_SIZE, ALPHA_ONE, BETA_ZERO>(
         m, n, k, nnz, alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, beta, C, ldc, idx_base);
 }
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+template <typename A, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __launch_bounds__(256) __global__
     void csrmmnn_kernel_device_pointer(rocsparse_int m,
                                        rocsparse_int n,
@@ -62,7 +68,7 @@ __launch_bounds__(256) __global__
                                        const T*      alpha,
                                        const rocsparse_int* __restrict__ csr_row_ptr,
                                        const rocsparse_int* __restrict__ csr_col_ind,
-                                       const T* __restrict__ csr_val,
+                                       const A* __restrict__ csr_val,
                                        const T* __restrict__ B,
                                        rocsparse_int ldb,
                                        const T*      beta,
@@ -75,7 +81,101 @@ __launch_bounds__(256) __global__
         return;
     }
 
-    csrmmnn_general_device<T, BLOCKSIZE, WF_SIZE>(
+    csrmmnn_general_device<A, T, BLOCKSIZE, WF_SIZE>(
+        m, n, k, nnz, *alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, *beta, C, ldc, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(256) __global__
+    void csrmmnn_row_major_kernel_host_pointer(rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int k,
+                                               rocsparse_int nnz,
+                                               T             alpha,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               const T* __restrict__ csr_val,
+                                               const T* __restrict__ B,
+                                               rocsparse_int ldb,
+                                               T             beta,
+                                               T* __restrict__ C,
+                                               rocsparse_int        ldc,
+                                               rocsparse_index_base idx_base)
+{
+    csrmmnn_row_major_device<T, BLOCKSIZE, WF_SIZE>(
+        m, n, k, nnz, alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, beta, C, ldc, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(256) __global__
+    void csrmmnn_row_major_kernel_device_pointer(rocsparse_int m,
+                                                 rocsparse_int n,
+                                                 rocsparse_int k,
+                                                 rocsparse_int nnz,
+                                                 const T*      alpha,
+                                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                                 const T* __restrict__ csr_val,
+                                                 const T* __restrict__ B,
+                                                 rocsparse_int ldb,
+                                                 const T*      beta,
+                                                 T* __restrict__ C,
+                                                 rocsparse_int        ldc,
+                                                 rocsparse_index_base idx_base)
+{
+    if(*alpha == 0.0 && *beta == 1.0)
+    {
+        return;
+    }
+
+    csrmmnn_row_major_device<T, BLOCKSIZE, WF_SIZE>(
+        m, n, k, nnz, *alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, *beta, C, ldc, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE>
+__launch_bounds__(256) __global__
+    void csrmmnn_tile_kernel_host_pointer(rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int k,
+                                          rocsparse_int nnz,
+                                          T             alpha,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const T* __restrict__ csr_val,
+                                          const T* __restrict__ B,
+                                          rocsparse_int ldb,
+                                          T             beta,
+                                          T* __restrict__ C,
+                                          rocsparse_int        ldc,
+                                          rocsparse_index_base idx_base)
+{
+    csrmmnn_tile_device<T, BLOCKSIZE, WF_SIZE, TILE>(
+        m, n, k, nnz, alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, beta, C, ldc, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE>
+__launch_bounds__(256) __global__
+    void csrmmnn_tile_kernel_device_pointer(rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int k,
+                                            rocsparse_int nnz,
+                                            const T*      alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            const T* __restrict__ B,
+                                            rocsparse_int ldb,
+                                            const T*      beta,
+                                            T* __restrict__ C,
+                                            rocsparse_int        ldc,
+                                            rocsparse_index_base idx_base)
+{
+    if(*alpha == 0.0 && *beta == 1.0)
+    {
+        return;
+    }
+
+    csrmmnn_tile_device<T, BLOCKSIZE, WF_SIZE, TILE>(
         m, n, k, nnz, *alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, *beta, C, ldc, idx_base);
 }
 
@@ -158,6 +258,268 @@ __launch_bounds__(256) __global__
                                                   idx_base);
 }
 
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE>
+__launch_bounds__(256) __global__
+    void csrmmnt_tile_kernel_host_pointer(rocsparse_int offset,
+                                          rocsparse_int ncol,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int k,
+                                          rocsparse_int nnz,
+                                          T             alpha,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const T* __restrict__ csr_val,
+                                          const T* __restrict__ B,
+                                          rocsparse_int ldb,
+                                          T             beta,
+                                          T* __restrict__ C,
+                                          rocsparse_int        ldc,
+                                          rocsparse_index_base idx_base)
+{
+    csrmmnt_tile_device<T, BLOCKSIZE, WF_SIZE, TILE>(offset,
+                                                     ncol,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     nnz,
+                                                     alpha,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csr_val,
+                                                     B,
+                                                     ldb,
+                                                     beta,
+                                                     C,
+                                                     ldc,
+                                                     idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE>
+__launch_bounds__(256) __global__
+    void csrmmnt_tile_kernel_device_pointer(rocsparse_int offset,
+                                            rocsparse_int ncol,
+                                            rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int k,
+                                            rocsparse_int nnz,
+                                            const T*      alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            const T* __restrict__ B,
+                                            rocsparse_int ldb,
+                                            const T*      beta,
+                                            T* __restrict__ C,
+                                            rocsparse_int        ldc,
+                                            rocsparse_index_base idx_base)
+{
+    if(*alpha == 0.0 && *beta == 1.0)
+    {
+        return;
+    }
+
+    csrmmnt_tile_device<T, BLOCKSIZE, WF_SIZE, TILE>(offset,
+                                                     ncol,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     nnz,
+                                                     *alpha,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csr_val,
+                                                     B,
+                                                     ldb,
+                                                     *beta,
+                                                     C,
+                                                     ldc,
+                                                     idx_base);
+}
+
+template <typename T>
+__global__ void csrmm_scale_kernel_host_pointer(
+    rocsparse_int m, rocsparse_int n, T beta, T* __restrict__ data, rocsparse_int ld)
+{
+    csrmm_scale_device<T>(m, n, beta, data, ld);
+}
+
+template <typename T>
+__global__ void csrmm_scale_kernel_device_pointer(
+    rocsparse_int m, rocsparse_int n, const T* __restrict__ beta, T* __restrict__ data, rocsparse_int ld)
+{
+    if(*beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    csrmm_scale_device<T>(m, n, *beta, data, ld);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, bool CONJ>
+__launch_bounds__(256) __global__
+    void csrmmtn_kernel_host_pointer(rocsparse_int m,
+                                     rocsparse_int n,
+                                     rocsparse_int k,
+                                     rocsparse_int nnz,
+                                     T             alpha,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     const T* __restrict__ B,
+                                     rocsparse_int ldb,
+                                     T* __restrict__ C,
+                                     rocsparse_int        ldc,
+                                     rocsparse_index_base idx_base)
+{
+    csrmmtn_general_device<T, BLOCKSIZE, WF_SIZE, CONJ>(
+        m, n, k, nnz, alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, C, ldc, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, bool CONJ>
+__launch_bounds__(256) __global__
+    void csrmmtn_kernel_device_pointer(rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int k,
+                                       rocsparse_int nnz,
+                                       const T*      alpha,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const T* __restrict__ B,
+                                       rocsparse_int ldb,
+                                       T* __restrict__ C,
+                                       rocsparse_int        ldc,
+                                       rocsparse_index_base idx_base)
+{
+    if(*alpha == 0.0)
+    {
+        return;
+    }
+
+    csrmmtn_general_device<T, BLOCKSIZE, WF_SIZE, CONJ>(
+        m, n, k, nnz, *alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, C, ldc, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(256) __global__
+    void csrmmnn_batched_kernel_host_pointer(rocsparse_int m,
+                                             rocsparse_int n,
+                                             rocsparse_int k,
+                                             rocsparse_int nnz,
+                                             T             alpha,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const T* __restrict__ csr_val,
+                                             const T* __restrict__ B,
+                                             rocsparse_int ldb,
+                                             rocsparse_int batch_stride_B,
+                                             T             beta,
+                                             T* __restrict__ C,
+                                             rocsparse_int        ldc,
+                                             rocsparse_int        batch_stride_C,
+                                             rocsparse_index_base idx_base)
+{
+    // Each z block dimension processes one batch. The CSR structure is
+    // shared by all batches and only staged once per workgroup.
+    csrmmnn_general_device<T, T, BLOCKSIZE, WF_SIZE>(m,
+                                                  n,
+                                                  k,
+                                                  nnz,
+                                                  alpha,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  B + hipBlockIdx_z * batch_stride_B,
+                                                  ldb,
+                                                  beta,
+                                                  C + hipBlockIdx_z * batch_stride_C,
+                                                  ldc,
+                                                  idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(256) __global__
+    void csrmmnn_batched_kernel_device_pointer(rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int k,
+                                               rocsparse_int nnz,
+                                               const T*      alpha,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               const T* __restrict__ csr_val,
+                                               const T* __restrict__ B,
+                                               rocsparse_int ldb,
+                                               rocsparse_int batch_stride_B,
+                                               const T*      beta,
+                                               T* __restrict__ C,
+                                               rocsparse_int        ldc,
+                                               rocsparse_int        batch_stride_C,
+                                               rocsparse_index_base idx_base)
+{
+    if(*alpha == 0.0 && *beta == 1.0)
+    {
+        return;
+    }
+
+    csrmmnn_general_device<T, T, BLOCKSIZE, WF_SIZE>(m,
+                                                  n,
+                                                  k,
+                                                  nnz,
+                                                  *alpha,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  B + hipBlockIdx_z * batch_stride_B,
+                                                  ldb,
+                                                  *beta,
+                                                  C + hipBlockIdx_z * batch_stride_C,
+                                                  ldc,
+                                                  idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, bool DIAG, bool SUB, bool CLAMP>
+__launch_bounds__(256) __global__
+    void csrmmnn_epilogue_kernel(rocsparse_int m,
+                                 rocsparse_int n,
+                                 rocsparse_int k,
+                                 rocsparse_int nnz,
+                                 const T*      alpha,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 const T* __restrict__ csr_val,
+                                 const T* __restrict__ B,
+                                 rocsparse_int ldb,
+                                 const T*      beta,
+                                 T* __restrict__ C,
+                                 rocsparse_int ldc,
+                                 const T* __restrict__ diag,
+                                 const T* __restrict__ vec,
+                                 const T*             clamp_lo,
+                                 const T*             clamp_hi,
+                                 rocsparse_index_base idx_base)
+{
+    csrmmnn_epilogue_device<T, BLOCKSIZE, WF_SIZE, DIAG, SUB, CLAMP>(
+        m,
+        n,
+        k,
+        nnz,
+        *alpha,
+        csr_row_ptr,
+        csr_col_ind,
+        csr_val,
+        B,
+        ldb,
+        *beta,
+        C,
+        ldc,
+        diag,
+        vec,
+        CLAMP ? *clamp_lo : static_cast<T>(0),
+        CLAMP ? *clamp_hi : static_cast<T>(0),
+        idx_base);
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans_A,
@@ -339,6 +701,43 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         }
     }
 
+    // Apply the row range view, if set. The row pointers of the range keep
+    // their absolute offsets into csr_val and csr_col_ind, such that
+    // restricting the operation to rows [begin, end) only shifts csr_row_ptr
+    // and C - no matrix data is moved
+    if(descr->row_range_end >= 0)
+    {
+        if(descr->row_range_end > m)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        if(trans_A != rocsparse_operation_none)
+        {
+            // TODO
+            return rocsparse_status_not_implemented;
+        }
+
+        m = descr->row_range_end - descr->row_range_begin;
+        csr_row_ptr += descr->row_range_begin;
+        C += descr->row_range_begin;
+
+        // Quick return on an empty view
+        if(m == 0)
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Profile the operation ; the matrix data and B are each moved once per
+    // row of A they contribute to, C is read and written once
+    rocsparse_profile_scope<T> profile(
+        handle,
+        "rocsparse_Xcsrmm",
+        static_cast<double>(sizeof(T)) * (static_cast<double>(nnz) * n + 2.0 * m * n + nnz)
+            + static_cast<double>(sizeof(rocsparse_int)) * (nnz + m + 1.0));
+
+    rocsparse_roctx_scope<T> roctx(handle, "rocsparse_Xcsrmm");
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -349,12 +748,78 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         {
 #define CSRMMNN_DIM 256
 #define SUB_WF_SIZE 8
+#define CSRMMNN_TILE 4
+            // For wide dense B, use the tiled kernel that re-uses the LDS
+            // staged entries of A across a column tile of
+            // SUB_WF_SIZE * CSRMMNN_TILE columns, instead of re-staging them
+            // for every SUB_WF_SIZE columns
+            if(n >= SUB_WF_SIZE * CSRMMNN_TILE)
+            {
+                dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1,
+                                    (n - 1) / (SUB_WF_SIZE * CSRMMNN_TILE) + 1);
+                dim3 csrmmnn_threads(CSRMMNN_DIM);
+
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    hipLaunchKernelGGL(
+                        (csrmmnn_tile_kernel_device_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE, CSRMMNN_TILE>),
+                        csrmmnn_blocks,
+                        csrmmnn_threads,
+                        0,
+                        stream,
+                        m,
+                        n,
+                        k,
+                        nnz,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        B,
+                        ldb,
+                        beta,
+                        C,
+                        ldc,
+                        descr->base);
+                }
+                else
+                {
+                    if(*alpha == 0.0 && *beta == 1.0)
+                    {
+                        return rocsparse_status_success;
+                    }
+
+                    hipLaunchKernelGGL(
+                        (csrmmnn_tile_kernel_host_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE, CSRMMNN_TILE>),
+                        csrmmnn_blocks,
+                        csrmmnn_threads,
+                        0,
+                        stream,
+                        m,
+                        n,
+                        k,
+                        nnz,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        B,
+                        ldb,
+                        *beta,
+                        C,
+                        ldc,
+                        descr->base);
+                }
+
+                return rocsparse_status_success;
+            }
+
             dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
             dim3 csrmmnn_threads(CSRMMNN_DIM);
 
             if(handle->pointer_mode == rocsparse_pointer_mode_device)
             {
-                hipLaunchKernelGGL((csrmmnn_kernel_device_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
+                hipLaunchKernelGGL((csrmmnn_kernel_device_pointer<T, T, CSRMMNN_DIM, SUB_WF_SIZE>),
                                    csrmmnn_blocks,
                                    csrmmnn_threads,
                                    0,
@@ -381,26 +846,52 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                     return rocsparse_status_success;
                 }
 
-                hipLaunchKernelGGL((csrmmnn_kernel_host_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
-                                   csrmmnn_blocks,
-                                   csrmmnn_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   n,
-                                   k,
-                                   nnz,
-                                   *alpha,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   csr_val,
-                                   B,
-                                   ldb,
-                                   *beta,
-                                   C,
-                                   ldc,
-                                   descr->base);
+                // With host scalars, the common alpha == 1 and beta == 0 cases
+                // can be dispatched to compile-time specialized kernels
+#define LAUNCH_CSRMMNN(alpha_one, beta_zero)                        \
+    hipLaunchKernelGGL(                                             \
+        (csrmmnn_kernel_host_pointer<T, T, CSRMMNN_DIM, SUB_WF_SIZE, alpha_one, beta_zero>), \
+        csrmmnn_blocks,                                             \
+        csrmmnn_threads,                                            \
+        0,                                                          \
+        stream,                                                     \
+        m,                                                          \
+        n,                                                          \
+        k,                                                          \
+        nnz,                                                        \
+        *alpha,                                                     \
+        csr_row_ptr,                                                \
+        csr_col_ind,                                                \
+        csr_val,                                                    \
+        B,                                                          \
+        ldb,                                                        \
+        *beta,                                                      \
+        C,                                                          \
+        ldc,                                                        \
+        descr->base)
+
+                bool alpha_one = (*alpha == static_cast<T>(1));
+                bool beta_zero = (*beta == static_cast<T>(0));
+
+                if(alpha_one && beta_zero)
+                {
+                    LAUNCH_CSRMMNN(true, true);
+                }
+                else if(beta_zero)
+                {
+                    LAUNCH_CSRMMNN(false, true);
+                }
+                else if(alpha_one)
+                {
+                    LAUNCH_CSRMMNN(true, false);
+                }
+                else
+                {
+                    LAUNCH_CSRMMNN(false, false);
+                }
+#undef LAUNCH_CSRMMNN
             }
+#undef CSRMMNN_TILE
 #undef SUB_WF_SIZE
 #undef CSRMMNN_DIM
         }
@@ -410,6 +901,7 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
             rocsparse_int avg_row_nnz = (nnz - 1) / m + 1;
 
 #define CSRMMNT_DIM 256
+#define CSRMMNT_TILE 4
             if(handle->pointer_mode == rocsparse_pointer_mode_device)
             {
                 // Computation is split into two parts, main and remainder
@@ -429,14 +921,248 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
 
                     // Launch main kernel if enough columns of B
                     if(main > 0)
+                    {
+                        if(main >= 8 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_device_pointer<T, CSRMMNT_DIM, 8, CSRMMNT_TILE>),
+                                               dim3((8 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 8>),
+                                               dim3((8 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                    }
+                }
+                else if(avg_row_nnz < 32)
+                {
+                    remainder = n % 16;
+                    main      = n - remainder;
+
+                    // Launch main kernel if enough columns of B
+                    if(main > 0)
+                    {
+                        if(main >= 16 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_device_pointer<T, CSRMMNT_DIM, 16, CSRMMNT_TILE>),
+                                               dim3((16 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 16>),
+                                               dim3((16 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                    }
+                }
+                else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
+                {
+                    remainder = n % 32;
+                    main      = n - remainder;
+
+                    // Launch main kernel if enough columns of B
+                    if(main > 0)
+                    {
+                        if(main >= 32 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_device_pointer<T, CSRMMNT_DIM, 32, CSRMMNT_TILE>),
+                                               dim3((32 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 32>),
+                                               dim3((32 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                    }
+                }
+                else if(handle->wavefront_size == 64)
+                {
+                    remainder = n % 64;
+                    main      = n - remainder;
+
+                    // Launch main kernel if enough columns of B
+                    if(main > 0)
+                    {
+                        if(main >= 64 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_device_pointer<T, CSRMMNT_DIM, 64, CSRMMNT_TILE>),
+                                               dim3((64 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 64>),
+                                               dim3((64 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                    }
+                }
+                else
+                {
+                    return rocsparse_status_arch_mismatch;
+                }
+
+                // Process remainder
+                if(remainder > 0)
+                {
+                    if(remainder <= 8)
                     {
                         hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 8>),
                                            dim3((8 * m - 1) / CSRMMNT_DIM + 1),
                                            dim3(CSRMMNT_DIM),
                                            0,
                                            stream,
-                                           0,
                                            main,
+                                           n,
                                            m,
                                            n,
                                            k,
@@ -452,141 +1178,15 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                            ldc,
                                            descr->base);
                     }
-                }
-                else if(avg_row_nnz < 32)
-                {
-                    remainder = n % 16;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
+                    else if(remainder <= 16)
                     {
                         hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 16>),
                                            dim3((16 * m - 1) / CSRMMNT_DIM + 1),
                                            dim3(CSRMMNT_DIM),
                                            0,
                                            stream,
-                                           0,
                                            main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
-                {
-                    remainder = n % 32;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 32>),
-                                           dim3((32 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(handle->wavefront_size == 64)
-                {
-                    remainder = n % 64;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 64>),
-                                           dim3((64 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else
-                {
-                    return rocsparse_status_arch_mismatch;
-                }
-
-                // Process remainder
-                if(remainder > 0)
-                {
-                    if(remainder <= 8)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 8>),
-                                           dim3((8 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else if(remainder <= 16)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 16>),
-                                           dim3((16 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
+                                           n,
                                            m,
                                            n,
                                            k,
@@ -676,27 +1276,54 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                     // Launch main kernel if enough columns of B
                     if(main > 0)
                     {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 8>),
-                                           dim3((8 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
+                        if(main >= 8 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_host_pointer<T, CSRMMNT_DIM, 8, CSRMMNT_TILE>),
+                                               dim3((8 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 8>),
+                                               dim3((8 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
                     }
                 }
                 else if(avg_row_nnz < 32)
@@ -707,27 +1334,54 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                     // Launch main kernel if enough columns of B
                     if(main > 0)
                     {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 16>),
-                                           dim3((16 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
+                        if(main >= 16 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_host_pointer<T, CSRMMNT_DIM, 16, CSRMMNT_TILE>),
+                                               dim3((16 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 16>),
+                                               dim3((16 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
                     }
                 }
                 else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
@@ -738,27 +1392,54 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                     // Launch main kernel if enough columns of B
                     if(main > 0)
                     {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 32>),
-                                           dim3((32 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
+                        if(main >= 32 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_host_pointer<T, CSRMMNT_DIM, 32, CSRMMNT_TILE>),
+                                               dim3((32 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 32>),
+                                               dim3((32 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
                     }
                 }
                 else if(handle->wavefront_size == 64)
@@ -769,27 +1450,54 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                     // Launch main kernel if enough columns of B
                     if(main > 0)
                     {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 64>),
-                                           dim3((64 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
+                        if(main >= 64 * CSRMMNT_TILE)
+                        {
+                            hipLaunchKernelGGL((csrmmnt_tile_kernel_host_pointer<T, CSRMMNT_DIM, 64, CSRMMNT_TILE>),
+                                               dim3((64 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
+                        else
+                        {
+                            hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 64>),
+                                               dim3((64 * m - 1) / CSRMMNT_DIM + 1),
+                                               dim3(CSRMMNT_DIM),
+                                               0,
+                                               stream,
+                                               0,
+                                               main,
+                                               m,
+                                               n,
+                                               k,
+                                               nnz,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               B,
+                                               ldb,
+                                               *beta,
+                                               C,
+                                               ldc,
+                                               descr->base);
+                        }
                     }
                 }
                 else
@@ -902,6 +1610,7 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                     }
                 }
             }
+#undef CSRMMNT_TILE
 #undef CSRMMNT_DIM
         }
         else
@@ -909,6 +1618,129 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
             return rocsparse_status_not_implemented;
         }
     }
+    else if(trans_A == rocsparse_operation_transpose
+            || trans_A == rocsparse_operation_conjugate_transpose)
+    {
+        if(trans_B != rocsparse_operation_none)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        // Transposed SpMM scatters into C, thus C has to be scaled by beta
+        // in advance. The conjugate transposed kernels conjugate each
+        // stored entry on the fly.
+#define CSRMMTN_DIM 256
+#define SUB_WF_SIZE 8
+        dim3 csrmmtn_blocks((SUB_WF_SIZE * m - 1) / CSRMMTN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
+        dim3 csrmmtn_threads(CSRMMTN_DIM);
+
+#define LAUNCH_CSRMMTN(ptr_mode, alpha, conj)                                           \
+    hipLaunchKernelGGL((csrmmtn_kernel_##ptr_mode<T, CSRMMTN_DIM, SUB_WF_SIZE, conj>),  \
+                       csrmmtn_blocks,                                                  \
+                       csrmmtn_threads,                                                 \
+                       0,                                                               \
+                       stream,                                                          \
+                       m,                                                               \
+                       n,                                                               \
+                       k,                                                               \
+                       nnz,                                                             \
+                       alpha,                                                           \
+                       csr_row_ptr,                                                     \
+                       csr_col_ind,                                                     \
+                       csr_val,                                                         \
+                       B,                                                               \
+                       ldb,                                                             \
+                       C,                                                               \
+                       ldc,                                                             \
+                       descr->base)
+
+        bool conj = (trans_A == rocsparse_operation_conjugate_transpose);
+
+        dim3 scale_blocks((k - 1) / 16 + 1, (n - 1) / 16 + 1);
+        dim3 scale_threads(16, 16);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            // Scale C with beta
+            hipLaunchKernelGGL((csrmm_scale_kernel_device_pointer<T>),
+                               scale_blocks,
+                               scale_threads,
+                               0,
+                               stream,
+                               k,
+                               n,
+                               beta,
+                               C,
+                               ldc);
+
+            if(conj)
+            {
+                LAUNCH_CSRMMTN(device_pointer, alpha, true);
+            }
+            else
+            {
+                LAUNCH_CSRMMTN(device_pointer, alpha, false);
+            }
+        }
+        else
+        {
+            // Quick return
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            // If beta == 0.0 we need to set C to 0
+            if(*beta == static_cast<T>(0))
+            {
+                if(ldc == k)
+                {
+                    RETURN_IF_HIP_ERROR(hipMemsetAsync(C, 0, sizeof(T) * k * n, stream));
+                }
+                else
+                {
+                    hipLaunchKernelGGL((csrmm_scale_kernel_host_pointer<T>),
+                                       scale_blocks,
+                                       scale_threads,
+                                       0,
+                                       stream,
+                                       k,
+                                       n,
+                                       static_cast<T>(0),
+                                       C,
+                                       ldc);
+                }
+            }
+            else if(*beta != static_cast<T>(1))
+            {
+                hipLaunchKernelGGL((csrmm_scale_kernel_host_pointer<T>),
+                                   scale_blocks,
+                                   scale_threads,
+                                   0,
+                                   stream,
+                                   k,
+                                   n,
+                                   *beta,
+                                   C,
+                                   ldc);
+            }
+
+            if(*alpha != static_cast<T>(0))
+            {
+                if(conj)
+                {
+                    LAUNCH_CSRMMTN(host_pointer, *alpha, true);
+                }
+                else
+                {
+                    LAUNCH_CSRMMTN(host_pointer, *alpha, false);
+                }
+            }
+        }
+#undef LAUNCH_CSRMMTN
+#undef SUB_WF_SIZE
+#undef CSRMMTN_DIM
+    }
     else
     {
         return rocsparse_status_not_implemented;
@@ -916,4 +1748,1045 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+// SpMM with a fused elementwise epilogue on C, replacing the follow-up
+// elementwise kernel and its extra read and write of C. The epilogue
+// operands are indexed per row of C and broadcast across its columns,
+// composed epilogues are applied in the order diagonal scale, vector
+// subtract, clamp
+template <typename T>
+rocsparse_status rocsparse_csrmm_epilogue_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             k,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const T*                  B,
+                                                   rocsparse_int             ldb,
+                                                   const T*                  beta,
+                                                   T*                        C,
+                                                   rocsparse_int             ldc,
+                                                   rocsparse_epilogue        epilogue,
+                                                   const T*                  diag,
+                                                   const T*                  vec,
+                                                   const T*                  clamp_lo,
+                                                   const T*                  clamp_hi)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmm_epilogue"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc,
+                  epilogue,
+                  (const void*&)diag,
+                  (const void*&)vec,
+                  (const void*&)clamp_lo,
+                  (const void*&)clamp_hi);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmm_epilogue"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc,
+                  epilogue,
+                  (const void*&)diag,
+                  (const void*&)vec,
+                  (const void*&)clamp_lo,
+                  (const void*&)clamp_hi);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check the epilogue selection
+    if(epilogue
+       & ~(rocsparse_epilogue_diag_scale | rocsparse_epilogue_vector_sub
+           | rocsparse_epilogue_clamp))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    bool diag_on  = (epilogue & rocsparse_epilogue_diag_scale) != 0;
+    bool sub_on   = (epilogue & rocsparse_epilogue_vector_sub) != 0;
+    bool clamp_on = (epilogue & rocsparse_epilogue_clamp) != 0;
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(diag_on && diag == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sub_on && vec == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(clamp_on && (clamp_lo == nullptr || clamp_hi == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions
+    rocsparse_int one = 1;
+    if(ldb < std::max(one, k))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    if(ldc < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Stage the scalars, such that a single kernel instantiation covers
+    // both pointer modes. No early out for alpha == 0 and beta == 1, the
+    // epilogue has to be applied in any case
+    const T* d_alpha;
+    const T* d_beta;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    // The clamp bounds are staged through the same ring, such that the
+    // kernel reads all scalars from device memory in both pointer modes
+    const T* d_clamp_lo = d_alpha;
+    const T* d_clamp_hi = d_alpha;
+
+    if(clamp_on)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            handle->stage_scalars(clamp_lo, clamp_hi, &d_clamp_lo, &d_clamp_hi));
+    }
+
+#define CSRMMNN_EPILOGUE_DIM 256
+#define SUB_WF_SIZE 8
+    dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_EPILOGUE_DIM + 1,
+                        (n - 1) / SUB_WF_SIZE + 1);
+    dim3 csrmmnn_threads(CSRMMNN_EPILOGUE_DIM);
+
+#define DISPATCH_CSRMMNN_EPILOGUE(D, S, C)                                                       \
+    hipLaunchKernelGGL((csrmmnn_epilogue_kernel<T, CSRMMNN_EPILOGUE_DIM, SUB_WF_SIZE, D, S, C>), \
+                       csrmmnn_blocks,                                                           \
+                       csrmmnn_threads,                                                          \
+                       0,                                                                        \
+                       stream,                                                                   \
+                       m,                                                                        \
+                       n,                                                                        \
+                       k,                                                                        \
+                       nnz,                                                                      \
+                       d_alpha,                                                                  \
+                       csr_row_ptr,                                                              \
+                       csr_col_ind,                                                              \
+                       csr_val,                                                                  \
+                       B,                                                                        \
+                       ldb,                                                                      \
+                       d_beta,                                                                   \
+                       C,                                                                        \
+                       ldc,                                                                      \
+                       diag,                                                                     \
+                       vec,                                                                      \
+                       d_clamp_lo,                                                               \
+                       d_clamp_hi,                                                               \
+                       descr->base)
+
+    if(diag_on)
+    {
+        if(sub_on)
+        {
+            if(clamp_on)
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(true, true, true);
+            }
+            else
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(true, true, false);
+            }
+        }
+        else
+        {
+            if(clamp_on)
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(true, false, true);
+            }
+            else
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(true, false, false);
+            }
+        }
+    }
+    else
+    {
+        if(sub_on)
+        {
+            if(clamp_on)
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(false, true, true);
+            }
+            else
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(false, true, false);
+            }
+        }
+        else
+        {
+            if(clamp_on)
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(false, false, true);
+            }
+            else
+            {
+                DISPATCH_CSRMMNN_EPILOGUE(false, false, false);
+            }
+        }
+    }
+#undef DISPATCH_CSRMMNN_EPILOGUE
+#undef SUB_WF_SIZE
+#undef CSRMMNN_EPILOGUE_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmm_batched_template(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans_A,
+                                                  rocsparse_operation       trans_B,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             k,
+                                                  rocsparse_int             nnz,
+                                                  const T*                  alpha,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  const T*                  B,
+                                                  rocsparse_int             ldb,
+                                                  rocsparse_int             batch_stride_B,
+                                                  const T*                  beta,
+                                                  T*                        C,
+                                                  rocsparse_int             ldc,
+                                                  rocsparse_int             batch_stride_C,
+                                                  rocsparse_int             batch_count)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmm_batched"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  batch_stride_B,
+                  *beta,
+                  (const void*&)C,
+                  ldc,
+                  batch_stride_C,
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmm_batched"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  batch_stride_B,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc,
+                  batch_stride_C,
+                  batch_count);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type, the batched routine only supports the
+    // non-transposed product
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions and batch strides
+    rocsparse_int one = 1;
+    if(ldb < std::max(one, k))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldc < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_stride_B < ldb * n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_stride_C < ldc * n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // A single launch processes all batches, mapping the batch to the third
+    // grid dimension, such that small dense matrices still fill the device
+#define CSRMMNN_DIM 256
+#define SUB_WF_SIZE 8
+    dim3 csrmmnn_blocks(
+        (SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1, batch_count);
+    dim3 csrmmnn_threads(CSRMMNN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmmnn_batched_kernel_device_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
+                           csrmmnn_blocks,
+                           csrmmnn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           batch_stride_B,
+                           beta,
+                           C,
+                           ldc,
+                           batch_stride_C,
+                           descr->base);
+    }
+    else
+    {
+        if(*alpha == 0.0 && *beta == 1.0)
+        {
+            return rocsparse_status_success;
+        }
+
+        hipLaunchKernelGGL((csrmmnn_batched_kernel_host_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
+                           csrmmnn_blocks,
+                           csrmmnn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           batch_stride_B,
+                           *beta,
+                           C,
+                           ldc,
+                           batch_stride_C,
+                           descr->base);
+    }
+#undef SUB_WF_SIZE
+#undef CSRMMNN_DIM
+
+    return rocsparse_status_success;
+}
+
+
+// Mixed precision csrmm. The matrix values are stored in type A and all
+// computations are carried out in type T. The sparsity structure is traversed
+// by the same kernel as the uniform precision path, only the LDS staged value
+// loads are widened.
+template <typename A, typename T>
+rocsparse_status rocsparse_csrmm_mixed_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  B,
+                                                rocsparse_int             ldb,
+                                                const T*                  beta,
+                                                T*                        C,
+                                                rocsparse_int             ldc)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Build routine name for logging, e.g. rocsparse_hscsrmm for half
+    // precision storage with single precision compute
+    std::string name = "rocsparse_";
+    name += std::is_same<A, __half>::value ? "h" : "s";
+    name += std::is_same<T, double>::value ? "d" : "s";
+    name += "csrmm";
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  name,
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  name,
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type, mixed precision kernels are only available for
+    // the non-transposed product
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions
+    rocsparse_int one = 1;
+    if(ldb < std::max(one, k))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldc < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMMNN_DIM 256
+#define SUB_WF_SIZE 8
+    dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
+    dim3 csrmmnn_threads(CSRMMNN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmmnn_kernel_device_pointer<A, T, CSRMMNN_DIM, SUB_WF_SIZE>),
+                           csrmmnn_blocks,
+                           csrmmnn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           beta,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+    else
+    {
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        hipLaunchKernelGGL((csrmmnn_kernel_host_pointer<A, T, CSRMMNN_DIM, SUB_WF_SIZE>),
+                           csrmmnn_blocks,
+                           csrmmnn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           *beta,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+#undef SUB_WF_SIZE
+#undef CSRMMNN_DIM
+
+    return rocsparse_status_success;
+}
+
+
+// csrmm with selectable dense matrix layout. For column-major B and C, this
+// is rocsparse_csrmm_template. For row-major B and C, a dedicated kernel
+// reads and writes the dense matrices directly, with consecutive lanes
+// owning consecutive columns such that the accesses remain coalesced and no
+// transposes of B and C are required.
+template <typename T>
+rocsparse_status rocsparse_csrmm2_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_order           order,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           rocsparse_int             nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const T*                  B,
+                                           rocsparse_int             ldb,
+                                           const T*                  beta,
+                                           T*                        C,
+                                           rocsparse_int             ldc)
+{
+    // Check layout argument
+    if(order != rocsparse_order_column && order != rocsparse_order_row)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Column-major B and C is the classic csrmm
+    if(order == rocsparse_order_column)
+    {
+        return rocsparse_csrmm_template(handle,
+                                        trans_A,
+                                        trans_B,
+                                        m,
+                                        n,
+                                        k,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        B,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        ldc);
+    }
+
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmm2"),
+                  trans_A,
+                  trans_B,
+                  order,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmm2"),
+                  trans_A,
+                  trans_B,
+                  order,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type, the row-major kernel only supports the
+    // non-transposed product. A row-major B with trans_B == transpose is a
+    // column-major B, which the classic csrmm handles.
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions, row-major B and C hold n columns per row
+    rocsparse_int one = 1;
+    if(ldb < std::max(one, n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldc < std::max(one, n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMMNN_DIM 256
+#define SUB_WF_SIZE 8
+    dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
+    dim3 csrmmnn_threads(CSRMMNN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmmnn_row_major_kernel_device_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
+                           csrmmnn_blocks,
+                           csrmmnn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           beta,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+    else
+    {
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        hipLaunchKernelGGL((csrmmnn_row_major_kernel_host_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
+                           csrmmnn_blocks,
+                           csrmmnn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           B,
+                           ldb,
+                           *beta,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+#undef SUB_WF_SIZE
+#undef CSRMMNN_DIM
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSRMM_HPP
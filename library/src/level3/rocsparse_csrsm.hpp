@@ -0,0 +1,509 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRSM_HPP
+#define ROCSPARSE_CSRSM_HPP
+
+#include "rocsparse.h"
+
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include "csrsm_device.h"
+
+#include <limits>
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, unsigned int NRHS>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsm_host_pointer(rocsparse_int m,
+                            T             alpha,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const rocsparse_int* __restrict__ csr_col_ind,
+                            const T* __restrict__ csr_val,
+                            const T* __restrict__ x,
+                            rocsparse_int ldx,
+                            T* __restrict__ y,
+                            rocsparse_int ldy,
+                            int* __restrict__ done_array,
+                            rocsparse_int* __restrict__ map,
+                            rocsparse_int* __restrict__ zero_pivot,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            rocsparse_diag_type  diag_type)
+{
+    csrsm_device<T, BLOCKSIZE, WF_SIZE, NRHS>(m,
+                                              alpha,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csr_val,
+                                              x,
+                                              ldx,
+                                              y,
+                                              ldy,
+                                              done_array,
+                                              map,
+                                              zero_pivot,
+                                              idx_base,
+                                              fill_mode,
+                                              diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, unsigned int NRHS>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsm_device_pointer(rocsparse_int m,
+                              const T*      alpha,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              const T* __restrict__ csr_val,
+                              const T* __restrict__ x,
+                              rocsparse_int ldx,
+                              T* __restrict__ y,
+                              rocsparse_int ldy,
+                              int* __restrict__ done_array,
+                              rocsparse_int* __restrict__ map,
+                              rocsparse_int* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode  fill_mode,
+                              rocsparse_diag_type  diag_type)
+{
+    csrsm_device<T, BLOCKSIZE, WF_SIZE, NRHS>(m,
+                                              *alpha,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csr_val,
+                                              x,
+                                              ldx,
+                                              y,
+                                              ldy,
+                                              done_array,
+                                              map,
+                                              zero_pivot,
+                                              idx_base,
+                                              fill_mode,
+                                              diag_type);
+}
+
+template <typename T, unsigned int NRHS>
+rocsparse_status rocsparse_csrsm_launch(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        const T*                  alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const T*                  csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_csrtr_info      csrsm,
+                                        const T*                  x,
+                                        rocsparse_int             ldx,
+                                        T*                        y,
+                                        rocsparse_int             ldy,
+                                        int*                      done_array)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Each batch of right-hand sides shares one traversal of the factor,
+    // hence the done array has to be reset for every batch
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m, stream));
+
+#define CSRSM_DIM 1024
+    dim3 csrsm_blocks((handle->wavefront_size * m - 1) / CSRSM_DIM + 1);
+    dim3 csrsm_threads(CSRSM_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsm_device_pointer<T, CSRSM_DIM, 32, NRHS>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               ldx,
+                               y,
+                               ldy,
+                               done_array,
+                               csrsm->row_map,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsm_device_pointer<T, CSRSM_DIM, 64, NRHS>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               ldx,
+                               y,
+                               ldy,
+                               done_array,
+                               csrsm->row_map,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrsm_host_pointer<T, CSRSM_DIM, 32, NRHS>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               ldx,
+                               y,
+                               ldy,
+                               done_array,
+                               csrsm->row_map,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrsm_host_pointer<T, CSRSM_DIM, 64, NRHS>),
+                               csrsm_blocks,
+                               csrsm_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               ldx,
+                               y,
+                               ldy,
+                               done_array,
+                               csrsm->row_map,
+                               csrsm->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRSM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nrhs,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const T*                  x,
+                                                rocsparse_int             ldx,
+                                                T*                        y,
+                                                rocsparse_int             ldy,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsm"),
+                  trans,
+                  m,
+                  nrhs,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  ldx,
+                  (const void*&)y,
+                  ldy,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsm"),
+                  trans,
+                  m,
+                  nrhs,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  ldx,
+                  (const void*&)y,
+                  ldy,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_level)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldx < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldy < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nrhs == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    // done array
+    int* done_array = reinterpret_cast<int*>(ptr);
+
+    // Re-use the meta data gathered by csrsv analysis
+    rocsparse_csrtr_info csrsm = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsv_upper_info
+                                     : info->csrsv_lower_info;
+
+    if(csrsm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
+    {
+        hipLaunchKernelGGL(
+            (csrsm_reset_zero_pivot_kernel), dim3(1), dim3(1), 0, stream, csrsm->zero_pivot);
+    }
+
+    // Process the right-hand sides in batches, such that the factor is
+    // traversed only once per batch
+    rocsparse_int batch = 0;
+    while(batch < nrhs)
+    {
+        rocsparse_int remaining = nrhs - batch;
+
+        const T* xb = x + batch * ldx;
+        T*       yb = y + batch * ldy;
+
+        if(remaining >= 8)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 8>(handle,
+                                                                    m,
+                                                                    alpha,
+                                                                    descr,
+                                                                    csr_val,
+                                                                    csr_row_ptr,
+                                                                    csr_col_ind,
+                                                                    csrsm,
+                                                                    xb,
+                                                                    ldx,
+                                                                    yb,
+                                                                    ldy,
+                                                                    done_array)));
+            batch += 8;
+        }
+        else if(remaining == 7)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 7>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, csrsm, xb, ldx, yb, ldy, done_array)));
+            batch += 7;
+        }
+        else if(remaining == 6)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 6>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, csrsm, xb, ldx, yb, ldy, done_array)));
+            batch += 6;
+        }
+        else if(remaining == 5)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 5>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, csrsm, xb, ldx, yb, ldy, done_array)));
+            batch += 5;
+        }
+        else if(remaining == 4)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 4>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, csrsm, xb, ldx, yb, ldy, done_array)));
+            batch += 4;
+        }
+        else if(remaining == 3)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 3>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, csrsm, xb, ldx, yb, ldy, done_array)));
+            batch += 3;
+        }
+        else if(remaining == 2)
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 2>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, csrsm, xb, ldx, yb, ldy, done_array)));
+            batch += 2;
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsm_launch<T, 1>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, csrsm, xb, ldx, yb, ldy, done_array)));
+            batch += 1;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRSM_HPP
@@ -0,0 +1,357 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_GEMMI_HPP
+#define ROCSPARSE_GEMMI_HPP
+
+#include "gemmi_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void gemmi_scale_kernel_host_pointer(
+    rocsparse_int m, rocsparse_int n, T beta, T* __restrict__ data, rocsparse_int ld)
+{
+    gemmi_scale_device<T>(m, n, beta, data, ld);
+}
+
+template <typename T>
+__global__ void gemmi_scale_kernel_device_pointer(
+    rocsparse_int m, rocsparse_int n, const T* __restrict__ beta, T* __restrict__ data, rocsparse_int ld)
+{
+    if(*beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    gemmi_scale_device<T>(m, n, *beta, data, ld);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE>
+__launch_bounds__(256) __global__
+    void gemmi_kernel_host_pointer(rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int k,
+                                   rocsparse_int nnz,
+                                   T             alpha,
+                                   const T* __restrict__ A,
+                                   rocsparse_int lda,
+                                   const T* __restrict__ csr_val,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   T beta,
+                                   T* __restrict__ C,
+                                   rocsparse_int        ldc,
+                                   rocsparse_index_base idx_base)
+{
+    gemmi_general_device<T, BLOCKSIZE>(
+        m, n, k, nnz, alpha, A, lda, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE>
+__launch_bounds__(256) __global__
+    void gemmi_kernel_device_pointer(rocsparse_int m,
+                                     rocsparse_int n,
+                                     rocsparse_int k,
+                                     rocsparse_int nnz,
+                                     const T*      alpha,
+                                     const T* __restrict__ A,
+                                     rocsparse_int lda,
+                                     const T* __restrict__ csr_val,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* beta,
+                                     T* __restrict__ C,
+                                     rocsparse_int        ldc,
+                                     rocsparse_index_base idx_base)
+{
+    if(*alpha == 0.0 && *beta == 1.0)
+    {
+        return;
+    }
+
+    gemmi_general_device<T, BLOCKSIZE>(
+        m, n, k, nnz, *alpha, A, lda, csr_val, csr_row_ptr, csr_col_ind, *beta, C, ldc, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_gemmi_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          rocsparse_int             nnz,
+                                          const T*                  alpha,
+                                          const T*                  A,
+                                          rocsparse_int             lda,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const T*                  beta,
+                                          T*                        C,
+                                          rocsparse_int             ldc)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xgemmi"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xgemmi"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    log_bench(handle, "./rocsparse-bench -f gemmi -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type. The sparse right-hand side is expected as the
+    // CSR matrix of its transpose, such that its rows can be traversed as
+    // the columns of the product
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions
+    rocsparse_int one = 1;
+    if(lda < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldc < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If the sparse matrix is empty, the product reduces to C := beta * C
+    if(k == 0 || nnz == 0)
+    {
+        dim3 scale_blocks((m - 1) / 16 + 1, (n - 1) / 16 + 1);
+        dim3 scale_threads(16, 16);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((gemmi_scale_kernel_device_pointer<T>),
+                               scale_blocks,
+                               scale_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               beta,
+                               C,
+                               ldc);
+        }
+        else if(*beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((gemmi_scale_kernel_host_pointer<T>),
+                               scale_blocks,
+                               scale_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               *beta,
+                               C,
+                               ldc);
+        }
+
+        return rocsparse_status_success;
+    }
+
+#define GEMMI_DIM 256
+    dim3 gemmi_blocks((m - 1) / GEMMI_DIM + 1, n);
+    dim3 gemmi_threads(GEMMI_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((gemmi_kernel_device_pointer<T, GEMMI_DIM>),
+                           gemmi_blocks,
+                           gemmi_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           alpha,
+                           A,
+                           lda,
+                           csr_val,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           beta,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+    else
+    {
+        // Quick return
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        hipLaunchKernelGGL((gemmi_kernel_host_pointer<T, GEMMI_DIM>),
+                           gemmi_blocks,
+                           gemmi_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           k,
+                           nnz,
+                           *alpha,
+                           A,
+                           lda,
+                           csr_val,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           *beta,
+                           C,
+                           ldc,
+                           descr->base);
+    }
+#undef GEMMI_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_GEMMI_HPP
@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_s24mm.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_ss24mm(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             k,
+                                             const float*              alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              s24_val,
+                                             const unsigned char*      s24_meta,
+                                             const float*              B,
+                                             rocsparse_int             ldb,
+                                             const float*              beta,
+                                             float*                    C,
+                                             rocsparse_int             ldc)
+{
+    return rocsparse_s24mm_template<float>(handle,
+                                           trans_A,
+                                           trans_B,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           descr,
+                                           s24_val,
+                                           s24_meta,
+                                           B,
+                                           ldb,
+                                           beta,
+                                           C,
+                                           ldc);
+}
+
+extern "C" rocsparse_status rocsparse_ds24mm(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             k,
+                                             const double*             alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             s24_val,
+                                             const unsigned char*      s24_meta,
+                                             const double*             B,
+                                             rocsparse_int             ldb,
+                                             const double*             beta,
+                                             double*                   C,
+                                             rocsparse_int             ldc)
+{
+    return rocsparse_s24mm_template<double>(handle,
+                                            trans_A,
+                                            trans_B,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            descr,
+                                            s24_val,
+                                            s24_meta,
+                                            B,
+                                            ldb,
+                                            beta,
+                                            C,
+                                            ldc);
+}
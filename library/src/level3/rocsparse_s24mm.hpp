@@ -0,0 +1,269 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_S24MM_HPP
+#define ROCSPARSE_S24MM_HPP
+
+#include "handle.h"
+#include "rocsparse.h"
+#include "s24mm_device.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void s24mm_scale_kernel(
+    rocsparse_int m, rocsparse_int n, const T* __restrict__ beta, T* __restrict__ data, rocsparse_int ld)
+{
+    if(*beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    s24mm_scale_device<T>(m, n, *beta, data, ld);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE>
+__launch_bounds__(256) __global__ void s24mm_kernel(rocsparse_int m,
+                                                    rocsparse_int n,
+                                                    rocsparse_int k,
+                                                    const T*      alpha,
+                                                    const T* __restrict__ s24_val,
+                                                    const unsigned char* __restrict__ s24_meta,
+                                                    const T* __restrict__ B,
+                                                    rocsparse_int ldb,
+                                                    const T*      beta,
+                                                    T* __restrict__ C,
+                                                    rocsparse_int ldc)
+{
+    if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    s24mm_general_device<T, BLOCKSIZE>(m, n, k, *alpha, s24_val, s24_meta, B, ldb, *beta, C, ldc);
+}
+
+template <typename T>
+rocsparse_status rocsparse_s24mm_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  s24_val,
+                                          const unsigned char*      s24_meta,
+                                          const T*                  B,
+                                          rocsparse_int             ldb,
+                                          const T*                  beta,
+                                          T*                        C,
+                                          rocsparse_int             ldc)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xs24mm"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)s24_val,
+                  (const void*&)s24_meta,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)C,
+                  ldc);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xs24mm"),
+                  trans_A,
+                  trans_B,
+                  m,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)s24_val,
+                  (const void*&)s24_meta,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)C,
+                  ldc);
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type. The structured storage fixes the traversal
+    // order of A, transposed products are not supported
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes. The column dimension must be a multiple of the group
+    // size of the 2:4 structure
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0 || (k & 3) != 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(s24_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(s24_meta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions
+    rocsparse_int one = 1;
+    if(ldb < std::max(one, k))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldc < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return before staging the scalars
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha == static_cast<T>(0)
+       && *beta == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Stage the scalars through the pinned ring, such that the kernels
+    // read them from device memory in either pointer mode
+    const T* d_alpha = nullptr;
+    const T* d_beta  = nullptr;
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->stage_scalars(alpha, beta, &d_alpha, &d_beta));
+
+    // If A has no columns, the product reduces to C := beta * C
+    if(k == 0)
+    {
+        dim3 scale_blocks((m - 1) / 16 + 1, (n - 1) / 16 + 1);
+        dim3 scale_threads(16, 16);
+
+        hipLaunchKernelGGL((s24mm_scale_kernel<T>),
+                           scale_blocks,
+                           scale_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           d_beta,
+                           C,
+                           ldc);
+
+        return rocsparse_status_success;
+    }
+
+#define S24MM_DIM 256
+    dim3 s24mm_blocks((m - 1) / S24MM_DIM + 1, n);
+    dim3 s24mm_threads(S24MM_DIM);
+
+    hipLaunchKernelGGL((s24mm_kernel<T, S24MM_DIM>),
+                       s24mm_blocks,
+                       s24mm_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       k,
+                       d_alpha,
+                       s24_val,
+                       s24_meta,
+                       B,
+                       ldb,
+                       d_beta,
+                       C,
+                       ldc);
+#undef S24MM_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_S24MM_HPP
@@ -0,0 +1,355 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SDDMM_HPP
+#define ROCSPARSE_SDDMM_HPP
+
+#include "handle.h"
+#include "rocsparse.h"
+#include "sddmm_device.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(256) __global__
+    void sddmm_kernel_host_pointer(rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int k,
+                                   rocsparse_int nnz,
+                                   T             alpha,
+                                   const T* __restrict__ A,
+                                   rocsparse_int lda,
+                                   const T* __restrict__ B,
+                                   rocsparse_int ldb,
+                                   T beta,
+                                   T* __restrict__ csr_val,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   rocsparse_index_base idx_base)
+{
+    sddmm_csr_device<T, BLOCKSIZE, WF_SIZE>(
+        m, n, k, nnz, alpha, A, lda, B, ldb, beta, csr_val, csr_row_ptr, csr_col_ind, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(256) __global__
+    void sddmm_kernel_device_pointer(rocsparse_int m,
+                                     rocsparse_int n,
+                                     rocsparse_int k,
+                                     rocsparse_int nnz,
+                                     const T*      alpha,
+                                     const T* __restrict__ A,
+                                     rocsparse_int lda,
+                                     const T* __restrict__ B,
+                                     rocsparse_int ldb,
+                                     const T* beta,
+                                     T* __restrict__ csr_val,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     rocsparse_index_base idx_base)
+{
+    if(*alpha == 0.0 && *beta == 1.0)
+    {
+        return;
+    }
+
+    sddmm_csr_device<T, BLOCKSIZE, WF_SIZE>(
+        m, n, k, nnz, *alpha, A, lda, B, ldb, *beta, csr_val, csr_row_ptr, csr_col_ind, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_sddmm_template(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          rocsparse_int             nnz,
+                                          const T*                  alpha,
+                                          const T*                  A,
+                                          rocsparse_int             lda,
+                                          const T*                  B,
+                                          rocsparse_int             ldb,
+                                          const T*                  beta,
+                                          const rocsparse_mat_descr descr,
+                                          T*                        csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsddmm"),
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xsddmm"),
+                  m,
+                  n,
+                  k,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind);
+    }
+
+    log_bench(handle, "./rocsparse-bench -f sddmm -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimensions
+    rocsparse_int one = 1;
+    if(lda < std::max(one, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ldb < std::max(one, n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define SDDMM_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(handle->wavefront_size == 32)
+        {
+            dim3 sddmm_blocks((m * 32 - 1) / SDDMM_DIM + 1);
+            dim3 sddmm_threads(SDDMM_DIM);
+
+            hipLaunchKernelGGL((sddmm_kernel_device_pointer<T, SDDMM_DIM, 32>),
+                               sddmm_blocks,
+                               sddmm_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            dim3 sddmm_blocks((m * 64 - 1) / SDDMM_DIM + 1);
+            dim3 sddmm_threads(SDDMM_DIM);
+
+            hipLaunchKernelGGL((sddmm_kernel_device_pointer<T, SDDMM_DIM, 64>),
+                               sddmm_blocks,
+                               sddmm_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+    else
+    {
+        // Quick return
+        if(*alpha == 0.0 && *beta == 1.0)
+        {
+            return rocsparse_status_success;
+        }
+
+        if(handle->wavefront_size == 32)
+        {
+            dim3 sddmm_blocks((m * 32 - 1) / SDDMM_DIM + 1);
+            dim3 sddmm_threads(SDDMM_DIM);
+
+            hipLaunchKernelGGL((sddmm_kernel_host_pointer<T, SDDMM_DIM, 32>),
+                               sddmm_blocks,
+                               sddmm_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               *alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               *beta,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            dim3 sddmm_blocks((m * 64 - 1) / SDDMM_DIM + 1);
+            dim3 sddmm_threads(SDDMM_DIM);
+
+            hipLaunchKernelGGL((sddmm_kernel_host_pointer<T, SDDMM_DIM, 64>),
+                               sddmm_blocks,
+                               sddmm_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               *alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               *beta,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef SDDMM_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_SDDMM_HPP
@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef S24MM_DEVICE_H
+#define S24MM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Scale the dense matrix C by beta
+template <typename T>
+static __device__ void s24mm_scale_device(
+    rocsparse_int m, rocsparse_int n, T beta, T* __restrict__ data, rocsparse_int ld)
+{
+    rocsparse_int gidx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int gidy = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(gidx >= m || gidy >= n)
+    {
+        return;
+    }
+
+    data[gidx + gidy * ld] *= beta;
+}
+
+// 2:4 structured sparse matrix dense matrix multiplication
+// C := alpha * A * B + beta * C. A is m x k with exactly two non-zero
+// entries in every group of four consecutive columns of a row. The kept
+// values are stored in column-major order as an m x (k / 2) array, byte g
+// of the column-major m x (k / 4) metadata holds the column offsets of
+// the two values of group g of a row in its low four bits. Each block
+// column of the grid processes one column of C, each thread computes one
+// entry. The threads of a wavefront read consecutive rows, such that the
+// value and metadata loads are fully coalesced and, unlike in the CSR
+// kernels, no per-non-zero column index has to be fetched.
+template <typename T, rocsparse_int BLOCKSIZE>
+static __device__ void s24mm_general_device(rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int k,
+                                            T             alpha,
+                                            const T* __restrict__ s24_val,
+                                            const unsigned char* __restrict__ s24_meta,
+                                            const T* __restrict__ B,
+                                            rocsparse_int ldb,
+                                            T             beta,
+                                            T* __restrict__ C,
+                                            rocsparse_int ldc)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int col = hipBlockIdx_y;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int ngroups = k >> 2;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int g = 0; g < ngroups; ++g)
+    {
+        unsigned char meta = s24_meta[row + g * m];
+
+        rocsparse_int col0 = (g << 2) + (meta & 0x3);
+        rocsparse_int col1 = (g << 2) + ((meta >> 2) & 0x3);
+
+        sum = rocsparse_fma(rocsparse_ldg(s24_val + row + (g << 1) * m),
+                            rocsparse_ldg(B + col0 + col * ldb),
+                            sum);
+        sum = rocsparse_fma(rocsparse_ldg(s24_val + row + ((g << 1) + 1) * m),
+                            rocsparse_ldg(B + col1 + col * ldb),
+                            sum);
+    }
+
+    if(beta == static_cast<T>(0))
+    {
+        C[row + col * ldc] = alpha * sum;
+    }
+    else
+    {
+        C[row + col * ldc] = rocsparse_fma(beta, C[row + col * ldc], alpha * sum);
+    }
+}
+
+#endif // S24MM_DEVICE_H
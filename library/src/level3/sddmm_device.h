@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SDDMM_DEVICE_H
+#define SDDMM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Sampled dense dense matrix multiplication. Each wavefront processes one row
+// of the sparsity pattern, walking the CSR structure like
+// csrmvn_general_device. For each non-zero entry (i, j), the lanes stride
+// over the inner dimension, computing the partial products A_il * B_jl, and
+// reduce the dot product within the wavefront. Only the sampled entries are
+// computed, the full dense product is never formed.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+static __device__ void sddmm_csr_device(rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int k,
+                                        rocsparse_int nnz,
+                                        T             alpha,
+                                        const T* __restrict__ A,
+                                        rocsparse_int lda,
+                                        const T* __restrict__ B,
+                                        rocsparse_int ldb,
+                                        T beta,
+                                        T* __restrict__ csr_val,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Sampled dot product of row i of A and row j of B
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int l = lid; l < k; l += WF_SIZE)
+        {
+            sum = rocsparse_fma(
+                rocsparse_ldg(A + row + l * lda), rocsparse_ldg(B + col + l * ldb), sum);
+        }
+
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                csr_val[j] = alpha * sum;
+            }
+            else
+            {
+                csr_val[j] = rocsparse_fma(beta, csr_val[j], alpha * sum);
+            }
+        }
+    }
+}
+
+#endif // SDDMM_DEVICE_H
@@ -0,0 +1,413 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRAMG_DEVICE_H
+#define CSRAMG_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Hash based random weight of a row, used to break ties between neighboring
+// unaggregated rows
+static __device__ unsigned int csramg_hash(rocsparse_int x)
+{
+    unsigned int h = static_cast<unsigned int>(x);
+
+    h = ((h >> 16) ^ h) * 0x45d9f3b;
+    h = ((h >> 16) ^ h) * 0x45d9f3b;
+    h = (h >> 16) ^ h;
+
+    return h;
+}
+
+// Count the strong connections per row, shifted by one such that the
+// subsequent inclusive scan yields the strength graph row pointers. An off
+// diagonal entry is strong, if its magnitude reaches theta times the
+// largest off diagonal magnitude of its row. Diagonal entries are not part
+// of the strength graph
+template <typename T>
+__global__ void csramg_strength_nnz_kernel(rocsparse_int        m,
+                                           const T*             csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           T                    theta,
+                                           rocsparse_int*       strength_row_ptr,
+                                           rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        rocsparse_int row_begin = csr_row_ptr[gid] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[gid + 1] - idx_base;
+
+        // Largest off diagonal magnitude of the row
+        T row_max = static_cast<T>(0);
+
+        for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+        {
+            if(csr_col_ind[aj] - idx_base != gid)
+            {
+                row_max = max(row_max, fabs(csr_val[aj]));
+            }
+        }
+
+        rocsparse_int row_nnz = 0;
+
+        if(row_max > static_cast<T>(0))
+        {
+            T threshold = theta * row_max;
+
+            for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+            {
+                if(csr_col_ind[aj] - idx_base != gid && fabs(csr_val[aj]) >= threshold)
+                {
+                    ++row_nnz;
+                }
+            }
+        }
+
+        strength_row_ptr[gid + 1] = row_nnz;
+    }
+
+    if(gid == 0)
+    {
+        strength_row_ptr[0] = idx_base;
+    }
+}
+
+// Gather the strong connections of each row into the strength graph
+template <typename T>
+__global__ void csramg_strength_fill_kernel(rocsparse_int        m,
+                                            const T*             csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            T                    theta,
+                                            const rocsparse_int* strength_row_ptr,
+                                            rocsparse_int*       strength_col_ind,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[gid] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[gid + 1] - idx_base;
+
+    T row_max = static_cast<T>(0);
+
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        if(csr_col_ind[aj] - idx_base != gid)
+        {
+            row_max = max(row_max, fabs(csr_val[aj]));
+        }
+    }
+
+    if(row_max <= static_cast<T>(0))
+    {
+        return;
+    }
+
+    T threshold = theta * row_max;
+
+    rocsparse_int pos = strength_row_ptr[gid] - idx_base;
+
+    for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+    {
+        if(csr_col_ind[aj] - idx_base != gid && fabs(csr_val[aj]) >= threshold)
+        {
+            strength_col_ind[pos++] = csr_col_ind[aj];
+        }
+    }
+}
+
+// One root selection sweep of the aggregation. Each unaggregated row
+// compares its random weight against all unaggregated neighbors and
+// becomes the root of a new aggregate, if it holds the maximum. The
+// matrix is interpreted as adjacency structure and is assumed to have a
+// symmetric pattern. Roots store their own row index, such that they can
+// be told apart from aggregate members
+template <unsigned int BLOCKSIZE>
+__global__ void csramg_mis_root_kernel(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       rocsparse_int* __restrict__ aggregates,
+                                       rocsparse_int* __restrict__ unaggregated,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Skip rows that have already been aggregated
+    if(aggregates[row] != -1)
+    {
+        return;
+    }
+
+    // Random weight of the current row
+    unsigned int row_weight = csramg_hash(row);
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Skip the diagonal and all neighbors that are already aggregated
+        if(col == row || aggregates[col] != -1)
+        {
+            continue;
+        }
+
+        // Random weight of the neighbor, ties are broken by the row index
+        unsigned int col_weight = csramg_hash(col);
+
+        if(col_weight > row_weight || (col_weight == row_weight && col > row))
+        {
+            return;
+        }
+    }
+
+    // Local maxima become roots of new aggregates
+    aggregates[row] = row;
+
+    atomicSub(unaggregated, 1);
+}
+
+// One member assignment sweep of the aggregation. Each unaggregated row
+// joins the aggregate of a neighboring root, preferring the root with the
+// largest random weight. Rows without a root neighbor stay unaggregated
+// and are retried in the next iteration
+template <unsigned int BLOCKSIZE>
+__global__ void csramg_mis_member_kernel(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                         rocsparse_int* __restrict__ aggregates,
+                                         rocsparse_int* __restrict__ unaggregated,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(aggregates[row] != -1)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int root        = -1;
+    unsigned int  root_weight = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Roots store their own row index
+        if(col != row && aggregates[col] == col)
+        {
+            unsigned int col_weight = csramg_hash(col);
+
+            if(root == -1 || col_weight > root_weight
+               || (col_weight == root_weight && col > root))
+            {
+                root        = col;
+                root_weight = col_weight;
+            }
+        }
+    }
+
+    if(root == -1)
+    {
+        return;
+    }
+
+    aggregates[row] = root;
+
+    atomicSub(unaggregated, 1);
+}
+
+// Flag the aggregate roots, such that an inclusive scan enumerates them
+__global__ void csramg_aggregate_flag_kernel(rocsparse_int m,
+                                             const rocsparse_int* __restrict__ aggregates,
+                                             rocsparse_int* __restrict__ work)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        work[gid] = (aggregates[gid] == gid) ? 1 : 0;
+    }
+}
+
+// Replace the stored root row indices by consecutive aggregate indices
+__global__ void csramg_aggregate_relabel_kernel(rocsparse_int m,
+                                                rocsparse_int* __restrict__ aggregates,
+                                                const rocsparse_int* __restrict__ work)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        aggregates[gid] = work[aggregates[gid]] - 1;
+    }
+}
+
+// Map each entry of the fine matrix to its coarse position, packing the
+// coarse row and column index of R * A * P into a single sort key
+__global__ void csramg_galerkin_keys_kernel(rocsparse_int m,
+                                            rocsparse_int naggs,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const rocsparse_int* __restrict__ aggregates,
+                                            int64_t* __restrict__ keys,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    int64_t coarse_row = static_cast<int64_t>(aggregates[row]) * naggs;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        keys[j] = coarse_row + aggregates[csr_col_ind[j] - idx_base];
+    }
+}
+
+// Map each entry of the fine matrix to its coarse position and gather the
+// values to be reduced
+template <typename T>
+__global__ void csramg_galerkin_pairs_kernel(rocsparse_int m,
+                                             rocsparse_int naggs,
+                                             const T* __restrict__ csr_val,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const rocsparse_int* __restrict__ aggregates,
+                                             int64_t* __restrict__ keys,
+                                             T* __restrict__ vals,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    int64_t coarse_row = static_cast<int64_t>(aggregates[row]) * naggs;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        keys[j] = coarse_row + aggregates[csr_col_ind[j] - idx_base];
+        vals[j] = csr_val[j];
+    }
+}
+
+// Count the distinct coarse positions per coarse row of the sorted keys,
+// shifted by one such that the subsequent inclusive scan yields the coarse
+// row pointers
+__global__ void csramg_galerkin_count_kernel(rocsparse_int nnz,
+                                             rocsparse_int naggs,
+                                             const int64_t* __restrict__ keys,
+                                             rocsparse_int* __restrict__ csr_row_ptr_C,
+                                             rocsparse_index_base idx_base_C)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid < nnz)
+    {
+        int64_t key = keys[gid];
+
+        if(gid == 0 || keys[gid - 1] != key)
+        {
+            atomicAdd(&csr_row_ptr_C[key / naggs + 1], 1);
+        }
+    }
+
+    if(gid == 0)
+    {
+        csr_row_ptr_C[0] = idx_base_C;
+    }
+}
+
+// Extract the total number of entries from a row pointer array, corrected
+// by the index base
+__global__ void csramg_nnz_extract_kernel(rocsparse_int        naggs,
+                                          const rocsparse_int* csr_row_ptr_C,
+                                          rocsparse_int*       nnz_C,
+                                          rocsparse_index_base idx_base_C)
+{
+    *nnz_C = csr_row_ptr_C[naggs] - idx_base_C;
+}
+
+// Unpack the reduced coarse positions into column indices and values. The
+// reduction by key preserves the sorted order, such that the entries are
+// written in coarse row major order
+template <typename T>
+__global__ void csramg_galerkin_fill_kernel(rocsparse_int naggs,
+                                            const rocsparse_int* __restrict__ unique_count,
+                                            const int64_t* __restrict__ keys,
+                                            const T* __restrict__ vals,
+                                            rocsparse_int* __restrict__ csr_col_ind_C,
+                                            T* __restrict__ csr_val_C,
+                                            rocsparse_index_base idx_base_C)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= *unique_count)
+    {
+        return;
+    }
+
+    csr_col_ind_C[gid] = keys[gid] % naggs + idx_base_C;
+    csr_val_C[gid]     = vals[gid];
+}
+
+#endif // CSRAMG_DEVICE_H
@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRIC0_DEVICE_H
+#define CSRIC0_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csric0_binsearch_kernel(rocsparse_int m,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        T* __restrict__ csr_val,
+                                        const rocsparse_int* __restrict__ csr_diag_ind,
+                                        int* __restrict__ done,
+                                        const rocsparse_int* __restrict__ map,
+                                        rocsparse_int* __restrict__ zero_pivot,
+                                        rocsparse_index_base idx_base)
+{
+    int           tid = hipThreadIdx_x;
+    int           lid = tid & (WF_SIZE - 1);
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag  = csr_diag_ind[row];
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+    // Structural zero pivot, nothing to factorize for this row
+    if(row_diag == -1)
+    {
+        if(lid == 0)
+        {
+            // We are looking for the first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+
+            // Mark this row as done, such that subsequent rows
+            // do not deadlock
+            rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
+        }
+
+        return;
+    }
+
+    // Loop over columns of current row, up to and including the diagonal.
+    // Entries above the diagonal are ignored, the factorization operates
+    // on the lower triangular part only.
+    for(rocsparse_int j = row_begin; j <= row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // Corresponding value
+        T local_val = csr_val[j];
+
+        if(local_col < row)
+        {
+            // Off-diagonal entry, depends on row local_col
+            rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+            // Diagonal entry point of row local_col
+            rocsparse_int local_diag = csr_diag_ind[local_col];
+
+            // Structural zero pivot in the dependency row, the
+            // factorization cannot be completed
+            if(local_diag == -1)
+            {
+                break;
+            }
+
+            // Spin loop until dependency has been resolved
+            while(!rocsparse_atomic_load(&done[local_col], __ATOMIC_ACQUIRE))
+                ;
+
+            // Load diagonal entry of the dependency row
+            T diag_val = csr_val[local_diag];
+
+            // Row has numerical zero diagonal
+            if(diag_val == static_cast<T>(0))
+            {
+                if(lid == 0)
+                {
+                    // We are looking for the first zero pivot
+                    atomicMin(zero_pivot, local_col + idx_base);
+                }
+
+                // Skip this row if it has a zero pivot
+                break;
+            }
+
+            // Compute the dot product of the prefix of the current row and
+            // the prefix of the dependency row
+            // Each lane processes one entry
+            T local_sum = static_cast<T>(0);
+
+            for(rocsparse_int k = local_begin + lid; k < local_diag; k += WF_SIZE)
+            {
+                rocsparse_int col_k = csr_col_ind[k];
+
+                // Perform a binary search to find the matching column in the
+                // current row prefix
+                rocsparse_int l = row_begin;
+                rocsparse_int r = j - 1;
+
+                while(l < r)
+                {
+                    rocsparse_int mid = (r + l) >> 1;
+
+                    if(csr_col_ind[mid] < col_k)
+                    {
+                        l = mid + 1;
+                    }
+                    else
+                    {
+                        r = mid;
+                    }
+                }
+
+                // Check if a match has been found
+                if(l < j && csr_col_ind[l] == col_k)
+                {
+                    local_sum = rocsparse_fma(csr_val[l], csr_val[k], local_sum);
+                }
+            }
+
+            // Gather all local sums for each lane
+            local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+            if(lid == WF_SIZE - 1)
+            {
+                csr_val[j] = (local_val - local_sum) / diag_val;
+            }
+        }
+        else if(local_col == row)
+        {
+            // Diagonal entry, compute the sum of squares of the
+            // current row prefix
+            // Each lane processes one entry
+            T local_sum = static_cast<T>(0);
+
+            for(rocsparse_int k = row_begin + lid; k < row_diag; k += WF_SIZE)
+            {
+                T val     = csr_val[k];
+                local_sum = rocsparse_fma(val, val, local_sum);
+            }
+
+            // Gather all local sums for each lane
+            local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+            if(lid == WF_SIZE - 1)
+            {
+                T diag_val = local_val - local_sum;
+
+                if(diag_val <= static_cast<T>(0))
+                {
+                    // Matrix is not positive definite, report the pivot
+                    atomicMin(zero_pivot, row + idx_base);
+                }
+                else
+                {
+                    csr_val[j] = sqrt(diag_val);
+                }
+            }
+        }
+    }
+
+    if(lid == 0)
+    {
+        // Lane 0 write "we are done" flag
+        rocsparse_atomic_store(&done[row], 1, __ATOMIC_RELEASE);
+    }
+}
+
+#endif // CSRIC0_DEVICE_H
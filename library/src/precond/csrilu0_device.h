@@ -34,8 +34,10 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
                                     const rocsparse_int* __restrict__ csr_row_ptr,
                                     const rocsparse_int* __restrict__ csr_col_ind,
                                     T* __restrict__ csr_val,
+                                    rocsparse_int batch_stride,
                                     const rocsparse_int* __restrict__ csr_diag_ind,
                                     int* __restrict__ done,
+                                    rocsparse_int done_stride,
                                     const rocsparse_int* __restrict__ map,
                                     rocsparse_int* __restrict__ zero_pivot,
                                     rocsparse_index_base idx_base)
@@ -64,6 +66,11 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
         return;
     }
 
+    // Shift values and done flags to the matrix of the current batch. All
+    // matrices of a batch share the same sparsity pattern.
+    csr_val += hipBlockIdx_y * batch_stride;
+    done += hipBlockIdx_y * done_stride;
+
     // Current row this wavefront is working on
     rocsparse_int row = map[idx];
 
@@ -189,8 +196,10 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
                                          const rocsparse_int* __restrict__ csr_row_ptr,
                                          const rocsparse_int* __restrict__ csr_col_ind,
                                          T* __restrict__ csr_val,
+                                         rocsparse_int batch_stride,
                                          const rocsparse_int* __restrict__ csr_diag_ind,
                                          int* __restrict__ done,
+                                         rocsparse_int done_stride,
                                          const rocsparse_int* __restrict__ map,
                                          rocsparse_int* __restrict__ zero_pivot,
                                          rocsparse_index_base idx_base)
@@ -206,6 +215,11 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
         return;
     }
 
+    // Shift values and done flags to the matrix of the current batch. All
+    // matrices of a batch share the same sparsity pattern.
+    csr_val += hipBlockIdx_y * batch_stride;
+    done += hipBlockIdx_y * done_stride;
+
     // Current row this wavefront is working on
     rocsparse_int row = map[idx];
     // Diagonal entry point of the current row
@@ -297,4 +311,344 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
     }
 }
 
+// One fixed-point sweep of the incremental numeric re-factorization. The
+// kernel performs the same row elimination as csrilu0_binsearch_kernel, but
+// instead of spin waiting until its dependency rows are final, it consumes
+// the current factor approximation in csr_lu. Warm-started from the factor
+// of a previous, slightly different matrix, each sweep contracts towards
+// the exact incomplete factors of the new values. The row is first
+// re-initialized from the new matrix values, such that the sweep iterates
+// on the factorization of the new matrix, not on an update of the old one.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__global__ void csrilu0_sweep_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     T* __restrict__ csr_lu,
+                                     const rocsparse_int* __restrict__ csr_diag_ind,
+                                     const rocsparse_int* __restrict__ map,
+                                     rocsparse_int* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base)
+{
+    int           tid = hipThreadIdx_x;
+    int           lid = tid & (WF_SIZE - 1);
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int idx = gid / WF_SIZE;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag  = csr_diag_ind[row];
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Re-initialize the row from the new matrix values
+    // Each lane processes one entry
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        csr_lu[j] = csr_val[j];
+    }
+
+    // Loop over column of current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+        // Corresponding value
+        T local_val = csr_lu[j];
+        // End of the row that corresponds to local_col
+        rocsparse_int local_end = csr_row_ptr[local_col + 1] - idx_base;
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            local_diag = local_end - 1;
+        }
+
+        // Load the current approximation of the diagonal entry
+        T diag_val = csr_lu[local_diag];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        csr_lu[j] = local_val /= diag_val;
+
+        // Loop over the row the current column index depends on
+        // Each lane processes one entry
+        rocsparse_int l = j + 1;
+        for(rocsparse_int k = local_diag + 1 + lid; k < local_end; k += WF_SIZE)
+        {
+            // Perform a binary search to find matching columns
+            rocsparse_int r     = row_end - 1;
+            rocsparse_int m     = (r + l) >> 1;
+            rocsparse_int col_j = csr_col_ind[m];
+
+            rocsparse_int col_k = csr_col_ind[k];
+
+            // Binary search
+            while(l < r)
+            {
+                if(col_j < col_k)
+                {
+                    l = m + 1;
+                }
+                else
+                {
+                    r = m;
+                }
+
+                m     = (r + l) >> 1;
+                col_j = csr_col_ind[m];
+            }
+
+            // Check if a match has been found
+            if(col_j == col_k)
+            {
+                // If a match has been found, do ILU computation
+                csr_lu[l] = rocsparse_fma(-local_val, csr_lu[k], csr_lu[l]);
+            }
+        }
+    }
+}
+
+// Initial guess for the fine-grained iterative factorization. Each thread
+// initializes one non-zero entry of the factors with the corresponding
+// matrix value, where the lower triangular part is scaled by the diagonal
+// entry of its column, such that the initial guess matches the exact
+// incomplete factors up to the elimination updates.
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrilu0_iterative_init_kernel(rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ csr_val,
+                                              T* __restrict__ csr_lu,
+                                              const rocsparse_int* __restrict__ csr_diag_ind,
+                                              rocsparse_int* __restrict__ zero_pivot,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    // Binary search for the row that contains the current entry
+    rocsparse_int l = 0;
+    rocsparse_int r = m;
+
+    while(r > l + 1)
+    {
+        rocsparse_int mid = (l + r) >> 1;
+
+        if(csr_row_ptr[mid] - idx_base <= gid)
+        {
+            l = mid;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    rocsparse_int row = l;
+    rocsparse_int col = csr_col_ind[gid] - idx_base;
+
+    // Diagonal and upper triangular part are initialized with the matrix value
+    if(col >= row)
+    {
+        csr_lu[gid] = csr_val[gid];
+
+        return;
+    }
+
+    // Diagonal entry point of the column the current entry depends on
+    rocsparse_int diag = csr_diag_ind[col];
+
+    // Structural zero pivot
+    if(diag == -1)
+    {
+        // We are looking for the first zero pivot
+        atomicMin(zero_pivot, col);
+
+        csr_lu[gid] = csr_val[gid];
+
+        return;
+    }
+
+    // Load diagonal entry
+    T diag_val = csr_val[diag];
+
+    // Row has numerical zero diagonal
+    if(diag_val == static_cast<T>(0))
+    {
+        // We are looking for the first zero pivot
+        atomicMin(zero_pivot, col);
+
+        csr_lu[gid] = csr_val[gid];
+
+        return;
+    }
+
+    // Lower triangular part is scaled by the diagonal entry of its column
+    csr_lu[gid] = csr_val[gid] / diag_val;
+}
+
+// One fine-grained fixed-point sweep of the iterative factorization. Instead
+// of resolving the dependencies between the rows, each thread recomputes one
+// non-zero entry of the factors from the current approximation,
+//
+//   l_ij = (a_ij - sum_k l_ik * u_kj) / u_jj    for i > j,
+//   u_ij =  a_ij - sum_k l_ik * u_kj            for i <= j,
+//
+// with k running over the sparsity pattern below min(i, j). All entries are
+// updated concurrently at full occupancy, independent of the dependency
+// depth of the matrix, and consume each others updates asynchronously. Each
+// sweep contracts the approximation towards the exact incomplete factors.
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrilu0_iterative_sweep_kernel(rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               const T* __restrict__ csr_val,
+                                               T* __restrict__ csr_lu,
+                                               const rocsparse_int* __restrict__ csr_diag_ind,
+                                               rocsparse_int* __restrict__ zero_pivot,
+                                               rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    // Binary search for the row that contains the current entry
+    rocsparse_int l = 0;
+    rocsparse_int r = m;
+
+    while(r > l + 1)
+    {
+        rocsparse_int mid = (l + r) >> 1;
+
+        if(csr_row_ptr[mid] - idx_base <= gid)
+        {
+            l = mid;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    rocsparse_int row       = l;
+    rocsparse_int col       = csr_col_ind[gid] - idx_base;
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+
+    // The fixed-point update is anchored to the matrix value
+    T sum = csr_val[gid];
+
+    // Loop over the entries left of the current entry, accumulating the
+    // elimination updates from the current factor approximation
+    for(rocsparse_int j = row_begin; j < gid; ++j)
+    {
+        // Column index currently being processed
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Only columns k < min(i, j) contribute
+        if(local_col >= row || local_col >= col)
+        {
+            break;
+        }
+
+        // Binary search for the entry (k, j) in the upper part of row k
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        l = (local_diag != -1) ? local_diag : csr_row_ptr[local_col] - idx_base;
+        r = csr_row_ptr[local_col + 1] - idx_base - 1;
+
+        while(l < r)
+        {
+            rocsparse_int mid = (l + r) >> 1;
+
+            if(csr_col_ind[mid] - idx_base < col)
+            {
+                l = mid + 1;
+            }
+            else
+            {
+                r = mid;
+            }
+        }
+
+        // Check if a match has been found
+        if(l <= r && csr_col_ind[l] - idx_base == col)
+        {
+            // If a match has been found, do ILU computation
+            sum = rocsparse_fma(-csr_lu[j], csr_lu[l], sum);
+        }
+    }
+
+    // Diagonal and upper triangular entries are complete
+    if(col >= row)
+    {
+        csr_lu[gid] = sum;
+
+        return;
+    }
+
+    // Diagonal entry point of the column the current entry depends on
+    rocsparse_int diag = csr_diag_ind[col];
+
+    // Structural zero pivot
+    if(diag == -1)
+    {
+        // We are looking for the first zero pivot
+        atomicMin(zero_pivot, col);
+
+        csr_lu[gid] = sum;
+
+        return;
+    }
+
+    // Load the current approximation of the diagonal entry
+    T diag_val = csr_lu[diag];
+
+    // Row has numerical zero diagonal
+    if(diag_val == static_cast<T>(0))
+    {
+        // We are looking for the first zero pivot
+        atomicMin(zero_pivot, col);
+
+        csr_lu[gid] = sum;
+
+        return;
+    }
+
+    // Lower triangular part is scaled by the current approximation of the
+    // diagonal entry of its column
+    csr_lu[gid] = sum / diag_val;
+}
+
 #endif // CSRILU0_DEVICE_H
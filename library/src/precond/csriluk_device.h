@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRILUK_DEVICE_H
+#define CSRILUK_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Scatter the values of the sparse CSR matrix into the (structurally larger)
+// factorization pattern. Fill-in positions that are not present in the input
+// matrix are initialized with zero. Both column arrays are assumed to be
+// sorted, such that each row can be processed by a two pointer merge.
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csriluk_scatter_kernel(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const rocsparse_int* __restrict__ iluk_row_ptr,
+                                       const rocsparse_int* __restrict__ iluk_col_ind,
+                                       T* __restrict__ iluk_val,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int iluk_row_begin = iluk_row_ptr[row] - idx_base;
+    rocsparse_int iluk_row_end   = iluk_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int j = row_begin;
+
+    for(rocsparse_int i = iluk_row_begin; i < iluk_row_end; ++i)
+    {
+        if(j < row_end && csr_col_ind[j] == iluk_col_ind[i])
+        {
+            iluk_val[i] = csr_val[j++];
+        }
+        else
+        {
+            // Fill-in entry
+            iluk_val[i] = static_cast<T>(0);
+        }
+    }
+}
+
+#endif // CSRILUK_DEVICE_H
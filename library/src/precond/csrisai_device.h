@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRISAI_DEVICE_H
+#define CSRISAI_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Binary search for the position of the first entry with a column >= col
+// within the row range [row_begin, row_end) of the CSR column indices
+static __device__ rocsparse_int csrisai_lower_bound(const rocsparse_int* csr_col_ind,
+                                                    rocsparse_int        row_begin,
+                                                    rocsparse_int        row_end,
+                                                    rocsparse_int        col)
+{
+    rocsparse_int left  = row_begin;
+    rocsparse_int right = row_end;
+
+    while(left < right)
+    {
+        rocsparse_int mid = (left + right) / 2;
+
+        if(csr_col_ind[mid] < col)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+
+    return left;
+}
+
+// Binary search for the position of column col within the row range
+// [row_begin, row_end) of the CSR column indices. Returns -1 if the row does
+// not store an entry at this column
+static __device__ rocsparse_int csrisai_find_entry(const rocsparse_int* csr_col_ind,
+                                                   rocsparse_int        row_begin,
+                                                   rocsparse_int        row_end,
+                                                   rocsparse_int        col)
+{
+    rocsparse_int pos = csrisai_lower_bound(csr_col_ind, row_begin, row_end, col);
+
+    return (pos < row_end && csr_col_ind[pos] == col) ? pos : -1;
+}
+
+// ISAI construction for a lower triangular factor. Each thread matches one
+// row of the approximate inverse against the identity on the sparsity
+// pattern of its factor row, which amounts to one small dense triangular
+// solve per row. The approximate inverse shares the pattern of the factor,
+// entries right of the diagonal are zeroed out
+template <typename T>
+static __device__ void csrisai_lower_device(rocsparse_int        m,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            const T*             csr_val,
+                                            T*                   isai_val,
+                                            rocsparse_diag_type  diag_type,
+                                            rocsparse_int*       zero_pivot,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Position of the first entry with a column >= row
+    rocsparse_int bound
+        = csrisai_lower_bound(csr_col_ind, row_begin, row_end, row + idx_base);
+
+    // Last unknown of the small system, excluding the diagonal for unit
+    // diagonal factors, which is implicitly one and not stored
+    rocsparse_int last = bound - 1;
+
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        // Structural or numerical zero pivot, report the row and skip it
+        if(bound == row_end || csr_col_ind[bound] - idx_base != row || csr_val[bound] == static_cast<T>(0))
+        {
+            atomicMin(zero_pivot, row + idx_base);
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                isai_val[j] = static_cast<T>(0);
+            }
+
+            return;
+        }
+
+        isai_val[bound] = static_cast<T>(1) / csr_val[bound];
+
+        last = bound;
+    }
+
+    // Entries right of the diagonal do not belong to the lower triangular
+    // part
+    for(rocsparse_int j = last + 1; j < row_end; ++j)
+    {
+        isai_val[j] = static_cast<T>(0);
+    }
+
+    // Back substitution of the small triangular system, from the diagonal
+    // towards the first entry of the row
+    for(rocsparse_int p = (diag_type == rocsparse_diag_type_non_unit) ? last - 1 : last;
+        p >= row_begin;
+        --p)
+    {
+        rocsparse_int col = csr_col_ind[p];
+
+        // For unit diagonal factors, the implicitly stored diagonal of the
+        // approximate inverse row contributes the factor entry itself
+        T sum = (diag_type == rocsparse_diag_type_non_unit) ? static_cast<T>(0) : csr_val[p];
+
+        for(rocsparse_int q = p + 1; q <= last; ++q)
+        {
+            rocsparse_int r = csr_col_ind[q] - idx_base;
+
+            rocsparse_int pos
+                = csrisai_find_entry(csr_col_ind, csr_row_ptr[r] - idx_base, csr_row_ptr[r + 1] - idx_base, col);
+
+            if(pos != -1)
+            {
+                sum = rocsparse_fma(isai_val[q], csr_val[pos], sum);
+            }
+        }
+
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            // Diagonal entry of the row the current column points to
+            rocsparse_int r = col - idx_base;
+
+            rocsparse_int pos
+                = csrisai_find_entry(csr_col_ind, csr_row_ptr[r] - idx_base, csr_row_ptr[r + 1] - idx_base, col);
+
+            if(pos == -1 || csr_val[pos] == static_cast<T>(0))
+            {
+                atomicMin(zero_pivot, col);
+                isai_val[p] = static_cast<T>(0);
+
+                continue;
+            }
+
+            isai_val[p] = -sum / csr_val[pos];
+        }
+        else
+        {
+            isai_val[p] = -sum;
+        }
+    }
+}
+
+// ISAI construction for an upper triangular factor, the mirrored counterpart
+// of csrisai_lower_device. Entries left of the diagonal are zeroed out
+template <typename T>
+static __device__ void csrisai_upper_device(rocsparse_int        m,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            const T*             csr_val,
+                                            T*                   isai_val,
+                                            rocsparse_diag_type  diag_type,
+                                            rocsparse_int*       zero_pivot,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Position of the first entry with a column >= row
+    rocsparse_int bound
+        = csrisai_lower_bound(csr_col_ind, row_begin, row_end, row + idx_base);
+
+    // First unknown of the small system, excluding the diagonal for unit
+    // diagonal factors, which is implicitly one and not stored
+    rocsparse_int first = bound;
+
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        // Structural or numerical zero pivot, report the row and skip it
+        if(bound == row_end || csr_col_ind[bound] - idx_base != row || csr_val[bound] == static_cast<T>(0))
+        {
+            atomicMin(zero_pivot, row + idx_base);
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                isai_val[j] = static_cast<T>(0);
+            }
+
+            return;
+        }
+
+        isai_val[bound] = static_cast<T>(1) / csr_val[bound];
+    }
+    else if(bound < row_end && csr_col_ind[bound] - idx_base == row)
+    {
+        // Skip a stored diagonal entry of a unit diagonal factor
+        first = bound + 1;
+        isai_val[bound] = static_cast<T>(0);
+    }
+
+    // Entries left of the diagonal do not belong to the upper triangular
+    // part
+    for(rocsparse_int j = row_begin; j < bound; ++j)
+    {
+        isai_val[j] = static_cast<T>(0);
+    }
+
+    // Forward substitution of the small triangular system, from the diagonal
+    // towards the last entry of the row
+    for(rocsparse_int p = (diag_type == rocsparse_diag_type_non_unit) ? first + 1 : first;
+        p < row_end;
+        ++p)
+    {
+        rocsparse_int col = csr_col_ind[p];
+
+        // For unit diagonal factors, the implicitly stored diagonal of the
+        // approximate inverse row contributes the factor entry itself
+        T sum = (diag_type == rocsparse_diag_type_non_unit) ? static_cast<T>(0) : csr_val[p];
+
+        for(rocsparse_int q = first; q < p; ++q)
+        {
+            rocsparse_int r = csr_col_ind[q] - idx_base;
+
+            rocsparse_int pos
+                = csrisai_find_entry(csr_col_ind, csr_row_ptr[r] - idx_base, csr_row_ptr[r + 1] - idx_base, col);
+
+            if(pos != -1)
+            {
+                sum = rocsparse_fma(isai_val[q], csr_val[pos], sum);
+            }
+        }
+
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            // Diagonal entry of the row the current column points to
+            rocsparse_int r = col - idx_base;
+
+            rocsparse_int pos
+                = csrisai_find_entry(csr_col_ind, csr_row_ptr[r] - idx_base, csr_row_ptr[r + 1] - idx_base, col);
+
+            if(pos == -1 || csr_val[pos] == static_cast<T>(0))
+            {
+                atomicMin(zero_pivot, col);
+                isai_val[p] = static_cast<T>(0);
+
+                continue;
+            }
+
+            isai_val[p] = -sum / csr_val[pos];
+        }
+        else
+        {
+            isai_val[p] = -sum;
+        }
+    }
+}
+
+#endif // CSRISAI_DEVICE_H
@@ -0,0 +1,729 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_csramg.hpp"
+
+#include <algorithm>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csramg_strength_buffer_size(rocsparse_handle handle,
+                                                                  rocsparse_int    m,
+                                                                  rocsparse_int    nnz,
+                                                                  size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csramg_strength_buffer_size", m, nnz, (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim buffer size
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, *buffer_size, ptr, ptr, m + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // Do not return 0 as size
+    if(*buffer_size == 0)
+    {
+        *buffer_size = 4;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsramg_strength_nnz(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const float*              csr_val,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           float                     theta,
+                                                           rocsparse_int* strength_row_ptr,
+                                                           rocsparse_int* strength_nnz,
+                                                           void*          temp_buffer)
+{
+    return rocsparse_csramg_strength_nnz_template<float>(handle,
+                                                         m,
+                                                         nnz,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         theta,
+                                                         strength_row_ptr,
+                                                         strength_nnz,
+                                                         temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsramg_strength_nnz(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const double*             csr_val,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           double                    theta,
+                                                           rocsparse_int* strength_row_ptr,
+                                                           rocsparse_int* strength_nnz,
+                                                           void*          temp_buffer)
+{
+    return rocsparse_csramg_strength_nnz_template<double>(handle,
+                                                          m,
+                                                          nnz,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          theta,
+                                                          strength_row_ptr,
+                                                          strength_nnz,
+                                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsramg_strength(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float*              csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       float                     theta,
+                                                       const rocsparse_int*      strength_row_ptr,
+                                                       rocsparse_int*            strength_col_ind)
+{
+    return rocsparse_csramg_strength_template<float>(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     theta,
+                                                     strength_row_ptr,
+                                                     strength_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_dcsramg_strength(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double*             csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       double                    theta,
+                                                       const rocsparse_int*      strength_row_ptr,
+                                                       rocsparse_int*            strength_col_ind)
+{
+    return rocsparse_csramg_strength_template<double>(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      theta,
+                                                      strength_row_ptr,
+                                                      strength_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_csramg_aggregate(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int*            aggregates,
+                                                       rocsparse_int*            naggs)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csramg_aggregate",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)aggregates,
+              (const void*&)naggs);
+
+    log_bench(handle, "./rocsparse-bench -f csramg_aggregate", "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(naggs, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *naggs = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz > 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(aggregates == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(naggs == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Initialize aggregates with -1, representing unaggregated rows
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(aggregates, 255, sizeof(rocsparse_int) * m, stream));
+
+    // Counter of unaggregated rows
+    rocsparse_int* d_unaggregated = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int), (void**)&d_unaggregated));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(d_unaggregated, &m, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+#define CSRAMG_DIM 256
+    dim3 csramg_blocks((m - 1) / CSRAMG_DIM + 1);
+    dim3 csramg_threads(CSRAMG_DIM);
+
+    // Alternating root selection and member assignment sweeps. The loop
+    // terminates, since at least the global maximum weight among the
+    // unaggregated rows becomes a root in every iteration.
+    rocsparse_int unaggregated = m;
+
+    while(unaggregated > 0)
+    {
+        hipLaunchKernelGGL((csramg_mis_root_kernel<CSRAMG_DIM>),
+                           csramg_blocks,
+                           csramg_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           aggregates,
+                           d_unaggregated,
+                           descr->base);
+
+        hipLaunchKernelGGL((csramg_mis_member_kernel<CSRAMG_DIM>),
+                           csramg_blocks,
+                           csramg_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           aggregates,
+                           d_unaggregated,
+                           descr->base);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &unaggregated, d_unaggregated, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_unaggregated));
+
+    // Enumerate the roots, such that the aggregates are labeled by
+    // consecutive indices starting at zero
+    rocsparse_int* work = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(sizeof(rocsparse_int) * m, (void**)&work));
+
+    hipLaunchKernelGGL((csramg_aggregate_flag_kernel),
+                       csramg_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       m,
+                       aggregates,
+                       work);
+
+    size_t size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, work, work, m, rocprim::plus<rocsparse_int>(), stream));
+
+    void* rocprim_buffer = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_alloc(size, &rocprim_buffer));
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        rocprim_buffer, size, work, work, m, rocprim::plus<rocsparse_int>(), stream));
+
+    hipLaunchKernelGGL((csramg_aggregate_relabel_kernel),
+                       csramg_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       m,
+                       aggregates,
+                       work);
+#undef CSRAMG_DIM
+
+    // Hand the number of aggregates back according to the pointer mode of
+    // the handle
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            naggs, work + m - 1, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(naggs, work + m - 1, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    }
+
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(rocprim_buffer));
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(work));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csramg_galerkin_buffer_size(rocsparse_handle handle,
+                                                                  rocsparse_int    m,
+                                                                  rocsparse_int    nnz,
+                                                                  rocsparse_int    naggs,
+                                                                  size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csramg_galerkin_buffer_size",
+              m,
+              nnz,
+              naggs,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || naggs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || naggs == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim buffer sizes. The value slots are sized for the
+    // largest supported precision, such that the buffer can be shared by
+    // all precisions
+    int64_t*       keys = nullptr;
+    double*        vals = nullptr;
+    rocsparse_int* ptr  = nullptr;
+
+    size_t sort_size = 0;
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, sort_size, keys, keys, vals, vals, nnz, 0, 64, stream));
+
+    size_t reduce_size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::reduce_by_key(nullptr,
+                                               reduce_size,
+                                               keys,
+                                               vals,
+                                               nnz,
+                                               keys,
+                                               vals,
+                                               ptr,
+                                               rocprim::plus<double>(),
+                                               rocprim::equal_to<int64_t>(),
+                                               stream));
+
+    size_t scan_size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, scan_size, ptr, ptr, naggs + 1, rocprim::plus<rocsparse_int>(), stream));
+
+    size_t rocprim_size = std::max(sort_size, std::max(reduce_size, scan_size));
+
+    // Double buffers for the sort keys and values, the device resident
+    // entry counter and the rocprim scratch space
+    *buffer_size = 4 * rocsparse_csramg_galerkin_region_size(nnz) + 256
+                   + ((rocprim_size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csramg_galerkin_nnz(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          rocsparse_int             naggs,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          const rocsparse_int*      aggregates,
+                                                          const rocsparse_mat_descr descr_C,
+                                                          rocsparse_int*            csr_row_ptr_C,
+                                                          rocsparse_int*            nnz_C,
+                                                          void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csramg_galerkin_nnz",
+              m,
+              nnz,
+              naggs,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)aggregates,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)temp_buffer);
+
+    // Check index bases
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix types
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || naggs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check nnz pointer argument before quick return
+    if(nnz_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || naggs == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(aggregates == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Carve the temporary storage buffer, the value slots are not needed
+    // by the pattern computation
+    size_t region = rocsparse_csramg_galerkin_region_size(nnz);
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    int64_t* keys0 = reinterpret_cast<int64_t*>(ptr);
+    ptr += region;
+    int64_t* keys1 = reinterpret_cast<int64_t*>(ptr);
+    ptr += 3 * region + 256;
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+#define CSRAMG_DIM 256
+    dim3 csramg_blocks((m - 1) / CSRAMG_DIM + 1);
+    dim3 csramg_threads(CSRAMG_DIM);
+
+    // Map each fine entry to its coarse position
+    hipLaunchKernelGGL((csramg_galerkin_keys_kernel),
+                       csramg_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       m,
+                       naggs,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       aggregates,
+                       keys0,
+                       descr->base);
+
+    // Sort the coarse positions
+    rocprim::double_buffer<int64_t> rocprim_keys(keys0, keys1);
+
+    size_t size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(nullptr, size, rocprim_keys, nnz, 0, 64, stream));
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_keys(rocprim_buffer, size, rocprim_keys, nnz, 0, 64, stream));
+
+    // Count the distinct coarse positions per coarse row
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(csr_row_ptr_C, 0, sizeof(rocsparse_int) * (naggs + 1), stream));
+
+    dim3 csramg_count_blocks((nnz - 1) / CSRAMG_DIM + 1);
+
+    hipLaunchKernelGGL((csramg_galerkin_count_kernel),
+                       csramg_count_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       nnz,
+                       naggs,
+                       rocprim_keys.current(),
+                       csr_row_ptr_C,
+                       descr_C->base);
+#undef CSRAMG_DIM
+
+    // Inclusive sum to obtain the coarse row pointers
+    size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                naggs + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                naggs + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract the coarse nnz, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csramg_nnz_extract_kernel),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           naggs,
+                           csr_row_ptr_C,
+                           nnz_C,
+                           descr_C->base);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_C, csr_row_ptr_C + naggs, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        *nnz_C -= descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsramg_galerkin(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       rocsparse_int             naggs,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float*              csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       const rocsparse_int*      aggregates,
+                                                       const rocsparse_mat_descr descr_C,
+                                                       float*                    csr_val_C,
+                                                       const rocsparse_int*      csr_row_ptr_C,
+                                                       rocsparse_int*            csr_col_ind_C,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csramg_galerkin_template<float>(handle,
+                                                     m,
+                                                     nnz,
+                                                     naggs,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     aggregates,
+                                                     descr_C,
+                                                     csr_val_C,
+                                                     csr_row_ptr_C,
+                                                     csr_col_ind_C,
+                                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsramg_galerkin(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       rocsparse_int             naggs,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double*             csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       const rocsparse_int*      aggregates,
+                                                       const rocsparse_mat_descr descr_C,
+                                                       double*                   csr_val_C,
+                                                       const rocsparse_int*      csr_row_ptr_C,
+                                                       rocsparse_int*            csr_col_ind_C,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csramg_galerkin_template<double>(handle,
+                                                      m,
+                                                      nnz,
+                                                      naggs,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      aggregates,
+                                                      descr_C,
+                                                      csr_val_C,
+                                                      csr_row_ptr_C,
+                                                      csr_col_ind_C,
+                                                      temp_buffer);
+}
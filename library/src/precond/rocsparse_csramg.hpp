@@ -0,0 +1,551 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRAMG_HPP
+#define ROCSPARSE_CSRAMG_HPP
+
+#include "csramg_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+// The temporary storage buffer of the Galerkin product holds a double
+// buffer of 64 bit sort keys, a double buffer of value slots sized for the
+// largest supported precision, a device resident entry counter and the
+// rocprim scratch space, each region aligned to 256 byte
+inline size_t rocsparse_csramg_galerkin_region_size(rocsparse_int nnz)
+{
+    return ((sizeof(int64_t) * nnz - 1) / 256 + 1) * 256;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csramg_strength_nnz_template(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        T                         theta,
+                                                        rocsparse_int* strength_row_ptr,
+                                                        rocsparse_int* strength_nnz,
+                                                        void*          temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsramg_strength_nnz"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              theta,
+              (const void*&)strength_row_ptr,
+              (const void*&)strength_nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check threshold
+    if(theta < static_cast<T>(0) || theta > static_cast<T>(1))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check nnz pointer argument before quick return
+    if(strength_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(strength_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *strength_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(strength_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSRAMG_DIM 256
+    dim3 csramg_blocks((m - 1) / CSRAMG_DIM + 1);
+    dim3 csramg_threads(CSRAMG_DIM);
+
+    // Count the strong connections per row
+    hipLaunchKernelGGL((csramg_strength_nnz_kernel<T>),
+                       csramg_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       theta,
+                       strength_row_ptr,
+                       descr->base);
+#undef CSRAMG_DIM
+
+    // Inclusive sum to obtain the strength graph row pointers
+    size_t size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                strength_row_ptr,
+                                                strength_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_buffer,
+                                                size,
+                                                strength_row_ptr,
+                                                strength_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract the strength graph nnz, if handle says so
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csramg_nnz_extract_kernel),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           strength_row_ptr,
+                           strength_nnz,
+                           descr->base);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            strength_nnz, strength_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        *strength_nnz -= descr->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csramg_strength_template(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    T                         theta,
+                                                    const rocsparse_int*      strength_row_ptr,
+                                                    rocsparse_int*            strength_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsramg_strength"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              theta,
+              (const void*&)strength_row_ptr,
+              (const void*&)strength_col_ind);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csramg_strength -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check threshold
+    if(theta < static_cast<T>(0) || theta > static_cast<T>(1))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(strength_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(strength_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRAMG_DIM 256
+    dim3 csramg_blocks((m - 1) / CSRAMG_DIM + 1);
+    dim3 csramg_threads(CSRAMG_DIM);
+
+    // Gather the strong connections
+    hipLaunchKernelGGL((csramg_strength_fill_kernel<T>),
+                       csramg_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       theta,
+                       strength_row_ptr,
+                       strength_col_ind,
+                       descr->base);
+#undef CSRAMG_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csramg_galerkin_template(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    rocsparse_int             naggs,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    const rocsparse_int*      aggregates,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    T*                        csr_val_C,
+                                                    const rocsparse_int*      csr_row_ptr_C,
+                                                    rocsparse_int*            csr_col_ind_C,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsramg_galerkin"),
+              m,
+              nnz,
+              naggs,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)aggregates,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)temp_buffer);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csramg_galerkin -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index bases
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix types
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || naggs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || naggs == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(aggregates == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Carve the temporary storage buffer
+    size_t region = rocsparse_csramg_galerkin_region_size(nnz);
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    int64_t* keys0 = reinterpret_cast<int64_t*>(ptr);
+    ptr += region;
+    int64_t* keys1 = reinterpret_cast<int64_t*>(ptr);
+    ptr += region;
+    T* vals0 = reinterpret_cast<T*>(ptr);
+    ptr += region;
+    T* vals1 = reinterpret_cast<T*>(ptr);
+    ptr += region;
+    rocsparse_int* unique_count = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+#define CSRAMG_DIM 256
+    dim3 csramg_blocks((m - 1) / CSRAMG_DIM + 1);
+    dim3 csramg_threads(CSRAMG_DIM);
+
+    // Map each fine entry to its coarse position and gather the values
+    hipLaunchKernelGGL((csramg_galerkin_pairs_kernel<T>),
+                       csramg_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       m,
+                       naggs,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       aggregates,
+                       keys0,
+                       vals0,
+                       descr->base);
+
+    // Sort the entries by their coarse position
+    rocprim::double_buffer<int64_t> rocprim_keys(keys0, keys1);
+    rocprim::double_buffer<T>       rocprim_vals(vals0, vals1);
+
+    size_t size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, size, rocprim_keys, rocprim_vals, nnz, 0, 64, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, size, rocprim_keys, rocprim_vals, nnz, 0, 64, stream));
+
+    // Sum up all entries that fall onto the same coarse position. The
+    // scratch halves of the double buffers receive the reduced keys and
+    // values
+    int64_t* unique_keys = rocprim_keys.alternate();
+    T*       unique_vals = rocprim_vals.alternate();
+
+    size = 0;
+    RETURN_IF_HIP_ERROR(rocprim::reduce_by_key(nullptr,
+                                               size,
+                                               rocprim_keys.current(),
+                                               rocprim_vals.current(),
+                                               nnz,
+                                               unique_keys,
+                                               unique_vals,
+                                               unique_count,
+                                               rocprim::plus<T>(),
+                                               rocprim::equal_to<int64_t>(),
+                                               stream));
+    RETURN_IF_HIP_ERROR(rocprim::reduce_by_key(rocprim_buffer,
+                                               size,
+                                               rocprim_keys.current(),
+                                               rocprim_vals.current(),
+                                               nnz,
+                                               unique_keys,
+                                               unique_vals,
+                                               unique_count,
+                                               rocprim::plus<T>(),
+                                               rocprim::equal_to<int64_t>(),
+                                               stream));
+
+    // Unpack the reduced entries into the coarse matrix. The fine nnz is
+    // an upper bound of the coarse nnz, surplus threads drop out on the
+    // device resident entry counter
+    dim3 csramg_fill_blocks((nnz - 1) / CSRAMG_DIM + 1);
+
+    hipLaunchKernelGGL((csramg_galerkin_fill_kernel<T>),
+                       csramg_fill_blocks,
+                       csramg_threads,
+                       0,
+                       stream,
+                       naggs,
+                       unique_count,
+                       unique_keys,
+                       unique_vals,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       descr_C->base);
+#undef CSRAMG_DIM
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRAMG_HPP
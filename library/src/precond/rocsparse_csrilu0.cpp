@@ -75,6 +75,54 @@ extern "C" rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle
                                         buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_scsrilu0_buffer_size_batched(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   rocsparse_int    nnz,
+                                                                   const rocsparse_mat_descr descr,
+                                                                   const float* csr_val,
+                                                                   const rocsparse_int* csr_row_ptr,
+                                                                   const rocsparse_int* csr_col_ind,
+                                                                   rocsparse_mat_info   info,
+                                                                   rocsparse_int        batch_count,
+                                                                   size_t*              buffer_size)
+{
+    return rocsparse_scsrsv_buffer_size_batched(handle,
+                                                rocsparse_operation_none,
+                                                m,
+                                                nnz,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                info,
+                                                batch_count,
+                                                buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_buffer_size_batched(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   rocsparse_int    nnz,
+                                                                   const rocsparse_mat_descr descr,
+                                                                   const double* csr_val,
+                                                                   const rocsparse_int* csr_row_ptr,
+                                                                   const rocsparse_int* csr_col_ind,
+                                                                   rocsparse_mat_info   info,
+                                                                   rocsparse_int        batch_count,
+                                                                   size_t*              buffer_size)
+{
+    return rocsparse_dcsrsv_buffer_size_batched(handle,
+                                                rocsparse_operation_none,
+                                                m,
+                                                nnz,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                info,
+                                                batch_count,
+                                                buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
                                                         rocsparse_int             m,
                                                         rocsparse_int             nnz,
@@ -185,6 +233,60 @@ extern "C" rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_scsrilu0_batched(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       float*                    csr_val,
+                                                       rocsparse_int             batch_stride,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_int             batch_count,
+                                                       rocsparse_solve_policy    policy,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrilu0_batched_template<float>(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_val,
+                                                     batch_stride,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     info,
+                                                     batch_count,
+                                                     policy,
+                                                     temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_batched(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       double*                   csr_val,
+                                                       rocsparse_int             batch_stride,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_int             batch_count,
+                                                       rocsparse_solve_policy    policy,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrilu0_batched_template<double>(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      batch_stride,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      batch_count,
+                                                      policy,
+                                                      temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
                                                          rocsparse_mat_info info,
                                                          rocsparse_int*     position)
@@ -278,3 +380,169 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   hand
 
     return rocsparse_status_success;
 }
+
+// Context of an asynchronous zero pivot query, passed through
+// hipStreamAddCallback and released once the callback has been invoked
+struct rocsparse_zero_pivot_callback_data
+{
+    rocsparse_zero_pivot_callback callback;
+    void*                         user_data;
+    rocsparse_int                 pivot;
+};
+
+static void csrilu0_zero_pivot_callback_run(hipStream_t stream, hipError_t status, void* data)
+{
+    rocsparse_zero_pivot_callback_data* ctx
+        = reinterpret_cast<rocsparse_zero_pivot_callback_data*>(data);
+
+    // If no zero pivot is found, report -1
+    rocsparse_int pivot
+        = (ctx->pivot == std::numeric_limits<rocsparse_int>::max()) ? -1 : ctx->pivot;
+
+    ctx->callback(pivot, ctx->user_data);
+
+    delete ctx;
+}
+
+extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot_async(rocsparse_handle   handle,
+                                                               rocsparse_mat_info info,
+                                                               rocsparse_int*     position,
+                                                               rocsparse_zero_pivot_callback callback,
+                                                               void* user_data)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrilu0_zero_pivot_async",
+              (const void*&)info,
+              (const void*&)position,
+              (const void*&)callback,
+              (const void*&)user_data);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, always report -1.
+    if(info->csrilu0_info == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+
+        if(callback != nullptr)
+        {
+            rocsparse_zero_pivot_callback_data* ctx = new rocsparse_zero_pivot_callback_data;
+
+            ctx->callback  = callback;
+            ctx->user_data = user_data;
+            ctx->pivot     = std::numeric_limits<rocsparse_int>::max();
+
+            RETURN_IF_HIP_ERROR(
+                hipStreamAddCallback(stream, csrilu0_zero_pivot_callback_run, ctx, 0));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Write the pivot status to position on the device, without
+    // synchronizing the stream
+    hipLaunchKernelGGL(csrsv_zero_pivot_kernel,
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       info->csrilu0_info->zero_pivot,
+                       position);
+
+    if(callback != nullptr)
+    {
+        rocsparse_zero_pivot_callback_data* ctx = new rocsparse_zero_pivot_callback_data;
+
+        ctx->callback  = callback;
+        ctx->user_data = user_data;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&ctx->pivot,
+                                           info->csrilu0_info->zero_pivot,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(
+            hipStreamAddCallback(stream, csrilu0_zero_pivot_callback_run, ctx, 0));
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsrilu0_refactor(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        float*                    csr_lu,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        rocsparse_int             nsweeps)
+{
+    return rocsparse_csrilu0_refactor_template<float>(
+        handle, m, nnz, descr, csr_val, csr_lu, csr_row_ptr, csr_col_ind, info, nsweeps);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_refactor(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        double*                   csr_lu,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        rocsparse_int             nsweeps)
+{
+    return rocsparse_csrilu0_refactor_template<double>(
+        handle, m, nnz, descr, csr_val, csr_lu, csr_row_ptr, csr_col_ind, info, nsweeps);
+}
+
+extern "C" rocsparse_status rocsparse_scsrilu0_iterative(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              csr_val,
+                                                         float*                    csr_lu,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         rocsparse_int             nsweeps)
+{
+    return rocsparse_csrilu0_iterative_template<float>(
+        handle, m, nnz, descr, csr_val, csr_lu, csr_row_ptr, csr_col_ind, info, nsweeps);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_iterative(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             csr_val,
+                                                         double*                   csr_lu,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         rocsparse_int             nsweeps)
+{
+    return rocsparse_csrilu0_iterative_template<double>(
+        handle, m, nnz, descr, csr_val, csr_lu, csr_row_ptr, csr_col_ind, info, nsweeps);
+}
@@ -85,13 +85,14 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
     }
 
     // Check analysis policy
-    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force
+       && analysis != rocsparse_analysis_policy_shared)
     {
         return rocsparse_status_invalid_value;
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(solve != rocsparse_solve_policy_auto && solve != rocsparse_solve_policy_level)
     {
         return rocsparse_status_invalid_value;
     }
@@ -152,6 +153,12 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
             reuse = info->csrsv_lower_info;
         }
 
+        // csric0 meta data
+        if(reuse == nullptr && info->csric0_info != nullptr)
+        {
+            reuse = info->csric0_info;
+        }
+
         // TODO add more crossover data here
 
         // If data has been found, use it
@@ -166,6 +173,17 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
     // User is explicitly asking to force a re-analysis, or no valid data has been
     // found to be re-used.
 
+    // Uncouple shared meta data
+    if(info->csrsv_lower_info == info->csrilu0_info)
+    {
+        info->csrsv_lower_info = nullptr;
+    }
+
+    if(info->csric0_info == info->csrilu0_info)
+    {
+        info->csric0_info = nullptr;
+    }
+
     // Clear csrilu0 info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
 
@@ -180,122 +198,65 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
                                                        descr,
                                                        csr_row_ptr,
                                                        csr_col_ind,
+                                                       rocsparse_fill_mode_lower,
                                                        info->csrilu0_info,
                                                        temp_buffer));
 
-    return rocsparse_status_success;
-}
-
-template <typename T>
-rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            T*                        csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_solve_policy    policy,
-                                            void*                     temp_buffer)
-{
-    // Check for valid handle and matrix descriptor
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-    else if(descr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Logging
-    log_trace(handle,
-              replaceX<T>("rocsparse_Xcsrilu0"),
-              m,
-              nnz,
-              (const void*&)descr,
-              (const void*&)csr_val,
-              (const void*&)csr_row_ptr,
-              (const void*&)csr_col_ind,
-              (const void*&)info,
-              policy,
-              (const void*&)temp_buffer);
-
-    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
-
-    // Check index base
-    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
-    {
-        return rocsparse_status_invalid_value;
-    }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
-
-    // Check sizes
-    if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(nnz < 0)
+    // If requested, share the gathered meta data with the triangular solvers,
+    // such that subsequent csrsv analysis calls on the same pattern become a
+    // no-op when called with the 'reuse' policy. This saves two additional
+    // analysis passes in e.g. an ILU0 preconditioned CG pipeline.
+    if(analysis == rocsparse_analysis_policy_shared)
     {
-        return rocsparse_status_invalid_size;
-    }
+        // The lower triangular solve can directly re-use the csrilu0 meta data
+        if(info->csrsv_lower_info != info->csrilu0_info)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+            info->csrsv_lower_info = info->csrilu0_info;
+        }
 
-    // Quick return if possible
-    if(m == 0 || nnz == 0)
-    {
-        return rocsparse_status_success;
-    }
+        // The upper triangular solve requires its own analysis of the pattern
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrsv_upper_info));
 
-    // Check pointer arguments
-    if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_col_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(temp_buffer == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
+                                                           rocsparse_operation_none,
+                                                           m,
+                                                           nnz,
+                                                           descr,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           rocsparse_fill_mode_upper,
+                                                           info->csrsv_upper_info,
+                                                           temp_buffer));
     }
 
-    // Check for analysis call
-    if(info->csrilu0_info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
+    return rocsparse_status_success;
+}
 
+template <typename T>
+static rocsparse_status rocsparse_csrilu0_launch(rocsparse_handle     handle,
+                                                 rocsparse_int        nrows,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 T*                   csr_val,
+                                                 rocsparse_int        batch_stride,
+                                                 const rocsparse_int* csr_diag_ind,
+                                                 int*                 done_array,
+                                                 rocsparse_int        done_stride,
+                                                 const rocsparse_int* map,
+                                                 rocsparse_int        batch_count,
+                                                 rocsparse_int*       zero_pivot,
+                                                 rocsparse_index_base idx_base,
+                                                 rocsparse_int        max_nnz)
+{
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Buffer
-    char* ptr = reinterpret_cast<char*>(temp_buffer);
-    ptr += 256;
-
-    // done array
-    int* d_done_array = reinterpret_cast<int*>(ptr);
-
-    // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
-
-    // Max nnz per row
-    rocsparse_int max_nnz = info->csrilu0_info->max_nnz;
-
+// The batch dimension is mapped to the second grid dimension, such that all
+// matrices of the batch are processed concurrently across the workgroups
 #define CSRILU0_DIM 256
-    dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1);
+    dim3 csrilu0_blocks((nrows * handle->wavefront_size - 1) / CSRILU0_DIM + 1, batch_count);
     dim3 csrilu0_threads(CSRILU0_DIM);
 
     if(handle->wavefront_size == 32)
@@ -307,15 +268,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 64)
         {
@@ -324,15 +287,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 128)
         {
@@ -341,15 +306,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 256)
         {
@@ -358,15 +325,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 512)
         {
@@ -375,15 +344,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else
         {
@@ -392,15 +363,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
     }
     else if(handle->wavefront_size == 64)
@@ -412,15 +385,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 128)
         {
@@ -429,15 +404,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 256)
         {
@@ -446,15 +423,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 512)
         {
@@ -463,15 +442,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else if(max_nnz <= 1024)
         {
@@ -480,15 +461,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
         else
         {
@@ -497,15 +480,17 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                csrilu0_threads,
                                0,
                                stream,
-                               m,
+                               nrows,
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
-                               info->csrilu0_info->csr_diag_ind,
-                               d_done_array,
-                               info->csrilu0_info->row_map,
-                               info->csrilu0_info->zero_pivot,
-                               descr->base);
+                               batch_stride,
+                               csr_diag_ind,
+                               done_array,
+                               done_stride,
+                               map,
+                               zero_pivot,
+                               idx_base);
         }
     }
     else
@@ -517,4 +502,632 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_level)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+
+    // Max nnz per row
+    rocsparse_int max_nnz = info->csrilu0_info->max_nnz;
+
+    // Level based solve policy, process the rows level by level such that all
+    // dependencies of a row have been resolved by previous kernel launches
+    // and the per-row spin loops complete on their first iteration. This can
+    // be beneficial for matrices with long dependency chains. If no level
+    // meta data is available, fall back to the single kernel launch.
+    if(policy == rocsparse_solve_policy_level && info->csrilu0_info->nlevels > 0)
+    {
+        for(rocsparse_int level = 0; level < info->csrilu0_info->nlevels; ++level)
+        {
+            rocsparse_int offset = info->csrilu0_info->level_ptr[level];
+            rocsparse_int nrows  = info->csrilu0_info->level_ptr[level + 1] - offset;
+
+            // Skip empty levels
+            if(nrows == 0)
+            {
+                continue;
+            }
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_csrilu0_launch<T>(handle,
+                                            nrows,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            0,
+                                            info->csrilu0_info->csr_diag_ind,
+                                            d_done_array,
+                                            0,
+                                            info->csrilu0_info->row_map + offset,
+                                            1,
+                                            info->csrilu0_info->zero_pivot,
+                                            descr->base,
+                                            max_nnz));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilu0_launch<T>(handle,
+                                                          m,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          csr_val,
+                                                          0,
+                                                          info->csrilu0_info->csr_diag_ind,
+                                                          d_done_array,
+                                                          0,
+                                                          info->csrilu0_info->row_map,
+                                                          1,
+                                                          info->csrilu0_info->zero_pivot,
+                                                          descr->base,
+                                                          max_nnz));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_refactor_template(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     T*                        csr_lu,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_mat_info        info,
+                                                     rocsparse_int             nsweeps)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_refactor"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_lu,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              nsweeps);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nsweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || nsweeps == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Re-initialize the zero pivot, the new values may have resolved a
+    // numerical pivot reported by a previous factorization
+    hipLaunchKernelGGL((csrsv_reset_zero_pivot_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       info->csrilu0_info->zero_pivot);
+
+#define CSRILU0_DIM 256
+    dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1);
+    dim3 csrilu0_threads(CSRILU0_DIM);
+
+    // Fixed-point sweeps on the factorization, warm-started from the factor
+    // values passed in csr_lu. No dependencies are resolved, each sweep
+    // consumes the current factor approximation. Processing the rows in the
+    // dependency ordering of the analysis meta data maximizes the number of
+    // updated values a sweep consumes, as rows scheduled to earlier
+    // wavefronts tend to complete first.
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrilu0_sweep_kernel<T, CSRILU0_DIM, 32>),
+                               csrilu0_blocks,
+                               csrilu0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csr_lu,
+                               info->csrilu0_info->csr_diag_ind,
+                               info->csrilu0_info->row_map,
+                               info->csrilu0_info->zero_pivot,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrilu0_sweep_kernel<T, CSRILU0_DIM, 64>),
+                               csrilu0_blocks,
+                               csrilu0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csr_lu,
+                               info->csrilu0_info->csr_diag_ind,
+                               info->csrilu0_info->row_map,
+                               info->csrilu0_info->zero_pivot,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRILU0_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_iterative_template(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  csr_val,
+                                                      T*                        csr_lu,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_int             nsweeps)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_iterative"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_lu,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              nsweeps);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nsweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Re-initialize the zero pivot
+    hipLaunchKernelGGL((csrsv_reset_zero_pivot_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       info->csrilu0_info->zero_pivot);
+
+// The kernels process one non-zero entry per thread and do not depend on
+// the wavefront size
+#define CSRILU0_DIM 256
+    dim3 csrilu0_blocks((nnz - 1) / CSRILU0_DIM + 1);
+    dim3 csrilu0_threads(CSRILU0_DIM);
+
+    // Initial guess, the matrix values with the lower triangular part scaled
+    // by the diagonal
+    hipLaunchKernelGGL((csrilu0_iterative_init_kernel<T, CSRILU0_DIM>),
+                       csrilu0_blocks,
+                       csrilu0_threads,
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csr_lu,
+                       info->csrilu0_info->csr_diag_ind,
+                       info->csrilu0_info->zero_pivot,
+                       descr->base);
+
+    // Fixed-point sweeps on the factorization. No dependencies are resolved,
+    // all entries of the factors are recomputed concurrently from the current
+    // approximation
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        hipLaunchKernelGGL((csrilu0_iterative_sweep_kernel<T, CSRILU0_DIM>),
+                           csrilu0_blocks,
+                           csrilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           nnz,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           csr_lu,
+                           info->csrilu0_info->csr_diag_ind,
+                           info->csrilu0_info->zero_pivot,
+                           descr->base);
+    }
+#undef CSRILU0_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_batched_template(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    T*                        csr_val,
+                                                    rocsparse_int             batch_stride,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    rocsparse_int             batch_count,
+                                                    rocsparse_solve_policy    policy,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_batched"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              batch_stride,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              batch_count,
+              policy,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy, the batched routine processes all matrices
+    // concurrently and does not support level scheduling
+    if(policy != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_stride < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array, one set of flags per matrix of the batch
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m * batch_count, stream));
+
+    // Max nnz per row
+    rocsparse_int max_nnz = info->csrilu0_info->max_nnz;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilu0_launch<T>(handle,
+                                                          m,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          csr_val,
+                                                          batch_stride,
+                                                          info->csrilu0_info->csr_diag_ind,
+                                                          d_done_array,
+                                                          m,
+                                                          info->csrilu0_info->row_map,
+                                                          batch_count,
+                                                          info->csrilu0_info->zero_pivot,
+                                                          descr->base,
+                                                          max_nnz));
+
+    return rocsparse_status_success;
+}
+
 #endif // ROCSPARSE_CSRILU0_HPP
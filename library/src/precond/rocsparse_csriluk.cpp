@@ -0,0 +1,516 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csriluk.hpp"
+#include "definitions.h"
+#include "rocsparse.h"
+
+#include <limits>
+#include <map>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsriluk_buffer_size(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const float*              csr_val,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           rocsparse_mat_info        info,
+                                                           size_t*                   buffer_size)
+{
+    return rocsparse_scsrsv_buffer_size(handle,
+                                        rocsparse_operation_none,
+                                        m,
+                                        nnz,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsriluk_buffer_size(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const double*             csr_val,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           rocsparse_mat_info        info,
+                                                           size_t*                   buffer_size)
+{
+    return rocsparse_dcsrsv_buffer_size(handle,
+                                        rocsparse_operation_none,
+                                        m,
+                                        nnz,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  rocsparse_int             level,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  rocsparse_int*            iluk_row_ptr,
+                                                  rocsparse_int*            iluk_nnz,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_nnz",
+              m,
+              nnz,
+              level,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)iluk_row_ptr,
+              (const void*&)iluk_nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(level < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(iluk_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *iluk_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(iluk_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(iluk_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Differentiate the analysis policies
+    if(info->csriluk_info != nullptr)
+    {
+        // Clear csriluk info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    }
+
+    // Create csriluk info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csriluk_info(&info->csriluk_info));
+
+    // Copy the matrix pattern to the host
+    std::vector<rocsparse_int> hptr(m + 1);
+    std::vector<rocsparse_int> hcol(nnz);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hptr.data(),
+                                       csr_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hcol.data(), csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Symbolic factorization by rows. For each row, the patterns of all
+    // dependency rows are merged, keeping track of the fill level of each
+    // entry. An entry that is generated by eliminating entry (i,k) against
+    // entry (k,j) obtains the level lev(i,k) + lev(k,j) + 1 and is kept, if
+    // its level does not exceed the requested fill level. Entries of the
+    // input matrix have level zero.
+    std::vector<std::vector<std::pair<rocsparse_int, rocsparse_int>>> urow(m);
+
+    std::vector<rocsparse_int> iptr(m + 1);
+    std::vector<rocsparse_int> icol;
+    icol.reserve(nnz);
+
+    iptr[0] = descr->base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // Working row, mapping column index to fill level
+        std::map<rocsparse_int, rocsparse_int> w;
+
+        rocsparse_int row_begin = hptr[i] - descr->base;
+        rocsparse_int row_end   = hptr[i + 1] - descr->base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            w[hcol[j] - descr->base] = 0;
+        }
+
+        // Eliminate dependency rows in ascending order. Inserted fill-in
+        // entries with column index larger than the current dependency are
+        // processed in subsequent iterations, std::map iterators remain
+        // valid on insertion.
+        for(auto it = w.begin(); it != w.end() && it->first < i; ++it)
+        {
+            rocsparse_int k     = it->first;
+            rocsparse_int lev_k = it->second;
+
+            for(auto& u : urow[k])
+            {
+                rocsparse_int lev = lev_k + u.second + 1;
+
+                if(lev > level)
+                {
+                    continue;
+                }
+
+                auto pos = w.find(u.first);
+                if(pos == w.end())
+                {
+                    w[u.first] = lev;
+                }
+                else if(lev < pos->second)
+                {
+                    pos->second = lev;
+                }
+            }
+        }
+
+        // Assemble row i of the factorization pattern and keep its upper
+        // triangular part for the elimination of subsequent rows
+        for(auto& entry : w)
+        {
+            icol.push_back(entry.first + descr->base);
+
+            if(entry.first > i)
+            {
+                urow[i].push_back(entry);
+            }
+        }
+
+        iptr[i + 1] = static_cast<rocsparse_int>(icol.size()) + descr->base;
+    }
+
+    rocsparse_int nnz_iluk = static_cast<rocsparse_int>(icol.size());
+
+    // Store the factorization pattern
+    info->csriluk_info->level = level;
+    info->csriluk_info->nnz   = nnz_iluk;
+    info->csriluk_info->m     = m;
+    info->csriluk_info->descr = descr;
+
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->csriluk_info->row_ptr, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->csriluk_info->col_ind, sizeof(rocsparse_int) * nnz_iluk));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csriluk_info->row_ptr,
+                                       iptr.data(),
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csriluk_info->col_ind,
+                                       icol.data(),
+                                       sizeof(rocsparse_int) * nnz_iluk,
+                                       hipMemcpyHostToDevice,
+                                       stream));
+
+    // Write the row pointers of the factorization pattern to the user array
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(iluk_row_ptr,
+                                       iptr.data(),
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyHostToDevice,
+                                       stream));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            iluk_nnz, &nnz_iluk, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+    }
+    else
+    {
+        *iluk_nnz = nnz_iluk;
+    }
+
+    // Wait for host arrays to be copied, before they go out of scope
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Create the dependency meta data for the numerical factorization
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csriluk_info->csrtr_info));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       nnz_iluk,
+                                                       descr,
+                                                       info->csriluk_info->row_ptr,
+                                                       info->csriluk_info->col_ind,
+                                                       rocsparse_fill_mode_lower,
+                                                       info->csriluk_info->csrtr_info,
+                                                       temp_buffer));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_clear(rocsparse_handle   handle,
+                                                    rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               float*                    iluk_val,
+                                               const rocsparse_int*      iluk_row_ptr,
+                                               rocsparse_int*            iluk_col_ind,
+                                               rocsparse_solve_policy    policy,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csriluk_template<float>(handle,
+                                             m,
+                                             nnz,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             info,
+                                             iluk_val,
+                                             iluk_row_ptr,
+                                             iluk_col_ind,
+                                             policy,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               double*                   iluk_val,
+                                               const rocsparse_int*      iluk_row_ptr,
+                                               rocsparse_int*            iluk_col_ind,
+                                               rocsparse_solve_policy    policy,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csriluk_template<double>(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              iluk_val,
+                                              iluk_row_ptr,
+                                              iluk_col_ind,
+                                              policy,
+                                              temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_zero_pivot(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csriluk_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info->csriluk_info == nullptr || info->csriluk_info->csrtr_info == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&pivot,
+                                           info->csriluk_info->csrtr_info->zero_pivot,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->csriluk_info->csrtr_info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(hipMemcpy(position,
+                                      info->csriluk_info->csrtr_info->zero_pivot,
+                                      sizeof(rocsparse_int),
+                                      hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
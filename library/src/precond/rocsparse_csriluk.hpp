@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRILUK_HPP
+#define ROCSPARSE_CSRILUK_HPP
+
+#include "csriluk_device.h"
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_csrilu0.hpp"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csriluk_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            T*                        iluk_val,
+                                            const rocsparse_int*      iluk_row_ptr,
+                                            rocsparse_int*            iluk_col_ind,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)iluk_val,
+              (const void*&)iluk_row_ptr,
+              (const void*&)iluk_col_ind,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csriluk -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_level)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(iluk_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(iluk_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(iluk_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for csriluk_nnz call
+    if(info->csriluk_info == nullptr || info->csriluk_info->csrtr_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+
+    // Copy the factorization pattern column indices to the user array
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(iluk_col_ind,
+                                       info->csriluk_info->col_ind,
+                                       sizeof(rocsparse_int) * info->csriluk_info->nnz,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+#define CSRILUK_DIM 256
+    dim3 csriluk_blocks((m - 1) / CSRILUK_DIM + 1);
+    dim3 csriluk_threads(CSRILUK_DIM);
+
+    // Scatter the input matrix into the factorization pattern, initializing
+    // fill-in positions with zero
+    hipLaunchKernelGGL((csriluk_scatter_kernel<T, CSRILUK_DIM>),
+                       csriluk_blocks,
+                       csriluk_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       info->csriluk_info->row_ptr,
+                       info->csriluk_info->col_ind,
+                       iluk_val,
+                       descr->base);
+#undef CSRILUK_DIM
+
+    // Meta data of the factorization pattern
+    rocsparse_csrtr_info csrtr_info = info->csriluk_info->csrtr_info;
+
+    // Max nnz per row of the factorization pattern
+    rocsparse_int max_nnz = csrtr_info->max_nnz;
+
+    // Level based solve policy, see rocsparse_csrilu0_template
+    if(policy == rocsparse_solve_policy_level && csrtr_info->nlevels > 0)
+    {
+        for(rocsparse_int level = 0; level < csrtr_info->nlevels; ++level)
+        {
+            rocsparse_int offset = csrtr_info->level_ptr[level];
+            rocsparse_int nrows  = csrtr_info->level_ptr[level + 1] - offset;
+
+            // Skip empty levels
+            if(nrows == 0)
+            {
+                continue;
+            }
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilu0_launch<T>(handle,
+                                                                  nrows,
+                                                                  info->csriluk_info->row_ptr,
+                                                                  info->csriluk_info->col_ind,
+                                                                  iluk_val,
+                                                                  0,
+                                                                  csrtr_info->csr_diag_ind,
+                                                                  d_done_array,
+                                                                  0,
+                                                                  csrtr_info->row_map + offset,
+                                                                  1,
+                                                                  csrtr_info->zero_pivot,
+                                                                  descr->base,
+                                                                  max_nnz));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilu0_launch<T>(handle,
+                                                          m,
+                                                          info->csriluk_info->row_ptr,
+                                                          info->csriluk_info->col_ind,
+                                                          iluk_val,
+                                                          0,
+                                                          csrtr_info->csr_diag_ind,
+                                                          d_done_array,
+                                                          0,
+                                                          csrtr_info->row_map,
+                                                          1,
+                                                          csrtr_info->zero_pivot,
+                                                          descr->base,
+                                                          max_nnz));
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRILUK_HPP
@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrilut.hpp"
+#include "definitions.h"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrilut_nnz(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float*              csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const float*              tol,
+                                                   rocsparse_int             max_fill,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int*            ilut_row_ptr,
+                                                   rocsparse_int*            ilut_nnz)
+{
+    return rocsparse_csrilut_nnz_template<float>(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 tol,
+                                                 max_fill,
+                                                 info,
+                                                 ilut_row_ptr,
+                                                 ilut_nnz);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilut_nnz(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double*             csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const double*             tol,
+                                                   rocsparse_int             max_fill,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int*            ilut_row_ptr,
+                                                   rocsparse_int*            ilut_nnz)
+{
+    return rocsparse_csrilut_nnz_template<double>(handle,
+                                                  m,
+                                                  nnz,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  tol,
+                                                  max_fill,
+                                                  info,
+                                                  ilut_row_ptr,
+                                                  ilut_nnz);
+}
+
+extern "C" rocsparse_status rocsparse_scsrilut(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               const rocsparse_mat_descr descr,
+                                               rocsparse_mat_info        info,
+                                               float*                    ilut_val,
+                                               const rocsparse_int*      ilut_row_ptr,
+                                               rocsparse_int*            ilut_col_ind)
+{
+    return rocsparse_csrilut_template<float>(
+        handle, m, descr, info, ilut_val, ilut_row_ptr, ilut_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilut(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               const rocsparse_mat_descr descr,
+                                               rocsparse_mat_info        info,
+                                               double*                   ilut_val,
+                                               const rocsparse_int*      ilut_row_ptr,
+                                               rocsparse_int*            ilut_col_ind)
+{
+    return rocsparse_csrilut_template<double>(
+        handle, m, descr, info, ilut_val, ilut_row_ptr, ilut_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_csrilut_clear(rocsparse_handle   handle,
+                                                    rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilut_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrilut_info(info->csrilut_info));
+    info->csrilut_info = nullptr;
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,487 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRILUT_HPP
+#define ROCSPARSE_CSRILUT_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <map>
+#include <vector>
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_nnz_template(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  tol,
+                                                rocsparse_int             max_fill,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_int*            ilut_row_ptr,
+                                                rocsparse_int*            ilut_nnz)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_nnz"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)tol,
+              max_fill,
+              (const void*&)info,
+              (const void*&)ilut_row_ptr,
+              (const void*&)ilut_nnz);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(max_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(ilut_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *ilut_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(tol == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ilut_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ilut_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Read drop tolerance
+    T h_tol;
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(&h_tol, tol, sizeof(T), hipMemcpyDeviceToHost));
+    }
+    else
+    {
+        h_tol = *tol;
+    }
+
+    // Check drop tolerance
+    if(h_tol < static_cast<T>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Clear previously computed factorization
+    if(info->csrilut_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrilut_info(info->csrilut_info));
+    }
+
+    // Create csrilut info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrilut_info(&info->csrilut_info));
+
+    // Copy the matrix to the host
+    std::vector<rocsparse_int> hptr(m + 1);
+    std::vector<rocsparse_int> hcol(nnz);
+    std::vector<T>             hval(nnz);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hptr.data(),
+                                       csr_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hcol.data(), csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(hval.data(), csr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Incomplete LU factorization with threshold based dropping by rows.
+    // Eliminated entries are dropped, if their magnitude falls below the
+    // drop tolerance, relative to the norm of the current row. Of the
+    // remaining entries, at most max_fill entries are kept in the strictly
+    // lower and the strictly upper triangular part of each row, the
+    // diagonal entry is always kept.
+    std::vector<std::vector<std::pair<rocsparse_int, T>>> upart(m);
+    std::vector<T>                                        diag(m);
+
+    std::vector<std::vector<std::pair<rocsparse_int, T>>> lpart(m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // Working row, mapping column index to value
+        std::map<rocsparse_int, T> w;
+
+        rocsparse_int row_begin = hptr[i] - descr->base;
+        rocsparse_int row_end   = hptr[i + 1] - descr->base;
+
+        double row_norm = 0.0;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            w[hcol[j] - descr->base] = hval[j];
+            row_norm += hval[j] * hval[j];
+        }
+
+        // Relative drop threshold of the current row
+        T threshold = h_tol * static_cast<T>(std::sqrt(row_norm));
+
+        // Eliminate dependency rows in ascending order. Fill-in entries with
+        // column index larger than the current dependency are processed in
+        // subsequent iterations, std::map iterators remain valid on
+        // insertion.
+        for(auto it = w.begin(); it != w.end() && it->first < i; ++it)
+        {
+            rocsparse_int k = it->first;
+
+            T w_k = it->second / diag[k];
+
+            // Drop small entries immediately, they do not contribute to the
+            // factorization
+            if(std::abs(w_k) < threshold)
+            {
+                it->second = static_cast<T>(0);
+                continue;
+            }
+
+            it->second = w_k;
+
+            for(auto& u : upart[k])
+            {
+                w[u.first] -= w_k * u.second;
+            }
+        }
+
+        // Split the working row into lower part, diagonal and upper part,
+        // dropping entries below the threshold
+        std::vector<std::pair<rocsparse_int, T>>& lrow = lpart[i];
+        std::vector<std::pair<rocsparse_int, T>>& urow = upart[i];
+
+        T    diag_val = static_cast<T>(0);
+        bool has_diag = false;
+
+        for(auto& entry : w)
+        {
+            if(entry.first == i)
+            {
+                diag_val = entry.second;
+                has_diag = true;
+            }
+            else if(std::abs(entry.second) >= threshold && entry.second != static_cast<T>(0))
+            {
+                if(entry.first < i)
+                {
+                    lrow.push_back(entry);
+                }
+                else
+                {
+                    urow.push_back(entry);
+                }
+            }
+        }
+
+        // Check for structural or numerical zero pivot
+        if(!has_diag || diag_val == static_cast<T>(0))
+        {
+            return rocsparse_status_zero_pivot;
+        }
+
+        diag[i] = diag_val;
+
+        // Keep only the max_fill largest entries in each part, by magnitude
+        auto larger = [](const std::pair<rocsparse_int, T>& lhs,
+                         const std::pair<rocsparse_int, T>& rhs) {
+            return std::abs(lhs.second) > std::abs(rhs.second);
+        };
+        auto by_col = [](const std::pair<rocsparse_int, T>& lhs,
+                         const std::pair<rocsparse_int, T>& rhs) {
+            return lhs.first < rhs.first;
+        };
+
+        if(static_cast<rocsparse_int>(lrow.size()) > max_fill)
+        {
+            std::partial_sort(lrow.begin(), lrow.begin() + max_fill, lrow.end(), larger);
+            lrow.resize(max_fill);
+            std::sort(lrow.begin(), lrow.end(), by_col);
+        }
+
+        if(static_cast<rocsparse_int>(urow.size()) > max_fill)
+        {
+            std::partial_sort(urow.begin(), urow.begin() + max_fill, urow.end(), larger);
+            urow.resize(max_fill);
+            std::sort(urow.begin(), urow.end(), by_col);
+        }
+    }
+
+    // Assemble the factorization in CSR format
+    std::vector<rocsparse_int> iptr(m + 1);
+    std::vector<rocsparse_int> icol;
+    std::vector<T>             ival;
+
+    icol.reserve(nnz);
+    ival.reserve(nnz);
+
+    iptr[0] = descr->base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(auto& entry : lpart[i])
+        {
+            icol.push_back(entry.first + descr->base);
+            ival.push_back(entry.second);
+        }
+
+        icol.push_back(i + descr->base);
+        ival.push_back(diag[i]);
+
+        for(auto& entry : upart[i])
+        {
+            icol.push_back(entry.first + descr->base);
+            ival.push_back(entry.second);
+        }
+
+        iptr[i + 1] = static_cast<rocsparse_int>(icol.size()) + descr->base;
+    }
+
+    rocsparse_int nnz_ilut = static_cast<rocsparse_int>(icol.size());
+
+    // Store the factorization
+    info->csrilut_info->nnz   = nnz_ilut;
+    info->csrilut_info->m     = m;
+    info->csrilut_info->descr = descr;
+
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->csrilut_info->row_ptr, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->csrilut_info->col_ind, sizeof(rocsparse_int) * nnz_ilut));
+    RETURN_IF_HIP_ERROR(hipMalloc(&info->csrilut_info->val, sizeof(T) * nnz_ilut));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrilut_info->row_ptr,
+                                       iptr.data(),
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrilut_info->col_ind,
+                                       icol.data(),
+                                       sizeof(rocsparse_int) * nnz_ilut,
+                                       hipMemcpyHostToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrilut_info->val,
+                                       ival.data(),
+                                       sizeof(T) * nnz_ilut,
+                                       hipMemcpyHostToDevice,
+                                       stream));
+
+    // Write the row pointers of the factorization to the user array
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(ilut_row_ptr,
+                                       iptr.data(),
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyHostToDevice,
+                                       stream));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            ilut_nnz, &nnz_ilut, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+    }
+    else
+    {
+        *ilut_nnz = nnz_ilut;
+    }
+
+    // Wait for host arrays to be copied, before they go out of scope
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            T*                        ilut_val,
+                                            const rocsparse_int*      ilut_row_ptr,
+                                            rocsparse_int*            ilut_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut"),
+              m,
+              (const void*&)descr,
+              (const void*&)info,
+              (const void*&)ilut_val,
+              (const void*&)ilut_row_ptr,
+              (const void*&)ilut_col_ind);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(ilut_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ilut_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ilut_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for csrilut_nnz call
+    if(info->csrilut_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Copy the factorization to the user arrays
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(ilut_col_ind,
+                                       info->csrilut_info->col_ind,
+                                       sizeof(rocsparse_int) * info->csrilut_info->nnz,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(ilut_val,
+                                       info->csrilut_info->val,
+                                       sizeof(T) * info->csrilut_info->nnz,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRILUT_HPP
@@ -0,0 +1,208 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRISAI_HPP
+#define ROCSPARSE_CSRISAI_HPP
+
+#include "../level2/csrsv_device.h"
+#include "csrisai_device.h"
+#include "definitions.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <limits>
+
+template <typename T>
+__global__ void csrisai_lower_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     T* __restrict__ isai_val,
+                                     rocsparse_diag_type diag_type,
+                                     rocsparse_int* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base)
+{
+    csrisai_lower_device<T>(
+        m, csr_row_ptr, csr_col_ind, csr_val, isai_val, diag_type, zero_pivot, idx_base);
+}
+
+template <typename T>
+__global__ void csrisai_upper_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     T* __restrict__ isai_val,
+                                     rocsparse_diag_type diag_type,
+                                     rocsparse_int* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base)
+{
+    csrisai_upper_device<T>(
+        m, csr_row_ptr, csr_col_ind, csr_val, isai_val, diag_type, zero_pivot, idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrisai_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            T*                        isai_val)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrisai"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)isai_val);
+
+    log_bench(handle, "./rocsparse-bench -f csrisai -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(isai_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Zero pivot tracker
+    rocsparse_int* d_zero_pivot;
+    RETURN_IF_ROCSPARSE_ERROR(
+        handle->buffer_alloc(sizeof(rocsparse_int), (void**)&d_zero_pivot));
+
+    hipLaunchKernelGGL((csrsv_reset_zero_pivot_kernel), dim3(1), dim3(1), 0, stream, d_zero_pivot);
+
+// One small dense triangular solve per row, rows are independent of each
+// other
+#define CSRISAI_DIM 256
+    dim3 csrisai_blocks((m - 1) / CSRISAI_DIM + 1);
+    dim3 csrisai_threads(CSRISAI_DIM);
+
+    if(descr->fill_mode == rocsparse_fill_mode_lower)
+    {
+        hipLaunchKernelGGL((csrisai_lower_kernel<T>),
+                           csrisai_blocks,
+                           csrisai_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           isai_val,
+                           descr->diag_type,
+                           d_zero_pivot,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrisai_upper_kernel<T>),
+                           csrisai_blocks,
+                           csrisai_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           isai_val,
+                           descr->diag_type,
+                           d_zero_pivot,
+                           descr->base);
+    }
+#undef CSRISAI_DIM
+
+    // Check for zero pivots, this synchronizes with the host
+    rocsparse_int zero_pivot;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&zero_pivot, d_zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->buffer_free(d_zero_pivot));
+
+    if(zero_pivot != std::numeric_limits<rocsparse_int>::max())
+    {
+        return rocsparse_status_zero_pivot;
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRISAI_HPP
@@ -27,6 +27,8 @@
 #include "utility.h"
 
 #include <hip/hip_runtime_api.h>
+#include <cstring>
+#include <limits>
 
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
@@ -114,6 +116,37 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle, rocsparse_p
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Indicates whether atomic updates may be used by compute kernels.
+ * Set atomics mode, can be allowed or not allowed
+ *******************************************************************************/
+rocsparse_status rocsparse_set_atomics_mode(rocsparse_handle handle, rocsparse_atomics_mode mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    handle->atomics_mode = mode;
+    log_trace(handle, "rocsparse_set_atomics_mode", mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get atomics mode, can be allowed or not allowed.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_atomics_mode(rocsparse_handle handle, rocsparse_atomics_mode* mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    *mode = handle->atomics_mode;
+    log_trace(handle, "rocsparse_get_atomics_mode", *mode);
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -164,6 +197,129 @@ rocsparse_status rocsparse_get_version(rocsparse_handle handle, int* version)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Snapshot the per-routine profiling table.
+ *******************************************************************************/
+rocsparse_status rocsparse_profile_snapshot(rocsparse_handle         handle,
+                                            rocsparse_int*           num_entries,
+                                            rocsparse_profile_entry* entries)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(num_entries == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    log_trace(handle, "rocsparse_profile_snapshot", *num_entries, (const void*&)entries);
+
+    std::lock_guard<std::mutex> lock(handle->profile_mutex);
+
+    // Query for the table size
+    if(entries == nullptr)
+    {
+        *num_entries = static_cast<rocsparse_int>(handle->profile_table.size());
+
+        return rocsparse_status_success;
+    }
+
+    rocsparse_int n = 0;
+
+    for(auto it = handle->profile_table.begin();
+        it != handle->profile_table.end() && n < *num_entries;
+        ++it, ++n)
+    {
+        rocsparse_profile_entry& entry = entries[n];
+
+        strncpy(entry.name, it->first.c_str(), sizeof(entry.name) - 1);
+        entry.name[sizeof(entry.name) - 1] = '\0';
+
+        entry.calls   = it->second.calls;
+        entry.time_ms = it->second.time_ms;
+        entry.bytes   = it->second.bytes;
+        entry.bandwidth
+            = (it->second.time_ms > 0.0) ? it->second.bytes / it->second.time_ms * 1e-6 : 0.0;
+    }
+
+    *num_entries = n;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Reset the per-routine profiling table.
+ *******************************************************************************/
+rocsparse_status rocsparse_profile_reset(rocsparse_handle handle)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_profile_reset");
+
+    std::lock_guard<std::mutex> lock(handle->profile_mutex);
+
+    handle->profile_table.clear();
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Snapshot the temporary device memory accounting of the handle.
+ *******************************************************************************/
+rocsparse_status rocsparse_memory_snapshot(rocsparse_handle handle,
+                                           size_t*          in_use,
+                                           size_t*          peak,
+                                           size_t*          buffer_size)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(in_use == nullptr || peak == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    log_trace(handle,
+              "rocsparse_memory_snapshot",
+              (const void*&)in_use,
+              (const void*&)peak,
+              (const void*&)buffer_size);
+
+    *in_use      = handle->temp_in_use;
+    *peak        = handle->temp_peak;
+    *buffer_size = handle->buffer_size;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Reset the temporary device memory peak of the handle.
+ *******************************************************************************/
+rocsparse_status rocsparse_memory_reset(rocsparse_handle handle)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_memory_reset");
+
+    handle->temp_peak = handle->temp_in_use;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief Get rocSPARSE git revision
  *******************************************************************************/
@@ -371,6 +527,70 @@ rocsparse_diag_type rocsparse_get_mat_diag_type(const rocsparse_mat_descr descr)
     return descr->diag_type;
 }
 
+rocsparse_status rocsparse_set_mat_row_range(rocsparse_mat_descr descr,
+                                             rocsparse_int       row_begin,
+                                             rocsparse_int       row_end)
+{
+    // Check if descriptor is valid
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // A negative row_end clears the view
+    if(row_end < 0)
+    {
+        descr->row_range_begin = 0;
+        descr->row_range_end   = -1;
+        return rocsparse_status_success;
+    }
+
+    if(row_begin < 0 || row_end < row_begin)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->row_range_begin = row_begin;
+    descr->row_range_end   = row_end;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_get_mat_row_range(const rocsparse_mat_descr descr,
+                                             rocsparse_int*            row_begin,
+                                             rocsparse_int*            row_end)
+{
+    // Check if descriptor is valid
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    if(row_begin == nullptr || row_end == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *row_begin = descr->row_range_begin;
+    *row_end   = descr->row_range_end;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse_set_mat_ell_pitched(rocsparse_mat_descr descr, rocsparse_int pitched)
+{
+    // Check if descriptor is valid
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    descr->ell_pitched = (pitched != 0);
+    return rocsparse_status_success;
+}
+
+rocsparse_int rocsparse_get_mat_ell_pitch(const rocsparse_mat_descr descr, rocsparse_int m)
+{
+    // If descriptor is invalid, the tight pitch is returned
+    return ell_get_pitch(descr, m);
+}
+
 /********************************************************************************
  * \brief rocsparse_create_hyb_mat is a structure holding the rocsparse HYB
  * matrix. It must be initialized using rocsparse_create_hyb_mat()
@@ -416,6 +636,10 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
         {
             RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
         }
+        if(hyb->ell_row_nnz != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_row_nnz));
+        }
 
         // Clean up COO part
         if(hyb->coo_row_ind != nullptr)
@@ -430,6 +654,10 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
         {
             RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
         }
+        if(hyb->coo_row_offset != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_offset));
+        }
 
         delete hyb;
     }
@@ -441,15 +669,15 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
 }
 
 /********************************************************************************
- * \brief rocsparse_mat_info is a structure holding the matrix info data that is
- * gathered during the analysis routines. It must be initialized by calling
- * rocsparse_create_mat_info() and the returned info structure must be passed
- * to all subsequent function calls that require additional information. It
- * should be destroyed at the end using rocsparse_destroy_mat_info().
+ * \brief rocsparse_create_bsr_mat is a structure holding the rocsparse BSR
+ * matrix. It must be initialized using rocsparse_create_bsr_mat()
+ * and the retured handle must be passed to all subsequent library function
+ * calls that involve the BSR matrix.
+ * It should be destroyed at the end using rocsparse_destroy_bsr_mat().
  *******************************************************************************/
-rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info)
+rocsparse_status rocsparse_create_bsr_mat(rocsparse_bsr_mat* bsr)
 {
-    if(info == nullptr)
+    if(bsr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -458,7 +686,7 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info)
         // Allocate
         try
         {
-            *info = new _rocsparse_mat_info;
+            *bsr = new _rocsparse_bsr_mat;
         }
         catch(const rocsparse_status& status)
         {
@@ -469,50 +697,1834 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info)
 }
 
 /********************************************************************************
- * \brief Destroy mat info.
+ * \brief Destroy BSR matrix.
  *******************************************************************************/
-rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
+rocsparse_status rocsparse_destroy_bsr_mat(rocsparse_bsr_mat bsr)
 {
-    if(info == nullptr)
+    // Destruct
+    try
     {
-        return rocsparse_status_success;
-    }
+        if(bsr->bsr_row_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(bsr->bsr_row_ptr));
+        }
+        if(bsr->bsr_col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(bsr->bsr_col_ind));
+        }
+        if(bsr->bsr_val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(bsr->bsr_val));
+        }
 
-    // Uncouple shared meta data
-    // TODO add more crossover data here
-    if(info->csrsv_lower_info == info->csrilu0_info)
+        delete bsr;
+    }
+    catch(const rocsparse_status& status)
     {
-        info->csrsv_lower_info = nullptr;
+        return status;
     }
+    return rocsparse_status_success;
+}
 
-    // Clear csrmv info struct
-    if(info->csrmv_info != nullptr)
+/********************************************************************************
+ * \brief rocsparse_create_dcsr_mat is a structure holding the rocsparse DCSR
+ * matrix. It must be initialized using rocsparse_create_dcsr_mat()
+ * and the retured handle must be passed to all subsequent library function
+ * calls that involve the DCSR matrix.
+ * It should be destroyed at the end using rocsparse_destroy_dcsr_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_dcsr_mat(rocsparse_dcsr_mat* dcsr)
+{
+    if(dcsr == nullptr)
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
+        return rocsparse_status_invalid_pointer;
     }
-
-    // Clear csrilu0 info struct
-    if(info->csrilu0_info != nullptr)
+    else
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+        // Allocate
+        try
+        {
+            *dcsr = new _rocsparse_dcsr_mat;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
     }
+}
 
-    // Clear csrsv upper info struct
-    if(info->csrsv_upper_info != nullptr)
+/********************************************************************************
+ * \brief Destroy DCSR matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_dcsr_mat(rocsparse_dcsr_mat dcsr)
+{
+    // Destruct
+    try
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
+        if(dcsr->dcsr_row_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_row_ind));
+        }
+        if(dcsr->dcsr_row_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_row_ptr));
+        }
+        if(dcsr->dcsr_col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_col_ind));
+        }
+        if(dcsr->dcsr_val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(dcsr->dcsr_val));
+        }
+
+        delete dcsr;
     }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
 
-    // Clear csrsv lower info struct
-    if(info->csrsv_lower_info != nullptr)
+/********************************************************************************
+ * \brief rocsparse_create_sell_mat is a structure holding the rocsparse
+ * SELL-C-sigma matrix. It must be initialized using rocsparse_create_sell_mat()
+ * and the retured handle must be passed to all subsequent library function
+ * calls that involve the SELL matrix.
+ * It should be destroyed at the end using rocsparse_destroy_sell_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_sell_mat(rocsparse_sell_mat* sell)
+{
+    if(sell == nullptr)
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *sell = new _rocsparse_sell_mat;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
     }
+}
 
+/********************************************************************************
+ * \brief Destroy SELL matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_sell_mat(rocsparse_sell_mat sell)
+{
     // Destruct
     try
     {
-        delete info;
+        if(sell->slice_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->slice_ptr));
+        }
+        if(sell->perm != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->perm));
+        }
+        if(sell->sell_col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->sell_col_ind));
+        }
+        if(sell->sell_val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(sell->sell_val));
+        }
+
+        delete sell;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_dist_mat is a structure holding a rocsparse matrix
+ * partitioned by rows across multiple devices. It must be initialized using
+ * rocsparse_create_dist_mat() and the returned handle must be passed to all
+ * subsequent library function calls that involve the distributed matrix.
+ * It should be destroyed at the end using rocsparse_destroy_dist_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_dist_mat(rocsparse_dist_mat* dist)
+{
+    if(dist == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *dist = new _rocsparse_dist_mat;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy distributed matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_dist_mat(rocsparse_dist_mat dist)
+{
+    // Destruct
+    try
+    {
+        // Save the active device, the partitions are freed on their owning
+        // devices
+        int current_device;
+        RETURN_IF_HIP_ERROR(hipGetDevice(&current_device));
+
+        for(rocsparse_int p = 0; p < dist->ndevice; ++p)
+        {
+            _rocsparse_dist_mat_part& part = dist->parts[p];
+
+            RETURN_IF_HIP_ERROR(hipSetDevice(part.device));
+
+            if(part.int_row_ptr != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(part.int_row_ptr));
+            }
+            if(part.int_col_ind != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(part.int_col_ind));
+            }
+            if(part.int_val != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(part.int_val));
+            }
+            if(part.bnd_row_ptr != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(part.bnd_row_ptr));
+            }
+            if(part.bnd_col_ind != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(part.bnd_col_ind));
+            }
+            if(part.bnd_val != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(part.bnd_val));
+            }
+            if(part.halo_x != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(part.halo_x));
+            }
+
+            if(part.comm_stream != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipStreamDestroy(part.comm_stream));
+            }
+            if(part.x_ready != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipEventDestroy(part.x_ready));
+            }
+            if(part.halo_sent != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipEventDestroy(part.halo_sent));
+            }
+            if(part.halo_done != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipEventDestroy(part.halo_done));
+            }
+
+            // Gather maps and staging buffers reside on the peer devices
+            for(rocsparse_int q = 0; q < dist->ndevice; ++q)
+            {
+                if(part.gather_ind[q] != nullptr)
+                {
+                    RETURN_IF_HIP_ERROR(hipSetDevice(dist->parts[q].device));
+                    RETURN_IF_HIP_ERROR(hipFree(part.gather_ind[q]));
+                    RETURN_IF_HIP_ERROR(hipFree(part.gather_buf[q]));
+                }
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(hipSetDevice(current_device));
+
+        delete dist;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_split_mat is a structure holding a rocsparse matrix
+ * split by rows between the device and the host. It must be initialized using
+ * rocsparse_create_split_mat() and the returned handle must be passed to all
+ * subsequent library function calls that involve the split matrix.
+ * It should be destroyed at the end using rocsparse_destroy_split_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_split_mat(rocsparse_split_mat* split)
+{
+    if(split == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *split = new _rocsparse_split_mat;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy split matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_split_mat(rocsparse_split_mat split)
+{
+    // Destruct
+    try
+    {
+        // Save the active device, the device partition is freed on its
+        // owning device
+        int current_device;
+        RETURN_IF_HIP_ERROR(hipGetDevice(&current_device));
+
+        RETURN_IF_HIP_ERROR(hipSetDevice(split->device));
+
+        if(split->dev_row_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(split->dev_row_ptr));
+        }
+        if(split->dev_col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(split->dev_col_ind));
+        }
+        if(split->dev_val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(split->dev_val));
+        }
+
+        if(split->host_row_ptr != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipHostFree(split->host_row_ptr));
+        }
+        if(split->host_col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipHostFree(split->host_col_ind));
+        }
+        if(split->host_val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipHostFree(split->host_val));
+        }
+        if(split->host_x != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipHostFree(split->host_x));
+        }
+        if(split->host_y != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipHostFree(split->host_y));
+        }
+
+        if(split->stage_stream != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamDestroy(split->stage_stream));
+        }
+        if(split->x_ready != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipEventDestroy(split->x_ready));
+        }
+        if(split->y_merged != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipEventDestroy(split->y_merged));
+        }
+
+        RETURN_IF_HIP_ERROR(hipSetDevice(current_device));
+
+        delete split;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Allocate one padded matrix array. The element count is padded to
+ * the next wavefront multiple of the device and the padding is zero filled,
+ * such that wavefront wide vector loads never run past the allocation. The
+ * allocation size is rounded up to the texture alignment of the device.
+ *******************************************************************************/
+static rocsparse_status rocsparse_padded_malloc(rocsparse_handle handle,
+                                                size_t           nelem,
+                                                size_t           elem_size,
+                                                void**           ptr)
+{
+    size_t wf = handle->wavefront_size;
+
+    size_t padded = ((nelem + wf - 1) / wf) * wf;
+    size_t bytes  = padded * elem_size;
+
+    size_t alignment = handle->properties.textureAlignment;
+
+    if(alignment > 0)
+    {
+        bytes = ((bytes + alignment - 1) / alignment) * alignment;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMalloc(ptr, bytes));
+
+    // Zero fill the padding ; a padded column index references x[0] and a
+    // zero value contributes nothing
+    if(bytes > nelem * elem_size)
+    {
+        RETURN_IF_HIP_ERROR(hipMemset(reinterpret_cast<char*>(*ptr) + nelem * elem_size,
+                                      0,
+                                      bytes - nelem * elem_size));
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Allocate the arrays of a CSR matrix with the padding and alignment
+ * the vectorized kernels expect.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr_malloc(rocsparse_handle handle,
+                                      rocsparse_int    m,
+                                      rocsparse_int    nnz,
+                                      size_t           val_size,
+                                      rocsparse_int**  csr_row_ptr,
+                                      rocsparse_int**  csr_col_ind,
+                                      void**           csr_val)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csr_malloc", m, nnz, val_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(val_size == 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_padded_malloc(
+        handle, static_cast<size_t>(m) + 1, sizeof(rocsparse_int), (void**)csr_row_ptr));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_padded_malloc(
+        handle, static_cast<size_t>(nnz), sizeof(rocsparse_int), (void**)csr_col_ind));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_padded_malloc(handle, static_cast<size_t>(nnz), val_size, csr_val));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Allocate the arrays of an ELL matrix with the padding and alignment
+ * the vectorized kernels expect.
+ *******************************************************************************/
+rocsparse_status rocsparse_ell_malloc(rocsparse_handle handle,
+                                      rocsparse_int    m,
+                                      rocsparse_int    ell_width,
+                                      size_t           val_size,
+                                      rocsparse_int**  ell_col_ind,
+                                      void**           ell_val)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_ell_malloc", m, ell_width, val_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ell_width < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(val_size == 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(ell_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    size_t nelem = static_cast<size_t>(m) * ell_width;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_padded_malloc(handle, nelem, sizeof(rocsparse_int), (void**)ell_col_ind));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_padded_malloc(handle, nelem, val_size, ell_val));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csr_builder is a structure holding a rocsparse matrix
+ * under incremental construction. It must be initialized using
+ * rocsparse_create_csr_builder() and the returned handle must be passed to
+ * all subsequent library function calls that append to or finalize the
+ * matrix.
+ * It should be destroyed at the end using rocsparse_destroy_csr_builder().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csr_builder(rocsparse_csr_builder* builder)
+{
+    if(builder == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *builder = new _rocsparse_csr_builder;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy CSR builder.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csr_builder(rocsparse_csr_builder builder)
+{
+    // Destruct
+    try
+    {
+        if(builder->coo_row_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(builder->coo_row_ind));
+        }
+        if(builder->coo_col_ind != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(builder->coo_col_ind));
+        }
+        if(builder->coo_val != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(builder->coo_val));
+        }
+
+        delete builder;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_mat_info is a structure holding the matrix info data that is
+ * gathered during the analysis routines. It must be initialized by calling
+ * rocsparse_create_mat_info() and the returned info structure must be passed
+ * to all subsequent function calls that require additional information. It
+ * should be destroyed at the end using rocsparse_destroy_mat_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_mat_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy mat info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Uncouple shared meta data
+    // TODO add more crossover data here
+    if(info->csrsv_lower_info == info->csrilu0_info || info->csrsv_lower_info == info->csric0_info)
+    {
+        info->csrsv_lower_info = nullptr;
+    }
+
+    if(info->csric0_info == info->csrilu0_info)
+    {
+        info->csric0_info = nullptr;
+    }
+
+    // Clear csrmv info struct
+    if(info->csrmv_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
+    }
+
+    // Clear spmv info struct
+    if(info->spmv_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_spmv_info(info->spmv_info));
+    }
+
+    // Clear csrilu0 info struct
+    if(info->csrilu0_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+    }
+
+    // Clear csric0 info struct
+    if(info->csric0_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csric0_info));
+    }
+
+    // Clear csrsv upper info struct
+    if(info->csrsv_upper_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
+    }
+
+    // Clear csrsv lower info struct
+    if(info->csrsv_lower_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
+    }
+
+    // Clear csriluk info struct
+    if(info->csriluk_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    }
+
+    // Clear csrilut info struct
+    if(info->csrilut_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrilut_info(info->csrilut_info));
+    }
+
+    // Clear csr2csc info struct
+    if(info->csr2csc_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csr2csc_info(info->csr2csc_info));
+    }
+
+    // Clear csrupd info struct
+    if(info->csrupd_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrupd_info(info->csrupd_info));
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+
+/********************************************************************************
+ * \brief Layout of the serialized analysis meta data blob. The fixed size
+ * header is followed by the present sections in ascending bit order of the
+ * section mask. Within a section, the fixed size section header is followed
+ * by its variable length arrays. rocsparse_int arrays are stored raw, the
+ * int_size header field rejects blobs of a differently configured build.
+ *******************************************************************************/
+#define ROCSPARSE_INFO_BLOB_MAGIC 0x52435350
+#define ROCSPARSE_INFO_BLOB_VERSION 2
+
+#define ROCSPARSE_INFO_BLOB_CSRMV 0x1
+#define ROCSPARSE_INFO_BLOB_CSRILU0 0x2
+#define ROCSPARSE_INFO_BLOB_CSRIC0 0x4
+#define ROCSPARSE_INFO_BLOB_CSRSV_UPPER 0x8
+#define ROCSPARSE_INFO_BLOB_CSRSV_LOWER 0x10
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t int_size;
+    uint32_t wavefront_size;
+    uint32_t sections;
+    uint32_t reserved;
+} rocsparse_info_blob_header;
+
+typedef struct
+{
+    uint64_t hash;
+    int64_t  m;
+    int64_t  n;
+    int64_t  nnz;
+    uint64_t size;
+    int32_t  tuning;
+    uint8_t  use_merge_path;
+    uint8_t  has_narrow;
+    uint8_t  use_binned_path;
+    uint8_t  use_col_blocked;
+    int64_t  bin_size[3];
+    int64_t  num_col_panels;
+} rocsparse_info_blob_csrmv;
+
+typedef struct
+{
+    int64_t max_nnz;
+    int64_t nlevels;
+    int64_t m;
+    int64_t nnz;
+} rocsparse_info_blob_csrtr;
+
+/********************************************************************************
+ * \brief Size of a serialized csrmv section.
+ *******************************************************************************/
+static size_t rocsparse_csrmv_section_size(rocsparse_csrmv_info info)
+{
+    size_t size = sizeof(rocsparse_info_blob_csrmv);
+
+    size += info->data->size * sizeof(unsigned long long);
+
+    if(info->data->csr_col_ind_narrow != nullptr)
+    {
+        size += info->data->nnz * sizeof(int32_t);
+    }
+
+    if(info->data->use_binned_path)
+    {
+        size += (info->data->bin_size[0] + info->data->bin_size[1] + info->data->bin_size[2])
+                * sizeof(rocsparse_int);
+    }
+
+    if(info->data->use_col_blocked)
+    {
+        size += (info->data->num_col_panels + 1) * sizeof(rocsparse_int);
+        size += 2 * info->data->col_panel_ptr[info->data->num_col_panels] * sizeof(rocsparse_int);
+    }
+
+    return size;
+}
+
+/********************************************************************************
+ * \brief Size of a serialized csrtr section.
+ *******************************************************************************/
+static size_t rocsparse_csrtr_section_size(rocsparse_csrtr_info info)
+{
+    return sizeof(rocsparse_info_blob_csrtr) + (info->nlevels + 1) * sizeof(rocsparse_int)
+           + 2 * info->m * sizeof(rocsparse_int);
+}
+
+/********************************************************************************
+ * \brief Serialize a csrmv info into the blob at ptr.
+ *******************************************************************************/
+static rocsparse_status rocsparse_serialize_csrmv_info(rocsparse_csrmv_info info, char** ptr)
+{
+    rocsparse_info_blob_csrmv section;
+
+    section.hash            = info->data->hash;
+    section.m               = info->data->m;
+    section.n               = info->data->n;
+    section.nnz             = info->data->nnz;
+    section.size            = info->data->size;
+    section.tuning          = info->data->tuning;
+    section.use_merge_path  = info->data->use_merge_path ? 1 : 0;
+    section.has_narrow      = info->data->csr_col_ind_narrow != nullptr ? 1 : 0;
+    section.use_binned_path = info->data->use_binned_path ? 1 : 0;
+    section.use_col_blocked = info->data->use_col_blocked ? 1 : 0;
+    section.bin_size[0]     = info->data->bin_size[0];
+    section.bin_size[1]     = info->data->bin_size[1];
+    section.bin_size[2]     = info->data->bin_size[2];
+    section.num_col_panels  = info->data->num_col_panels;
+
+    memcpy(*ptr, &section, sizeof(rocsparse_info_blob_csrmv));
+    *ptr += sizeof(rocsparse_info_blob_csrmv);
+
+    if(info->data->size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(*ptr,
+                                      info->data->row_blocks,
+                                      info->data->size * sizeof(unsigned long long),
+                                      hipMemcpyDeviceToHost));
+        *ptr += info->data->size * sizeof(unsigned long long);
+    }
+
+    if(info->data->csr_col_ind_narrow != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(*ptr,
+                                      info->data->csr_col_ind_narrow,
+                                      info->data->nnz * sizeof(int32_t),
+                                      hipMemcpyDeviceToHost));
+        *ptr += info->data->nnz * sizeof(int32_t);
+    }
+
+    if(info->data->use_binned_path)
+    {
+        rocsparse_int nbinned
+            = info->data->bin_size[0] + info->data->bin_size[1] + info->data->bin_size[2];
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            *ptr, info->data->bin_rows, nbinned * sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        *ptr += nbinned * sizeof(rocsparse_int);
+    }
+
+    if(info->data->use_col_blocked)
+    {
+        rocsparse_int num_col_entries = info->data->col_panel_ptr[info->data->num_col_panels];
+
+        memcpy(*ptr,
+               info->data->col_panel_ptr,
+               (info->data->num_col_panels + 1) * sizeof(rocsparse_int));
+        *ptr += (info->data->num_col_panels + 1) * sizeof(rocsparse_int);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(*ptr,
+                                      info->data->col_panel_rows,
+                                      num_col_entries * sizeof(rocsparse_int),
+                                      hipMemcpyDeviceToHost));
+        *ptr += num_col_entries * sizeof(rocsparse_int);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(*ptr,
+                                      info->data->col_panel_begin,
+                                      num_col_entries * sizeof(rocsparse_int),
+                                      hipMemcpyDeviceToHost));
+        *ptr += num_col_entries * sizeof(rocsparse_int);
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Serialize a csrtr info into the blob at ptr.
+ *******************************************************************************/
+static rocsparse_status rocsparse_serialize_csrtr_info(rocsparse_csrtr_info info, char** ptr)
+{
+    rocsparse_info_blob_csrtr section;
+
+    section.max_nnz = info->max_nnz;
+    section.nlevels = info->nlevels;
+    section.m       = info->m;
+    section.nnz     = info->nnz;
+
+    memcpy(*ptr, &section, sizeof(rocsparse_info_blob_csrtr));
+    *ptr += sizeof(rocsparse_info_blob_csrtr);
+
+    memcpy(*ptr, info->level_ptr, (info->nlevels + 1) * sizeof(rocsparse_int));
+    *ptr += (info->nlevels + 1) * sizeof(rocsparse_int);
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(*ptr, info->row_map, info->m * sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    *ptr += info->m * sizeof(rocsparse_int);
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        *ptr, info->csr_diag_ind, info->m * sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    *ptr += info->m * sizeof(rocsparse_int);
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Deserialize a csrmv info from the blob at ptr.
+ *******************************************************************************/
+static rocsparse_status rocsparse_deserialize_csrmv_info(rocsparse_csrmv_info* out, const char** ptr)
+{
+    rocsparse_info_blob_csrmv section;
+    memcpy(&section, *ptr, sizeof(rocsparse_info_blob_csrmv));
+    *ptr += sizeof(rocsparse_info_blob_csrmv);
+
+    rocsparse_csrmv_info info;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info));
+
+    _rocsparse_csrmv_analysis_data* data;
+
+    try
+    {
+        data = new _rocsparse_csrmv_analysis_data;
+    }
+    catch(const rocsparse_status& status)
+    {
+        rocsparse_destroy_csrmv_info(info);
+        return status;
+    }
+
+    info->data = data;
+
+    data->hash            = section.hash;
+    data->m               = static_cast<rocsparse_int>(section.m);
+    data->n               = static_cast<rocsparse_int>(section.n);
+    data->nnz             = static_cast<rocsparse_int>(section.nnz);
+    data->size            = static_cast<size_t>(section.size);
+    data->tuning          = section.tuning;
+    data->use_merge_path  = section.use_merge_path != 0;
+    data->use_binned_path = section.use_binned_path != 0;
+    data->use_col_blocked = section.use_col_blocked != 0;
+    data->bin_size[0]     = static_cast<rocsparse_int>(section.bin_size[0]);
+    data->bin_size[1]     = static_cast<rocsparse_int>(section.bin_size[1]);
+    data->bin_size[2]     = static_cast<rocsparse_int>(section.bin_size[2]);
+    data->num_col_panels  = static_cast<rocsparse_int>(section.num_col_panels);
+
+    // The matrix the analysis is re-attached to is not known at this point,
+    // the verification data is therefore left empty
+    info->trans       = rocsparse_operation_none;
+    info->m           = data->m;
+    info->n           = data->n;
+    info->nnz         = data->nnz;
+    info->descr       = nullptr;
+    info->csr_row_ptr = nullptr;
+    info->csr_col_ind = nullptr;
+
+    if(data->size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&data->row_blocks,
+                                      sizeof(unsigned long long) * data->size));
+        RETURN_IF_HIP_ERROR(hipMemcpy(data->row_blocks,
+                                      *ptr,
+                                      sizeof(unsigned long long) * data->size,
+                                      hipMemcpyHostToDevice));
+        *ptr += data->size * sizeof(unsigned long long);
+    }
+
+    if(section.has_narrow != 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&data->csr_col_ind_narrow, sizeof(int32_t) * data->nnz));
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            data->csr_col_ind_narrow, *ptr, sizeof(int32_t) * data->nnz, hipMemcpyHostToDevice));
+        *ptr += data->nnz * sizeof(int32_t);
+    }
+
+    if(data->use_binned_path)
+    {
+        rocsparse_int nbinned = data->bin_size[0] + data->bin_size[1] + data->bin_size[2];
+
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&data->bin_rows, sizeof(rocsparse_int) * nbinned));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(data->bin_rows, *ptr, sizeof(rocsparse_int) * nbinned, hipMemcpyHostToDevice));
+        *ptr += nbinned * sizeof(rocsparse_int);
+    }
+
+    if(data->use_col_blocked)
+    {
+        data->col_panel_ptr = new rocsparse_int[data->num_col_panels + 1];
+
+        memcpy(data->col_panel_ptr, *ptr, (data->num_col_panels + 1) * sizeof(rocsparse_int));
+        *ptr += (data->num_col_panels + 1) * sizeof(rocsparse_int);
+
+        rocsparse_int num_col_entries = data->col_panel_ptr[data->num_col_panels];
+
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&data->col_panel_rows, sizeof(rocsparse_int) * num_col_entries));
+        RETURN_IF_HIP_ERROR(hipMemcpy(data->col_panel_rows,
+                                      *ptr,
+                                      sizeof(rocsparse_int) * num_col_entries,
+                                      hipMemcpyHostToDevice));
+        *ptr += num_col_entries * sizeof(rocsparse_int);
+
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&data->col_panel_begin, sizeof(rocsparse_int) * num_col_entries));
+        RETURN_IF_HIP_ERROR(hipMemcpy(data->col_panel_begin,
+                                      *ptr,
+                                      sizeof(rocsparse_int) * num_col_entries,
+                                      hipMemcpyHostToDevice));
+        *ptr += num_col_entries * sizeof(rocsparse_int);
+    }
+
+    *out = info;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Deserialize a csrtr info from the blob at ptr.
+ *******************************************************************************/
+static rocsparse_status rocsparse_deserialize_csrtr_info(rocsparse_csrtr_info* out, const char** ptr)
+{
+    rocsparse_info_blob_csrtr section;
+    memcpy(&section, *ptr, sizeof(rocsparse_info_blob_csrtr));
+    *ptr += sizeof(rocsparse_info_blob_csrtr);
+
+    rocsparse_csrtr_info info;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info));
+
+    info->max_nnz = static_cast<rocsparse_int>(section.max_nnz);
+    info->nlevels = static_cast<rocsparse_int>(section.nlevels);
+    info->m       = static_cast<rocsparse_int>(section.m);
+    info->nnz     = static_cast<rocsparse_int>(section.nnz);
+
+    // The matrix the analysis is re-attached to is not known at this point,
+    // the verification data is therefore left empty
+    info->descr       = nullptr;
+    info->csr_row_ptr = nullptr;
+    info->csr_col_ind = nullptr;
+
+    try
+    {
+        info->level_ptr = new rocsparse_int[info->nlevels + 1];
+    }
+    catch(const rocsparse_status& status)
+    {
+        rocsparse_destroy_csrtr_info(info);
+        return status;
+    }
+
+    memcpy(info->level_ptr, *ptr, (info->nlevels + 1) * sizeof(rocsparse_int));
+    *ptr += (info->nlevels + 1) * sizeof(rocsparse_int);
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->row_map, sizeof(rocsparse_int) * info->m));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(info->row_map, *ptr, sizeof(rocsparse_int) * info->m, hipMemcpyHostToDevice));
+    *ptr += info->m * sizeof(rocsparse_int);
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csr_diag_ind, sizeof(rocsparse_int) * info->m));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(info->csr_diag_ind, *ptr, sizeof(rocsparse_int) * info->m, hipMemcpyHostToDevice));
+    *ptr += info->m * sizeof(rocsparse_int);
+
+    // The zero pivot is not part of the blob, it is re-initialized such that
+    // a pivot of the previous process does not leak into this one
+    rocsparse_int max_pivot = std::numeric_limits<rocsparse_int>::max();
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->zero_pivot, sizeof(rocsparse_int)));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(info->zero_pivot, &max_pivot, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+
+    *out = info;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Query the size of the serialized analysis meta data of a mat info.
+ *******************************************************************************/
+rocsparse_status rocsparse_mat_info_serialize_size(rocsparse_handle   handle,
+                                                   rocsparse_mat_info info,
+                                                   size_t*            size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_mat_info_serialize_size", (const void*&)info, (const void*&)size);
+
+    // Check pointer arguments
+    if(info == nullptr || size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *size = sizeof(rocsparse_info_blob_header);
+
+    if(info->csrmv_info != nullptr && info->csrmv_info->data != nullptr)
+    {
+        *size += rocsparse_csrmv_section_size(info->csrmv_info);
+    }
+
+    if(info->csrilu0_info != nullptr)
+    {
+        *size += rocsparse_csrtr_section_size(info->csrilu0_info);
+    }
+
+    if(info->csric0_info != nullptr)
+    {
+        *size += rocsparse_csrtr_section_size(info->csric0_info);
+    }
+
+    if(info->csrsv_upper_info != nullptr)
+    {
+        *size += rocsparse_csrtr_section_size(info->csrsv_upper_info);
+    }
+
+    if(info->csrsv_lower_info != nullptr)
+    {
+        *size += rocsparse_csrtr_section_size(info->csrsv_lower_info);
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Serialize the analysis meta data of a mat info into a host blob.
+ *******************************************************************************/
+rocsparse_status rocsparse_mat_info_serialize(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              void*              buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_mat_info_serialize", (const void*&)info, (const void*&)buffer);
+
+    // Check pointer arguments
+    if(info == nullptr || buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_info_blob_header header;
+
+    header.magic          = ROCSPARSE_INFO_BLOB_MAGIC;
+    header.version        = ROCSPARSE_INFO_BLOB_VERSION;
+    header.int_size       = sizeof(rocsparse_int);
+    header.wavefront_size = handle->wavefront_size;
+    header.sections       = 0;
+    header.reserved       = 0;
+
+    if(info->csrmv_info != nullptr && info->csrmv_info->data != nullptr)
+    {
+        header.sections |= ROCSPARSE_INFO_BLOB_CSRMV;
+    }
+
+    if(info->csrilu0_info != nullptr)
+    {
+        header.sections |= ROCSPARSE_INFO_BLOB_CSRILU0;
+    }
+
+    if(info->csric0_info != nullptr)
+    {
+        header.sections |= ROCSPARSE_INFO_BLOB_CSRIC0;
+    }
+
+    if(info->csrsv_upper_info != nullptr)
+    {
+        header.sections |= ROCSPARSE_INFO_BLOB_CSRSV_UPPER;
+    }
+
+    if(info->csrsv_lower_info != nullptr)
+    {
+        header.sections |= ROCSPARSE_INFO_BLOB_CSRSV_LOWER;
+    }
+
+    char* ptr = reinterpret_cast<char*>(buffer);
+
+    memcpy(ptr, &header, sizeof(rocsparse_info_blob_header));
+    ptr += sizeof(rocsparse_info_blob_header);
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRMV)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_serialize_csrmv_info(info->csrmv_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRILU0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_serialize_csrtr_info(info->csrilu0_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRIC0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_serialize_csrtr_info(info->csric0_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRSV_UPPER)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_serialize_csrtr_info(info->csrsv_upper_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRSV_LOWER)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_serialize_csrtr_info(info->csrsv_lower_info, &ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Re-create the analysis meta data of a mat info from a host blob.
+ *******************************************************************************/
+rocsparse_status rocsparse_mat_info_deserialize(rocsparse_handle   handle,
+                                                rocsparse_mat_info info,
+                                                const void*        buffer,
+                                                size_t             size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_mat_info_deserialize",
+              (const void*&)info,
+              (const void*&)buffer,
+              size);
+
+    // Check pointer arguments
+    if(info == nullptr || buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(size < sizeof(rocsparse_info_blob_header))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Deserializing into a mat info that already carries analysis results
+    // would silently leak them
+    if(info->csrmv_info != nullptr || info->csrilu0_info != nullptr
+       || info->csric0_info != nullptr || info->csrsv_upper_info != nullptr
+       || info->csrsv_lower_info != nullptr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    const char* ptr = reinterpret_cast<const char*>(buffer);
+
+    rocsparse_info_blob_header header;
+    memcpy(&header, ptr, sizeof(rocsparse_info_blob_header));
+    ptr += sizeof(rocsparse_info_blob_header);
+
+    // The blob is tied to the build configuration and to the wavefront size
+    // the analysis was tuned for
+    if(header.magic != ROCSPARSE_INFO_BLOB_MAGIC
+       || header.version != ROCSPARSE_INFO_BLOB_VERSION
+       || header.int_size != sizeof(rocsparse_int)
+       || header.wavefront_size != (uint32_t)handle->wavefront_size)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRMV)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_deserialize_csrmv_info(&info->csrmv_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRILU0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_deserialize_csrtr_info(&info->csrilu0_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRIC0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_deserialize_csrtr_info(&info->csric0_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRSV_UPPER)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_deserialize_csrtr_info(&info->csrsv_upper_info, &ptr));
+    }
+
+    if(header.sections & ROCSPARSE_INFO_BLOB_CSRSV_LOWER)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_deserialize_csrtr_info(&info->csrsv_lower_info, &ptr));
+    }
+
+    // The consumed bytes must match the buffer the caller loaded
+    if(static_cast<size_t>(ptr - reinterpret_cast<const char*>(buffer)) > size)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Arrays below this size are copied regardless of the expected reuse, as
+// the staging cost is negligible
+#define ROCSPARSE_ZERO_COPY_MIN_SIZE (1 << 20)
+
+/********************************************************************************
+ * \brief Stage a host array for device access. Depending on the array size
+ * and the expected number of reading operations, the array is either copied
+ * into a device buffer or registered with the runtime such that the kernels
+ * stream it over the interconnect without a device copy.
+ *******************************************************************************/
+rocsparse_status rocsparse_stage_host_buffer(rocsparse_handle handle,
+                                             size_t           size,
+                                             rocsparse_int    expected_reuse,
+                                             void*            host_ptr,
+                                             void**           dev_ptr)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_stage_host_buffer",
+              size,
+              expected_reuse,
+              (const void*&)host_ptr,
+              (const void*&)dev_ptr);
+
+    // Check pointer arguments
+    if(host_ptr == nullptr || dev_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check size argument
+    if(size == 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(expected_reuse < 1)
+    {
+        expected_reuse = 1;
+    }
+
+    // A device copy moves the array over the interconnect once, the
+    // zero-copy path on each reading operation. For large arrays that are
+    // read only once or twice, streaming them directly avoids the staging
+    // latency and the device memory of the copy
+    if(expected_reuse <= 2 && size >= ROCSPARSE_ZERO_COPY_MIN_SIZE)
+    {
+        RETURN_IF_HIP_ERROR(hipHostRegister(host_ptr, size, hipHostRegisterMapped));
+        RETURN_IF_HIP_ERROR(hipHostGetDevicePointer(dev_ptr, host_ptr, 0));
+
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMalloc(dev_ptr, size));
+    RETURN_IF_HIP_ERROR(hipMemcpy(*dev_ptr, host_ptr, size, hipMemcpyHostToDevice));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Release a host array staged with rocsparse_stage_host_buffer(),
+ * freeing the device copy or unregistering the host memory, whichever the
+ * staging selected.
+ *******************************************************************************/
+rocsparse_status
+    rocsparse_unstage_host_buffer(rocsparse_handle handle, void* host_ptr, void* dev_ptr)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_unstage_host_buffer",
+              (const void*&)host_ptr,
+              (const void*&)dev_ptr);
+
+    // Check pointer arguments
+    if(host_ptr == nullptr || dev_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Distinguish the copy from the zero-copy path by the memory type of
+    // the device pointer
+    hipPointerAttribute_t attributes;
+    RETURN_IF_HIP_ERROR(hipPointerGetAttributes(&attributes, dev_ptr));
+
+    if(attributes.memoryType == hipMemoryTypeDevice)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(dev_ptr));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipHostUnregister(host_ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_concurrent_begin opens a group of data independent calls
+ * that may execute concurrently. The handle stream is swapped to the first
+ * stream of the handle stream pool, ordered behind all prior work on the
+ * user stream.
+ *******************************************************************************/
+rocsparse_status rocsparse_concurrent_begin(rocsparse_handle handle)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_concurrent_begin");
+
+    // Nested groups are not supported
+    if(handle->pool_index >= 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Create the stream pool on first use
+    if(handle->pool_streams.empty())
+    {
+        handle->pool_streams.resize(_rocsparse_handle::stream_pool_size);
+        handle->pool_events.resize(_rocsparse_handle::stream_pool_size);
+        handle->pool_buffer_states.resize(_rocsparse_handle::stream_pool_size);
+
+        for(int i = 0; i < _rocsparse_handle::stream_pool_size; ++i)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipStreamCreateWithFlags(&handle->pool_streams[i], hipStreamNonBlocking));
+            RETURN_IF_HIP_ERROR(
+                hipEventCreateWithFlags(&handle->pool_events[i], hipEventDisableTiming));
+        }
+
+        RETURN_IF_HIP_ERROR(
+            hipEventCreateWithFlags(&handle->pool_fork_event, hipEventDisableTiming));
+    }
+
+    // The scratch buffer is swapped alongside the stream. Releasing a
+    // suballocation is host side bookkeeping that is only safe when all
+    // work using the region runs on a single stream, and routines place
+    // library internal temporaries in the scratch buffer, so grouped calls
+    // on different pool streams must not share it
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    handle->swap_buffer_state(handle->pool_saved_buffer);
+    handle->swap_buffer_state(handle->pool_buffer_states[0]);
+
+    // Allocate the scratch buffer of the pool stream on its first use,
+    // sized like the user facing one
+    if(handle->buffer == nullptr)
+    {
+        handle->buffer_size = handle->pool_saved_buffer.size;
+        RETURN_IF_HIP_ERROR(hipMalloc(&handle->buffer, handle->buffer_size));
+    }
+
+    // Fork the first pool stream off the user stream, such that the group
+    // is ordered behind all previously enqueued work
+    RETURN_IF_HIP_ERROR(hipEventRecord(handle->pool_fork_event, handle->stream));
+    RETURN_IF_HIP_ERROR(
+        hipStreamWaitEvent(handle->pool_streams[0], handle->pool_fork_event, 0));
+
+    handle->pool_saved_stream = handle->stream;
+    handle->stream            = handle->pool_streams[0];
+    handle->pool_index        = 0;
+    handle->pool_used         = 1;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_concurrent_branch switches the open group to the next
+ * stream of the pool. Calls issued after the branch run concurrently with
+ * the calls issued before it.
+ *******************************************************************************/
+rocsparse_status rocsparse_concurrent_branch(rocsparse_handle handle)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_concurrent_branch");
+
+    // No group is open
+    if(handle->pool_index < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Round-robin over the pool ; branching more often than the pool has
+    // streams serializes onto already used ones
+    int next = (handle->pool_index + 1) % _rocsparse_handle::stream_pool_size;
+
+    if(next >= handle->pool_used)
+    {
+        // First use of this stream in the current group, fork it off the
+        // user stream
+        RETURN_IF_HIP_ERROR(
+            hipStreamWaitEvent(handle->pool_streams[next], handle->pool_fork_event, 0));
+        handle->pool_used = next + 1;
+    }
+
+    // Park the scratch buffer of the current pool stream and take over the
+    // one of the next, such that the calls issued after the branch do not
+    // reuse scratch regions of calls still in flight
+    handle->swap_buffer_state(handle->pool_buffer_states[handle->pool_index]);
+    handle->swap_buffer_state(handle->pool_buffer_states[next]);
+
+    if(handle->buffer == nullptr)
+    {
+        handle->buffer_size = handle->pool_saved_buffer.size;
+        RETURN_IF_HIP_ERROR(hipMalloc(&handle->buffer, handle->buffer_size));
+    }
+
+    handle->stream     = handle->pool_streams[next];
+    handle->pool_index = next;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_concurrent_end closes the group and restores the user
+ * stream, which is ordered behind all streams used by the group.
+ *******************************************************************************/
+rocsparse_status rocsparse_concurrent_end(rocsparse_handle handle)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_concurrent_end");
+
+    // No group is open
+    if(handle->pool_index < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Restore the user stream and join all pool streams used by the group
+    handle->stream = handle->pool_saved_stream;
+
+    for(int i = 0; i < handle->pool_used; ++i)
+    {
+        RETURN_IF_HIP_ERROR(hipEventRecord(handle->pool_events[i], handle->pool_streams[i]));
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(handle->stream, handle->pool_events[i], 0));
+    }
+
+    // Park the scratch buffer of the last pool stream and restore the user
+    // facing one
+    handle->swap_buffer_state(handle->pool_buffer_states[handle->pool_index]);
+    handle->swap_buffer_state(handle->pool_saved_buffer);
+
+    handle->pool_index = -1;
+    handle->pool_used  = 0;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_priority_begin opens a section of latency critical calls.
+ * The handle stream is swapped to a high priority side stream, such that the
+ * calls inside the section are scheduled ahead of long running kernels
+ * queued on the user stream. The section is not ordered behind the work in
+ * flight on the user stream, the caller guarantees data independence.
+ *******************************************************************************/
+rocsparse_status rocsparse_priority_begin(rocsparse_handle handle)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_priority_begin");
+
+    // A section is already open
+    if(handle->priority_active)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Create the priority stream on first use with the greatest priority
+    // the device offers
+    if(handle->priority_stream == nullptr)
+    {
+        int least_priority;
+        int greatest_priority;
+
+        RETURN_IF_HIP_ERROR(hipDeviceGetStreamPriorityRange(&least_priority, &greatest_priority));
+        RETURN_IF_HIP_ERROR(hipStreamCreateWithPriority(
+            &handle->priority_stream, hipStreamNonBlocking, greatest_priority));
+        RETURN_IF_HIP_ERROR(
+            hipEventCreateWithFlags(&handle->priority_join_event, hipEventDisableTiming));
+    }
+
+    handle->priority_saved_stream = handle->stream;
+    handle->stream                = handle->priority_stream;
+    handle->priority_active       = true;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_priority_end closes the section and restores the user
+ * stream, which is ordered behind all calls of the section.
+ *******************************************************************************/
+rocsparse_status rocsparse_priority_end(rocsparse_handle handle)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_priority_end");
+
+    // No section is open
+    if(!handle->priority_active)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Restore the user stream and order it behind the section, such that
+    // subsequent consumers of the results are safe
+    handle->stream          = handle->priority_saved_stream;
+    handle->priority_active = false;
+
+    RETURN_IF_HIP_ERROR(hipEventRecord(handle->priority_join_event, handle->priority_stream));
+    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(handle->stream, handle->priority_join_event, 0));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_csr_descr creates a generic API sparse matrix
+ * descriptor for a matrix in CSR storage format. It should be destroyed at
+ * the end using rocsparse_destroy_spmat_descr().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csr_descr(rocsparse_spmat_descr* descr,
+                                            rocsparse_int          rows,
+                                            rocsparse_int          cols,
+                                            rocsparse_int          nnz,
+                                            void*                  csr_row_ptr,
+                                            void*                  csr_col_ind,
+                                            void*                  csr_val,
+                                            rocsparse_index_base   idx_base,
+                                            rocsparse_datatype     data_type)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check data type
+    if(data_type != rocsparse_datatype_f16_r && data_type != rocsparse_datatype_f32_r
+       && data_type != rocsparse_datatype_f64_r && data_type != rocsparse_datatype_f32_c
+       && data_type != rocsparse_datatype_f64_c)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(rows < 0 || cols < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(rows > 0 && csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz > 0 && (csr_col_ind == nullptr || csr_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Allocate
+    try
+    {
+        *descr = new _rocsparse_spmat_descr;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    (*descr)->rows      = rows;
+    (*descr)->cols      = cols;
+    (*descr)->nnz       = nnz;
+    (*descr)->row_data  = csr_row_ptr;
+    (*descr)->col_data  = csr_col_ind;
+    (*descr)->val_data  = csr_val;
+    (*descr)->format    = rocsparse_format_csr;
+    (*descr)->data_type = data_type;
+
+    // Create the owned legacy descriptor and info structure, such that the
+    // generic routines can dispatch to the existing typed templates
+    rocsparse_status status = rocsparse_create_mat_descr(&(*descr)->descr);
+    if(status != rocsparse_status_success)
+    {
+        delete *descr;
+        return status;
+    }
+
+    status = rocsparse_create_mat_info(&(*descr)->info);
+    if(status != rocsparse_status_success)
+    {
+        rocsparse_destroy_mat_descr((*descr)->descr);
+        delete *descr;
+        return status;
+    }
+
+    return rocsparse_set_mat_index_base((*descr)->descr, idx_base);
+}
+
+/********************************************************************************
+ * \brief Destroy a generic API sparse matrix descriptor.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_spmat_descr(rocsparse_spmat_descr descr)
+{
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(descr->info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_descr(descr->descr));
+
+    // Destruct
+    try
+    {
+        delete descr;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_dnvec_descr creates a generic API dense vector
+ * descriptor. It should be destroyed at the end using
+ * rocsparse_destroy_dnvec_descr().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_dnvec_descr(rocsparse_dnvec_descr* descr,
+                                              rocsparse_int          size,
+                                              void*                  values,
+                                              rocsparse_datatype     data_type)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check data type
+    if(data_type != rocsparse_datatype_f16_r && data_type != rocsparse_datatype_f32_r
+       && data_type != rocsparse_datatype_f64_r && data_type != rocsparse_datatype_f32_c
+       && data_type != rocsparse_datatype_f64_c)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check size
+    if(size < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(size > 0 && values == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Allocate
+    try
+    {
+        *descr = new _rocsparse_dnvec_descr;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    (*descr)->size      = size;
+    (*descr)->values    = values;
+    (*descr)->data_type = data_type;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Destroy a generic API dense vector descriptor.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_dnvec_descr(rocsparse_dnvec_descr descr)
+{
+    // Destruct
+    try
+    {
+        delete descr;
     }
     catch(const rocsparse_status& status)
     {
@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "handle.h"
+#include "level2/rocsparse_coomv.hpp"
+#include "level2/rocsparse_csrmv.hpp"
+#include "level2/rocsparse_ellmv.hpp"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <thread>
+
+// Device code of a kernel is loaded and finalized for the active
+// architecture on its first launch. The warm launches below run the
+// frequently used kernels with zero sized inputs, such that the loading
+// cost is paid here instead of inside the first real operation
+__global__ void rocsparse_preload_kernel() {}
+
+// Device pointer to the constant one of the handle, used for the scalar
+// arguments of the warm launches
+template <typename T>
+static const T* rocsparse_preload_one(rocsparse_handle handle);
+
+template <>
+const float* rocsparse_preload_one<float>(rocsparse_handle handle)
+{
+    return handle->sone;
+}
+
+template <>
+const double* rocsparse_preload_one<double>(rocsparse_handle handle)
+{
+    return handle->done;
+}
+
+template <typename T>
+static void rocsparse_preload_kernels(rocsparse_handle handle, hipStream_t stream)
+{
+    const T* one = rocsparse_preload_one<T>(handle);
+
+    // csrmv general, all wavefront tiers of the non-zeros per row dispatch
+    hipLaunchKernelGGL((csrmvn_general_kernel<T, T, 2>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvn_general_kernel<T, T, 4>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvn_general_kernel<T, T, 8>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvn_general_kernel<T, T, 16>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvn_general_kernel<T, T, 32>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvn_general_kernel<T, T, 64>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+
+    // csrmv transpose and conjugate transpose
+    hipLaunchKernelGGL((csrmvt_general_kernel<T, 32, false>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvt_general_kernel<T, 64, false>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvt_general_kernel<T, 32, true>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+    hipLaunchKernelGGL((csrmvt_general_kernel<T, 64, true>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       rocsparse_index_base_zero);
+
+    // y scaling of the csrmv transpose path. The fused coomv kernel is not
+    // warmed, since its grid-wide barrier requires live counters
+    hipLaunchKernelGGL(
+        (csrmv_scale_kernel<T>), dim3(1), dim3(256), 0, stream, 0, one, (T*)nullptr);
+
+    // ellmv
+    hipLaunchKernelGGL((ellmvn_kernel_device_pointer<T>),
+                       dim3(1),
+                       dim3(256),
+                       0,
+                       stream,
+                       0,
+                       0,
+                       0,
+                       0,
+                       one,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       one,
+                       nullptr,
+                       rocsparse_index_base_zero);
+}
+
+// Body of the preloading thread. The warm launches run on a private stream,
+// such that the user stream of the handle stays untouched. The adaptive
+// csrmv kernel requires a populated row blocks structure and keeps loading
+// lazily on its first analyzed SpMV, as do all remaining kernels on their
+// first use
+static void rocsparse_preload(rocsparse_handle handle)
+{
+    if(hipSetDevice(handle->device) != hipSuccess)
+    {
+        return;
+    }
+
+    hipStream_t stream;
+    if(hipStreamCreate(&stream) != hipSuccess)
+    {
+        return;
+    }
+
+    hipLaunchKernelGGL(rocsparse_preload_kernel, dim3(1), dim3(64), 0, stream);
+
+    rocsparse_preload_kernels<float>(handle, stream);
+    rocsparse_preload_kernels<double>(handle, stream);
+
+    PRINT_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    PRINT_IF_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_initialize(rocsparse_handle handle)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_initialize");
+
+    // Only the first call starts the preloading, subsequent calls return
+    // immediately
+    if(handle->preload_started.exchange(true))
+    {
+        return rocsparse_status_success;
+    }
+
+    // The warm launches pass the staged one constants, which are allocated
+    // on first use
+    RETURN_IF_ROCSPARSE_ERROR(handle->ensure_device_memory());
+
+    handle->preload_thread = std::thread(rocsparse_preload, handle);
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,476 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <hip/hip_runtime.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Header of the rocSPARSE binary CSR container. Indices and values are
+// stored type independent as zero based CSR in int64_t and double, the
+// header is followed by nrow + 1 row offsets, nnz column indices and nnz
+// values. The layout matches the cache the rocSPARSE clients write next to
+// parsed mtx files
+struct rocsparse_bin_csr_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    int64_t  nrow;
+    int64_t  ncol;
+    int64_t  nnz;
+};
+
+#define ROCSPARSE_BIN_CSR_MAGIC "rocSPbin"
+#define ROCSPARSE_BIN_CSR_VERSION 1
+
+// Allocate the pinned staging ring of the handle on first use. The ring is
+// retained for the handle lifetime, such that repeated uploads do not pay
+// the synchronizing pinned allocation again
+static rocsparse_status rocsparse_upload_ring_init(rocsparse_handle handle)
+{
+    if(handle->upload_ring[0] != nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    for(int i = 0; i < 2; ++i)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipHostMalloc((void**)&handle->upload_ring[i], _rocsparse_handle::upload_chunk_size));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&handle->upload_done[i], hipEventDisableTiming));
+    }
+
+    return rocsparse_status_success;
+}
+
+// Map a binary CSR container into memory and validate its header. Returns
+// the mapping, or nullptr if the file cannot be read or is malformed, with
+// malformed distinguished through a valid file size in *fsize
+static const char* rocsparse_bin_csr_map(const char*                      filename,
+                                         size_t*                          fsize,
+                                         const rocsparse_bin_csr_header** header)
+{
+    *fsize = 0;
+
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) < 0 || static_cast<size_t>(st.st_size) < sizeof(rocsparse_bin_csr_header))
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    const char* fbuf
+        = static_cast<const char*>(mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0));
+
+    // The mapping keeps the file alive
+    close(fd);
+
+    if(fbuf == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    // The chunks are consumed front to back, read-ahead hides the disk
+    // latency behind the conversion and the device transfers
+    madvise(const_cast<char*>(fbuf), st.st_size, MADV_SEQUENTIAL);
+
+    *fsize = st.st_size;
+
+    const rocsparse_bin_csr_header* h = reinterpret_cast<const rocsparse_bin_csr_header*>(fbuf);
+
+    // Validate header and file size
+    if(memcmp(h->magic, ROCSPARSE_BIN_CSR_MAGIC, 8) != 0 || h->version != ROCSPARSE_BIN_CSR_VERSION
+       || h->nrow < 0 || h->ncol < 0 || h->nnz < 0
+       || *fsize != sizeof(rocsparse_bin_csr_header)
+                        + sizeof(int64_t) * (h->nrow + 1 + h->nnz) + sizeof(double) * h->nnz)
+    {
+        munmap(const_cast<char*>(fbuf), st.st_size);
+        return nullptr;
+    }
+
+    *header = h;
+
+    return fbuf;
+}
+
+// Convert one host array into pinned staging chunks and issue the
+// asynchronous device copies, applying an additive offset during the
+// staging pass. The conversion of a chunk runs while the transfer of the
+// previous chunk is in flight, the handle ring slots are recycled once
+// their event has drained
+template <typename SRC, typename DST>
+static rocsparse_status rocsparse_staged_upload(
+    rocsparse_handle handle, const SRC* src, DST* dst, int64_t size, DST offset)
+{
+    int64_t chunk_elems = _rocsparse_handle::upload_chunk_size / sizeof(DST);
+
+    for(int64_t begin = 0; begin < size; begin += chunk_elems)
+    {
+        int64_t chunk = std::min(chunk_elems, size - begin);
+        int     buf   = handle->upload_head;
+
+        // Recycle the staging slot once its previous transfer has drained
+        if(handle->upload_used[buf])
+        {
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(handle->upload_done[buf]));
+        }
+
+        DST* out = reinterpret_cast<DST*>(handle->upload_ring[buf]);
+
+        for(int64_t i = 0; i < chunk; ++i)
+        {
+            out[i] = static_cast<DST>(src[begin + i]) + offset;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dst + begin, out, sizeof(DST) * chunk, hipMemcpyHostToDevice, handle->stream));
+        RETURN_IF_HIP_ERROR(hipEventRecord(handle->upload_done[buf], handle->stream));
+
+        handle->upload_used[buf] = true;
+        handle->upload_head      = 1 - buf;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+static rocsparse_status rocsparse_read_bin_csr_template(rocsparse_handle          handle,
+                                                        const char*               filename,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        T*                        csr_val,
+                                                        rocsparse_int*            csr_row_ptr,
+                                                        rocsparse_int*            csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xread_bin_csr"),
+              filename,
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(filename == nullptr || csr_val == nullptr || csr_row_ptr == nullptr
+       || csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    size_t                          fsize;
+    const rocsparse_bin_csr_header* h;
+
+    const char* fbuf = rocsparse_bin_csr_map(filename, &fsize, &h);
+    if(fbuf == nullptr)
+    {
+        return fsize == 0 ? rocsparse_status_internal_error : rocsparse_status_invalid_value;
+    }
+
+    // The sizes must match the container, as queried by
+    // rocsparse_read_bin_csr_size()
+    if(h->nrow != m || h->ncol != n || h->nnz != nnz)
+    {
+        munmap(const_cast<char*>(fbuf), fsize);
+        return rocsparse_status_invalid_size;
+    }
+
+    const int64_t* bin_ptr
+        = reinterpret_cast<const int64_t*>(fbuf + sizeof(rocsparse_bin_csr_header));
+    const int64_t* bin_col = bin_ptr + m + 1;
+    const double*  bin_val = reinterpret_cast<const double*>(bin_col + nnz);
+
+    rocsparse_int base = static_cast<rocsparse_int>(descr->base);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_upload_ring_init(handle));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_staged_upload(handle, bin_ptr, csr_row_ptr, m + 1, base));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_staged_upload(handle, bin_col, csr_col_ind, nnz, base));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_staged_upload(handle, bin_val, csr_val, nnz, static_cast<T>(0)));
+
+    // All transfers must have drained before the mapping is released
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
+    munmap(const_cast<char*>(fbuf), fsize);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+static rocsparse_status rocsparse_upload_csr_template(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  host_val,
+                                                      const rocsparse_int*      host_row_ptr,
+                                                      const rocsparse_int*      host_col_ind,
+                                                      rocsparse_index_base      host_base,
+                                                      T*                        csr_val,
+                                                      rocsparse_int*            csr_row_ptr,
+                                                      rocsparse_int*            csr_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xupload_csr"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)host_val,
+              (const void*&)host_row_ptr,
+              (const void*&)host_col_ind,
+              host_base,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind);
+
+    // Check index base
+    if(host_base != rocsparse_index_base_zero && host_base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 && nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(host_val == nullptr || host_row_ptr == nullptr || host_col_ind == nullptr
+       || csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Index base shift, fused into the staging pass such that the
+    // conversion overlaps with the transfers instead of requiring a
+    // separate device kernel after arrival
+    rocsparse_int shift
+        = static_cast<rocsparse_int>(descr->base) - static_cast<rocsparse_int>(host_base);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_upload_ring_init(handle));
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_staged_upload(handle, host_row_ptr, csr_row_ptr, m + 1, shift));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_staged_upload(handle, host_col_ind, csr_col_ind, nnz, shift));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_staged_upload(handle, host_val, csr_val, nnz, static_cast<T>(0)));
+
+    // The host arrays are fully staged at this point, the remaining device
+    // transfers source the pinned ring only and drain asynchronously
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_read_bin_csr_size(rocsparse_handle handle,
+                                                        const char*      filename,
+                                                        rocsparse_int*   m,
+                                                        rocsparse_int*   n,
+                                                        rocsparse_int*   nnz)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_read_bin_csr_size",
+              filename,
+              (const void*&)m,
+              (const void*&)n,
+              (const void*&)nnz);
+
+    // Check pointer arguments
+    if(filename == nullptr || m == nullptr || n == nullptr || nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    size_t                          fsize;
+    const rocsparse_bin_csr_header* h;
+
+    const char* fbuf = rocsparse_bin_csr_map(filename, &fsize, &h);
+    if(fbuf == nullptr)
+    {
+        return fsize == 0 ? rocsparse_status_internal_error : rocsparse_status_invalid_value;
+    }
+
+#ifndef rocsparse_ILP64
+    // The container is not loadable when its sizes overflow rocsparse_int
+    if(h->nrow > std::numeric_limits<int32_t>::max() || h->ncol > std::numeric_limits<int32_t>::max()
+       || h->nnz > std::numeric_limits<int32_t>::max())
+    {
+        munmap(const_cast<char*>(fbuf), fsize);
+        return rocsparse_status_invalid_size;
+    }
+#endif
+
+    *m   = static_cast<rocsparse_int>(h->nrow);
+    *n   = static_cast<rocsparse_int>(h->ncol);
+    *nnz = static_cast<rocsparse_int>(h->nnz);
+
+    munmap(const_cast<char*>(fbuf), fsize);
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sread_bin_csr(rocsparse_handle          handle,
+                                                    const char*               filename,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    float*                    csr_val,
+                                                    rocsparse_int*            csr_row_ptr,
+                                                    rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_read_bin_csr_template<float>(
+        handle, filename, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_dread_bin_csr(rocsparse_handle          handle,
+                                                    const char*               filename,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    double*                   csr_val,
+                                                    rocsparse_int*            csr_row_ptr,
+                                                    rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_read_bin_csr_template<double>(
+        handle, filename, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_supload_csr(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              host_val,
+                                                  const rocsparse_int*      host_row_ptr,
+                                                  const rocsparse_int*      host_col_ind,
+                                                  rocsparse_index_base      host_base,
+                                                  float*                    csr_val,
+                                                  rocsparse_int*            csr_row_ptr,
+                                                  rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_upload_csr_template<float>(handle,
+                                                m,
+                                                nnz,
+                                                descr,
+                                                host_val,
+                                                host_row_ptr,
+                                                host_col_ind,
+                                                host_base,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_dupload_csr(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             host_val,
+                                                  const rocsparse_int*      host_row_ptr,
+                                                  const rocsparse_int*      host_col_ind,
+                                                  rocsparse_index_base      host_base,
+                                                  double*                   csr_val,
+                                                  rocsparse_int*            csr_row_ptr,
+                                                  rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_upload_csr_template<double>(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 host_val,
+                                                 host_row_ptr,
+                                                 host_col_ind,
+                                                 host_base,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind);
+}
@@ -0,0 +1,316 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRBICGSTAB_DEVICE_H
+#define CSRBICGSTAB_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Slots of the device resident scalar workspace of the BiCGStab driver.
+// The constant slots feed the internal SpMV calls, the accumulator slots
+// are filled by the fused dot product kernels of the current iteration and
+// alpha and omega are carried over into the next iteration by the step
+// kernel
+#define CSRBICGSTAB_ONE 0
+#define CSRBICGSTAB_MINUS_ONE 1
+#define CSRBICGSTAB_ZERO 2
+#define CSRBICGSTAB_RHO 3
+#define CSRBICGSTAB_RHO_OLD 4
+#define CSRBICGSTAB_R0V 5
+#define CSRBICGSTAB_TS 6
+#define CSRBICGSTAB_TT 7
+#define CSRBICGSTAB_RR 8
+#define CSRBICGSTAB_ALPHA 9
+#define CSRBICGSTAB_OMEGA 10
+#define CSRBICGSTAB_NRM 11
+
+// Slots of the device resident flag workspace
+#define CSRBICGSTAB_DONE 0
+#define CSRBICGSTAB_NITER 1
+
+// Initialize the scalar constants consumed by the internal SpMV calls and
+// the carried scalars of the first iteration. The remaining slots have
+// been cleared by the preceding memset
+template <typename T>
+__global__ void csrbicgstab_scalars_kernel(T* scalars)
+{
+    scalars[CSRBICGSTAB_ONE]       = static_cast<T>(1);
+    scalars[CSRBICGSTAB_MINUS_ONE] = static_cast<T>(-1);
+    scalars[CSRBICGSTAB_RHO_OLD]   = static_cast<T>(1);
+    scalars[CSRBICGSTAB_ALPHA]     = static_cast<T>(1);
+    scalars[CSRBICGSTAB_OMEGA]     = static_cast<T>(1);
+}
+
+// Initialize the shadow residual with the initial residual and clear the
+// search direction and v
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrbicgstab_init_kernel(rocsparse_int m,
+                                        const T* __restrict__ r,
+                                        T* __restrict__ r0,
+                                        T* __restrict__ p,
+                                        T* __restrict__ v)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        r0[gid] = r[gid];
+        p[gid]  = static_cast<T>(0);
+        v[gid]  = static_cast<T>(0);
+    }
+}
+
+// Accumulate <x, y> into the given slot of the scalar workspace
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrbicgstab_dot_kernel(rocsparse_int m,
+                                       const T* __restrict__ x,
+                                       const T* __restrict__ y,
+                                       T*                   scalars,
+                                       unsigned int         slot,
+                                       const rocsparse_int* flags)
+{
+    // Converged solves skip the remaining iterations on the device
+    if(flags[CSRBICGSTAB_DONE] != 0)
+    {
+        return;
+    }
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T sum = static_cast<T>(0);
+
+    if(gid < m)
+    {
+        sum = x[gid] * y[gid];
+    }
+
+    __shared__ T sdata[BLOCKSIZE / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, BLOCKSIZE, 32>(hipThreadIdx_x, sum, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        atomicAdd(&scalars[slot], sum);
+    }
+}
+
+// Accumulate <t, s> and <t, t> in a single pass
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrbicgstab_dot2_kernel(rocsparse_int m,
+                                        const T* __restrict__ t,
+                                        const T* __restrict__ s,
+                                        T*                   scalars,
+                                        const rocsparse_int* flags)
+{
+    if(flags[CSRBICGSTAB_DONE] != 0)
+    {
+        return;
+    }
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T sum_ts = static_cast<T>(0);
+    T sum_tt = static_cast<T>(0);
+
+    if(gid < m)
+    {
+        T val = t[gid];
+
+        sum_ts = val * s[gid];
+        sum_tt = val * val;
+    }
+
+    __shared__ T sdata[BLOCKSIZE / 32];
+
+    sum_ts = rocsparse_blockreduce_wf_sum<T, BLOCKSIZE, 32>(hipThreadIdx_x, sum_ts, sdata);
+
+    __syncthreads();
+
+    sum_tt = rocsparse_blockreduce_wf_sum<T, BLOCKSIZE, 32>(hipThreadIdx_x, sum_tt, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        atomicAdd(&scalars[CSRBICGSTAB_TS], sum_ts);
+        atomicAdd(&scalars[CSRBICGSTAB_TT], sum_tt);
+    }
+}
+
+// Update the search direction p = r + beta * (p - omega * v) with
+// beta = (rho / rho_old) * (alpha / omega), using alpha and omega carried
+// over from the previous iteration
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrbicgstab_direction_kernel(rocsparse_int m,
+                                             const T* __restrict__ r,
+                                             const T* __restrict__ v,
+                                             T* __restrict__ p,
+                                             const T*             scalars,
+                                             const rocsparse_int* flags)
+{
+    if(flags[CSRBICGSTAB_DONE] != 0)
+    {
+        return;
+    }
+
+    T rho_old = scalars[CSRBICGSTAB_RHO_OLD];
+    T omega   = scalars[CSRBICGSTAB_OMEGA];
+
+    T beta = (rho_old != static_cast<T>(0) && omega != static_cast<T>(0))
+                 ? (scalars[CSRBICGSTAB_RHO] / rho_old) * (scalars[CSRBICGSTAB_ALPHA] / omega)
+                 : static_cast<T>(0);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        p[gid] = rocsparse_fma(beta, rocsparse_fma(-omega, v[gid], p[gid]), r[gid]);
+    }
+}
+
+// Compute s = r - alpha * v. The step size is recomputed from the raw
+// accumulators by each block, such that no intermediate scalar has to be
+// written back
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrbicgstab_s_kernel(rocsparse_int m,
+                                     const T* __restrict__ r,
+                                     const T* __restrict__ v,
+                                     T* __restrict__ s,
+                                     const T*             scalars,
+                                     const rocsparse_int* flags)
+{
+    if(flags[CSRBICGSTAB_DONE] != 0)
+    {
+        return;
+    }
+
+    T r0v = scalars[CSRBICGSTAB_R0V];
+
+    // A vanishing <r0, v> marks a breakdown, the termination is left to
+    // the step kernel
+    T alpha = (r0v != static_cast<T>(0)) ? scalars[CSRBICGSTAB_RHO] / r0v : static_cast<T>(0);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        s[gid] = rocsparse_fma(-alpha, v[gid], r[gid]);
+    }
+}
+
+// Fused solution and residual update x = x + alpha * p + omega * s and
+// r = s - omega * t, accumulating the new <r, r> in the same pass
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrbicgstab_update_kernel(rocsparse_int m,
+                                          const T* __restrict__ p,
+                                          const T* __restrict__ s,
+                                          const T* __restrict__ t,
+                                          T* __restrict__ x,
+                                          T* __restrict__ r,
+                                          T*                   scalars,
+                                          const rocsparse_int* flags)
+{
+    if(flags[CSRBICGSTAB_DONE] != 0)
+    {
+        return;
+    }
+
+    T r0v = scalars[CSRBICGSTAB_R0V];
+    T tt  = scalars[CSRBICGSTAB_TT];
+
+    T alpha = (r0v != static_cast<T>(0)) ? scalars[CSRBICGSTAB_RHO] / r0v : static_cast<T>(0);
+    T omega = (tt != static_cast<T>(0)) ? scalars[CSRBICGSTAB_TS] / tt : static_cast<T>(0);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T sum = static_cast<T>(0);
+
+    if(gid < m)
+    {
+        T res = rocsparse_fma(-omega, t[gid], s[gid]);
+
+        x[gid] = rocsparse_fma(omega, s[gid], rocsparse_fma(alpha, p[gid], x[gid]));
+        r[gid] = res;
+
+        sum = res * res;
+    }
+
+    __shared__ T sdata[BLOCKSIZE / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, BLOCKSIZE, 32>(hipThreadIdx_x, sum, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        atomicAdd(&scalars[CSRBICGSTAB_RR], sum);
+    }
+}
+
+// Advance the device resident iteration state. The residual norm and the
+// convergence decision stay on the device, the host merely polls the done
+// flag every few iterations
+template <typename T>
+__global__ void csrbicgstab_step_kernel(T tol, T* scalars, rocsparse_int* flags)
+{
+    if(flags[CSRBICGSTAB_DONE] != 0)
+    {
+        return;
+    }
+
+    T rr  = scalars[CSRBICGSTAB_RR];
+    T nrm = sqrt(rr);
+
+    scalars[CSRBICGSTAB_NRM] = nrm;
+
+    ++flags[CSRBICGSTAB_NITER];
+
+    if(nrm <= tol)
+    {
+        flags[CSRBICGSTAB_DONE] = 1;
+    }
+
+    T r0v = scalars[CSRBICGSTAB_R0V];
+    T tt  = scalars[CSRBICGSTAB_TT];
+
+    // A breakdown of <r0, v> or <t, t> cannot make further progress
+    if(r0v == static_cast<T>(0) || tt == static_cast<T>(0))
+    {
+        flags[CSRBICGSTAB_DONE] = 1;
+    }
+
+    // Carry alpha and omega over into the next iteration, shift rho and
+    // clear the accumulators
+    scalars[CSRBICGSTAB_ALPHA]
+        = (r0v != static_cast<T>(0)) ? scalars[CSRBICGSTAB_RHO] / r0v : static_cast<T>(0);
+    scalars[CSRBICGSTAB_OMEGA]
+        = (tt != static_cast<T>(0)) ? scalars[CSRBICGSTAB_TS] / tt : static_cast<T>(0);
+
+    scalars[CSRBICGSTAB_RHO_OLD] = scalars[CSRBICGSTAB_RHO];
+    scalars[CSRBICGSTAB_RHO]     = static_cast<T>(0);
+    scalars[CSRBICGSTAB_R0V]     = static_cast<T>(0);
+    scalars[CSRBICGSTAB_TS]      = static_cast<T>(0);
+    scalars[CSRBICGSTAB_TT]      = static_cast<T>(0);
+    scalars[CSRBICGSTAB_RR]      = static_cast<T>(0);
+}
+
+#endif // CSRBICGSTAB_DEVICE_H
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRCG_DEVICE_H
+#define CSRCG_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Slots of the device resident scalar workspace of the CG driver. The
+// constant slots feed the internal SpMV calls, the accumulator slots are
+// filled by the fused dot product kernels of the current iteration
+#define CSRCG_ONE 0
+#define CSRCG_MINUS_ONE 1
+#define CSRCG_ZERO 2
+#define CSRCG_RHO 3
+#define CSRCG_RHO_NEW 4
+#define CSRCG_PQ 5
+#define CSRCG_NRM 6
+
+// Slots of the device resident flag workspace
+#define CSRCG_DONE 0
+#define CSRCG_NITER 1
+
+// Initialize the scalar constants consumed by the internal SpMV calls.
+// The remaining slots have been cleared by the preceding memset
+template <typename T>
+__global__ void csrcg_scalars_kernel(T* scalars)
+{
+    scalars[CSRCG_ONE]       = static_cast<T>(1);
+    scalars[CSRCG_MINUS_ONE] = static_cast<T>(-1);
+}
+
+// Initialize the search direction with the initial residual and accumulate
+// the initial rho = <r, r>
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrcg_init_kernel(rocsparse_int m, const T* __restrict__ r, T* __restrict__ p, T* scalars)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T sum = static_cast<T>(0);
+
+    if(gid < m)
+    {
+        T val = r[gid];
+
+        p[gid] = val;
+        sum    = val * val;
+    }
+
+    __shared__ T sdata[BLOCKSIZE / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, BLOCKSIZE, 32>(hipThreadIdx_x, sum, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        atomicAdd(&scalars[CSRCG_RHO], sum);
+    }
+}
+
+// Accumulate <p, q> into the scalar workspace
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrcg_dot_kernel(rocsparse_int m,
+                                 const T* __restrict__ p,
+                                 const T* __restrict__ q,
+                                 T*                   scalars,
+                                 const rocsparse_int* flags)
+{
+    // Converged solves skip the remaining iterations on the device
+    if(flags[CSRCG_DONE] != 0)
+    {
+        return;
+    }
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T sum = static_cast<T>(0);
+
+    if(gid < m)
+    {
+        sum = p[gid] * q[gid];
+    }
+
+    __shared__ T sdata[BLOCKSIZE / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, BLOCKSIZE, 32>(hipThreadIdx_x, sum, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        atomicAdd(&scalars[CSRCG_PQ], sum);
+    }
+}
+
+// Fused solution and residual update, accumulating the new rho = <r, r> in
+// the same pass. The step size is recomputed from the raw accumulators by
+// each block, such that no intermediate scalar has to be written back
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrcg_update_kernel(rocsparse_int m,
+                                    const T* __restrict__ p,
+                                    const T* __restrict__ q,
+                                    T* __restrict__ x,
+                                    T* __restrict__ r,
+                                    T*                   scalars,
+                                    const rocsparse_int* flags)
+{
+    if(flags[CSRCG_DONE] != 0)
+    {
+        return;
+    }
+
+    T pq = scalars[CSRCG_PQ];
+
+    // A vanishing <p, q> marks a breakdown, keep the iterate untouched and
+    // leave the termination to the step kernel
+    T alpha = (pq != static_cast<T>(0)) ? scalars[CSRCG_RHO] / pq : static_cast<T>(0);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T sum = static_cast<T>(0);
+
+    if(gid < m)
+    {
+        T res = rocsparse_fma(-alpha, q[gid], r[gid]);
+
+        x[gid] = rocsparse_fma(alpha, p[gid], x[gid]);
+        r[gid] = res;
+
+        sum = res * res;
+    }
+
+    __shared__ T sdata[BLOCKSIZE / 32];
+
+    sum = rocsparse_blockreduce_wf_sum<T, BLOCKSIZE, 32>(hipThreadIdx_x, sum, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        atomicAdd(&scalars[CSRCG_RHO_NEW], sum);
+    }
+}
+
+// Update the search direction p = r + beta * p
+template <typename T, unsigned int BLOCKSIZE>
+__global__ void csrcg_direction_kernel(rocsparse_int m,
+                                       const T* __restrict__ r,
+                                       T* __restrict__ p,
+                                       const T*             scalars,
+                                       const rocsparse_int* flags)
+{
+    if(flags[CSRCG_DONE] != 0)
+    {
+        return;
+    }
+
+    T rho = scalars[CSRCG_RHO];
+
+    T beta = (rho != static_cast<T>(0)) ? scalars[CSRCG_RHO_NEW] / rho : static_cast<T>(0);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < m)
+    {
+        p[gid] = rocsparse_fma(beta, p[gid], r[gid]);
+    }
+}
+
+// Advance the device resident iteration state. The residual norm and the
+// convergence decision stay on the device, the host merely polls the done
+// flag every few iterations
+template <typename T>
+__global__ void csrcg_step_kernel(T tol, T* scalars, rocsparse_int* flags)
+{
+    if(flags[CSRCG_DONE] != 0)
+    {
+        return;
+    }
+
+    T rho_new = scalars[CSRCG_RHO_NEW];
+    T nrm     = sqrt(rho_new);
+
+    scalars[CSRCG_NRM] = nrm;
+
+    ++flags[CSRCG_NITER];
+
+    if(nrm <= tol)
+    {
+        flags[CSRCG_DONE] = 1;
+    }
+
+    // A breakdown of <p, q> cannot make further progress
+    if(scalars[CSRCG_PQ] == static_cast<T>(0))
+    {
+        flags[CSRCG_DONE] = 1;
+    }
+
+    // Shift rho and clear the accumulators for the next iteration
+    scalars[CSRCG_RHO]     = rho_new;
+    scalars[CSRCG_RHO_NEW] = static_cast<T>(0);
+    scalars[CSRCG_PQ]      = static_cast<T>(0);
+}
+
+#endif // CSRCG_DEVICE_H
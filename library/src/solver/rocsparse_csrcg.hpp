@@ -0,0 +1,491 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRCG_HPP
+#define ROCSPARSE_CSRCG_HPP
+
+#include "rocsparse.h"
+
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include "../level2/rocsparse_csrmv.hpp"
+#include "csrcg_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csrcg_buffer_size_template(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcg_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Device resident scalar and flag workspace
+    *buffer_size = 512;
+
+    // Temporary vectors r, p and q, 256 byte aligned
+    *buffer_size += ((sizeof(T) * m - 1) / 256 + 1) * 256 * 3;
+
+    return rocsparse_status_success;
+}
+
+// Run the device resident CG iteration. The handle has been switched to
+// device pointer mode by the caller, such that the internal SpMV calls
+// consume the constants kept in the scalar workspace
+template <typename T>
+static rocsparse_status rocsparse_csrcg_run(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            T*                        x,
+                                            const T*                  b,
+                                            T                         tol,
+                                            rocsparse_int             max_iter,
+                                            T*                        scalars,
+                                            rocsparse_int*            flags,
+                                            T*                        r,
+                                            T*                        p,
+                                            T*                        q)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRCG_DIM 256
+    dim3 csrcg_blocks((m - 1) / CSRCG_DIM + 1);
+    dim3 csrcg_threads(CSRCG_DIM);
+
+    // Clear the scalar and flag workspace and set up the constants for the
+    // internal SpMV calls
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(scalars, 0, 256, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(flags, 0, 256, stream));
+
+    hipLaunchKernelGGL((csrcg_scalars_kernel<T>), dim3(1), dim3(1), 0, stream, scalars);
+
+    // Initial residual r = b - A * x
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(r, b, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template<T>(handle,
+                                                          rocsparse_operation_none,
+                                                          m,
+                                                          m,
+                                                          nnz,
+                                                          scalars + CSRCG_MINUS_ONE,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          info,
+                                                          x,
+                                                          scalars + CSRCG_ONE,
+                                                          r));
+
+    // Initial search direction p = r and rho = <r, r>
+    hipLaunchKernelGGL((csrcg_init_kernel<T, CSRCG_DIM>),
+                       csrcg_blocks,
+                       csrcg_threads,
+                       0,
+                       stream,
+                       m,
+                       r,
+                       p,
+                       scalars);
+
+    for(rocsparse_int iter = 0; iter < max_iter; ++iter)
+    {
+        // q = A * p, the meta data gathered by the analysis is reused
+        // across all iterations
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              m,
+                                                              m,
+                                                              nnz,
+                                                              scalars + CSRCG_ONE,
+                                                              descr,
+                                                              csr_val,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              info,
+                                                              p,
+                                                              scalars + CSRCG_ZERO,
+                                                              q));
+
+        // <p, q>
+        hipLaunchKernelGGL((csrcg_dot_kernel<T, CSRCG_DIM>),
+                           csrcg_blocks,
+                           csrcg_threads,
+                           0,
+                           stream,
+                           m,
+                           p,
+                           q,
+                           scalars,
+                           flags);
+
+        // x = x + alpha * p, r = r - alpha * q and rho_new = <r, r>
+        hipLaunchKernelGGL((csrcg_update_kernel<T, CSRCG_DIM>),
+                           csrcg_blocks,
+                           csrcg_threads,
+                           0,
+                           stream,
+                           m,
+                           p,
+                           q,
+                           x,
+                           r,
+                           scalars,
+                           flags);
+
+        // p = r + beta * p
+        hipLaunchKernelGGL((csrcg_direction_kernel<T, CSRCG_DIM>),
+                           csrcg_blocks,
+                           csrcg_threads,
+                           0,
+                           stream,
+                           m,
+                           r,
+                           p,
+                           scalars,
+                           flags);
+
+        // Advance the iteration state and decide about convergence on the
+        // device
+        hipLaunchKernelGGL((csrcg_step_kernel<T>), dim3(1), dim3(1), 0, stream, tol, scalars, flags);
+
+        // Poll the done flag every few iterations. This is the only host
+        // synchronization of the solve, converged systems skip the already
+        // enqueued iterations on the device
+        if((iter & 7) == 7)
+        {
+            rocsparse_int done;
+            RETURN_IF_HIP_ERROR(hipMemcpy(
+                &done, flags + CSRCG_DONE, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+            if(done != 0)
+            {
+                break;
+            }
+        }
+    }
+#undef CSRCG_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrcg_template(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info,
+                                          T*                        x,
+                                          const T*                  b,
+                                          T                         tol,
+                                          rocsparse_int             max_iter,
+                                          rocsparse_int*            niter,
+                                          T*                        nrm_res,
+                                          void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcg"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)x,
+              (const void*&)b,
+              tol,
+              max_iter,
+              (const void*&)niter,
+              (const void*&)nrm_res,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrcg -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> "
+              "--tol",
+              tol,
+              "--maxiter",
+              max_iter);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(max_iter < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check tolerance
+    if(tol < static_cast<T>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid output pointers
+    if(niter == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nrm_res == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(niter, 0, sizeof(rocsparse_int), handle->stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nrm_res, 0, sizeof(T), handle->stream));
+        }
+        else
+        {
+            *niter   = 0;
+            *nrm_res = static_cast<T>(0);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(b == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Carve the temporary storage buffer into the scalar workspace, the
+    // flag workspace and the temporary vectors
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    T* scalars = reinterpret_cast<T*>(ptr);
+    ptr += 256;
+
+    rocsparse_int* flags = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+
+    size_t vec_size = ((sizeof(T) * m - 1) / 256 + 1) * 256;
+
+    T* r = reinterpret_cast<T*>(ptr);
+    ptr += vec_size;
+    T* p = reinterpret_cast<T*>(ptr);
+    ptr += vec_size;
+    T* q = reinterpret_cast<T*>(ptr);
+
+    // The internal SpMV calls consume the device resident constants of the
+    // scalar workspace. Switch the handle to device pointer mode for the
+    // duration of the solve and restore the user mode afterwards
+    rocsparse_pointer_mode user_mode = handle->pointer_mode;
+    handle->pointer_mode             = rocsparse_pointer_mode_device;
+
+    rocsparse_status status = rocsparse_csrcg_run(handle,
+                                                  m,
+                                                  nnz,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  x,
+                                                  b,
+                                                  tol,
+                                                  max_iter,
+                                                  scalars,
+                                                  flags,
+                                                  r,
+                                                  p,
+                                                  q);
+
+    handle->pointer_mode = user_mode;
+
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    // Hand the iteration count and the final residual norm back according
+    // to the pointer mode of the handle
+    if(user_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(niter,
+                                           flags + CSRCG_NITER,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           handle->stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nrm_res,
+                                           scalars + CSRCG_NRM,
+                                           sizeof(T),
+                                           hipMemcpyDeviceToDevice,
+                                           handle->stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            niter, flags + CSRCG_NITER, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nrm_res, scalars + CSRCG_NRM, sizeof(T), hipMemcpyDeviceToHost));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRCG_HPP